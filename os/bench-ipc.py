@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+"""
+IPC microbenchmark runner for the Otium kernel.
+
+Builds and runs the ipc-bench program (ot/user/prog-ipc-bench.cpp), collects
+its BENCH: lines and compares the median of each case against a saved
+baseline, failing if any case got slower by more than the threshold.
+
+    ./bench-ipc.py --platform riscv --save     # record a baseline
+    ./bench-ipc.py --platform riscv            # compare against it
+    ./bench-ipc.py --input log.txt             # compare a captured run (e.g. `run ipc-bench` in the shell)
+
+Baselines are machine-specific and are not checked in.
+
+Uses Meson for building.
+"""
+
+import argparse
+import re
+import subprocess
+import sys
+from pathlib import Path
+from typing import Dict, List, Tuple
+
+PROJECT_ROOT = Path(__file__).parent
+
+# Platform-specific configuration. RISC-V and WASM run the whole suite through
+# the bench_ipc kernel program; POSIX has no kernel and only runs the mpack cases.
+PLATFORMS = {
+    "posix": {
+        "build_dir": PROJECT_ROOT / "build-posix-bench",
+        "setup": ["--buildtype=release"],
+        "target": "ipc-bench",
+        "run": lambda build_dir: [str(build_dir / "ipc-bench")],
+        "timeout": 60,
+    },
+    "riscv": {
+        "build_dir": PROJECT_ROOT / "build-riscv-bench",
+        "setup": ["--cross-file=cross/riscv32.txt", "-Dkernel_prog=bench_ipc", "-Dgraphics_backend=test"],
+        "target": None,
+        "run": lambda build_dir: [str(PROJECT_ROOT / "tools" / "run-qemu-riscv.sh"), str(build_dir)],
+        "timeout": 300,
+    },
+    "wasm": {
+        "build_dir": PROJECT_ROOT / "build-wasm-bench",
+        "setup": ["--cross-file=cross/wasm.txt", "-Dkernel_prog=bench_ipc", "-Dgraphics_backend=test"],
+        "target": None,
+        "run": lambda build_dir: [str(PROJECT_ROOT / "tools" / "run-wasm.sh"), str(build_dir)],
+        "timeout": 300,
+    },
+}
+
+# BENCH: <case> <median> <min> <unit>/op -- case names may contain spaces
+BENCH_LINE = re.compile(r"^BENCH: (.+?)\s+(\d+)\s+(\d+)\s+(\S+)/op$")
+
+Results = Dict[str, Tuple[int, int, str]]
+
+
+def build_and_run(platform: str) -> str:
+    """Configure, compile and run ipc-bench for a platform, returning its output."""
+    config = PLATFORMS[platform]
+    build_dir = config["build_dir"]
+
+    setup_cmd = ["meson", "setup", str(build_dir)] + config["setup"] + ["--reconfigure"]
+    print(f"$ {' '.join(setup_cmd)}")
+    subprocess.run(setup_cmd, check=True, capture_output=True, text=True, cwd=str(PROJECT_ROOT))
+
+    compile_cmd = ["meson", "compile", "-C", str(build_dir)]
+    if config["target"]:
+        compile_cmd.append(config["target"])
+    print(f"$ {' '.join(compile_cmd)}")
+    subprocess.run(compile_cmd, check=True, capture_output=True, text=True, cwd=str(PROJECT_ROOT))
+
+    run_cmd = config["run"](build_dir)
+    print(f"$ {' '.join(run_cmd)}")
+    try:
+        result = subprocess.run(run_cmd, capture_output=True, text=True, timeout=config["timeout"],
+                                cwd=str(PROJECT_ROOT))
+        return result.stdout + result.stderr
+    except subprocess.TimeoutExpired as e:
+        out = e.stdout or ""
+        return out.decode() if isinstance(out, bytes) else out
+
+
+def parse_results(output: str) -> Results:
+    """Extract case -> (median, min, unit) from BENCH: lines."""
+    results: Results = {}
+    for line in output.split("\n"):
+        line = line.strip()
+        if not line.startswith("BENCH:"):
+            continue
+        match = BENCH_LINE.match(line)
+        if match:
+            results[match.group(1)] = (int(match.group(2)), int(match.group(3)), match.group(4))
+        elif "failed" in line or "skipped" in line:
+            print(f"  {line}")
+    return results
+
+
+def save_baseline(path: Path, results: Results) -> None:
+    with open(path, "w") as f:
+        for name, (median, minimum, unit) in results.items():
+            f.write(f"BENCH: {name} {median} {minimum} {unit}/op\n")
+    print(f"Saved {len(results)} cases to {path}")
+
+
+def compare(baseline: Results, current: Results, threshold: float) -> List[str]:
+    """Print a comparison table and return the names of regressed cases."""
+    regressions = []
+    print(f"{'case':<34} {'baseline':>10} {'current':>10} {'change':>8}")
+    for name, (median, _, unit) in current.items():
+        if name not in baseline:
+            print(f"{name:<34} {'-':>10} {median:>10} {'new':>8}")
+            continue
+        base, _, base_unit = baseline[name]
+        if base_unit != unit:
+            print(f"{name:<34} unit changed ({base_unit} -> {unit}), not compared")
+            continue
+        change = (median - base) * 100.0 / base if base else 0.0
+        flag = ""
+        if change > threshold:
+            regressions.append(name)
+            flag = "  REGRESSION"
+        print(f"{name:<34} {base:>10} {median:>10} {change:>+7.1f}%{flag}")
+    for name in baseline:
+        if name not in current:
+            print(f"{name:<34} missing from this run")
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Run IPC microbenchmarks and compare against a baseline")
+    parser.add_argument("--platform", choices=list(PLATFORMS.keys()), default="posix")
+    parser.add_argument("--input", type=Path, help="Compare this captured output instead of building and running")
+    parser.add_argument("--baseline", type=Path, help="Baseline file (default: bench-baseline-<platform>.txt)")
+    parser.add_argument("--save", action="store_true", help="Save this run as the baseline instead of comparing")
+    parser.add_argument("--threshold", type=float, default=10.0,
+                        help="Fail if a case's median is this many percent slower (default: 10)")
+    args = parser.parse_args()
+
+    baseline_path = args.baseline or PROJECT_ROOT / f"bench-baseline-{args.platform}.txt"
+
+    if args.input:
+        output = args.input.read_text()
+    else:
+        output = build_and_run(args.platform)
+
+    current = parse_results(output)
+    if not current:
+        print("No BENCH: results in output:")
+        print(output)
+        sys.exit(1)
+
+    if args.save:
+        save_baseline(baseline_path, current)
+        return
+
+    if not baseline_path.exists():
+        print(f"No baseline at {baseline_path}; run with --save first")
+        sys.exit(1)
+
+    baseline = parse_results(baseline_path.read_text())
+    regressions = compare(baseline, current, args.threshold)
+    if regressions:
+        print(f"\n{len(regressions)} case(s) regressed by more than {args.threshold:.0f}%: {', '.join(regressions)}")
+        sys.exit(1)
+    print(f"\nNo regressions above {args.threshold:.0f}%")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,55 @@
+# Mandelbrot benchmark using expr - same computation as bench-mandelbrot.tcl
+# This exercises: compiled expressions, loops, variables
+
+set MAX_ITER 32
+set WIDTH 128
+set HEIGHT 100
+
+# Mandelbrot bounds in fixed-point (scaled by 256)
+set X_MIN -512
+set X_MAX 256
+set Y_MIN -256
+set Y_MAX 256
+
+proc compute_mandelbrot {} {
+  set x_range [expr {$X_MAX - $X_MIN}]
+  set y_range [expr {$Y_MAX - $Y_MIN}]
+  set total_iters 0
+
+  set py 0
+  while {expr {$py < $HEIGHT}} {
+    set c_imag [expr {$Y_MIN + $py * $y_range / $HEIGHT}]
+
+    set px 0
+    while {expr {$px < $WIDTH}} {
+      set c_real [expr {$X_MIN + $px * $x_range / $WIDTH}]
+
+      set zr 0
+      set zi 0
+      set iter 0
+
+      while {expr {$iter < $MAX_ITER}} {
+        set zr_sq [expr {($zr * $zr) >> 8}]
+        set zi_sq [expr {($zi * $zi) >> 8}]
+
+        if {expr {$zr_sq + $zi_sq > 1024}} {
+          break
+        }
+
+        set zi [expr {((($zr << 1) * $zi) >> 8) + $c_imag}]
+        set zr [expr {$zr_sq - $zi_sq + $c_real}]
+
+        set iter [expr {$iter + 1}]
+      }
+
+      set total_iters [expr {$total_iters + $iter}]
+      set px [expr {$px + 1}]
+    }
+    set py [expr {$py + 1}]
+  }
+
+  return $total_iters
+}
+
+set result [compute_mandelbrot]
+puts $result
@@ -2,12 +2,13 @@
 # bench-tcl.sh - Benchmark Tcl interpreter optimizations
 #
 # Compiles tcl-repl with different optimization flags and measures
-# performance on bench-mandelbrot.tcl
+# performance on bench-mandelbrot.tcl (or the script given as the first
+# argument, e.g. bench-mandelbrot-expr.tcl)
 
 set -e
 
 SCRIPT_DIR="$(cd "$(dirname "$0")" && pwd)"
-SCRIPT="$SCRIPT_DIR/bench-mandelbrot.tcl"
+SCRIPT="${1:-$SCRIPT_DIR/bench-mandelbrot.tcl}"
 RUNS=3
 BUILD_DIR="$SCRIPT_DIR/build-bench"
 
@@ -66,6 +66,16 @@ int oputchar(char);
 
 uint64_t o_time_get(void);
 
+// Finest-grained counter available, for benchmarks: the cycle counter on
+// RISC-V, nanoseconds elsewhere. Only differences are meaningful.
+#ifdef OT_ARCH_RISCV
+#define O_CYCLES_UNIT "cycles"
+#else
+#define O_CYCLES_UNIT "ns"
+#endif
+
+uint64_t o_cycles_get(void);
+
 #define OT_PAGE_SIZE 4096
 
 /** a page sized scratch buffer for general use -- generally not safe to call
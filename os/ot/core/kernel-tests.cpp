@@ -638,6 +638,11 @@ void proc_filesystem_test_client(void) {
     err = file.read_all(content);
     TEST_ASSERT(err == NONE, "Failed to read from nested directory");
     TEST_ASSERT(content.length() == 7, "Nested file size mismatch");
+
+    size_t chunked = 0;
+    err = file.read_chunks([](void *ctx, const char *data, size_t len) { *(size_t *)ctx += len; }, &chunked);
+    TEST_ASSERT(err == NONE, "Failed to read nested file in chunks");
+    TEST_ASSERT(chunked == 7, "Chunked read size mismatch");
   }
 
   // Test 8: Delete file
@@ -885,6 +890,28 @@ void kernel_prog_test_filesystem_fat() {
 }
 #endif
 
+// BENCH_IPC: ipc-bench against the configured servers. It shuts them down
+// when done, so the kernel exits once the results are printed.
+#if KERNEL_PROG == KERNEL_PROG_BENCH_IPC
+void kernel_prog_bench_ipc() {
+#if OT_GRAPHICS_BACKEND != OT_GRAPHICS_BACKEND_NONE
+  extern void proc_graphics(void);
+  process_create("graphics", (const void *)proc_graphics, nullptr, false);
+#endif
+
+#if OT_FILESYSTEM_BACKEND != OT_FILESYSTEM_BACKEND_NONE
+  extern void proc_filesystem(void);
+  process_create("filesystem", (const void *)proc_filesystem, nullptr, false);
+#endif
+
+  // user_program_main is defined in ot/user/user-main.cpp
+  extern void user_program_main(void);
+  char *bench_argv[] = {(char *)"ipc-bench", (char *)"--shutdown"};
+  Arguments bench_args = {2, bench_argv};
+  process_create("ipc-bench", (const void *)user_program_main, &bench_args, false);
+}
+#endif
+
 /**
  * Single entry point for all kernel tests
  */
@@ -913,5 +940,7 @@ void kernel_prog_test() {
   kernel_prog_test_filesystem();
 #elif KERNEL_PROG == KERNEL_PROG_TEST_FILESYSTEM_FAT
   kernel_prog_test_filesystem_fat();
+#elif KERNEL_PROG == KERNEL_PROG_BENCH_IPC
+  kernel_prog_bench_ipc();
 #endif
 }
@@ -110,7 +110,8 @@ uint32_t known_memory_release_process(Pidx pidx);
 #define PAGE_X (1 << 3) // Executable
 #define PAGE_U (1 << 4) // User (accessible in user mode)
 
-enum ProcessState { UNUSED, RUNNABLE, TERMINATED, IPC_RECV_WAIT, IPC_SEND_WAIT };
+// EVENT_WAIT: blocked in ou_wait() until input arrives, an IPC message is sent to it or its wake_time passes
+enum ProcessState { UNUSED, RUNNABLE, TERMINATED, IPC_RECV_WAIT, IPC_SEND_WAIT, EVENT_WAIT };
 
 // Globally unique process ID counter (never reused)
 extern Pid proc_pid_counter;
@@ -173,15 +174,16 @@ struct Process {
   size_t ipc_wait_queue_len;
 
 #ifdef OT_ARCH_WASM
-  bool started; // For WASM: track if process has been started
-  void *fiber;  // emscripten_fiber_t for this process
+  bool started;       // For WASM: track if process has been started
+  void *fiber;        // emscripten_fiber_t for this process
+  uint64_t wake_time; // EVENT_WAIT deadline in o_time_get() units, 0 for none
 #endif
   uint8_t stack[8192] __attribute__((aligned(16)));
 };
 
-// Helper to check if a process is in a running state (RUNNABLE or IPC_RECV_WAIT or IPC_SEND_WAIT)
+// Helper to check if a process is in a running state (RUNNABLE or blocked in IPC or ou_wait)
 inline bool process_is_running(const Process *p) {
-  return p->state == RUNNABLE || p->state == IPC_RECV_WAIT || p->state == IPC_SEND_WAIT;
+  return p->state == RUNNABLE || p->state == IPC_RECV_WAIT || p->state == IPC_SEND_WAIT || p->state == EVENT_WAIT;
 }
 
 // Helper to find pidx from pid (returns PIDX_INVALID if not found)
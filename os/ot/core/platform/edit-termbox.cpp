@@ -179,9 +179,40 @@ struct TermboxBackend : Backend {
     }
   }
 
+  // Scroll rows [0, height) of the terminal up by n rows (down if negative)
+  // with a scroll region, and shift termbox's copy of the screen to match so
+  // tb_present only sends the rows that scrolled in
+  void scrollTextArea(int height, int n) {
+    struct cellbuf *front = &global.front;
+    if (n == 0 || height > front->height || (n < 0 ? -n : n) >= height) {
+      return;
+    }
+    tb_sendf("\x1b[1;%dr\x1b[%d%c\x1b[r", height, n < 0 ? -n : n, n > 0 ? 'S' : 'T');
+
+    int w = front->width;
+    int keep = height - (n < 0 ? -n : n);
+    struct tb_cell *cells = front->cells;
+    if (n > 0) {
+      memmove(cells, cells + n * w, (size_t)keep * w * sizeof(struct tb_cell));
+    } else {
+      memmove(cells + (-n) * w, cells, (size_t)keep * w * sizeof(struct tb_cell));
+    }
+
+    // The terminal blanked the rows that scrolled in; mark them so they are redrawn
+    int first = n > 0 ? keep : 0;
+    for (int i = first * w; i < (first + height - keep) * w; i++) {
+      cells[i].ch = 0;
+    }
+  }
+
   virtual void render(const Editor &ed) override {
-    tb_clear();
     Coord ws = getWindowSize();
+    if (ed.frame.full) {
+      tb_invalidate();
+    } else if (ed.frame.scroll != 0) {
+      scrollTextArea(ws.y, (int)ed.frame.scroll);
+    }
+    tb_clear();
 
     // Draw file lines
     for (int y = 0; y < ws.y; y++) {
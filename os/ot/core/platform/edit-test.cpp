@@ -52,8 +52,9 @@ ou::vector<ou::string> edit_test_run(const Key *keys, size_t count, const ou::ve
   test_editor.mode = (style == EditorStyle::SIMPLE) ? EditorMode::INSERT : EditorMode::NORMAL;
   test_editor.pending_operator = Operator::NONE;
   test_editor.lines.clear();
-  test_editor.file_lines.clear();
+  test_editor.buffer.clear();
   test_editor.render_lines.clear();
+  test_editor.invalidate_frame();
   test_editor.file_name.clear();
   test_editor.status_line.clear();
   test_editor.message_line.clear();
@@ -63,17 +64,28 @@ ou::vector<ou::string> edit_test_run(const Key *keys, size_t count, const ou::ve
 
   // Set initial content if provided
   if (initial_lines) {
+    ou::string content;
     for (size_t i = 0; i < initial_lines->size(); i++) {
-      test_editor.file_lines.push_back((*initial_lines)[i]);
+      if (i > 0) {
+        content.push_back('\n');
+      }
+      content.append((*initial_lines)[i]);
     }
+    test_editor.buffer.load(static_cast<ou::string &&>(content));
   }
 
   // Create and run with test backend
   TestBackend test_backend(keys, count, &test_editor);
   edit_run(&test_backend, &test_editor, nullptr, nullptr);
 
-  // Return the final file contents by moving
-  return static_cast<ou::vector<ou::string> &&>(test_editor.file_lines);
+  // Return the final file contents split into lines
+  ou::vector<ou::string> result;
+  for (size_t i = 0; i < test_editor.buffer.line_count(); i++) {
+    ou::string line;
+    test_editor.buffer.get_line(i, line);
+    result.push_back(static_cast<ou::string &&>(line));
+  }
+  return result;
 }
 
 } // namespace edit
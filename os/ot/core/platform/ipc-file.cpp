@@ -1,5 +1,5 @@
 #include "ot/lib/file.hpp"
-#include "ot/lib/mpack/mpack-reader.hpp"
+#include "ot/lib/mpack/mpack-direct.hpp"
 #include "ot/user/gen/filesystem-client.hpp"
 #include "ot/user/user.hpp"
 #include "ot/user/fs/types.hpp"
@@ -80,7 +80,7 @@ Result<char, ErrorCode> File::getc() {
 
   // Read data from comm page
   PageAddr comm = ou_get_comm_page();
-  MPackReader reader(comm.as<char>(), OT_PAGE_SIZE);
+  MPackDirectReader reader(comm.as<char>(), OT_PAGE_SIZE);
 
   StringView bin;
   if (!reader.read_bin(bin)) {
@@ -127,43 +127,22 @@ ErrorCode File::read_all(ou::string &out_data) {
   out_data.clear();
   FilesystemClient client(fs_pid);
 
-  // Read file in chunks until EOF
-  uintptr_t offset = 0;
-  const uintptr_t chunk_size = 4000; // Leave room for msgpack overhead in 4KB page
-
-  while (true) {
-    auto result = client.read(FileHandleId(handle), offset, chunk_size);
-    if (result.is_err()) {
-      return result.error();
-    }
-
-    uintptr_t bytes_read = result.value();
-    if (bytes_read == 0) {
-      // EOF reached
-      break;
-    }
-
-    // Read data from comm page
-    PageAddr comm = ou_get_comm_page();
-    MPackReader reader(comm.as<char>(), OT_PAGE_SIZE);
-
-    StringView bin;
-    if (!reader.read_bin(bin)) {
-      return FILESYSTEM__IO_ERROR;
-    }
-
-    // Append entire chunk at once (much more efficient than char-by-char)
-    out_data.append(bin.ptr, bin.len);
-
-    offset += bytes_read;
+  // One call for the whole file; the stream pulls a raw comm page per round trip
+  return client.read_stream(FileHandleId(handle)).read_all(out_data);
+}
 
-    // If we read less than requested, we've reached EOF
-    if (bytes_read < chunk_size) {
-      break;
-    }
+ErrorCode File::read_chunks(ChunkCallback callback, void *ctx) {
+  if (!opened) {
+    return FILESYSTEM__INVALID_HANDLE;
   }
 
-  return NONE;
+  FilesystemClient client(fs_pid);
+  StreamReader reader = client.read_stream(FileHandleId(handle));
+  StringView chunk;
+  while (reader.next(chunk)) {
+    callback(ctx, chunk.ptr, chunk.len);
+  }
+  return reader.error();
 }
 
 ErrorCode File::write_all(const ou::string &data) {
@@ -172,35 +151,24 @@ ErrorCode File::write_all(const ou::string &data) {
   }
 
   FilesystemClient client(fs_pid);
+  auto result = client.write_stream(FileHandleId(handle), StringView(data.data(), data.length()));
+  if (result.is_err()) {
+    return result.error();
+  }
+  return NONE;
+}
 
-  // Write file in chunks
-  uintptr_t offset = 0;
-  const uintptr_t chunk_size = 4000; // Leave room for msgpack overhead
-
-  while (offset < data.length()) {
-    size_t remaining = data.length() - offset;
-    size_t to_write = (remaining < chunk_size) ? remaining : chunk_size;
-
-    // Prepare data chunk
-    ou::vector<uint8_t> chunk;
-    for (size_t i = 0; i < to_write; i++) {
-      chunk.push_back(static_cast<uint8_t>(data[offset + i]));
-    }
-
-    // Write chunk
-    auto result = client.write(FileHandleId(handle), offset, chunk);
-    if (result.is_err()) {
-      return result.error();
-    }
-
-    uintptr_t bytes_written = result.value();
-    if (bytes_written != to_write) {
-      return FILESYSTEM__IO_ERROR;
+ErrorCode File::map(const char **out_data, size_t *out_size) {
+  // The filesystem servers can't hand out pages that would ever be returned,
+  // so read the file into one buffer that lives as long as the File
+  if (buffer.empty()) {
+    ErrorCode err = read_all(buffer);
+    if (err != NONE) {
+      return err;
     }
-
-    offset += bytes_written;
   }
-
+  *out_data = buffer.data();
+  *out_size = buffer.length();
   return NONE;
 }
 
@@ -700,6 +700,8 @@ void yield(void) {
 
 extern "C" void kernel_main(void) {
   WRITE_CSR(stvec, (uintptr_t)kernel_entry);
+  // Let user mode read the cycle, time and instret counters (o_cycles_get, o_time_get)
+  WRITE_CSR(scounteren, 0x7);
   // Physical addressing only - no need for SUM bit or page table setup
   kernel_start();
 }
@@ -7,8 +7,8 @@
 #include <stdlib.h>
 
 // Memory region for WASM (simulate __free_ram from linker script)
-// Allocate 16MB for OS use
-static char wasm_ram[16 * 1024 * 1024];
+// Allocate 64MB for OS use (matches the RISC-V linker script)
+static char wasm_ram[64 * 1024 * 1024];
 
 // Define the memory region symbols that the kernel expects
 extern "C" {
@@ -53,6 +53,18 @@ EM_JS(void, js_exit, (), {
   Module.exit();
 });
 
+// Hand control to the host's event loop for up to timeout_ms (-1: no deadline).
+// Returns 1 if input may have arrived. Hosts provide Module.idleWait(timeoutMs),
+// a promise that resolves early (to true) when input arrives; without it, sleep
+// briefly and assume input so that waiting processes poll.
+EM_ASYNC_JS(int, js_idle_wait, (int timeout_ms), {
+  if (typeof Module.idleWait === 'function') {
+    return (await Module.idleWait(timeout_ms)) ? 1 : 0;
+  }
+  await new Promise((resolve) => setTimeout(resolve, timeout_ms < 0 || timeout_ms > 10 ? 10 : timeout_ms));
+  return 1;
+});
+
 // clang-format on
 
 } // end extern "C" for EM_JS
@@ -65,7 +77,6 @@ int oputchar(char ch) {
 }
 
 int ogetchar() {
-  emscripten_sleep(0);
   // Check local buffer first
   if (input_read_pos != input_write_pos) {
     char ch = input_buffer[input_read_pos];
@@ -167,7 +178,69 @@ static void fiber_entry_point(void *arg) {
   yield();
 }
 
-// WASM scheduler loop - runs processes cooperatively with fibers
+// Longest the scheduler keeps running processes without returning to the
+// host's event loop, so input and painting still get through under load
+static const uint64_t HOST_SLICE = O_TIME_UNITS_PER_SECOND / 60;
+static uint64_t last_host_return = 0;
+
+// Make EVENT_WAIT processes runnable: all of them if input may have arrived,
+// otherwise those whose deadline has passed
+static void wake_waiting_processes(bool input, uint64_t now) {
+  for (size_t i = 0; i < PROCS_MAX; i++) {
+    Process *p = &procs[i];
+    if (p->state == EVENT_WAIT && (input || (p->wake_time != 0 && now >= p->wake_time))) {
+      TRACE(LLOUD, "Scheduler: waking process %s (pid=%d)", p->name, p->pid);
+      p->state = RUNNABLE;
+    }
+  }
+}
+
+static void host_wait(int timeout_ms) {
+  bool input = js_idle_wait(timeout_ms) != 0;
+  last_host_return = o_time_get();
+  wake_waiting_processes(input, last_host_return);
+}
+
+// Nothing is runnable: sleep in the host until the earliest deadline or until
+// input arrives. Returns false if no process is waiting on an event, in which
+// case nothing can ever become runnable again, or if process 1 has exited and
+// process_next_runnable() is asking the kernel to shut down.
+static bool scheduler_idle(void) {
+  if (procs[1].state == TERMINATED) {
+    return false;
+  }
+
+  bool waiting = false;
+  uint64_t earliest = 0;
+  for (size_t i = 0; i < PROCS_MAX; i++) {
+    Process *p = &procs[i];
+    if (p->state != EVENT_WAIT) {
+      continue;
+    }
+    waiting = true;
+    if (p->wake_time != 0 && (earliest == 0 || p->wake_time < earliest)) {
+      earliest = p->wake_time;
+    }
+  }
+  if (!waiting) {
+    return false;
+  }
+
+  int timeout_ms = -1;
+  if (earliest != 0) {
+    uint64_t now = o_time_get();
+    uint64_t units = earliest > now ? earliest - now : 0;
+    // Round up, waking early would just come straight back here
+    timeout_ms = (int)((units * 1000 + O_TIME_UNITS_PER_SECOND - 1) / O_TIME_UNITS_PER_SECOND);
+  }
+  TRACE(LLOUD, "Scheduler: all processes blocked, idling for %d ms", timeout_ms);
+  host_wait(timeout_ms);
+  return true;
+}
+
+// WASM scheduler loop - runs processes cooperatively with fibers. Processes
+// blocked in IPC or ou_wait() are skipped; when none is runnable the scheduler
+// awaits the host's event loop rather than spinning
 void scheduler_loop(void) {
   TRACE(LSOFT, "Entering WASM scheduler loop");
 
@@ -181,9 +254,17 @@ void scheduler_loop(void) {
   TRACE(LSOFT, "Initializing scheduler fiber with asyncify stack size %d", SCHEDULER_ASYNCIFY_STACK_SIZE);
   emscripten_fiber_init_from_current_context(&scheduler_fiber, scheduler_asyncify_stack, SCHEDULER_ASYNCIFY_STACK_SIZE);
 
+  last_host_return = o_time_get();
+
   while (true) {
     Process *next;
 
+    uint64_t now = o_time_get();
+    wake_waiting_processes(false, now);
+    if (now - last_host_return >= HOST_SLICE) {
+      host_wait(0);
+    }
+
     // Check if there's a direct switch request (from IPC)
     if (scheduler_next_process) {
       next = scheduler_next_process;
@@ -194,8 +275,11 @@ void scheduler_loop(void) {
       TRACE(LLOUD, "Scheduler picked process %s (pid=%d)", next->name, next->pid);
     }
 
-    // Check if we're done (only idle process left or no processes)
+    // Nothing runnable: wait for an event, or finish if nothing is waiting for one
     if (!next || next == idle_proc) {
+      if (scheduler_idle()) {
+        continue;
+      }
       TRACE(LSOFT, "No more runnable processes, exiting scheduler");
       break;
     }
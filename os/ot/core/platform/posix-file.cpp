@@ -1,13 +1,18 @@
 #include "ot/lib/file.hpp"
 #include <errno.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 namespace ou {
 
 #ifdef OT_POSIX
 File::File(const char *path, FileMode mode)
-    : path_(path), mode_(mode), opened(false), file_handle(nullptr) {}
+    : path_(path), mode_(mode), opened(false), file_handle(nullptr), mapping(nullptr), mapping_size(0) {}
 
 File::~File() {
+  if (mapping) {
+    munmap(mapping, mapping_size);
+  }
   if (opened && file_handle) {
     fclose(file_handle);
   }
@@ -120,6 +125,23 @@ ErrorCode File::read_all(ou::string &out_data) {
   return NONE;
 }
 
+ErrorCode File::read_chunks(ChunkCallback callback, void *ctx) {
+  if (!opened) {
+    return FILESYSTEM__INVALID_HANDLE;
+  }
+
+  if (fseek(file_handle, 0, SEEK_SET) != 0) {
+    return FILESYSTEM__IO_ERROR;
+  }
+
+  char buffer[4096];
+  size_t bytes_read;
+  while ((bytes_read = fread(buffer, 1, sizeof(buffer), file_handle)) > 0) {
+    callback(ctx, buffer, bytes_read);
+  }
+  return ferror(file_handle) ? FILESYSTEM__IO_ERROR : NONE;
+}
+
 ErrorCode File::write_all(const ou::string &data) {
   if (!opened) {
     return FILESYSTEM__INVALID_HANDLE;
@@ -144,6 +166,35 @@ ErrorCode File::write_all(const ou::string &data) {
   return NONE;
 }
 
+ErrorCode File::map(const char **out_data, size_t *out_size) {
+  if (!opened) {
+    return FILESYSTEM__INVALID_HANDLE;
+  }
+
+  if (!mapping) {
+    struct stat st;
+    if (fstat(fileno(file_handle), &st) != 0) {
+      return FILESYSTEM__IO_ERROR;
+    }
+    // mmap rejects zero-length mappings
+    if (st.st_size == 0) {
+      *out_data = "";
+      *out_size = 0;
+      return NONE;
+    }
+    void *p = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fileno(file_handle), 0);
+    if (p == MAP_FAILED) {
+      return FILESYSTEM__IO_ERROR;
+    }
+    mapping = p;
+    mapping_size = st.st_size;
+  }
+
+  *out_data = static_cast<const char *>(mapping);
+  *out_size = mapping_size;
+  return NONE;
+}
+
 #endif
 
 } // namespace ou
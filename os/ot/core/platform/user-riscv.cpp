@@ -58,6 +58,8 @@ SyscallResult syscall(int sysno, int arg0, int arg1, int arg2) {
 
 void ou_exit(void) { syscall(OU_EXIT, 0, 0, 0); }
 void ou_yield(void) { syscall(OU_YIELD, 0, 0, 0); }
+// No interrupt-driven wakeups on RISC-V yet, so waiting is polling
+void ou_wait(uint64_t deadline) { ou_yield(); }
 void ou_shutdown(void) { syscall(OU_SHUTDOWN, 0, 0, 0); }
 void *ou_alloc_pages(size_t count) { return (void *)syscall(OU_ALLOC_PAGE, (int)count, 0, 0).a0; }
 
@@ -20,6 +20,13 @@ extern int oputchar(char ch);
 
 void ou_yield(void) { yield(); }
 
+void ou_wait(uint64_t deadline) {
+  // The scheduler makes us runnable again (see scheduler_loop)
+  current_proc->wake_time = deadline;
+  current_proc->state = EVENT_WAIT;
+  yield();
+}
+
 __attribute__((noreturn)) void ou_exit(void) {
   current_proc->state = TERMINATED;
   // process_exit(current_proc);
@@ -163,8 +170,12 @@ IpcResponse ou_ipc_send(Pid target_pid, uintptr_t flags, intptr_t method, intptr
     process_switch_to(target); // Direct context switch - receiver will process and reply
     // After this returns, we're back in our own context with response available
   } else {
-    // Target is busy - block sender until reply arrives
+    // Target is busy - block sender until reply arrives. A target blocked in
+    // ou_wait() is woken so that it gets to the message
     TRACE_IPC(LLOUD, "IPC: target not in IPC_RECV_WAIT, blocking sender");
+    if (target->state == EVENT_WAIT) {
+      target->state = RUNNABLE;
+    }
     current_proc->state = IPC_SEND_WAIT;
     yield();
   }
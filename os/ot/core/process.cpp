@@ -405,7 +405,7 @@ struct ProgramEntry {
 
 static const ProgramEntry program_registry[] = {
     {"shell"}, {"uishell"},    {"scratch"}, {"spacedemo"}, {"typedemo"},
-    {"echo"},  {"gfxscratch"}, {"edit"},    {nullptr} // Sentinel
+    {"echo"},  {"gfxscratch"}, {"edit"},    {"ipc-bench"}, {nullptr} // Sentinel
 };
 
 // Helper to check if program name is in registry
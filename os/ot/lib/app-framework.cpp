@@ -2,6 +2,7 @@
 #include "ot/lib/app-framework.hpp"
 #include "ot/lib/arena.hpp"
 #include "ot/lib/font-blit16.hpp"
+#include "ot/lib/font-proggy-atlas.hpp"
 #include "ot/lib/font-proggy.hpp"
 #include "ot/user/gen/graphics-client.hpp"
 #include "ot/user/user.hpp"
@@ -17,7 +18,12 @@ extern "C" void oprintf(const char *fmt, ...);
 namespace app {
 
 Framework::Framework(uint32_t *framebuffer, int width, int height)
-    : fb_(framebuffer), width_(width), height_(height), ttf_font_(nullptr), arena_memory_(nullptr), arena_(nullptr) {
+    : fb_(framebuffer), width_(width), height_(height), ttf_font_(nullptr), glyph_cache_(nullptr),
+      glyph_cache_budget_(GlyphCache::DEFAULT_BUDGET), arena_memory_(nullptr), arena_(nullptr) {}
+
+// Pages for the arena are only taken once a glyph actually needs rasterising,
+// so apps that draw from pre-rasterised atlas sizes never allocate them
+void Framework::init_arena() {
   // Allocate pages for arena
   arena_memory_ = ou_alloc_page();
   oprintf("[app] Framework: arena page 0 at %p\n", arena_memory_);
@@ -42,6 +48,11 @@ Framework::Framework(uint32_t *framebuffer, int width, int height)
 }
 
 Framework::~Framework() {
+  if (glyph_cache_) {
+    glyph_cache_->~GlyphCache();
+    ou_free(glyph_cache_);
+    glyph_cache_ = nullptr;
+  }
   if (ttf_font_) {
     sft_freefont(ttf_font_);
     ttf_font_ = nullptr;
@@ -119,128 +130,183 @@ Result<bool, ErrorCode> Framework::init_ttf() {
   }
 
   oprintf("[app] TTF font loaded successfully\n");
-  return Result<bool, ErrorCode>::ok(true);
-}
-
-void Framework::blend_pixel(int x, int y, uint32_t color, uint8_t alpha) {
-  if (x < 0 || x >= width_ || y < 0 || y >= height_) {
-    return;
-  }
-  if (alpha == 0) {
-    return;
-  }
 
-  uint32_t *dst = &fb_[y * width_ + x];
-
-  if (alpha == 255) {
-    *dst = color;
-    return;
+  // Without a cache every glyph is rasterised on each draw, so a failed
+  // allocation here costs speed but not correctness
+  void *cache_mem = ou_malloc(sizeof(GlyphCache));
+  if (cache_mem) {
+    glyph_cache_ = new (cache_mem) GlyphCache(glyph_cache_budget_);
   }
-
-  // Extract source color components
-  uint8_t src_b = color & 0xFF;
-  uint8_t src_g = (color >> 8) & 0xFF;
-  uint8_t src_r = (color >> 16) & 0xFF;
-
-  // Extract destination color components
-  uint8_t dst_b = *dst & 0xFF;
-  uint8_t dst_g = (*dst >> 8) & 0xFF;
-  uint8_t dst_r = (*dst >> 16) & 0xFF;
-
-  // Alpha blend
-  uint8_t out_r = (uint8_t)((src_r * alpha + dst_r * (255 - alpha)) / 255);
-  uint8_t out_g = (uint8_t)((src_g * alpha + dst_g * (255 - alpha)) / 255);
-  uint8_t out_b = (uint8_t)((src_b * alpha + dst_b * (255 - alpha)) / 255);
-
-  *dst = 0xFF000000 | ((uint32_t)out_r << 16) | ((uint32_t)out_g << 8) | out_b;
+  return Result<bool, ErrorCode>::ok(true);
 }
 
-Result<int, ErrorCode> Framework::draw_ttf_char(int x, int y, uint32_t codepoint, uint32_t color, int size_px) {
-  if (!ttf_font_) {
-    return Result<int, ErrorCode>::err(APP__FONT_NOT_LOADED);
+void Framework::set_glyph_cache_budget(size_t bytes) {
+  glyph_cache_budget_ = bytes;
+  if (glyph_cache_) {
+    glyph_cache_->set_budget(bytes);
   }
+}
 
+// Scaler state for one pixel size, using the arena for outline data
+static SFT make_sft(SFT_Font *font, int size_px, lib::Arena *arena) {
   SFT sft = {};
-  sft.font = ttf_font_;
+  sft.font = font;
   sft.xScale = (float)size_px;
   sft.yScale = (float)size_px;
   sft.xOffset = 0;
   sft.yOffset = 0;
   sft.flags = SFT_DOWNWARD_Y;
-  sft.arena = arena_; // Use arena allocator for outline data
+  sft.arena = arena;
+  return sft;
+}
+
+Result<CachedGlyph *, ErrorCode> Framework::lookup_glyph(uint32_t codepoint, int size_px, bool *owned) {
+  *owned = false;
+  if (glyph_cache_) {
+    CachedGlyph *cached = glyph_cache_->find(codepoint, size_px);
+    if (cached) {
+      return Result<CachedGlyph *, ErrorCode>::ok(cached);
+    }
+  }
+
+  if (!arena_memory_) {
+    init_arena();
+  }
+  SFT sft = make_sft(ttf_font_, size_px, arena_);
 
   // Lookup glyph ID
-  SFT_Glyph glyph;
-  if (sft_lookup(&sft, codepoint, &glyph) < 0) {
+  SFT_Glyph glyph_id;
+  if (sft_lookup(&sft, codepoint, &glyph_id) < 0) {
     oprintf("[app] Glyph lookup failed for codepoint %u\n", codepoint);
-    return Result<int, ErrorCode>::err(APP__GLYPH_LOOKUP_FAILED);
+    return Result<CachedGlyph *, ErrorCode>::err(APP__GLYPH_LOOKUP_FAILED);
   }
 
   // Get glyph metrics
-  SFT_GMetrics metrics;
-  if (sft_gmetrics(&sft, glyph, &metrics) < 0) {
+  SFT_GMetrics gmetrics;
+  if (sft_gmetrics(&sft, glyph_id, &gmetrics) < 0) {
     oprintf("[app] Glyph metrics failed for codepoint %u\n", codepoint);
-    return Result<int, ErrorCode>::err(APP__GLYPH_METRICS_FAILED);
+    return Result<CachedGlyph *, ErrorCode>::err(APP__GLYPH_METRICS_FAILED);
   }
 
-  int glyph_w = metrics.minWidth;
-  int glyph_h = metrics.minHeight;
-
-  if (glyph_w <= 0 || glyph_h <= 0) {
-    // Space or empty glyph - just return advance
-    return Result<int, ErrorCode>::ok((int)metrics.advanceWidth);
+  GlyphMetrics metrics;
+  metrics.advance = (int)gmetrics.advanceWidth;
+  metrics.left_bearing = (int)gmetrics.leftSideBearing;
+  metrics.y_offset = gmetrics.yOffset;
+  // Space or empty glyph - cached with metrics only
+  bool blank = gmetrics.minWidth <= 0 || gmetrics.minHeight <= 0;
+  metrics.width = blank ? 0 : gmetrics.minWidth;
+  metrics.height = blank ? 0 : gmetrics.minHeight;
+
+  CachedGlyph *glyph = GlyphCache::allocate(codepoint, size_px, metrics);
+  if (!glyph) {
+    oprintf("[app] Memory alloc failed for glyph %ux%u\n", metrics.width, metrics.height);
+    return Result<CachedGlyph *, ErrorCode>::err(APP__MEMORY_ALLOC_FAILED);
   }
 
-  // Allocate buffer for glyph image
-  uint8_t *pixels = (uint8_t *)ou_malloc((size_t)(glyph_w * glyph_h));
-  if (!pixels) {
-    oprintf("[app] Memory alloc failed for glyph %ux%u\n", glyph_w, glyph_h);
-    return Result<int, ErrorCode>::err(APP__MEMORY_ALLOC_FAILED);
+  if (!blank) {
+    SFT_Image image = {};
+    image.pixels = glyph->coverage();
+    image.width = metrics.width;
+    image.height = metrics.height;
+
+    int rendered = sft_render(&sft, glyph_id, image);
+
+    // Reset arena for next glyph
+    if (arena_) {
+      arena_->reset();
+    }
+
+    if (rendered < 0) {
+      oprintf("[app] Glyph render failed for codepoint %u\n", codepoint);
+      GlyphCache::release(glyph);
+      return Result<CachedGlyph *, ErrorCode>::err(APP__GLYPH_RENDER_FAILED);
+    }
   }
 
-  SFT_Image image = {};
-  image.pixels = pixels;
-  image.width = glyph_w;
-  image.height = glyph_h;
+  if (!glyph_cache_ || !glyph_cache_->insert(glyph)) {
+    *owned = true;
+  }
+  return Result<CachedGlyph *, ErrorCode>::ok(glyph);
+}
 
-  if (sft_render(&sft, glyph, image) < 0) {
-    oprintf("[app] Glyph render failed for codepoint %u\n", codepoint);
-    ou_free(pixels);
-    return Result<int, ErrorCode>::err(APP__GLYPH_RENDER_FAILED);
+bool Framework::line_metrics(int size_px, LineMetrics *out) {
+  const FontAtlas *atlas = find_font_atlas(proggy_atlas, proggy_atlas_count, size_px);
+  if (atlas) {
+    out->ascender = atlas->ascender;
+    out->descender = atlas->descender;
+    out->line_gap = atlas->line_gap;
+    return true;
+  }
+  if (glyph_cache_ && glyph_cache_->find_line_metrics(size_px, out)) {
+    return true;
   }
 
-  // Get line metrics for baseline calculation
+  SFT sft = make_sft(ttf_font_, size_px, arena_);
   SFT_LMetrics lmetrics;
   if (sft_lmetrics(&sft, &lmetrics) < 0) {
-    ou_free(pixels);
-    return Result<int, ErrorCode>::ok((int)metrics.advanceWidth);
+    return false;
+  }
+
+  out->ascender = (int)lmetrics.ascender;
+  out->descender = (int)lmetrics.descender;
+  out->line_gap = (int)lmetrics.lineGap;
+  if (glyph_cache_) {
+    glyph_cache_->store_line_metrics(size_px, *out);
+  }
+  return true;
+}
+
+void Framework::blend_pixel(int x, int y, uint32_t color, uint8_t alpha) {
+  if (x < 0 || x >= width_ || y < 0 || y >= height_ || alpha == 0) {
+    return;
   }
 
-  // Calculate draw position
-  int draw_x = x + (int)metrics.leftSideBearing;
-  int draw_y = y + (int)lmetrics.ascender + metrics.yOffset;
+  uint32_t *dst = &fb_[y * width_ + x];
+  *dst = alpha == 255 ? color : graphics::blend(*dst, color, alpha);
+}
 
-  // Debug: count non-zero alpha pixels
-  int nonzero_alpha = 0;
+void Framework::blend_mask(int x, int y, const uint8_t *mask, int mask_w, int mask_h, uint32_t color) {
+  graphics::Rect r = graphics::Rect(x, y, mask_w, mask_h).clip(width_, height_);
+  for (int py = r.y; py < r.bottom(); py++) {
+    const uint8_t *row = &mask[(py - y) * mask_w + (r.x - x)];
+    graphics::blend_span(&fb_[py * width_ + r.x], row, r.w, color);
+  }
+}
 
-  // Blit to framebuffer with alpha blending
-  for (int py = 0; py < glyph_h; py++) {
-    for (int px = 0; px < glyph_w; px++) {
-      uint8_t alpha = pixels[py * glyph_w + px];
-      if (alpha > 0)
-        nonzero_alpha++;
-      blend_pixel(draw_x + px, draw_y + py, color, alpha);
-    }
+Result<int, ErrorCode> Framework::draw_ttf_char(int x, int y, uint32_t codepoint, uint32_t color, int size_px) {
+  if (!ttf_font_) {
+    return Result<int, ErrorCode>::err(APP__FONT_NOT_LOADED);
   }
 
-  ou_free(pixels);
+  // Pre-rasterised sizes skip libschrift entirely
+  const FontAtlas *atlas = find_font_atlas(proggy_atlas, proggy_atlas_count, size_px);
+  const AtlasGlyph *atlas_glyph = atlas ? atlas->glyph(codepoint) : nullptr;
+  if (atlas_glyph) {
+    draw_atlas_glyph(x, y, *atlas, *atlas_glyph, color);
+    return Result<int, ErrorCode>::ok(atlas_glyph->advance);
+  }
 
-  // Reset arena for next glyph
-  if (arena_) {
-    arena_->reset();
+  bool owned;
+  auto lookup = lookup_glyph(codepoint, size_px, &owned);
+  if (lookup.is_err()) {
+    return Result<int, ErrorCode>::err(lookup.error());
+  }
+  CachedGlyph *glyph = lookup.value();
+  const GlyphMetrics &metrics = glyph->metrics;
+  int advance = metrics.advance;
+
+  // Blit to framebuffer with alpha blending, relative to the baseline
+  LineMetrics lmetrics;
+  if (metrics.width > 0 && line_metrics(size_px, &lmetrics)) {
+    int draw_x = x + metrics.left_bearing;
+    int draw_y = y + lmetrics.ascender + metrics.y_offset;
+    blend_mask(draw_x, draw_y, glyph->coverage(), metrics.width, metrics.height, color);
   }
 
-  return Result<int, ErrorCode>::ok((int)metrics.advanceWidth);
+  if (owned) {
+    GlyphCache::release(glyph);
+  }
+  return Result<int, ErrorCode>::ok(advance);
 }
 
 Result<int, ErrorCode> Framework::draw_ttf_text(int x, int y, const char *text, uint32_t color, int size_px) {
@@ -281,29 +347,16 @@ Result<int, ErrorCode> Framework::measure_ttf_text(const char *text, int size_px
     return Result<int, ErrorCode>::ok(0);
   }
 
-  SFT sft = {};
-  sft.font = ttf_font_;
-  sft.xScale = (float)size_px;
-  sft.yScale = (float)size_px;
-  sft.flags = SFT_DOWNWARD_Y;
-
   int total_width = 0;
   for (const char *p = text; *p; p++) {
     if (*p == '\n') {
       continue; // Newlines don't contribute to width
     }
 
-    SFT_Glyph glyph;
-    if (sft_lookup(&sft, (uint32_t)(unsigned char)*p, &glyph) < 0) {
-      continue;
-    }
-
-    SFT_GMetrics metrics;
-    if (sft_gmetrics(&sft, glyph, &metrics) < 0) {
-      continue;
+    int advance;
+    if (glyph_advance((uint32_t)(unsigned char)*p, size_px, &advance)) {
+      total_width += advance;
     }
-
-    total_width += (int)metrics.advanceWidth;
   }
 
   return Result<int, ErrorCode>::ok(total_width);
@@ -319,18 +372,11 @@ Result<int, ErrorCode> Framework::draw_ttf_text_wrapped(int x, int y, int max_wi
   }
 
   // Get line metrics for proper line height
-  SFT sft = {};
-  sft.font = ttf_font_;
-  sft.xScale = (float)size_px;
-  sft.yScale = (float)size_px;
-  sft.flags = SFT_DOWNWARD_Y;
-  sft.arena = arena_;
-
-  SFT_LMetrics lmetrics;
-  if (sft_lmetrics(&sft, &lmetrics) < 0) {
+  LineMetrics lmetrics;
+  if (!line_metrics(size_px, &lmetrics)) {
     return Result<int, ErrorCode>::err(APP__GLYPH_METRICS_FAILED);
   }
-  int line_height = (int)(lmetrics.ascender - lmetrics.descender) + 2;
+  int line_height = lmetrics.ascender - lmetrics.descender + 2;
 
   int cursor_x = x;
   int cursor_y = y;
@@ -344,18 +390,11 @@ Result<int, ErrorCode> Framework::draw_ttf_text_wrapped(int x, int y, int max_wi
     }
 
     // Get glyph metrics to check if it fits
-    SFT_Glyph glyph;
-    if (sft_lookup(&sft, (uint32_t)(unsigned char)*p, &glyph) < 0) {
+    int advance;
+    if (!glyph_advance((uint32_t)(unsigned char)*p, size_px, &advance)) {
       continue;
     }
 
-    SFT_GMetrics metrics;
-    if (sft_gmetrics(&sft, glyph, &metrics) < 0) {
-      continue;
-    }
-
-    int advance = (int)metrics.advanceWidth;
-
     // Wrap if this character would exceed max_width
     if (cursor_x + advance > start_x + max_width && cursor_x > start_x) {
       cursor_x = start_x;
@@ -373,6 +412,71 @@ Result<int, ErrorCode> Framework::draw_ttf_text_wrapped(int x, int y, int max_wi
   return Result<int, ErrorCode>::ok(cursor_y - y + line_height);
 }
 
+bool Framework::glyph_advance(uint32_t codepoint, int size_px, int *advance) {
+  const FontAtlas *atlas = find_font_atlas(proggy_atlas, proggy_atlas_count, size_px);
+  const AtlasGlyph *atlas_glyph = atlas ? atlas->glyph(codepoint) : nullptr;
+  if (atlas_glyph) {
+    *advance = atlas_glyph->advance;
+    return true;
+  }
+
+  bool owned;
+  auto lookup = lookup_glyph(codepoint, size_px, &owned);
+  if (lookup.is_err()) {
+    return false;
+  }
+  *advance = lookup.value()->metrics.advance;
+  if (owned) {
+    GlyphCache::release(lookup.value());
+  }
+  return true;
+}
+
+// === PRE-RASTERISED ATLAS ===
+
+bool Framework::has_atlas(int size_px) const {
+  return find_font_atlas(proggy_atlas, proggy_atlas_count, size_px) != nullptr;
+}
+
+void Framework::draw_atlas_glyph(int x, int y, const FontAtlas &atlas, const AtlasGlyph &glyph, uint32_t color) {
+  if (glyph.width == 0) {
+    return;
+  }
+  blend_mask(x + glyph.left_bearing, y + atlas.ascender + glyph.y_offset, atlas.bitmap(&glyph), glyph.width,
+             glyph.height, color);
+}
+
+Result<int, ErrorCode> Framework::draw_atlas_text(int x, int y, const char *text, uint32_t color, int size_px) {
+  const FontAtlas *atlas = find_font_atlas(proggy_atlas, proggy_atlas_count, size_px);
+  if (!atlas) {
+    return Result<int, ErrorCode>::err(APP__NO_FONT_ATLAS);
+  }
+  if (!text) {
+    return Result<int, ErrorCode>::ok(0);
+  }
+
+  int cursor_x = x;
+  int start_x = x;
+
+  for (const char *p = text; *p; p++) {
+    if (*p == '\n') {
+      cursor_x = start_x;
+      y += size_px + 2; // Same line height as draw_ttf_text
+      continue;
+    }
+
+    // Characters outside the atlas are skipped
+    const AtlasGlyph *glyph = atlas->glyph((uint32_t)(unsigned char)*p);
+    if (!glyph) {
+      continue;
+    }
+    draw_atlas_glyph(cursor_x, y, *atlas, *glyph, color);
+    cursor_x += glyph->advance;
+  }
+
+  return Result<int, ErrorCode>::ok(cursor_x - start_x);
+}
+
 // === KEY EVENT PASSTHROUGH ===
 
 bool Framework::pass_key_to_server(GraphicsClient &gfx_client, uint16_t code, uint8_t flags) {
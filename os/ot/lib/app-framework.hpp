@@ -3,6 +3,10 @@
 
 #include "ot/common.h"
 #include "ot/lib/error-codes.hpp"
+#include "ot/lib/font-atlas.hpp"
+#include "ot/lib/glyph-cache.hpp"
+#include "ot/lib/pixel-ops.hpp"
+#include "ot/lib/rect.hpp"
 #include "ot/lib/result.hpp"
 
 // Forward declare libschrift types
@@ -31,12 +35,7 @@ public:
   uint32_t *framebuffer() const { return fb_; }
 
   // Clear framebuffer to a color
-  void clear(uint32_t color = 0xFF000000) {
-    int num_pixels = width_ * height_;
-    for (int i = 0; i < num_pixels; i++) {
-      fb_[i] = color;
-    }
-  }
+  void clear(uint32_t color = 0xFF000000) { graphics::fill_span(fb_, width_ * height_, color); }
 
   // Put a pixel at (x, y) with bounds checking
   void put_pixel(int x, int y, uint32_t color) {
@@ -53,29 +52,46 @@ public:
     return 0;
   }
 
-  // Fill a rectangle
+  // Fill a rectangle (clipped to the framebuffer once, then filled row by row)
   void fill_rect(int x, int y, int w, int h, uint32_t color) {
-    for (int dy = 0; dy < h; dy++) {
-      for (int dx = 0; dx < w; dx++) {
-        put_pixel(x + dx, y + dy, color);
-      }
+    graphics::Rect r = graphics::Rect(x, y, w, h).clip(width_, height_);
+    for (int py = r.y; py < r.bottom(); py++) {
+      graphics::fill_span(&fb_[py * width_ + r.x], r.w, color);
     }
   }
 
   // Draw a horizontal line
-  void draw_hline(int x, int y, int length, uint32_t color) {
-    for (int i = 0; i < length; i++) {
-      put_pixel(x + i, y, color);
-    }
-  }
+  void draw_hline(int x, int y, int length, uint32_t color) { fill_rect(x, y, length, 1, color); }
 
   // Draw a vertical line
   void draw_vline(int x, int y, int length, uint32_t color) {
-    for (int i = 0; i < length; i++) {
-      put_pixel(x, y + i, color);
+    graphics::Rect r = graphics::Rect(x, y, 1, length).clip(width_, height_);
+    for (int py = r.y; py < r.bottom(); py++) {
+      fb_[py * width_ + r.x] = color;
     }
   }
 
+  // Move count full-width rows from src_y to dst_y (the ranges may overlap),
+  // e.g. to scroll part of the screen without redrawing it
+  void move_rows(int src_y, int dst_y, int count) {
+    if (count <= 0 || src_y < 0 || dst_y < 0 || src_y + count > height_ || dst_y + count > height_) {
+      return;
+    }
+    memmove(&fb_[dst_y * width_], &fb_[src_y * width_], (size_t)count * width_ * sizeof(uint32_t));
+  }
+
+  // Blend a solid color over a rectangle with a constant alpha (0-255)
+  void blend_rect(int x, int y, int w, int h, uint32_t color, uint8_t alpha) {
+    graphics::Rect r = graphics::Rect(x, y, w, h).clip(width_, height_);
+    for (int py = r.y; py < r.bottom(); py++) {
+      graphics::blend_span(&fb_[py * width_ + r.x], r.w, color, alpha);
+    }
+  }
+
+  // Blend a solid color through an 8-bit coverage mask (mask_w x mask_h bytes,
+  // row-major) placed at (x, y), e.g. a rendered glyph
+  void blend_mask(int x, int y, const uint8_t *mask, int mask_w, int mask_h, uint32_t color);
+
   // Interpolate between two BGRA colors (0.0 = start, 1.0 = end)
   static uint32_t interpolate_color(uint32_t start, uint32_t end, float t) {
     if (t <= 0.0f)
@@ -139,6 +155,11 @@ public:
   // Check if TTF font is initialized
   bool ttf_available() const { return ttf_font_ != nullptr; }
 
+  // Rasterised glyphs are cached by (codepoint, size) up to a memory budget
+  // (GlyphCache::DEFAULT_BUDGET unless changed); may be called before init_ttf
+  void set_glyph_cache_budget(size_t bytes);
+  GlyphCache *glyph_cache() const { return glyph_cache_; }
+
   // Draw TTF text (size_px is font size in pixels)
   // Returns advance width on success, or error
   Result<int, ErrorCode> draw_ttf_char(int x, int y, uint32_t codepoint, uint32_t color, int size_px);
@@ -151,6 +172,14 @@ public:
   Result<int, ErrorCode> draw_ttf_text_wrapped(int x, int y, int max_width, const char *text, uint32_t color,
                                                int size_px);
 
+  // === PRE-RASTERISED ATLAS (ot/lib/font-proggy-atlas.hpp) ===
+  // Common Proggy sizes are rasterised at build time by tools/embed-font.py.
+  // The draw_ttf_* methods use them automatically; draw_atlas_text draws from
+  // them directly and needs no init_ttf. Returns advance width on success, or
+  // APP__NO_FONT_ATLAS if the size wasn't pre-rasterised.
+  bool has_atlas(int size_px) const;
+  Result<int, ErrorCode> draw_atlas_text(int x, int y, const char *text, uint32_t color, int size_px);
+
   // === KEY EVENT PASSTHROUGH ===
   // Pass key event to graphics server for global hotkey handling (e.g., Alt+1-9 app switching)
   // Returns true if key was consumed by the server, false if app should handle it
@@ -163,15 +192,31 @@ private:
 
   // TTF font state
   SFT_Font *ttf_font_;
+  GlyphCache *glyph_cache_; // Allocated by init_ttf
+  size_t glyph_cache_budget_;
 
   // Arena allocator for TTF rendering (avoids per-glyph malloc/free)
-  // Memory is allocated via ou_alloc_page() in constructor
+  // Memory is allocated via ou_alloc_page() on the first rasterised glyph
   static constexpr size_t ARENA_NUM_PAGES = 2;
   void *arena_memory_; // Points to allocated page(s)
   lib::Arena *arena_;  // Placement-new'd into first part of arena_memory_
 
   // Internal helper to blend a grayscale pixel onto framebuffer
   void blend_pixel(int x, int y, uint32_t color, uint8_t alpha);
+
+  // Find a glyph in the cache, rasterising it on a miss. If the glyph couldn't
+  // be cached, *owned is set and the caller must GlyphCache::release it.
+  Result<CachedGlyph *, ErrorCode> lookup_glyph(uint32_t codepoint, int size_px, bool *owned);
+
+  void init_arena();
+
+  // Cached font line metrics for a size
+  bool line_metrics(int size_px, LineMetrics *out);
+
+  // Advance width of a glyph, from the atlas when the size has one
+  bool glyph_advance(uint32_t codepoint, int size_px, int *advance);
+
+  void draw_atlas_glyph(int x, int y, const FontAtlas &atlas, const AtlasGlyph &glyph, uint32_t color);
 };
 
 } // namespace app
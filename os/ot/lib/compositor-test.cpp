@@ -0,0 +1,108 @@
+// compositor-test.cpp - Unit tests for graphics::Compositor
+
+#include "ot/lib/compositor.hpp"
+#include "vendor/doctest.h"
+
+using graphics::Compositor;
+using graphics::DamageList;
+using graphics::Rect;
+using graphics::Surface;
+
+static const int W = 16;
+static const int H = 16;
+static const uint32_t BG = 0xFF000000;
+
+static void make_surface(Surface &s, uint32_t *pixels, const Rect &r, uint32_t color) {
+  s.pixels = pixels;
+  s.rect = r;
+  s.mapped = true;
+  for (int i = 0; i < r.w * r.h; i++) {
+    pixels[i] = color;
+  }
+}
+
+TEST_CASE("rect subtract") {
+  Rect out[4];
+
+  SUBCASE("disjoint leaves original") {
+    CHECK(graphics::rect_subtract(Rect(0, 0, 10, 10), Rect(20, 20, 5, 5), out) == 1);
+    CHECK(out[0].w == 10);
+  }
+
+  SUBCASE("covered leaves nothing") { CHECK(graphics::rect_subtract(Rect(2, 2, 4, 4), Rect(0, 0, 10, 10), out) == 0); }
+
+  SUBCASE("hole in the middle splits into four") {
+    int n = graphics::rect_subtract(Rect(0, 0, 10, 10), Rect(3, 3, 4, 4), out);
+    CHECK(n == 4);
+    int area = 0;
+    for (int i = 0; i < n; i++) {
+      area += out[i].area();
+      CHECK(out[i].intersect(Rect(3, 3, 4, 4)).empty());
+    }
+    CHECK(area == 100 - 16);
+  }
+}
+
+TEST_CASE("compositor z-order and occlusion") {
+  uint32_t fb[W * H] = {0};
+  uint32_t pa[W * H], pb[8 * 8], pt[W * 2];
+  Compositor c(fb, W, H, BG);
+
+  Surface a, b, bar;
+  make_surface(a, pa, Rect(0, 0, W, H), 0xFFAAAAAA);
+  make_surface(b, pb, Rect(4, 4, 8, 8), 0xFFBBBBBB);
+  make_surface(bar, pt, Rect(0, H - 2, W, 2), 0xFFCCCCCC);
+  bar.always_on_top = true;
+
+  c.attach(&bar);
+  c.attach(&a);
+  c.attach(&b);
+
+  SUBCASE("always-on-top surfaces stay above attached and raised surfaces") {
+    CHECK(c.at(c.count() - 1) == &bar);
+    c.raise(&a);
+    CHECK(c.at(c.count() - 1) == &bar);
+    CHECK(c.at(c.count() - 2) == &a);
+  }
+
+  SUBCASE("present only blits uncovered pixels") {
+    DamageList damage;
+    c.present(&a, Rect(0, 0, W, H), damage);
+    CHECK(fb[0] == 0xFFAAAAAA);
+    CHECK(fb[5 * W + 5] == 0);        // under b
+    CHECK(fb[(H - 1) * W + 3] == 0); // under the taskbar
+    CHECK(damage.bounds().contains(Rect(0, 0, W, 4)));
+  }
+
+  SUBCASE("fully covered surface is occluded and presents nothing") {
+    c.raise(&a);
+    CHECK(c.occluded(&b));
+    DamageList damage;
+    c.present(&b, Rect(0, 0, 8, 8), damage);
+    CHECK(damage.empty());
+    CHECK(fb[5 * W + 5] == 0);
+  }
+
+  SUBCASE("hidden and unmapped surfaces don't occlude") {
+    b.visible = false;
+    CHECK(!c.occluded(&a));
+    Rect parts[Compositor::MAX_PIECES];
+    CHECK(c.visible_parts(&a, Rect(4, 4, 8, 8), parts, Compositor::MAX_PIECES) == 1);
+  }
+
+  SUBCASE("recompose paints the stack bottom to top") {
+    DamageList damage;
+    c.recompose(Rect(0, 0, W, H), damage);
+    CHECK(fb[0] == 0xFFAAAAAA);
+    CHECK(fb[5 * W + 5] == 0xFFBBBBBB);
+    CHECK(fb[(H - 1) * W] == 0xFFCCCCCC);
+  }
+
+  SUBCASE("detached surface reveals the background") {
+    c.detach(&a);
+    DamageList damage;
+    c.recompose(Rect(0, 0, 4, 4), damage);
+    CHECK(fb[0] == BG);
+    CHECK(c.index_of(&a) == -1);
+  }
+}
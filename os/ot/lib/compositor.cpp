@@ -0,0 +1,183 @@
+// compositor.cpp - Window surfaces, z-order and occlusion-culled composition
+
+#include "ot/lib/compositor.hpp"
+#include "ot/lib/pixel-ops.hpp"
+
+namespace graphics {
+
+int rect_subtract(const Rect &a, const Rect &b, Rect out[4]) {
+  if (a.empty()) {
+    return 0;
+  }
+
+  Rect i = a.intersect(b);
+  if (i.empty()) {
+    out[0] = a;
+    return 1;
+  }
+
+  // Full-width bands above and below the overlap, then the pieces to its left
+  // and right within the overlap's rows
+  int n = 0;
+  if (i.y > a.y) {
+    out[n++] = Rect(a.x, a.y, a.w, i.y - a.y);
+  }
+  if (i.bottom() < a.bottom()) {
+    out[n++] = Rect(a.x, i.bottom(), a.w, a.bottom() - i.bottom());
+  }
+  if (i.x > a.x) {
+    out[n++] = Rect(a.x, i.y, i.x - a.x, i.h);
+  }
+  if (i.right() < a.right()) {
+    out[n++] = Rect(i.right(), i.y, a.right() - i.right(), i.h);
+  }
+  return n;
+}
+
+int Compositor::index_of(const Surface *s) const {
+  for (int i = 0; i < count_; i++) {
+    if (surfaces_[i] == s) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+int Compositor::insert_position(const Surface *s) const {
+  if (s->always_on_top) {
+    return count_;
+  }
+  for (int i = 0; i < count_; i++) {
+    if (surfaces_[i]->always_on_top) {
+      return i;
+    }
+  }
+  return count_;
+}
+
+bool Compositor::attach(Surface *s) {
+  if (index_of(s) >= 0) {
+    return true;
+  }
+  if (count_ == MAX_SURFACES) {
+    return false;
+  }
+
+  int pos = insert_position(s);
+  for (int i = count_; i > pos; i--) {
+    surfaces_[i] = surfaces_[i - 1];
+  }
+  surfaces_[pos] = s;
+  count_++;
+  return true;
+}
+
+void Compositor::detach(Surface *s) {
+  int idx = index_of(s);
+  if (idx < 0) {
+    return;
+  }
+  for (int i = idx; i < count_ - 1; i++) {
+    surfaces_[i] = surfaces_[i + 1];
+  }
+  count_--;
+}
+
+void Compositor::raise(Surface *s) {
+  detach(s);
+  attach(s);
+}
+
+int Compositor::visible_parts(const Surface *s, const Rect &region, Rect *out, int max) const {
+  int idx = index_of(s);
+  Rect r = region.intersect(s->rect).clip(width_, height_);
+  if (idx < 0 || r.empty() || max < 1) {
+    return 0;
+  }
+
+  int n = 0;
+  out[n++] = r;
+
+  // Cut away everything covered by shown surfaces higher in the stack
+  Rect next[MAX_PIECES];
+  for (int i = idx + 1; i < count_ && n > 0; i++) {
+    const Surface *above = surfaces_[i];
+    if (!above->shown() || above->rect.intersect(r).empty()) {
+      continue;
+    }
+
+    int m = 0;
+    for (int p = 0; p < n; p++) {
+      Rect pieces[4];
+      int k = rect_subtract(out[p], above->rect, pieces);
+      if (m + k > max || m + k > MAX_PIECES) {
+        return -1;
+      }
+      for (int j = 0; j < k; j++) {
+        next[m++] = pieces[j];
+      }
+    }
+
+    for (int p = 0; p < m; p++) {
+      out[p] = next[p];
+    }
+    n = m;
+  }
+  return n;
+}
+
+bool Compositor::occluded(const Surface *s) const {
+  Rect parts[MAX_PIECES];
+  return visible_parts(s, s->rect, parts, MAX_PIECES) == 0;
+}
+
+void Compositor::present(const Surface *s, const Rect &local, DamageList &damage) {
+  if (!s->shown()) {
+    return;
+  }
+
+  Rect screen(local.x + s->rect.x, local.y + s->rect.y, local.w, local.h);
+  Rect parts[MAX_PIECES];
+  int n = visible_parts(s, screen, parts, MAX_PIECES);
+  if (n < 0) {
+    // Too fragmented to cull; repaint the region with everything stacked on it
+    recompose(screen.intersect(s->rect), damage);
+    return;
+  }
+
+  for (int i = 0; i < n; i++) {
+    blit(s, parts[i]);
+    damage.add(parts[i]);
+  }
+}
+
+void Compositor::recompose(const Rect &region, DamageList &damage) {
+  Rect r = region.clip(width_, height_);
+  if (r.empty()) {
+    return;
+  }
+
+  fill(r, background_);
+  for (int i = 0; i < count_; i++) {
+    if (surfaces_[i]->shown()) {
+      blit(surfaces_[i], r.intersect(surfaces_[i]->rect));
+    }
+  }
+  damage.add(r);
+}
+
+void Compositor::blit(const Surface *s, const Rect &screen) {
+  Rect r = screen.intersect(s->rect).clip(width_, height_);
+  for (int y = r.y; y < r.bottom(); y++) {
+    const uint32_t *src = &s->pixels[(y - s->rect.y) * s->rect.w + (r.x - s->rect.x)];
+    copy_span(&fb_[y * width_ + r.x], src, r.w);
+  }
+}
+
+void Compositor::fill(const Rect &screen, uint32_t color) {
+  for (int y = screen.y; y < screen.bottom(); y++) {
+    fill_span(&fb_[y * width_ + screen.x], screen.w, color);
+  }
+}
+
+} // namespace graphics
@@ -0,0 +1,83 @@
+// compositor.hpp - Window surfaces, z-order and occlusion-culled composition
+#pragma once
+
+#include "ot/common.h"
+#include "ot/lib/rect.hpp"
+
+namespace graphics {
+
+// Flags returned by the graphics server's should_render
+static const uintptr_t RENDER_VISIBLE = 1 << 0; // Part of the app's surface is on screen
+static const uintptr_t RENDER_FOCUSED = 1 << 1; // The app has keyboard focus
+
+// A rectangular image placed on screen. Pixels are stored row-major with a
+// stride of rect.w. A surface is only composited once it is both visible and
+// mapped (has presented at least one frame), so a freshly registered app
+// doesn't flash an empty window.
+struct Surface {
+  uint32_t *pixels;
+  Rect rect; // Position and size in screen coordinates
+  bool visible;
+  bool mapped;
+  bool always_on_top; // Kept above all other surfaces (used for the taskbar)
+
+  Surface() : pixels(nullptr), visible(true), mapped(false), always_on_top(false) {}
+
+  bool shown() const { return pixels && visible && mapped && !rect.empty(); }
+};
+
+// Composes a stack of surfaces onto a scanout buffer. Surfaces are ordered
+// bottom to top; the compositor does not own them.
+class Compositor {
+public:
+  static const int MAX_SURFACES = 12;
+  // Upper bound on the pieces a region is split into by occlusion before
+  // falling back to repainting it bottom to top
+  static const int MAX_PIECES = 32;
+
+  Compositor(uint32_t *fb, int width, int height, uint32_t background)
+      : fb_(fb), width_(width), height_(height), background_(background), count_(0) {}
+
+  int count() const { return count_; }
+  Surface *at(int i) const { return surfaces_[i]; }
+
+  // Add a surface on top of the stack (but below always-on-top surfaces)
+  bool attach(Surface *s);
+  void detach(Surface *s);
+  // Move a surface to the top of the stack (but below always-on-top surfaces)
+  void raise(Surface *s);
+  int index_of(const Surface *s) const;
+
+  // Parts of region (screen coordinates) where s is not covered by a shown
+  // surface above it. Returns the number of pieces written to out, or -1 if
+  // there were more than max.
+  int visible_parts(const Surface *s, const Rect &region, Rect *out, int max) const;
+
+  // True if no part of s would be on screen if it were shown
+  bool occluded(const Surface *s) const;
+
+  // Blit the visible parts of a damaged region of s (surface coordinates) to
+  // the scanout, adding the screen areas that changed to damage. Fully occluded
+  // regions cost nothing.
+  void present(const Surface *s, const Rect &local, DamageList &damage);
+
+  // Repaint a screen region from the background and every shown surface
+  void recompose(const Rect &region, DamageList &damage);
+
+private:
+  uint32_t *fb_;
+  int width_;
+  int height_;
+  uint32_t background_;
+  Surface *surfaces_[MAX_SURFACES];
+  int count_;
+
+  void blit(const Surface *s, const Rect &screen);
+  void fill(const Rect &screen, uint32_t color);
+  int insert_position(const Surface *s) const;
+};
+
+// Split a minus b into at most 4 disjoint rectangles, returning the count
+int rect_subtract(const Rect &a, const Rect &b, Rect out[4]);
+
+} // namespace graphics
@@ -15,6 +15,8 @@ enum ErrorCode {
   IPC__METHOD_NOT_IMPLEMENTED = 4,
   /** Receiver's IPC wait queue is full */
   IPC__QUEUE_FULL = 5,
+  /** Arguments in the comm page don't match the method's signature */
+  IPC__INVALID_ARGS = 18,
 
   VIRTIO__DEVICE_NOT_FOUND = 6,
   VIRTIO__SETUP_FAIL = 7,
@@ -31,6 +33,7 @@ enum ErrorCode {
   APP__GLYPH_METRICS_FAILED = 14,
   APP__GLYPH_RENDER_FAILED = 15,
   APP__MEMORY_ALLOC_FAILED = 16,
+  APP__NO_FONT_ATLAS = 17,
 
 // Generated service error codes (starting at 100)
 #include "ot/user/gen/error-codes-gen.hpp"
@@ -50,6 +53,8 @@ inline const char *error_code_to_string(ErrorCode code) {
     return "ipc.method-not-implemented";
   case IPC__QUEUE_FULL:
     return "ipc.queue-full";
+  case IPC__INVALID_ARGS:
+    return "ipc.invalid-args";
   case VIRTIO__DEVICE_NOT_FOUND:
     return "virtio.device-not-found";
   case VIRTIO__SETUP_FAIL:
@@ -72,6 +77,8 @@ inline const char *error_code_to_string(ErrorCode code) {
     return "app.glyph-render-failed";
   case APP__MEMORY_ALLOC_FAILED:
     return "app.memory-alloc-failed";
+  case APP__NO_FONT_ATLAS:
+    return "app.no-font-atlas";
 
 // Generated service error code cases
 #include "ot/user/gen/error-codes-gen-switch.hpp"
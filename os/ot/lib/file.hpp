@@ -22,6 +22,7 @@ enum class FileMode {
 };
 
 typedef void (*LineCallback)(const ou::string &line);
+typedef void (*ChunkCallback)(void *ctx, const char *data, size_t len);
 
 struct File {
   File(const char *path, FileMode mode = FileMode::READ);
@@ -34,6 +35,8 @@ struct File {
 
 #ifdef OT_POSIX
   FILE *file_handle;
+  void *mapping;       // Set by map()
+  size_t mapping_size;
 #else
   Pid fs_pid;            // Filesystem server PID
   uintptr_t handle;      // IPC file handle (FileHandleId)
@@ -51,7 +54,20 @@ struct File {
 
   // Utility methods
   ErrorCode read_all(ou::string &out_data);
+  /**
+   * Calls callback with the file's contents from the start, a piece at a time
+   * (one comm page per call on the OS), so memory stays bounded however large
+   * the file is. Pieces are only valid during the callback.
+   */
+  ErrorCode read_chunks(ChunkCallback callback, void *ctx);
   ErrorCode write_all(const ou::string &data);
+
+  /**
+   * Get the whole file contents without copying them where possible: an mmap
+   * on POSIX, otherwise a read_all into buffer. The data stays valid until the
+   * File is destroyed and is not null-terminated.
+   */
+  ErrorCode map(const char **out_data, size_t *out_size);
 };
 } // namespace ou
 
@@ -0,0 +1,46 @@
+// font-atlas-test.cpp - Unit tests for the pre-rasterised Proggy atlases
+
+#include "ot/lib/font-atlas.hpp"
+#include "ot/lib/font-proggy-atlas.hpp"
+#include "vendor/doctest.h"
+
+using app::AtlasGlyph;
+using app::FontAtlas;
+
+TEST_CASE("font atlas lookup") {
+  const FontAtlas *atlas = app::find_font_atlas(proggy_atlas, proggy_atlas_count, 16);
+  CHECK(atlas != nullptr);
+  CHECK(atlas->size_px == 16);
+  CHECK(app::find_font_atlas(proggy_atlas, proggy_atlas_count, 17) == nullptr);
+
+  CHECK(atlas->glyph(' ') != nullptr);
+  CHECK(atlas->glyph('~') != nullptr);
+  CHECK(atlas->glyph(31) == nullptr);
+  CHECK(atlas->glyph(127) == nullptr);
+
+  // Space carries only an advance
+  CHECK(atlas->glyph(' ')->width == 0);
+  CHECK(atlas->glyph(' ')->advance > 0);
+}
+
+TEST_CASE("font atlas data is consistent") {
+  for (int i = 0; i < proggy_atlas_count; i++) {
+    const FontAtlas &atlas = proggy_atlas[i];
+    CHECK(atlas.ascender > 0);
+    CHECK(atlas.descender < 0);
+
+    // Bitmaps are packed in codepoint order and sit inside the line box
+    uint32_t next_offset = 0;
+    for (uint32_t cp = atlas.first; cp < atlas.first + atlas.count; cp++) {
+      const AtlasGlyph *g = atlas.glyph(cp);
+      CHECK(g->offset == next_offset);
+      next_offset += (uint32_t)g->width * g->height;
+      if (g->width > 0) {
+        CHECK(atlas.ascender + g->y_offset >= -1);
+      }
+    }
+
+    // Proggy is monospaced
+    CHECK(atlas.glyph('i')->advance == atlas.glyph('W')->advance);
+  }
+}
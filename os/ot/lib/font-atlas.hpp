@@ -0,0 +1,49 @@
+// font-atlas.hpp - Pre-rasterised font atlases
+//
+// Atlases are generated at build time by tools/embed-font.py --atlas, which
+// renders a contiguous codepoint range at one pixel size into 8-bit coverage
+// bitmaps. Drawing from an atlas needs no font parsing, rasterisation or
+// allocation.
+#pragma once
+
+#include "ot/common.h"
+
+namespace app {
+
+// Metrics are in pixels and match libschrift's SFT_GMetrics for the same size
+struct AtlasGlyph {
+  int16_t advance;
+  int16_t left_bearing;
+  int16_t y_offset; // Offset of the bitmap's top row from the baseline
+  uint8_t width;    // Coverage bitmap dimensions (0 for blank glyphs like space)
+  uint8_t height;
+  uint32_t offset; // Start of the bitmap in the atlas coverage array
+};
+
+struct FontAtlas {
+  int size_px;
+  int ascender;
+  int descender;
+  int line_gap;
+  uint32_t first; // First codepoint covered
+  uint32_t count; // Number of consecutive codepoints covered
+  const AtlasGlyph *glyphs;
+  const uint8_t *coverage;
+
+  const AtlasGlyph *glyph(uint32_t codepoint) const {
+    return codepoint - first < count ? &glyphs[codepoint - first] : nullptr;
+  }
+  const uint8_t *bitmap(const AtlasGlyph *g) const { return coverage + g->offset; }
+};
+
+// Find the atlas for a pixel size, or nullptr if it wasn't pre-rasterised
+inline const FontAtlas *find_font_atlas(const FontAtlas *atlases, int count, int size_px) {
+  for (int i = 0; i < count; i++) {
+    if (atlases[i].size_px == size_px) {
+      return &atlases[i];
+    }
+  }
+  return nullptr;
+}
+
+} // namespace app
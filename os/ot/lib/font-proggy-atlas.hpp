@@ -0,0 +1,5459 @@
+// Auto-generated file - do not edit
+// Generated from: ProggyVector-Regular.ttf (embed-font.py --atlas 14,16,20,24,28)
+// Coverage: 78912 bytes
+
+#ifndef FONT_PROGGY_ATLAS_HPP
+#define FONT_PROGGY_ATLAS_HPP
+
+#include "ot/lib/font-atlas.hpp"
+
+static const app::AtlasGlyph proggy_atlas_14_glyphs[] = {
+  {8, 0, 0, 0, 0, 0}, // ' '
+  {8, 3, -11, 4, 13, 0}, // '!'
+  {8, 2, -10, 6, 5, 52}, // '"'
+  {8, 0, -10, 10, 11, 82}, // '#'
+  {8, 1, -10, 8, 12, 192}, // '$'
+  {8, 0, -10, 10, 11, 288}, // '%'
+  {8, 0, -10, 10, 12, 398}, // '&'
+  {8, 3, -10, 3, 5, 518}, // "'"
+  {8, 2, -11, 5, 14, 533}, // '('
+  {8, 2, -11, 5, 14, 603}, // ')'
+  {8, 0, -9, 9, 9, 673}, // '*'
+  {8, 0, -9, 9, 9, 754}, // '+'
+  {8, 2, -2, 5, 6, 835}, // ','
+  {8, 1, -6, 8, 3, 865}, // '-'
+  {8, 3, -2, 4, 4, 889}, // '.'
+  {8, 0, -11, 9, 13, 905}, // '/'
+  {8, 0, -10, 9, 12, 1022}, // '0'
+  {8, 1, -10, 7, 11, 1130}, // '1'
+  {8, 1, -10, 8, 11, 1207}, // '2'
+  {8, 1, -10, 8, 12, 1295}, // '3'
+  {8, 0, -10, 9, 11, 1391}, // '4'
+  {8, 0, -10, 9, 12, 1490}, // '5'
+  {8, 0, -10, 9, 12, 1598}, // '6'
+  {8, 0, -10, 9, 11, 1706}, // '7'
+  {8, 0, -10, 9, 12, 1805}, // '8'
+  {8, 0, -10, 9, 12, 1913}, // '9'
+  {8, 3, -8, 4, 8, 2021}, // ':'
+  {8, 2, -8, 5, 10, 2053}, // ';'
+  {8, 0, -9, 9, 9, 2103}, // '<'
+  {8, 0, -7, 9, 6, 2184}, // '='
+  {8, 0, -8, 9, 8, 2238}, // '>'
+  {8, 1, -11, 8, 13, 2310}, // '?'
+  {8, 0, -11, 12, 13, 2414}, // '@'
+  {8, 0, -10, 10, 11, 2570}, // 'A'
+  {8, 1, -10, 8, 11, 2680}, // 'B'
+  {8, 0, -10, 9, 12, 2768}, // 'C'
+  {8, 0, -10, 9, 11, 2876}, // 'D'
+  {8, 1, -10, 8, 11, 2975}, // 'E'
+  {8, 1, -10, 8, 11, 3063}, // 'F'
+  {8, 0, -10, 9, 12, 3151}, // 'G'
+  {8, 0, -10, 9, 11, 3259}, // 'H'
+  {8, 1, -10, 8, 11, 3358}, // 'I'
+  {8, 0, -10, 8, 12, 3446}, // 'J'
+  {8, 0, -10, 10, 11, 3542}, // 'K'
+  {8, 1, -10, 8, 11, 3652}, // 'L'
+  {8, 0, -10, 9, 11, 3740}, // 'M'
+  {8, 0, -10, 9, 11, 3839}, // 'N'
+  {8, 0, -10, 9, 12, 3938}, // 'O'
+  {8, 1, -10, 8, 11, 4046}, // 'P'
+  {8, 0, -10, 10, 13, 4134}, // 'Q'
+  {8, 0, -10, 9, 11, 4264}, // 'R'
+  {8, 0, -10, 9, 12, 4363}, // 'S'
+  {8, 0, -10, 10, 11, 4471}, // 'T'
+  {8, 0, -10, 9, 12, 4581}, // 'U'
+  {8, 0, -10, 10, 11, 4689}, // 'V'
+  {8, 0, -10, 10, 11, 4799}, // 'W'
+  {8, 0, -10, 10, 11, 4909}, // 'X'
+  {8, 0, -10, 10, 11, 5019}, // 'Y'
+  {8, 0, -10, 9, 11, 5129}, // 'Z'
+  {8, 2, -11, 6, 14, 5228}, // '['
+  {8, 0, -11, 9, 13, 5312}, // '\\'
+  {8, 2, -11, 6, 14, 5429}, // ']'
+  {8, 0, -10, 9, 6, 5513}, // '^'
+  {8, 0, 0, 11, 3, 5567}, // '_'
+  {8, 2, -11, 5, 5, 5600}, // '`'
+  {8, 0, -8, 9, 10, 5625}, // 'a'
+  {8, 1, -11, 8, 13, 5715}, // 'b'
+  {8, 1, -8, 8, 10, 5819}, // 'c'
+  {8, 0, -11, 9, 13, 5899}, // 'd'
+  {8, 0, -8, 9, 10, 6016}, // 'e'
+  {8, 0, -11, 9, 12, 6106}, // 'f'
+  {8, 1, -8, 8, 13, 6214}, // 'g'
+  {8, 1, -11, 8, 12, 6318}, // 'h'
+  {8, 2, -10, 5, 11, 6414}, // 'i'
+  {8, 1, -10, 7, 15, 6469}, // 'j'
+  {8, 1, -10, 9, 11, 6574}, // 'k'
+  {8, 1, -10, 6, 11, 6673}, // 'l'
+  {8, 0, -8, 9, 9, 6739}, // 'm'
+  {8, 1, -8, 8, 9, 6820}, // 'n'
+  {8, 0, -8, 9, 10, 6892}, // 'o'
+  {8, 1, -8, 8, 13, 6982}, // 'p'
+  {8, 0, -8, 9, 13, 7086}, // 'q'
+  {8, 1, -8, 8, 9, 7203}, // 'r'
+  {8, 1, -8, 8, 10, 7275}, // 's'
+  {8, 1, -10, 7, 12, 7355}, // 't'
+  {8, 1, -8, 8, 10, 7439}, // 'u'
+  {8, 0, -8, 9, 9, 7519}, // 'v'
+  {8, 0, -8, 10, 9, 7600}, // 'w'
+  {8, 0, -8, 9, 9, 7690}, // 'x'
+  {8, 0, -8, 9, 13, 7771}, // 'y'
+  {8, 1, -8, 8, 9, 7888}, // 'z'
+  {8, 1, -12, 8, 15, 7960}, // '{'
+  {8, 3, -11, 3, 14, 8080}, // '|'
+  {8, 1, -12, 8, 15, 8122}, // '}'
+  {8, 0, -7, 9, 5, 8242}, // '~'
+};
+
+static const uint8_t proggy_atlas_14_coverage[] = {
+  0x12, 0x1c, 0x00, 0x00, 0x98, 0xf2, 0x00, 0x00, 0x97, 0xf1, 0x00, 0x00, 0x8b, 0xe8, 0x00, 0x00,
+  0x7e, 0xdd, 0x00, 0x00, 0x70, 0xd3, 0x00, 0x00, 0x64, 0xc8, 0x00, 0x00, 0x22, 0x48, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7d, 0xd1, 0x13, 0x00, 0x90, 0xea, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0x4a, 0x0c, 0x95, 0x11, 0x00, 0xb0, 0x7f, 0x14, 0xff, 0x1c, 0x00,
+  0xb0, 0x7f, 0x14, 0xff, 0x1c, 0x00, 0xab, 0x7c, 0x13, 0xf8, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x4e, 0x00, 0x5b, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf,
+  0x68, 0x01, 0xe7, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x04, 0xf0, 0x23, 0x2e, 0xe8, 0x01, 0x00, 0x00,
+  0x2d, 0xd9, 0xdd, 0xfe, 0xd9, 0xe5, 0xf6, 0xd9, 0x55, 0x00, 0x08, 0x26, 0x93, 0xae, 0x34, 0xc6,
+  0x75, 0x26, 0x0f, 0x00, 0x00, 0x00, 0xbf, 0x5c, 0x04, 0xf0, 0x1e, 0x00, 0x00, 0x00, 0xb1, 0xb4,
+  0xf8, 0xb3, 0xaf, 0xfb, 0xb4, 0x6f, 0x00, 0x00, 0x43, 0x80, 0xd5, 0x44, 0xaa, 0xab, 0x44, 0x2a,
+  0x00, 0x00, 0x00, 0x8c, 0x8b, 0x00, 0xc6, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x44, 0x0c,
+  0xe7, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x37, 0xc8, 0x01, 0x00, 0x00, 0x00, 0x0d, 0xa5, 0xf1, 0xfd, 0xe8, 0xac, 0x00, 0x00,
+  0x90, 0xc2, 0x41, 0xe4, 0x06, 0x42, 0x00, 0x00, 0xb1, 0x8d, 0x3a, 0xe4, 0x00, 0x00, 0x00, 0x00,
+  0x50, 0xf5, 0xb3, 0xed, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x32, 0xa0, 0xf9, 0xde, 0xb8, 0x08, 0x00,
+  0x00, 0x00, 0x3a, 0xe4, 0x01, 0xb9, 0x6d, 0x00, 0x13, 0x00, 0x3a, 0xe4, 0x00, 0xaf, 0x76, 0x00,
+  0xb8, 0xb5, 0x99, 0xf0, 0x9e, 0xd6, 0x14, 0x00, 0x08, 0x42, 0x89, 0xf0, 0x56, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x0d, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3a, 0x49, 0x04, 0x00, 0x00, 0x4d, 0x28, 0x00, 0x00, 0x70, 0xce, 0xb5, 0xac, 0x00, 0x42,
+  0xf1, 0x19, 0x00, 0x00, 0xb1, 0x46, 0x0a, 0xef, 0x05, 0xd4, 0x73, 0x00, 0x00, 0x00, 0x4d, 0xdf,
+  0xd7, 0x86, 0x71, 0xd7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1b, 0x18, 0xf0, 0x46, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xf5,
+  0x29, 0x8f, 0xb5, 0x4b, 0x00, 0x00, 0x00, 0x02, 0xcb, 0x7f, 0x76, 0xa1, 0x3f, 0xe9, 0x12, 0x00,
+  0x00, 0x65, 0xdf, 0x09, 0x75, 0x9b, 0x35, 0xe5, 0x0e, 0x00, 0x04, 0xac, 0x4c, 0x00, 0x0a, 0x92,
+  0xb9, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+  0xa7, 0xd4, 0x98, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xac, 0x2d, 0xd4, 0x64, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xce, 0x7a, 0x01, 0xcd, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xf3, 0xbe,
+  0xb8, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xeb, 0xfa, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x13, 0xe7, 0x41, 0xa0, 0xc7, 0x06, 0x00, 0xcc, 0x28, 0x00, 0x75, 0xac, 0x00, 0x0a, 0xcf, 0x95,
+  0x01, 0xf3, 0x19, 0x00, 0x8c, 0xb4, 0x00, 0x00, 0x22, 0xed, 0x9d, 0xd2, 0x00, 0x00, 0x3e, 0xfa,
+  0x4f, 0x00, 0x00, 0x81, 0xff, 0x5f, 0x00, 0x00, 0x00, 0x5e, 0xeb, 0xde, 0xde, 0xc4, 0x92, 0xde,
+  0x13, 0x00, 0x00, 0x00, 0x02, 0x21, 0x11, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x8b, 0x00, 0x5d, 0xe4, 0x00, 0x5d, 0xe4, 0x00, 0x59,
+  0xda, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x27, 0x00, 0x00, 0x55, 0xd0, 0x01, 0x00, 0x01,
+  0xd5, 0x62, 0x00, 0x00, 0x39, 0xfc, 0x10, 0x00, 0x00, 0x7d, 0xd0, 0x00, 0x00, 0x00, 0xa3, 0xaf,
+  0x00, 0x00, 0x00, 0xad, 0xaa, 0x00, 0x00, 0x00, 0x96, 0xd0, 0x00, 0x00, 0x00, 0x5d, 0xf5, 0x02,
+  0x00, 0x00, 0x13, 0xf6, 0x3a, 0x00, 0x00, 0x00, 0x99, 0xae, 0x00, 0x00, 0x00, 0x18, 0xee, 0x26,
+  0x00, 0x00, 0x00, 0x16, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x9f, 0x12, 0x00, 0x00,
+  0x00, 0x8e, 0x97, 0x00, 0x00, 0x00, 0x20, 0xf8, 0x1a, 0x00, 0x00, 0x00, 0xca, 0x78, 0x00, 0x00,
+  0x00, 0x8e, 0xbc, 0x00, 0x00, 0x00, 0x71, 0xdf, 0x00, 0x00, 0x00, 0x68, 0xe6, 0x00, 0x00, 0x00,
+  0x7c, 0xce, 0x00, 0x00, 0x00, 0xae, 0x94, 0x00, 0x00, 0x0b, 0xf2, 0x40, 0x00, 0x00, 0x63, 0xcc,
+  0x00, 0x00, 0x07, 0xde, 0x3b, 0x00, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x27, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x6b, 0xc5, 0x00,
+  0x00, 0x05, 0x00, 0x25, 0xe3, 0x6a, 0x6f, 0xc5, 0x39, 0xc2, 0x88, 0x00, 0x00, 0x4d, 0xd6, 0xf8,
+  0xf8, 0xf4, 0x84, 0x0e, 0x00, 0x00, 0x18, 0x9c, 0xff, 0xff, 0xd3, 0x40, 0x00, 0x00, 0x26, 0xf2,
+  0xaa, 0x8f, 0xce, 0x7a, 0xf0, 0x7c, 0x00, 0x00, 0x27, 0x00, 0x6b, 0xc5, 0x00, 0x15, 0x1b, 0x00,
+  0x00, 0x00, 0x00, 0x52, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xc1,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xc1, 0x00, 0x00, 0x00, 0x00, 0x22, 0x4e, 0x4e,
+  0x93, 0xd4, 0x4e, 0x4e, 0x41, 0x00, 0x58, 0xc9, 0xc9, 0xde, 0xf2, 0xc9, 0xc9, 0xa8, 0x00, 0x00,
+  0x00, 0x00, 0x64, 0xc1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xc1, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3f, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x83, 0xd5, 0x13, 0x00, 0x00, 0x93, 0xff, 0x2c, 0x00, 0x00, 0x36, 0xda,
+  0x03, 0x00, 0x0c, 0xd8, 0x3a, 0x00, 0x00, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x46, 0x51, 0x51, 0x51, 0x51, 0x51, 0x18, 0x00, 0xae, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9, 0x3d,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xd4, 0x14, 0x00, 0x90, 0xea, 0x1a,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d,
+  0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xf6, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8e, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xf5, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8d, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xf5, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8b, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xf4, 0x41, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8a, 0xc1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xf4, 0x42, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x89, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x9b, 0x3b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x39, 0x9e, 0xb3, 0x73, 0x03, 0x00, 0x00, 0x00, 0x36, 0xf6, 0x98, 0x73, 0xe3, 0xa0, 0x00, 0x00,
+  0x00, 0xa8, 0xa4, 0x00, 0x00, 0x7e, 0xff, 0x26, 0x00, 0x00, 0xeb, 0x54, 0x00, 0x3b, 0xf9, 0xf8,
+  0x62, 0x00, 0x05, 0xfe, 0x34, 0x1b, 0xe7, 0x97, 0xbd, 0x7c, 0x00, 0x0d, 0xff, 0x37, 0xc8, 0xc3,
+  0x06, 0xb9, 0x81, 0x00, 0x00, 0xf5, 0xd1, 0xe2, 0x17, 0x00, 0xcb, 0x70, 0x00, 0x00, 0xcd, 0xf5,
+  0x32, 0x00, 0x0d, 0xf7, 0x45, 0x00, 0x00, 0x6a, 0xf1, 0x3f, 0x12, 0xa0, 0xe0, 0x06, 0x00, 0x00,
+  0x03, 0x97, 0xfb, 0xff, 0xd9, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x95, 0x05, 0x00,
+  0x00, 0x0a, 0xa7, 0xfd, 0xff, 0x08, 0x00, 0x00, 0x30, 0xd6, 0x61, 0xff, 0x08, 0x00, 0x00, 0x11,
+  0x0e, 0x3a, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x3a,
+  0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xff, 0x08,
+  0x00, 0x00, 0x06, 0x1f, 0x52, 0xff, 0x26, 0x1e, 0x00, 0x32, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x81, 0xb7, 0xb7, 0x72, 0x07, 0x00, 0x00, 0xdf,
+  0xab, 0x67, 0x70, 0xe8, 0xb4, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x5c, 0xff, 0x1c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x55, 0xfe, 0x15, 0x00, 0x00, 0x00, 0x00, 0x04, 0xc4, 0xad, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x97, 0xd4, 0x11, 0x00, 0x00, 0x00, 0x00, 0x8e, 0xdb, 0x1a, 0x00, 0x00, 0x00, 0x00,
+  0x8a, 0xd6, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x89, 0xe4, 0x35, 0x1f, 0x1f, 0x1f, 0x0d, 0x00, 0xf5,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a,
+  0x9a, 0xbe, 0xb9, 0x7f, 0x11, 0x00, 0x00, 0x7d, 0x80, 0x5a, 0x65, 0xd5, 0xc7, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3a, 0xff, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xfa, 0x18, 0x00, 0x00,
+  0x24, 0xa9, 0xc0, 0xda, 0x4e, 0x00, 0x00, 0x00, 0x16, 0x68, 0x80, 0xdf, 0x94, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1f, 0xfe, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xf6, 0x6a, 0x00, 0x5f,
+  0x11, 0x00, 0x06, 0x7e, 0xfc, 0x2f, 0x00, 0xd2, 0xfd, 0xed, 0xfb, 0xec, 0x61, 0x00, 0x00, 0x00,
+  0x12, 0x2a, 0x23, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x75, 0x95, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0xfd, 0xf3, 0x3f, 0x00,
+  0x00, 0x00, 0x00, 0x0f, 0xe3, 0x8e, 0xd4, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x99, 0xda, 0x09, 0xd4,
+  0x3f, 0x00, 0x00, 0x00, 0x40, 0xfd, 0x3f, 0x00, 0xd4, 0x3f, 0x00, 0x00, 0x09, 0xda, 0x9a, 0x00,
+  0x00, 0xd4, 0x3f, 0x00, 0x00, 0x68, 0xfb, 0x69, 0x59, 0x59, 0xe3, 0x82, 0x4e, 0x00, 0x53, 0xb7,
+  0xb7, 0xb7, 0xb7, 0xfe, 0xc9, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x3f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x58, 0x95, 0x95, 0x95, 0x95, 0x70, 0x00, 0x00, 0x00, 0x97, 0xd6, 0x7f, 0x7f,
+  0x7f, 0x5f, 0x00, 0x00, 0x00, 0x97, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0xbd,
+  0x50, 0x46, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x97, 0xdc, 0xc3, 0xe6, 0xf1, 0x4d, 0x00, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x03, 0x97, 0xed, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xff, 0x3e,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xff, 0x35, 0x00, 0x02, 0x52, 0x09, 0x00, 0x17, 0xb7,
+  0xdc, 0x07, 0x00, 0x03, 0xed, 0xfb, 0xef, 0xff, 0xd1, 0x2f, 0x00, 0x00, 0x00, 0x02, 0x1d, 0x2b,
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x47, 0x88, 0x98, 0x58, 0x00, 0x00, 0x00, 0x03, 0xa7, 0xe1, 0x82, 0x74, 0x89, 0x00, 0x00,
+  0x00, 0x6a, 0xdd, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x71, 0x28, 0x4e, 0x27, 0x00,
+  0x00, 0x00, 0x01, 0xf6, 0xb1, 0xda, 0xb4, 0xf0, 0x92, 0x00, 0x00, 0x11, 0xff, 0xc7, 0x05, 0x00,
+  0x31, 0xfe, 0x3e, 0x00, 0x08, 0xfe, 0x75, 0x00, 0x00, 0x00, 0xe2, 0x74, 0x00, 0x00, 0xdb, 0x7b,
+  0x00, 0x00, 0x00, 0xe9, 0x6e, 0x00, 0x00, 0x80, 0xdd, 0x1a, 0x00, 0x5c, 0xfc, 0x2d, 0x00, 0x00,
+  0x07, 0xa7, 0xf7, 0xed, 0xee, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x19, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x95, 0x95, 0x95, 0x95, 0x95,
+  0x95, 0x39, 0x00, 0x05, 0x7f, 0x7f, 0x7f, 0x7f, 0xa1, 0xfe, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x92, 0xc1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xf0, 0x5a, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x69, 0xea, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xd4, 0x8a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x41, 0xfe, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0xbb, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1c, 0xfb, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xe6, 0x05,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x67,
+  0xb2, 0xba, 0x8c, 0x1c, 0x00, 0x00, 0x00, 0x7c, 0xef, 0x62, 0x47, 0xb8, 0xde, 0x0a, 0x00, 0x00,
+  0xcf, 0x90, 0x00, 0x00, 0x25, 0xff, 0x3e, 0x00, 0x00, 0xb1, 0xa9, 0x00, 0x00, 0x3d, 0xff, 0x29,
+  0x00, 0x00, 0x1e, 0xcd, 0xb8, 0x9f, 0xdf, 0x77, 0x00, 0x00, 0x00, 0x52, 0xea, 0x96, 0x7f, 0xd3,
+  0xbb, 0x0b, 0x00, 0x01, 0xe8, 0x79, 0x00, 0x00, 0x10, 0xf6, 0x62, 0x00, 0x0e, 0xff, 0x54, 0x00,
+  0x00, 0x00, 0xe4, 0x82, 0x00, 0x00, 0xd9, 0xb3, 0x08, 0x00, 0x4b, 0xfe, 0x52, 0x00, 0x00, 0x33,
+  0xd3, 0xf1, 0xdf, 0xf3, 0x7f, 0x01, 0x00, 0x00, 0x00, 0x01, 0x16, 0x22, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x68, 0xaf, 0xbb, 0x77, 0x07,
+  0x00, 0x00, 0x00, 0x98, 0xe3, 0x59, 0x51, 0xd2, 0xa4, 0x00, 0x00, 0x09, 0xf9, 0x64, 0x00, 0x00,
+  0x3b, 0xfe, 0x21, 0x00, 0x1c, 0xff, 0x41, 0x00, 0x00, 0x12, 0xff, 0x59, 0x00, 0x04, 0xf8, 0x64,
+  0x00, 0x00, 0x3b, 0xff, 0x73, 0x00, 0x00, 0x8f, 0xe5, 0x5d, 0x53, 0xce, 0xf2, 0x73, 0x00, 0x00,
+  0x03, 0x6d, 0xb1, 0xad, 0x46, 0xf7, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xfa, 0x17,
+  0x00, 0x00, 0x12, 0x05, 0x01, 0x36, 0xe1, 0x97, 0x00, 0x00, 0x00, 0x55, 0xf2, 0xf1, 0xed, 0x8f,
+  0x05, 0x00, 0x00, 0x00, 0x00, 0x05, 0x13, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xd1, 0x19, 0x00, 0x89, 0xf1, 0x22, 0x00, 0x00, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x5c, 0x01, 0x00, 0xad, 0xff, 0x33, 0x00, 0x2d, 0x67, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xd1, 0x19, 0x00, 0x00, 0x89, 0xf1, 0x22, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x60, 0x02, 0x00, 0x00, 0xa9,
+  0xff, 0x3b, 0x00, 0x00, 0x33, 0xfb, 0x20, 0x00, 0x00, 0x86, 0x9c, 0x00, 0x00, 0x06, 0x8d, 0x08,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x8c, 0xaf, 0x00, 0x00, 0x00, 0x14, 0x6d, 0xcc, 0xee, 0x9b,
+  0x3a, 0x00, 0x2e, 0xae, 0xf1, 0xac, 0x51, 0x07, 0x00, 0x00, 0x00, 0x5b, 0xfb, 0xa9, 0x42, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x74, 0xd2, 0xe5, 0x8d, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x32, 0x91, 0xea, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x36, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xb5,
+  0x00, 0x18, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x59, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xe8, 0xc2, 0x00, 0x13, 0x32, 0x32, 0x32,
+  0x32, 0x32, 0x32, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xa9,
+  0x4a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x7b, 0xd4, 0xe6, 0x8b, 0x2c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x31, 0x8c, 0xe4, 0xcb, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x77, 0xf0,
+  0xbe, 0x00, 0x00, 0x11, 0x63, 0xbf, 0xf1, 0x9f, 0x40, 0x02, 0x00, 0x51, 0xf6, 0xbc, 0x5d, 0x0b,
+  0x00, 0x00, 0x00, 0x00, 0x25, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6c,
+  0xc8, 0xf7, 0xc1, 0x67, 0x00, 0x00, 0x84, 0xe1, 0x48, 0x0b, 0x3f, 0xec, 0x26, 0x00, 0x1f, 0x23,
+  0x00, 0x00, 0x05, 0xe3, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x15, 0xbb, 0xcb, 0x0b, 0x00, 0x00, 0x00,
+  0x15, 0xdc, 0xa0, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xe6, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x32, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7d, 0xd1, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xea, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x81, 0xe4, 0xf5,
+  0xe5, 0xc5, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x05, 0xbf, 0xce, 0x3b, 0x02, 0x06, 0x50, 0xe4, 0x72,
+  0x00, 0x00, 0x00, 0x75, 0xe8, 0x11, 0x30, 0xb6, 0xbc, 0x3a, 0x66, 0xc1, 0x00, 0x00, 0x00, 0xd7,
+  0x77, 0x15, 0xed, 0x8e, 0x8c, 0xf7, 0xf2, 0x7b, 0x00, 0x00, 0x05, 0xfe, 0x3b, 0x61, 0xd1, 0x00,
+  0x00, 0xc3, 0x8d, 0x00, 0x00, 0x00, 0x0a, 0xff, 0x3b, 0x6d, 0xc6, 0x00, 0x00, 0xb6, 0x81, 0x00,
+  0x00, 0x00, 0x00, 0xec, 0x70, 0x30, 0xfa, 0x54, 0x51, 0xf9, 0x81, 0x00, 0x00, 0x00, 0x00, 0x92,
+  0xe2, 0x0b, 0x66, 0xef, 0xec, 0xa9, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x11, 0xdb, 0xb4, 0x15, 0x03,
+  0x04, 0x00, 0x4a, 0xaf, 0x0a, 0x00, 0x00, 0x00, 0x1b, 0xba, 0xf6, 0xbd, 0xbb, 0xe2, 0xf6, 0x7c,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x58, 0x66, 0x4e, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x95, 0x17,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf2, 0xf0, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4e, 0xec, 0x84, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0xa3, 0x34, 0xfb, 0x15, 0x00,
+  0x00, 0x00, 0x00, 0x06, 0xee, 0x56, 0x01, 0xe7, 0x63, 0x00, 0x00, 0x00, 0x00, 0x48, 0xfa, 0x0f,
+  0x00, 0x9d, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x9b, 0xeb, 0x8a, 0x8a, 0xb8, 0xf9, 0x0f, 0x00, 0x00,
+  0x04, 0xeb, 0xab, 0x7f, 0x7f, 0x7f, 0xf7, 0x5b, 0x00, 0x00, 0x43, 0xff, 0x20, 0x00, 0x00, 0x00,
+  0xb3, 0xae, 0x00, 0x00, 0x97, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x66, 0xf6, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x95, 0x95, 0x84, 0x51, 0x03, 0x00, 0x00,
+  0xeb, 0xad, 0x78, 0x81, 0xd0, 0xab, 0x00, 0x00, 0xeb, 0x64, 0x00, 0x00, 0x1b, 0xff, 0x15, 0x00,
+  0xeb, 0x64, 0x00, 0x00, 0x31, 0xfb, 0x14, 0x00, 0xeb, 0xc8, 0xa5, 0xae, 0xe7, 0x6b, 0x00, 0x00,
+  0xeb, 0xa5, 0x6b, 0x70, 0x9c, 0xcd, 0x20, 0x00, 0xeb, 0x64, 0x00, 0x00, 0x00, 0x8e, 0xa0, 0x00,
+  0xeb, 0x64, 0x00, 0x00, 0x00, 0x70, 0xbd, 0x00, 0xeb, 0x6e, 0x11, 0x15, 0x3b, 0xd7, 0x7d, 0x00,
+  0xeb, 0xff, 0xff, 0xf6, 0xd9, 0x7f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0c, 0x73, 0xb2, 0xbe, 0x90, 0x1b, 0x00, 0x00, 0x0c, 0xce, 0xd3, 0x67, 0x55, 0x9b,
+  0x54, 0x00, 0x00, 0x82, 0xed, 0x0f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xd6, 0x98, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xf9, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xfc, 0x77,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xaa, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xfc, 0xa3, 0x28, 0x00, 0x32, 0x31,
+  0x00, 0x00, 0x00, 0x51, 0xe2, 0xfd, 0xe9, 0xf2, 0x40, 0x00, 0x00, 0x00, 0x00, 0x01, 0x20, 0x27,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x95, 0x95, 0x91,
+  0x71, 0x3a, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xa3, 0x7a, 0x9d, 0xf9, 0x8b, 0x00, 0x00, 0x0e, 0xff,
+  0x53, 0x00, 0x00, 0x65, 0xfd, 0x25, 0x00, 0x0e, 0xff, 0x53, 0x00, 0x00, 0x06, 0xf4, 0x6d, 0x00,
+  0x0e, 0xff, 0x53, 0x00, 0x00, 0x00, 0xdb, 0x87, 0x00, 0x0e, 0xff, 0x53, 0x00, 0x00, 0x00, 0xd3,
+  0x8f, 0x00, 0x0e, 0xff, 0x53, 0x00, 0x00, 0x00, 0xeb, 0x6f, 0x00, 0x0e, 0xff, 0x53, 0x00, 0x00,
+  0x34, 0xff, 0x38, 0x00, 0x0e, 0xff, 0x5e, 0x16, 0x45, 0xd6, 0xb3, 0x00, 0x00, 0x0e, 0xff, 0xff,
+  0xfa, 0xd4, 0x83, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a,
+  0x95, 0x95, 0x95, 0x95, 0x95, 0x45, 0x00, 0xb6, 0xd4, 0x7f, 0x7f, 0x7f, 0x7f, 0x3b, 0x00, 0xb6,
+  0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6,
+  0xe2, 0xa8, 0xa8, 0xa8, 0x96, 0x00, 0x00, 0xb6, 0xcf, 0x6f, 0x6f, 0x6f, 0x62, 0x00, 0x00, 0xb6,
+  0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6,
+  0xb2, 0x18, 0x18, 0x18, 0x18, 0x0b, 0x00, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x98, 0x98, 0x98, 0x98, 0x98, 0x55, 0x00, 0x66,
+  0xf6, 0x71, 0x71, 0x71, 0x71, 0x3f, 0x00, 0x66, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66,
+  0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xf8, 0x85, 0x85, 0x85, 0x28, 0x00, 0x00, 0x66,
+  0xf8, 0x83, 0x83, 0x83, 0x28, 0x00, 0x00, 0x66, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66,
+  0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66,
+  0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x16, 0x83, 0xb5, 0xb4, 0x6c, 0x07, 0x00, 0x00, 0x2a, 0xe5, 0xb2, 0x5c, 0x5e, 0xc0, 0x31,
+  0x00, 0x00, 0xb4, 0xbc, 0x02, 0x00, 0x00, 0x01, 0x08, 0x00, 0x13, 0xff, 0x59, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x35, 0xff, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xff, 0x29, 0x00,
+  0x8c, 0xeb, 0xeb, 0x81, 0x00, 0x23, 0xff, 0x3d, 0x00, 0x16, 0x25, 0xcc, 0x8b, 0x00, 0x04, 0xe5,
+  0x7e, 0x00, 0x00, 0x00, 0xc3, 0x8b, 0x00, 0x00, 0x6c, 0xf0, 0x43, 0x00, 0x04, 0xcf, 0x8b, 0x00,
+  0x00, 0x01, 0x81, 0xf3, 0xed, 0xf1, 0xd4, 0x39, 0x00, 0x00, 0x00, 0x00, 0x08, 0x26, 0x1c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x95, 0x30, 0x00, 0x00,
+  0x00, 0x86, 0x49, 0x00, 0x0e, 0xff, 0x53, 0x00, 0x00, 0x00, 0xe6, 0x7e, 0x00, 0x0e, 0xff, 0x53,
+  0x00, 0x00, 0x00, 0xe6, 0x7e, 0x00, 0x0e, 0xff, 0x53, 0x00, 0x00, 0x00, 0xe6, 0x7e, 0x00, 0x0e,
+  0xff, 0xc4, 0xa8, 0xa8, 0xa8, 0xf7, 0x7e, 0x00, 0x0e, 0xff, 0x9d, 0x6f, 0x6f, 0x6f, 0xf1, 0x7e,
+  0x00, 0x0e, 0xff, 0x53, 0x00, 0x00, 0x00, 0xe6, 0x7e, 0x00, 0x0e, 0xff, 0x53, 0x00, 0x00, 0x00,
+  0xe6, 0x7e, 0x00, 0x0e, 0xff, 0x53, 0x00, 0x00, 0x00, 0xe6, 0x7e, 0x00, 0x0e, 0xff, 0x53, 0x00,
+  0x00, 0x00, 0xe6, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0x95,
+  0x95, 0x95, 0x95, 0x95, 0x06, 0x00, 0x50, 0x7f, 0xbd, 0xf1, 0x7f, 0x7f, 0x05, 0x00, 0x00, 0x00,
+  0x7c, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7c, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7c, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x18,
+  0x88, 0xe7, 0x18, 0x18, 0x01, 0x00, 0xa1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x95, 0x95, 0x95, 0x50, 0x00, 0x00, 0x00,
+  0x3a, 0x7f, 0x7f, 0xeb, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x88, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xd8, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x88, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xd8, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x88, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xe6, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xfe, 0x4c, 0x00, 0x27, 0xed,
+  0xed, 0xef, 0xfd, 0xa3, 0x02, 0x00, 0x05, 0x1f, 0x1f, 0x1e, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x95, 0x30, 0x00, 0x00, 0x00, 0x63, 0x87, 0x08, 0x00,
+  0x0e, 0xff, 0x53, 0x00, 0x00, 0x79, 0xef, 0x37, 0x00, 0x00, 0x0e, 0xff, 0x53, 0x00, 0x7b, 0xee,
+  0x34, 0x00, 0x00, 0x00, 0x0e, 0xff, 0x53, 0x7b, 0xec, 0x32, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff,
+  0xc3, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xe8, 0x8c, 0xf5, 0x2b, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0xff, 0x5b, 0x01, 0xb7, 0xd1, 0x08, 0x00, 0x00, 0x00, 0x0e, 0xff, 0x53, 0x00,
+  0x1a, 0xed, 0x92, 0x00, 0x00, 0x00, 0x0e, 0xff, 0x53, 0x00, 0x00, 0x56, 0xfe, 0x4b, 0x00, 0x00,
+  0x0e, 0xff, 0x53, 0x00, 0x00, 0x00, 0xa5, 0xe9, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4e, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xdb, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xdb, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xdb, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xdb, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x85, 0xde, 0x18, 0x18, 0x18, 0x18, 0x13, 0x00, 0x85, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x95, 0x47, 0x00,
+  0x00, 0x08, 0x93, 0x8a, 0x00, 0x7b, 0xf7, 0xca, 0x00, 0x00, 0x5a, 0xf7, 0xed, 0x00, 0x7b, 0xbd,
+  0xe8, 0x2f, 0x00, 0xc0, 0xa4, 0xed, 0x00, 0x7b, 0xb8, 0x8a, 0x93, 0x26, 0xef, 0x4f, 0xed, 0x00,
+  0x7b, 0xb8, 0x27, 0xed, 0x93, 0x96, 0x46, 0xed, 0x00, 0x7b, 0xb8, 0x00, 0xc1, 0xfe, 0x33, 0x46,
+  0xed, 0x00, 0x7b, 0xb8, 0x00, 0x49, 0x94, 0x00, 0x46, 0xed, 0x00, 0x7b, 0xb8, 0x00, 0x00, 0x00,
+  0x00, 0x46, 0xed, 0x00, 0x7b, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x46, 0xed, 0x00, 0x7b, 0xb8, 0x00,
+  0x00, 0x00, 0x00, 0x46, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06,
+  0x95, 0x7d, 0x00, 0x00, 0x00, 0x7e, 0x47, 0x00, 0x0b, 0xff, 0xff, 0x30, 0x00, 0x00, 0xd8, 0x7a,
+  0x00, 0x0b, 0xff, 0xda, 0xa0, 0x00, 0x00, 0xd8, 0x7a, 0x00, 0x0b, 0xff, 0x6e, 0xf7, 0x18, 0x00,
+  0xd8, 0x7a, 0x00, 0x0b, 0xff, 0x48, 0xb2, 0x82, 0x00, 0xd8, 0x7a, 0x00, 0x0b, 0xff, 0x48, 0x41,
+  0xea, 0x08, 0xd8, 0x7a, 0x00, 0x0b, 0xff, 0x48, 0x00, 0xcf, 0x62, 0xd8, 0x7a, 0x00, 0x0b, 0xff,
+  0x48, 0x00, 0x5f, 0xd2, 0xd9, 0x7a, 0x00, 0x0b, 0xff, 0x48, 0x00, 0x07, 0xe7, 0xfc, 0x7a, 0x00,
+  0x0b, 0xff, 0x48, 0x00, 0x00, 0x7d, 0xff, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x35, 0x8e, 0xab, 0x74, 0x09, 0x00, 0x00, 0x00, 0x43, 0xf7, 0x93, 0x6e,
+  0xde, 0xb7, 0x00, 0x00, 0x00, 0xc1, 0xa7, 0x00, 0x00, 0x39, 0xff, 0x31, 0x00, 0x09, 0xff, 0x5f,
+  0x00, 0x00, 0x01, 0xf0, 0x76, 0x00, 0x22, 0xff, 0x49, 0x00, 0x00, 0x00, 0xda, 0x8f, 0x00, 0x2c,
+  0xff, 0x43, 0x00, 0x00, 0x00, 0xd4, 0x98, 0x00, 0x13, 0xff, 0x52, 0x00, 0x00, 0x00, 0xe5, 0x81,
+  0x00, 0x01, 0xe8, 0x82, 0x00, 0x00, 0x16, 0xfd, 0x57, 0x00, 0x00, 0x84, 0xe5, 0x29, 0x0a, 0x96,
+  0xeb, 0x08, 0x00, 0x00, 0x06, 0x9a, 0xf5, 0xfc, 0xe0, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0x95,
+  0x95, 0x8a, 0x66, 0x0e, 0x00, 0x00, 0xd2, 0xc3, 0x78, 0x84, 0xd6, 0xe9, 0x23, 0x00, 0xd2, 0x8e,
+  0x00, 0x00, 0x10, 0xf2, 0x87, 0x00, 0xd2, 0x8e, 0x00, 0x00, 0x00, 0xdc, 0x94, 0x00, 0xd2, 0x8e,
+  0x00, 0x01, 0x5a, 0xfe, 0x59, 0x00, 0xd2, 0xf6, 0xeb, 0xf4, 0xf4, 0x85, 0x01, 0x00, 0xd2, 0x9e,
+  0x25, 0x1a, 0x02, 0x00, 0x00, 0x00, 0xd2, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0x8e,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x8e, 0xab, 0x74, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x43, 0xf7, 0x93, 0x6e, 0xde, 0xb7, 0x00, 0x00, 0x00, 0x00, 0xc1, 0xa7, 0x00, 0x00, 0x39,
+  0xff, 0x31, 0x00, 0x00, 0x09, 0xff, 0x5f, 0x00, 0x00, 0x01, 0xf0, 0x76, 0x00, 0x00, 0x22, 0xff,
+  0x49, 0x00, 0x00, 0x00, 0xda, 0x8f, 0x00, 0x00, 0x2c, 0xff, 0x43, 0x00, 0x00, 0x00, 0xd4, 0x98,
+  0x00, 0x00, 0x13, 0xff, 0x52, 0x00, 0x00, 0x00, 0xe5, 0x81, 0x00, 0x00, 0x01, 0xe8, 0x83, 0x00,
+  0x00, 0x17, 0xfd, 0x59, 0x00, 0x00, 0x00, 0x84, 0xe6, 0x2a, 0x0a, 0x98, 0xf9, 0x0c, 0x00, 0x00,
+  0x00, 0x06, 0x9a, 0xf4, 0xfc, 0xde, 0xeb, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x14, 0x01,
+  0x38, 0xf5, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x95, 0x95, 0x95, 0x85, 0x54, 0x02, 0x00,
+  0x00, 0x04, 0xff, 0xa9, 0x78, 0x87, 0xe5, 0xa9, 0x00, 0x00, 0x04, 0xff, 0x5d, 0x00, 0x00, 0x3c,
+  0xff, 0x2a, 0x00, 0x04, 0xff, 0x5d, 0x00, 0x00, 0x1d, 0xff, 0x3d, 0x00, 0x04, 0xff, 0x72, 0x21,
+  0x32, 0xab, 0xe2, 0x0b, 0x00, 0x04, 0xff, 0xf7, 0xf6, 0xfd, 0xc9, 0x23, 0x00, 0x00, 0x04, 0xff,
+  0x5d, 0x00, 0x8c, 0xd3, 0x03, 0x00, 0x00, 0x04, 0xff, 0x5d, 0x00, 0x15, 0xf3, 0x5d, 0x00, 0x00,
+  0x04, 0xff, 0x5d, 0x00, 0x00, 0x89, 0xde, 0x06, 0x00, 0x04, 0xff, 0x5d, 0x00, 0x00, 0x14, 0xf3,
+  0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5d, 0xaf, 0xc1,
+  0xa5, 0x61, 0x00, 0x00, 0x00, 0x81, 0xea, 0x70, 0x4f, 0x71, 0xbd, 0x00, 0x00, 0x01, 0xed, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xf6, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x85, 0xff, 0xc3, 0x7e, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x92, 0xce, 0xfe, 0xb2, 0x04,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xf8, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xda, 0x79, 0x00, 0x00, 0x7f, 0x23, 0x00, 0x00, 0x4f, 0xfc, 0x46, 0x00, 0x00, 0xb4, 0xfb, 0xe9,
+  0xec, 0xf0, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x28, 0x1e, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x10,
+  0x00, 0x55, 0x7f, 0x7f, 0xbb, 0xf3, 0x7f, 0x7f, 0x7f, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x79, 0xe8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x79, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xe8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xe8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x95, 0x22, 0x00, 0x00, 0x00, 0x76, 0x58, 0x00, 0x2e, 0xff,
+  0x3a, 0x00, 0x00, 0x00, 0xca, 0x96, 0x00, 0x2e, 0xff, 0x3a, 0x00, 0x00, 0x00, 0xca, 0x96, 0x00,
+  0x2e, 0xff, 0x3a, 0x00, 0x00, 0x00, 0xca, 0x96, 0x00, 0x2e, 0xff, 0x3a, 0x00, 0x00, 0x00, 0xca,
+  0x96, 0x00, 0x2e, 0xff, 0x3a, 0x00, 0x00, 0x00, 0xca, 0x96, 0x00, 0x2c, 0xff, 0x3a, 0x00, 0x00,
+  0x00, 0xca, 0x95, 0x00, 0x1d, 0xff, 0x3d, 0x00, 0x00, 0x00, 0xce, 0x89, 0x00, 0x02, 0xe5, 0x90,
+  0x03, 0x00, 0x31, 0xf6, 0x54, 0x00, 0x00, 0x42, 0xe1, 0xf0, 0xe3, 0xf9, 0x93, 0x02, 0x00, 0x00,
+  0x00, 0x01, 0x1e, 0x2b, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4c, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x8c, 0x01, 0x00, 0x44, 0xfb, 0x11, 0x00, 0x00,
+  0x00, 0xa1, 0xb2, 0x00, 0x00, 0x05, 0xef, 0x58, 0x00, 0x00, 0x02, 0xea, 0x63, 0x00, 0x00, 0x00,
+  0xa6, 0xa4, 0x00, 0x00, 0x38, 0xfc, 0x16, 0x00, 0x00, 0x00, 0x57, 0xec, 0x03, 0x00, 0x83, 0xc3,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0xf8, 0x3c, 0x00, 0xcd, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7,
+  0x87, 0x1a, 0xfe, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xd2, 0x65, 0xd4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x19, 0xfd, 0xcc, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xff,
+  0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a,
+  0x24, 0x00, 0x5a, 0x94, 0x04, 0x00, 0x7a, 0x34, 0x00, 0xcc, 0x5b, 0x00, 0xba, 0xfe, 0x25, 0x00,
+  0xed, 0x3b, 0x00, 0xa3, 0x7e, 0x00, 0xe0, 0xc5, 0x4d, 0x11, 0xff, 0x13, 0x00, 0x7b, 0xa2, 0x09,
+  0xea, 0x81, 0x74, 0x34, 0xea, 0x00, 0x00, 0x54, 0xc5, 0x2e, 0xc4, 0x57, 0x9a, 0x57, 0xc2, 0x00,
+  0x00, 0x2d, 0xe8, 0x54, 0x9b, 0x2d, 0xc1, 0x7a, 0x9a, 0x00, 0x00, 0x08, 0xfc, 0x89, 0x72, 0x08,
+  0xe6, 0x9d, 0x72, 0x00, 0x00, 0x00, 0xdd, 0xd4, 0x48, 0x00, 0xda, 0xd2, 0x4a, 0x00, 0x00, 0x00,
+  0xb4, 0xff, 0x1e, 0x00, 0xb0, 0xff, 0x23, 0x00, 0x00, 0x00, 0x8c, 0xf2, 0x01, 0x00, 0x87, 0xf7,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x8e, 0x08,
+  0x00, 0x00, 0x00, 0x58, 0x82, 0x01, 0x00, 0x0c, 0xdb, 0x8d, 0x00, 0x00, 0x21, 0xf5, 0x57, 0x00,
+  0x00, 0x00, 0x36, 0xf8, 0x40, 0x00, 0xb9, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xe1, 0x6c,
+  0xe8, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0xff, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x06, 0xd2, 0xfc, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xdb, 0x59, 0xf0, 0x1b,
+  0x00, 0x00, 0x00, 0x00, 0x36, 0xfa, 0x40, 0x00, 0xb2, 0xb1, 0x00, 0x00, 0x00, 0x08, 0xd6, 0x97,
+  0x00, 0x00, 0x20, 0xf5, 0x57, 0x00, 0x00, 0x89, 0xe2, 0x0e, 0x00, 0x00, 0x00, 0x7b, 0xe8, 0x12,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x84, 0x01, 0x00, 0x00,
+  0x00, 0x48, 0x8e, 0x06, 0x00, 0x1e, 0xf3, 0x5e, 0x00, 0x00, 0x0c, 0xe5, 0x81, 0x00, 0x00, 0x00,
+  0x74, 0xe7, 0x0e, 0x00, 0x87, 0xd9, 0x08, 0x00, 0x00, 0x00, 0x05, 0xd2, 0x8c, 0x25, 0xf8, 0x42,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xf8, 0xc8, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xa2, 0xf4, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xe4, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7c, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xe4,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xe4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
+  0x4f, 0x00, 0x0c, 0x7f, 0x7f, 0x7f, 0x7f, 0x9d, 0xff, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0xbd, 0xbb, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xec, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2a, 0xf7, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xcd, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x82, 0xdb, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xf7, 0x37, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0b, 0xda, 0x91, 0x18, 0x18, 0x18, 0x18, 0x10, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xd3, 0xd3, 0xd3,
+  0x40, 0x00, 0xf9, 0x6c, 0x2f, 0x2f, 0x0e, 0x00, 0xf9, 0x4b, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x4b,
+  0x00, 0x00, 0x00, 0x00, 0xf9, 0x4b, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x4b, 0x00, 0x00, 0x00, 0x00,
+  0xf9, 0x4b, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x4b, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x4b, 0x00, 0x00,
+  0x00, 0x00, 0xf9, 0x4b, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x4b, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xda,
+  0xcb, 0xcb, 0x3d, 0x00, 0x39, 0x3b, 0x3b, 0x3b, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x2f, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xce, 0x7f, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4f, 0xee, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xce, 0x7e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xef, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0xce, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xef, 0x0f, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xd1, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xee, 0x0e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xd2, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54,
+  0xed, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x92, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xd3, 0xd3, 0xd3, 0x4e, 0x00, 0x2a, 0x2f, 0x2f, 0xe7, 0x5f,
+  0x00, 0x00, 0x00, 0x00, 0xe2, 0x5f, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x5f, 0x00, 0x00, 0x00, 0x00,
+  0xe2, 0x5f, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x5f, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x5f, 0x00, 0x00,
+  0x00, 0x00, 0xe2, 0x5f, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x5f, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x5f,
+  0x00, 0x00, 0x00, 0x00, 0xe2, 0x5f, 0x00, 0xb8, 0xce, 0xce, 0xf9, 0x5f, 0x00, 0x31, 0x37, 0x37,
+  0x37, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0x8f, 0x0b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3a, 0xf5, 0xd0, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x14, 0xe2, 0x7a, 0x1d,
+  0xee, 0x65, 0x00, 0x00, 0x02, 0xb8, 0xc1, 0x03, 0x00, 0x57, 0xf6, 0x2f, 0x00, 0x03, 0x14, 0x08,
+  0x00, 0x00, 0x00, 0x14, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a,
+  0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0xd2, 0x75, 0x00, 0x07, 0x37, 0x37, 0x37, 0x37, 0x37,
+  0x37, 0x37, 0x37, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x47, 0x7f, 0x06, 0x00, 0x00, 0x15, 0xe7, 0x87, 0x00, 0x00, 0x00, 0x4b, 0xfc, 0x3f, 0x00, 0x00,
+  0x00, 0x40, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x58, 0x5b, 0x56, 0x24, 0x00,
+  0x00, 0x00, 0x00, 0x0a, 0xa4, 0xa0, 0xad, 0xf0, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x32, 0xff, 0x22, 0x00, 0x00, 0x01, 0x3e, 0x79, 0x8c, 0x90, 0xff, 0x3f, 0x00, 0x00, 0x97, 0xe1,
+  0x7d, 0x65, 0x67, 0xff, 0x42, 0x00, 0x06, 0xfc, 0x44, 0x00, 0x00, 0x22, 0xff, 0x42, 0x00, 0x01,
+  0xf1, 0x6a, 0x00, 0x05, 0xa3, 0xff, 0x42, 0x00, 0x00, 0x5b, 0xf2, 0xd8, 0xe8, 0xa0, 0xe3, 0x41,
+  0x00, 0x00, 0x00, 0x09, 0x26, 0x11, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x40, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x91, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xaf, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x91, 0x1d, 0x56, 0x3c,
+  0x01, 0x00, 0x00, 0xaf, 0xcd, 0xe1, 0xa8, 0xd8, 0xaa, 0x01, 0x00, 0xaf, 0xf5, 0x1f, 0x00, 0x07,
+  0xd5, 0x44, 0x00, 0xaf, 0xba, 0x00, 0x00, 0x00, 0x83, 0x84, 0x00, 0xaf, 0xa7, 0x00, 0x00, 0x00,
+  0x72, 0x95, 0x00, 0xaf, 0xc3, 0x00, 0x00, 0x00, 0x8c, 0x7c, 0x00, 0xaf, 0xfc, 0x3b, 0x00, 0x18,
+  0xe4, 0x2e, 0x00, 0xaf, 0xa2, 0xd5, 0xd6, 0xef, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x54, 0x51,
+  0x13, 0x00, 0x00, 0x04, 0xa5, 0xf1, 0xaf, 0xb2, 0xed, 0x09, 0x00, 0x71, 0xe9, 0x1c, 0x00, 0x00,
+  0x1d, 0x04, 0x00, 0xc4, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x77, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xba, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xf6, 0x3d, 0x00, 0x00,
+  0x3c, 0x06, 0x00, 0x00, 0x77, 0xf0, 0xdc, 0xe0, 0xd6, 0x07, 0x00, 0x00, 0x00, 0x08, 0x24, 0x19,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x59, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x22, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x14, 0x4d, 0x41, 0x24, 0xff, 0x1f, 0x00, 0x00,
+  0x38, 0xec, 0xbb, 0xb9, 0xc6, 0xff, 0x1f, 0x00, 0x00, 0xca, 0x93, 0x00, 0x00, 0x8d, 0xff, 0x1f,
+  0x00, 0x0d, 0xff, 0x40, 0x00, 0x00, 0x36, 0xff, 0x1f, 0x00, 0x25, 0xff, 0x2f, 0x00, 0x00, 0x25,
+  0xff, 0x1f, 0x00, 0x0c, 0xfc, 0x49, 0x00, 0x00, 0x3f, 0xff, 0x1f, 0x00, 0x00, 0xbb, 0xaf, 0x03,
+  0x02, 0xaa, 0xff, 0x1f, 0x00, 0x00, 0x26, 0xdb, 0xe6, 0xe0, 0x82, 0xff, 0x1f, 0x00, 0x00, 0x00,
+  0x03, 0x24, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x3d, 0x53, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xd5, 0xd6, 0xa7, 0xe1, 0x99,
+  0x00, 0x00, 0x00, 0xb4, 0xb0, 0x04, 0x00, 0x10, 0xe8, 0x48, 0x00, 0x0b, 0xfb, 0x76, 0x3d, 0x3d,
+  0x3d, 0xc1, 0x84, 0x00, 0x1e, 0xff, 0xbb, 0xad, 0xad, 0xad, 0xad, 0x68, 0x00, 0x03, 0xf6, 0x4b,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xcc, 0x19, 0x00, 0x00, 0x33, 0x26, 0x00, 0x00,
+  0x0b, 0x96, 0xf4, 0xd8, 0xe8, 0xe5, 0x37, 0x00, 0x00, 0x00, 0x00, 0x05, 0x25, 0x1d, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+  0x10, 0x09, 0x00, 0x00, 0x00, 0x00, 0x36, 0xdf, 0xf4, 0xef, 0x82, 0x00, 0x00, 0x00, 0x00, 0xb0,
+  0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x85,
+  0x85, 0xec, 0xb9, 0x85, 0x62, 0x00, 0x00, 0x0e, 0x8b, 0x8b, 0xed, 0xbd, 0x8b, 0x67, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xd7, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x6e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x6e,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x4e, 0x50, 0x0f, 0x22, 0x0d, 0x00, 0x1e, 0xe0,
+  0xd3, 0xae, 0xe3, 0xea, 0x4e, 0x00, 0x9e, 0xc0, 0x04, 0x00, 0x57, 0xff, 0x4d, 0x00, 0xe2, 0x65,
+  0x00, 0x00, 0x07, 0xfc, 0x4c, 0x00, 0xf1, 0x53, 0x00, 0x00, 0x00, 0xf6, 0x4b, 0x00, 0xd2, 0x77,
+  0x00, 0x00, 0x17, 0xff, 0x4a, 0x00, 0x7a, 0xe3, 0x28, 0x07, 0x97, 0xff, 0x48, 0x00, 0x05, 0x9e,
+  0xfa, 0xf9, 0xb9, 0xe1, 0x47, 0x00, 0x00, 0x00, 0x04, 0x06, 0x02, 0xe9, 0x3b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x4e, 0xf8, 0x17, 0x00, 0x2b, 0x9b, 0x9d, 0xbd, 0xfe, 0x7f, 0x00, 0x00, 0x20, 0x73,
+  0x71, 0x6d, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x34,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0x95,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0x95, 0x21, 0x5e, 0x51, 0x05, 0x00, 0x00, 0xac, 0xcc,
+  0xd9, 0xb2, 0xee, 0xab, 0x00, 0x00, 0xac, 0xe5, 0x11, 0x00, 0x44, 0xfe, 0x13, 0x00, 0xac, 0xa2,
+  0x00, 0x00, 0x18, 0xff, 0x2b, 0x00, 0xac, 0x95, 0x00, 0x00, 0x14, 0xff, 0x2d, 0x00, 0xac, 0x95,
+  0x00, 0x00, 0x14, 0xff, 0x2d, 0x00, 0xac, 0x95, 0x00, 0x00, 0x14, 0xff, 0x2d, 0x00, 0xac, 0x95,
+  0x00, 0x00, 0x14, 0xff, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+  0xfd, 0x3d, 0x00, 0x00, 0x10, 0x7e, 0x1d, 0x00, 0x24, 0x31, 0x31, 0x0c, 0x00, 0xa0, 0xdc, 0xff,
+  0x3f, 0x00, 0x00, 0x00, 0xfe, 0x3c, 0x00, 0x00, 0x00, 0xfe, 0x3c, 0x00, 0x00, 0x00, 0xfe, 0x3d,
+  0x00, 0x00, 0x00, 0xfe, 0x40, 0x00, 0x00, 0x02, 0xff, 0x43, 0x00, 0x00, 0x02, 0xff, 0x41, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33,
+  0x78, 0x00, 0x00, 0x00, 0x08, 0x31, 0x31, 0x31, 0x03, 0x00, 0x00, 0x25, 0xdc, 0xe3, 0xff, 0x0e,
+  0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x0e, 0x00, 0x00,
+  0x00, 0x00, 0x33, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00,
+  0x33, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xff,
+  0x0a, 0x00, 0x00, 0x00, 0x00, 0x76, 0xec, 0x00, 0x00, 0x40, 0xa5, 0xb3, 0xfd, 0x86, 0x00, 0x00,
+  0x2c, 0x72, 0x70, 0x48, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xd3,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x74, 0xd7, 0x00, 0x00, 0x00, 0x2e, 0x1b, 0x00, 0x00, 0x74, 0xd7, 0x00, 0x04, 0x9b, 0xcd, 0x18,
+  0x00, 0x00, 0x74, 0xd7, 0x09, 0xb2, 0xbb, 0x0d, 0x00, 0x00, 0x00, 0x74, 0xe2, 0xc4, 0xdf, 0x06,
+  0x00, 0x00, 0x00, 0x00, 0x74, 0xff, 0x97, 0xee, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x74, 0xd9, 0x00,
+  0x4e, 0xf9, 0x3a, 0x00, 0x00, 0x00, 0x74, 0xd7, 0x00, 0x00, 0x89, 0xe4, 0x16, 0x00, 0x00, 0x74,
+  0xd7, 0x00, 0x00, 0x04, 0xc2, 0xbe, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0b, 0x98, 0x98, 0x98, 0x13, 0x00, 0x09, 0x78, 0x8e, 0xff, 0x1d, 0x00, 0x00, 0x00, 0x29,
+  0xff, 0x1b, 0x00, 0x00, 0x00, 0x28, 0xff, 0x19, 0x00, 0x00, 0x00, 0x28, 0xff, 0x19, 0x00, 0x00,
+  0x00, 0x28, 0xff, 0x19, 0x00, 0x00, 0x00, 0x28, 0xff, 0x19, 0x00, 0x00, 0x00, 0x28, 0xff, 0x19,
+  0x00, 0x00, 0x00, 0x28, 0xff, 0x19, 0x00, 0x00, 0x00, 0x28, 0xff, 0x19, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x15, 0x1e, 0x32, 0x46, 0x01, 0x2e, 0x4e, 0x08, 0x00, 0x70, 0xe5, 0xb0, 0xe4,
+  0xbc, 0xbd, 0xd7, 0x98, 0x00, 0x70, 0xcd, 0x00, 0x68, 0xe7, 0x00, 0x4a, 0xda, 0x00, 0x70, 0xb7,
+  0x00, 0x56, 0xd3, 0x00, 0x38, 0xeb, 0x00, 0x70, 0xb5, 0x00, 0x56, 0xcf, 0x00, 0x34, 0xf1, 0x00,
+  0x70, 0xb5, 0x00, 0x56, 0xcf, 0x00, 0x34, 0xf1, 0x00, 0x70, 0xb5, 0x00, 0x56, 0xcf, 0x00, 0x34,
+  0xf1, 0x00, 0x70, 0xb5, 0x00, 0x56, 0xcf, 0x00, 0x34, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x21, 0x17, 0x0f, 0x48, 0x1d, 0x00, 0x00, 0x00, 0xac, 0xad, 0xca, 0xb4,
+  0xed, 0x84, 0x00, 0x00, 0xac, 0xe6, 0x0f, 0x00, 0x49, 0xe6, 0x01, 0x00, 0xac, 0xa3, 0x00, 0x00,
+  0x19, 0xff, 0x24, 0x00, 0xac, 0x95, 0x00, 0x00, 0x14, 0xff, 0x2d, 0x00, 0xac, 0x95, 0x00, 0x00,
+  0x14, 0xff, 0x2d, 0x00, 0xac, 0x95, 0x00, 0x00, 0x14, 0xff, 0x2d, 0x00, 0xac, 0x95, 0x00, 0x00,
+  0x14, 0xff, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x3e,
+  0x4f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x26, 0xdb, 0xd0, 0xb2, 0xf3, 0x72, 0x00, 0x00, 0x00, 0xaf,
+  0xbb, 0x03, 0x00, 0x50, 0xfa, 0x21, 0x00, 0x00, 0xf0, 0x5f, 0x00, 0x00, 0x01, 0xf0, 0x5e, 0x00,
+  0x06, 0xff, 0x4c, 0x00, 0x00, 0x00, 0xdc, 0x75, 0x00, 0x00, 0xea, 0x69, 0x00, 0x00, 0x06, 0xf5,
+  0x58, 0x00, 0x00, 0x9a, 0xd3, 0x10, 0x00, 0x76, 0xf1, 0x14, 0x00, 0x00, 0x14, 0xb7, 0xf3, 0xe1,
+  0xeb, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x16, 0x1a, 0x4f, 0x2d, 0x00, 0x00, 0x00, 0xb3, 0xbd,
+  0xe5, 0xb5, 0xf7, 0x91, 0x00, 0x00, 0xb3, 0xfe, 0x33, 0x00, 0x1d, 0xf6, 0x36, 0x00, 0xb3, 0xd5,
+  0x00, 0x00, 0x00, 0xc4, 0x76, 0x00, 0xb3, 0xc2, 0x00, 0x00, 0x00, 0xa1, 0x8a, 0x00, 0xb3, 0xde,
+  0x00, 0x00, 0x00, 0xcf, 0x6e, 0x00, 0xb3, 0xff, 0x55, 0x00, 0x45, 0xf7, 0x21, 0x00, 0xb3, 0xb0,
+  0xdc, 0xe3, 0xf7, 0x64, 0x00, 0x00, 0xb3, 0x8e, 0x01, 0x1f, 0x06, 0x00, 0x00, 0x00, 0xb3, 0x8e,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x41,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x44, 0x38, 0x04, 0x27, 0x09, 0x00, 0x00, 0x23, 0xde, 0xc4, 0xcd, 0xb1, 0xfd, 0x34, 0x00,
+  0x00, 0xaa, 0x95, 0x00, 0x01, 0xab, 0xff, 0x34, 0x00, 0x00, 0xef, 0x37, 0x00, 0x00, 0x4f, 0xff,
+  0x34, 0x00, 0x09, 0xff, 0x24, 0x00, 0x00, 0x3b, 0xff, 0x34, 0x00, 0x01, 0xf2, 0x3e, 0x00, 0x00,
+  0x56, 0xff, 0x34, 0x00, 0x00, 0xa8, 0xad, 0x02, 0x07, 0xc0, 0xff, 0x34, 0x00, 0x00, 0x1c, 0xd7,
+  0xe3, 0xe8, 0x96, 0xff, 0x34, 0x00, 0x00, 0x00, 0x03, 0x2b, 0x12, 0x0d, 0xff, 0x34, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0xff, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xff, 0x34,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x72, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0c, 0x31, 0x02, 0x3c, 0x58, 0x30, 0x00, 0x00, 0x3c, 0xfd, 0xb9, 0xd9, 0xc0,
+  0xeb, 0x4f, 0x00, 0x3c, 0xff, 0x87, 0x02, 0x00, 0x08, 0x19, 0x00, 0x3c, 0xfe, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3c, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xff, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3c, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xff, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x45, 0x57, 0x3d,
+  0x07, 0x00, 0x00, 0x1d, 0xe2, 0xd3, 0xa7, 0xc8, 0xa2, 0x00, 0x00, 0x72, 0xdf, 0x03, 0x00, 0x00,
+  0x0d, 0x00, 0x00, 0x54, 0xf5, 0x6f, 0x2d, 0x04, 0x00, 0x00, 0x00, 0x01, 0x5d, 0xb7, 0xf1, 0xdf,
+  0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x86, 0xe2, 0x01, 0x00, 0x36, 0x1a, 0x00, 0x00, 0x71,
+  0xe5, 0x00, 0x00, 0x71, 0xf4, 0xde, 0xdb, 0xe3, 0x47, 0x00, 0x00, 0x00, 0x06, 0x21, 0x1f, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x61, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x40, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x32, 0x31, 0x31, 0x01, 0x00,
+  0x40, 0xff, 0xe3, 0xe3, 0xe3, 0x07, 0x00, 0x40, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xff, 0x04, 0x00,
+  0x00, 0x00, 0x00, 0x1f, 0xff, 0x51, 0x10, 0x0d, 0x09, 0x00, 0x00, 0x83, 0xef, 0xff, 0xff, 0xa4,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0x07, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27,
+  0x12, 0x00, 0x00, 0x00, 0x2d, 0x0c, 0x00, 0xd9, 0x64, 0x00, 0x00, 0x01, 0xff, 0x43, 0x00, 0xd9,
+  0x64, 0x00, 0x00, 0x02, 0xff, 0x45, 0x00, 0xd9, 0x64, 0x00, 0x00, 0x05, 0xff, 0x46, 0x00, 0xd9,
+  0x64, 0x00, 0x00, 0x08, 0xff, 0x46, 0x00, 0xc5, 0x79, 0x00, 0x00, 0x15, 0xff, 0x46, 0x00, 0x7f,
+  0xcb, 0x14, 0x01, 0x89, 0xff, 0x46, 0x00, 0x24, 0xba, 0xf7, 0xec, 0xbc, 0xed, 0x46, 0x00, 0x00,
+  0x00, 0x1a, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+  0x31, 0x01, 0x00, 0x00, 0x00, 0x1d, 0x22, 0x00, 0x14, 0xf9, 0x3d, 0x00, 0x00, 0x00, 0xd0, 0x79,
+  0x00, 0x00, 0xad, 0x9b, 0x00, 0x00, 0x30, 0xfc, 0x1c, 0x00, 0x00, 0x4d, 0xf0, 0x09, 0x00, 0x8e,
+  0xb8, 0x00, 0x00, 0x00, 0x04, 0xe7, 0x59, 0x04, 0xe8, 0x59, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xb7,
+  0x4b, 0xef, 0x09, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xfb, 0xc0, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xc8, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x13, 0x00, 0xd3, 0x67, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xf3, 0x40, 0x00, 0x93, 0xa2, 0x00, 0x13, 0x21, 0x00, 0x2c, 0xf7, 0x08, 0x00, 0x53, 0xdb,
+  0x00, 0xac, 0xfd, 0x1a, 0x60, 0xc0, 0x00, 0x00, 0x15, 0xfd, 0x19, 0xec, 0xba, 0x69, 0x95, 0x81,
+  0x00, 0x00, 0x00, 0xd4, 0x89, 0xc4, 0x56, 0xba, 0xcb, 0x42, 0x00, 0x00, 0x00, 0x94, 0xf4, 0x76,
+  0x0e, 0xf4, 0xf2, 0x09, 0x00, 0x00, 0x00, 0x55, 0xff, 0x27, 0x00, 0xb9, 0xc1, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x31, 0x0d, 0x00, 0x00, 0x00,
+  0x29, 0x1c, 0x00, 0x01, 0xa9, 0xb7, 0x02, 0x00, 0x50, 0xef, 0x27, 0x00, 0x00, 0x0b, 0xd1, 0x81,
+  0x25, 0xee, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x22, 0xec, 0xe0, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xb7, 0xfc, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xda, 0x89, 0xd8, 0x0f, 0x00, 0x00,
+  0x00, 0x4a, 0xf3, 0x2e, 0x01, 0xb2, 0xb2, 0x02, 0x00, 0x25, 0xef, 0x5c, 0x00, 0x00, 0x11, 0xdd,
+  0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x33, 0x0c, 0x00, 0x00,
+  0x00, 0x30, 0x10, 0x00, 0x08, 0xff, 0x3a, 0x00, 0x00, 0x00, 0xf4, 0x4d, 0x00, 0x0b, 0xff, 0x3a,
+  0x00, 0x00, 0x00, 0xf1, 0x4f, 0x00, 0x0b, 0xff, 0x3a, 0x00, 0x00, 0x00, 0xf1, 0x50, 0x00, 0x0b,
+  0xff, 0x3a, 0x00, 0x00, 0x00, 0xf1, 0x52, 0x00, 0x08, 0xfc, 0x46, 0x00, 0x00, 0x00, 0xf1, 0x54,
+  0x00, 0x00, 0xb0, 0xa9, 0x28, 0x1f, 0x1f, 0xf2, 0x54, 0x00, 0x00, 0x27, 0x9f, 0xf1, 0xfc, 0xfc,
+  0xff, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x24, 0xfc, 0x16, 0x00, 0x00, 0x3c, 0x9f, 0xa1, 0xa2, 0xe4, 0xa7, 0x00, 0x00, 0x00, 0x2e,
+  0x79, 0x79, 0x79, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x17, 0x34, 0x34, 0x34, 0x34, 0x34, 0x06, 0x00, 0x52, 0xb9, 0xb9, 0xb9, 0xd0, 0xff, 0x1a, 0x00,
+  0x00, 0x00, 0x00, 0x0d, 0xd1, 0x91, 0x00, 0x00, 0x00, 0x00, 0x03, 0xb5, 0xb6, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x92, 0xd2, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x6b, 0xe7, 0x1f, 0x00, 0x00, 0x00, 0x00,
+  0x48, 0xf2, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xfd, 0xf8, 0xf8, 0xf8, 0xf8, 0x1b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8d, 0xeb, 0xfe, 0x0a, 0x00, 0x00, 0x00, 0x25, 0xff, 0x5d, 0x24, 0x01, 0x00,
+  0x00, 0x00, 0x41, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x54, 0xfa, 0x02, 0x00, 0x00, 0x00, 0x4c, 0x70, 0xd3, 0xa8, 0x00, 0x00, 0x00, 0x00,
+  0x98, 0xd9, 0xf4, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xe8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x47, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xff, 0x08, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x35, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xe6, 0xdc, 0xb5, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x13, 0x58, 0x6c, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x42, 0x78, 0x00, 0x6b, 0xc1, 0x00, 0x6b, 0xc1, 0x00, 0x6b, 0xc1, 0x00, 0x6b, 0xc1, 0x00, 0x6b,
+  0xc1, 0x00, 0x6b, 0xc1, 0x00, 0x6b, 0xc1, 0x00, 0x6b, 0xc1, 0x00, 0x6b, 0xc1, 0x00, 0x6b, 0xc1,
+  0x00, 0x6b, 0xc1, 0x00, 0x03, 0x05, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x9a, 0xf5, 0xc8, 0x24, 0x00, 0x00, 0x00, 0x00, 0x14, 0x2d, 0xcf, 0x8d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x97, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xac, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x8d, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xf7, 0x9c, 0x69,
+  0x16, 0x00, 0x00, 0x00, 0x13, 0xc5, 0xf7, 0xd4, 0x2d, 0x00, 0x00, 0x00, 0x79, 0xe1, 0x13, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x93, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xac, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xaa, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xc2, 0xfb, 0x5a, 0x00, 0x00,
+  0x00, 0x00, 0x43, 0x62, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x18, 0x62, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xdf, 0xa6, 0xe5, 0x4f,
+  0x00, 0x49, 0xa7, 0x00, 0x56, 0xc6, 0x00, 0x2f, 0xe9, 0x69, 0xbf, 0x7f, 0x00, 0x04, 0x19, 0x00,
+  0x00, 0x3c, 0xa8, 0x7f, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const app::AtlasGlyph proggy_atlas_16_glyphs[] = {
+  {9, 0, 0, 0, 0, 0}, // ' '
+  {9, 3, -12, 4, 14, 0}, // '!'
+  {9, 2, -11, 6, 6, 56}, // '"'
+  {9, 0, -11, 11, 12, 92}, // '#'
+  {9, 1, -12, 9, 14, 224}, // '$'
+  {9, 0, -11, 11, 12, 350}, // '%'
+  {9, 0, -12, 11, 14, 482}, // '&'
+  {9, 4, -11, 3, 6, 636}, // "'"
+  {9, 2, -13, 6, 16, 654}, // '('
+  {9, 3, -13, 5, 16, 750}, // ')'
+  {9, 0, -10, 10, 10, 830}, // '*'
+  {9, 0, -10, 10, 10, 930}, // '+'
+  {9, 3, -3, 4, 7, 1030}, // ','
+  {9, 1, -7, 9, 4, 1058}, // '-'
+  {9, 3, -3, 4, 5, 1094}, // '.'
+  {9, 1, -12, 9, 14, 1114}, // '/'
+  {9, 1, -12, 9, 14, 1240}, // '0'
+  {9, 2, -11, 7, 12, 1366}, // '1'
+  {9, 1, -12, 9, 13, 1450}, // '2'
+  {9, 1, -12, 9, 14, 1567}, // '3'
+  {9, 0, -11, 10, 12, 1693}, // '4'
+  {9, 1, -11, 9, 13, 1813}, // '5'
+  {9, 1, -11, 9, 13, 1930}, // '6'
+  {9, 1, -11, 9, 12, 2047}, // '7'
+  {9, 1, -12, 9, 14, 2155}, // '8'
+  {9, 0, -12, 10, 14, 2281}, // '9'
+  {9, 3, -10, 5, 10, 2421}, // ':'
+  {9, 3, -10, 5, 12, 2471}, // ';'
+  {9, 0, -10, 10, 10, 2531}, // '<'
+  {9, 0, -8, 10, 6, 2631}, // '='
+  {9, 0, -10, 10, 10, 2691}, // '>'
+  {9, 1, -12, 9, 14, 2791}, // '?'
+  {9, 0, -12, 13, 14, 2917}, // '@'
+  {9, 0, -11, 11, 12, 3099}, // 'A'
+  {9, 1, -11, 9, 12, 3231}, // 'B'
+  {9, 1, -12, 9, 14, 3339}, // 'C'
+  {9, 1, -11, 9, 12, 3465}, // 'D'
+  {9, 1, -11, 9, 12, 3573}, // 'E'
+  {9, 1, -11, 9, 12, 3681}, // 'F'
+  {9, 0, -12, 10, 14, 3789}, // 'G'
+  {9, 1, -11, 9, 12, 3929}, // 'H'
+  {9, 1, -11, 9, 12, 4037}, // 'I'
+  {9, 0, -11, 9, 13, 4145}, // 'J'
+  {9, 1, -11, 10, 12, 4262}, // 'K'
+  {9, 1, -11, 9, 12, 4382}, // 'L'
+  {9, 0, -11, 11, 12, 4490}, // 'M'
+  {9, 1, -11, 9, 12, 4622}, // 'N'
+  {9, 0, -12, 10, 14, 4730}, // 'O'
+  {9, 1, -11, 9, 12, 4870}, // 'P'
+  {9, 0, -12, 11, 15, 4978}, // 'Q'
+  {9, 1, -11, 9, 12, 5143}, // 'R'
+  {9, 1, -12, 9, 14, 5251}, // 'S'
+  {9, 0, -11, 11, 12, 5377}, // 'T'
+  {9, 0, -11, 10, 13, 5509}, // 'U'
+  {9, 0, -11, 11, 12, 5639}, // 'V'
+  {9, 0, -11, 11, 12, 5771}, // 'W'
+  {9, 0, -11, 11, 12, 5903}, // 'X'
+  {9, 0, -11, 11, 12, 6035}, // 'Y'
+  {9, 0, -11, 10, 12, 6167}, // 'Z'
+  {9, 2, -13, 7, 16, 6287}, // '['
+  {9, 0, -12, 10, 14, 6399}, // '\\'
+  {9, 2, -13, 7, 16, 6539}, // ']'
+  {9, 0, -11, 10, 6, 6651}, // '^'
+  {9, 0, 0, 12, 3, 6711}, // '_'
+  {9, 2, -13, 6, 6, 6747}, // '`'
+  {9, 1, -9, 9, 11, 6783}, // 'a'
+  {9, 1, -12, 9, 14, 6882}, // 'b'
+  {9, 1, -9, 9, 11, 7008}, // 'c'
+  {9, 0, -12, 10, 14, 7107}, // 'd'
+  {9, 0, -9, 10, 11, 7247}, // 'e'
+  {9, 1, -12, 9, 13, 7357}, // 'f'
+  {9, 1, -9, 9, 14, 7474}, // 'g'
+  {9, 1, -12, 9, 13, 7600}, // 'h'
+  {9, 2, -12, 6, 13, 7717}, // 'i'
+  {9, 1, -12, 7, 17, 7795}, // 'j'
+  {9, 1, -12, 10, 13, 7914}, // 'k'
+  {9, 2, -11, 5, 12, 8044}, // 'l'
+  {9, 0, -9, 11, 10, 8104}, // 'm'
+  {9, 1, -9, 9, 10, 8214}, // 'n'
+  {9, 1, -9, 9, 11, 8304}, // 'o'
+  {9, 1, -9, 9, 14, 8403}, // 'p'
+  {9, 1, -9, 9, 14, 8529}, // 'q'
+  {9, 2, -9, 8, 10, 8655}, // 'r'
+  {9, 1, -9, 9, 11, 8735}, // 's'
+  {9, 2, -11, 7, 13, 8834}, // 't'
+  {9, 1, -9, 9, 11, 8925}, // 'u'
+  {9, 0, -9, 10, 10, 9024}, // 'v'
+  {9, 0, -9, 11, 10, 9124}, // 'w'
+  {9, 0, -9, 11, 10, 9234}, // 'x'
+  {9, 1, -9, 9, 14, 9344}, // 'y'
+  {9, 1, -9, 9, 10, 9470}, // 'z'
+  {9, 1, -13, 9, 16, 9560}, // '{'
+  {9, 4, -13, 3, 16, 9704}, // '|'
+  {9, 1, -13, 9, 16, 9752}, // '}'
+  {9, 0, -8, 10, 6, 9896}, // '~'
+};
+
+static const uint8_t proggy_atlas_16_coverage[] = {
+  0x10, 0x8f, 0x5e, 0x00, 0x1c, 0xff, 0xa7, 0x00, 0x19, 0xff, 0xa5, 0x00, 0x0c, 0xff, 0x9c, 0x00,
+  0x02, 0xfd, 0x90, 0x00, 0x00, 0xf1, 0x86, 0x00, 0x00, 0xe3, 0x7c, 0x00, 0x00, 0xba, 0x61, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x0c, 0x00, 0x2c, 0xfb, 0xd1, 0x00, 0x20, 0xea, 0xb3, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0xf3, 0x00, 0x5b, 0xef, 0x00, 0x5c, 0xff,
+  0x00, 0x60, 0xfb, 0x00, 0x5c, 0xff, 0x00, 0x60, 0xfb, 0x00, 0x5c, 0xff, 0x00, 0x60, 0xfb, 0x00,
+  0x0a, 0x1c, 0x00, 0x0a, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0xd7, 0x32, 0x00, 0xba, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xf4, 0x06, 0x1a, 0xfe, 0x27,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xb5, 0x00, 0x5e, 0xe1, 0x00, 0x00, 0x00, 0x14, 0xd3, 0xd3,
+  0xf2, 0xeb, 0xd3, 0xea, 0xf3, 0xd3, 0x7d, 0x00, 0x07, 0x50, 0x63, 0xff, 0x78, 0x60, 0xf3, 0x87,
+  0x50, 0x2f, 0x00, 0x00, 0x00, 0x55, 0xec, 0x02, 0x24, 0xfe, 0x17, 0x00, 0x00, 0x00, 0x3b, 0x3c,
+  0xa9, 0xbc, 0x28, 0x7b, 0xe2, 0x3c, 0x2a, 0x00, 0x00, 0xdc, 0xdf, 0xff, 0xe8, 0xdf, 0xf9, 0xed,
+  0xdf, 0x9d, 0x00, 0x00, 0x00, 0x22, 0xff, 0x1e, 0x04, 0xf1, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x66, 0xd9, 0x00, 0x3a, 0xf9, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0x8b, 0x00, 0x72, 0xb1,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x31, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xcb, 0xb9, 0x2e, 0x04,
+  0x00, 0x00, 0x04, 0xa5, 0xf0, 0xeb, 0xe7, 0xe5, 0xda, 0x00, 0x00, 0x65, 0xf9, 0x25, 0xaf, 0x97,
+  0x00, 0x31, 0x00, 0x00, 0x85, 0xe2, 0x01, 0xaf, 0x97, 0x00, 0x00, 0x00, 0x00, 0x39, 0xfc, 0x9d,
+  0xc8, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xc6, 0xfa, 0xff, 0xd8, 0x5a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xaf, 0xaa, 0x59, 0xf3, 0x48, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x97, 0x00, 0xb0, 0x94,
+  0x00, 0x42, 0x19, 0x00, 0xaf, 0x97, 0x0a, 0xe2, 0x6d, 0x00, 0x79, 0xf9, 0xc4, 0xe4, 0xdf, 0xe6,
+  0xac, 0x05, 0x00, 0x00, 0x13, 0x47, 0xc9, 0xbb, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31,
+  0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x78,
+  0xa8, 0x5f, 0x00, 0x00, 0x0f, 0xab, 0x4a, 0x00, 0x00, 0x7d, 0xcc, 0x68, 0xe3, 0x57, 0x00, 0x90,
+  0xe0, 0x0a, 0x00, 0x00, 0xa6, 0x73, 0x00, 0x9a, 0x82, 0x2c, 0xfb, 0x54, 0x00, 0x00, 0x00, 0x45,
+  0xed, 0xbb, 0xed, 0x2a, 0xbf, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x4e, 0x16, 0x57, 0xfb,
+  0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xe3, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x86, 0xe8, 0x0f, 0x28, 0x3c, 0x04, 0x00, 0x00, 0x00, 0x00, 0x24, 0xf8, 0x60,
+  0x77, 0xec, 0xda, 0xca, 0x08, 0x00, 0x00, 0x00, 0xb3, 0xc8, 0x02, 0xe5, 0x38, 0x03, 0xdc, 0x45,
+  0x00, 0x00, 0x4a, 0xfd, 0x35, 0x00, 0xbc, 0x97, 0x64, 0xf0, 0x1f, 0x00, 0x00, 0x93, 0x80, 0x00,
+  0x00, 0x1b, 0x98, 0xae, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x35, 0x32, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xd7,
+  0xf2, 0xf3, 0xc1, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xd9, 0x0d, 0x27, 0xfd, 0x35, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xa1, 0xd6, 0x03, 0x3d, 0xfc, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32,
+  0xf1, 0xb5, 0xe9, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xb0, 0xff, 0xa7, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xce, 0x80, 0xfa, 0x3b, 0x00, 0x00, 0x84, 0x35, 0x00, 0x2e,
+  0xf8, 0x1a, 0x00, 0xa7, 0xe5, 0x18, 0x00, 0xe7, 0x51, 0x00, 0x83, 0xdd, 0x00, 0x00, 0x0b, 0xd2,
+  0xc1, 0x15, 0xfc, 0x28, 0x00, 0x6a, 0xfa, 0x16, 0x00, 0x00, 0x24, 0xef, 0xde, 0xc3, 0x00, 0x00,
+  0x18, 0xe7, 0xbf, 0x23, 0x00, 0x18, 0xb8, 0xff, 0x6d, 0x00, 0x00, 0x00, 0x2e, 0xc6, 0xff, 0xee,
+  0xfa, 0xa0, 0x87, 0xf4, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x13, 0x2a, 0x07, 0x00, 0x00, 0x03, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0x95, 0x00, 0xd7,
+  0x97, 0x00, 0xd7, 0x97, 0x00, 0xd7, 0x97, 0x00, 0x14, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x1c, 0x05, 0x00, 0x00, 0x00, 0x6e, 0xd5, 0x04, 0x00, 0x00, 0x12, 0xef, 0x57, 0x00, 0x00,
+  0x00, 0x7b, 0xe8, 0x05, 0x00, 0x00, 0x00, 0xd9, 0x9b, 0x00, 0x00, 0x00, 0x1e, 0xff, 0x60, 0x00,
+  0x00, 0x00, 0x48, 0xff, 0x3b, 0x00, 0x00, 0x00, 0x5a, 0xff, 0x2b, 0x00, 0x00, 0x00, 0x4b, 0xff,
+  0x48, 0x00, 0x00, 0x00, 0x28, 0xff, 0x6f, 0x00, 0x00, 0x00, 0x00, 0xe4, 0x97, 0x00, 0x00, 0x00,
+  0x00, 0x87, 0xe5, 0x06, 0x00, 0x00, 0x00, 0x1d, 0xf7, 0x62, 0x00, 0x00, 0x00, 0x00, 0x82, 0xd6,
+  0x02, 0x00, 0x00, 0x00, 0x09, 0x48, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x18,
+  0x00, 0x00, 0x00, 0x66, 0xd7, 0x06, 0x00, 0x00, 0x04, 0xdf, 0x72, 0x00, 0x00, 0x00, 0x7b, 0xe2,
+  0x04, 0x00, 0x00, 0x2b, 0xff, 0x47, 0x00, 0x00, 0x01, 0xed, 0x8b, 0x00, 0x00, 0x00, 0xce, 0xb1,
+  0x00, 0x00, 0x00, 0xbf, 0xc2, 0x00, 0x00, 0x00, 0xc8, 0xb1, 0x00, 0x00, 0x00, 0xeb, 0x8b, 0x00,
+  0x00, 0x29, 0xff, 0x48, 0x00, 0x00, 0x80, 0xe3, 0x04, 0x00, 0x05, 0xe1, 0x74, 0x00, 0x00, 0x6b,
+  0xd9, 0x07, 0x00, 0x00, 0x26, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x82, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0xe7, 0x74, 0x00, 0x00,
+  0x06, 0x00, 0x13, 0xe1, 0x86, 0x0f, 0xe7, 0x74, 0x3a, 0xc3, 0x9a, 0x00, 0x02, 0x5e, 0xe2, 0xeb,
+  0xf7, 0xe4, 0xfe, 0xb1, 0x2a, 0x00, 0x00, 0x00, 0x23, 0xe6, 0xff, 0xff, 0x99, 0x02, 0x00, 0x00,
+  0x0b, 0x82, 0xf4, 0xd5, 0xf4, 0xd2, 0xf8, 0xcf, 0x41, 0x00, 0x0b, 0xc1, 0x60, 0x03, 0xe7, 0x74,
+  0x1f, 0xa2, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x89, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xdf, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x70, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x10, 0x10, 0x10, 0xe1, 0x79, 0x10, 0x10, 0x0f, 0x00, 0x5c, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xf3, 0x00, 0x11, 0x30, 0x30, 0x30, 0xe5, 0x8a, 0x30, 0x30, 0x2e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xdf, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x0e, 0x00, 0x30, 0xfd, 0xd1, 0x00, 0x21, 0xed,
+  0xe8, 0x00, 0x00, 0xa0, 0x9a, 0x00, 0x63, 0xe1, 0x16, 0x00, 0x4c, 0x24, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x14, 0x14, 0x14, 0x14, 0x14, 0x14, 0x07, 0x00, 0xb3, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x58, 0x00, 0x22, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x11, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0d, 0x00, 0x2c, 0xfc, 0xd3, 0x00, 0x20, 0xea,
+  0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0x91, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0xf9, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0xdd, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0xf9, 0x1f, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0xdc, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xfa, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xdb, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xfa, 0x21, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0xda, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xfb, 0x22, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xd9, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xfb, 0x23,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x0a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3b, 0xdf, 0xff, 0xfa, 0xb2, 0x0e, 0x00, 0x00, 0x1c, 0xf5, 0xb6, 0x38, 0x53, 0xed,
+  0xbe, 0x00, 0x00, 0x7e, 0xed, 0x0c, 0x00, 0x01, 0xb4, 0xff, 0x32, 0x00, 0xc2, 0xac, 0x00, 0x00,
+  0x76, 0xff, 0xfd, 0x6d, 0x00, 0xda, 0x88, 0x00, 0x48, 0xfc, 0x8f, 0xdc, 0x8b, 0x00, 0xed, 0x7e,
+  0x24, 0xee, 0xbd, 0x04, 0xd1, 0x94, 0x00, 0xdb, 0x95, 0xd3, 0xdf, 0x14, 0x00, 0xdb, 0x8c, 0x00,
+  0xc3, 0xfd, 0xf3, 0x2e, 0x00, 0x06, 0xf7, 0x70, 0x00, 0x82, 0xff, 0x5d, 0x00, 0x00, 0x4d, 0xff,
+  0x36, 0x00, 0x1e, 0xf7, 0xbe, 0x3b, 0x4d, 0xe7, 0xc3, 0x01, 0x00, 0x00, 0x41, 0xe6, 0xff, 0xfd,
+  0xba, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xec, 0xb6, 0x00, 0x00, 0x00, 0x9b, 0xff, 0xf3,
+  0xbf, 0x00, 0x00, 0x00, 0xe4, 0x5e, 0xaf, 0xbf, 0x00, 0x00, 0x00, 0x28, 0x00, 0xaf, 0xbf, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xaf, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xbf, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xaf, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xaf, 0xbf, 0x00, 0x00, 0x00, 0x43, 0x48, 0xc6, 0xd1, 0x48, 0x45, 0x00, 0xef, 0xff, 0xff, 0xff,
+  0xff, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x23, 0x0f, 0x00,
+  0x00, 0x00, 0x00, 0x3f, 0xbb, 0xfc, 0xff, 0xfd, 0xb3, 0x1b, 0x00, 0x00, 0xb9, 0xa0, 0x4a, 0x1f,
+  0x58, 0xf1, 0xce, 0x01, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x86, 0xff, 0x24, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x80, 0xff, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xdb, 0xc2, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xa3, 0xea, 0x22, 0x00, 0x00, 0x00, 0x00, 0x01, 0x93, 0xf1, 0x33, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x8d, 0xf0, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xed, 0x34, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x83, 0xfe, 0x7a, 0x48, 0x48, 0x48, 0x48, 0x22, 0x00, 0xcf, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x16, 0x28, 0x11, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xe7, 0xff, 0xff, 0xfe, 0xc5, 0x2b, 0x00,
+  0x00, 0x49, 0x5e, 0x2c, 0x1a, 0x41, 0xd9, 0xdf, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61,
+  0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xfd, 0x20, 0x00, 0x00, 0x00, 0x61, 0x7d,
+  0xa9, 0xef, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x9b, 0xc6, 0xec, 0xc5, 0x38, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0x9b, 0xf7, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xff, 0x79, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xff, 0x6d, 0x00, 0x87, 0x4e, 0x18, 0x13, 0x3e, 0xcc, 0xf3,
+  0x23, 0x00, 0xa6, 0xfa, 0xff, 0xff, 0xff, 0xda, 0x44, 0x00, 0x00, 0x00, 0x09, 0x29, 0x32, 0x1e,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x44, 0xf3, 0xf3, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xde, 0xdf, 0xff, 0x24, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x8f, 0xf9, 0x46, 0xff, 0x24, 0x00, 0x00, 0x00, 0x00, 0x38, 0xfc, 0x7e,
+  0x18, 0xff, 0x24, 0x00, 0x00, 0x00, 0x07, 0xd4, 0xd2, 0x06, 0x18, 0xff, 0x24, 0x00, 0x00, 0x00,
+  0x80, 0xfc, 0x37, 0x00, 0x18, 0xff, 0x24, 0x00, 0x00, 0x29, 0xf9, 0x90, 0x00, 0x00, 0x18, 0xff,
+  0x24, 0x00, 0x00, 0x60, 0xff, 0xdb, 0xd3, 0xd3, 0xd7, 0xff, 0xd9, 0xd3, 0x00, 0x25, 0x64, 0x64,
+  0x64, 0x64, 0x8d, 0xff, 0x79, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xff, 0x24, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xff, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xaf, 0x00, 0x00, 0x64, 0xff,
+  0x53, 0x48, 0x48, 0x48, 0x34, 0x00, 0x00, 0x64, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x64, 0xff, 0x34, 0x3b, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x64, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x1f,
+  0x00, 0x00, 0x2e, 0x37, 0x08, 0x0c, 0x53, 0xed, 0xc8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6b, 0xff, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x73, 0xff, 0x2c, 0x00, 0x7f, 0x3f, 0x13, 0x1d, 0x61, 0xf1, 0xbe, 0x02, 0x00, 0xc6,
+  0xff, 0xff, 0xff, 0xfd, 0xb1, 0x18, 0x00, 0x00, 0x00, 0x16, 0x2f, 0x2d, 0x0f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xc2, 0xf3, 0xf2,
+  0x94, 0x00, 0x00, 0x00, 0x90, 0xf9, 0x80, 0x3b, 0x43, 0x65, 0x00, 0x00, 0x3c, 0xfe, 0x4b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xce, 0x01, 0x2c, 0x2f, 0x07, 0x00, 0x00, 0x00, 0xca, 0xae,
+  0xc8, 0xf6, 0xf7, 0xef, 0x57, 0x00, 0x00, 0xeb, 0xfa, 0x7e, 0x04, 0x06, 0x9a, 0xf8, 0x24, 0x00,
+  0xeb, 0xe4, 0x02, 0x00, 0x00, 0x19, 0xff, 0x72, 0x00, 0xd2, 0xc7, 0x00, 0x00, 0x00, 0x01, 0xfb,
+  0x8e, 0x00, 0x9a, 0xe7, 0x03, 0x00, 0x00, 0x20, 0xff, 0x70, 0x00, 0x30, 0xfc, 0x92, 0x11, 0x1e,
+  0xb1, 0xf4, 0x1f, 0x00, 0x00, 0x58, 0xe9, 0xff, 0xff, 0xdc, 0x48, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x1f, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc,
+  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0x64, 0x00, 0x41, 0x48, 0x48, 0x48, 0x48, 0x9f, 0xfc, 0x1c,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff,
+  0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xdf, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b,
+  0xfa, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xfa, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0xe7, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xc4, 0xdb, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xff, 0x74, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x24, 0x14,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x8c, 0xf4, 0xff, 0xff, 0xd7, 0x43, 0x00, 0x00, 0x65, 0xff, 0x6f,
+  0x08, 0x1a, 0xbc, 0xf1, 0x14, 0x00, 0xa7, 0xea, 0x00, 0x00, 0x00, 0x4a, 0xff, 0x4a, 0x00, 0x8b,
+  0xf5, 0x0b, 0x00, 0x00, 0x61, 0xff, 0x35, 0x00, 0x12, 0xd2, 0xc4, 0x6b, 0x7d, 0xeb, 0xa1, 0x00,
+  0x00, 0x06, 0x92, 0xf9, 0xd9, 0xe7, 0xe3, 0x5f, 0x00, 0x00, 0x8a, 0xf4, 0x31, 0x00, 0x01, 0x7e,
+  0xff, 0x43, 0x00, 0xe2, 0xac, 0x00, 0x00, 0x00, 0x09, 0xfd, 0x8b, 0x00, 0xe2, 0xb6, 0x00, 0x00,
+  0x00, 0x13, 0xff, 0x90, 0x00, 0x97, 0xfc, 0x59, 0x04, 0x11, 0xa2, 0xff, 0x46, 0x00, 0x0c, 0xa1,
+  0xfc, 0xfa, 0xfe, 0xe6, 0x62, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x29, 0x1d, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x22, 0x13, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x8c, 0xf8, 0xff, 0xfe, 0xb7, 0x16, 0x00, 0x00, 0x00, 0x88, 0xfc,
+  0x55, 0x07, 0x2d, 0xdd, 0xbc, 0x00, 0x00, 0x00, 0xe3, 0xb4, 0x00, 0x00, 0x00, 0x5f, 0xff, 0x2b,
+  0x00, 0x01, 0xfc, 0x93, 0x00, 0x00, 0x00, 0x38, 0xff, 0x63, 0x00, 0x00, 0xe0, 0xab, 0x00, 0x00,
+  0x00, 0x55, 0xff, 0x80, 0x00, 0x00, 0x90, 0xf7, 0x36, 0x00, 0x12, 0xcd, 0xfd, 0x87, 0x00, 0x00,
+  0x0f, 0xb6, 0xfe, 0xe6, 0xf6, 0x93, 0xfd, 0x76, 0x00, 0x00, 0x00, 0x01, 0x24, 0x43, 0x1f, 0x3d,
+  0xff, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0xea, 0x07, 0x00, 0x00, 0x10, 0x35,
+  0x10, 0x29, 0x97, 0xfe, 0x62, 0x00, 0x00, 0x00, 0x20, 0xee, 0xff, 0xfe, 0xd6, 0x5a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x11, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x18, 0xe8, 0xc3, 0x00, 0x00, 0x21,
+  0xf8, 0xdd, 0x00, 0x00, 0x00, 0x19, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x15, 0xd3, 0xa9, 0x00, 0x00, 0x29, 0xfe, 0xe4, 0x00, 0x00, 0x00, 0x2c, 0x19,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x18, 0xe8, 0xc3, 0x00,
+  0x00, 0x21, 0xf8, 0xdd, 0x00, 0x00, 0x00, 0x19, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xd5, 0xaf, 0x00, 0x00, 0x25, 0xfd, 0xfc, 0x01, 0x00, 0x00,
+  0x8c, 0xc6, 0x00, 0x00, 0x28, 0xe9, 0x3d, 0x00, 0x00, 0x70, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x47, 0xa7, 0xda, 0x00, 0x00, 0x00, 0x00, 0x29, 0x88, 0xe4, 0xf6, 0xaa, 0x4b,
+  0x00, 0x0f, 0x6a, 0xc9, 0xfc, 0xbb, 0x60, 0x0e, 0x00, 0x00, 0x00, 0x5c, 0xff, 0xcd, 0x2b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x71, 0xd0, 0xf9, 0xb0, 0x56, 0x0a, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x30, 0x8e, 0xe8, 0xf2, 0xa3, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x4d,
+  0xab, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xd3, 0xc9,
+  0x00, 0x20, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x72, 0x00, 0x3c,
+  0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xd5, 0x76,
+  0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x79, 0xd3, 0xfc, 0xb7, 0x58, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2e, 0x8a, 0xe3, 0xef, 0x99, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0x6b, 0xf5, 0xef, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x76, 0xd1, 0xfa, 0xb0, 0x4f, 0x00, 0x0e,
+  0x66, 0xbf, 0xfd, 0xcd, 0x6e, 0x15, 0x00, 0x00, 0x00, 0x50, 0xe6, 0x8b, 0x2d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0d, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x54, 0x5c, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x86, 0xfa, 0xdc, 0xc6, 0xf9, 0xb1, 0x00, 0x00, 0x6b, 0xf7, 0x4d, 0x00, 0x00, 0x21, 0xf7,
+  0x43, 0x00, 0x03, 0x2a, 0x00, 0x00, 0x00, 0x18, 0xf7, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26,
+  0xd4, 0xd4, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xf1, 0xae, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xd3, 0xc0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x2c, 0xfb, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xea, 0xb3, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x6a, 0x72, 0x4f, 0x29, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0xa8, 0xfe, 0xcc, 0xa6, 0xc0, 0xfb, 0xab, 0x16, 0x00, 0x00, 0x00,
+  0x05, 0xc2, 0xe3, 0x3a, 0x00, 0x00, 0x00, 0x1e, 0xc7, 0xcc, 0x00, 0x00, 0x00, 0x6b, 0xfe, 0x35,
+  0x04, 0x88, 0xe4, 0xc7, 0x36, 0x4c, 0xfe, 0x04, 0x00, 0x00, 0xcc, 0xb4, 0x00, 0x8c, 0xef, 0x7b,
+  0xba, 0xf5, 0xee, 0xbf, 0x00, 0x00, 0x03, 0xfc, 0x70, 0x04, 0xf3, 0x6c, 0x00, 0x07, 0xe8, 0xb0,
+  0x0d, 0x00, 0x00, 0x0f, 0xff, 0x5c, 0x13, 0xff, 0x47, 0x00, 0x00, 0xc8, 0x93, 0x00, 0x00, 0x00,
+  0x02, 0xfc, 0x87, 0x03, 0xf1, 0x7f, 0x00, 0x13, 0xf1, 0x93, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xd3,
+  0x03, 0x7e, 0xfa, 0xa8, 0xd9, 0xfb, 0x93, 0x00, 0x00, 0x00, 0x00, 0x52, 0xff, 0x6c, 0x00, 0x64,
+  0xba, 0x91, 0x57, 0x4e, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x97, 0xfb, 0x77, 0x0a, 0x00, 0x00, 0x08,
+  0x6d, 0xef, 0x40, 0x00, 0x00, 0x00, 0x01, 0x7a, 0xf0, 0xf3, 0xce, 0xde, 0xfd, 0xfb, 0x8e, 0x09,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x49, 0x6e, 0x73, 0x57, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xf3,
+  0xe0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xdf, 0xff, 0x41, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0xec, 0x79, 0xd6, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xff,
+  0x2e, 0x89, 0xe6, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0xe0, 0x00, 0x3f, 0xff, 0x3b, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xe8, 0x94, 0x00, 0x04, 0xee, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff,
+  0x54, 0x0c, 0x0c, 0xac, 0xdf, 0x01, 0x00, 0x00, 0x00, 0x92, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x33, 0x00, 0x00, 0x02, 0xe4, 0xb0, 0x24, 0x24, 0x24, 0x2e, 0xfa, 0x86, 0x00, 0x00, 0x3a, 0xff,
+  0x5c, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xd8, 0x00, 0x00, 0x8e, 0xfc, 0x14, 0x00, 0x00, 0x00, 0x00,
+  0x6f, 0xff, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba,
+  0xf3, 0xf3, 0xef, 0xd6, 0x90, 0x16, 0x00, 0x00, 0xc3, 0xcc, 0x40, 0x41, 0x58, 0xcd, 0xc5, 0x00,
+  0x00, 0xc3, 0xbb, 0x00, 0x00, 0x00, 0x3d, 0xff, 0x1c, 0x00, 0xc3, 0xbb, 0x00, 0x00, 0x00, 0x52,
+  0xfe, 0x1a, 0x00, 0xc3, 0xda, 0x74, 0x75, 0x8c, 0xeb, 0x8e, 0x00, 0x00, 0xc3, 0xef, 0xc3, 0xc3,
+  0xd0, 0xe4, 0x7b, 0x04, 0x00, 0xc3, 0xbb, 0x00, 0x00, 0x00, 0x18, 0xd8, 0x82, 0x00, 0xc3, 0xbb,
+  0x00, 0x00, 0x00, 0x00, 0x7f, 0xd5, 0x00, 0xc3, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x92, 0xcc, 0x00,
+  0xc3, 0xca, 0x38, 0x38, 0x43, 0x79, 0xf8, 0x72, 0x00, 0xc3, 0xff, 0xff, 0xfe, 0xec, 0xc9, 0x64,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x20,
+  0x1e, 0x02, 0x00, 0x00, 0x00, 0x09, 0x91, 0xf3, 0xff, 0xff, 0xe7, 0x40, 0x00, 0x01, 0xbb, 0xf4,
+  0x61, 0x1d, 0x1f, 0x70, 0x52, 0x00, 0x55, 0xff, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7,
+  0xf2, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xe1, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0xf1, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xa9, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xff, 0x6c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc6, 0xfa, 0x9f, 0x26, 0x13, 0x65, 0x4e, 0x00, 0x00, 0x13,
+  0xa7, 0xfa, 0xff, 0xff, 0xee, 0x45, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x2c, 0x28, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xf3, 0xf3, 0xe2, 0xbc, 0x73, 0x03,
+  0x00, 0x00, 0xeb, 0xbd, 0x40, 0x4a, 0x8e, 0xfd, 0xaf, 0x00, 0x00, 0xeb, 0xa7, 0x00, 0x00, 0x00,
+  0x8b, 0xff, 0x30, 0x00, 0xeb, 0xa7, 0x00, 0x00, 0x00, 0x21, 0xff, 0x7a, 0x00, 0xeb, 0xa7, 0x00,
+  0x00, 0x00, 0x03, 0xfc, 0x95, 0x00, 0xeb, 0xa7, 0x00, 0x00, 0x00, 0x00, 0xed, 0xa8, 0x00, 0xeb,
+  0xa7, 0x00, 0x00, 0x00, 0x04, 0xfc, 0x8f, 0x00, 0xeb, 0xa7, 0x00, 0x00, 0x00, 0x23, 0xff, 0x6e,
+  0x00, 0xeb, 0xa7, 0x00, 0x00, 0x00, 0x8c, 0xf8, 0x1e, 0x00, 0xeb, 0xbb, 0x38, 0x4e, 0x99, 0xfe,
+  0x82, 0x00, 0x00, 0xeb, 0xff, 0xff, 0xea, 0xbe, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0x81, 0x00, 0x87, 0xff,
+  0x50, 0x48, 0x48, 0x48, 0x48, 0x26, 0x00, 0x87, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x87, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0x7e, 0x78, 0x78, 0x78, 0x69,
+  0x00, 0x00, 0x87, 0xff, 0xca, 0xc7, 0xc7, 0xc7, 0xae, 0x00, 0x00, 0x87, 0xff, 0x0c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0x0c,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0x49, 0x40, 0x40, 0x40, 0x40, 0x23, 0x00, 0x87,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x2a, 0xf6, 0xf7, 0xf7, 0xf7, 0xf7, 0xf7, 0x9e, 0x00, 0x2c, 0xff, 0x7f, 0x38, 0x38, 0x38,
+  0x38, 0x24, 0x00, 0x2c, 0xff, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xff, 0x5c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xff, 0x8f, 0x50, 0x50, 0x50, 0x10, 0x00, 0x00, 0x2c, 0xff,
+  0xeb, 0xdf, 0xdf, 0xdf, 0x2d, 0x00, 0x00, 0x2c, 0xff, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2c, 0xff, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xff, 0x5c, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x2c, 0xff, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xff, 0x5c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0x24, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xb2, 0xf5, 0xff, 0xfe, 0xbd, 0x19,
+  0x00, 0x00, 0x15, 0xe6, 0xd7, 0x43, 0x14, 0x2e, 0x9e, 0x37, 0x00, 0x00, 0x8e, 0xfa, 0x1b, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0xee, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+  0xff, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0xff, 0x78, 0x00, 0x00, 0x9a, 0x9f,
+  0x9f, 0x64, 0x00, 0x14, 0xff, 0x80, 0x00, 0x00, 0x93, 0x97, 0xf2, 0x9f, 0x00, 0x00, 0xf1, 0xa7,
+  0x00, 0x00, 0x00, 0x00, 0xdf, 0x9f, 0x00, 0x00, 0x99, 0xef, 0x10, 0x00, 0x00, 0x00, 0xdf, 0x9f,
+  0x00, 0x00, 0x1e, 0xf3, 0xc9, 0x32, 0x05, 0x29, 0xec, 0x9f, 0x00, 0x00, 0x00, 0x35, 0xcc, 0xff,
+  0xfe, 0xff, 0xc7, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x2f, 0x18, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x9f, 0x00, 0x00, 0x00, 0x08, 0xf3,
+  0x89, 0x00, 0xeb, 0xa7, 0x00, 0x00, 0x00, 0x08, 0xff, 0x8f, 0x00, 0xeb, 0xa7, 0x00, 0x00, 0x00,
+  0x08, 0xff, 0x8f, 0x00, 0xeb, 0xa7, 0x00, 0x00, 0x00, 0x08, 0xff, 0x8f, 0x00, 0xeb, 0xd0, 0x78,
+  0x78, 0x78, 0x7c, 0xff, 0x8f, 0x00, 0xeb, 0xec, 0xc7, 0xc7, 0xc7, 0xc9, 0xff, 0x8f, 0x00, 0xeb,
+  0xa7, 0x00, 0x00, 0x00, 0x08, 0xff, 0x8f, 0x00, 0xeb, 0xa7, 0x00, 0x00, 0x00, 0x08, 0xff, 0x8f,
+  0x00, 0xeb, 0xa7, 0x00, 0x00, 0x00, 0x08, 0xff, 0x8f, 0x00, 0xeb, 0xa7, 0x00, 0x00, 0x00, 0x08,
+  0xff, 0x8f, 0x00, 0xeb, 0xa7, 0x00, 0x00, 0x00, 0x08, 0xff, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0x0b, 0x00, 0x1f, 0x48,
+  0x48, 0xfc, 0xb5, 0x48, 0x48, 0x03, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x97, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xfb, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x97, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x97,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xfb, 0x97, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x40, 0x40, 0xfc, 0xb1, 0x40, 0x40, 0x03, 0x00, 0x70,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x17, 0xf3, 0xf3, 0xf3, 0xf3, 0x72, 0x00, 0x00, 0x00, 0x07, 0x48, 0x48, 0x5c,
+  0xff, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xff, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1c, 0xff, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xff, 0x78, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1c, 0xff, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xff, 0x78, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xff,
+  0x60, 0x00, 0x01, 0x10, 0x10, 0x10, 0x1e, 0xa9, 0xfc, 0x23, 0x00, 0x0c, 0xff, 0xff, 0xff, 0xff,
+  0xf3, 0x6b, 0x00, 0x00, 0x02, 0x24, 0x24, 0x24, 0x1d, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x9f, 0x00, 0x00, 0x00, 0x13, 0xc9, 0xd0, 0x18, 0x00,
+  0xeb, 0xa7, 0x00, 0x00, 0x15, 0xd1, 0xd9, 0x1b, 0x00, 0x00, 0xeb, 0xa7, 0x00, 0x15, 0xd2, 0xd7,
+  0x19, 0x00, 0x00, 0x00, 0xeb, 0xa7, 0x15, 0xd2, 0xd4, 0x17, 0x00, 0x00, 0x00, 0x00, 0xeb, 0xbd,
+  0xd3, 0xfb, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb, 0xff, 0xd3, 0xf8, 0x9a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xeb, 0xd7, 0x12, 0x74, 0xff, 0x54, 0x00, 0x00, 0x00, 0x00, 0xeb, 0xa7, 0x00, 0x02,
+  0xc1, 0xee, 0x1d, 0x00, 0x00, 0x00, 0xeb, 0xa7, 0x00, 0x00, 0x21, 0xf1, 0xc1, 0x03, 0x00, 0x00,
+  0xeb, 0xa7, 0x00, 0x00, 0x00, 0x61, 0xff, 0x7c, 0x00, 0x00, 0xeb, 0xa7, 0x00, 0x00, 0x00, 0x00,
+  0xb0, 0xfb, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xf3,
+  0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x50, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x50, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xff, 0x44, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x50, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xff, 0x44,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
+  0xff, 0x73, 0x40, 0x40, 0x40, 0x40, 0x39, 0x00, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0xf3, 0xd6, 0x02, 0x00, 0x00,
+  0x3c, 0xf3, 0xf3, 0x0f, 0x00, 0x68, 0xfb, 0xf2, 0x46, 0x00, 0x00, 0xa1, 0xed, 0xff, 0x10, 0x00,
+  0x68, 0xf7, 0x9a, 0xaa, 0x00, 0x11, 0xf6, 0x90, 0xff, 0x10, 0x00, 0x68, 0xf7, 0x37, 0xf9, 0x15,
+  0x6d, 0xda, 0x51, 0xff, 0x10, 0x00, 0x68, 0xf7, 0x00, 0xd3, 0x73, 0xd2, 0x78, 0x50, 0xff, 0x10,
+  0x00, 0x68, 0xf7, 0x00, 0x6f, 0xed, 0xfb, 0x19, 0x50, 0xff, 0x10, 0x00, 0x68, 0xf7, 0x00, 0x12,
+  0xf8, 0xb0, 0x00, 0x50, 0xff, 0x10, 0x00, 0x68, 0xf7, 0x00, 0x00, 0x27, 0x16, 0x00, 0x50, 0xff,
+  0x10, 0x00, 0x68, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xff, 0x10, 0x00, 0x68, 0xf7, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x50, 0xff, 0x10, 0x00, 0x68, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
+  0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xf3,
+  0x4a, 0x00, 0x00, 0x00, 0xeb, 0x85, 0x00, 0xe7, 0xff, 0xbc, 0x00, 0x00, 0x00, 0xf7, 0x8b, 0x00,
+  0xe7, 0xcf, 0xfe, 0x2e, 0x00, 0x00, 0xf7, 0x8b, 0x00, 0xe7, 0x9b, 0xc2, 0x9e, 0x00, 0x00, 0xf7,
+  0x8b, 0x00, 0xe7, 0x9b, 0x52, 0xf8, 0x17, 0x00, 0xf7, 0x8b, 0x00, 0xe7, 0x9b, 0x03, 0xdd, 0x7f,
+  0x00, 0xf7, 0x8b, 0x00, 0xe7, 0x9b, 0x00, 0x6f, 0xe8, 0x07, 0xf7, 0x8b, 0x00, 0xe7, 0x9b, 0x00,
+  0x0d, 0xf0, 0x60, 0xf7, 0x8b, 0x00, 0xe7, 0x9b, 0x00, 0x00, 0x8d, 0xd1, 0xf8, 0x8b, 0x00, 0xe7,
+  0x9b, 0x00, 0x00, 0x20, 0xfc, 0xff, 0x8b, 0x00, 0xe7, 0x9b, 0x00, 0x00, 0x00, 0xac, 0xff, 0x8b,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x07,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xcf, 0xfb, 0xfc, 0xb7, 0x1f, 0x00, 0x00, 0x00, 0x2e,
+  0xf8, 0xb0, 0x33, 0x4c, 0xe8, 0xd0, 0x01, 0x00, 0x00, 0x9b, 0xf4, 0x0a, 0x00, 0x00, 0x5c, 0xff,
+  0x40, 0x00, 0x00, 0xe2, 0xb8, 0x00, 0x00, 0x00, 0x17, 0xff, 0x86, 0x00, 0x02, 0xfa, 0xa0, 0x00,
+  0x00, 0x00, 0x01, 0xfc, 0x9e, 0x00, 0x11, 0xff, 0x93, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xb1, 0x00,
+  0x03, 0xfb, 0x9f, 0x00, 0x00, 0x00, 0x01, 0xfb, 0xa0, 0x00, 0x00, 0xe4, 0xb5, 0x00, 0x00, 0x00,
+  0x15, 0xff, 0x87, 0x00, 0x00, 0xa1, 0xf2, 0x07, 0x00, 0x00, 0x56, 0xff, 0x44, 0x00, 0x00, 0x35,
+  0xfb, 0xa6, 0x2a, 0x41, 0xe2, 0xd6, 0x01, 0x00, 0x00, 0x00, 0x49, 0xdc, 0xfe, 0xff, 0xc7, 0x27,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf3, 0xf3, 0xf2, 0xdc, 0xb0, 0x39, 0x00, 0x00, 0xa7,
+  0xf0, 0x40, 0x41, 0x5f, 0xd2, 0xfc, 0x3f, 0x00, 0xa7, 0xeb, 0x00, 0x00, 0x00, 0x1e, 0xff, 0x9e,
+  0x00, 0xa7, 0xeb, 0x00, 0x00, 0x00, 0x02, 0xf7, 0xac, 0x00, 0xa7, 0xeb, 0x00, 0x00, 0x00, 0x53,
+  0xff, 0x7d, 0x00, 0xa7, 0xf8, 0x9f, 0xa0, 0xbb, 0xfc, 0xd2, 0x0d, 0x00, 0xa7, 0xf7, 0x97, 0x96,
+  0x81, 0x56, 0x04, 0x00, 0x00, 0xa7, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xeb,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xa7, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d,
+  0xcf, 0xfb, 0xfc, 0xb7, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xf8, 0xb0, 0x33, 0x4c, 0xe8, 0xd0,
+  0x01, 0x00, 0x00, 0x00, 0x9b, 0xf4, 0x0a, 0x00, 0x00, 0x5c, 0xff, 0x40, 0x00, 0x00, 0x00, 0xe2,
+  0xb8, 0x00, 0x00, 0x00, 0x17, 0xff, 0x86, 0x00, 0x00, 0x02, 0xfa, 0xa0, 0x00, 0x00, 0x00, 0x01,
+  0xfc, 0x9e, 0x00, 0x00, 0x11, 0xff, 0x93, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xb1, 0x00, 0x00, 0x03,
+  0xfb, 0x9f, 0x00, 0x00, 0x00, 0x01, 0xfb, 0xa0, 0x00, 0x00, 0x00, 0xe4, 0xb6, 0x00, 0x00, 0x00,
+  0x15, 0xff, 0x87, 0x00, 0x00, 0x00, 0xa1, 0xf3, 0x08, 0x00, 0x00, 0x58, 0xff, 0x48, 0x00, 0x00,
+  0x00, 0x35, 0xfb, 0xa7, 0x2a, 0x41, 0xe3, 0xf7, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x49, 0xdb, 0xfe,
+  0xfe, 0xc7, 0xf3, 0xad, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x0f, 0x00, 0x4a, 0xfb, 0x79,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xf3, 0xf3, 0xf0, 0xd5, 0x93, 0x14, 0x00, 0x00,
+  0xdf, 0xc6, 0x40, 0x41, 0x67, 0xe9, 0xc3, 0x03, 0x00, 0xdf, 0xb3, 0x00, 0x00, 0x00, 0x5f, 0xff,
+  0x34, 0x00, 0xdf, 0xb3, 0x00, 0x00, 0x00, 0x42, 0xff, 0x49, 0x00, 0xdf, 0xb3, 0x00, 0x00, 0x0c,
+  0xad, 0xf2, 0x15, 0x00, 0xdf, 0xf4, 0xdb, 0xdf, 0xf7, 0xec, 0x4c, 0x00, 0x00, 0xdf, 0xd0, 0x61,
+  0x71, 0xfd, 0x6d, 0x00, 0x00, 0x00, 0xdf, 0xb3, 0x00, 0x00, 0xa7, 0xe5, 0x09, 0x00, 0x00, 0xdf,
+  0xb3, 0x00, 0x00, 0x29, 0xfc, 0x76, 0x00, 0x00, 0xdf, 0xb3, 0x00, 0x00, 0x00, 0xa5, 0xee, 0x10,
+  0x00, 0xdf, 0xb3, 0x00, 0x00, 0x00, 0x28, 0xfc, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x23, 0x21, 0x05, 0x00, 0x00, 0x00, 0x01, 0x80, 0xef, 0xff,
+  0xff, 0xf6, 0xab, 0x00, 0x00, 0x70, 0xfc, 0x6e, 0x1a, 0x15, 0x47, 0x9b, 0x00, 0x00, 0xca, 0xaf,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7a, 0xff, 0xc9, 0x71, 0x30, 0x01, 0x00, 0x00, 0x00, 0x01, 0x68, 0xcd, 0xfd, 0xff, 0xe1, 0x54,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x4e, 0xc3, 0xfd, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0xfb, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfa, 0x85, 0x00, 0xa2, 0x6c, 0x1f,
+  0x03, 0x1f, 0xa5, 0xfe, 0x3a, 0x00, 0x86, 0xf0, 0xff, 0xfe, 0xff, 0xe0, 0x5d, 0x00, 0x00, 0x00,
+  0x03, 0x22, 0x2f, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x98, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0x41, 0x00, 0x2d, 0x48, 0x48, 0x48,
+  0xf9, 0xb7, 0x48, 0x48, 0x48, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0x9b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xf7, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0x9b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xf7, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0x9b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xf7, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf3, 0x85, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xa3, 0x00, 0x10,
+  0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xab, 0x00, 0x10, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00,
+  0xe7, 0xab, 0x00, 0x10, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xab, 0x00, 0x10, 0xff, 0x8b,
+  0x00, 0x00, 0x00, 0x00, 0xe7, 0xab, 0x00, 0x10, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xab,
+  0x00, 0x10, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xab, 0x00, 0x08, 0xff, 0x8b, 0x00, 0x00,
+  0x00, 0x00, 0xe8, 0xa7, 0x00, 0x00, 0xf2, 0x95, 0x00, 0x00, 0x00, 0x01, 0xf2, 0x92, 0x00, 0x00,
+  0xaa, 0xec, 0x3f, 0x04, 0x0f, 0x81, 0xff, 0x4b, 0x00, 0x00, 0x16, 0xb5, 0xfe, 0xfe, 0xff, 0xf2,
+  0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2e, 0x2d, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xf3, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x79, 0xee,
+  0x0e, 0x00, 0x1a, 0xfe, 0x68, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xbb, 0x00, 0x00, 0x00, 0xc9, 0xb3,
+  0x00, 0x00, 0x00, 0x16, 0xfd, 0x6b, 0x00, 0x00, 0x00, 0x7a, 0xf6, 0x09, 0x00, 0x00, 0x5f, 0xfe,
+  0x1c, 0x00, 0x00, 0x00, 0x2b, 0xff, 0x4c, 0x00, 0x00, 0xaa, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xdb, 0x97, 0x00, 0x05, 0xef, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0xe2, 0x01, 0x3f, 0xff,
+  0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xff, 0x2e, 0x8b, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xe9, 0x79, 0xd7, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xdf, 0xff,
+  0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xff, 0xeb, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0x6b, 0x00, 0x22, 0xf3,
+  0xb9, 0x00, 0x00, 0xc6, 0x7f, 0x00, 0xbc, 0x94, 0x00, 0x4c, 0xfb, 0xe9, 0x00, 0x00, 0xf2, 0x5f,
+  0x00, 0x93, 0xb7, 0x00, 0x71, 0xb8, 0xfe, 0x12, 0x16, 0xff, 0x38, 0x00, 0x6b, 0xdb, 0x00, 0x97,
+  0x7f, 0xdf, 0x39, 0x39, 0xff, 0x10, 0x00, 0x44, 0xfa, 0x04, 0xbe, 0x57, 0xb5, 0x5f, 0x5c, 0xe6,
+  0x00, 0x00, 0x1d, 0xff, 0x23, 0xe4, 0x2f, 0x8b, 0x86, 0x7f, 0xbe, 0x00, 0x00, 0x01, 0xf3, 0x53,
+  0xfb, 0x08, 0x62, 0xad, 0xa2, 0x96, 0x00, 0x00, 0x00, 0xcd, 0x9d, 0xda, 0x00, 0x3a, 0xd5, 0xc5,
+  0x6e, 0x00, 0x00, 0x00, 0xa5, 0xe7, 0xb0, 0x00, 0x10, 0xf9, 0xeb, 0x46, 0x00, 0x00, 0x00, 0x7d,
+  0xff, 0x87, 0x00, 0x00, 0xe5, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x54, 0xff, 0x5d, 0x00, 0x00, 0xbc,
+  0xf5, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46,
+  0xf3, 0x5f, 0x00, 0x00, 0x00, 0x01, 0xb9, 0xd3, 0x0a, 0x00, 0x00, 0x98, 0xf1, 0x1f, 0x00, 0x00,
+  0x61, 0xfd, 0x40, 0x00, 0x00, 0x00, 0x0b, 0xd8, 0xbf, 0x02, 0x17, 0xed, 0x90, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x33, 0xf9, 0x74, 0xa7, 0xd9, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xfa,
+  0xfc, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xfe, 0xea, 0x0f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0xce, 0xc7, 0xe4, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xf7,
+  0x28, 0x56, 0xfd, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x33, 0xfa, 0x79, 0x00, 0x00, 0xb8, 0xd9, 0x09,
+  0x00, 0x00, 0x06, 0xd3, 0xce, 0x04, 0x00, 0x00, 0x24, 0xf7, 0x86, 0x00, 0x00, 0x85, 0xfa, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x81, 0xfa, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x65, 0xf3, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x9b, 0xe7, 0x18, 0x00, 0x03, 0xcb,
+  0xd1, 0x04, 0x00, 0x00, 0x36, 0xfd, 0x71, 0x00, 0x00, 0x00, 0x33, 0xfc, 0x6c, 0x00, 0x02, 0xc8,
+  0xce, 0x04, 0x00, 0x00, 0x00, 0x00, 0x93, 0xee, 0x14, 0x60, 0xfc, 0x35, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0f, 0xe6, 0xa5, 0xe8, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0xff, 0xe5,
+  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfb, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb,
+  0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x97, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0x94,
+  0x00, 0x00, 0x45, 0x48, 0x48, 0x48, 0x48, 0x9d, 0xff, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1c, 0xef, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xbb, 0xe1, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x6f, 0xfc, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xf6, 0x86, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xca, 0xcb, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0xf4, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xfb, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0xd9, 0xd5, 0x40, 0x40, 0x40, 0x40, 0x40, 0x31, 0x00, 0x24, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42,
+  0x60, 0x60, 0x60, 0x60, 0x13, 0x00, 0xaf, 0xf2, 0xc7, 0xc7, 0xc7, 0x28, 0x00, 0xaf, 0xc3, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xaf, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xc3, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xaf, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xaf, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xc3,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xc3, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xaf, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xf1, 0xc3, 0xc3, 0xc3, 0x28,
+  0x00, 0x47, 0x68, 0x68, 0x68, 0x68, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8e, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xf3, 0x14, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0xea, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76,
+  0xf2, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xea, 0x88, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x76, 0xf4, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xeb,
+  0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xf3, 0x14, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0d, 0xec, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xf2,
+  0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xed, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x7c, 0xf1, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xb3, 0x52,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x60, 0x60, 0x60, 0x60,
+  0x1b, 0x00, 0x76, 0xc7, 0xc7, 0xd0, 0xff, 0x48, 0x00, 0x00, 0x00, 0x00, 0x28, 0xff, 0x48, 0x00,
+  0x00, 0x00, 0x00, 0x28, 0xff, 0x48, 0x00, 0x00, 0x00, 0x00, 0x28, 0xff, 0x48, 0x00, 0x00, 0x00,
+  0x00, 0x28, 0xff, 0x48, 0x00, 0x00, 0x00, 0x00, 0x28, 0xff, 0x48, 0x00, 0x00, 0x00, 0x00, 0x28,
+  0xff, 0x48, 0x00, 0x00, 0x00, 0x00, 0x28, 0xff, 0x48, 0x00, 0x00, 0x00, 0x00, 0x28, 0xff, 0x48,
+  0x00, 0x00, 0x00, 0x00, 0x28, 0xff, 0x48, 0x00, 0x00, 0x00, 0x00, 0x28, 0xff, 0x48, 0x00, 0x00,
+  0x00, 0x00, 0x28, 0xff, 0x48, 0x00, 0x76, 0xc7, 0xc7, 0xd0, 0xff, 0x48, 0x00, 0x3b, 0x64, 0x64,
+  0x64, 0x64, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xf0,
+  0xc9, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xe3, 0xaf, 0xe9, 0x9c, 0x00, 0x00, 0x00, 0x00,
+  0x02, 0xb9, 0xde, 0x0e, 0x4b, 0xfe, 0x5d, 0x00, 0x00, 0x00, 0x7d, 0xfb, 0x3a, 0x00, 0x00, 0x94,
+  0xf4, 0x29, 0x00, 0x00, 0x39, 0x2e, 0x00, 0x00, 0x00, 0x09, 0x3c, 0x23, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb, 0xcb,
+  0xcb, 0x9f, 0x00, 0x0e, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x64, 0x4e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x08, 0x03, 0x00, 0x00,
+  0x00, 0x18, 0xea, 0xb7, 0x01, 0x00, 0x00, 0x00, 0x50, 0xff, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x9c,
+  0xf7, 0x2c, 0x00, 0x00, 0x00, 0x09, 0x34, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4e, 0x67, 0x69, 0x58, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x93, 0xb8, 0xb9, 0xd7, 0xfb, 0x72, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xfd, 0x1b, 0x00, 0x00, 0x00, 0x0b, 0x2b, 0x34, 0x5a,
+  0xff, 0x43, 0x00, 0x1b, 0xb5, 0xfb, 0xe9, 0xdf, 0xe4, 0xff, 0x4b, 0x00, 0xb3, 0xd8, 0x24, 0x00,
+  0x00, 0x30, 0xff, 0x4c, 0x00, 0xe5, 0x8a, 0x00, 0x00, 0x00, 0x67, 0xff, 0x4c, 0x00, 0xbd, 0xd3,
+  0x18, 0x00, 0x35, 0xe6, 0xff, 0x4c, 0x00, 0x29, 0xd5, 0xfd, 0xf1, 0xf3, 0x6a, 0xfe, 0x4a, 0x00,
+  0x00, 0x02, 0x21, 0x2a, 0x06, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x6c, 0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xef, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7f, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xef, 0x04,
+  0x49, 0x64, 0x36, 0x00, 0x00, 0x00, 0x7f, 0xf2, 0xbf, 0xdd, 0xc1, 0xf7, 0x90, 0x00, 0x00, 0x7f,
+  0xff, 0xa9, 0x02, 0x00, 0x2b, 0xf6, 0x39, 0x00, 0x7f, 0xff, 0x30, 0x00, 0x00, 0x00, 0xa8, 0x87,
+  0x00, 0x7f, 0xff, 0x0b, 0x00, 0x00, 0x00, 0x84, 0xa9, 0x00, 0x7f, 0xff, 0x10, 0x00, 0x00, 0x00,
+  0x88, 0xa4, 0x00, 0x7f, 0xff, 0x40, 0x00, 0x00, 0x00, 0xb7, 0x7a, 0x00, 0x7f, 0xff, 0xc8, 0x17,
+  0x00, 0x57, 0xf7, 0x20, 0x00, 0x7f, 0xdc, 0x7c, 0xf8, 0xf4, 0xf1, 0x57, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0x2a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0b, 0x4c, 0x66, 0x54, 0x10, 0x00, 0x00, 0x00, 0x51, 0xef, 0xe9, 0xbf, 0xd5, 0xf5,
+  0x0a, 0x00, 0x25, 0xf7, 0x9e, 0x06, 0x00, 0x00, 0x44, 0x07, 0x00, 0x83, 0xf9, 0x0e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xac, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xd9, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xfd, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
+  0xe8, 0xc5, 0x24, 0x00, 0x0e, 0x73, 0x0a, 0x00, 0x00, 0x2b, 0xc6, 0xff, 0xf3, 0xfc, 0xca, 0x07,
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x2d, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xd3, 0x1e, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4c, 0xff, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xff, 0x24,
+  0x00, 0x00, 0x00, 0x05, 0x40, 0x63, 0x2f, 0x4c, 0xff, 0x24, 0x00, 0x00, 0x10, 0xc2, 0xf2, 0xc0,
+  0xe8, 0xb6, 0xff, 0x24, 0x00, 0x00, 0x85, 0xf1, 0x22, 0x00, 0x0f, 0xda, 0xff, 0x24, 0x00, 0x00,
+  0xdd, 0xa3, 0x00, 0x00, 0x00, 0x74, 0xff, 0x24, 0x00, 0x04, 0xfb, 0x80, 0x00, 0x00, 0x00, 0x50,
+  0xff, 0x24, 0x00, 0x03, 0xfc, 0x84, 0x00, 0x00, 0x00, 0x54, 0xff, 0x24, 0x00, 0x00, 0xd1, 0xb1,
+  0x00, 0x00, 0x00, 0x83, 0xff, 0x24, 0x00, 0x00, 0x75, 0xfb, 0x49, 0x00, 0x2d, 0xec, 0xff, 0x24,
+  0x00, 0x00, 0x04, 0xa4, 0xfe, 0xf3, 0xe7, 0x6d, 0xff, 0x24, 0x00, 0x00, 0x00, 0x00, 0x17, 0x26,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x24, 0x5b, 0x56, 0x22, 0x00, 0x00, 0x00, 0x00, 0x02, 0x95, 0xfd, 0xcc, 0xc5, 0xf8,
+  0x7e, 0x00, 0x00, 0x00, 0x6a, 0xfb, 0x49, 0x00, 0x00, 0x41, 0xfd, 0x3b, 0x00, 0x00, 0xcf, 0xae,
+  0x00, 0x00, 0x00, 0x00, 0xd1, 0x8a, 0x00, 0x01, 0xf9, 0xed, 0xd7, 0xd7, 0xd7, 0xd7, 0xf5, 0xaa,
+  0x00, 0x00, 0xef, 0x9e, 0x34, 0x34, 0x34, 0x34, 0x34, 0x24, 0x00, 0x00, 0xc0, 0xbc, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xfe, 0x84, 0x0f, 0x00, 0x16, 0x66, 0x3f, 0x00, 0x00,
+  0x00, 0x4e, 0xdd, 0xfe, 0xf2, 0xfe, 0xdd, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x30, 0x1a,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x10, 0x63, 0x7e, 0x80, 0x50, 0x00, 0x00, 0x00, 0x07, 0xdd, 0xdc, 0xa6, 0xa3, 0x66, 0x00, 0x00,
+  0x00, 0x44, 0xff, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x70, 0x74, 0xaa, 0xff, 0x7c, 0x74, 0x51, 0x00, 0x00, 0xbd, 0xc3, 0xdb, 0xff, 0xc7, 0xc3,
+  0x89, 0x00, 0x00, 0x00, 0x00, 0x64, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xff,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x64, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x64, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x3c, 0x65, 0x4b, 0x06, 0x2d, 0x11, 0x00, 0x02, 0xa4, 0xfc, 0xcb, 0xda,
+  0xd3, 0xf5, 0x59, 0x00, 0x56, 0xff, 0x4f, 0x00, 0x02, 0xa8, 0xff, 0x58, 0x00, 0xa9, 0xd0, 0x00,
+  0x00, 0x00, 0x39, 0xff, 0x58, 0x00, 0xca, 0xa9, 0x00, 0x00, 0x00, 0x18, 0xff, 0x56, 0x00, 0xc2,
+  0xb2, 0x00, 0x00, 0x00, 0x24, 0xff, 0x55, 0x00, 0x92, 0xe7, 0x07, 0x00, 0x00, 0x58, 0xff, 0x54,
+  0x00, 0x2b, 0xf9, 0xa2, 0x27, 0x3f, 0xde, 0xff, 0x52, 0x00, 0x00, 0x51, 0xe0, 0xff, 0xf5, 0x8d,
+  0xf4, 0x50, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x02, 0x0d, 0xfb, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x57, 0xfe, 0x26, 0x00, 0x02, 0x44, 0x44, 0x49, 0x8f, 0xf4, 0xaf, 0x00, 0x00, 0x08, 0xf2,
+  0xf0, 0xed, 0xe2, 0x9e, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x66, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7c, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xf3, 0x06, 0x4e, 0x74,
+  0x4f, 0x02, 0x00, 0x00, 0x7c, 0xf6, 0xb7, 0xdc, 0xd3, 0xff, 0x95, 0x00, 0x00, 0x7c, 0xff, 0x89,
+  0x01, 0x00, 0x8d, 0xfb, 0x0d, 0x00, 0x7c, 0xff, 0x12, 0x00, 0x00, 0x46, 0xff, 0x2e, 0x00, 0x7c,
+  0xf5, 0x00, 0x00, 0x00, 0x3c, 0xff, 0x34, 0x00, 0x7c, 0xf3, 0x00, 0x00, 0x00, 0x3c, 0xff, 0x34,
+  0x00, 0x7c, 0xf3, 0x00, 0x00, 0x00, 0x3c, 0xff, 0x34, 0x00, 0x7c, 0xf3, 0x00, 0x00, 0x00, 0x3c,
+  0xff, 0x34, 0x00, 0x7c, 0xf3, 0x00, 0x00, 0x00, 0x3c, 0xff, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x68, 0x00, 0x00, 0x00, 0x00, 0x97, 0xff, 0x00,
+  0x00, 0x00, 0x00, 0x27, 0x45, 0x00, 0x00, 0x17, 0x38, 0x38, 0x38, 0x00, 0x00, 0x66, 0xfb, 0xfd,
+  0xff, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xfb, 0x00, 0x00, 0x00,
+  0x00, 0x6c, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x6d, 0xff, 0x02,
+  0x00, 0x00, 0x00, 0x6f, 0xff, 0x04, 0x00, 0x00, 0x00, 0x70, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0xcf,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x38, 0x00, 0x00, 0x00, 0x2b, 0x38, 0x38, 0x33, 0x00, 0x00,
+  0x00, 0xc0, 0xfb, 0xfd, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xeb, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x83, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83,
+  0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xeb, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x83, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xe8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xbb, 0xce, 0x00, 0x0c, 0x50, 0x50, 0x8f, 0xfb, 0x84, 0x00, 0x25, 0xef, 0xef, 0xe2,
+  0x9b, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x68, 0x1a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3c, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xff,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xff, 0x40, 0x00, 0x00, 0x05, 0x38, 0x24,
+  0x00, 0x00, 0x3c, 0xff, 0x40, 0x00, 0x0d, 0xb9, 0xd7, 0x1f, 0x00, 0x00, 0x3c, 0xff, 0x40, 0x16,
+  0xcc, 0xc6, 0x13, 0x00, 0x00, 0x00, 0x3c, 0xff, 0x62, 0xdb, 0xb7, 0x0a, 0x00, 0x00, 0x00, 0x00,
+  0x3c, 0xff, 0xfa, 0xf2, 0xc9, 0x07, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xff, 0x87, 0x2a, 0xf4, 0x98,
+  0x00, 0x00, 0x00, 0x00, 0x3c, 0xff, 0x40, 0x00, 0x5b, 0xff, 0x5e, 0x00, 0x00, 0x00, 0x3c, 0xff,
+  0x40, 0x00, 0x00, 0x97, 0xf5, 0x2e, 0x00, 0x00, 0x3c, 0xff, 0x40, 0x00, 0x00, 0x08, 0xcd, 0xdb,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xf7, 0xf7, 0xd3,
+  0x00, 0x33, 0x40, 0xb7, 0xd7, 0x00, 0x00, 0x00, 0x9c, 0xd5, 0x00, 0x00, 0x00, 0x9b, 0xd3, 0x00,
+  0x00, 0x00, 0x9b, 0xd3, 0x00, 0x00, 0x00, 0x9b, 0xd3, 0x00, 0x00, 0x00, 0x9b, 0xd3, 0x00, 0x00,
+  0x00, 0x9b, 0xd3, 0x00, 0x00, 0x00, 0x9b, 0xd3, 0x00, 0x00, 0x00, 0x9b, 0xd3, 0x00, 0x00, 0x00,
+  0x9b, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x2f, 0x1f, 0x5b, 0x25, 0x04, 0x46, 0x58,
+  0x0a, 0x00, 0x00, 0x5c, 0xed, 0xd0, 0xcf, 0xeb, 0xba, 0xc5, 0xec, 0xa7, 0x00, 0x00, 0x5c, 0xff,
+  0x1b, 0x03, 0xec, 0xa8, 0x00, 0x5e, 0xf2, 0x00, 0x00, 0x5c, 0xf9, 0x00, 0x00, 0xd2, 0x88, 0x00,
+  0x44, 0xff, 0x09, 0x00, 0x5c, 0xf3, 0x00, 0x00, 0xcf, 0x80, 0x00, 0x3c, 0xff, 0x13, 0x00, 0x5c,
+  0xf3, 0x00, 0x00, 0xcf, 0x80, 0x00, 0x3c, 0xff, 0x14, 0x00, 0x5c, 0xf3, 0x00, 0x00, 0xcf, 0x80,
+  0x00, 0x3c, 0xff, 0x14, 0x00, 0x5c, 0xf3, 0x00, 0x00, 0xcf, 0x80, 0x00, 0x3c, 0xff, 0x14, 0x00,
+  0x5c, 0xf3, 0x00, 0x00, 0xcf, 0x80, 0x00, 0x3c, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x2e, 0x00, 0x2e, 0x58, 0x10, 0x00, 0x00, 0x00, 0x7c,
+  0xe5, 0x8b, 0xdd, 0xd6, 0xf5, 0x6e, 0x00, 0x00, 0x7c, 0xff, 0x88, 0x00, 0x00, 0x93, 0xd5, 0x00,
+  0x00, 0x7c, 0xff, 0x12, 0x00, 0x00, 0x47, 0xff, 0x1a, 0x00, 0x7c, 0xf5, 0x00, 0x00, 0x00, 0x3c,
+  0xff, 0x34, 0x00, 0x7c, 0xf3, 0x00, 0x00, 0x00, 0x3c, 0xff, 0x34, 0x00, 0x7c, 0xf3, 0x00, 0x00,
+  0x00, 0x3c, 0xff, 0x34, 0x00, 0x7c, 0xf3, 0x00, 0x00, 0x00, 0x3c, 0xff, 0x34, 0x00, 0x7c, 0xf3,
+  0x00, 0x00, 0x00, 0x3c, 0xff, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x2e, 0x5c, 0x4d, 0x17, 0x00, 0x00, 0x00, 0x04, 0xa4, 0xfb, 0xca, 0xdf, 0xf2, 0x56,
+  0x00, 0x00, 0x64, 0xff, 0x48, 0x00, 0x02, 0xa3, 0xf1, 0x14, 0x00, 0xbd, 0xc8, 0x00, 0x00, 0x00,
+  0x28, 0xff, 0x5f, 0x00, 0xde, 0xa2, 0x00, 0x00, 0x00, 0x03, 0xfb, 0x81, 0x00, 0xd8, 0xa7, 0x00,
+  0x00, 0x00, 0x07, 0xfe, 0x7b, 0x00, 0xb4, 0xd9, 0x01, 0x00, 0x00, 0x3a, 0xff, 0x55, 0x00, 0x4a,
+  0xff, 0x7d, 0x07, 0x1a, 0xc7, 0xe2, 0x08, 0x00, 0x00, 0x6f, 0xf4, 0xf9, 0xfe, 0xd6, 0x32, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x25, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1d, 0x2d, 0x05, 0x3f, 0x5b, 0x25, 0x00, 0x00, 0x00, 0x83, 0xe5, 0xb4, 0xe8,
+  0xda, 0xfd, 0x74, 0x00, 0x00, 0x83, 0xff, 0xc2, 0x09, 0x02, 0x65, 0xfc, 0x26, 0x00, 0x83, 0xff,
+  0x50, 0x00, 0x00, 0x03, 0xf2, 0x7b, 0x00, 0x83, 0xff, 0x2b, 0x00, 0x00, 0x00, 0xbe, 0x9b, 0x00,
+  0x83, 0xff, 0x30, 0x00, 0x00, 0x00, 0xc9, 0x93, 0x00, 0x83, 0xff, 0x61, 0x00, 0x00, 0x08, 0xf9,
+  0x6d, 0x00, 0x83, 0xff, 0xdc, 0x26, 0x16, 0x97, 0xf2, 0x13, 0x00, 0x83, 0xeb, 0x84, 0xfb, 0xfa,
+  0xea, 0x45, 0x00, 0x00, 0x83, 0xeb, 0x00, 0x0b, 0x24, 0x02, 0x00, 0x00, 0x00, 0x83, 0xeb, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d,
+  0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x33, 0x5a, 0x2a, 0x04, 0x30, 0x0b, 0x00, 0x04, 0xa4, 0xf6, 0xce, 0xf5, 0x96,
+  0xff, 0x3c, 0x00, 0x5f, 0xf1, 0x27, 0x00, 0x22, 0xec, 0xff, 0x3c, 0x00, 0xbc, 0x9a, 0x00, 0x00,
+  0x00, 0x91, 0xff, 0x3c, 0x00, 0xdd, 0x76, 0x00, 0x00, 0x00, 0x6b, 0xff, 0x3c, 0x00, 0xe2, 0x79,
+  0x00, 0x00, 0x00, 0x6f, 0xff, 0x3c, 0x00, 0xba, 0xa8, 0x00, 0x00, 0x00, 0x9e, 0xff, 0x3c, 0x00,
+  0x5e, 0xf9, 0x47, 0x00, 0x41, 0xf5, 0xff, 0x3c, 0x00, 0x01, 0x98, 0xfe, 0xf3, 0xf5, 0x7f, 0xff,
+  0x3c, 0x00, 0x00, 0x00, 0x1c, 0x30, 0x07, 0x34, 0xff, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x34, 0xff, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xff, 0x3c, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x31, 0xef, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37,
+  0x18, 0x15, 0x57, 0x62, 0x32, 0x00, 0x00, 0xfb, 0xaf, 0xf2, 0xe0, 0xe1, 0xfe, 0x59, 0x00, 0xfb,
+  0xf6, 0x4e, 0x00, 0x00, 0x1d, 0x2f, 0x00, 0xfb, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb,
+  0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb,
+  0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb,
+  0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x32, 0x5e, 0x5f, 0x3c, 0x05, 0x00, 0x00, 0x02, 0xa6, 0xfc, 0xd2, 0xc3, 0xed, 0x96, 0x00,
+  0x00, 0x31, 0xff, 0x60, 0x00, 0x00, 0x06, 0x27, 0x00, 0x00, 0x37, 0xff, 0x66, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x9d, 0xfe, 0xe9, 0xb3, 0x58, 0x03, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x5f,
+  0xa2, 0xf9, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xf4, 0x02, 0x00, 0x38, 0x62,
+  0x13, 0x00, 0x14, 0xbf, 0xd0, 0x00, 0x00, 0x41, 0xe6, 0xff, 0xf0, 0xfd, 0xcc, 0x2b, 0x00, 0x00,
+  0x00, 0x00, 0x19, 0x2d, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xb7, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x8f, 0x38, 0x38, 0x32, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xe3, 0x00, 0x00, 0xff, 0x72,
+  0x04, 0x04, 0x04, 0x00, 0x00, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x70, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0x77, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xcc, 0xd0, 0x44, 0x34, 0x34, 0x1f, 0x00, 0x38, 0xcf, 0xfa, 0xff, 0xff, 0x97, 0x00, 0x00,
+  0x00, 0x02, 0x08, 0x08, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x26, 0x00,
+  0x00, 0x00, 0x07, 0x34, 0x0f, 0x00, 0xaf, 0xbb, 0x00, 0x00, 0x00, 0x25, 0xff, 0x4d, 0x00, 0xaf,
+  0xbb, 0x00, 0x00, 0x00, 0x27, 0xff, 0x4e, 0x00, 0xaf, 0xbb, 0x00, 0x00, 0x00, 0x29, 0xff, 0x50,
+  0x00, 0xaf, 0xbb, 0x00, 0x00, 0x00, 0x2c, 0xff, 0x50, 0x00, 0xaf, 0xbc, 0x00, 0x00, 0x00, 0x2f,
+  0xff, 0x50, 0x00, 0x81, 0xe9, 0x02, 0x00, 0x00, 0x4f, 0xff, 0x50, 0x00, 0x38, 0xff, 0x75, 0x0f,
+  0x2d, 0xd4, 0xff, 0x50, 0x00, 0x03, 0x8d, 0xea, 0xfd, 0xfe, 0x90, 0xff, 0x50, 0x00, 0x00, 0x00,
+  0x06, 0x2f, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x38, 0x11, 0x00, 0x00, 0x00, 0x00, 0x26, 0x2d, 0x00, 0x06, 0xec, 0x88, 0x00, 0x00, 0x00,
+  0x03, 0xe4, 0x92, 0x00, 0x00, 0x92, 0xe3, 0x03, 0x00, 0x00, 0x47, 0xff, 0x31, 0x00, 0x00, 0x31,
+  0xff, 0x46, 0x00, 0x00, 0xa5, 0xd0, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xa4, 0x00, 0x0e, 0xf5, 0x70,
+  0x00, 0x00, 0x00, 0x00, 0x6f, 0xf5, 0x0d, 0x63, 0xfa, 0x16, 0x00, 0x00, 0x00, 0x00, 0x14, 0xf9,
+  0x60, 0xc0, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0xd5, 0xfe, 0x50, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4c, 0xff, 0xea, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x36, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x21, 0x00, 0xd1,
+  0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xf0, 0x72, 0x00, 0x91, 0xd1, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x27, 0xff, 0x32, 0x00, 0x51, 0xfc, 0x0e, 0x1b, 0xdf, 0xa3, 0x00, 0x5b, 0xef, 0x03, 0x00,
+  0x13, 0xfd, 0x44, 0x61, 0xea, 0xf8, 0x0e, 0x90, 0xb3, 0x00, 0x00, 0x00, 0xd2, 0x7d, 0xa7, 0x81,
+  0xdd, 0x58, 0xc5, 0x74, 0x00, 0x00, 0x00, 0x92, 0xba, 0xeb, 0x33, 0x8f, 0xad, 0xf6, 0x35, 0x00,
+  0x00, 0x00, 0x53, 0xfd, 0xe2, 0x01, 0x41, 0xfd, 0xf0, 0x03, 0x00, 0x00, 0x00, 0x15, 0xfe, 0x94,
+  0x00, 0x04, 0xee, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x37, 0x21, 0x00, 0x00, 0x00, 0x00, 0x35, 0x24, 0x00, 0x00, 0x00, 0x87, 0xed,
+  0x21, 0x00, 0x00, 0x71, 0xf6, 0x33, 0x00, 0x00, 0x00, 0x03, 0xb8, 0xcd, 0x09, 0x3c, 0xfa, 0x5e,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xdb, 0xaa, 0xe5, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x34, 0xff, 0xd0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xee, 0xfa, 0x41,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xf9, 0x39, 0x8f, 0xea, 0x1e, 0x00, 0x00, 0x00, 0x00,
+  0x3b, 0xf9, 0x6c, 0x00, 0x05, 0xc3, 0xcc, 0x09, 0x00, 0x00, 0x1a, 0xe7, 0xa3, 0x00, 0x00, 0x00,
+  0x1a, 0xe8, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x34, 0x21, 0x00, 0x00, 0x00, 0x06, 0x38, 0x14, 0x00, 0xe4, 0x8b, 0x00, 0x00, 0x00, 0x18, 0xff,
+  0x58, 0x00, 0xe7, 0x8b, 0x00, 0x00, 0x00, 0x14, 0xff, 0x59, 0x00, 0xe7, 0x8b, 0x00, 0x00, 0x00,
+  0x14, 0xff, 0x5c, 0x00, 0xe7, 0x8b, 0x00, 0x00, 0x00, 0x14, 0xff, 0x5c, 0x00, 0xe7, 0x8d, 0x00,
+  0x00, 0x00, 0x14, 0xff, 0x5f, 0x00, 0xce, 0xa7, 0x00, 0x00, 0x00, 0x14, 0xff, 0x60, 0x00, 0x6a,
+  0xf4, 0x6e, 0x49, 0x48, 0x56, 0xff, 0x60, 0x00, 0x09, 0x6f, 0xce, 0xfb, 0xfb, 0xfb, 0xff, 0x61,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+  0xff, 0x27, 0x00, 0x0a, 0x48, 0x4a, 0x4c, 0x54, 0xca, 0xd8, 0x00, 0x00, 0x25, 0xf7, 0xf7, 0xf7,
+  0xf7, 0xab, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x3c,
+  0x3c, 0x3c, 0x3c, 0x3c, 0x3c, 0x07, 0x00, 0x2e, 0xd3, 0xd3, 0xd3, 0xd3, 0xe7, 0xff, 0x20, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x16, 0xde, 0xae, 0x02, 0x00, 0x00, 0x00, 0x00, 0x08, 0xc6, 0xcd, 0x0b,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xa7, 0xe4, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xf4, 0x32,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xfb, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xf8, 0x8a,
+  0x1c, 0x1c, 0x1c, 0x1c, 0x03, 0x00, 0x6c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x48, 0x81, 0x94, 0x07,
+  0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0xd4, 0xb9, 0x09, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xda, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb,
+  0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x19, 0x30,
+  0x5f, 0xfb, 0x76, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xff, 0xbc, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x1d, 0x39, 0x6d, 0xfd, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xb3, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xc0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0xff, 0xc6, 0xa9, 0x08, 0x00, 0x00, 0x00, 0x00, 0x03, 0x57, 0x8f, 0xa1, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x00, 0xe7, 0x70, 0x00, 0xe7, 0x70,
+  0x00, 0xe7, 0x70, 0x00, 0xe7, 0x70, 0x00, 0xe7, 0x70, 0x00, 0xe7, 0x70, 0x00, 0xe7, 0x70, 0x00,
+  0xe7, 0x70, 0x00, 0xe7, 0x70, 0x00, 0xe7, 0x70, 0x00, 0xe7, 0x70, 0x00, 0xe7, 0x70, 0x00, 0xe7,
+  0x70, 0x00, 0x28, 0x13, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x8e, 0x75, 0x22, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4a, 0xbc, 0xe8, 0xed, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xff, 0x42, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xff, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff,
+  0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xce, 0xdf, 0x52, 0x2e, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xec, 0xff, 0xff, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0xcb, 0xe5, 0x64, 0x3a, 0x0d, 0x00, 0x00, 0x00, 0x0e, 0xff, 0x6b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0x57,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xff, 0x43, 0x00, 0x00, 0x00, 0x00, 0x44, 0xae, 0xe2,
+  0xf0, 0x12, 0x00, 0x00, 0x00, 0x00, 0x42, 0x9b, 0x84, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x3d, 0x45, 0x03, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x9e, 0xed, 0xea, 0xb2, 0x04, 0x00, 0x40, 0x9c, 0x00, 0x25, 0xff, 0x27, 0x10,
+  0xd4, 0x9a, 0x04, 0x9c, 0xbb, 0x00, 0x26, 0x8b, 0x00, 0x00, 0x22, 0xe3, 0xf6, 0xef, 0x2f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x32, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+};
+
+static const app::AtlasGlyph proggy_atlas_20_glyphs[] = {
+  {11, 0, 0, 0, 0, 0}, // ' '
+  {11, 4, -15, 5, 17, 0}, // '!'
+  {11, 3, -14, 7, 7, 85}, // '"'
+  {11, 0, -14, 13, 15, 134}, // '#'
+  {11, 1, -15, 11, 17, 329}, // '$'
+  {11, 0, -14, 13, 15, 516}, // '%'
+  {11, 0, -15, 13, 17, 711}, // '&'
+  {11, 5, -14, 3, 7, 932}, // "'"
+  {11, 3, -16, 6, 19, 953}, // '('
+  {11, 4, -16, 6, 19, 1067}, // ')'
+  {11, 0, -12, 13, 12, 1181}, // '*'
+  {11, 0, -12, 13, 12, 1337}, // '+'
+  {11, 4, -3, 5, 8, 1493}, // ','
+  {11, 1, -8, 11, 3, 1533}, // '-'
+  {11, 4, -3, 5, 5, 1566}, // '.'
+  {11, 1, -15, 11, 17, 1591}, // '/'
+  {11, 1, -14, 11, 16, 1778}, // '0'
+  {11, 2, -14, 9, 15, 1954}, // '1'
+  {11, 1, -14, 11, 15, 2089}, // '2'
+  {11, 1, -14, 11, 16, 2254}, // '3'
+  {11, 0, -14, 13, 15, 2430}, // '4'
+  {11, 1, -14, 11, 16, 2625}, // '5'
+  {11, 1, -14, 11, 16, 2801}, // '6'
+  {11, 1, -14, 11, 15, 2977}, // '7'
+  {11, 1, -14, 11, 16, 3142}, // '8'
+  {11, 1, -14, 11, 16, 3318}, // '9'
+  {11, 4, -12, 5, 11, 3494}, // ':'
+  {11, 4, -12, 5, 15, 3549}, // ';'
+  {11, 0, -12, 13, 11, 3624}, // '<'
+  {11, 0, -10, 13, 7, 3767}, // '='
+  {11, 0, -12, 13, 11, 3858}, // '>'
+  {11, 1, -15, 11, 17, 4001}, // '?'
+  {11, 0, -15, 16, 17, 4188}, // '@'
+  {11, 0, -14, 13, 15, 4460}, // 'A'
+  {11, 1, -14, 12, 15, 4655}, // 'B'
+  {11, 1, -14, 11, 16, 4835}, // 'C'
+  {11, 1, -14, 11, 15, 5011}, // 'D'
+  {11, 1, -14, 11, 15, 5176}, // 'E'
+  {11, 2, -14, 10, 15, 5341}, // 'F'
+  {11, 0, -14, 12, 16, 5491}, // 'G'
+  {11, 1, -14, 11, 15, 5683}, // 'H'
+  {11, 1, -14, 11, 15, 5848}, // 'I'
+  {11, 1, -14, 10, 16, 6013}, // 'J'
+  {11, 1, -14, 12, 15, 6173}, // 'K'
+  {11, 2, -14, 11, 15, 6353}, // 'L'
+  {11, 0, -14, 13, 15, 6518}, // 'M'
+  {11, 1, -14, 11, 15, 6713}, // 'N'
+  {11, 1, -14, 11, 16, 6878}, // 'O'
+  {11, 1, -14, 11, 15, 7054}, // 'P'
+  {11, 1, -14, 13, 17, 7219}, // 'Q'
+  {11, 1, -14, 11, 15, 7440}, // 'R'
+  {11, 1, -14, 11, 16, 7605}, // 'S'
+  {11, 0, -14, 13, 15, 7781}, // 'T'
+  {11, 1, -14, 11, 16, 7976}, // 'U'
+  {11, 0, -14, 13, 15, 8152}, // 'V'
+  {11, 0, -14, 13, 15, 8347}, // 'W'
+  {11, 0, -14, 13, 15, 8542}, // 'X'
+  {11, 0, -14, 13, 15, 8737}, // 'Y'
+  {11, 1, -14, 11, 15, 8932}, // 'Z'
+  {11, 2, -16, 9, 19, 9097}, // '['
+  {11, 1, -15, 11, 17, 9268}, // '\\'
+  {11, 3, -16, 8, 19, 9455}, // ']'
+  {11, 1, -14, 11, 7, 9607}, // '^'
+  {11, 0, 0, 15, 3, 9684}, // '_'
+  {11, 3, -16, 7, 7, 9729}, // '`'
+  {11, 1, -11, 11, 13, 9778}, // 'a'
+  {11, 1, -15, 11, 17, 9921}, // 'b'
+  {11, 1, -11, 11, 13, 10108}, // 'c'
+  {11, 1, -15, 11, 17, 10251}, // 'd'
+  {11, 1, -11, 11, 13, 10438}, // 'e'
+  {11, 1, -15, 11, 16, 10581}, // 'f'
+  {11, 1, -11, 11, 17, 10757}, // 'g'
+  {11, 1, -15, 11, 16, 10944}, // 'h'
+  {11, 3, -15, 6, 16, 11120}, // 'i'
+  {11, 2, -15, 8, 21, 11216}, // 'j'
+  {11, 2, -15, 11, 16, 11384}, // 'k'
+  {11, 2, -14, 7, 15, 11560}, // 'l'
+  {11, 0, -11, 13, 12, 11665}, // 'm'
+  {11, 1, -11, 11, 12, 11821}, // 'n'
+  {11, 1, -11, 11, 13, 11953}, // 'o'
+  {11, 1, -11, 11, 17, 12096}, // 'p'
+  {11, 1, -11, 11, 17, 12283}, // 'q'
+  {11, 2, -11, 10, 12, 12470}, // 'r'
+  {11, 2, -11, 10, 13, 12590}, // 's'
+  {11, 2, -14, 9, 16, 12720}, // 't'
+  {11, 1, -11, 11, 13, 12864}, // 'u'
+  {11, 0, -11, 13, 12, 13007}, // 'v'
+  {11, 0, -11, 14, 12, 13163}, // 'w'
+  {11, 0, -11, 13, 12, 13331}, // 'x'
+  {11, 1, -11, 11, 17, 13487}, // 'y'
+  {11, 1, -11, 11, 12, 13674}, // 'z'
+  {11, 1, -16, 11, 20, 13806}, // '{'
+  {11, 5, -16, 3, 19, 14026}, // '|'
+  {11, 1, -16, 11, 20, 14083}, // '}'
+  {11, 0, -10, 13, 7, 14303}, // '~'
+};
+
+static const uint8_t proggy_atlas_20_coverage[] = {
+  0x10, 0x74, 0x74, 0x08, 0x00, 0x23, 0xff, 0xff, 0x12, 0x00, 0x23, 0xff, 0xff, 0x12, 0x00, 0x1b,
+  0xff, 0xff, 0x0d, 0x00, 0x0e, 0xff, 0xfe, 0x03, 0x00, 0x02, 0xfe, 0xf5, 0x00, 0x00, 0x00, 0xf2,
+  0xeb, 0x00, 0x00, 0x00, 0xe4, 0xe1, 0x00, 0x00, 0x00, 0xd8, 0xd6, 0x00, 0x00, 0x00, 0xa9, 0xa7,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x96, 0x9c, 0x0f,
+  0x00, 0x52, 0xff, 0xff, 0x67, 0x00, 0x1c, 0xde, 0xe5, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xb0, 0x00, 0x00, 0xab, 0x81, 0x00, 0xb2, 0xff, 0x00, 0x00,
+  0xf7, 0xba, 0x00, 0xb2, 0xff, 0x00, 0x00, 0xf7, 0xba, 0x00, 0xb2, 0xff, 0x00, 0x00, 0xf7, 0xba,
+  0x00, 0xb2, 0xff, 0x00, 0x00, 0xf7, 0xba, 0x00, 0x45, 0x63, 0x00, 0x00, 0x60, 0x48, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8c, 0x58, 0x00, 0x02, 0x8f,
+  0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xff, 0x64, 0x00, 0x35, 0xff, 0x5b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x70, 0xff, 0x20, 0x00, 0x79, 0xfe, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xb4, 0xda, 0x00, 0x00, 0xbd, 0xd1, 0x00, 0x00, 0x00, 0x00, 0xae, 0xc8, 0xc8, 0xf8, 0xee,
+  0xc8, 0xc8, 0xfa, 0xec, 0xc8, 0xc7, 0x00, 0x00, 0x8e, 0xa3, 0xc0, 0xff, 0xca, 0xb7, 0xd0, 0xff,
+  0xb7, 0xa3, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x80, 0xfe, 0x17, 0x00, 0x83, 0xf9, 0x0c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc3, 0xd1, 0x00, 0x00, 0xc6, 0xc1, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4b,
+  0x4d, 0xf9, 0xa9, 0x32, 0x39, 0xfb, 0xab, 0x4b, 0x42, 0x00, 0x00, 0xfa, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x17, 0x18, 0x9e, 0xf6, 0x1d, 0x18, 0xa6, 0xf0,
+  0x1a, 0x18, 0x15, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xba, 0x00, 0x00, 0xde, 0xb1, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1a, 0xfe, 0x76, 0x00, 0x23, 0xff, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x52, 0xe6, 0x30, 0x00, 0x5a, 0xe6, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x51, 0xc2, 0xf9, 0xff, 0xd8, 0xa7, 0x62, 0x00, 0x00, 0x00, 0x7e, 0xff, 0xb9, 0xc7, 0xfe,
+  0x7e, 0xb9, 0xd8, 0x00, 0x00, 0x0e, 0xfd, 0xcc, 0x02, 0x9b, 0xfd, 0x00, 0x00, 0x13, 0x00, 0x00,
+  0x2b, 0xff, 0x94, 0x00, 0x9b, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xef, 0xe8, 0x2d, 0x9b,
+  0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xf7, 0xfe, 0xf4, 0xfe, 0x7a, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x21, 0x82, 0xde, 0xff, 0xfc, 0xfe, 0x99, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x9b, 0xfd, 0x06, 0x65, 0xfe, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0xfd, 0x00, 0x00, 0xdc,
+  0xb9, 0x00, 0x0b, 0x04, 0x00, 0x00, 0x9b, 0xfd, 0x00, 0x09, 0xf1, 0xa5, 0x00, 0x39, 0xdb, 0x76,
+  0x2d, 0xa3, 0xfd, 0x2f, 0xa7, 0xfa, 0x3b, 0x00, 0x19, 0xa6, 0xec, 0xff, 0xff, 0xff, 0xff, 0xda,
+  0x48, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1e, 0xab, 0xfd, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x35, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x49, 0x4b, 0x09, 0x00, 0x00, 0x00, 0x11, 0x5c, 0x3e, 0x00,
+  0x00, 0x18, 0xdb, 0xfd, 0xfd, 0xde, 0x1e, 0x00, 0x00, 0x95, 0xff, 0x45, 0x00, 0x00, 0x81, 0xe7,
+  0x1b, 0x17, 0xe0, 0x95, 0x00, 0x30, 0xfc, 0xad, 0x00, 0x00, 0x00, 0x8e, 0xd1, 0x01, 0x00, 0xc3,
+  0xa1, 0x01, 0xc3, 0xf6, 0x20, 0x00, 0x00, 0x00, 0x31, 0xf9, 0xbf, 0xbd, 0xfd, 0x41, 0x5d, 0xff,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x95, 0x9a, 0x3b, 0x0e, 0xe6, 0xdf, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xff, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x29, 0xfa, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xba, 0xfa, 0x29, 0x0b, 0x4a, 0x48, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xff, 0x8b, 0x1d,
+  0xe0, 0xfb, 0xfd, 0xd7, 0x16, 0x00, 0x00, 0x00, 0x09, 0xdf, 0xe6, 0x0e, 0x8f, 0xde, 0x14, 0x1f,
+  0xea, 0x88, 0x00, 0x00, 0x00, 0x7e, 0xff, 0x5e, 0x00, 0x9b, 0xc3, 0x00, 0x01, 0xd2, 0x91, 0x00,
+  0x00, 0x20, 0xf6, 0xc6, 0x01, 0x00, 0x3f, 0xfd, 0xb6, 0xc4, 0xf9, 0x32, 0x00, 0x00, 0x5f, 0xa5,
+  0x31, 0x00, 0x00, 0x00, 0x3b, 0x99, 0x97, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xc8, 0xfe, 0xfc, 0xb1, 0x1a, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0f, 0xec, 0xea, 0x73, 0x7e, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a,
+  0xff, 0x6e, 0x00, 0x00, 0xcd, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xff, 0x9c, 0x00,
+  0x1f, 0xfb, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xc5, 0xfe, 0x8c, 0xdd, 0xe2, 0x1f,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xee, 0xff, 0xd5, 0x1b, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0xa8, 0xfa, 0xed, 0xeb, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x92, 0xf7, 0x43, 0x40, 0xfb, 0xc7, 0x06, 0x00, 0x00, 0xd8, 0xac, 0x00, 0x11, 0xf5, 0x86, 0x00,
+  0x00, 0x79, 0xff, 0x96, 0x00, 0x00, 0xe2, 0xa3, 0x00, 0x62, 0xff, 0x52, 0x00, 0x00, 0x01, 0xac,
+  0xff, 0x5f, 0x0b, 0xfa, 0x79, 0x00, 0x59, 0xff, 0x71, 0x00, 0x00, 0x00, 0x0e, 0xd6, 0xf6, 0x99,
+  0xfd, 0x29, 0x00, 0x20, 0xfb, 0xdf, 0x0e, 0x00, 0x00, 0x00, 0x2a, 0xf4, 0xff, 0x90, 0x00, 0x00,
+  0x00, 0x77, 0xff, 0xd5, 0x5e, 0x2a, 0x41, 0x9a, 0xfc, 0xff, 0xb8, 0x03, 0x00, 0x00, 0x01, 0x5c,
+  0xe4, 0xff, 0xff, 0xff, 0xd7, 0x53, 0x7c, 0xff, 0x84, 0x00, 0x00, 0x00, 0x00, 0x01, 0x1d, 0x39,
+  0x14, 0x00, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x96, 0xb9, 0x00, 0xcd, 0xfd, 0x00, 0xcd, 0xfd, 0x00, 0xcd, 0xfd, 0x00,
+  0xcd, 0xfd, 0x00, 0x4b, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x19, 0x00, 0x00,
+  0x00, 0x39, 0xfd, 0x62, 0x00, 0x00, 0x02, 0xcc, 0xd7, 0x03, 0x00, 0x00, 0x52, 0xff, 0x67, 0x00,
+  0x00, 0x00, 0xc2, 0xf6, 0x0e, 0x00, 0x00, 0x1a, 0xfe, 0xba, 0x00, 0x00, 0x00, 0x5c, 0xff, 0x7f,
+  0x00, 0x00, 0x00, 0x90, 0xff, 0x52, 0x00, 0x00, 0x00, 0xa7, 0xff, 0x3c, 0x00, 0x00, 0x00, 0xb0,
+  0xff, 0x39, 0x00, 0x00, 0x00, 0x9b, 0xff, 0x5f, 0x00, 0x00, 0x00, 0x79, 0xff, 0x86, 0x00, 0x00,
+  0x00, 0x38, 0xff, 0xae, 0x00, 0x00, 0x00, 0x04, 0xe7, 0xe0, 0x03, 0x00, 0x00, 0x00, 0x7f, 0xff,
+  0x53, 0x00, 0x00, 0x00, 0x17, 0xf3, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x76, 0xff, 0x3f, 0x00, 0x00,
+  0x00, 0x06, 0x92, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x26, 0x00, 0x00, 0x00,
+  0x00, 0x91, 0xed, 0x14, 0x00, 0x00, 0x00, 0x16, 0xf4, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x97, 0xfc,
+  0x1f, 0x00, 0x00, 0x00, 0x37, 0xff, 0x89, 0x00, 0x00, 0x00, 0x01, 0xec, 0xe2, 0x00, 0x00, 0x00,
+  0x00, 0xb1, 0xff, 0x26, 0x00, 0x00, 0x00, 0x89, 0xff, 0x56, 0x00, 0x00, 0x00, 0x76, 0xff, 0x6c,
+  0x00, 0x00, 0x00, 0x6e, 0xff, 0x71, 0x00, 0x00, 0x00, 0x7d, 0xff, 0x5b, 0x00, 0x00, 0x00, 0xa0,
+  0xff, 0x36, 0x00, 0x00, 0x00, 0xd8, 0xf0, 0x04, 0x00, 0x00, 0x25, 0xff, 0xa5, 0x00, 0x00, 0x00,
+  0x85, 0xff, 0x39, 0x00, 0x00, 0x08, 0xe5, 0xc1, 0x00, 0x00, 0x00, 0x75, 0xfb, 0x2f, 0x00, 0x00,
+  0x00, 0x6f, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xd7, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0xe1,
+  0xd0, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0xaa, 0xbf, 0x35, 0x00, 0xe1, 0xd0, 0x00, 0x3d,
+  0xc5, 0xae, 0x00, 0x00, 0x03, 0x80, 0xf4, 0xfe, 0xa8, 0xec, 0xe2, 0xb1, 0xff, 0xf4, 0x81, 0x03,
+  0x00, 0x00, 0x00, 0x1a, 0x9c, 0xfc, 0xff, 0xff, 0xfb, 0x98, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0x87, 0xf7, 0xff, 0xff, 0xf4, 0x80, 0x0c, 0x00, 0x00, 0x00, 0x03, 0x6e, 0xeb, 0xff, 0xbd,
+  0xee, 0xe6, 0xc6, 0xff, 0xe7, 0x64, 0x02, 0x00, 0x00, 0xba, 0xcb, 0x46, 0x00, 0xe1, 0xd0, 0x01,
+  0x50, 0xd8, 0xba, 0x01, 0x00, 0x00, 0x0d, 0x01, 0x00, 0x00, 0xe1, 0xd0, 0x00, 0x00, 0x05, 0x12,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe1, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x37, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x86,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xcb, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x93, 0x93,
+  0x93, 0x93, 0xee, 0xe9, 0x93, 0x93, 0x93, 0x93, 0x1c, 0x00, 0x32, 0xfb, 0xfb, 0xfb, 0xfb, 0xfe,
+  0xfe, 0xfb, 0xfb, 0xfb, 0xfb, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xcb, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xd7, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x9f, 0xa2, 0x0f, 0x00, 0x55, 0xff, 0xff, 0x67, 0x00, 0x1f,
+  0xe3, 0xff, 0x5f, 0x00, 0x00, 0x76, 0xf7, 0x18, 0x00, 0x2f, 0xf2, 0x80, 0x00, 0x00, 0xc8, 0xa8,
+  0x03, 0x00, 0x00, 0x1b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x98, 0x98,
+  0x98, 0x98, 0x98, 0x98, 0x98, 0x98, 0x41, 0x00, 0x5f, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb, 0xfb,
+  0xfb, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x99,
+  0xa0, 0x0f, 0x00, 0x52, 0xff, 0xff, 0x69, 0x00, 0x1c, 0xde, 0xe5, 0x2a, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x7e,
+  0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x16, 0xf4, 0xce, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xff,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xf4, 0xcf, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x89, 0xff, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xf3, 0xd0,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xff, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x14, 0xf3, 0xd1, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0x54,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xf2, 0xd2, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x85, 0xff, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0xf2, 0xd3, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xff, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x12, 0xf1, 0xd4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xef, 0x56, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2a, 0xa1, 0xd9, 0xdb, 0xa3, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x34, 0xec,
+  0xfd, 0xcb, 0xc9, 0xfc, 0xf0, 0x3d, 0x00, 0x00, 0x00, 0xc4, 0xfd, 0x50, 0x00, 0x00, 0x4b, 0xfc,
+  0xe0, 0x06, 0x00, 0x2b, 0xff, 0xa6, 0x00, 0x00, 0x00, 0x34, 0xf7, 0xff, 0x48, 0x00, 0x70, 0xff,
+  0x5d, 0x00, 0x00, 0x17, 0xe2, 0xff, 0xff, 0x84, 0x00, 0x88, 0xff, 0x34, 0x00, 0x06, 0xc3, 0xff,
+  0x9e, 0xff, 0xa6, 0x00, 0xa0, 0xff, 0x21, 0x00, 0x97, 0xff, 0xb1, 0x0a, 0xff, 0xb5, 0x00, 0xa7,
+  0xff, 0x1e, 0x64, 0xff, 0xd7, 0x0e, 0x08, 0xff, 0xb9, 0x00, 0x90, 0xff, 0x66, 0xf8, 0xef, 0x27,
+  0x00, 0x15, 0xff, 0xad, 0x00, 0x77, 0xff, 0xfb, 0xfc, 0x48, 0x00, 0x00, 0x36, 0xff, 0x90, 0x00,
+  0x48, 0xff, 0xff, 0x73, 0x00, 0x00, 0x00, 0x78, 0xff, 0x60, 0x00, 0x02, 0xe0, 0xfb, 0x32, 0x00,
+  0x00, 0x1c, 0xe6, 0xf5, 0x14, 0x00, 0x00, 0x62, 0xfe, 0xea, 0x90, 0x85, 0xde, 0xff, 0x72, 0x00,
+  0x00, 0x00, 0x00, 0x61, 0xeb, 0xff, 0xff, 0xec, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x24, 0x26, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0xa5, 0xb0, 0x21, 0x00, 0x00, 0x00, 0x00, 0x50, 0xee, 0xff, 0xff,
+  0x30, 0x00, 0x00, 0x00, 0x53, 0xfe, 0xf2, 0xd3, 0xff, 0x30, 0x00, 0x00, 0x00, 0x69, 0xd8, 0x29,
+  0x9b, 0xff, 0x30, 0x00, 0x00, 0x00, 0x30, 0x0f, 0x00, 0x9b, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x9b, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0xff, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x9b, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0xff, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b,
+  0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0xff, 0x30, 0x00, 0x00, 0x00, 0x41, 0x99,
+  0x99, 0xd7, 0xff, 0xac, 0x99, 0x93, 0x00, 0x6c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x90, 0xd1, 0xea, 0xe1, 0xa3,
+  0x32, 0x00, 0x00, 0x00, 0x57, 0xfc, 0xfd, 0xd4, 0xa4, 0xc6, 0xff, 0xfb, 0x54, 0x00, 0x00, 0x64,
+  0x94, 0x1f, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xed, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xde, 0xff, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xff, 0x29, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xfe, 0xdf, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0xc4, 0xfe, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xa1, 0xff, 0x7e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x97, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92,
+  0xff, 0x96, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0xff, 0x8d, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x8e, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xff, 0xee,
+  0x9a, 0x99, 0x99, 0x99, 0x99, 0x99, 0x5a, 0x00, 0x83, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x7f,
+  0xb5, 0xe0, 0xf2, 0xe3, 0xaf, 0x4c, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xde, 0xb2, 0x9e, 0xb5, 0xf8,
+  0xff, 0x6f, 0x00, 0x00, 0x09, 0x24, 0x00, 0x00, 0x00, 0x00, 0x29, 0xf2, 0xfb, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xff, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xd2, 0xff, 0x32, 0x00, 0x00, 0x00, 0x00, 0x16, 0x1a, 0x37, 0xa4, 0xff, 0xaa, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0xf6, 0x68, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x70, 0x74,
+  0x93, 0xea, 0xf5, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xd3, 0xfe, 0x3f,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xff, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x62, 0xff, 0x99, 0x00, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xbf, 0xff,
+  0x67, 0x00, 0x88, 0xd5, 0x86, 0x5a, 0x55, 0x71, 0xcf, 0xff, 0xcf, 0x0a, 0x00, 0x5a, 0xdf, 0xff,
+  0xff, 0xff, 0xff, 0xfa, 0xa8, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x17, 0x36, 0x3f, 0x32, 0x0c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0xa0, 0xb0, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7c, 0xff, 0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xf8, 0xee, 0xb8,
+  0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc5, 0xff, 0x5d, 0x9d, 0xec, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xff, 0xb2, 0x00, 0x9d, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x20, 0xf3, 0xf0, 0x1b, 0x00, 0x9d, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0xff,
+  0x67, 0x00, 0x00, 0x9d, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xff, 0xc2, 0x01, 0x00, 0x00,
+  0x9d, 0xec, 0x00, 0x00, 0x00, 0x00, 0x13, 0xec, 0xf7, 0x28, 0x00, 0x00, 0x00, 0x9d, 0xec, 0x00,
+  0x00, 0x00, 0x00, 0x38, 0xff, 0xf0, 0xc8, 0xc8, 0xc8, 0xc8, 0xea, 0xfb, 0xc8, 0xc8, 0x32, 0x00,
+  0x29, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xf4, 0xfa, 0xbc, 0xbc, 0x2f, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xd4, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xd4, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xec,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xae, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0x72, 0x00, 0x00, 0x00, 0xfc, 0xf8, 0xd9,
+  0xd9, 0xd9, 0xd9, 0xd9, 0x8d, 0x00, 0x00, 0x00, 0xfc, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xfc, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xd3,
+  0x02, 0x0c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xf7, 0xf2, 0xff, 0xf5, 0xb7, 0x3e,
+  0x00, 0x00, 0x00, 0x00, 0xed, 0xaa, 0x86, 0x8a, 0xbd, 0xfe, 0xfd, 0x50, 0x00, 0x00, 0x00, 0x0a,
+  0x00, 0x00, 0x00, 0x00, 0x52, 0xfe, 0xe9, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb8, 0xff, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0xff, 0x67, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0x49, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0xf8, 0xf6, 0x16, 0x00, 0x96, 0xbe, 0x77, 0x54, 0x5f, 0x8e, 0xf4, 0xff, 0x6d, 0x00, 0x00,
+  0x77, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xe2, 0x68, 0x01, 0x00, 0x00, 0x00, 0x07, 0x28, 0x3d, 0x3b,
+  0x23, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x6b, 0xa3, 0xba, 0xa1, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x54, 0xec,
+  0xff, 0xd8, 0xc1, 0xe6, 0xaf, 0x00, 0x00, 0x00, 0x43, 0xff, 0xd7, 0x2d, 0x00, 0x00, 0x01, 0x25,
+  0x00, 0x00, 0x06, 0xd7, 0xf1, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0xff, 0x8c,
+  0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xff, 0x59, 0x92, 0xf1, 0xfe, 0xde, 0x8a,
+  0x09, 0x00, 0x00, 0x93, 0xff, 0xcf, 0xe1, 0x7e, 0x6e, 0xb4, 0xff, 0xc0, 0x01, 0x00, 0xac, 0xff,
+  0xec, 0x19, 0x00, 0x00, 0x00, 0xb7, 0xff, 0x56, 0x00, 0xa5, 0xff, 0x95, 0x00, 0x00, 0x00, 0x00,
+  0x56, 0xff, 0x94, 0x00, 0x8c, 0xff, 0x78, 0x00, 0x00, 0x00, 0x00, 0x39, 0xff, 0xb3, 0x00, 0x5c,
+  0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xff, 0x9b, 0x00, 0x12, 0xf5, 0xe0, 0x0c, 0x00, 0x00,
+  0x00, 0xa5, 0xff, 0x69, 0x00, 0x00, 0x7b, 0xff, 0xca, 0x59, 0x54, 0x9f, 0xff, 0xd8, 0x07, 0x00,
+  0x00, 0x01, 0x7b, 0xee, 0xff, 0xff, 0xfa, 0xaa, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x24,
+  0x24, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x70, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0x60, 0x00, 0x89, 0xd9, 0xd9, 0xd9,
+  0xd9, 0xd9, 0xd9, 0xf3, 0xff, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xe7, 0xee,
+  0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xc0, 0xfe, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xff, 0xc1,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xff, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x10, 0xf4, 0xea, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xff, 0x89,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xda, 0xfe, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x48, 0xff, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0xff, 0x55,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xfc, 0xe7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x87, 0xff, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x6a, 0xc2, 0xeb, 0xe5, 0xc1, 0x61, 0x04, 0x00,
+  0x00, 0x00, 0x99, 0xff, 0xdd, 0x8c, 0x8b, 0xd8, 0xff, 0xa1, 0x00, 0x00, 0x28, 0xff, 0xe1, 0x0c,
+  0x00, 0x00, 0x09, 0xdc, 0xff, 0x31, 0x00, 0x57, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x98, 0xff,
+  0x62, 0x00, 0x3b, 0xff, 0xb3, 0x00, 0x00, 0x00, 0x00, 0xab, 0xff, 0x4c, 0x00, 0x00, 0xb4, 0xfd,
+  0x63, 0x0a, 0x09, 0x5c, 0xfb, 0xda, 0x07, 0x00, 0x00, 0x0a, 0xa4, 0xff, 0xfe, 0xfe, 0xff, 0xad,
+  0x18, 0x00, 0x00, 0x00, 0x85, 0xfd, 0xda, 0x92, 0x91, 0xd7, 0xfe, 0xa5, 0x05, 0x00, 0x3f, 0xff,
+  0xc4, 0x06, 0x00, 0x00, 0x04, 0xb5, 0xff, 0x64, 0x00, 0x96, 0xff, 0x5c, 0x00, 0x00, 0x00, 0x00,
+  0x4d, 0xff, 0xaa, 0x00, 0xa8, 0xff, 0x52, 0x00, 0x00, 0x00, 0x00, 0x46, 0xff, 0xbb, 0x00, 0x7d,
+  0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xff, 0x97, 0x00, 0x1a, 0xe9, 0xfe, 0x96, 0x43, 0x40,
+  0x8e, 0xfb, 0xf4, 0x2a, 0x00, 0x00, 0x2f, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x32, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0x30, 0x30, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x6a, 0xc0, 0xe8, 0xe5, 0xae, 0x33, 0x00, 0x00,
+  0x00, 0x04, 0xb8, 0xff, 0xce, 0x89, 0x98, 0xef, 0xf9, 0x43, 0x00, 0x00, 0x5a, 0xff, 0xc2, 0x03,
+  0x00, 0x00, 0x2b, 0xfa, 0xdc, 0x04, 0x00, 0xa3, 0xff, 0x56, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xff,
+  0x3f, 0x00, 0xbe, 0xff, 0x37, 0x00, 0x00, 0x00, 0x00, 0x85, 0xff, 0x77, 0x00, 0xa6, 0xff, 0x45,
+  0x00, 0x00, 0x00, 0x00, 0x95, 0xff, 0x99, 0x00, 0x7a, 0xff, 0x89, 0x00, 0x00, 0x00, 0x06, 0xdd,
+  0xff, 0xa8, 0x00, 0x11, 0xeb, 0xf7, 0x6b, 0x21, 0x2d, 0xa8, 0xf1, 0xff, 0xa5, 0x00, 0x00, 0x39,
+  0xda, 0xff, 0xff, 0xff, 0xdd, 0x7b, 0xff, 0x91, 0x00, 0x00, 0x00, 0x07, 0x32, 0x55, 0x41, 0x04,
+  0x81, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xe3, 0xfb, 0x1a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x8a, 0xff, 0xa2, 0x00, 0x00, 0x00, 0x75, 0x6a, 0x53, 0x6c, 0xba,
+  0xff, 0xd3, 0x16, 0x00, 0x00, 0x00, 0x92, 0xf8, 0xff, 0xff, 0xe3, 0x9a, 0x0d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x17, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x2f, 0x00, 0x00, 0x25, 0xf9, 0xff, 0x54, 0x00,
+  0x34, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x4e, 0x61, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xc0, 0xd0, 0x26, 0x00, 0x48, 0xff,
+  0xff, 0x74, 0x00, 0x0a, 0xae, 0xbb, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x2f,
+  0x00, 0x00, 0x25, 0xf9, 0xff, 0x54, 0x00, 0x34, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x4e, 0x61, 0x04,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0xc2, 0xd5, 0x2a, 0x00, 0x42, 0xff, 0xff, 0x7f, 0x00, 0x09, 0xb8, 0xff, 0x6b, 0x00, 0x00,
+  0x7c, 0xf6, 0x18, 0x00, 0x3f, 0xf6, 0x72, 0x00, 0x00, 0xa9, 0x8c, 0x00, 0x00, 0x00, 0x06, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x3c, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x7d, 0xdb, 0xff,
+  0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x5e, 0xbe, 0xfd, 0xff, 0xca, 0x6f, 0x07, 0x00, 0x00,
+  0x01, 0x40, 0x9f, 0xf3, 0xff, 0xda, 0x7f, 0x25, 0x00, 0x00, 0x00, 0x00, 0x21, 0xde, 0xff, 0xe7,
+  0x91, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xff, 0xfc, 0x9d, 0x42, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x89, 0xe5, 0xff, 0xe5, 0x8e, 0x34, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x47, 0xa6, 0xf6, 0xff, 0xd9, 0x80, 0x28, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x64, 0xc3, 0xfe, 0xff, 0x1c, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x81, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8, 0xc8,
+  0xc8, 0xc8, 0x26, 0x00, 0x18, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x26,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x95, 0x95, 0x95, 0x95,
+  0x95, 0x95, 0x95, 0x95, 0x95, 0x95, 0x1d, 0x00, 0x1f, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+  0xfe, 0xfe, 0xfe, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
+  0xff, 0xcf, 0x70, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x76, 0xcf, 0xff,
+  0xfa, 0xb1, 0x52, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x85, 0xe0, 0xff,
+  0xec, 0x93, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3e, 0x98, 0xec, 0xff,
+  0xd3, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x3e, 0x9c, 0xfd, 0xff, 0x2b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2d, 0x88, 0xe2, 0xff, 0xea, 0x90, 0x32, 0x00, 0x00, 0x00, 0x20, 0x77,
+  0xd0, 0xff, 0xf9, 0xad, 0x4f, 0x05, 0x00, 0x00, 0x00, 0x00, 0x21, 0xfe, 0xff, 0xca, 0x6c, 0x13,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x89, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x46, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xd4,
+  0xff, 0xff, 0xfa, 0xc3, 0x59, 0x00, 0x00, 0x01, 0x91, 0xff, 0xc1, 0x5f, 0x31, 0x5a, 0xd0, 0xf1,
+  0x12, 0x00, 0x23, 0xdd, 0xaa, 0x03, 0x00, 0x00, 0x00, 0x2b, 0xff, 0x7f, 0x00, 0x00, 0x0a, 0x05,
+  0x00, 0x00, 0x00, 0x00, 0x62, 0xff, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xf6,
+  0xe1, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x92, 0xff, 0xca, 0x21, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7e, 0xff, 0xa4, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0xf6, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x96, 0x9c, 0x0f, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x52, 0xff, 0xff, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xde,
+  0xe5, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0x40, 0x57, 0x39, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+  0x8b, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xed, 0x6b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xd2,
+  0xff, 0xb3, 0x48, 0x14, 0x15, 0x4c, 0xad, 0xff, 0xc0, 0x09, 0x00, 0x00, 0x00, 0x02, 0xc0, 0xff,
+  0x70, 0x00, 0x00, 0x11, 0x22, 0x01, 0x00, 0x73, 0xff, 0x67, 0x00, 0x00, 0x00, 0x56, 0xff, 0xad,
+  0x00, 0x06, 0x99, 0xfc, 0xff, 0xd2, 0x2c, 0x1c, 0xff, 0x84, 0x00, 0x00, 0x00, 0xb7, 0xfe, 0x30,
+  0x00, 0x9c, 0xff, 0xb6, 0x9c, 0xf8, 0xef, 0xe4, 0xff, 0x42, 0x00, 0x00, 0x00, 0xf3, 0xd9, 0x00,
+  0x1e, 0xfd, 0xb0, 0x00, 0x00, 0x56, 0xff, 0xe4, 0x61, 0x00, 0x00, 0x00, 0x0d, 0xff, 0xb5, 0x00,
+  0x51, 0xff, 0x5f, 0x00, 0x00, 0x05, 0xfc, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x11, 0xff, 0xbd, 0x00,
+  0x56, 0xff, 0x60, 0x00, 0x00, 0x04, 0xfb, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfb, 0xee, 0x01,
+  0x2c, 0xff, 0xaa, 0x00, 0x00, 0x54, 0xff, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0xff, 0x3a,
+  0x00, 0xb6, 0xff, 0xaf, 0x8f, 0xf5, 0xff, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xca,
+  0x02, 0x10, 0xad, 0xfe, 0xff, 0xc1, 0xb3, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xbc, 0xff,
+  0x86, 0x01, 0x00, 0x18, 0x2d, 0x01, 0x00, 0x00, 0x56, 0x51, 0x00, 0x00, 0x00, 0x00, 0x14, 0xd1,
+  0xff, 0xbe, 0x47, 0x0c, 0x04, 0x25, 0x4c, 0xb4, 0xff, 0xe0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x0d,
+  0x97, 0xf7, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xab, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x13, 0x53, 0x82, 0x94, 0x88, 0x69, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x33, 0xb0, 0xb0, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0xff, 0xff,
+  0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe4, 0xd9, 0xd0, 0xec, 0x04, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xff, 0x8e, 0x83, 0xff, 0x45, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8b, 0xff, 0x43, 0x36, 0xff, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xdd, 0xf0, 0x05, 0x02, 0xe8, 0xe8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0xa8, 0x00,
+  0x00, 0x9f, 0xff, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xff, 0x5d, 0x00, 0x00, 0x53, 0xff,
+  0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0xfe, 0x24, 0x0f, 0x0f, 0x1c, 0xfa, 0xe2, 0x01, 0x00,
+  0x00, 0x00, 0x2d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x36, 0x00, 0x00, 0x00, 0x80,
+  0xff, 0xa3, 0x6d, 0x6d, 0x6d, 0x6d, 0xa1, 0xff, 0x88, 0x00, 0x00, 0x00, 0xd4, 0xff, 0x23, 0x00,
+  0x00, 0x00, 0x00, 0x1e, 0xfe, 0xda, 0x00, 0x00, 0x28, 0xff, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xce, 0xff, 0x2f, 0x00, 0x7c, 0xff, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff,
+  0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51,
+  0xb0, 0xb0, 0xb0, 0xae, 0x97, 0x71, 0x13, 0x00, 0x00, 0x00, 0x00, 0x75, 0xff, 0xe3, 0xcf, 0xcf,
+  0xde, 0xfc, 0xf4, 0x45, 0x00, 0x00, 0x00, 0x75, 0xff, 0x6b, 0x00, 0x00, 0x00, 0x21, 0xdd, 0xe9,
+  0x02, 0x00, 0x00, 0x75, 0xff, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x85, 0xff, 0x2a, 0x00, 0x00, 0x75,
+  0xff, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x98, 0xff, 0x28, 0x00, 0x00, 0x75, 0xff, 0x74, 0x11, 0x11,
+  0x20, 0x64, 0xf8, 0xc1, 0x00, 0x00, 0x00, 0x75, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0x13,
+  0x00, 0x00, 0x00, 0x75, 0xff, 0xae, 0x75, 0x75, 0x7b, 0x9b, 0xf0, 0xcb, 0x1c, 0x00, 0x00, 0x75,
+  0xff, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xeb, 0xb5, 0x00, 0x00, 0x75, 0xff, 0x6b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xa3, 0xfd, 0x08, 0x00, 0x75, 0xff, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0,
+  0xff, 0x12, 0x00, 0x75, 0xff, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x19, 0xe8, 0xde, 0x00, 0x00, 0x75,
+  0xff, 0xb8, 0x85, 0x85, 0x8b, 0xa5, 0xf1, 0xfd, 0x4c, 0x00, 0x00, 0x75, 0xff, 0xff, 0xff, 0xff,
+  0xf1, 0xd6, 0xa0, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xaf, 0xdc, 0xf0, 0xda, 0x9a, 0x26, 0x00, 0x00, 0x03,
+  0x97, 0xff, 0xed, 0xb4, 0x95, 0xb9, 0xfa, 0x7d, 0x00, 0x00, 0x70, 0xff, 0xcb, 0x18, 0x00, 0x00,
+  0x00, 0x20, 0x43, 0x00, 0x09, 0xf1, 0xfe, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49,
+  0xff, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xff, 0x93, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0xff, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x96, 0xff, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xff, 0x8c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xff, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1c, 0xf8, 0xf5, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0xff, 0x92,
+  0x01, 0x00, 0x00, 0x00, 0x01, 0x1c, 0x00, 0x00, 0x17, 0xde, 0xff, 0xb4, 0x63, 0x43, 0x6b, 0xcb,
+  0x7d, 0x00, 0x00, 0x00, 0x19, 0xa2, 0xf7, 0xff, 0xff, 0xff, 0xe5, 0x4d, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0a, 0x30, 0x3d, 0x27, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x73, 0xb0, 0xb0, 0xb0, 0x9f, 0x7a, 0x53, 0x06, 0x00, 0x00, 0x00, 0xa6, 0xff,
+  0xdf, 0xcf, 0xd9, 0xf8, 0xff, 0xcd, 0x29, 0x00, 0x00, 0xa6, 0xff, 0x52, 0x00, 0x00, 0x0e, 0x9b,
+  0xff, 0xd9, 0x02, 0x00, 0xa6, 0xff, 0x52, 0x00, 0x00, 0x00, 0x02, 0xda, 0xff, 0x4a, 0x00, 0xa6,
+  0xff, 0x52, 0x00, 0x00, 0x00, 0x00, 0x70, 0xff, 0x96, 0x00, 0xa6, 0xff, 0x52, 0x00, 0x00, 0x00,
+  0x00, 0x48, 0xff, 0xb0, 0x00, 0xa6, 0xff, 0x52, 0x00, 0x00, 0x00, 0x00, 0x31, 0xff, 0xca, 0x00,
+  0xa6, 0xff, 0x52, 0x00, 0x00, 0x00, 0x00, 0x2b, 0xff, 0xcf, 0x00, 0xa6, 0xff, 0x52, 0x00, 0x00,
+  0x00, 0x00, 0x44, 0xff, 0xaf, 0x00, 0xa6, 0xff, 0x52, 0x00, 0x00, 0x00, 0x00, 0x62, 0xff, 0x8e,
+  0x00, 0xa6, 0xff, 0x52, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x4d, 0x00, 0xa6, 0xff, 0x52, 0x00,
+  0x00, 0x00, 0x6b, 0xff, 0xc8, 0x01, 0x00, 0xa6, 0xff, 0xac, 0x85, 0x9c, 0xcf, 0xff, 0xda, 0x2f,
+  0x00, 0x00, 0xa6, 0xff, 0xff, 0xff, 0xea, 0xbe, 0x82, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+  0xb0, 0x75, 0x00, 0x2a, 0xff, 0xf8, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0x90, 0x00, 0x2a, 0xff,
+  0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2a, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a,
+  0xff, 0xd2, 0x16, 0x16, 0x16, 0x16, 0x16, 0x12, 0x00, 0x00, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xd7, 0x00, 0x00, 0x2a, 0xff, 0xe5, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x67, 0x00, 0x00,
+  0x2a, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xff, 0xce, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x2a, 0xff, 0xce, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xff, 0xea, 0x8f,
+  0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x62, 0x00, 0x2a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xb5, 0xb5,
+  0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0x91, 0x00, 0xb6, 0xff, 0xd1, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0x9e,
+  0x00, 0xb6, 0xff, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xff, 0x33, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xff, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6,
+  0xff, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xff, 0xe9, 0xe3, 0xe3, 0xe3, 0xe3,
+  0x01, 0x00, 0x00, 0xb6, 0xff, 0xac, 0x97, 0x97, 0x97, 0x97, 0x01, 0x00, 0x00, 0xb6, 0xff, 0x33,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xff, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xb6, 0xff, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xff, 0x33, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xff, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6,
+  0xff, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x72, 0xb1, 0xe3, 0xeb, 0xbc, 0x60, 0x04, 0x00, 0x00,
+  0x00, 0x1b, 0xc3, 0xff, 0xd9, 0xa3, 0x9b, 0xd5, 0xff, 0x46, 0x00, 0x00, 0x00, 0xbc, 0xff, 0x87,
+  0x01, 0x00, 0x00, 0x01, 0x59, 0x38, 0x00, 0x00, 0x42, 0xff, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xa6, 0xff, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xc8, 0xff, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe9, 0xff, 0x21, 0x00,
+  0x00, 0x06, 0x08, 0x08, 0x08, 0x06, 0x00, 0x00, 0xf4, 0xff, 0x15, 0x00, 0x00, 0xb5, 0xff, 0xff,
+  0xff, 0xc7, 0x00, 0x00, 0xd4, 0xff, 0x23, 0x00, 0x00, 0x59, 0x7e, 0x8a, 0xff, 0xc7, 0x00, 0x00,
+  0xb2, 0xff, 0x48, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xc7, 0x00, 0x00, 0x6f, 0xff, 0x94, 0x00,
+  0x00, 0x00, 0x00, 0x18, 0xff, 0xc7, 0x00, 0x00, 0x09, 0xe5, 0xf6, 0x38, 0x00, 0x00, 0x00, 0x18,
+  0xff, 0xc7, 0x00, 0x00, 0x00, 0x57, 0xfc, 0xf5, 0x86, 0x4e, 0x4b, 0x9c, 0xff, 0xc5, 0x00, 0x00,
+  0x00, 0x00, 0x45, 0xcf, 0xff, 0xff, 0xff, 0xfa, 0xac, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1c, 0x39, 0x35, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x73, 0xb0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x33, 0xb0, 0x7c, 0x00, 0xa6, 0xff,
+  0x52, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xff, 0xb3, 0x00, 0xa6, 0xff, 0x52, 0x00, 0x00, 0x00, 0x00,
+  0x4a, 0xff, 0xb3, 0x00, 0xa6, 0xff, 0x52, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xff, 0xb3, 0x00, 0xa6,
+  0xff, 0x52, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xff, 0xb3, 0x00, 0xa6, 0xff, 0x61, 0x16, 0x16, 0x16,
+  0x16, 0x59, 0xff, 0xb3, 0x00, 0xa6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x00,
+  0xa6, 0xff, 0xa4, 0x7a, 0x7a, 0x7a, 0x7a, 0xa0, 0xff, 0xb3, 0x00, 0xa6, 0xff, 0x52, 0x00, 0x00,
+  0x00, 0x00, 0x4a, 0xff, 0xb3, 0x00, 0xa6, 0xff, 0x52, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xff, 0xb3,
+  0x00, 0xa6, 0xff, 0x52, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xff, 0xb3, 0x00, 0xa6, 0xff, 0x52, 0x00,
+  0x00, 0x00, 0x00, 0x4a, 0xff, 0xb3, 0x00, 0xa6, 0xff, 0x52, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xff,
+  0xb3, 0x00, 0xa6, 0xff, 0x52, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xff, 0xb3, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+  0xb0, 0x0a, 0x00, 0x0a, 0xd9, 0xd9, 0xd9, 0xfe, 0xff, 0xd9, 0xd9, 0xd9, 0x0d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xfa, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xfd, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xfa, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xfd,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xfa, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa,
+  0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xfd, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x8f, 0x8f, 0x8f,
+  0xfd, 0xfe, 0x8f, 0x8f, 0x8f, 0x08, 0x00, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41,
+  0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0x3b, 0x00, 0x00, 0x00, 0x50, 0xd9, 0xd9, 0xd9, 0xf1, 0xff, 0x56,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xa2, 0xff, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0x56, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2,
+  0xff, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0x56, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xa2, 0xff, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xff, 0x54,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xff, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0xea, 0xff, 0x1b, 0x00, 0x44, 0x54, 0x54, 0x54, 0x5f, 0xb1, 0xff, 0xbd, 0x00, 0x00, 0xce,
+  0xff, 0xff, 0xff, 0xff, 0xfe, 0xbb, 0x1b, 0x00, 0x00, 0x24, 0x2d, 0x2d, 0x2d, 0x27, 0x11, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xb0, 0x38,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x94, 0xb0, 0x4e, 0x00, 0xa6, 0xff, 0x52, 0x00, 0x00, 0x00, 0x08,
+  0xb6, 0xff, 0x94, 0x01, 0x00, 0xa6, 0xff, 0x52, 0x00, 0x00, 0x08, 0xb9, 0xff, 0x90, 0x01, 0x00,
+  0x00, 0xa6, 0xff, 0x52, 0x00, 0x08, 0xb9, 0xff, 0x8c, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xff, 0x52,
+  0x09, 0xb9, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xff, 0x5b, 0xba, 0xff, 0x86, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xff, 0xea, 0xff, 0xff, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xa6, 0xff, 0xff, 0x81, 0xdf, 0xfe, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xff, 0x87,
+  0x00, 0x3e, 0xfd, 0xe8, 0x17, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xff, 0x52, 0x00, 0x00, 0x8b, 0xff,
+  0xb7, 0x01, 0x00, 0x00, 0x00, 0xa6, 0xff, 0x52, 0x00, 0x00, 0x07, 0xd2, 0xff, 0x70, 0x00, 0x00,
+  0x00, 0xa6, 0xff, 0x52, 0x00, 0x00, 0x00, 0x2f, 0xf9, 0xf8, 0x30, 0x00, 0x00, 0xa6, 0xff, 0x52,
+  0x00, 0x00, 0x00, 0x00, 0x77, 0xff, 0xd6, 0x0a, 0x00, 0xa6, 0xff, 0x52, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xc3, 0xff, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x9d, 0xb0, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xff, 0x15, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xff, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xe3, 0xff, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xff, 0x15,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xff, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xe3, 0xff, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xff,
+  0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xff, 0x15, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xe3, 0xff, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3,
+  0xff, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xff, 0x15, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xff, 0x99, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f, 0x10, 0x00,
+  0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xb0, 0xb0, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x51, 0xb0,
+  0xb0, 0x3a, 0x00, 0x42, 0xff, 0xff, 0xd7, 0x01, 0x00, 0x00, 0x00, 0xca, 0xff, 0xff, 0x54, 0x00,
+  0x42, 0xff, 0xce, 0xff, 0x3d, 0x00, 0x00, 0x31, 0xff, 0xcd, 0xff, 0x54, 0x00, 0x42, 0xff, 0x7d,
+  0xed, 0xa1, 0x00, 0x00, 0x96, 0xf4, 0x72, 0xff, 0x54, 0x00, 0x42, 0xff, 0x76, 0x91, 0xf5, 0x10,
+  0x0b, 0xf0, 0x9e, 0x64, 0xff, 0x54, 0x00, 0x42, 0xff, 0x76, 0x2e, 0xff, 0x6a, 0x61, 0xff, 0x3b,
+  0x64, 0xff, 0x54, 0x00, 0x42, 0xff, 0x76, 0x00, 0xca, 0xce, 0xc6, 0xd7, 0x00, 0x64, 0xff, 0x54,
+  0x00, 0x42, 0xff, 0x76, 0x00, 0x65, 0xff, 0xff, 0x74, 0x00, 0x64, 0xff, 0x54, 0x00, 0x42, 0xff,
+  0x76, 0x00, 0x0c, 0xf3, 0xf9, 0x16, 0x00, 0x64, 0xff, 0x54, 0x00, 0x42, 0xff, 0x76, 0x00, 0x00,
+  0x2e, 0x31, 0x00, 0x00, 0x64, 0xff, 0x54, 0x00, 0x42, 0xff, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x64, 0xff, 0x54, 0x00, 0x42, 0xff, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xff,
+  0x54, 0x00, 0x42, 0xff, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xff, 0x54, 0x00, 0x42,
+  0xff, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xff, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xb0, 0xab, 0x09, 0x00, 0x00, 0x00,
+  0x25, 0xb0, 0x79, 0x00, 0xa1, 0xff, 0xff, 0x65, 0x00, 0x00, 0x00, 0x36, 0xff, 0xae, 0x00, 0xa1,
+  0xff, 0xfe, 0xd4, 0x01, 0x00, 0x00, 0x36, 0xff, 0xae, 0x00, 0xa1, 0xff, 0xb5, 0xff, 0x47, 0x00,
+  0x00, 0x36, 0xff, 0xae, 0x00, 0xa1, 0xff, 0x52, 0xf2, 0xb8, 0x00, 0x00, 0x36, 0xff, 0xae, 0x00,
+  0xa1, 0xff, 0x43, 0x90, 0xfe, 0x2a, 0x00, 0x36, 0xff, 0xae, 0x00, 0xa1, 0xff, 0x43, 0x22, 0xfc,
+  0x99, 0x00, 0x36, 0xff, 0xae, 0x00, 0xa1, 0xff, 0x43, 0x00, 0xae, 0xf5, 0x13, 0x36, 0xff, 0xae,
+  0x00, 0xa1, 0xff, 0x43, 0x00, 0x3d, 0xff, 0x79, 0x36, 0xff, 0xae, 0x00, 0xa1, 0xff, 0x43, 0x00,
+  0x00, 0xcb, 0xe4, 0x3b, 0xff, 0xae, 0x00, 0xa1, 0xff, 0x43, 0x00, 0x00, 0x5b, 0xff, 0x91, 0xff,
+  0xae, 0x00, 0xa1, 0xff, 0x43, 0x00, 0x00, 0x05, 0xe4, 0xf3, 0xff, 0xae, 0x00, 0xa1, 0xff, 0x43,
+  0x00, 0x00, 0x00, 0x79, 0xff, 0xff, 0xae, 0x00, 0xa1, 0xff, 0x43, 0x00, 0x00, 0x00, 0x13, 0xf5,
+  0xff, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x26, 0x8c, 0xc1, 0xd0, 0xa3, 0x37, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xed, 0xfb, 0xc5, 0xc2, 0xf9,
+  0xfd, 0x5b, 0x00, 0x00, 0x03, 0xe0, 0xfb, 0x49, 0x00, 0x00, 0x3f, 0xf8, 0xec, 0x08, 0x00, 0x50,
+  0xff, 0xb3, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xff, 0x5c, 0x00, 0x98, 0xff, 0x6a, 0x00, 0x00, 0x00,
+  0x00, 0x61, 0xff, 0xa4, 0x00, 0xb2, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x44, 0xff, 0xbd, 0x00,
+  0xcc, 0xff, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0xd5, 0x00, 0xd4, 0xff, 0x3a, 0x00, 0x00,
+  0x00, 0x00, 0x2d, 0xff, 0xdc, 0x00, 0xba, 0xff, 0x49, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xc4,
+  0x00, 0xa0, 0xff, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x53, 0xff, 0xac, 0x00, 0x6f, 0xff, 0x9b, 0x00,
+  0x00, 0x00, 0x00, 0x8f, 0xff, 0x7b, 0x00, 0x12, 0xf6, 0xea, 0x1a, 0x00, 0x00, 0x14, 0xe3, 0xfa,
+  0x19, 0x00, 0x00, 0x7e, 0xff, 0xd9, 0x79, 0x77, 0xd4, 0xff, 0x97, 0x00, 0x00, 0x00, 0x00, 0x67,
+  0xdb, 0xfe, 0xff, 0xf0, 0x89, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x22, 0x06, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xb0,
+  0xb0, 0xb0, 0xb0, 0x9f, 0x81, 0x39, 0x00, 0x00, 0x00, 0x52, 0xff, 0xee, 0xcf, 0xcf, 0xe4, 0xfe,
+  0xff, 0xb2, 0x0a, 0x00, 0x52, 0xff, 0xa6, 0x00, 0x00, 0x00, 0x2c, 0xdb, 0xff, 0x82, 0x00, 0x52,
+  0xff, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x55, 0xff, 0xcd, 0x00, 0x52, 0xff, 0xa6, 0x00, 0x00, 0x00,
+  0x00, 0x33, 0xff, 0xdb, 0x00, 0x52, 0xff, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x6d, 0xff, 0xb3, 0x00,
+  0x52, 0xff, 0xa9, 0x08, 0x08, 0x17, 0x60, 0xf1, 0xff, 0x56, 0x00, 0x52, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xf3, 0x7a, 0x00, 0x00, 0x52, 0xff, 0xd2, 0x7e, 0x7d, 0x6d, 0x4f, 0x15, 0x00, 0x00,
+  0x00, 0x52, 0xff, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xff, 0xa6, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xff, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x52, 0xff, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xff, 0xa6,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x8c, 0xc1, 0xd0, 0xa3, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3f, 0xed, 0xfb, 0xc5, 0xc2, 0xf9, 0xfd, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe0, 0xfb,
+  0x49, 0x00, 0x00, 0x3f, 0xf8, 0xec, 0x08, 0x00, 0x00, 0x00, 0x50, 0xff, 0xb3, 0x00, 0x00, 0x00,
+  0x00, 0xa7, 0xff, 0x5c, 0x00, 0x00, 0x00, 0x98, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x61, 0xff,
+  0xa4, 0x00, 0x00, 0x00, 0xb2, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x44, 0xff, 0xbd, 0x00, 0x00,
+  0x00, 0xcc, 0xff, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff, 0xd5, 0x00, 0x00, 0x00, 0xd4, 0xff,
+  0x3a, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xff, 0xdc, 0x00, 0x00, 0x00, 0xba, 0xff, 0x49, 0x00, 0x00,
+  0x00, 0x00, 0x3f, 0xff, 0xc4, 0x00, 0x00, 0x00, 0xa0, 0xff, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x53,
+  0xff, 0xac, 0x00, 0x00, 0x00, 0x6f, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x90, 0xff, 0x7d, 0x00,
+  0x00, 0x00, 0x12, 0xf6, 0xeb, 0x1b, 0x00, 0x00, 0x15, 0xe4, 0xfd, 0x1f, 0x00, 0x00, 0x00, 0x00,
+  0x7e, 0xff, 0xda, 0x79, 0x77, 0xd4, 0xff, 0xf5, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xda,
+  0xfe, 0xff, 0xed, 0xa7, 0xfd, 0xdf, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x1d, 0x04,
+  0x00, 0x73, 0xff, 0xc9, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c,
+  0xe4, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x69, 0xb0, 0xb0, 0xb0, 0xaf, 0x97, 0x74, 0x15, 0x00, 0x00, 0x00, 0x97, 0xff, 0xe1, 0xcf, 0xd0,
+  0xe5, 0xff, 0xf1, 0x44, 0x00, 0x00, 0x97, 0xff, 0x61, 0x00, 0x00, 0x00, 0x4e, 0xfb, 0xe8, 0x0e,
+  0x00, 0x97, 0xff, 0x61, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0x47, 0x00, 0x97, 0xff, 0x61, 0x00,
+  0x00, 0x00, 0x00, 0x8d, 0xff, 0x60, 0x00, 0x97, 0xff, 0x61, 0x00, 0x00, 0x00, 0x04, 0xcf, 0xff,
+  0x33, 0x00, 0x97, 0xff, 0x94, 0x53, 0x55, 0x6c, 0xc7, 0xff, 0xaa, 0x00, 0x00, 0x97, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xf8, 0x86, 0x05, 0x00, 0x00, 0x97, 0xff, 0x83, 0x3a, 0x3d, 0xe0, 0xf5, 0x1c,
+  0x00, 0x00, 0x00, 0x97, 0xff, 0x61, 0x00, 0x00, 0x62, 0xff, 0x9a, 0x00, 0x00, 0x00, 0x97, 0xff,
+  0x61, 0x00, 0x00, 0x04, 0xdb, 0xfa, 0x25, 0x00, 0x00, 0x97, 0xff, 0x61, 0x00, 0x00, 0x00, 0x5f,
+  0xff, 0xa9, 0x00, 0x00, 0x97, 0xff, 0x61, 0x00, 0x00, 0x00, 0x04, 0xda, 0xfe, 0x32, 0x00, 0x97,
+  0xff, 0x61, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5a, 0xba, 0xe9, 0xf0, 0xd7, 0xa5, 0x58, 0x00, 0x00,
+  0x00, 0x96, 0xff, 0xe8, 0xa4, 0x94, 0xb0, 0xee, 0xe1, 0x00, 0x00, 0x44, 0xff, 0xc4, 0x0a, 0x00,
+  0x00, 0x00, 0x09, 0x5a, 0x00, 0x00, 0x83, 0xff, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x90, 0xff, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xff, 0xee, 0x6c,
+  0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xff, 0xff, 0xfe, 0xd5, 0x8d, 0x36, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x34, 0x8b, 0xcb, 0xfa, 0xff, 0xfe, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0c, 0x58, 0xe7, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
+  0xff, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xff, 0xb0, 0x00, 0x31, 0x17,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xff, 0x87, 0x00, 0x75, 0xf6, 0xa3, 0x60, 0x42, 0x53, 0x9d,
+  0xfd, 0xf1, 0x20, 0x00, 0x3c, 0xc3, 0xfb, 0xff, 0xff, 0xff, 0xfe, 0xb1, 0x2d, 0x00, 0x00, 0x00,
+  0x00, 0x0a, 0x2f, 0x3d, 0x29, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0,
+  0x67, 0x00, 0x73, 0xd9, 0xd9, 0xd9, 0xd9, 0xfe, 0xff, 0xda, 0xd9, 0xd9, 0xd9, 0x7e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf5, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xf5, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xff,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xff, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xf5, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5,
+  0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xff, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xf5, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xb0, 0x20, 0x00, 0x00, 0x00, 0x00, 0x17,
+  0xb0, 0x94, 0x00, 0xd3, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x22, 0xff, 0xd6, 0x00, 0xd3, 0xff,
+  0x2f, 0x00, 0x00, 0x00, 0x00, 0x22, 0xff, 0xd6, 0x00, 0xd3, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00,
+  0x22, 0xff, 0xd6, 0x00, 0xd3, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x22, 0xff, 0xd6, 0x00, 0xd3,
+  0xff, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x22, 0xff, 0xd6, 0x00, 0xd3, 0xff, 0x2f, 0x00, 0x00, 0x00,
+  0x00, 0x22, 0xff, 0xd6, 0x00, 0xd3, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x22, 0xff, 0xd6, 0x00,
+  0xd3, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x22, 0xff, 0xd6, 0x00, 0xcc, 0xff, 0x2f, 0x00, 0x00,
+  0x00, 0x00, 0x22, 0xff, 0xd2, 0x00, 0xba, 0xff, 0x32, 0x00, 0x00, 0x00, 0x00, 0x28, 0xff, 0xc3,
+  0x00, 0x90, 0xff, 0x65, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0x99, 0x00, 0x2b, 0xf8, 0xf3, 0x7e,
+  0x46, 0x45, 0x7b, 0xf2, 0xf9, 0x31, 0x00, 0x00, 0x41, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x47,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x38, 0x3f, 0x24, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xb0, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x61, 0xb0, 0x42, 0x00, 0x14, 0xfb, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0xfe,
+  0x1d, 0x00, 0x00, 0xc0, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x18, 0xfd, 0xcc, 0x00, 0x00, 0x00,
+  0x71, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x62, 0xff, 0x7c, 0x00, 0x00, 0x00, 0x23, 0xff, 0xb6,
+  0x00, 0x00, 0x00, 0x00, 0xae, 0xff, 0x2c, 0x00, 0x00, 0x00, 0x00, 0xd3, 0xf7, 0x0b, 0x00, 0x00,
+  0x06, 0xf2, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xff, 0x4e, 0x00, 0x00, 0x43, 0xff, 0x8c,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xff, 0x99, 0x00, 0x00, 0x8e, 0xff, 0x3d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xe3, 0xe4, 0x01, 0x00, 0xd8, 0xea, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x95, 0xff, 0x31, 0x25, 0xff, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xff, 0x7b,
+  0x71, 0xff, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xef, 0xc6, 0xbd, 0xf6, 0x0a,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xfc, 0xfa, 0xb1, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xff, 0xff, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x87, 0x00, 0x00, 0x18,
+  0xb0, 0xb0, 0x1d, 0x00, 0x00, 0x82, 0xa6, 0x00, 0xc4, 0xe2, 0x00, 0x00, 0x46, 0xff, 0xff, 0x4b,
+  0x00, 0x00, 0xd9, 0xcf, 0x00, 0x9c, 0xfd, 0x08, 0x00, 0x6d, 0xf8, 0xf3, 0x73, 0x00, 0x03, 0xf9,
+  0xa8, 0x00, 0x73, 0xff, 0x2a, 0x00, 0x92, 0xd1, 0xc8, 0x9a, 0x00, 0x20, 0xff, 0x80, 0x00, 0x4b,
+  0xff, 0x4e, 0x00, 0xb8, 0xa4, 0x9c, 0xc1, 0x00, 0x43, 0xff, 0x58, 0x00, 0x24, 0xff, 0x71, 0x00,
+  0xdf, 0x7c, 0x73, 0xe8, 0x00, 0x66, 0xff, 0x30, 0x00, 0x03, 0xf8, 0x95, 0x09, 0xfd, 0x53, 0x49,
+  0xff, 0x10, 0x89, 0xfd, 0x0a, 0x00, 0x00, 0xd4, 0xb8, 0x2d, 0xff, 0x2b, 0x1e, 0xff, 0x36, 0xac,
+  0xdf, 0x00, 0x00, 0x00, 0xad, 0xdb, 0x54, 0xfa, 0x06, 0x01, 0xf4, 0x5e, 0xcf, 0xb7, 0x00, 0x00,
+  0x00, 0x86, 0xfa, 0x80, 0xd6, 0x00, 0x00, 0xce, 0x86, 0xf2, 0x8e, 0x00, 0x00, 0x00, 0x5e, 0xff,
+  0xc7, 0xac, 0x00, 0x00, 0xa3, 0xc4, 0xff, 0x67, 0x00, 0x00, 0x00, 0x35, 0xff, 0xfd, 0x83, 0x00,
+  0x00, 0x79, 0xfc, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x0e, 0xfe, 0xff, 0x59, 0x00, 0x00, 0x4f, 0xff,
+  0xff, 0x18, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xff, 0x2f, 0x00, 0x00, 0x26, 0xff, 0xf0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xb0,
+  0x8f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xb0, 0x36, 0x00, 0x00, 0xaf, 0xff, 0x66, 0x00,
+  0x00, 0x00, 0x00, 0x54, 0xff, 0xba, 0x01, 0x00, 0x00, 0x14, 0xe6, 0xf3, 0x23, 0x00, 0x00, 0x10,
+  0xe6, 0xef, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x46, 0xfe, 0xc5, 0x03, 0x00, 0x9a, 0xff, 0x5f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0xff, 0x7b, 0x3e, 0xfe, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xce, 0xfa, 0xe0, 0xed, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2a, 0xfe, 0xff, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xff, 0xff,
+  0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xf6, 0xda, 0xa2, 0xff, 0x51, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc7, 0xfe, 0x3f, 0x13, 0xeb, 0xe5, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x78, 0xff, 0x96, 0x00, 0x00, 0x62, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xf8,
+  0xe1, 0x0e, 0x00, 0x00, 0x01, 0xc3, 0xfe, 0x43, 0x00, 0x00, 0x04, 0xcb, 0xff, 0x49, 0x00, 0x00,
+  0x00, 0x00, 0x2d, 0xfb, 0xdb, 0x09, 0x00, 0x7c, 0xff, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8e, 0xff, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4b, 0xb0, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xb0, 0x52, 0x00, 0x09, 0xdb,
+  0xfc, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xfa, 0xe3, 0x0d, 0x00, 0x00, 0x46, 0xff, 0xc2, 0x01,
+  0x00, 0x00, 0x00, 0xb9, 0xff, 0x52, 0x00, 0x00, 0x00, 0x00, 0xa9, 0xff, 0x5a, 0x00, 0x00, 0x50,
+  0xff, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xf1, 0xe4, 0x0c, 0x08, 0xdd, 0xf3, 0x1e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xff, 0x87, 0x7c, 0xff, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xcc, 0xf8, 0xf5, 0xd1, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x35, 0xfe, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xfd,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xfd, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xfa, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa,
+  0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7d, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0xb0, 0x86, 0x00, 0x9a,
+  0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xef, 0xff, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0xe4, 0xfa, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xff, 0x7a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xff, 0xc1, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b,
+  0xed, 0xef, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb8, 0xff, 0x59, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x69, 0xff, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xf4,
+  0xdf, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc6, 0xfc, 0x3c, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x7c, 0xff, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xfa, 0xc9,
+  0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xff, 0xb1, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f,
+  0x8f, 0x89, 0x00, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
+  0x00, 0x00, 0x1c, 0xff, 0xfd, 0xf9, 0xf9, 0xf9, 0xf9, 0x01, 0x00, 0x1c, 0xff, 0xb4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1c, 0xff, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xff, 0xb4,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xff, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c,
+  0xff, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xff, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1c, 0xff, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xff, 0xb4, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1c, 0xff, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xff, 0xb4, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xff, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xff,
+  0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xff, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1c, 0xff, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xff, 0xe9, 0xb4, 0xb4, 0xb4, 0xb4,
+  0x01, 0x00, 0x15, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0xc1, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5b, 0x8c, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+  0xff, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0xf9, 0x1f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xff, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xc3, 0xf9, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xff, 0x9a,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0xfa, 0x21, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x45, 0xff, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xc7, 0xfa, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xff, 0x99, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xf9, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x49, 0xff, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0xf8,
+  0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0xff, 0x95, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0xf8, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x49, 0xe5, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77,
+  0x78, 0x78, 0x78, 0x78, 0x78, 0x0c, 0x00, 0xf7, 0xf9, 0xf9, 0xf9, 0xfd, 0xff, 0x1a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xb1, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xff, 0x1a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xb1, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xff, 0x1a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xb1, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xff, 0x1a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xb1, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xff, 0x1a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xb1, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xff, 0x1a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xb1, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xff, 0x1a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xb1, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xff, 0x1a, 0x00, 0xb8,
+  0xb9, 0xb9, 0xb9, 0xea, 0xff, 0x1a, 0x00, 0xbb, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0x13, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xac, 0xae, 0x1b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0xba, 0xfd, 0xfb, 0xc4, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f,
+  0xff, 0x87, 0x7c, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x45, 0xfd, 0xcb, 0x06, 0x03, 0xc3, 0xfe,
+  0x4e, 0x00, 0x00, 0x1b, 0xe9, 0xf4, 0x26, 0x00, 0x00, 0x21, 0xf0, 0xed, 0x1f, 0x00, 0x54, 0x8a,
+  0x4d, 0x00, 0x00, 0x00, 0x00, 0x47, 0x8a, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x21, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe, 0xbe,
+  0xbe, 0x2b, 0x00, 0x21, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc, 0xbc,
+  0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xff, 0xca, 0x05, 0x00, 0x00, 0x00, 0x00,
+  0xa6, 0xff, 0x85, 0x00, 0x00, 0x00, 0x00, 0x11, 0xe3, 0xfc, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x41,
+  0xfd, 0xe0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1c, 0x7d, 0x81, 0x84, 0x7b, 0x4f, 0x09, 0x00, 0x00, 0x00, 0x00, 0x36, 0xea,
+  0xe5, 0xe5, 0xf7, 0xff, 0xe9, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x45, 0xf0,
+  0xee, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xff, 0x45, 0x00, 0x00, 0x00,
+  0x13, 0x50, 0x73, 0x80, 0x80, 0xba, 0xff, 0x59, 0x00, 0x01, 0x85, 0xf8, 0xfe, 0xe5, 0xd8, 0xd7,
+  0xe9, 0xff, 0x5f, 0x00, 0x56, 0xff, 0xbb, 0x1e, 0x00, 0x00, 0x00, 0x78, 0xff, 0x5f, 0x00, 0x9b,
+  0xff, 0x32, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xff, 0x5f, 0x00, 0x92, 0xff, 0x3f, 0x00, 0x00, 0x00,
+  0x1b, 0xf2, 0xff, 0x5f, 0x00, 0x47, 0xfe, 0xd7, 0x4f, 0x2b, 0x56, 0xd9, 0xef, 0xff, 0x5f, 0x00,
+  0x00, 0x6b, 0xf0, 0xff, 0xff, 0xfe, 0xb7, 0x58, 0xff, 0x5d, 0x00, 0x00, 0x00, 0x09, 0x2f, 0x37,
+  0x15, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1a, 0xcd, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0xab, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x20, 0xff, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0xab,
+  0x06, 0x55, 0x7f, 0x6e, 0x21, 0x00, 0x00, 0x00, 0x20, 0xff, 0xba, 0xcd, 0xfe, 0xed, 0xfc, 0xf9,
+  0x5d, 0x00, 0x00, 0x20, 0xff, 0xff, 0xd1, 0x23, 0x00, 0x14, 0xb2, 0xf9, 0x21, 0x00, 0x20, 0xff,
+  0xff, 0x30, 0x00, 0x00, 0x00, 0x11, 0xf5, 0x82, 0x00, 0x20, 0xff, 0xe6, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xbd, 0xbb, 0x00, 0x20, 0xff, 0xca, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0xd5, 0x00, 0x20,
+  0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xd1, 0x00, 0x20, 0xff, 0xf1, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0xca, 0xaf, 0x00, 0x20, 0xff, 0xff, 0x52, 0x00, 0x00, 0x00, 0x29, 0xfd, 0x67, 0x00,
+  0x20, 0xff, 0xf1, 0xef, 0x63, 0x2f, 0x52, 0xdb, 0xdf, 0x0a, 0x00, 0x20, 0xff, 0x8f, 0x7a, 0xf7,
+  0xff, 0xff, 0xd1, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x32, 0x28, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+  0x5b, 0x7b, 0x7f, 0x54, 0x0c, 0x00, 0x00, 0x00, 0x01, 0x73, 0xf7, 0xff, 0xf5, 0xef, 0xff, 0xf0,
+  0x0b, 0x00, 0x00, 0x69, 0xff, 0xd0, 0x37, 0x01, 0x00, 0x25, 0xa7, 0x0f, 0x00, 0x05, 0xec, 0xf3,
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xff, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x5b, 0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xff,
+  0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xff, 0xbf, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xfe, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x04, 0x00, 0x00,
+  0x3d, 0xf9, 0xf1, 0x78, 0x38, 0x31, 0x68, 0xd7, 0x0f, 0x00, 0x00, 0x00, 0x38, 0xc6, 0xff, 0xff,
+  0xff, 0xfb, 0xb0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x37, 0x2e, 0x0e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7c, 0xc8, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xff, 0x2d,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xff, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x9e, 0xff, 0x2d, 0x00, 0x00, 0x00, 0x15, 0x56, 0x7d, 0x5c, 0x0a, 0x9e, 0xff,
+  0x2d, 0x00, 0x00, 0x3d, 0xe8, 0xff, 0xef, 0xfa, 0xd8, 0xb3, 0xff, 0x2d, 0x00, 0x0b, 0xe9, 0xf1,
+  0x40, 0x00, 0x0f, 0xab, 0xff, 0xff, 0x2d, 0x00, 0x6f, 0xff, 0x7b, 0x00, 0x00, 0x00, 0x11, 0xf3,
+  0xff, 0x2d, 0x00, 0xa2, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xff, 0x2d, 0x00, 0xc3, 0xff,
+  0x1e, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0x2d, 0x00, 0xc3, 0xff, 0x23, 0x00, 0x00, 0x00, 0x00,
+  0xa6, 0xff, 0x2d, 0x00, 0x9d, 0xff, 0x45, 0x00, 0x00, 0x00, 0x00, 0xc9, 0xff, 0x2d, 0x00, 0x57,
+  0xff, 0x99, 0x00, 0x00, 0x00, 0x27, 0xfd, 0xff, 0x2d, 0x00, 0x05, 0xd7, 0xfd, 0x80, 0x31, 0x4b,
+  0xd6, 0xf1, 0xff, 0x2d, 0x00, 0x00, 0x24, 0xca, 0xff, 0xff, 0xf9, 0x88, 0x82, 0xff, 0x2d, 0x00,
+  0x00, 0x00, 0x00, 0x24, 0x35, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x6d, 0x7a, 0x51, 0x12, 0x00, 0x00,
+  0x00, 0x00, 0x16, 0xc2, 0xff, 0xfa, 0xed, 0xfe, 0xe9, 0x4f, 0x00, 0x00, 0x03, 0xc6, 0xfe, 0x7d,
+  0x0a, 0x00, 0x21, 0xcc, 0xf5, 0x1d, 0x00, 0x52, 0xff, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x31, 0xff,
+  0x8e, 0x00, 0x9c, 0xff, 0x4c, 0x0e, 0x0e, 0x0e, 0x0e, 0x0e, 0xf6, 0xb9, 0x00, 0xbd, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x00, 0xb1, 0xff, 0x5a, 0x41, 0x41, 0x41, 0x41, 0x41,
+  0x41, 0x38, 0x00, 0x86, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xfc,
+  0xc0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x00, 0x8d, 0xff, 0xc8, 0x57, 0x31, 0x3b,
+  0x73, 0xcb, 0x73, 0x00, 0x00, 0x01, 0x5d, 0xe3, 0xff, 0xff, 0xff, 0xfd, 0xcb, 0x3f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x38, 0x35, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x51, 0x60, 0x60, 0x4b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x93, 0xfe, 0xff, 0xff, 0xff, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xfe,
+  0xb4, 0x20, 0x0d, 0x0d, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x62, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7b, 0xff, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x51, 0x51, 0xa6,
+  0xff, 0x8a, 0x51, 0x51, 0x33, 0x00, 0x00, 0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0,
+  0x00, 0x00, 0x26, 0x35, 0x35, 0x98, 0xff, 0x77, 0x35, 0x35, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7d, 0xff, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xff, 0x54, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xff, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x7d, 0xff, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xff, 0x54, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xff, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7d, 0xff, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x56, 0x7e, 0x73, 0x2b, 0x0a, 0x3c, 0x1b, 0x00,
+  0x00, 0x1c, 0xd6, 0xff, 0xfa, 0xf4, 0xfd, 0xab, 0xff, 0x70, 0x00, 0x00, 0xbd, 0xff, 0x7a, 0x09,
+  0x02, 0x6b, 0xff, 0xff, 0x6e, 0x00, 0x2b, 0xff, 0xbd, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0x6e,
+  0x00, 0x66, 0xff, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x73, 0xff, 0x6d, 0x00, 0x7e, 0xff, 0x51, 0x00,
+  0x00, 0x00, 0x00, 0x5c, 0xff, 0x6c, 0x00, 0x77, 0xff, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xff,
+  0x6a, 0x00, 0x50, 0xff, 0x85, 0x00, 0x00, 0x00, 0x00, 0x8e, 0xff, 0x69, 0x00, 0x0d, 0xf2, 0xe9,
+  0x14, 0x00, 0x00, 0x10, 0xe8, 0xff, 0x68, 0x00, 0x00, 0x72, 0xff, 0xdb, 0x75, 0x72, 0xd5, 0xfd,
+  0xff, 0x66, 0x00, 0x00, 0x01, 0x6f, 0xe4, 0xff, 0xfd, 0xcb, 0x66, 0xff, 0x64, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0c, 0x07, 0x00, 0x41, 0xff, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8d, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xe5, 0xe6, 0x0a, 0x00, 0x00,
+  0x50, 0x94, 0x95, 0x9a, 0xc6, 0xff, 0xfe, 0x60, 0x00, 0x00, 0x00, 0x81, 0xee, 0xec, 0xe9, 0xe6,
+  0xbb, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0xc8, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xb0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1b, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xb0, 0x09,
+  0x5b, 0x8c, 0x87, 0x3f, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xbf, 0xc1, 0xff, 0xf9, 0xff, 0xff, 0x66,
+  0x00, 0x00, 0x1b, 0xff, 0xff, 0xb6, 0x1b, 0x01, 0x44, 0xf7, 0xea, 0x04, 0x00, 0x1b, 0xff, 0xf5,
+  0x10, 0x00, 0x00, 0x00, 0xae, 0xff, 0x2b, 0x00, 0x1b, 0xff, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x8f,
+  0xff, 0x3e, 0x00, 0x1b, 0xff, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0x41, 0x00, 0x1b, 0xff,
+  0xb0, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0x41, 0x00, 0x1b, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00,
+  0x8a, 0xff, 0x41, 0x00, 0x1b, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0x41, 0x00, 0x1b,
+  0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0x41, 0x00, 0x1b, 0xff, 0xb0, 0x00, 0x00, 0x00,
+  0x00, 0x8a, 0xff, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1d, 0x47, 0x1e, 0x00, 0x00, 0x00, 0x7e, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x66, 0xd9,
+  0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x46, 0x46, 0x46, 0x23, 0x00, 0xc1, 0xff,
+  0xff, 0xff, 0x7f, 0x00, 0x2d, 0x3b, 0x71, 0xff, 0x7c, 0x00, 0x00, 0x00, 0x47, 0xff, 0x7b, 0x00,
+  0x00, 0x00, 0x47, 0xff, 0x7b, 0x00, 0x00, 0x00, 0x47, 0xff, 0x7b, 0x00, 0x00, 0x00, 0x47, 0xff,
+  0x7c, 0x00, 0x00, 0x00, 0x47, 0xff, 0x80, 0x00, 0x00, 0x00, 0x4b, 0xff, 0x84, 0x00, 0x00, 0x00,
+  0x4c, 0xff, 0x84, 0x00, 0x00, 0x00, 0x4c, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1c, 0x47, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xff, 0x83, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5f, 0xd9, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x43, 0x46, 0x46, 0x46, 0x2d, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xff, 0xff, 0xa6, 0x00,
+  0x00, 0x00, 0x38, 0x3b, 0x57, 0xff, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xff, 0xa6, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x25, 0xff, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xff, 0xa6, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x25, 0xff, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xff, 0xa6, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x25, 0xff, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xff, 0xa6, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x25, 0xff, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xff, 0xa5, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x55, 0xff, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x06, 0xa9, 0xff, 0x64, 0x00,
+  0x72, 0xa3, 0xa3, 0xda, 0xff, 0xec, 0x0b, 0x00, 0xa3, 0xeb, 0xeb, 0xe0, 0xaf, 0x28, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x42, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xca, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0xff,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xca, 0xff, 0x10, 0x00, 0x00, 0x00, 0x19, 0x46, 0x38, 0x00, 0x00, 0xca,
+  0xff, 0x10, 0x00, 0x00, 0x2f, 0xe5, 0xe6, 0x30, 0x00, 0x00, 0xca, 0xff, 0x10, 0x00, 0x41, 0xf0,
+  0xd9, 0x21, 0x00, 0x00, 0x00, 0xca, 0xff, 0x10, 0x54, 0xf8, 0xc9, 0x15, 0x00, 0x00, 0x00, 0x00,
+  0xca, 0xff, 0x79, 0xfc, 0xdf, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0xff, 0xff, 0xea, 0xff,
+  0x5e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0xff, 0x7f, 0x18, 0xe6, 0xf5, 0x2f, 0x00, 0x00, 0x00,
+  0x00, 0xca, 0xff, 0x10, 0x00, 0x3f, 0xfb, 0xdb, 0x10, 0x00, 0x00, 0x00, 0xca, 0xff, 0x10, 0x00,
+  0x00, 0x78, 0xff, 0xb0, 0x01, 0x00, 0x00, 0xca, 0xff, 0x10, 0x00, 0x00, 0x01, 0xb3, 0xff, 0x78,
+  0x00, 0x00, 0xca, 0xff, 0x10, 0x00, 0x00, 0x00, 0x12, 0xdf, 0xfc, 0x43, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xb5, 0xb5, 0xb5, 0xb5, 0x3a, 0x00, 0x33,
+  0xcf, 0xcf, 0xe9, 0xff, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x86, 0xff, 0x4d, 0x00, 0x00, 0x00, 0x00,
+  0x83, 0xff, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x82, 0xff, 0x49, 0x00, 0x00, 0x00, 0x00, 0x82, 0xff,
+  0x49, 0x00, 0x00, 0x00, 0x00, 0x82, 0xff, 0x49, 0x00, 0x00, 0x00, 0x00, 0x82, 0xff, 0x49, 0x00,
+  0x00, 0x00, 0x00, 0x82, 0xff, 0x49, 0x00, 0x00, 0x00, 0x00, 0x82, 0xff, 0x49, 0x00, 0x00, 0x00,
+  0x00, 0x82, 0xff, 0x49, 0x00, 0x00, 0x00, 0x00, 0x82, 0xff, 0x49, 0x00, 0x00, 0x00, 0x00, 0x82,
+  0xff, 0x49, 0x00, 0x00, 0x00, 0x00, 0x82, 0xff, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0e, 0x46, 0x15, 0x47, 0x77, 0x39, 0x00, 0x27, 0x6d, 0x69, 0x10, 0x00, 0x00, 0x33, 0xff,
+  0xca, 0xf4, 0xf7, 0xfa, 0x81, 0xf7, 0xec, 0xff, 0xc5, 0x00, 0x00, 0x33, 0xff, 0xc4, 0x05, 0x19,
+  0xf6, 0xff, 0x41, 0x00, 0x97, 0xff, 0x1f, 0x00, 0x33, 0xff, 0x84, 0x00, 0x00, 0xd1, 0xf3, 0x00,
+  0x00, 0x5d, 0xff, 0x41, 0x00, 0x33, 0xff, 0x74, 0x00, 0x00, 0xc3, 0xe5, 0x00, 0x00, 0x51, 0xff,
+  0x50, 0x00, 0x33, 0xff, 0x71, 0x00, 0x00, 0xc3, 0xdf, 0x00, 0x00, 0x4b, 0xff, 0x59, 0x00, 0x33,
+  0xff, 0x71, 0x00, 0x00, 0xc3, 0xdf, 0x00, 0x00, 0x4b, 0xff, 0x59, 0x00, 0x33, 0xff, 0x71, 0x00,
+  0x00, 0xc3, 0xdf, 0x00, 0x00, 0x4b, 0xff, 0x59, 0x00, 0x33, 0xff, 0x71, 0x00, 0x00, 0xc3, 0xdf,
+  0x00, 0x00, 0x4b, 0xff, 0x59, 0x00, 0x33, 0xff, 0x71, 0x00, 0x00, 0xc3, 0xdf, 0x00, 0x00, 0x4b,
+  0xff, 0x59, 0x00, 0x33, 0xff, 0x71, 0x00, 0x00, 0xc3, 0xdf, 0x00, 0x00, 0x4b, 0xff, 0x59, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x46, 0x25,
+  0x01, 0x32, 0x6d, 0x49, 0x02, 0x00, 0x00, 0x00, 0x1b, 0xff, 0x9c, 0x8f, 0xff, 0xfa, 0xff, 0xdd,
+  0x48, 0x00, 0x00, 0x1b, 0xff, 0xf5, 0xb3, 0x1d, 0x02, 0x4b, 0xfa, 0xb1, 0x00, 0x00, 0x1b, 0xff,
+  0xf3, 0x12, 0x00, 0x00, 0x00, 0xb3, 0xf1, 0x04, 0x00, 0x1b, 0xff, 0xc6, 0x00, 0x00, 0x00, 0x00,
+  0x90, 0xff, 0x34, 0x00, 0x1b, 0xff, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0x41, 0x00, 0x1b,
+  0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0x41, 0x00, 0x1b, 0xff, 0xb0, 0x00, 0x00, 0x00,
+  0x00, 0x8a, 0xff, 0x41, 0x00, 0x1b, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0x41, 0x00,
+  0x1b, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0x41, 0x00, 0x1b, 0xff, 0xb0, 0x00, 0x00,
+  0x00, 0x00, 0x8a, 0xff, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0x43, 0x6f, 0x71, 0x44, 0x07, 0x00, 0x00, 0x00, 0x00, 0x25, 0xcc, 0xff,
+  0xf9, 0xf8, 0xff, 0xd0, 0x29, 0x00, 0x00, 0x01, 0xca, 0xfe, 0x73, 0x08, 0x07, 0x6b, 0xfc, 0xd2,
+  0x02, 0x00, 0x48, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xff, 0x52, 0x00, 0x7a, 0xff, 0x63,
+  0x00, 0x00, 0x00, 0x00, 0x5a, 0xff, 0x84, 0x00, 0x99, 0xff, 0x48, 0x00, 0x00, 0x00, 0x00, 0x3c,
+  0xff, 0xa6, 0x00, 0x92, 0xff, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x43, 0xff, 0x9e, 0x00, 0x72, 0xff,
+  0x71, 0x00, 0x00, 0x00, 0x00, 0x68, 0xff, 0x7b, 0x00, 0x31, 0xfe, 0xd4, 0x04, 0x00, 0x00, 0x02,
+  0xca, 0xff, 0x38, 0x00, 0x00, 0xa8, 0xff, 0xb6, 0x45, 0x43, 0xb0, 0xff, 0xb0, 0x00, 0x00, 0x00,
+  0x08, 0x8e, 0xfa, 0xff, 0xff, 0xfb, 0x98, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x2a, 0x2d,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x46, 0x23, 0x08, 0x47, 0x78, 0x56, 0x16, 0x00, 0x00, 0x00, 0x25, 0xff, 0xa2, 0xbf, 0xff,
+  0xf7, 0xff, 0xeb, 0x42, 0x00, 0x00, 0x25, 0xff, 0xff, 0xe5, 0x39, 0x04, 0x5c, 0xdd, 0xee, 0x0f,
+  0x00, 0x25, 0xff, 0xff, 0x5c, 0x00, 0x00, 0x00, 0x55, 0xff, 0x74, 0x00, 0x25, 0xff, 0xff, 0x0e,
+  0x00, 0x00, 0x00, 0x1e, 0xff, 0xa6, 0x00, 0x25, 0xff, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe6,
+  0xc5, 0x00, 0x25, 0xff, 0xf7, 0x01, 0x00, 0x00, 0x00, 0x03, 0xf2, 0xbc, 0x00, 0x25, 0xff, 0xff,
+  0x1b, 0x00, 0x00, 0x00, 0x2d, 0xff, 0x9b, 0x00, 0x25, 0xff, 0xff, 0x7b, 0x00, 0x00, 0x00, 0x6a,
+  0xff, 0x55, 0x00, 0x25, 0xff, 0xf3, 0xfb, 0x7b, 0x3c, 0x9f, 0xfc, 0xd3, 0x02, 0x00, 0x25, 0xff,
+  0xa6, 0x84, 0xf9, 0xff, 0xfe, 0xbd, 0x17, 0x00, 0x00, 0x25, 0xff, 0xa6, 0x00, 0x08, 0x32, 0x13,
+  0x00, 0x00, 0x00, 0x00, 0x25, 0xff, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25,
+  0xff, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xff, 0xa6, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0xf0, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x47, 0x73,
+  0x4d, 0x0e, 0x15, 0x3c, 0x12, 0x00, 0x00, 0x20, 0xd1, 0xff, 0xfb, 0xff, 0xd5, 0x85, 0xff, 0x4b,
+  0x00, 0x00, 0xc6, 0xf2, 0x4c, 0x04, 0x27, 0xce, 0xff, 0xff, 0x4b, 0x00, 0x42, 0xff, 0x7a, 0x00,
+  0x00, 0x00, 0x2e, 0xff, 0xff, 0x4b, 0x00, 0x79, 0xff, 0x2a, 0x00, 0x00, 0x00, 0x00, 0xde, 0xff,
+  0x4b, 0x00, 0x98, 0xff, 0x11, 0x00, 0x00, 0x00, 0x00, 0xc2, 0xff, 0x4b, 0x00, 0x9e, 0xff, 0x15,
+  0x00, 0x00, 0x00, 0x00, 0xc7, 0xff, 0x4b, 0x00, 0x7e, 0xff, 0x34, 0x00, 0x00, 0x00, 0x01, 0xe7,
+  0xff, 0x4b, 0x00, 0x3c, 0xff, 0x94, 0x00, 0x00, 0x00, 0x46, 0xff, 0xff, 0x4b, 0x00, 0x00, 0xbf,
+  0xfd, 0x7e, 0x2e, 0x58, 0xea, 0xf4, 0xff, 0x4b, 0x00, 0x00, 0x18, 0xc5, 0xff, 0xff, 0xfe, 0xab,
+  0x86, 0xff, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x41, 0x15, 0x00, 0x80, 0xff, 0x4b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x80, 0xff, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x4b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xeb, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x46, 0x14, 0x10, 0x5c, 0x7f, 0x70, 0x36, 0x00, 0x00,
+  0x7b, 0xff, 0x83, 0xeb, 0xff, 0xff, 0xff, 0xff, 0x6c, 0x00, 0x7b, 0xff, 0xfe, 0xb3, 0x2f, 0x0a,
+  0x29, 0x6e, 0x68, 0x00, 0x7b, 0xff, 0xb7, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xff,
+  0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xff, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7b, 0xff, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xff, 0x4c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xff, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0xff, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xff, 0x4f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x4a, 0x72, 0x7f, 0x68, 0x33, 0x02, 0x00, 0x00, 0x1b, 0xda, 0xff, 0xfd, 0xeb, 0xfe, 0xff, 0x7b,
+  0x00, 0x00, 0xa6, 0xff, 0x7e, 0x10, 0x00, 0x0a, 0x52, 0x4e, 0x00, 0x00, 0xd2, 0xfa, 0x07, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0xff, 0x91, 0x2d, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0xc7, 0xff, 0xff, 0xf0, 0xb5, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x6f, 0xac, 0xf6,
+  0xff, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xee, 0xdf, 0x02, 0x00, 0x06, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xd9, 0xef, 0x02, 0x00, 0xdc, 0x95, 0x51, 0x2d, 0x3b, 0xa1, 0xff, 0x98,
+  0x00, 0x00, 0xaf, 0xf2, 0xff, 0xff, 0xff, 0xf6, 0x91, 0x07, 0x00, 0x00, 0x00, 0x04, 0x23, 0x39,
+  0x2a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x33, 0x66, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x4c, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7f, 0xff, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x7d, 0x46, 0x46,
+  0x46, 0x2b, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0x00, 0x00, 0x80, 0xff, 0x7c,
+  0x45, 0x45, 0x45, 0x2a, 0x00, 0x00, 0x80, 0xff, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0xff, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x80, 0xff, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xff, 0x4e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x62, 0xff, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0xf8, 0xf2, 0x99,
+  0x82, 0x80, 0x80, 0x3f, 0x00, 0x00, 0x51, 0xd1, 0xf6, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0x0a, 0x0a, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x17, 0x41, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x41, 0x18, 0x00, 0x5c, 0xff, 0x6b, 0x00, 0x00,
+  0x00, 0x00, 0x6e, 0xff, 0x60, 0x00, 0x5c, 0xff, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x70, 0xff, 0x61,
+  0x00, 0x5c, 0xff, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x71, 0xff, 0x63, 0x00, 0x5c, 0xff, 0x6b, 0x00,
+  0x00, 0x00, 0x00, 0x74, 0xff, 0x64, 0x00, 0x5c, 0xff, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x77, 0xff,
+  0x64, 0x00, 0x5c, 0xff, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xff, 0x64, 0x00, 0x3e, 0xff, 0x8a,
+  0x00, 0x00, 0x00, 0x00, 0x8d, 0xff, 0x64, 0x00, 0x04, 0xef, 0xd5, 0x00, 0x00, 0x00, 0x07, 0xdb,
+  0xff, 0x64, 0x00, 0x00, 0xaa, 0xff, 0xb2, 0x53, 0x57, 0xc8, 0xfd, 0xff, 0x64, 0x00, 0x00, 0x26,
+  0x96, 0xef, 0xff, 0xff, 0xdf, 0x72, 0xff, 0x64, 0x00, 0x00, 0x00, 0x00, 0x09, 0x3e, 0x1e, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x44, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x45, 0x01, 0x00, 0x00, 0xbb, 0xfd, 0x20,
+  0x00, 0x00, 0x00, 0x00, 0x1a, 0xfc, 0xc2, 0x00, 0x00, 0x00, 0x5b, 0xff, 0x7d, 0x00, 0x00, 0x00,
+  0x00, 0x75, 0xff, 0x62, 0x00, 0x00, 0x00, 0x0a, 0xf0, 0xda, 0x01, 0x00, 0x00, 0x00, 0xd3, 0xf3,
+  0x0d, 0x00, 0x00, 0x00, 0x00, 0x99, 0xff, 0x3b, 0x00, 0x00, 0x33, 0xff, 0xa0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x38, 0xff, 0x99, 0x00, 0x00, 0x91, 0xff, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xd6, 0xef, 0x08, 0x05, 0xea, 0xdf, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xff, 0x55,
+  0x4d, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xfb, 0xb3, 0xab, 0xfe, 0x22,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0xfb, 0xf8, 0xbf, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xff, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x38, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x45, 0x01, 0x00, 0xce, 0xf1, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xe8, 0xd6, 0x00, 0x00, 0x8e, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1d, 0xff, 0x97, 0x00, 0x00, 0x4d, 0xff, 0x6a, 0x00, 0x04, 0x58, 0x58, 0x04, 0x00, 0x51, 0xff,
+  0x57, 0x00, 0x00, 0x10, 0xfc, 0xa3, 0x00, 0x3b, 0xff, 0xff, 0x41, 0x00, 0x86, 0xff, 0x19, 0x00,
+  0x00, 0x00, 0xcd, 0xdb, 0x00, 0x81, 0xf1, 0xec, 0x91, 0x00, 0xbb, 0xd8, 0x00, 0x00, 0x00, 0x00,
+  0x8e, 0xff, 0x16, 0xc8, 0xaa, 0x9f, 0xe2, 0x02, 0xef, 0x99, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xff,
+  0x62, 0xfc, 0x5d, 0x51, 0xff, 0x5b, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x12, 0xfd, 0xdc, 0xfb,
+  0x12, 0x0b, 0xf7, 0xdc, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xff, 0xbf, 0x00, 0x00,
+  0xb4, 0xff, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xff, 0x6f, 0x00, 0x00, 0x66, 0xff,
+  0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x36, 0x46, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x46, 0x38, 0x00, 0x00,
+  0x00, 0x45, 0xfc, 0xb7, 0x02, 0x00, 0x00, 0x01, 0xb3, 0xfe, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x77,
+  0xff, 0x81, 0x00, 0x00, 0x79, 0xff, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xa7, 0xfd, 0x4c,
+  0x44, 0xfc, 0xb3, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xd1, 0xee, 0xea, 0xd8, 0x0f,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xff, 0xff, 0x36, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xfe, 0xfd, 0xaf, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x72, 0xff, 0x89, 0x7f, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xfb, 0xbf,
+  0x04, 0x02, 0xb4, 0xfd, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x22, 0xed, 0xe5, 0x17, 0x00, 0x00, 0x11,
+  0xde, 0xf0, 0x27, 0x00, 0x00, 0x0b, 0xd0, 0xf9, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x32, 0xf7, 0xd7,
+  0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c,
+  0x4a, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x47, 0x20, 0x00, 0x9d, 0xff, 0x2f, 0x00, 0x00, 0x00,
+  0x00, 0x5f, 0xff, 0x6e, 0x00, 0xa0, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xff, 0x6e, 0x00,
+  0xa1, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x59, 0xff, 0x71, 0x00, 0xa1, 0xff, 0x2f, 0x00, 0x00,
+  0x00, 0x00, 0x59, 0xff, 0x73, 0x00, 0xa1, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x59, 0xff, 0x73,
+  0x00, 0xa1, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x59, 0xff, 0x76, 0x00, 0x9b, 0xff, 0x40, 0x00,
+  0x00, 0x00, 0x00, 0x59, 0xff, 0x78, 0x00, 0x47, 0xff, 0x82, 0x00, 0x00, 0x00, 0x00, 0x59, 0xff,
+  0x78, 0x00, 0x02, 0xdb, 0xfe, 0xbc, 0x9b, 0x99, 0x99, 0xbd, 0xff, 0x78, 0x00, 0x00, 0x15, 0x6f,
+  0xce, 0xfa, 0xfa, 0xfa, 0xfc, 0xff, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58,
+  0xff, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xff, 0x4e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xc2, 0xf5, 0x0a, 0x00, 0x00, 0x69, 0x9a, 0x9c, 0x9e, 0x9e, 0xd6,
+  0xff, 0xa2, 0x00, 0x00, 0x00, 0xa8, 0xf5, 0xf5, 0xf5, 0xf5, 0xe1, 0x5e, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0x4b, 0x4b, 0x4b, 0x4b,
+  0x4b, 0x4b, 0x4b, 0x0c, 0x00, 0x00, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0x00,
+  0x00, 0x07, 0x09, 0x09, 0x09, 0x09, 0x37, 0xf5, 0xda, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0xe1, 0xee, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xca, 0xfa, 0x42, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0xab, 0xff, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86,
+  0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0xae, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x40, 0xf9, 0xc9, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xed, 0xfd,
+  0x7b, 0x63, 0x63, 0x63, 0x63, 0x63, 0x0f, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x31, 0x8d, 0xa9, 0xbb, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xfb, 0xff,
+  0xf5, 0xe6, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xff, 0x78, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xa1, 0xff, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xff,
+  0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb8, 0xff, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xec,
+  0xf2, 0x08, 0x00, 0x00, 0x00, 0x00, 0x25, 0xb6, 0xc2, 0xf0, 0xf9, 0x69, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x34, 0xff, 0xff, 0xff, 0xcd, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x10, 0x55,
+  0xfc, 0xdb, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0xff, 0x1e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0xff, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xaa, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xff, 0x32, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xff, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x52, 0xff, 0xe9, 0xa3, 0x93, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0xdf,
+  0xf9, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0b, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x24, 0x00, 0xe1, 0xcb, 0x00,
+  0xe1, 0xcb, 0x00, 0xe1, 0xcb, 0x00, 0xe1, 0xcb, 0x00, 0xe1, 0xcb, 0x00, 0xe1, 0xcb, 0x00, 0xe1,
+  0xcb, 0x00, 0xe1, 0xcb, 0x00, 0xe1, 0xcb, 0x00, 0xe1, 0xcb, 0x00, 0xe1, 0xcb, 0x00, 0xe1, 0xcb,
+  0x00, 0xe1, 0xcb, 0x00, 0xe1, 0xcb, 0x00, 0xe1, 0xcb, 0x00, 0xe1, 0xcb, 0x00, 0x69, 0x5e, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xbb, 0xaa, 0x8e, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xe6,
+  0xf1, 0xff, 0xfc, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0xff, 0x86, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xff, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1e, 0xff, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xff, 0xad,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xff, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0xeb, 0xf7, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55,
+  0xf2, 0xfc, 0xcd, 0xb8, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xc8, 0xff, 0xff, 0xff, 0x50,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xff, 0x85, 0x23, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
+  0xff, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xff, 0xae, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xff, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x21, 0xff, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xff, 0x90, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x92, 0xa1, 0xe7, 0xff, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff,
+  0xfa, 0xe1, 0x85, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x21, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xd1, 0xff,
+  0xfb, 0x81, 0x00, 0x00, 0x00, 0x2c, 0x57, 0x0a, 0x00, 0x00, 0xb3, 0xeb, 0x55, 0x87, 0xff, 0x73,
+  0x00, 0x00, 0x81, 0xff, 0x19, 0x00, 0x0d, 0xfb, 0x8d, 0x00, 0x00, 0x8b, 0xfd, 0x72, 0x3c, 0xe4,
+  0xc4, 0x00, 0x00, 0x0e, 0x6b, 0x36, 0x00, 0x00, 0x03, 0xa6, 0xff, 0xff, 0xe6, 0x24, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x38, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const app::AtlasGlyph proggy_atlas_24_glyphs[] = {
+  {14, 0, 0, 0, 0, 0}, // ' '
+  {14, 5, -18, 5, 20, 0}, // '!'
+  {14, 3, -17, 9, 8, 100}, // '"'
+  {14, 0, -17, 16, 18, 172}, // '#'
+  {14, 2, -17, 12, 19, 460}, // '$'
+  {14, 0, -17, 15, 18, 688}, // '%'
+  {14, 0, -17, 16, 19, 958}, // '&'
+  {14, 6, -17, 4, 8, 1262}, // "'"
+  {14, 3, -19, 8, 22, 1294}, // '('
+  {14, 4, -19, 8, 22, 1470}, // ')'
+  {14, 1, -15, 14, 14, 1646}, // '*'
+  {14, 0, -14, 15, 13, 1842}, // '+'
+  {14, 4, -4, 6, 10, 2037}, // ','
+  {14, 1, -10, 13, 4, 2097}, // '-'
+  {14, 5, -4, 5, 6, 2149}, // '.'
+  {14, 1, -18, 13, 21, 2179}, // '/'
+  {14, 1, -17, 13, 19, 2452}, // '0'
+  {14, 3, -17, 10, 18, 2699}, // '1'
+  {14, 1, -17, 13, 18, 2879}, // '2'
+  {14, 1, -17, 13, 19, 3113}, // '3'
+  {14, 0, -17, 15, 18, 3360}, // '4'
+  {14, 1, -17, 13, 19, 3630}, // '5'
+  {14, 1, -17, 13, 19, 3877}, // '6'
+  {14, 1, -17, 13, 18, 4124}, // '7'
+  {14, 1, -17, 13, 19, 4358}, // '8'
+  {14, 1, -17, 13, 19, 4605}, // '9'
+  {14, 5, -14, 6, 13, 4852}, // ':'
+  {14, 4, -14, 7, 17, 4930}, // ';'
+  {14, 0, -14, 15, 13, 5049}, // '<'
+  {14, 1, -12, 14, 9, 5244}, // '='
+  {14, 1, -14, 14, 13, 5370}, // '>'
+  {14, 1, -18, 13, 20, 5552}, // '?'
+  {14, 0, -18, 18, 20, 5812}, // '@'
+  {14, 0, -17, 16, 18, 6172}, // 'A'
+  {14, 1, -17, 14, 18, 6460}, // 'B'
+  {14, 1, -17, 13, 19, 6712}, // 'C'
+  {14, 1, -17, 14, 18, 6959}, // 'D'
+  {14, 2, -17, 12, 18, 7211}, // 'E'
+  {14, 2, -17, 12, 18, 7427}, // 'F'
+  {14, 1, -17, 13, 19, 7643}, // 'G'
+  {14, 1, -17, 13, 18, 7890}, // 'H'
+  {14, 2, -17, 12, 18, 8124}, // 'I'
+  {14, 1, -17, 12, 19, 8340}, // 'J'
+  {14, 1, -17, 15, 18, 8568}, // 'K'
+  {14, 2, -17, 13, 18, 8838}, // 'L'
+  {14, 0, -17, 15, 18, 9072}, // 'M'
+  {14, 1, -17, 13, 18, 9342}, // 'N'
+  {14, 1, -17, 14, 19, 9576}, // 'O'
+  {14, 2, -17, 13, 18, 9842}, // 'P'
+  {14, 1, -17, 15, 21, 10076}, // 'Q'
+  {14, 1, -17, 14, 18, 10391}, // 'R'
+  {14, 1, -17, 13, 19, 10643}, // 'S'
+  {14, 0, -17, 15, 18, 10890}, // 'T'
+  {14, 1, -17, 14, 19, 11160}, // 'U'
+  {14, 0, -17, 15, 18, 11426}, // 'V'
+  {14, 0, -17, 16, 18, 11696}, // 'W'
+  {14, 0, -17, 16, 18, 11984}, // 'X'
+  {14, 0, -17, 16, 18, 12272}, // 'Y'
+  {14, 1, -17, 14, 18, 12560}, // 'Z'
+  {14, 3, -19, 9, 23, 12812}, // '['
+  {14, 1, -18, 13, 21, 13019}, // '\\'
+  {14, 3, -19, 9, 23, 13292}, // ']'
+  {14, 1, -17, 14, 8, 13499}, // '^'
+  {14, 0, 0, 17, 4, 13611}, // '_'
+  {14, 3, -19, 8, 7, 13679}, // '`'
+  {14, 1, -13, 13, 15, 13735}, // 'a'
+  {14, 2, -18, 13, 20, 13930}, // 'b'
+  {14, 1, -13, 13, 15, 14190}, // 'c'
+  {14, 1, -18, 13, 20, 14385}, // 'd'
+  {14, 1, -13, 14, 15, 14645}, // 'e'
+  {14, 1, -18, 13, 19, 14855}, // 'f'
+  {14, 1, -13, 13, 20, 15102}, // 'g'
+  {14, 2, -18, 12, 19, 15362}, // 'h'
+  {14, 3, -18, 8, 19, 15590}, // 'i'
+  {14, 2, -18, 10, 25, 15742}, // 'j'
+  {14, 2, -18, 13, 19, 15992}, // 'k'
+  {14, 3, -17, 7, 18, 16239}, // 'l'
+  {14, 0, -13, 15, 14, 16365}, // 'm'
+  {14, 2, -13, 12, 14, 16575}, // 'n'
+  {14, 1, -13, 13, 15, 16743}, // 'o'
+  {14, 2, -13, 12, 20, 16938}, // 'p'
+  {14, 1, -13, 13, 20, 17178}, // 'q'
+  {14, 3, -13, 11, 14, 17438}, // 'r'
+  {14, 2, -13, 12, 15, 17592}, // 's'
+  {14, 3, -17, 10, 19, 17772}, // 't'
+  {14, 1, -13, 13, 15, 17962}, // 'u'
+  {14, 1, -13, 14, 14, 18157}, // 'v'
+  {14, 0, -13, 16, 14, 18353}, // 'w'
+  {14, 0, -13, 15, 14, 18577}, // 'x'
+  {14, 1, -13, 13, 20, 18787}, // 'y'
+  {14, 2, -13, 12, 14, 19047}, // 'z'
+  {14, 2, -19, 12, 23, 19215}, // '{'
+  {14, 6, -19, 4, 22, 19491}, // '|'
+  {14, 2, -19, 12, 23, 19579}, // '}'
+  {14, 0, -12, 15, 8, 19855}, // '~'
+};
+
+static const uint8_t proggy_atlas_24_coverage[] = {
+  0x0e, 0x58, 0x58, 0x2a, 0x00, 0x2a, 0xff, 0xff, 0x7c, 0x00, 0x2a, 0xff, 0xff, 0x7c, 0x00, 0x28,
+  0xff, 0xff, 0x7a, 0x00, 0x1c, 0xff, 0xff, 0x72, 0x00, 0x0f, 0xff, 0xff, 0x67, 0x00, 0x03, 0xfe,
+  0xff, 0x5c, 0x00, 0x00, 0xf4, 0xff, 0x51, 0x00, 0x00, 0xe6, 0xff, 0x47, 0x00, 0x00, 0xd8, 0xff,
+  0x3d, 0x00, 0x00, 0xcc, 0xff, 0x31, 0x00, 0x00, 0x99, 0xc9, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x39, 0x02, 0x00, 0x2f, 0xf7, 0xff, 0xa2, 0x00,
+  0x66, 0xff, 0xff, 0xe5, 0x00, 0x17, 0xd0, 0xf5, 0x6d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x6e, 0x6e, 0x00, 0x00, 0x3e, 0x6e, 0x34, 0x00, 0x0a, 0xff, 0xff,
+  0x00, 0x00, 0x8f, 0xff, 0x7a, 0x00, 0x0a, 0xff, 0xff, 0x00, 0x00, 0x8f, 0xff, 0x7a, 0x00, 0x0a,
+  0xff, 0xff, 0x00, 0x00, 0x8f, 0xff, 0x7a, 0x00, 0x0a, 0xff, 0xff, 0x00, 0x00, 0x8f, 0xff, 0x7a,
+  0x00, 0x0a, 0xff, 0xff, 0x00, 0x00, 0x8f, 0xff, 0x7a, 0x00, 0x07, 0xa9, 0xa9, 0x00, 0x00, 0x5f,
+  0xa9, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x42, 0x48, 0x00, 0x00, 0x0a, 0x4a, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x14, 0xfd, 0xcd, 0x00, 0x00, 0x50, 0xff, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x56, 0xff, 0x89, 0x00, 0x00, 0x94, 0xff, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x9b, 0xff, 0x44, 0x00, 0x00, 0xd9, 0xf9, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xdf, 0xf6, 0x09, 0x00, 0x1e, 0xff, 0xc1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xbd, 0xbd,
+  0xc0, 0xff, 0xf4, 0xbd, 0xbd, 0xd0, 0xff, 0xe4, 0xbd, 0xbd, 0x4a, 0x00, 0x00, 0x9e, 0xf7, 0xf7,
+  0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf7, 0xf7, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xaa, 0xff, 0x46, 0x10, 0x10, 0xe5, 0xf2, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0xec, 0xf2, 0x05, 0x00, 0x26, 0xff, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31,
+  0xff, 0xb3, 0x00, 0x00, 0x69, 0xff, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x5a, 0x5a, 0x9c,
+  0xff, 0x97, 0x3c, 0x3c, 0xba, 0xff, 0x7d, 0x5a, 0x5a, 0x05, 0x00, 0x00, 0xf9, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x4e, 0x50, 0x59, 0xfe,
+  0xe1, 0x50, 0x50, 0x82, 0xff, 0xb7, 0x50, 0x50, 0x50, 0x04, 0x00, 0x00, 0x00, 0x00, 0x44, 0xff,
+  0x9b, 0x00, 0x00, 0x82, 0xff, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xff,
+  0x57, 0x00, 0x00, 0xc6, 0xfe, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xfd,
+  0x15, 0x00, 0x0f, 0xfb, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xdf, 0xb9,
+  0x00, 0x00, 0x43, 0xe1, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7d, 0xeb, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x56, 0xc6, 0xff, 0xae, 0x50,
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x52, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0x00, 0x00,
+  0x3f, 0xfb, 0xf7, 0x68, 0x96, 0xff, 0x7a, 0x49, 0x8f, 0xc1, 0x00, 0x00, 0xac, 0xff, 0x84, 0x00,
+  0x87, 0xff, 0x64, 0x00, 0x00, 0x03, 0x00, 0x00, 0xd0, 0xff, 0x48, 0x00, 0x87, 0xff, 0x64, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0x9a, 0x00, 0x87, 0xff, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x32, 0xf8, 0xff, 0xc0, 0xc0, 0xff, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xdd, 0xff,
+  0xff, 0xff, 0xff, 0xd6, 0x7f, 0x08, 0x00, 0x00, 0x00, 0x00, 0x03, 0x3e, 0xb8, 0xff, 0xdc, 0xe8,
+  0xff, 0xd1, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0x64, 0x03, 0x85, 0xff, 0x95, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0x64, 0x00, 0x0c, 0xfd, 0xda, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x87, 0xff, 0x64, 0x00, 0x16, 0xff, 0xd8, 0x00, 0x95, 0x38, 0x00, 0x00, 0x87, 0xff, 0x64, 0x00,
+  0x84, 0xff, 0x90, 0x00, 0xdd, 0xff, 0xda, 0x96, 0xc2, 0xff, 0xb8, 0xc7, 0xff, 0xd0, 0x0b, 0x00,
+  0x33, 0x89, 0xc8, 0xf4, 0xff, 0xff, 0xfe, 0xda, 0x7c, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x86, 0xff, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x72, 0x2c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x07, 0x00, 0x00, 0x00,
+  0x48, 0xd3, 0xfd, 0xe4, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xff, 0x9f, 0x00, 0x00, 0x28, 0xf8,
+  0xe6, 0x94, 0xcf, 0xff, 0x66, 0x00, 0x00, 0x34, 0xfd, 0xef, 0x17, 0x00, 0x00, 0x7b, 0xff, 0x35,
+  0x00, 0x09, 0xe9, 0xc6, 0x00, 0x02, 0xc8, 0xff, 0x6f, 0x00, 0x00, 0x00, 0x74, 0xff, 0x36, 0x00,
+  0x09, 0xe6, 0xbd, 0x00, 0x62, 0xff, 0xd4, 0x04, 0x00, 0x00, 0x00, 0x21, 0xf2, 0xe4, 0x90, 0xcd,
+  0xff, 0x5d, 0x10, 0xe9, 0xff, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xc6, 0xf6, 0xde, 0x69,
+  0x00, 0x91, 0xff, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d,
+  0xfb, 0xf5, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff,
+  0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xff, 0xdd, 0x08,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xe3, 0xff, 0x4e, 0x00, 0x2d,
+  0x63, 0x53, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xff, 0xb6, 0x00, 0x82, 0xfe, 0xff,
+  0xff, 0xe1, 0x26, 0x00, 0x00, 0x00, 0x00, 0x24, 0xf8, 0xf9, 0x26, 0x30, 0xff, 0xba, 0x2e, 0x5f,
+  0xf9, 0xbd, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xff, 0x89, 0x00, 0x5f, 0xff, 0x3d, 0x00, 0x00, 0xb7,
+  0xef, 0x00, 0x00, 0x00, 0x4a, 0xff, 0xe5, 0x0d, 0x00, 0x3b, 0xff, 0x94, 0x02, 0x2a, 0xed, 0xc4,
+  0x00, 0x00, 0x07, 0xda, 0xff, 0x5c, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xf4, 0xfe, 0xf5, 0x38, 0x00,
+  0x00, 0x34, 0x93, 0x83, 0x01, 0x00, 0x00, 0x00, 0x02, 0x52, 0x90, 0x7e, 0x21, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x31, 0xa5, 0xd8, 0xd6, 0x98, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x43, 0xf3, 0xff, 0xe3, 0xe4, 0xff, 0xe6, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xc7, 0xff, 0x7c, 0x03, 0x04, 0xd2, 0xff, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,
+  0xfa, 0xff, 0x10, 0x00, 0x00, 0x8c, 0xff, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0xe2, 0xff, 0x62, 0x00, 0x0b, 0xec, 0xf9, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x70, 0xff, 0xf3, 0x63, 0xce, 0xff, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x81, 0xff, 0xff, 0xfd, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0xab, 0xff, 0xff, 0xdc, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0xb4, 0xff, 0x9f, 0xcb, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x50, 0x5e, 0x05, 0x00, 0x00, 0x73,
+  0xff, 0x95, 0x00, 0x20, 0xed, 0xff, 0x66, 0x00, 0x00, 0x00, 0xd6, 0xff, 0x04, 0x00, 0x02, 0xdd,
+  0xf1, 0x0b, 0x00, 0x00, 0x4c, 0xfd, 0xf8, 0x36, 0x00, 0x00, 0xdd, 0xf5, 0x00, 0x00, 0x3f, 0xff,
+  0xc8, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xff, 0xe2, 0x15, 0x08, 0xf7, 0xcb, 0x00, 0x00, 0x46, 0xff,
+  0xdf, 0x00, 0x00, 0x00, 0x00, 0x02, 0xb4, 0xff, 0xbd, 0x5f, 0xff, 0x84, 0x00, 0x00, 0x13, 0xfe,
+  0xfe, 0x31, 0x00, 0x00, 0x00, 0x00, 0x10, 0xdc, 0xff, 0xfb, 0xed, 0x16, 0x00, 0x00, 0x00, 0xaf,
+  0xff, 0xd5, 0x19, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x11,
+  0xda, 0xff, 0xf2, 0x9a, 0x66, 0x71, 0xb5, 0xfd, 0xf3, 0xfe, 0xf2, 0x2a, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x87, 0xf6, 0xff, 0xff, 0xff, 0xf6, 0x93, 0x15, 0x7e, 0xff, 0xd8, 0x0e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x28, 0x46, 0x25, 0x03, 0x00, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x7a,
+  0x2f, 0x00, 0xc3, 0xff, 0x64, 0x00, 0xc3, 0xff, 0x64, 0x00, 0xc3, 0xff, 0x64, 0x00, 0xc3, 0xff,
+  0x64, 0x00, 0xc3, 0xff, 0x64, 0x00, 0x7d, 0xa3, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1a, 0x2a, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x13, 0xea, 0xe1, 0x0a, 0x00, 0x00, 0x00,
+  0x00, 0x99, 0xff, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfc, 0xe0, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x9f, 0xff, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x11, 0xf6, 0xfe, 0x20, 0x00, 0x00, 0x00, 0x00, 0x58,
+  0xff, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0xff, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7,
+  0xff, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xff, 0x53, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff,
+  0xff, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x04, 0xfd, 0xff, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xeb,
+  0xff, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0xff, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a,
+  0xff, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0xe2, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xff, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x12, 0xed, 0xff, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xff, 0xa6, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xc3, 0xe7, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x48,
+  0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xfa, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33,
+  0xfe, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4f, 0xff, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xef, 0xfe, 0x2c, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xb1, 0xff, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x45, 0xff, 0xf7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0xff, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x20, 0xff, 0xff, 0x25, 0x00, 0x00, 0x00, 0x00, 0x21, 0xff, 0xff, 0x1b, 0x00, 0x00, 0x00,
+  0x00, 0x33, 0xff, 0xfe, 0x06, 0x00, 0x00, 0x00, 0x00, 0x55, 0xff, 0xe1, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8b, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xff, 0x5b, 0x00, 0x00, 0x00, 0x00,
+  0x28, 0xff, 0xed, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0x89, 0x00, 0x00, 0x00, 0x00, 0x0c,
+  0xea, 0xf3, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xff, 0x76, 0x00, 0x00, 0x00, 0x00, 0x09, 0xc0,
+  0xb7, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4b, 0x58, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xdb, 0xff, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xdb,
+  0xff, 0x2e, 0x00, 0x00, 0x01, 0x0e, 0x00, 0x00, 0x56, 0xea, 0x6d, 0x06, 0x00, 0xdb, 0xff, 0x2e,
+  0x00, 0x3f, 0xc7, 0xbf, 0x01, 0x00, 0x8e, 0xfd, 0xff, 0xdb, 0x55, 0xdc, 0xff, 0x59, 0xb4, 0xff,
+  0xff, 0xd8, 0x1d, 0x00, 0x00, 0x32, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x68, 0x04,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xfd, 0xff, 0xff, 0xff, 0xaa, 0x0c, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0x73, 0xed, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xa3, 0x1f, 0x00, 0x00, 0x00, 0x56, 0xdf,
+  0xff, 0xfd, 0xa3, 0xe7, 0xff, 0x9a, 0xee, 0xff, 0xf7, 0x87, 0x0c, 0x00, 0x8a, 0xff, 0xb2, 0x2e,
+  0x00, 0xdb, 0xff, 0x2e, 0x11, 0x8a, 0xf7, 0xe3, 0x0e, 0x00, 0x0a, 0x38, 0x00, 0x00, 0x00, 0xdb,
+  0xff, 0x2e, 0x00, 0x00, 0x1f, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xff, 0x2e,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0xe3, 0x29, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xfd, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xff, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xff, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xff, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18,
+  0x18, 0x18, 0x18, 0x18, 0xd4, 0xff, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x0a, 0x00, 0x0a, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x00, 0x08, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xf5, 0xff, 0xd0, 0xc7, 0xc7, 0xc7, 0xc7, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xcf, 0xff, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xcf, 0xff, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf,
+  0xff, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xff,
+  0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xa7, 0x1a,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x41, 0x03, 0x00, 0x00, 0x35, 0xfa, 0xff, 0xa4,
+  0x00, 0x00, 0x68, 0xff, 0xff, 0xe9, 0x00, 0x00, 0x1a, 0xd7, 0xff, 0xd5, 0x00, 0x00, 0x00, 0x4d,
+  0xff, 0x86, 0x00, 0x00, 0x0f, 0xd8, 0xeb, 0x16, 0x00, 0x0a, 0xc6, 0xfa, 0x48, 0x00, 0x00, 0x01,
+  0xab, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x1e, 0x0f, 0x00, 0x0e, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x84, 0x00, 0x0b, 0xc7, 0xc7, 0xc7, 0xc7,
+  0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0xc7, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x3f, 0x03, 0x00, 0x2f, 0xf7, 0xff, 0xa6, 0x00, 0x66,
+  0xff, 0xff, 0xe7, 0x00, 0x17, 0xd0, 0xf5, 0x6f, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x64, 0x56, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xff, 0x84, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xff, 0xf2, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xb3, 0xff, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xfe,
+  0xf2, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0xff, 0x87, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xfe, 0xf3, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb1, 0xff, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x32, 0xfe, 0xf3, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xff, 0x89,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xfe, 0xf4, 0x15, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x2f, 0xfe, 0xf4, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad,
+  0xff, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xfe, 0xf5, 0x17, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0xff, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2d, 0xfd, 0xf5, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xaa, 0xff, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xfd, 0xf6,
+  0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x20, 0x19, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x61, 0x99, 0xaf, 0x7a, 0x3a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x26, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x79, 0x00, 0x00, 0x00, 0x00, 0x12,
+  0xe9, 0xff, 0xca, 0x62, 0x47, 0x8f, 0xfe, 0xff, 0x78, 0x00, 0x00, 0x00, 0x70, 0xff, 0xd9, 0x11,
+  0x00, 0x00, 0x00, 0x81, 0xff, 0xf3, 0x12, 0x00, 0x01, 0xd6, 0xff, 0x57, 0x00, 0x00, 0x00, 0x01,
+  0xad, 0xff, 0xff, 0x5f, 0x00, 0x1d, 0xff, 0xfd, 0x11, 0x00, 0x00, 0x00, 0x7e, 0xff, 0xff, 0xff,
+  0x9b, 0x00, 0x36, 0xff, 0xe2, 0x00, 0x00, 0x00, 0x4e, 0xfd, 0xff, 0xc7, 0xff, 0xc0, 0x00, 0x4e,
+  0xff, 0xc6, 0x00, 0x00, 0x29, 0xf1, 0xff, 0xa3, 0x45, 0xff, 0xd4, 0x00, 0x65, 0xff, 0xbd, 0x00,
+  0x0f, 0xd9, 0xff, 0xcd, 0x09, 0x3a, 0xff, 0xdf, 0x00, 0x5c, 0xff, 0xbf, 0x02, 0xb4, 0xff, 0xea,
+  0x1e, 0x00, 0x3f, 0xff, 0xdb, 0x00, 0x44, 0xff, 0xd2, 0x83, 0xff, 0xfa, 0x3f, 0x00, 0x00, 0x4e,
+  0xff, 0xce, 0x00, 0x2c, 0xff, 0xfb, 0xfe, 0xff, 0x67, 0x00, 0x00, 0x00, 0x6f, 0xff, 0xb1, 0x00,
+  0x0e, 0xf9, 0xff, 0xff, 0x95, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xff, 0x87, 0x00, 0x00, 0xaa, 0xff,
+  0xdd, 0x05, 0x00, 0x00, 0x00, 0x1a, 0xf6, 0xff, 0x3e, 0x00, 0x00, 0x43, 0xff, 0xff, 0x6c, 0x01,
+  0x00, 0x0e, 0xca, 0xff, 0xcd, 0x02, 0x00, 0x00, 0x01, 0x9b, 0xff, 0xff, 0xe6, 0xc3, 0xf8, 0xff,
+  0xe5, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x82, 0xec, 0xff, 0xff, 0xfb, 0xc4, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x26, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x5d, 0x6e,
+  0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xbb, 0xff, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x42,
+  0xe7, 0xff, 0xff, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x00, 0xe6, 0xff, 0xcf, 0xa7, 0xff, 0x9f, 0x00,
+  0x00, 0x00, 0x00, 0xe4, 0xa5, 0x0a, 0x87, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00,
+  0x87, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0x9f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xff,
+  0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x87, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0x9f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x87, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0x9f, 0x00, 0x00, 0x00,
+  0x00, 0xd5, 0xeb, 0xeb, 0xf6, 0xff, 0xf8, 0xeb, 0xeb, 0xe0, 0x00, 0xe7, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0d, 0x61, 0x9b, 0xb2, 0xb2, 0x84, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x08, 0x87, 0xf0, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x9c, 0x05, 0x00, 0x00, 0x1e, 0xff, 0xf6, 0x9f, 0x60, 0x2b, 0x3f,
+  0xa1, 0xfe, 0xff, 0x95, 0x00, 0x00, 0x16, 0x89, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xff,
+  0xfb, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xff, 0xff, 0x3f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xff, 0xff, 0x36, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xff, 0xf0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x14, 0xe8, 0xff, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xbb, 0xff,
+  0xc5, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xa1, 0xff, 0xd6, 0x14, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9b, 0xff, 0xdf, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x95, 0xff, 0xe2, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x91, 0xff,
+  0xdd, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x91, 0xff, 0xd6, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0xff, 0xd7, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x30, 0xff, 0xff, 0xf3, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xeb, 0xa5, 0x00, 0x38,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x4f, 0x82, 0xaa, 0xbd, 0xb3,
+  0x8c, 0x44, 0x02, 0x00, 0x00, 0x00, 0x00, 0xb9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7,
+  0x11, 0x00, 0x00, 0x00, 0xa4, 0x9d, 0x62, 0x39, 0x24, 0x35, 0x75, 0xef, 0xff, 0xb6, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xff, 0xff, 0x23, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xfe, 0xff, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x25, 0xff, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xc0,
+  0xff, 0xd4, 0x04, 0x00, 0x00, 0x00, 0x00, 0x27, 0xb3, 0xb6, 0xce, 0xf9, 0xfb, 0xac, 0x16, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x38, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0x20, 0x23, 0x3f, 0x82, 0xf1, 0xff, 0x94, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x34, 0xf7, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xb4, 0xff, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xff,
+  0xc1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xd1, 0xff, 0x96, 0x00, 0x2a,
+  0x67, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x08, 0x8d, 0xff, 0xff, 0x4f, 0x00, 0x3e, 0xff, 0xf8, 0xc2,
+  0x9c, 0x96, 0xb0, 0xe7, 0xff, 0xff, 0x95, 0x00, 0x00, 0x20, 0xb7, 0xf3, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xe1, 0x6f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x04, 0x29, 0x43, 0x4d, 0x42, 0x24, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x6e, 0x6e, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xf1, 0xff, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb4, 0xff, 0xf0, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x5a, 0xff, 0xfd, 0x63, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0xea, 0xff, 0x91, 0x24, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6,
+  0xff, 0xdc, 0x0b, 0x24, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0xff, 0xfe,
+  0x41, 0x00, 0x24, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe3, 0xff, 0x9a, 0x00,
+  0x00, 0x24, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0xff, 0xe6, 0x10, 0x00, 0x00,
+  0x24, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xfe, 0xff, 0x54, 0x00, 0x00, 0x00, 0x24,
+  0xff, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd8, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x24, 0xff,
+  0xb5, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0xcf, 0xbd, 0xbd, 0xbd, 0xbd, 0xc7, 0xff, 0xec,
+  0xbd, 0xbd, 0x5f, 0x00, 0x10, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x7f, 0x00, 0x01, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x73, 0xff, 0xbc, 0x16, 0x16,
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xff, 0xb5, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+  0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x3f, 0x00, 0x00, 0x00, 0x95, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x93, 0x00, 0x00, 0x00, 0x95, 0xff, 0xc3, 0x6c, 0x6c, 0x6c, 0x6c,
+  0x6c, 0x6c, 0x3e, 0x00, 0x00, 0x00, 0x95, 0xff, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x95, 0xff, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x95, 0xff, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xff, 0xd6,
+  0xc5, 0xdb, 0xcb, 0x9c, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xae, 0x06, 0x00, 0x00, 0x00, 0x68, 0x65, 0x22, 0x06, 0x0a, 0x32, 0x9a, 0xfe, 0xff,
+  0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xff, 0xfc, 0x21, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xf9, 0xff, 0x54, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xf6, 0xff, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43,
+  0xff, 0xff, 0x37, 0x00, 0x2e, 0x48, 0x03, 0x00, 0x00, 0x00, 0x00, 0x34, 0xe0, 0xff, 0xc8, 0x04,
+  0x00, 0x50, 0xff, 0xeb, 0xb3, 0x97, 0xa2, 0xc5, 0xfd, 0xff, 0xf1, 0x25, 0x00, 0x00, 0x36, 0xe1,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xab, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x38, 0x4a,
+  0x48, 0x35, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x4d, 0x76, 0x75, 0x4c, 0x10,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xb2, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0x00, 0x00, 0x00,
+  0x00, 0x3c, 0xe9, 0xff, 0xd3, 0x7e, 0x4e, 0x58, 0x92, 0x8f, 0x00, 0x00, 0x00, 0x08, 0xdc, 0xff,
+  0x98, 0x07, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xc1, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf1, 0xff, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x17, 0xff, 0xfd, 0x08, 0x5a, 0xb8, 0xd6, 0xbb, 0x8d, 0x1e, 0x00, 0x00, 0x00,
+  0x39, 0xff, 0xe0, 0x95, 0xff, 0xf9, 0xe6, 0xfa, 0xff, 0xf0, 0x51, 0x00, 0x00, 0x5b, 0xff, 0xf4,
+  0xfe, 0x7b, 0x09, 0x00, 0x0e, 0x99, 0xff, 0xef, 0x16, 0x00, 0x69, 0xff, 0xff, 0xa2, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0xe1, 0xff, 0x87, 0x00, 0x60, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x95, 0xff, 0xb5, 0x00, 0x45, 0xff, 0xff, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xff, 0xd8,
+  0x00, 0x1c, 0xff, 0xff, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xff, 0xc5, 0x00, 0x00, 0xd3,
+  0xff, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0x9f, 0x00, 0x00, 0x68, 0xff, 0xec, 0x27,
+  0x00, 0x00, 0x00, 0x52, 0xff, 0xff, 0x46, 0x00, 0x00, 0x04, 0xbe, 0xff, 0xf4, 0xa2, 0x8e, 0xb8,
+  0xfe, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x91, 0xf2, 0xff, 0xff, 0xff, 0xe7, 0x6b, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x29, 0x33, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x6e, 0x6e, 0x6e,
+  0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x48, 0x00, 0x5c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x9a, 0x00, 0x27, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x7c, 0xff,
+  0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xff, 0xd6, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xd7, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x43, 0xff, 0xf6, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xae, 0xff, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xfc, 0xff,
+  0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x86, 0xff, 0xd0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xea, 0xff, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x5e, 0xff, 0xf3, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xca, 0xff, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0xff, 0xff, 0x33,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0xff, 0xcc, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xf7, 0xff, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x76, 0xff, 0xf1, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xde,
+  0xff, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x8a, 0xb3, 0xb6, 0x94, 0x61, 0x06,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0xa9, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xe1, 0x33, 0x00, 0x00,
+  0x00, 0x7d, 0xff, 0xf9, 0x6a, 0x12, 0x06, 0x34, 0xca, 0xff, 0xdf, 0x0e, 0x00, 0x00, 0xdb, 0xff,
+  0x8e, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xfe, 0xff, 0x4d, 0x00, 0x07, 0xfe, 0xff, 0x56, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xe6, 0xff, 0x79, 0x00, 0x00, 0xe8, 0xff, 0x69, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0xf6, 0xff, 0x62, 0x00, 0x00, 0x76, 0xff, 0xd5, 0x10, 0x00, 0x00, 0x00, 0x76, 0xff, 0xf6, 0x15,
+  0x00, 0x00, 0x02, 0x99, 0xff, 0xec, 0xa8, 0x9a, 0xc8, 0xff, 0xe9, 0x49, 0x00, 0x00, 0x00, 0x00,
+  0x3d, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x79, 0x12, 0x00, 0x00, 0x00, 0x51, 0xfc, 0xfc, 0x99,
+  0x4d, 0x3e, 0x6a, 0xe0, 0xff, 0xd6, 0x15, 0x00, 0x0b, 0xe7, 0xff, 0x77, 0x00, 0x00, 0x00, 0x00,
+  0x12, 0xe9, 0xff, 0x83, 0x00, 0x4b, 0xff, 0xfe, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0xff,
+  0xc8, 0x00, 0x69, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xff, 0xe2, 0x00, 0x48,
+  0xff, 0xff, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa9, 0xff, 0xd1, 0x00, 0x15, 0xf6, 0xff, 0xa8,
+  0x04, 0x00, 0x00, 0x00, 0x37, 0xfa, 0xff, 0x8b, 0x00, 0x00, 0x64, 0xff, 0xff, 0xd4, 0x87, 0x75,
+  0xa5, 0xfb, 0xff, 0xd9, 0x12, 0x00, 0x00, 0x00, 0x51, 0xd2, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x86,
+  0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x37, 0x43, 0x23, 0x06, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x43, 0x85, 0xae, 0xb4, 0x91, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xa9, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x95, 0x01, 0x00, 0x00, 0x00, 0xab, 0xff, 0xe9, 0x52, 0x0d, 0x0f, 0x5b, 0xf0,
+  0xff, 0x76, 0x00, 0x00, 0x24, 0xfe, 0xff, 0x59, 0x00, 0x00, 0x00, 0x00, 0x62, 0xff, 0xf0, 0x0e,
+  0x00, 0x63, 0xff, 0xf7, 0x02, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf4, 0xff, 0x53, 0x00, 0x7e, 0xff,
+  0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xff, 0x8b, 0x00, 0x6d, 0xff, 0xe3, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xdc, 0xff, 0xb1, 0x00, 0x47, 0xff, 0xfc, 0x0f, 0x00, 0x00, 0x00, 0x00,
+  0x11, 0xfa, 0xff, 0xc4, 0x00, 0x10, 0xec, 0xff, 0x84, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xff,
+  0xcd, 0x00, 0x00, 0x68, 0xff, 0xff, 0xa2, 0x5e, 0x59, 0xa8, 0xff, 0xda, 0xff, 0xc1, 0x00, 0x00,
+  0x01, 0x68, 0xf2, 0xff, 0xff, 0xff, 0xfb, 0x8c, 0x99, 0xff, 0xac, 0x00, 0x00, 0x00, 0x00, 0x12,
+  0x41, 0x67, 0x5b, 0x1c, 0x00, 0xc6, 0xff, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x29, 0xfd, 0xff, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xff,
+  0xd0, 0x00, 0x00, 0x00, 0x06, 0x01, 0x00, 0x00, 0x00, 0x03, 0x93, 0xff, 0xfe, 0x44, 0x00, 0x00,
+  0x00, 0x3c, 0xe1, 0xa4, 0x95, 0xae, 0xeb, 0xff, 0xfa, 0x68, 0x00, 0x00, 0x00, 0x00, 0x2b, 0xda,
+  0xfe, 0xff, 0xff, 0xed, 0xb3, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x1d, 0x21,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x7e, 0x20, 0x00, 0x00, 0x35, 0xfe, 0xff, 0xdb, 0x00, 0x00,
+  0x49, 0xff, 0xff, 0xf0, 0x01, 0x00, 0x02, 0x87, 0xba, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0xaa, 0xda, 0x60, 0x00, 0x00, 0x57, 0xff, 0xff, 0xf1, 0x00, 0x00,
+  0x2d, 0xfc, 0xff, 0xc4, 0x00, 0x00, 0x00, 0x32, 0x5b, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4c, 0x7e, 0x20, 0x00, 0x00, 0x00, 0x35, 0xfe, 0xff, 0xdb, 0x00, 0x00,
+  0x00, 0x49, 0xff, 0xff, 0xf0, 0x01, 0x00, 0x00, 0x02, 0x87, 0xba, 0x48, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xad, 0xe0, 0x66, 0x00,
+  0x00, 0x00, 0x4f, 0xff, 0xff, 0xf7, 0x02, 0x00, 0x00, 0x29, 0xfb, 0xff, 0xf9, 0x01, 0x00, 0x00,
+  0x00, 0x4b, 0xff, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0x52, 0x00, 0x00, 0x00, 0x5b, 0xfd,
+  0xa8, 0x00, 0x00, 0x00, 0x03, 0xd9, 0xbc, 0x09, 0x00, 0x00, 0x00, 0x00, 0x20, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x17, 0x72, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x53, 0xb2, 0xfb, 0xff, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x94, 0xec,
+  0xff, 0xff, 0xe6, 0x8e, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x76, 0xd5, 0xff, 0xff, 0xf0, 0x9e,
+  0x44, 0x03, 0x00, 0x00, 0x00, 0x01, 0x57, 0xb6, 0xfc, 0xff, 0xf9, 0xb0, 0x55, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xff, 0xdd, 0x66, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0xe0, 0xff, 0xff, 0xd2, 0x7a, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0x42, 0xa1, 0xf3, 0xff, 0xfe, 0xc5, 0x6b, 0x16, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x5f, 0xbe, 0xfd, 0xff, 0xfb, 0xb7, 0x5e, 0x0e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x7c, 0xda, 0xff, 0xff, 0xf7, 0x44, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x3a, 0x99, 0xef, 0x56, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x13, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xbd, 0xbd, 0xbd,
+  0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0xbd, 0x51, 0x00, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x00, 0x20, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+  0x22, 0x22, 0x22, 0x22, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xa9, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x4d, 0x00,
+  0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0x00, 0x2f, 0x32,
+  0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x2a, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xff, 0xc9, 0x6a, 0x12, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xcc, 0xff, 0xff, 0xf8, 0xab, 0x4c, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x81, 0xdb, 0xff, 0xff, 0xe7, 0x8d, 0x2d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x39, 0x94, 0xeb, 0xff, 0xff, 0xcd, 0x6e, 0x12, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x4b, 0xb1, 0xff, 0xff, 0x68, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x51, 0xa9, 0xf5, 0xff, 0xfa, 0x54, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x3f, 0x9a, 0xef, 0xff, 0xff, 0xcf, 0x71, 0x17, 0x00, 0x00, 0x00, 0x2f, 0x88, 0xe1, 0xff, 0xff,
+  0xe8, 0x8e, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0xff, 0xff, 0xf8, 0xab, 0x4c, 0x04, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xc8, 0x69, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2c, 0x1d, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x51, 0x9f, 0xe8, 0xff, 0xff, 0xf8, 0x9f, 0x23, 0x00, 0x00, 0x00, 0x01, 0x91, 0xff, 0xff, 0xe0,
+  0xa0, 0xb0, 0xf3, 0xff, 0xe6, 0x1f, 0x00, 0x02, 0x98, 0xff, 0xea, 0x40, 0x01, 0x00, 0x00, 0x0e,
+  0xb9, 0xff, 0x8d, 0x00, 0x00, 0x5e, 0xdb, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xff, 0xb9,
+  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xff, 0x88, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x9f, 0xff, 0xeb, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x21, 0xce, 0xff, 0xe3, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xe5, 0xff,
+  0xb6, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xff, 0xbe, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0xff, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xd0, 0xd5, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x39, 0x02, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xf7, 0xff, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x66, 0xff, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x17, 0xd0, 0xf5, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x36, 0x23, 0x04, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x6a, 0xd1, 0xff, 0xff, 0xff,
+  0xfa, 0xdb, 0xb2, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xd1, 0xff, 0xfe, 0xc3,
+  0x86, 0x79, 0x8f, 0xda, 0xff, 0xfa, 0x82, 0x06, 0x00, 0x00, 0x00, 0x00, 0x16, 0xe3, 0xff, 0xce,
+  0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xde, 0xff, 0x93, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff,
+  0xc7, 0x0a, 0x00, 0x00, 0x2f, 0x5f, 0x44, 0x03, 0x00, 0x24, 0xfb, 0xf7, 0x02, 0x00, 0x00, 0x41,
+  0xff, 0xfd, 0x2b, 0x00, 0x09, 0xa7, 0xff, 0xff, 0xff, 0xd3, 0x20, 0x06, 0xe7, 0xfd, 0x08, 0x00,
+  0x00, 0xa2, 0xff, 0xab, 0x00, 0x00, 0xac, 0xff, 0xea, 0xab, 0xe1, 0xff, 0xe8, 0xd9, 0xff, 0xc4,
+  0x00, 0x00, 0x00, 0xe5, 0xff, 0x46, 0x00, 0x3a, 0xff, 0xe9, 0x1d, 0x00, 0x0b, 0xc6, 0xff, 0xfd,
+  0xce, 0x2c, 0x00, 0x00, 0x06, 0xfe, 0xff, 0x1f, 0x00, 0x83, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x4b,
+  0xff, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x18, 0xff, 0xfe, 0x04, 0x00, 0x9e, 0xff, 0x64, 0x00, 0x00,
+  0x00, 0x29, 0xff, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x26, 0x00, 0x93, 0xff, 0x81,
+  0x00, 0x00, 0x00, 0x3f, 0xff, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf9, 0xff, 0x57, 0x00, 0x61,
+  0xff, 0xd4, 0x03, 0x00, 0x00, 0xa5, 0xff, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0x9e,
+  0x00, 0x0a, 0xe2, 0xff, 0xc2, 0x6d, 0xab, 0xff, 0xff, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64,
+  0xff, 0xfc, 0x31, 0x00, 0x31, 0xe1, 0xff, 0xff, 0xff, 0xd5, 0xe7, 0xdd, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x04, 0xd1, 0xff, 0xc5, 0x05, 0x00, 0x13, 0x6d, 0xa4, 0x7b, 0x0d, 0x3e, 0x40, 0x00, 0x19,
+  0x00, 0x00, 0x00, 0x00, 0x29, 0xf1, 0xff, 0xba, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12,
+  0x9d, 0xf8, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xeb, 0xff, 0xf0, 0x91, 0x4b, 0x2f, 0x45, 0x6b,
+  0x92, 0xe9, 0xff, 0xfc, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xa8, 0xfb, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xc7, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x5e,
+  0x94, 0xaa, 0xb3, 0x9c, 0x7a, 0x32, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0x6e, 0x6e, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x84, 0xff, 0xff, 0xf1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xd8, 0xff, 0xed, 0xff, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2d, 0xff, 0xeb, 0x7f, 0xff, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7f, 0xff, 0xa4, 0x2f, 0xff, 0xee, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xd1, 0xff, 0x58, 0x00, 0xe0, 0xff, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25,
+  0xff, 0xfa, 0x10, 0x00, 0x96, 0xff, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
+  0xff, 0xbd, 0x00, 0x00, 0x4b, 0xff, 0xea, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc,
+  0xff, 0x71, 0x00, 0x00, 0x0a, 0xf6, 0xff, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xfe,
+  0xff, 0x26, 0x00, 0x00, 0x00, 0xb3, 0xff, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xff,
+  0xe0, 0x12, 0x12, 0x12, 0x12, 0x74, 0xff, 0xe4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x39, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xfe, 0xff,
+  0xbd, 0xb5, 0xb5, 0xb5, 0xb5, 0xb5, 0xe8, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xff, 0xe7,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xff, 0xdd, 0x00, 0x00, 0x00, 0x00, 0xc2, 0xff, 0x9e,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xff, 0xff, 0x31, 0x00, 0x00, 0x19, 0xfd, 0xff, 0x52,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x85, 0x00, 0x00, 0x6a, 0xff, 0xf9, 0x0e,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xff, 0xd9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x6e, 0x6e, 0x6e,
+  0x6e, 0x6c, 0x57, 0x3b, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xeb, 0x7d, 0x02, 0x00, 0x00, 0x00, 0x26, 0xff, 0xff, 0x70, 0x60, 0x60, 0x6a, 0x8e,
+  0xeb, 0xff, 0x83, 0x00, 0x00, 0x00, 0x26, 0xff, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x25, 0xf7,
+  0xf8, 0x08, 0x00, 0x00, 0x26, 0xff, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xff, 0x37,
+  0x00, 0x00, 0x26, 0xff, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x36, 0x00, 0x00,
+  0x26, 0xff, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x01, 0x6d, 0xff, 0xde, 0x05, 0x00, 0x00, 0x26, 0xff,
+  0xff, 0xb6, 0xad, 0xad, 0xb8, 0xdc, 0xff, 0xe4, 0x38, 0x00, 0x00, 0x00, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xfc, 0x92, 0x26, 0x00, 0x00, 0x00, 0x26, 0xff, 0xff, 0x3c, 0x26, 0x26,
+  0x28, 0x40, 0x79, 0xe9, 0xf4, 0x46, 0x00, 0x00, 0x26, 0xff, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x2f, 0xf9, 0xe0, 0x08, 0x00, 0x26, 0xff, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xc8, 0xff, 0x37, 0x00, 0x26, 0xff, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xff,
+  0x50, 0x00, 0x26, 0xff, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xe4, 0xff, 0x27, 0x00,
+  0x26, 0xff, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xa7, 0xff, 0xd8, 0x02, 0x00, 0x26, 0xff,
+  0xff, 0xd8, 0xd3, 0xd3, 0xd5, 0xe9, 0xfd, 0xff, 0xec, 0x28, 0x00, 0x00, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xf6, 0xdb, 0xbf, 0x6e, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x66, 0x98, 0xb8,
+  0xb3, 0x93, 0x49, 0x03, 0x00, 0x00, 0x00, 0x00, 0x60, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x8e, 0x00, 0x00, 0x00, 0x6e, 0xfe, 0xff, 0xab, 0x4f, 0x1f, 0x22, 0x5a, 0xc5, 0x95, 0x00, 0x00,
+  0x24, 0xf7, 0xff, 0x8a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x24, 0x00, 0x00, 0x9e, 0xff, 0xe8,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe8, 0xff, 0x87, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xff, 0xff, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x54, 0xff, 0xff, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0xff, 0xff,
+  0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xff, 0xff, 0x44, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xfe, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0xff, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x57, 0xff, 0xfc, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0xd1, 0xff, 0xdb, 0x25, 0x00, 0x00, 0x00, 0x00, 0x35, 0x64, 0x00, 0x00, 0x00, 0x2d, 0xe8, 0xff,
+  0xf3, 0xba, 0x88, 0x8e, 0xca, 0xff, 0x95, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x9e, 0xf4, 0xff, 0xff,
+  0xff, 0xff, 0xd9, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x32, 0x48, 0x44, 0x21, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a,
+  0x6e, 0x6e, 0x6e, 0x6e, 0x5d, 0x38, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0x33, 0x00, 0x00, 0x00, 0x00, 0x62, 0xff, 0xfd, 0x60, 0x60,
+  0x69, 0x8b, 0xe4, 0xff, 0xfa, 0x64, 0x00, 0x00, 0x00, 0x62, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00,
+  0x0e, 0xc4, 0xff, 0xec, 0x09, 0x00, 0x00, 0x62, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31,
+  0xff, 0xff, 0x63, 0x00, 0x00, 0x62, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff,
+  0xb1, 0x00, 0x00, 0x62, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0xff, 0xcb, 0x00,
+  0x00, 0x62, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xff, 0xe5, 0x00, 0x00, 0x62,
+  0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0xff, 0xfc, 0x02, 0x00, 0x62, 0xff, 0xfb,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xff, 0xf0, 0x00, 0x00, 0x62, 0xff, 0xfb, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0xcf, 0x00, 0x00, 0x62, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xa2, 0xff, 0xae, 0x00, 0x00, 0x62, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+  0xec, 0xff, 0x7d, 0x00, 0x00, 0x62, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xff, 0xef,
+  0x11, 0x00, 0x00, 0x62, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x17, 0x87, 0xfd, 0xff, 0x7a, 0x00, 0x00,
+  0x00, 0x62, 0xff, 0xfe, 0xd3, 0xd3, 0xe9, 0xff, 0xff, 0xf8, 0x79, 0x04, 0x00, 0x00, 0x00, 0x62,
+  0xff, 0xff, 0xff, 0xff, 0xeb, 0xbe, 0x92, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x6e, 0x6e, 0x6e, 0x6e,
+  0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x57, 0x00, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xcb, 0x00, 0xcb, 0xff, 0xc0, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0x56, 0x00, 0xcb,
+  0xff, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0xff, 0x91, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0xff, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xcb, 0xff, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb,
+  0xff, 0xde, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0x92, 0x00, 0x00, 0xcb, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xcf, 0x00, 0x00, 0xcb, 0xff, 0xa4, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
+  0x24, 0x00, 0x00, 0xcb, 0xff, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb,
+  0xff, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0xff, 0x91, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb, 0xff, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xcb, 0xff, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb,
+  0xff, 0xf1, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xb7, 0x00, 0xcb, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1c, 0x70, 0x73, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x6f, 0x00, 0x42,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x00, 0x42, 0xff, 0xff, 0x5a, 0x54,
+  0x54, 0x54, 0x54, 0x54, 0x54, 0x50, 0x00, 0x42, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x42, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42,
+  0xff, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xff, 0xff, 0x0a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xff, 0xff, 0x7d, 0x78, 0x78, 0x78, 0x78, 0x60,
+  0x00, 0x00, 0x00, 0x42, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0x00, 0x00, 0x00, 0x42,
+  0xff, 0xff, 0x57, 0x50, 0x50, 0x50, 0x50, 0x40, 0x00, 0x00, 0x00, 0x42, 0xff, 0xff, 0x0a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x42, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42,
+  0xff, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xff, 0xff, 0x0a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x42, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+  0x69, 0x9c, 0xbb, 0xa4, 0x66, 0x11, 0x00, 0x00, 0x00, 0x00, 0x06, 0x91, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xf1, 0x38, 0x00, 0x00, 0x08, 0xc8, 0xff, 0xf3, 0x73, 0x39, 0x17, 0x35, 0x84, 0xf4,
+  0x54, 0x00, 0x00, 0x71, 0xff, 0xec, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x30, 0x00, 0x0c,
+  0xea, 0xff, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xfd, 0x1d,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0xff, 0xcd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xc2, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x33, 0x70, 0x70, 0x70, 0x70, 0x69, 0x00,
+  0xb6, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x74, 0xff, 0xff, 0xff, 0xff, 0xef, 0x00, 0x95, 0xff, 0xc4,
+  0x00, 0x00, 0x00, 0x2d, 0x64, 0x64, 0x94, 0xff, 0xef, 0x00, 0x73, 0xff, 0xea, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x50, 0xff, 0xef, 0x00, 0x40, 0xff, 0xff, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x50, 0xff, 0xef, 0x00, 0x00, 0xc5, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xff, 0xef,
+  0x00, 0x00, 0x44, 0xff, 0xff, 0x86, 0x01, 0x00, 0x00, 0x00, 0x57, 0xff, 0xef, 0x00, 0x00, 0x00,
+  0x88, 0xff, 0xff, 0xd8, 0xa0, 0x80, 0xa5, 0xf5, 0xff, 0xda, 0x00, 0x00, 0x00, 0x00, 0x50, 0xd1,
+  0xff, 0xff, 0xff, 0xff, 0xf0, 0x90, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3e, 0x48,
+  0x32, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x2a, 0x6e, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x6e, 0x5c, 0x00, 0x62,
+  0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xff, 0xd7, 0x00, 0x62, 0xff, 0xfb, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xff, 0xd7, 0x00, 0x62, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8b, 0xff, 0xd7, 0x00, 0x62, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b,
+  0xff, 0xd7, 0x00, 0x62, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xff, 0xd7, 0x00,
+  0x62, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xff, 0xd7, 0x00, 0x62, 0xff, 0xfe,
+  0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xb3, 0xdd, 0xff, 0xd7, 0x00, 0x62, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x00, 0x62, 0xff, 0xfc, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c, 0x2c,
+  0x9f, 0xff, 0xd7, 0x00, 0x62, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xff, 0xd7,
+  0x00, 0x62, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xff, 0xd7, 0x00, 0x62, 0xff,
+  0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xff, 0xd7, 0x00, 0x62, 0xff, 0xfb, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x8b, 0xff, 0xd7, 0x00, 0x62, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8b, 0xff, 0xd7, 0x00, 0x62, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xff,
+  0xd7, 0x00, 0x62, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xff, 0xd7, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x6e, 0x6e, 0x6e,
+  0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x08, 0x00, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x12, 0x00, 0x47, 0x6c, 0x6c, 0x6c, 0xfc, 0xff, 0xa5, 0x6c, 0x6c, 0x6c, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf9, 0xff, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf9, 0xff, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xff, 0x64, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xff, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf9, 0xff, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf9, 0xff, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xff, 0x64, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xff, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf9, 0xff, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf9, 0xff, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xff, 0x64, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xff, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x92, 0xdf, 0xdf, 0xdf, 0xfe, 0xff, 0xec, 0xdf, 0xdf, 0xdf, 0x10, 0x00, 0xa7, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x16, 0x00,
+  0x00, 0x00, 0x00, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0x00, 0x00, 0x00, 0x00, 0x45,
+  0x6c, 0x6c, 0x6c, 0x84, 0xff, 0xff, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a,
+  0xff, 0xff, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xff, 0xff, 0x34, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xff, 0xff, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x2a, 0xff, 0xff, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a,
+  0xff, 0xff, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xff, 0xff, 0x34, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xff, 0xff, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x2a, 0xff, 0xff, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b,
+  0xff, 0xff, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xff, 0xff, 0x23, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xff, 0xfd, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0xc1, 0xff, 0xc9, 0x00, 0x00, 0x56, 0x97, 0x97, 0x97, 0x98, 0xa1, 0xd9, 0xff,
+  0xff, 0x50, 0x00, 0x00, 0x91, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x5f, 0x00, 0x00, 0x00,
+  0x1f, 0x36, 0x36, 0x36, 0x36, 0x30, 0x1e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x6e, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x5d, 0x6e, 0x64, 0x03, 0x00, 0x62, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x93, 0xff, 0xf4, 0x41, 0x00, 0x00, 0x62, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x02, 0x98, 0xff,
+  0xf2, 0x3e, 0x00, 0x00, 0x00, 0x62, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x02, 0x9a, 0xff, 0xf1, 0x3b,
+  0x00, 0x00, 0x00, 0x00, 0x62, 0xff, 0xfb, 0x00, 0x00, 0x02, 0x9a, 0xff, 0xf0, 0x38, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x62, 0xff, 0xfb, 0x00, 0x02, 0x9a, 0xff, 0xee, 0x35, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x62, 0xff, 0xfb, 0x02, 0x9c, 0xff, 0xec, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x62, 0xff, 0xfc, 0x9e, 0xff, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x62, 0xff, 0xff, 0xff, 0xf4, 0xff, 0xfc, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62,
+  0xff, 0xff, 0xe7, 0x29, 0xb3, 0xff, 0xe1, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0xff,
+  0xfd, 0x28, 0x00, 0x17, 0xea, 0xff, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0xff, 0xfb,
+  0x00, 0x00, 0x00, 0x52, 0xff, 0xff, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0xff, 0xfb, 0x00,
+  0x00, 0x00, 0x00, 0xa1, 0xff, 0xf4, 0x27, 0x00, 0x00, 0x00, 0x00, 0x62, 0xff, 0xfb, 0x00, 0x00,
+  0x00, 0x00, 0x0f, 0xe0, 0xff, 0xce, 0x07, 0x00, 0x00, 0x00, 0x62, 0xff, 0xfb, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x40, 0xfd, 0xff, 0x8d, 0x00, 0x00, 0x00, 0x62, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8d, 0xff, 0xfe, 0x47, 0x00, 0x00, 0x62, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0xd4, 0xff, 0xe6, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x6e, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x78, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x78, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xff, 0xe5,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xff, 0xe5, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x78, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x78, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xff,
+  0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xff, 0xe5, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x78, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
+  0xff, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xff, 0xe5, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xff, 0xfc, 0xdf, 0xdf, 0xdf, 0xdf,
+  0xdf, 0xdf, 0xdf, 0xdf, 0x4b, 0x00, 0x78, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x6e, 0x6e, 0x6e, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0x6e, 0x6e, 0x41, 0x00, 0x1c,
+  0xff, 0xff, 0xff, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x07, 0xec, 0xff, 0xff, 0x97, 0x00, 0x1c, 0xff,
+  0xfb, 0xfb, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x59, 0xff, 0xf7, 0xff, 0x97, 0x00, 0x1c, 0xff, 0xf3,
+  0xb3, 0xff, 0x34, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xa5, 0xff, 0x97, 0x00, 0x1c, 0xff, 0xf3, 0x4f,
+  0xff, 0x98, 0x00, 0x00, 0x26, 0xfe, 0xc6, 0x78, 0xff, 0x97, 0x00, 0x1c, 0xff, 0xf3, 0x04, 0xe7,
+  0xf1, 0x0b, 0x00, 0x8a, 0xff, 0x62, 0x78, 0xff, 0x97, 0x00, 0x1c, 0xff, 0xf3, 0x00, 0x88, 0xff,
+  0x61, 0x06, 0xe9, 0xf2, 0x0c, 0x78, 0xff, 0x97, 0x00, 0x1c, 0xff, 0xf3, 0x00, 0x26, 0xfe, 0xc5,
+  0x55, 0xff, 0x9b, 0x00, 0x78, 0xff, 0x97, 0x00, 0x1c, 0xff, 0xf3, 0x00, 0x00, 0xc0, 0xff, 0xd7,
+  0xff, 0x38, 0x00, 0x78, 0xff, 0x97, 0x00, 0x1c, 0xff, 0xf3, 0x00, 0x00, 0x5a, 0xff, 0xff, 0xd4,
+  0x00, 0x00, 0x78, 0xff, 0x97, 0x00, 0x1c, 0xff, 0xf3, 0x00, 0x00, 0x08, 0xee, 0xff, 0x70, 0x00,
+  0x00, 0x78, 0xff, 0x97, 0x00, 0x1c, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x34, 0x48, 0x0d, 0x00, 0x00,
+  0x78, 0xff, 0x97, 0x00, 0x1c, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78,
+  0xff, 0x97, 0x00, 0x1c, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xff,
+  0x97, 0x00, 0x1c, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xff, 0x97,
+  0x00, 0x1c, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xff, 0x97, 0x00,
+  0x1c, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xff, 0x97, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x6e,
+  0x6e, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x6e, 0x5a, 0x00, 0x5c, 0xff, 0xff, 0xf7, 0x16,
+  0x00, 0x00, 0x00, 0x00, 0x74, 0xff, 0xd1, 0x00, 0x5c, 0xff, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00,
+  0x00, 0x74, 0xff, 0xd1, 0x00, 0x5c, 0xff, 0xf9, 0xfd, 0xe8, 0x07, 0x00, 0x00, 0x00, 0x74, 0xff,
+  0xd1, 0x00, 0x5c, 0xff, 0xe9, 0xb1, 0xff, 0x61, 0x00, 0x00, 0x00, 0x74, 0xff, 0xd1, 0x00, 0x5c,
+  0xff, 0xe9, 0x41, 0xff, 0xd1, 0x00, 0x00, 0x00, 0x74, 0xff, 0xd1, 0x00, 0x5c, 0xff, 0xe9, 0x00,
+  0xcf, 0xff, 0x42, 0x00, 0x00, 0x74, 0xff, 0xd1, 0x00, 0x5c, 0xff, 0xe9, 0x00, 0x5e, 0xff, 0xb2,
+  0x00, 0x00, 0x74, 0xff, 0xd1, 0x00, 0x5c, 0xff, 0xe9, 0x00, 0x06, 0xe6, 0xfd, 0x25, 0x00, 0x74,
+  0xff, 0xd1, 0x00, 0x5c, 0xff, 0xe9, 0x00, 0x00, 0x7c, 0xff, 0x93, 0x00, 0x74, 0xff, 0xd1, 0x00,
+  0x5c, 0xff, 0xe9, 0x00, 0x00, 0x14, 0xf6, 0xf3, 0x10, 0x74, 0xff, 0xd1, 0x00, 0x5c, 0xff, 0xe9,
+  0x00, 0x00, 0x00, 0x9a, 0xff, 0x73, 0x74, 0xff, 0xd1, 0x00, 0x5c, 0xff, 0xe9, 0x00, 0x00, 0x00,
+  0x2a, 0xfe, 0xe0, 0x78, 0xff, 0xd1, 0x00, 0x5c, 0xff, 0xe9, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xff,
+  0xcb, 0xff, 0xd1, 0x00, 0x5c, 0xff, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x47, 0xff, 0xff, 0xff, 0xd1,
+  0x00, 0x5c, 0xff, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x01, 0xd5, 0xff, 0xff, 0xd1, 0x00, 0x5c, 0xff,
+  0xe9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xff, 0xff, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x47, 0x7d, 0x9a, 0x7d,
+  0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa7,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x28, 0xef, 0xff, 0xc4, 0x5a, 0x3f, 0x84, 0xfb, 0xff, 0x9b, 0x00,
+  0x00, 0x00, 0x00, 0x98, 0xff, 0xd2, 0x0d, 0x00, 0x00, 0x00, 0x69, 0xff, 0xf9, 0x17, 0x00, 0x00,
+  0x10, 0xf4, 0xff, 0x69, 0x00, 0x00, 0x00, 0x00, 0x05, 0xef, 0xff, 0x79, 0x00, 0x00, 0x4e, 0xff,
+  0xff, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0xff, 0xc2, 0x00, 0x00, 0x68, 0xff, 0xfb, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xdb, 0x00, 0x00, 0x82, 0xff, 0xec, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x79, 0xff, 0xf3, 0x00, 0x00, 0x9b, 0xff, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x68, 0xff, 0xff, 0x0c, 0x00, 0x91, 0xff, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e,
+  0xff, 0xfd, 0x05, 0x00, 0x77, 0xff, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xe9,
+  0x00, 0x00, 0x5d, 0xff, 0xfe, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0xff, 0xd1, 0x00, 0x00,
+  0x38, 0xff, 0xff, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0xff, 0xac, 0x00, 0x00, 0x01, 0xd7,
+  0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x17, 0xfd, 0xff, 0x4d, 0x00, 0x00, 0x00, 0x6f, 0xff, 0xf8,
+  0x42, 0x00, 0x00, 0x07, 0xbd, 0xff, 0xe1, 0x03, 0x00, 0x00, 0x00, 0x09, 0xae, 0xff, 0xfb, 0xca,
+  0xb2, 0xeb, 0xff, 0xfc, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x82, 0xd9, 0xfe, 0xff, 0xfe,
+  0xcb, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x2e, 0x15, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x6c, 0x6e, 0x6e, 0x6e, 0x6e, 0x62, 0x44, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x35, 0x00, 0x00, 0x00, 0xfb, 0xff, 0x9d, 0x60,
+  0x60, 0x6e, 0x9a, 0xf5, 0xff, 0xf7, 0x39, 0x00, 0x00, 0xfb, 0xff, 0x62, 0x00, 0x00, 0x00, 0x00,
+  0x24, 0xf1, 0xff, 0xbe, 0x00, 0x00, 0xfb, 0xff, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xff,
+  0xf9, 0x02, 0x00, 0xfb, 0xff, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0xff, 0xff, 0x0b, 0x00,
+  0xfb, 0xff, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xff, 0xe5, 0x00, 0x00, 0xfb, 0xff, 0x62,
+  0x00, 0x00, 0x00, 0x00, 0x31, 0xf6, 0xff, 0xad, 0x00, 0x00, 0xfb, 0xff, 0xa6, 0x70, 0x70, 0x78,
+  0xa6, 0xf8, 0xff, 0xee, 0x1e, 0x00, 0x00, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xb1,
+  0x2e, 0x00, 0x00, 0x00, 0xfb, 0xff, 0x9f, 0x64, 0x64, 0x58, 0x3b, 0x1a, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xfb, 0xff, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xff,
+  0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xff, 0x62, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xff, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xff, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xfb, 0xff, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d,
+  0x47, 0x7d, 0x9a, 0x7d, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xde, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xa7, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xef, 0xff, 0xc4, 0x5a,
+  0x3f, 0x84, 0xfb, 0xff, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xff, 0xd2, 0x0d, 0x00, 0x00,
+  0x00, 0x69, 0xff, 0xf9, 0x17, 0x00, 0x00, 0x00, 0x10, 0xf4, 0xff, 0x69, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0xef, 0xff, 0x79, 0x00, 0x00, 0x00, 0x4e, 0xff, 0xff, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xac, 0xff, 0xc2, 0x00, 0x00, 0x00, 0x68, 0xff, 0xfb, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a,
+  0xff, 0xdb, 0x00, 0x00, 0x00, 0x82, 0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xff,
+  0xf3, 0x00, 0x00, 0x00, 0x9b, 0xff, 0xdd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0xff, 0xff,
+  0x0c, 0x00, 0x00, 0x91, 0xff, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xff, 0xfd, 0x05,
+  0x00, 0x00, 0x77, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xe9, 0x00, 0x00,
+  0x00, 0x5d, 0xff, 0xfe, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0xff, 0xd1, 0x00, 0x00, 0x00,
+  0x38, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0xff, 0xad, 0x00, 0x00, 0x00, 0x01,
+  0xd7, 0xff, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x19, 0xfd, 0xff, 0x53, 0x00, 0x00, 0x00, 0x00, 0x6f,
+  0xff, 0xf9, 0x43, 0x00, 0x00, 0x07, 0xbf, 0xff, 0xef, 0x06, 0x00, 0x00, 0x00, 0x00, 0x09, 0xae,
+  0xff, 0xfb, 0xca, 0xb2, 0xeb, 0xff, 0xff, 0xff, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x82,
+  0xd7, 0xfd, 0xff, 0xfd, 0xc6, 0x9f, 0xff, 0xfa, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0d, 0x28, 0x10, 0x00, 0x01, 0xa0, 0xff, 0xef, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0xb9, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0x46, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x6e, 0x6e, 0x6e, 0x6e, 0x6d, 0x58, 0x39, 0x0f,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x77, 0x03,
+  0x00, 0x00, 0x00, 0x50, 0xff, 0xff, 0x68, 0x60, 0x60, 0x6d, 0xae, 0xfe, 0xff, 0x7d, 0x00, 0x00,
+  0x00, 0x50, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x70, 0xff, 0xfb, 0x21, 0x00, 0x00, 0x50,
+  0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x02, 0xf3, 0xff, 0x5b, 0x00, 0x00, 0x50, 0xff, 0xff,
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0xff, 0x76, 0x00, 0x00, 0x50, 0xff, 0xff, 0x0e, 0x00,
+  0x00, 0x00, 0x00, 0x11, 0xfa, 0xff, 0x51, 0x00, 0x00, 0x50, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00,
+  0x1b, 0xb6, 0xff, 0xe1, 0x0c, 0x00, 0x00, 0x50, 0xff, 0xff, 0xcc, 0xc9, 0xcb, 0xdf, 0xfa, 0xff,
+  0xed, 0x3d, 0x00, 0x00, 0x00, 0x50, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0x1c, 0x00,
+  0x00, 0x00, 0x00, 0x50, 0xff, 0xff, 0x1d, 0x13, 0x16, 0xa4, 0xff, 0xbc, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x50, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x21, 0xfa, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x50,
+  0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x9a, 0xff, 0xca, 0x01, 0x00, 0x00, 0x00, 0x50, 0xff, 0xff,
+  0x0e, 0x00, 0x00, 0x00, 0x1f, 0xf9, 0xff, 0x53, 0x00, 0x00, 0x00, 0x50, 0xff, 0xff, 0x0e, 0x00,
+  0x00, 0x00, 0x00, 0x98, 0xff, 0xd8, 0x04, 0x00, 0x00, 0x50, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00,
+  0x00, 0x1e, 0xf9, 0xff, 0x63, 0x00, 0x00, 0x50, 0xff, 0xff, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x96, 0xff, 0xe1, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x80, 0xb0, 0xbd, 0xab, 0x88, 0x4d, 0x0d, 0x00, 0x00,
+  0x00, 0x02, 0x99, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x00, 0x00, 0x00, 0x7f, 0xff,
+  0xf3, 0x7d, 0x2f, 0x18, 0x25, 0x56, 0xaf, 0xd9, 0x00, 0x00, 0x0c, 0xfc, 0xff, 0x54, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x3d, 0xff, 0xf4, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4b, 0xff, 0xf6, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0xfd, 0xff, 0xac, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d,
+  0xff, 0xff, 0xf8, 0xba, 0x78, 0x38, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x7a, 0xef, 0xff,
+  0xff, 0xff, 0xff, 0xe6, 0x7f, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x48, 0x88, 0xc1, 0xf8,
+  0xff, 0xff, 0xc6, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x79, 0xfe, 0xff,
+  0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0xff, 0xb5, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0xff, 0xd5, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xff, 0xc0, 0x00, 0x26, 0xb5, 0x3c, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3d, 0xf7, 0xff, 0x77, 0x00, 0x26, 0xff, 0xff, 0xdc, 0xa0, 0x82, 0x8e, 0xbb, 0xfe, 0xff,
+  0xd2, 0x0b, 0x00, 0x0d, 0x8d, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x7c, 0x0e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x17, 0x3c, 0x4a, 0x3a, 0x1c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
+  0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x62, 0x00, 0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0x00, 0x2f, 0x6c, 0x6c, 0x6c, 0x6c, 0x6c, 0xf8, 0xff,
+  0xa9, 0x6c, 0x6c, 0x6c, 0x6c, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xff, 0x6a,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xff, 0x6a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xff, 0x6a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xff, 0x6a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf3, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xf3, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xf3, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xf3, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf3, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x6e, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x27, 0x6e, 0x6e, 0x01, 0x00, 0x97, 0xff, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c,
+  0xff, 0xff, 0x02, 0x00, 0x97, 0xff, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xff, 0xff,
+  0x02, 0x00, 0x97, 0xff, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xff, 0xff, 0x02, 0x00,
+  0x97, 0xff, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xff, 0xff, 0x02, 0x00, 0x97, 0xff,
+  0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xff, 0xff, 0x02, 0x00, 0x97, 0xff, 0xd1, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xff, 0xff, 0x02, 0x00, 0x97, 0xff, 0xd1, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x5c, 0xff, 0xff, 0x02, 0x00, 0x97, 0xff, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x5c, 0xff, 0xff, 0x02, 0x00, 0x97, 0xff, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c,
+  0xff, 0xff, 0x02, 0x00, 0x97, 0xff, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xff, 0xff,
+  0x02, 0x00, 0x8f, 0xff, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xff, 0xfd, 0x00, 0x00,
+  0x80, 0xff, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0xf1, 0x00, 0x00, 0x64, 0xff,
+  0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xff, 0xd2, 0x00, 0x00, 0x21, 0xfd, 0xff, 0x63,
+  0x00, 0x00, 0x00, 0x00, 0x17, 0xde, 0xff, 0x8f, 0x00, 0x00, 0x00, 0x91, 0xff, 0xff, 0xbe, 0x89,
+  0x80, 0x9e, 0xed, 0xff, 0xe6, 0x1a, 0x00, 0x00, 0x00, 0x02, 0x70, 0xe5, 0xff, 0xff, 0xff, 0xff,
+  0xfc, 0xad, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x42, 0x4d, 0x3e, 0x13, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1c, 0x6e, 0x6d, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x6e, 0x4e,
+  0x00, 0x0e, 0xf9, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xff, 0x7d, 0x00,
+  0x00, 0xb7, 0xff, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xfe, 0xff, 0x2d, 0x00, 0x00,
+  0x69, 0xff, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xff, 0xdc, 0x00, 0x00, 0x00, 0x1b,
+  0xfe, 0xff, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xff, 0x8c, 0x00, 0x00, 0x00, 0x00, 0xcb,
+  0xff, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf4, 0xff, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xff,
+  0xb8, 0x00, 0x00, 0x00, 0x00, 0x47, 0xff, 0xea, 0x03, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xff, 0xf8,
+  0x0c, 0x00, 0x00, 0x00, 0x92, 0xff, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xff, 0x50,
+  0x00, 0x00, 0x00, 0xdc, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xff, 0x9c, 0x00,
+  0x00, 0x27, 0xff, 0xf4, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xff, 0xe6, 0x01, 0x00,
+  0x72, 0xff, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xeb, 0xff, 0x33, 0x00, 0xbe,
+  0xff, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0xff, 0x7d, 0x0f, 0xfa, 0xfc,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xff, 0xc8, 0x56, 0xff, 0xc1, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xf4, 0xfd, 0xb8, 0xff, 0x73, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xff, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xff, 0xff, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x65, 0x6e, 0x0a, 0x00, 0x00, 0x0e, 0x6e, 0x6e, 0x3e, 0x00, 0x00, 0x00, 0x48, 0x6e, 0x27, 0x00,
+  0xcd, 0xff, 0x31, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xac, 0x00, 0x00, 0x00, 0xc0, 0xff, 0x40, 0x00,
+  0xa4, 0xff, 0x55, 0x00, 0x00, 0x68, 0xff, 0xff, 0xd4, 0x00, 0x00, 0x00, 0xe3, 0xff, 0x19, 0x00,
+  0x7c, 0xff, 0x79, 0x00, 0x00, 0x8e, 0xff, 0xd5, 0xf8, 0x03, 0x00, 0x09, 0xfd, 0xf1, 0x00, 0x00,
+  0x53, 0xff, 0x9d, 0x00, 0x00, 0xb3, 0xf4, 0x87, 0xff, 0x24, 0x00, 0x2a, 0xff, 0xc9, 0x00, 0x00,
+  0x2b, 0xff, 0xc0, 0x00, 0x00, 0xd9, 0xca, 0x5a, 0xff, 0x4b, 0x00, 0x4d, 0xff, 0xa1, 0x00, 0x00,
+  0x07, 0xfc, 0xe3, 0x00, 0x05, 0xfa, 0xa0, 0x30, 0xff, 0x72, 0x00, 0x70, 0xff, 0x79, 0x00, 0x00,
+  0x00, 0xdb, 0xfe, 0x09, 0x27, 0xff, 0x78, 0x09, 0xfc, 0x98, 0x00, 0x93, 0xff, 0x50, 0x00, 0x00,
+  0x00, 0xb4, 0xff, 0x2b, 0x4e, 0xff, 0x50, 0x00, 0xdb, 0xbf, 0x00, 0xb6, 0xff, 0x28, 0x00, 0x00,
+  0x00, 0x8d, 0xff, 0x4e, 0x75, 0xff, 0x27, 0x00, 0xb1, 0xe6, 0x00, 0xd9, 0xfa, 0x05, 0x00, 0x00,
+  0x00, 0x66, 0xff, 0x71, 0x9c, 0xf8, 0x04, 0x00, 0x8a, 0xff, 0x12, 0xf9, 0xd7, 0x00, 0x00, 0x00,
+  0x00, 0x3f, 0xff, 0x94, 0xc4, 0xd2, 0x00, 0x00, 0x62, 0xff, 0x56, 0xff, 0xaf, 0x00, 0x00, 0x00,
+  0x00, 0x17, 0xff, 0xb8, 0xeb, 0xa8, 0x00, 0x00, 0x38, 0xff, 0xa2, 0xff, 0x87, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xed, 0xed, 0xff, 0x7f, 0x00, 0x00, 0x0e, 0xfe, 0xeb, 0xff, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xc5, 0xff, 0xff, 0x55, 0x00, 0x00, 0x00, 0xe2, 0xff, 0xff, 0x38, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x9c, 0xff, 0xff, 0x2b, 0x00, 0x00, 0x00, 0xb9, 0xff, 0xff, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x74, 0xff, 0xfa, 0x06, 0x00, 0x00, 0x00, 0x90, 0xff, 0xe9, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1f, 0x6e, 0x6e, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0x6e, 0x4d, 0x00, 0x00,
+  0x03, 0xc4, 0xff, 0xba, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xff, 0xfc, 0x3b, 0x00, 0x00,
+  0x00, 0x21, 0xf1, 0xff, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xde, 0xff, 0x8a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x5d, 0xff, 0xf5, 0x27, 0x00, 0x00, 0x00, 0x8c, 0xff, 0xd4, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xa6, 0xff, 0xca, 0x05, 0x00, 0x34, 0xfc, 0xfa, 0x32, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0xe0, 0xff, 0x81, 0x04, 0xce, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3c, 0xfc, 0xfb, 0xa2, 0xff, 0xce, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xf9, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0xfd, 0xff, 0xcf, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xbc, 0xff, 0xfe, 0xff, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x68, 0xff, 0xeb, 0x59, 0xff, 0xf0, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x21, 0xf3, 0xff, 0x5a, 0x00, 0xa7, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0xc0, 0xff, 0xb3, 0x00, 0x00, 0x1a, 0xf1, 0xff, 0x57, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x70, 0xff, 0xf0, 0x1c, 0x00, 0x00, 0x00, 0x6e, 0xff, 0xe9, 0x13, 0x00, 0x00, 0x00,
+  0x00, 0x26, 0xf6, 0xff, 0x66, 0x00, 0x00, 0x00, 0x00, 0x03, 0xcd, 0xff, 0xa1, 0x00, 0x00, 0x00,
+  0x02, 0xc3, 0xff, 0xbd, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xfd, 0xfe, 0x44, 0x00, 0x00,
+  0x73, 0xff, 0xf4, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0xff, 0xdd, 0x0a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x30, 0x6e, 0x6d, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x6e, 0x61, 0x00, 0x00,
+  0x12, 0xe9, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf6, 0xff, 0x70, 0x00, 0x00,
+  0x00, 0x5c, 0xff, 0xf7, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xff, 0xce, 0x04, 0x00, 0x00,
+  0x00, 0x01, 0xbe, 0xff, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0xfc, 0x36, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x28, 0xf9, 0xff, 0x48, 0x00, 0x00, 0x03, 0xd1, 0xff, 0x93, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x84, 0xff, 0xd8, 0x06, 0x00, 0x6b, 0xff, 0xe4, 0x0e, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0xdd, 0xff, 0x76, 0x14, 0xed, 0xff, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x49, 0xff, 0xf1, 0xab, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xff, 0xff, 0xf5, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xfd, 0xff, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xff, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xff, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xff, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xff, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xff, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xff, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xff, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x32, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e, 0x64, 0x00, 0x00, 0x74, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x00, 0x00, 0x31, 0x6c, 0x6c, 0x6c,
+  0x6c, 0x6c, 0x6c, 0x6c, 0x75, 0xf9, 0xff, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8f, 0xff, 0xea, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+  0xfd, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe0, 0xff, 0x97,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0xd7, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xff, 0xf9, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x18, 0xeb, 0xff, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xb2, 0xff, 0xbf, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63,
+  0xff, 0xee, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xf2, 0xff, 0x57,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xc3, 0xff, 0xa1, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xff, 0xde, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x30, 0xf9, 0xfc, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xae, 0xff, 0xf9, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0xdf, 0x21, 0x00,
+  0xb5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x8f, 0x8f, 0x8f,
+  0x8f, 0x8f, 0x8f, 0x73, 0x00, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0x00, 0x87, 0xff,
+  0xb5, 0x2c, 0x2c, 0x2c, 0x2c, 0x23, 0x00, 0x87, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x87, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x87, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0xa5, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0xa5,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87,
+  0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x87, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0xa5, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x87, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0xa5, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xff,
+  0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0xdf, 0xa5, 0xa5, 0xa5, 0xa5, 0x85, 0x00,
+  0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcd, 0x00, 0x0f, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c,
+  0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x76, 0x60, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xf6, 0xfe, 0x2e, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xff, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1a, 0xf6, 0xfd, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x90, 0xff, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xf6,
+  0xfd, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xff, 0xac, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xf6, 0xfe, 0x2f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0xff, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1b, 0xf8, 0xfe, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x96, 0xff, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d,
+  0xf8, 0xfd, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xff, 0xa9,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xf9, 0xfd, 0x2a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xff, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf9, 0xfd, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x99, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x20, 0xf9, 0xfc, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0xff,
+  0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x14, 0x12, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x8f, 0x8f, 0x8f,
+  0x8f, 0x8f, 0x8f, 0x84, 0x00, 0x64, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x00, 0x11, 0x2c,
+  0x2c, 0x2c, 0x2c, 0x5d, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xff, 0xeb, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xff,
+  0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3c, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3c, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xff, 0xeb, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3c, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xff, 0xeb,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c,
+  0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3c, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xff, 0xeb, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3c, 0xff, 0xeb, 0x00, 0x43, 0xab, 0xab, 0xab, 0xab, 0xbf, 0xff, 0xeb, 0x00,
+  0x64, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x00, 0x09, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x68, 0x6e, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xff, 0xff,
+  0xe1, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0xfd, 0xf6, 0xc1, 0xff, 0xb7,
+  0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xea, 0xff, 0x6c, 0x13, 0xe4, 0xff, 0x7b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0xc4, 0xff, 0xb4, 0x01, 0x00, 0x44, 0xfe, 0xfc, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x8c, 0xff, 0xe8, 0x16, 0x00, 0x00, 0x00, 0x8d, 0xff, 0xe6, 0x16, 0x00, 0x00, 0x37,
+  0xd8, 0xd9, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x06, 0xbb, 0xd9, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xb1, 0xb1, 0xb1, 0xb1,
+  0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0xb1, 0x77, 0x00, 0x36, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab, 0x00, 0x05, 0x16, 0x16,
+  0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x0f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x0c, 0x0c, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xff, 0xda, 0x0c, 0x00, 0x00, 0x00, 0x00,
+  0x15, 0xe7, 0xff, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0xfe, 0xff, 0x52, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x98, 0xff, 0xec, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xb9, 0xcd, 0x8a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0x97, 0x9b, 0x9f, 0x99, 0x7c, 0x3b,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x1d, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x18, 0x14, 0x14, 0x22, 0x50, 0xcd, 0xff, 0xcf, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xf2, 0xff, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc9, 0xff, 0x62, 0x00, 0x00, 0x00, 0x0b, 0x5c, 0x99, 0xbb, 0xcc, 0xcd,
+  0xcd, 0xf2, 0xff, 0x6e, 0x00, 0x00, 0x3e, 0xe9, 0xff, 0xfe, 0xe3, 0xd1, 0xcf, 0xcf, 0xf2, 0xff,
+  0x72, 0x00, 0x0d, 0xe8, 0xff, 0xa0, 0x1a, 0x00, 0x00, 0x00, 0x00, 0xc1, 0xff, 0x72, 0x00, 0x48,
+  0xff, 0xe4, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0x72, 0x00, 0x5b, 0xff, 0xcc, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x31, 0xff, 0xff, 0x72, 0x00, 0x32, 0xff, 0xf7, 0x24, 0x00, 0x00, 0x00,
+  0x0d, 0xc9, 0xff, 0xff, 0x72, 0x00, 0x03, 0xbc, 0xff, 0xea, 0x88, 0x65, 0x82, 0xe2, 0xfe, 0xcf,
+  0xff, 0x72, 0x00, 0x00, 0x15, 0xa3, 0xfd, 0xff, 0xff, 0xff, 0xe3, 0x5b, 0x80, 0xff, 0x6f, 0x00,
+  0x00, 0x00, 0x00, 0x14, 0x3c, 0x44, 0x28, 0x01, 0x00, 0x01, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xc3, 0x4f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xbf, 0xff, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff,
+  0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0x68, 0x09, 0x5e,
+  0x93, 0x95, 0x68, 0x10, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0x81, 0xd7, 0xff, 0xff, 0xff, 0xff,
+  0xe7, 0x36, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xf9, 0xf1, 0x65, 0x20, 0x27, 0x80, 0xfc, 0xe6, 0x0e,
+  0x00, 0x00, 0xbf, 0xff, 0xff, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xff, 0x72, 0x00, 0x00, 0xbf,
+  0xff, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xfb, 0xbf, 0x00, 0x00, 0xbf, 0xff, 0xa3, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xec, 0x00, 0x00, 0xbf, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xc2, 0xfe, 0x03, 0x00, 0xbf, 0xff, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6,
+  0xfc, 0x01, 0x00, 0xbf, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4, 0xe0, 0x00, 0x00,
+  0xbf, 0xff, 0xea, 0x06, 0x00, 0x00, 0x00, 0x00, 0x26, 0xff, 0xa7, 0x00, 0x00, 0xbf, 0xff, 0xff,
+  0x84, 0x00, 0x00, 0x00, 0x03, 0xb1, 0xff, 0x48, 0x00, 0x00, 0xbf, 0xff, 0xce, 0xff, 0xb3, 0x6e,
+  0x74, 0xca, 0xff, 0xb1, 0x00, 0x00, 0x00, 0xbf, 0xff, 0x42, 0x77, 0xf4, 0xff, 0xff, 0xfb, 0x9f,
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x31, 0x40, 0x17, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x19, 0x6a, 0x8b, 0x9d, 0x8b, 0x50, 0x07, 0x00, 0x00, 0x00, 0x00, 0x06, 0x91, 0xfb,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x0d, 0x00, 0x00, 0x00, 0xad, 0xff, 0xf3, 0x80, 0x31, 0x1a,
+  0x31, 0x7c, 0xef, 0x12, 0x00, 0x00, 0x53, 0xff, 0xfa, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c,
+  0x07, 0x00, 0x00, 0xb3, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xef, 0xff, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0xff, 0x3a,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xfd, 0xff, 0x3f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xff, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x98, 0xff, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x2c, 0xf9, 0xff, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x0d, 0x00, 0x00, 0x00, 0x6a,
+  0xfd, 0xff, 0xcd, 0x7f, 0x68, 0x80, 0xca, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x44, 0xc5, 0xff,
+  0xff, 0xff, 0xff, 0xf0, 0x96, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x3b, 0x45, 0x29,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xbd, 0x28, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xff, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf1, 0xff, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xf1, 0xff, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xff,
+  0x36, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x6c, 0x97, 0x82, 0x2e, 0x00, 0xf1, 0xff, 0x36, 0x00, 0x00,
+  0x01, 0x78, 0xfc, 0xff, 0xff, 0xff, 0xfc, 0x6f, 0xf1, 0xff, 0x36, 0x00, 0x00, 0x66, 0xff, 0xf8,
+  0x6d, 0x21, 0x2a, 0x95, 0xfc, 0xfc, 0xff, 0x36, 0x00, 0x06, 0xe1, 0xff, 0x6b, 0x00, 0x00, 0x00,
+  0x00, 0xab, 0xff, 0xff, 0x36, 0x00, 0x44, 0xff, 0xf8, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xff,
+  0xff, 0x36, 0x00, 0x67, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xfe, 0xff, 0x36, 0x00,
+  0x87, 0xff, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0x36, 0x00, 0x86, 0xff, 0xc0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0x36, 0x00, 0x65, 0xff, 0xde, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x16, 0xff, 0xff, 0x36, 0x00, 0x2b, 0xff, 0xfe, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x57,
+  0xff, 0xff, 0x36, 0x00, 0x00, 0xd0, 0xff, 0xa0, 0x01, 0x00, 0x00, 0x0c, 0xd4, 0xff, 0xff, 0x36,
+  0x00, 0x00, 0x41, 0xfc, 0xff, 0xba, 0x6e, 0x77, 0xd7, 0xdc, 0xf1, 0xff, 0x36, 0x00, 0x00, 0x00,
+  0x4e, 0xe3, 0xff, 0xff, 0xff, 0xcc, 0x1b, 0xcb, 0xff, 0x36, 0x00, 0x00, 0x00, 0x00, 0x03, 0x31,
+  0x43, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x4e, 0x80, 0x98, 0x77, 0x49, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x29, 0x00, 0x00,
+  0x00, 0x00, 0x2d, 0xf5, 0xff, 0xb5, 0x3e, 0x1b, 0x32, 0x9e, 0xff, 0xe1, 0x09, 0x00, 0x00, 0x00,
+  0xc6, 0xff, 0xa3, 0x01, 0x00, 0x00, 0x00, 0x00, 0xa9, 0xff, 0x7b, 0x00, 0x00, 0x26, 0xff, 0xfc,
+  0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xff, 0xc5, 0x00, 0x00, 0x64, 0xff, 0xe6, 0x44, 0x44,
+  0x44, 0x44, 0x44, 0x44, 0x5d, 0xff, 0xe9, 0x00, 0x00, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x06, 0x00, 0x73, 0xff, 0xd2, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e, 0x4e,
+  0x4e, 0x4e, 0x4e, 0x02, 0x00, 0x48, 0xff, 0xde, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x18, 0xf9, 0xfd, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x84, 0xff, 0xd3, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x49, 0x00, 0x00, 0x00,
+  0x08, 0xc7, 0xff, 0xf4, 0xa0, 0x75, 0x6c, 0x8f, 0xd4, 0xff, 0x89, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x6c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xba, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x14, 0x3c, 0x48, 0x32, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x1f, 0x3b,
+  0x40, 0x40, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xef,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xed, 0xff, 0xb0, 0x7c, 0x76, 0x76, 0x6e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x5d, 0xff, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+  0xff, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xff, 0x97, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x2e, 0x2e, 0x2e, 0xa8, 0xff, 0xaa, 0x2e, 0x2e, 0x2e, 0x19,
+  0x00, 0x00, 0x74, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8d, 0x00, 0x00, 0x4b,
+  0xa5, 0xa5, 0xa5, 0xda, 0xff, 0xdb, 0xa5, 0xa5, 0xa5, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x95, 0xff, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xff, 0x97,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xff, 0x97, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xff, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x95, 0xff, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x95, 0xff, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xff,
+  0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xff, 0x97, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xff, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x18, 0x70, 0x97, 0x94, 0x62, 0x0d, 0x1d, 0x48, 0x27, 0x00, 0x00, 0x00, 0x4b, 0xf1, 0xff,
+  0xff, 0xff, 0xff, 0xe7, 0x9d, 0xff, 0x87, 0x00, 0x00, 0x26, 0xf5, 0xff, 0xaf, 0x3e, 0x1f, 0x5e,
+  0xee, 0xff, 0xff, 0x84, 0x00, 0x00, 0x9f, 0xff, 0xbb, 0x02, 0x00, 0x00, 0x00, 0x4d, 0xff, 0xff,
+  0x83, 0x00, 0x02, 0xf0, 0xff, 0x47, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe2, 0xff, 0x83, 0x00, 0x20,
+  0xff, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0xff, 0x83, 0x00, 0x33, 0xff, 0xf7, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xff, 0x81, 0x00, 0x2b, 0xff, 0xfe, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xb0, 0xff, 0x80, 0x00, 0x0b, 0xfd, 0xff, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca,
+  0xff, 0x7f, 0x00, 0x00, 0xc9, 0xff, 0x82, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xfd, 0xff, 0x7d, 0x00,
+  0x00, 0x5f, 0xff, 0xf1, 0x41, 0x00, 0x00, 0x0a, 0xb5, 0xff, 0xff, 0x7c, 0x00, 0x00, 0x02, 0xb3,
+  0xff, 0xfa, 0xc5, 0xaf, 0xe7, 0xff, 0xee, 0xff, 0x7a, 0x00, 0x00, 0x00, 0x06, 0x82, 0xe7, 0xff,
+  0xff, 0xe9, 0x86, 0x72, 0xff, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0d, 0x00, 0x00,
+  0x7a, 0xff, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xff, 0x59,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xfd, 0xfe, 0x2b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0x75, 0xe7, 0xff, 0xa9, 0x00, 0x00, 0x00, 0x0b, 0xe5, 0xe5, 0xe6,
+  0xec, 0xf8, 0xff, 0xff, 0xe0, 0x22, 0x00, 0x00, 0x00, 0x0b, 0xec, 0xea, 0xe8, 0xe5, 0xe3, 0xcb,
+  0x8e, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8a, 0xbd, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0xff,
+  0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0xff, 0x6e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0xff, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xb9, 0xff, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0xff,
+  0x6e, 0x0d, 0x67, 0x9b, 0xb1, 0x8f, 0x27, 0x00, 0x00, 0x00, 0xb9, 0xff, 0x81, 0xca, 0xff, 0xff,
+  0xff, 0xff, 0xf8, 0x3d, 0x00, 0x00, 0xb9, 0xff, 0xfc, 0xdf, 0x5a, 0x2a, 0x49, 0xd2, 0xff, 0xcf,
+  0x00, 0x00, 0xb9, 0xff, 0xf5, 0x1f, 0x00, 0x00, 0x00, 0x2b, 0xff, 0xff, 0x1d, 0x00, 0xb9, 0xff,
+  0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0xff, 0x41, 0x00, 0xb9, 0xff, 0x7a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xdb, 0xff, 0x4d, 0x00, 0xb9, 0xff, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0xff,
+  0x4e, 0x00, 0xb9, 0xff, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0xff, 0x4e, 0x00, 0xb9, 0xff,
+  0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0xff, 0x4e, 0x00, 0xb9, 0xff, 0x6e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xd9, 0xff, 0x4e, 0x00, 0xb9, 0xff, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0xff,
+  0x4e, 0x00, 0xb9, 0xff, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0xff, 0x4e, 0x00, 0xb9, 0xff,
+  0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x22, 0x1c, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x62, 0xff, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x23, 0x6c, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x54,
+  0x54, 0x54, 0x54, 0x54, 0x00, 0x00, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x0d, 0x7a,
+  0x7a, 0x8b, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xff, 0xf9, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x22, 0xff, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xff, 0xf9, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x22, 0xff, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x22, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x28, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x28, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x28, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x20, 0x21, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xff, 0xff,
+  0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xff, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0b, 0x6a, 0x6b, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0c, 0x54, 0x54, 0x54, 0x54, 0x54, 0x20, 0x00, 0x00, 0x00, 0x26, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x62, 0x00, 0x00, 0x00, 0x12, 0x7a, 0x7a, 0x7a, 0xe1, 0xff, 0x62, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc5, 0xff, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xff,
+  0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xff, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xc5, 0xff, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xff, 0x62, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xff, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xc5, 0xff, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xff, 0x62, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc5, 0xff, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xff,
+  0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xff, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xec, 0xff, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xff, 0xff, 0x2f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x34, 0xc8, 0xff, 0xdf, 0x04, 0x00, 0x3a, 0xf7, 0xf7, 0xf7, 0xfe, 0xff,
+  0xfe, 0x63, 0x00, 0x00, 0x36, 0xe7, 0xe7, 0xe7, 0xde, 0xb3, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x1c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x5a, 0xff, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a,
+  0xff, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xdf, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xdf, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x35, 0x54, 0x4e, 0x03, 0x00, 0x5a, 0xff, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x65, 0xfb, 0xf2,
+  0x46, 0x00, 0x00, 0x5a, 0xff, 0xdf, 0x00, 0x00, 0x00, 0x81, 0xff, 0xe8, 0x33, 0x00, 0x00, 0x00,
+  0x5a, 0xff, 0xdf, 0x00, 0x03, 0x98, 0xff, 0xdb, 0x23, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xdf,
+  0x08, 0xad, 0xff, 0xcc, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xe8, 0xc0, 0xff, 0xff,
+  0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xdb, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xff, 0x80, 0x0b, 0xd3, 0xff, 0xb1, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x5a, 0xff, 0xe0, 0x00, 0x00, 0x28, 0xf3, 0xff, 0x79, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xff,
+  0xdf, 0x00, 0x00, 0x00, 0x58, 0xff, 0xfc, 0x42, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xdf, 0x00, 0x00,
+  0x00, 0x00, 0x94, 0xff, 0xe9, 0x1b, 0x00, 0x00, 0x5a, 0xff, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xca, 0xff, 0xc6, 0x06, 0x00, 0x5a, 0xff, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xee, 0xff,
+  0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
+  0x74, 0x74, 0x74, 0x74, 0x5b, 0x00, 0xb1, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x00, 0x42, 0x60, 0x60,
+  0xa5, 0xff, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x6d, 0xff, 0xc1, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xff,
+  0xbf, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xff, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xff, 0xbd, 0x00,
+  0x00, 0x00, 0x00, 0x6a, 0xff, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xff, 0xbd, 0x00, 0x00, 0x00,
+  0x00, 0x6a, 0xff, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xff, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x6a,
+  0xff, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xff, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xff, 0xbd,
+  0x00, 0x00, 0x00, 0x00, 0x6a, 0xff, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xff, 0xbd, 0x00, 0x00,
+  0x00, 0x00, 0x6a, 0xff, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x54, 0x3f,
+  0x17, 0x69, 0x92, 0x52, 0x00, 0x09, 0x5a, 0x90, 0x78, 0x18, 0x00, 0x00, 0x0a, 0xff, 0xd6, 0xdc,
+  0xff, 0xff, 0xff, 0x6f, 0xc7, 0xff, 0xff, 0xff, 0xdb, 0x06, 0x00, 0x0a, 0xff, 0xff, 0x8e, 0x1d,
+  0x51, 0xfe, 0xff, 0xd4, 0x33, 0x23, 0xd4, 0xff, 0x43, 0x00, 0x0a, 0xff, 0xff, 0x17, 0x00, 0x00,
+  0xd6, 0xff, 0x66, 0x00, 0x00, 0x7d, 0xff, 0x78, 0x00, 0x0a, 0xff, 0xf8, 0x00, 0x00, 0x00, 0xbd,
+  0xff, 0x4f, 0x00, 0x00, 0x68, 0xff, 0x88, 0x00, 0x0a, 0xff, 0xef, 0x00, 0x00, 0x00, 0xb7, 0xff,
+  0x44, 0x00, 0x00, 0x5e, 0xff, 0x98, 0x00, 0x0a, 0xff, 0xed, 0x00, 0x00, 0x00, 0xb7, 0xff, 0x40,
+  0x00, 0x00, 0x5a, 0xff, 0x9d, 0x00, 0x0a, 0xff, 0xed, 0x00, 0x00, 0x00, 0xb7, 0xff, 0x40, 0x00,
+  0x00, 0x5a, 0xff, 0x9d, 0x00, 0x0a, 0xff, 0xed, 0x00, 0x00, 0x00, 0xb7, 0xff, 0x40, 0x00, 0x00,
+  0x5a, 0xff, 0x9d, 0x00, 0x0a, 0xff, 0xed, 0x00, 0x00, 0x00, 0xb7, 0xff, 0x40, 0x00, 0x00, 0x5a,
+  0xff, 0x9d, 0x00, 0x0a, 0xff, 0xed, 0x00, 0x00, 0x00, 0xb7, 0xff, 0x40, 0x00, 0x00, 0x5a, 0xff,
+  0x9d, 0x00, 0x0a, 0xff, 0xed, 0x00, 0x00, 0x00, 0xb7, 0xff, 0x40, 0x00, 0x00, 0x5a, 0xff, 0x9d,
+  0x00, 0x0a, 0xff, 0xed, 0x00, 0x00, 0x00, 0xb7, 0xff, 0x40, 0x00, 0x00, 0x5a, 0xff, 0x9d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d,
+  0x54, 0x14, 0x01, 0x36, 0x72, 0x94, 0x6b, 0x17, 0x00, 0x00, 0x00, 0xb9, 0xff, 0x53, 0x93, 0xff,
+  0xff, 0xff, 0xff, 0xe7, 0x33, 0x00, 0x00, 0xb9, 0xff, 0xda, 0xe0, 0x5b, 0x2d, 0x4e, 0xd9, 0xff,
+  0xbe, 0x00, 0x00, 0xb9, 0xff, 0xf6, 0x1b, 0x00, 0x00, 0x00, 0x33, 0xff, 0xff, 0x18, 0x00, 0xb9,
+  0xff, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0xff, 0x36, 0x00, 0xb9, 0xff, 0x7e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xdb, 0xff, 0x4c, 0x00, 0xb9, 0xff, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9,
+  0xff, 0x4e, 0x00, 0xb9, 0xff, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0xff, 0x4e, 0x00, 0xb9,
+  0xff, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0xff, 0x4e, 0x00, 0xb9, 0xff, 0x6e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xd9, 0xff, 0x4e, 0x00, 0xb9, 0xff, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9,
+  0xff, 0x4e, 0x00, 0xb9, 0xff, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0xff, 0x4e, 0x00, 0xb9,
+  0xff, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x55, 0x81, 0x93, 0x68, 0x33,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xe8, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x0b, 0x00,
+  0x00, 0x00, 0x34, 0xfe, 0xff, 0xa6, 0x3b, 0x26, 0x64, 0xf1, 0xff, 0xa3, 0x00, 0x00, 0x00, 0xb8,
+  0xff, 0xb1, 0x01, 0x00, 0x00, 0x00, 0x3e, 0xff, 0xfd, 0x2d, 0x00, 0x15, 0xff, 0xff, 0x3d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xcb, 0xff, 0x86, 0x00, 0x36, 0xff, 0xfe, 0x08, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x95, 0xff, 0xa9, 0x00, 0x55, 0xff, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xff,
+  0xca, 0x00, 0x4d, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xff, 0xc1, 0x00, 0x2c,
+  0xff, 0xff, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xff, 0x9e, 0x00, 0x0c, 0xf8, 0xff, 0x61,
+  0x00, 0x00, 0x00, 0x00, 0x06, 0xe7, 0xff, 0x75, 0x00, 0x00, 0x91, 0xff, 0xdb, 0x1a, 0x00, 0x00,
+  0x00, 0x81, 0xff, 0xef, 0x12, 0x00, 0x00, 0x16, 0xe6, 0xff, 0xe2, 0x8c, 0x75, 0xb7, 0xff, 0xfe,
+  0x6e, 0x00, 0x00, 0x00, 0x00, 0x14, 0xab, 0xfc, 0xff, 0xff, 0xff, 0xe5, 0x4e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0x2e, 0x40, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x54, 0x10, 0x0b, 0x50, 0x89,
+  0x82, 0x4c, 0x07, 0x00, 0x00, 0x00, 0xc5, 0xff, 0x5b, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xc8, 0x1c,
+  0x00, 0x00, 0xc5, 0xff, 0xf6, 0xfd, 0x82, 0x2e, 0x60, 0xde, 0xff, 0xd4, 0x02, 0x00, 0xc5, 0xff,
+  0xff, 0x78, 0x00, 0x00, 0x00, 0x05, 0xc0, 0xff, 0x55, 0x00, 0xc5, 0xff, 0xf7, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x7d, 0xff, 0xb1, 0x00, 0xc5, 0xff, 0xd3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0xff,
+  0xd1, 0x00, 0xc5, 0xff, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xf0, 0x00, 0xc5, 0xff,
+  0xc1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xff, 0xe5, 0x00, 0xc5, 0xff, 0xdc, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x58, 0xff, 0xc4, 0x00, 0xc5, 0xff, 0xfe, 0x29, 0x00, 0x00, 0x00, 0x00, 0x90, 0xff,
+  0x98, 0x00, 0xc5, 0xff, 0xff, 0xb0, 0x06, 0x00, 0x00, 0x37, 0xde, 0xfd, 0x2b, 0x00, 0xc5, 0xff,
+  0xd5, 0xff, 0xcb, 0x7c, 0xaf, 0xfe, 0xff, 0x9b, 0x00, 0x00, 0xc5, 0xff, 0x62, 0x83, 0xf6, 0xff,
+  0xff, 0xf7, 0x7d, 0x01, 0x00, 0x00, 0xc5, 0xff, 0x62, 0x00, 0x06, 0x35, 0x30, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0xc5, 0xff, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xff,
+  0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xff, 0x62, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xff, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xb7, 0xed, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0x5b, 0x8c,
+  0x6d, 0x2f, 0x00, 0x2c, 0x48, 0x19, 0x00, 0x00, 0x00, 0x46, 0xef, 0xff, 0xff, 0xff, 0xfe, 0x6b,
+  0xb2, 0xff, 0x5a, 0x00, 0x00, 0x30, 0xfb, 0xfb, 0x7b, 0x33, 0x4a, 0xc1, 0xfe, 0xf5, 0xff, 0x5a,
+  0x00, 0x00, 0xad, 0xff, 0x6d, 0x00, 0x00, 0x00, 0x08, 0xd3, 0xff, 0xff, 0x5a, 0x00, 0x14, 0xfe,
+  0xee, 0x09, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xff, 0xff, 0x5a, 0x00, 0x35, 0xff, 0xc2, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x34, 0xff, 0xff, 0x5a, 0x00, 0x53, 0xff, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1a, 0xff, 0xff, 0x5a, 0x00, 0x59, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0xff,
+  0x5a, 0x00, 0x3f, 0xff, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xff, 0xff, 0x5a, 0x00, 0x0f,
+  0xfa, 0xf9, 0x19, 0x00, 0x00, 0x00, 0x00, 0x83, 0xff, 0xff, 0x5a, 0x00, 0x00, 0xaf, 0xff, 0x9b,
+  0x01, 0x00, 0x00, 0x21, 0xe9, 0xff, 0xff, 0x5a, 0x00, 0x00, 0x27, 0xf3, 0xff, 0xb6, 0x6a, 0x83,
+  0xe6, 0xef, 0xe9, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x3e, 0xe2, 0xff, 0xff, 0xff, 0xe9, 0x36, 0xcd,
+  0xff, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3c, 0x51, 0x29, 0x02, 0x00, 0xcd, 0xff, 0x5a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xcd, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xcd, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xe7, 0x51,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0x54,
+  0x0c, 0x0c, 0x5a, 0x8e, 0x9b, 0x7b, 0x39, 0x00, 0x00, 0xf9, 0xff, 0x56, 0xe2, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x7d, 0x00, 0xf9, 0xff, 0xf3, 0xf6, 0x89, 0x43, 0x48, 0x71, 0xc1, 0x95, 0x00, 0xf9,
+  0xff, 0xeb, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0xf9, 0xff, 0x62, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xff, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf9, 0xff, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xff, 0x26, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xff, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xf9, 0xff, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xff, 0x28, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xff, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xf9, 0xff, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x62, 0x85, 0x9b, 0x89, 0x6a,
+  0x28, 0x00, 0x00, 0x00, 0x00, 0x51, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x00, 0x00,
+  0x1d, 0xf5, 0xff, 0xa3, 0x4a, 0x1a, 0x2d, 0x57, 0xb4, 0x61, 0x00, 0x00, 0x56, 0xff, 0xe6, 0x09,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x5e, 0xff, 0xd9, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0xf5, 0xff, 0xc9, 0x6f, 0x33, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x49, 0xe2, 0xff, 0xff, 0xff, 0xfa, 0xa2, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x3d,
+  0x80, 0xbb, 0xf6, 0xff, 0xfe, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xaa,
+  0xff, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xff, 0xfb, 0x05, 0x00,
+  0x3c, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xff, 0xd3, 0x00, 0x00, 0x83, 0xff, 0xca, 0x90,
+  0x6b, 0x6e, 0xac, 0xfd, 0xfd, 0x51, 0x00, 0x00, 0x51, 0xca, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xd2,
+  0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x2d, 0x44, 0x3c, 0x1d, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x28, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x6e, 0x54, 0x54, 0x54, 0x54, 0x1c, 0x00, 0x00, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x56, 0x00, 0x00, 0xff, 0xff, 0x98, 0x85, 0x85, 0x85, 0x85, 0x2d,
+  0x00, 0x00, 0xff, 0xff, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x28, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x28, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0xff,
+  0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0xff, 0x94, 0x03, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x5e, 0xff, 0xff, 0xeb, 0xd1, 0xcd, 0xcd, 0xcd, 0x50, 0x00, 0x01, 0x63, 0xd1, 0xf3,
+  0xff, 0xff, 0xff, 0xff, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x0c, 0x0c, 0x0c, 0x05, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4e, 0x4e, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x37, 0x4e, 0x23, 0x00, 0x08, 0xff, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb7, 0xff, 0x73, 0x00, 0x08, 0xff, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xff, 0x74,
+  0x00, 0x08, 0xff, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xff, 0x76, 0x00, 0x08, 0xff,
+  0xff, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xff, 0x77, 0x00, 0x08, 0xff, 0xff, 0x1a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0x78, 0x00, 0x08, 0xff, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xc2, 0xff, 0x78, 0x00, 0x08, 0xff, 0xff, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xff,
+  0x78, 0x00, 0x04, 0xfc, 0xff, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xff, 0x78, 0x00, 0x00,
+  0xe2, 0xff, 0x74, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xf6, 0xff, 0x78, 0x00, 0x00, 0xb6, 0xff, 0xc7,
+  0x0c, 0x00, 0x00, 0x05, 0x9f, 0xff, 0xff, 0x78, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xf3, 0x9e, 0x8a,
+  0xd4, 0xff, 0xef, 0xff, 0x78, 0x00, 0x00, 0x00, 0x60, 0xf1, 0xff, 0xff, 0xff, 0xfc, 0x88, 0x8c,
+  0xff, 0x78, 0x00, 0x00, 0x00, 0x00, 0x07, 0x2d, 0x4e, 0x31, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x54, 0x26,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x53, 0x54, 0x11, 0x00, 0x84, 0xff, 0xb4, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x44, 0xff, 0xec, 0x07, 0x00, 0x25, 0xfe, 0xfb, 0x17, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xa3, 0xff, 0x92, 0x00, 0x00, 0x00, 0xc3, 0xff, 0x72, 0x00, 0x00, 0x00, 0x00, 0x0d,
+  0xf4, 0xff, 0x31, 0x00, 0x00, 0x00, 0x62, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x61, 0xff, 0xd0,
+  0x00, 0x00, 0x00, 0x00, 0x0d, 0xf4, 0xff, 0x30, 0x00, 0x00, 0x00, 0xbf, 0xff, 0x71, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xa0, 0xff, 0x8f, 0x00, 0x00, 0x20, 0xfe, 0xfa, 0x16, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3f, 0xff, 0xe9, 0x04, 0x00, 0x7d, 0xff, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0xdc, 0xff, 0x4b, 0x00, 0xda, 0xff, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xff,
+  0xa8, 0x38, 0xff, 0xeb, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xfd, 0xf7, 0xa7,
+  0xff, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xff, 0xff, 0xff, 0x30,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xff, 0xcf, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x50, 0x54, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0x54, 0x21,
+  0x00, 0xca, 0xff, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xff, 0x3b,
+  0x00, 0x8a, 0xff, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xff, 0xf5, 0x06,
+  0x00, 0x4a, 0xff, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xff, 0xbb, 0x00,
+  0x00, 0x0e, 0xfb, 0xf9, 0x09, 0x00, 0x17, 0xcf, 0xcf, 0x6b, 0x00, 0x00, 0x7c, 0xff, 0x7c, 0x00,
+  0x00, 0x00, 0xc9, 0xff, 0x3b, 0x00, 0x5c, 0xff, 0xff, 0xcc, 0x00, 0x00, 0xb1, 0xff, 0x3d, 0x00,
+  0x00, 0x00, 0x8a, 0xff, 0x74, 0x00, 0xa2, 0xff, 0xd0, 0xfe, 0x1e, 0x00, 0xe6, 0xf6, 0x07, 0x00,
+  0x00, 0x00, 0x4b, 0xff, 0xad, 0x01, 0xe8, 0xd4, 0x61, 0xff, 0x6f, 0x1c, 0xff, 0xbe, 0x00, 0x00,
+  0x00, 0x00, 0x0f, 0xfc, 0xe7, 0x31, 0xff, 0x87, 0x15, 0xfc, 0xc0, 0x51, 0xff, 0x7f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xcc, 0xff, 0x9a, 0xff, 0x38, 0x00, 0xc3, 0xfc, 0x9b, 0xff, 0x3f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x8c, 0xff, 0xfa, 0xe7, 0x02, 0x00, 0x76, 0xff, 0xfa, 0xf6, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x4d, 0xff, 0xff, 0x9a, 0x00, 0x00, 0x28, 0xff, 0xff, 0xbd, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0xfc, 0xff, 0x4a, 0x00, 0x00, 0x00, 0xd8, 0xff, 0x7e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x2c, 0x54, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x54, 0x50, 0x02, 0x00,
+  0x00, 0x19, 0xe4, 0xff, 0x64, 0x00, 0x00, 0x00, 0x00, 0x15, 0xe4, 0xff, 0x72, 0x00, 0x00, 0x00,
+  0x00, 0x3a, 0xf9, 0xf7, 0x34, 0x00, 0x00, 0x03, 0xb9, 0xff, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x65, 0xff, 0xe0, 0x14, 0x00, 0x84, 0xff, 0xcf, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x96, 0xff, 0xba, 0x50, 0xfe, 0xeb, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0xc5, 0xff, 0xfc, 0xfb, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x28, 0xfe, 0xff, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb0,
+  0xff, 0xff, 0xf5, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xff, 0xd4,
+  0x79, 0xff, 0xe0, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xfd, 0xf2, 0x28, 0x00,
+  0xa5, 0xff, 0xbd, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xf1, 0xfe, 0x55, 0x00, 0x00, 0x0b,
+  0xd2, 0xff, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x10, 0xd9, 0xff, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x26,
+  0xf1, 0xff, 0x5b, 0x00, 0x00, 0x02, 0xb3, 0xff, 0xbf, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53,
+  0xfe, 0xf6, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1c, 0x58, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x55, 0x2e, 0x00,
+  0x56, 0xff, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xff, 0x83, 0x00, 0x58, 0xff, 0xd1,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0xff, 0x84, 0x00, 0x5c, 0xff, 0xd1, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x9d, 0xff, 0x86, 0x00, 0x5c, 0xff, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x9d, 0xff, 0x89, 0x00, 0x5c, 0xff, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0xff, 0x89,
+  0x00, 0x5c, 0xff, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0xff, 0x8a, 0x00, 0x5c, 0xff,
+  0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0xff, 0x8d, 0x00, 0x5c, 0xff, 0xdf, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x9d, 0xff, 0x8f, 0x00, 0x25, 0xfe, 0xf8, 0x0d, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x9d, 0xff, 0x8f, 0x00, 0x00, 0xb9, 0xff, 0x92, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x9d, 0xff,
+  0x8f, 0x00, 0x00, 0x4b, 0xfe, 0xff, 0xff, 0xee, 0xeb, 0xeb, 0xeb, 0xf7, 0xff, 0x90, 0x00, 0x00,
+  0x00, 0x40, 0xba, 0xe6, 0xf9, 0xf9, 0xf9, 0xf9, 0xfd, 0xff, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0xff, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xac, 0xff, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe9,
+  0xff, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x87, 0xff, 0xd8, 0x00, 0x00,
+  0x00, 0x34, 0xeb, 0xec, 0xef, 0xf1, 0xf1, 0xf8, 0xff, 0xff, 0x6e, 0x00, 0x00, 0x00, 0x36, 0xf3,
+  0xf3, 0xf3, 0xf3, 0xf3, 0xf3, 0xd0, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a, 0x5a,
+  0x5a, 0x11, 0x00, 0x54, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x00, 0x14,
+  0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x8c, 0xff, 0xf5, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x31, 0xf4, 0xfe, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xe4, 0xff, 0x7a,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xce, 0xff, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0xb0, 0xff, 0xc2, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xff,
+  0xdc, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xff, 0xee, 0x28, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x44, 0xfa, 0xf8, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29,
+  0xef, 0xff, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0xff, 0xee, 0xa9, 0xa9,
+  0xa9, 0xa9, 0xa9, 0xa9, 0xa9, 0x20, 0x00, 0xa1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0x86, 0xbb, 0xd2, 0xe2, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+  0xe2, 0xff, 0xff, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xf5, 0x4d, 0x21,
+  0x14, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x98, 0xff, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99,
+  0xff, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0xff, 0x9f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xff, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0xd6, 0xff, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x44, 0x57, 0xa6, 0xff,
+  0xf4, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xff, 0xff, 0xff, 0xd1, 0x38, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xad, 0xd0, 0xe7, 0xff, 0xfd, 0x95, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3f, 0xfb, 0xff, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9,
+  0xff, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xff, 0x9c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x99, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91,
+  0xff, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xff, 0xcd, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xff, 0xff, 0xb7, 0x89, 0x7c, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x98, 0xfc, 0xff, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0x52, 0x66, 0x75, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x2e, 0x36, 0x08, 0x00, 0xdb, 0xff, 0x28, 0x00, 0xdb, 0xff, 0x28, 0x00, 0xdb,
+  0xff, 0x28, 0x00, 0xdb, 0xff, 0x28, 0x00, 0xdb, 0xff, 0x28, 0x00, 0xdb, 0xff, 0x28, 0x00, 0xdb,
+  0xff, 0x28, 0x00, 0xdb, 0xff, 0x28, 0x00, 0xdb, 0xff, 0x28, 0x00, 0xdb, 0xff, 0x28, 0x00, 0xdb,
+  0xff, 0x28, 0x00, 0xdb, 0xff, 0x28, 0x00, 0xdb, 0xff, 0x28, 0x00, 0xdb, 0xff, 0x28, 0x00, 0xdb,
+  0xff, 0x28, 0x00, 0xdb, 0xff, 0x28, 0x00, 0xdb, 0xff, 0x28, 0x00, 0xdb, 0xff, 0x28, 0x00, 0xdb,
+  0xff, 0x28, 0x00, 0xa6, 0xc1, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xdb, 0xc5, 0xa7, 0x4b,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0xff, 0xff, 0xff, 0xff, 0x5b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0c, 0x18, 0x2c, 0xae, 0xff, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3d, 0xff, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xff,
+  0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xff, 0xff, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x21, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf9,
+  0xff, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xff, 0xf7, 0x8d, 0x51,
+  0x43, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x84, 0xfe, 0xff, 0xff, 0xff, 0x60, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x3a, 0xea, 0xff, 0xff, 0xe8, 0xd2, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4,
+  0xff, 0xc4, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xff, 0xff, 0x2e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x24, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xff,
+  0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xff, 0xf9, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xdc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b,
+  0x81, 0x99, 0xec, 0xff, 0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9b, 0xff, 0xff, 0xff, 0xdf,
+  0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x6e, 0x5a, 0x3e, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x43, 0xca, 0xfb, 0xda, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x12, 0x0c, 0x00, 0x00, 0x00, 0x32, 0xf5,
+  0xf5, 0xbf, 0xf2, 0xfc, 0x53, 0x00, 0x00, 0x00, 0x7e, 0xfb, 0x57, 0x00, 0x00, 0xa4, 0xff, 0x51,
+  0x00, 0x25, 0xe7, 0xf5, 0x35, 0x00, 0x00, 0xc2, 0xff, 0x31, 0x00, 0x01, 0xe9, 0xf6, 0x07, 0x00,
+  0x00, 0x3d, 0xf8, 0xf0, 0x78, 0x9a, 0xff, 0xc5, 0x00, 0x00, 0x01, 0x3c, 0x5d, 0x00, 0x00, 0x00,
+  0x00, 0x54, 0xf7, 0xff, 0xff, 0xda, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x17, 0x4f, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const app::AtlasGlyph proggy_atlas_28_glyphs[] = {
+  {16, 0, 0, 0, 0, 0}, // ' '
+  {16, 6, -21, 6, 23, 0}, // '!'
+  {16, 4, -20, 10, 9, 138}, // '"'
+  {16, 0, -20, 18, 21, 228}, // '#'
+  {16, 2, -20, 15, 22, 606}, // '$'
+  {16, 0, -19, 18, 20, 936}, // '%'
+  {16, 0, -20, 18, 22, 1296}, // '&'
+  {16, 7, -20, 4, 9, 1692}, // "'"
+  {16, 4, -22, 8, 26, 1728}, // '('
+  {16, 5, -22, 8, 26, 1936}, // ')'
+  {16, 1, -17, 16, 16, 2144}, // '*'
+  {16, 1, -17, 16, 16, 2400}, // '+'
+  {16, 5, -4, 7, 10, 2656}, // ','
+  {16, 2, -11, 14, 4, 2726}, // '-'
+  {16, 6, -4, 6, 6, 2782}, // '.'
+  {16, 1, -21, 16, 24, 2818}, // '/'
+  {16, 1, -20, 16, 22, 3202}, // '0'
+  {16, 3, -20, 12, 21, 3554}, // '1'
+  {16, 2, -20, 14, 21, 3806}, // '2'
+  {16, 2, -20, 14, 22, 4100}, // '3'
+  {16, 1, -20, 16, 21, 4408}, // '4'
+  {16, 1, -20, 15, 22, 4744}, // '5'
+  {16, 1, -20, 16, 22, 5074}, // '6'
+  {16, 1, -20, 15, 21, 5426}, // '7'
+  {16, 1, -20, 16, 22, 5741}, // '8'
+  {16, 1, -20, 15, 22, 6093}, // '9'
+  {16, 6, -16, 6, 14, 6423}, // ':'
+  {16, 5, -16, 7, 19, 6507}, // ';'
+  {16, 1, -17, 16, 15, 6640}, // '<'
+  {16, 1, -14, 16, 10, 6880}, // '='
+  {16, 1, -16, 16, 14, 7040}, // '>'
+  {16, 2, -21, 14, 23, 7264}, // '?'
+  {16, 0, -21, 21, 23, 7586}, // '@'
+  {16, 0, -20, 18, 21, 8069}, // 'A'
+  {16, 2, -20, 15, 21, 8447}, // 'B'
+  {16, 1, -20, 15, 22, 8762}, // 'C'
+  {16, 1, -20, 16, 21, 9092}, // 'D'
+  {16, 2, -20, 14, 21, 9428}, // 'E'
+  {16, 3, -20, 14, 21, 9722}, // 'F'
+  {16, 1, -20, 16, 22, 10016}, // 'G'
+  {16, 1, -20, 15, 21, 10368}, // 'H'
+  {16, 2, -20, 14, 21, 10683}, // 'I'
+  {16, 1, -20, 14, 22, 10977}, // 'J'
+  {16, 1, -20, 17, 21, 11285}, // 'K'
+  {16, 2, -20, 15, 21, 11642}, // 'L'
+  {16, 1, -20, 16, 21, 11957}, // 'M'
+  {16, 1, -20, 15, 21, 12293}, // 'N'
+  {16, 1, -20, 16, 22, 12608}, // 'O'
+  {16, 2, -20, 15, 21, 12960}, // 'P'
+  {16, 1, -20, 17, 24, 13275}, // 'Q'
+  {16, 1, -20, 16, 21, 13683}, // 'R'
+  {16, 1, -20, 16, 22, 14019}, // 'S'
+  {16, 0, -20, 18, 21, 14371}, // 'T'
+  {16, 1, -20, 16, 22, 14749}, // 'U'
+  {16, 0, -20, 18, 21, 15101}, // 'V'
+  {16, 0, -20, 18, 21, 15479}, // 'W'
+  {16, 0, -20, 18, 21, 15857}, // 'X'
+  {16, 0, -20, 18, 21, 16235}, // 'Y'
+  {16, 1, -20, 16, 21, 16613}, // 'Z'
+  {16, 4, -22, 10, 26, 16949}, // '['
+  {16, 1, -21, 16, 24, 17209}, // '\\'
+  {16, 4, -22, 10, 26, 17593}, // ']'
+  {16, 1, -20, 16, 10, 17853}, // '^'
+  {16, 0, 0, 20, 4, 18013}, // '_'
+  {16, 4, -22, 9, 8, 18093}, // '`'
+  {16, 1, -15, 15, 17, 18165}, // 'a'
+  {16, 2, -21, 15, 23, 18420}, // 'b'
+  {16, 2, -15, 14, 17, 18765}, // 'c'
+  {16, 1, -21, 15, 23, 19003}, // 'd'
+  {16, 1, -15, 16, 17, 19348}, // 'e'
+  {16, 1, -21, 16, 22, 19620}, // 'f'
+  {16, 2, -15, 14, 23, 19972}, // 'g'
+  {16, 2, -21, 14, 22, 20294}, // 'h'
+  {16, 4, -20, 8, 21, 20602}, // 'i'
+  {16, 3, -20, 11, 28, 20770}, // 'j'
+  {16, 3, -20, 15, 21, 21078}, // 'k'
+  {16, 3, -20, 9, 21, 21393}, // 'l'
+  {16, 1, -15, 16, 16, 21582}, // 'm'
+  {16, 2, -15, 14, 16, 21838}, // 'n'
+  {16, 1, -15, 15, 17, 22062}, // 'o'
+  {16, 2, -15, 15, 23, 22317}, // 'p'
+  {16, 1, -15, 15, 23, 22662}, // 'q'
+  {16, 3, -15, 13, 16, 23007}, // 'r'
+  {16, 2, -15, 14, 17, 23215}, // 's'
+  {16, 3, -19, 12, 21, 23453}, // 't'
+  {16, 2, -15, 14, 17, 23705}, // 'u'
+  {16, 1, -15, 16, 16, 23943}, // 'v'
+  {16, 0, -15, 18, 16, 24199}, // 'w'
+  {16, 1, -15, 16, 16, 24487}, // 'x'
+  {16, 1, -15, 15, 23, 24743}, // 'y'
+  {16, 2, -15, 14, 16, 25088}, // 'z'
+  {16, 2, -23, 14, 27, 25312}, // '{'
+  {16, 7, -22, 4, 26, 25690}, // '|'
+  {16, 2, -23, 14, 27, 25794}, // '}'
+  {16, 1, -13, 16, 8, 26172}, // '~'
+};
+
+static const uint8_t proggy_atlas_28_coverage[] = {
+  0x0b, 0x3c, 0x3c, 0x36, 0x00, 0x00, 0x31, 0xff, 0xff, 0xe5, 0x00, 0x00, 0x31, 0xff, 0xff, 0xe5,
+  0x00, 0x00, 0x31, 0xff, 0xff, 0xe5, 0x00, 0x00, 0x2b, 0xff, 0xff, 0xe1, 0x00, 0x00, 0x1d, 0xff,
+  0xff, 0xd8, 0x00, 0x00, 0x11, 0xff, 0xff, 0xcc, 0x00, 0x00, 0x05, 0xff, 0xff, 0xc1, 0x00, 0x00,
+  0x00, 0xf6, 0xff, 0xb6, 0x00, 0x00, 0x00, 0xe7, 0xff, 0xac, 0x00, 0x00, 0x00, 0xd9, 0xff, 0xa2,
+  0x00, 0x00, 0x00, 0xcd, 0xff, 0x97, 0x00, 0x00, 0x00, 0xc1, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x8a,
+  0xc0, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x8e, 0xc8, 0x7f, 0x01, 0x00, 0x63, 0xff, 0xff, 0xff,
+  0x4b, 0x00, 0x71, 0xff, 0xff, 0xff, 0x5b, 0x00, 0x10, 0xc1, 0xf9, 0xb2, 0x07, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x2b, 0x2b, 0x00, 0x00, 0x07,
+  0x2b, 0x2b, 0x0a, 0x00, 0x61, 0xff, 0xff, 0x00, 0x00, 0x28, 0xff, 0xff, 0x39, 0x00, 0x61, 0xff,
+  0xff, 0x00, 0x00, 0x28, 0xff, 0xff, 0x39, 0x00, 0x61, 0xff, 0xff, 0x00, 0x00, 0x28, 0xff, 0xff,
+  0x39, 0x00, 0x61, 0xff, 0xff, 0x00, 0x00, 0x28, 0xff, 0xff, 0x39, 0x00, 0x61, 0xff, 0xff, 0x00,
+  0x00, 0x28, 0xff, 0xff, 0x39, 0x00, 0x61, 0xff, 0xff, 0x00, 0x00, 0x28, 0xff, 0xff, 0x39, 0x00,
+  0x5b, 0xf0, 0xf0, 0x00, 0x00, 0x26, 0xf0, 0xf0, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xf2, 0xff, 0x37,
+  0x00, 0x00, 0x6b, 0xff, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xff,
+  0xef, 0x03, 0x00, 0x00, 0xb0, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x81, 0xff, 0xae, 0x00, 0x00, 0x04, 0xf0, 0xff, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xc6, 0xff, 0x69, 0x00, 0x00, 0x39, 0xff, 0xf1, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0f, 0xfb, 0xff, 0x25, 0x00, 0x00, 0x7e, 0xff, 0xb1, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x4a, 0xb2, 0xb2, 0xb2, 0xc3, 0xff, 0xfd, 0xb2, 0xb2, 0xb2, 0xe5, 0xff, 0xda, 0xb2, 0xb2,
+  0x8d, 0x00, 0x00, 0x6a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xc9, 0x00, 0x00, 0x1f, 0x4c, 0x4c, 0x4c, 0xe8, 0xff, 0x9a, 0x68, 0x68, 0x96, 0xff,
+  0xe7, 0x4c, 0x4c, 0x4c, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xfe, 0xff, 0x1f, 0x00, 0x00,
+  0x84, 0xff, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xff, 0xda, 0x00,
+  0x00, 0x00, 0xc8, 0xff, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xff,
+  0x96, 0x00, 0x00, 0x10, 0xfc, 0xff, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x69, 0x69, 0x69,
+  0xe4, 0xff, 0x88, 0x46, 0x46, 0x79, 0xff, 0xef, 0x69, 0x69, 0x69, 0x18, 0x00, 0x00, 0xf8, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3b, 0x00, 0x00,
+  0x84, 0x87, 0x87, 0xc4, 0xff, 0xd9, 0x87, 0x87, 0x88, 0xfa, 0xff, 0xa3, 0x87, 0x87, 0x87, 0x1f,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xb3, 0xff, 0x7c, 0x00, 0x00, 0x27, 0xff, 0xfb, 0x0e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xf2, 0xff, 0x38, 0x00, 0x00, 0x6a, 0xff, 0xc5, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xff, 0xf0, 0x04, 0x00, 0x00, 0xae, 0xff,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xaf, 0x00, 0x00, 0x03,
+  0xef, 0xff, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xdc, 0x60, 0x00,
+  0x00, 0x2c, 0xdc, 0xd1, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x56, 0xbd, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x83, 0xff, 0xd0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x95,
+  0xe8, 0xff, 0xff, 0xff, 0xf6, 0xca, 0x99, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x35, 0xeb, 0xff, 0xfa,
+  0xe5, 0xff, 0xf5, 0xe1, 0xff, 0xff, 0xce, 0x00, 0x00, 0x00, 0x10, 0xe2, 0xff, 0xd0, 0x1b, 0x74,
+  0xff, 0xc9, 0x00, 0x19, 0x69, 0xa1, 0x00, 0x00, 0x00, 0x4e, 0xff, 0xff, 0x3a, 0x00, 0x74, 0xff,
+  0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xff, 0xfa, 0x02, 0x00, 0x74, 0xff, 0xc9,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xff, 0xff, 0x39, 0x00, 0x74, 0xff, 0xc9, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xe8, 0xff, 0xe1, 0x55, 0x7b, 0xff, 0xc9, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x78, 0x33, 0x02,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xa3, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x2b,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x87, 0xff, 0xe6, 0x9d, 0xdd, 0xff, 0xee, 0x22,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xff, 0xc9, 0x00, 0x02, 0xad, 0xff, 0xba, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xff, 0xc9, 0x00, 0x00, 0x39, 0xff, 0xf6, 0x05, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xff, 0xc9, 0x00, 0x00, 0x37, 0xff, 0xfc, 0x0c, 0x00, 0x37,
+  0x13, 0x00, 0x00, 0x00, 0x74, 0xff, 0xc9, 0x00, 0x00, 0x85, 0xff, 0xd1, 0x00, 0x00, 0x82, 0xf2,
+  0x96, 0x41, 0x05, 0x74, 0xff, 0xc9, 0x12, 0x6b, 0xf6, 0xfe, 0x4f, 0x00, 0x00, 0x6f, 0xfe, 0xff,
+  0xff, 0xfa, 0xf1, 0xff, 0xfa, 0xfc, 0xff, 0xf6, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x67, 0xa1,
+  0xcb, 0xef, 0xff, 0xfa, 0xc8, 0x90, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x6a, 0xff, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32,
+  0x84, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x9c, 0xab, 0x78, 0x11, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x80, 0xb3, 0x9d, 0x02, 0x00, 0x00, 0x00, 0x91, 0xff, 0xff, 0xff, 0xff,
+  0xe1, 0x21, 0x00, 0x00, 0x00, 0x39, 0xfe, 0xff, 0x61, 0x00, 0x00, 0x00, 0x31, 0xff, 0xea, 0x4e,
+  0x2e, 0xa8, 0xff, 0xb1, 0x00, 0x00, 0x02, 0xcc, 0xff, 0xc7, 0x01, 0x00, 0x00, 0x00, 0x6d, 0xff,
+  0x7b, 0x00, 0x00, 0x08, 0xf9, 0xf0, 0x00, 0x00, 0x67, 0xff, 0xfd, 0x34, 0x00, 0x00, 0x00, 0x00,
+  0x58, 0xff, 0x9b, 0x00, 0x00, 0x21, 0xfc, 0xd8, 0x00, 0x13, 0xec, 0xff, 0x9b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x13, 0xe7, 0xfe, 0x9d, 0x80, 0xe1, 0xff, 0x7b, 0x00, 0x96, 0xff, 0xef, 0x15, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xe1, 0xff, 0xff, 0xfd, 0x98, 0x03, 0x31, 0xfc, 0xff, 0x6e,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x3a, 0x4d, 0x1e, 0x00, 0x01, 0xc4, 0xff,
+  0xd3, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d,
+  0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0e, 0xe6, 0xff, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x8c, 0xff, 0xf4, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x29, 0xfa, 0xff, 0x79, 0x00, 0x0a, 0x55, 0x77, 0x5d, 0x0d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xff, 0xda, 0x07, 0x25, 0xde, 0xff, 0xff, 0xff, 0xe8, 0x36,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xff, 0xff, 0x4b, 0x00, 0xc6, 0xff, 0xab, 0x5b, 0xa3,
+  0xff, 0xe2, 0x08, 0x00, 0x00, 0x00, 0x00, 0x09, 0xde, 0xff, 0xb4, 0x00, 0x15, 0xff, 0xd9, 0x02,
+  0x00, 0x00, 0xc3, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xff, 0xf8, 0x25, 0x00, 0x0f, 0xfe,
+  0xd5, 0x01, 0x00, 0x00, 0xb9, 0xff, 0x33, 0x00, 0x00, 0x00, 0x1f, 0xf5, 0xff, 0x87, 0x00, 0x00,
+  0x00, 0xc8, 0xff, 0x97, 0x46, 0x8e, 0xff, 0xdf, 0x06, 0x00, 0x00, 0x00, 0xad, 0xff, 0xe4, 0x0c,
+  0x00, 0x00, 0x00, 0x27, 0xe3, 0xff, 0xff, 0xff, 0xec, 0x38, 0x00, 0x00, 0x00, 0x11, 0x81, 0x81,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x5b, 0x82, 0x64, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x26, 0x80, 0xaa, 0xa8, 0x78, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xde, 0x36, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3a, 0xfc, 0xff, 0xc7, 0x59, 0x5b, 0xea, 0xff, 0xac, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0xff, 0xe2, 0x0a, 0x00, 0x00, 0x67, 0xff,
+  0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xff, 0xbf, 0x00, 0x00, 0x00,
+  0x62, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0xff, 0xfb, 0x2e,
+  0x00, 0x03, 0xd2, 0xff, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xf0,
+  0xff, 0xdd, 0x3d, 0xbc, 0xff, 0xe8, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x38, 0xf1, 0xff, 0xff, 0xff, 0xd7, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x06, 0xbc, 0xff, 0xff, 0xec, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0xb6, 0xff, 0xf2, 0xff, 0xff, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xbd, 0xff, 0xd1, 0x1d, 0xa4, 0xff, 0xfa, 0x3c, 0x00, 0x00,
+  0x00, 0x00, 0xa0, 0xc2, 0x4b, 0x00, 0x00, 0x4c, 0xff, 0xe2, 0x17, 0x00, 0x0b, 0xd4, 0xff, 0xe6,
+  0x19, 0x00, 0x00, 0x00, 0xcf, 0xff, 0x56, 0x00, 0x00, 0xb9, 0xff, 0x74, 0x00, 0x00, 0x00, 0x29,
+  0xf2, 0xff, 0xc2, 0x05, 0x00, 0x00, 0xd9, 0xff, 0x48, 0x00, 0x1c, 0xfe, 0xff, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x4f, 0xfe, 0xff, 0x8f, 0x00, 0x06, 0xf4, 0xff, 0x1d, 0x00, 0x30, 0xff, 0xff, 0x4e,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0xff, 0x5a, 0x4a, 0xff, 0xdd, 0x00, 0x00, 0x08, 0xf9,
+  0xff, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xb9, 0xff, 0xf4, 0xdb, 0xff, 0x6c, 0x00, 0x00,
+  0x00, 0xc6, 0xff, 0xf4, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xe2, 0xff, 0xff, 0xc2, 0x05,
+  0x00, 0x00, 0x00, 0x32, 0xf7, 0xff, 0xdb, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xd3, 0xff, 0xff,
+  0xb4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xf7, 0xff, 0xff, 0xd7, 0xa4, 0xa3, 0xda, 0xff, 0xff,
+  0xcb, 0xff, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0xb1, 0xfc, 0xff, 0xff, 0xff, 0xfe,
+  0xcc, 0x47, 0x00, 0x81, 0xff, 0xfd, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x32, 0x54,
+  0x36, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x06, 0x04, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x39, 0x2d, 0x00,
+  0xb9, 0xff, 0xc9, 0x00, 0xb9, 0xff, 0xc9, 0x00, 0xb9, 0xff, 0xc9, 0x00, 0xb9, 0xff, 0xc9, 0x00,
+  0xb9, 0xff, 0xc9, 0x00, 0xb9, 0xff, 0xc9, 0x00, 0xa9, 0xe9, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x13, 0x31, 0x27, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc3, 0xff, 0x74, 0x00,
+  0x00, 0x00, 0x00, 0x63, 0xff, 0xde, 0x06, 0x00, 0x00, 0x00, 0x0b, 0xe6, 0xff, 0x66, 0x00, 0x00,
+  0x00, 0x00, 0x73, 0xff, 0xed, 0x09, 0x00, 0x00, 0x00, 0x04, 0xe4, 0xff, 0x91, 0x00, 0x00, 0x00,
+  0x00, 0x4c, 0xff, 0xff, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x97, 0xff, 0xf4, 0x05, 0x00, 0x00, 0x00,
+  0x00, 0xda, 0xff, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x86, 0x00, 0x00, 0x00, 0x00,
+  0x3b, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x51, 0xff, 0xff, 0x54, 0x00, 0x00, 0x00, 0x00,
+  0x62, 0xff, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0x52, 0xff, 0xff, 0x52, 0x00, 0x00, 0x00, 0x00,
+  0x3c, 0xff, 0xff, 0x66, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xdd, 0xff, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0xff, 0xf0, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x4b, 0xff, 0xff, 0x36, 0x00, 0x00, 0x00, 0x00, 0x02, 0xdc, 0xff, 0x95, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x70, 0xff, 0xef, 0x09, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xe7, 0xff, 0x64, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x5e, 0xff, 0xe2, 0x09, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc4, 0xff, 0x75, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x19, 0x3e, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0x54, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xe0, 0xff, 0x4a, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x5b, 0xff, 0xdb, 0x08, 0x00, 0x00, 0x00, 0x00, 0x03, 0xd9, 0xff, 0x7b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x6d, 0xff, 0xea, 0x08, 0x00, 0x00, 0x00, 0x00, 0x11, 0xf9, 0xff, 0x61, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xb5, 0xff, 0xcb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xff, 0xfe, 0x18, 0x00,
+  0x00, 0x00, 0x00, 0x38, 0xff, 0xff, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x06, 0xfc, 0xff, 0x99, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xec, 0xff, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0xff, 0xca, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xcb, 0xff, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0xff, 0xc5, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xe8, 0xff, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xfe, 0xff, 0x8c, 0x00,
+  0x00, 0x00, 0x00, 0x3e, 0xff, 0xff, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xff, 0xfa, 0x0d, 0x00,
+  0x00, 0x00, 0x00, 0xcb, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xff, 0xff, 0x49, 0x00, 0x00,
+  0x00, 0x00, 0x8e, 0xff, 0xd8, 0x01, 0x00, 0x00, 0x00, 0x11, 0xee, 0xff, 0x5b, 0x00, 0x00, 0x00,
+  0x00, 0x88, 0xff, 0xc0, 0x01, 0x00, 0x00, 0x00, 0x1b, 0xf6, 0xfb, 0x2c, 0x00, 0x00, 0x00, 0x00,
+  0x0a, 0x1b, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0xbb, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x01, 0x13, 0x00, 0x00,
+  0x15, 0xea, 0xa6, 0x21, 0x00, 0x00, 0xd5, 0xff, 0x8a, 0x00, 0x00, 0x41, 0xc8, 0xce, 0x04, 0x00,
+  0x7e, 0xff, 0xff, 0xf8, 0x8e, 0x13, 0xd5, 0xff, 0x8a, 0x2e, 0xb7, 0xff, 0xff, 0xfe, 0x4f, 0x00,
+  0x01, 0x53, 0xda, 0xff, 0xff, 0xef, 0xf2, 0xff, 0xe5, 0xfd, 0xff, 0xff, 0xc2, 0x38, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x6f, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd6, 0x4f, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x09, 0x88, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x56, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x5f, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x3a, 0x00, 0x00, 0x00,
+  0x3f, 0xcf, 0xff, 0xff, 0xf5, 0x88, 0xdf, 0xff, 0xae, 0xb0, 0xff, 0xff, 0xfe, 0xa9, 0x1f, 0x00,
+  0x59, 0xff, 0xfa, 0x98, 0x1a, 0x00, 0xd5, 0xff, 0x8a, 0x00, 0x3a, 0xc4, 0xff, 0xf9, 0x2d, 0x00,
+  0x00, 0x79, 0x24, 0x00, 0x00, 0x00, 0xd5, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x52, 0x6b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0x89, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x53, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xff, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xff, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xff, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xff, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xff, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x89, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0xe9, 0xff, 0xcf, 0x9b, 0x9b, 0x9b, 0x9b, 0x9b, 0x68, 0x00,
+  0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaa, 0x00,
+  0x82, 0x93, 0x93, 0x93, 0x93, 0x93, 0xe7, 0xff, 0xcb, 0x93, 0x93, 0x93, 0x93, 0x93, 0x62, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xff, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xff, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xff, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xff, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xff, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x44, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0x9d, 0xd1, 0x85, 0x01, 0x00, 0x00, 0x6a, 0xff, 0xff, 0xff, 0x4b, 0x00, 0x00, 0x73,
+  0xff, 0xff, 0xff, 0x67, 0x00, 0x00, 0x13, 0xc8, 0xff, 0xff, 0x4b, 0x00, 0x00, 0x00, 0x27, 0xfe,
+  0xee, 0x0d, 0x00, 0x00, 0x01, 0xb2, 0xff, 0x7f, 0x00, 0x00, 0x01, 0x8c, 0xff, 0xca, 0x06, 0x00,
+  0x00, 0x2f, 0xfd, 0xd8, 0x18, 0x00, 0x00, 0x00, 0x00, 0x60, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2,
+  0xa2, 0xa2, 0x62, 0x00, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x9a, 0x00, 0x6c, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x93, 0x5c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x92,
+  0xcf, 0x83, 0x01, 0x00, 0x63, 0xff, 0xff, 0xff, 0x50, 0x00, 0x71, 0xff, 0xff, 0xff, 0x5e, 0x00,
+  0x10, 0xc1, 0xf9, 0xb2, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x4a, 0x4a,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xda, 0xff, 0xba,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xff, 0x3b,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xd9, 0xff, 0xbb, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5c, 0xff, 0xff, 0x3c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xd8, 0xff, 0xbc, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xff, 0xff, 0x3e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xd7, 0xff, 0xbe, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xd6, 0xff, 0xbf, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xd5, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0xff, 0xff, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xd4, 0xff, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xff, 0xff, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xd3, 0xff, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xff, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0xd2, 0xff, 0xc4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x53, 0xff, 0xff, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xd1, 0xff, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x52, 0xff, 0xff, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xd0, 0xff, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0c, 0x50, 0x50, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x59, 0x7e, 0x50, 0x18, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xcd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4, 0x0b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x22, 0xdc, 0xff, 0xff, 0xf2, 0xc9, 0xf8, 0xff, 0xff, 0xc8, 0x13, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb6, 0xff, 0xff, 0x6a, 0x05, 0x00, 0x0a, 0x8d, 0xff, 0xff, 0xa7, 0x00,
+  0x00, 0x00, 0x00, 0x1f, 0xfd, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc5, 0xff, 0xfd, 0x25,
+  0x00, 0x00, 0x00, 0x83, 0xff, 0xf6, 0x11, 0x00, 0x00, 0x00, 0x00, 0x39, 0xf8, 0xff, 0xff, 0x75,
+  0x00, 0x00, 0x00, 0xca, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xe6, 0xff, 0xff, 0xff, 0xb1,
+  0x00, 0x00, 0x00, 0xe3, 0xff, 0x91, 0x00, 0x00, 0x00, 0x08, 0xc8, 0xff, 0xff, 0xe5, 0xff, 0xd7,
+  0x00, 0x00, 0x01, 0xfa, 0xff, 0x70, 0x00, 0x00, 0x00, 0x9f, 0xff, 0xff, 0x94, 0x84, 0xff, 0xf2,
+  0x00, 0x00, 0x14, 0xff, 0xff, 0x61, 0x00, 0x00, 0x6d, 0xff, 0xff, 0xc2, 0x05, 0x72, 0xff, 0xfd,
+  0x01, 0x00, 0x25, 0xff, 0xff, 0x5b, 0x00, 0x3f, 0xfa, 0xff, 0xe2, 0x17, 0x00, 0x6f, 0xff, 0xff,
+  0x07, 0x00, 0x11, 0xff, 0xff, 0x62, 0x1e, 0xe9, 0xff, 0xf7, 0x35, 0x00, 0x00, 0x76, 0xff, 0xfc,
+  0x00, 0x00, 0x00, 0xf7, 0xff, 0x81, 0xcc, 0xff, 0xff, 0x5c, 0x00, 0x00, 0x00, 0x88, 0xff, 0xf0,
+  0x00, 0x00, 0x00, 0xdf, 0xff, 0xf8, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xd2,
+  0x00, 0x00, 0x00, 0xc4, 0xff, 0xff, 0xff, 0xb5, 0x03, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xff, 0xab,
+  0x00, 0x00, 0x00, 0x71, 0xff, 0xff, 0xd7, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x34, 0xff, 0xff, 0x69,
+  0x00, 0x00, 0x00, 0x13, 0xf7, 0xff, 0xc8, 0x09, 0x00, 0x00, 0x00, 0x08, 0xc6, 0xff, 0xf8, 0x19,
+  0x00, 0x00, 0x00, 0x00, 0xa0, 0xff, 0xff, 0xb3, 0x3f, 0x0a, 0x3c, 0xb2, 0xff, 0xff, 0x8c, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0c, 0xbb, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xa0, 0x04, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x9b, 0xed, 0xff, 0xff, 0xff, 0xe6, 0x82, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x27, 0x4c, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x2b, 0x2b, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x6d, 0xf8, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xad, 0xff, 0xff, 0xff,
+  0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x29, 0xde, 0xff, 0xff, 0xf6, 0xff, 0xff, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x62, 0xff, 0xff, 0x97, 0x7a, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x60, 0xf8,
+  0x63, 0x00, 0x74, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x44, 0x37, 0x00, 0x00, 0x74, 0xff,
+  0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xff, 0xff, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x74, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xff,
+  0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xff, 0xff, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x74, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xff,
+  0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xff, 0xff, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x18, 0x3e,
+  0x3e, 0x3e, 0x95, 0xff, 0xff, 0x4a, 0x3e, 0x3e, 0x3a, 0x00, 0x64, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xf1, 0x00, 0x64, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x2e, 0x63, 0x79, 0x80, 0x5e, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x66, 0xd5, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xfd, 0xb0, 0x1d, 0x00, 0x00, 0x00, 0xbe, 0xff, 0xff, 0xff, 0xea, 0xb3,
+  0xbe, 0xf1, 0xff, 0xff, 0xe7, 0x26, 0x00, 0x00, 0xcc, 0xf1, 0x88, 0x27, 0x01, 0x00, 0x00, 0x12,
+  0xa4, 0xff, 0xff, 0xc3, 0x00, 0x00, 0x59, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xd7,
+  0xff, 0xff, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xff, 0xff,
+  0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0xff, 0xff, 0x41, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xff, 0xfa, 0x12, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xfe, 0xff, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0e, 0xd8, 0xff, 0xec, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x04, 0xb7, 0xff, 0xfa, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xa4, 0xff,
+  0xfd, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x9f, 0xff, 0xfe, 0x68, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x99, 0xff, 0xff, 0x6f, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x94, 0xff, 0xfe, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0x94, 0xff, 0xfb, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x94,
+  0xff, 0xfc, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0xff, 0xff, 0x98,
+  0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x33, 0x00, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x00, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x4e, 0x74, 0x87, 0x81, 0x64, 0x2a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x42, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x43, 0x00, 0x00, 0x00,
+  0x59, 0xff, 0xff, 0xe5, 0xbf, 0xa9, 0xb5, 0xdd, 0xff, 0xff, 0xf9, 0x3c, 0x00, 0x00, 0x37, 0x64,
+  0x1c, 0x00, 0x00, 0x00, 0x00, 0x01, 0x5a, 0xfb, 0xff, 0xe7, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xff, 0xff, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x5a, 0xff, 0xff, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x79, 0xff, 0xff, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xe7,
+  0xff, 0xeb, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x22, 0x52, 0x53, 0x69, 0x97, 0xf3, 0xff, 0xe8, 0x3e,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x6c, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x7d, 0x13, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x57, 0xcf, 0xd1, 0xeb, 0xff, 0xff, 0xf1, 0x8b, 0x06, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x8e, 0xfc, 0xff, 0xbf, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xff, 0xff, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0xfa, 0xff, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xdf, 0xff, 0xe5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xfb, 0xff, 0xc5, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xff, 0xff,
+  0x92, 0x00, 0xe1, 0x92, 0x3e, 0x06, 0x00, 0x00, 0x00, 0x1a, 0x89, 0xfb, 0xff, 0xf2, 0x29, 0x00,
+  0xf2, 0xff, 0xff, 0xfa, 0xde, 0xd8, 0xf1, 0xff, 0xff, 0xff, 0xfc, 0x52, 0x00, 0x00, 0x86, 0xd3,
+  0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xb5, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x39,
+  0x50, 0x5a, 0x51, 0x3c, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+  0x2b, 0x2b, 0x2b, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1,
+  0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xff,
+  0xff, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xe0, 0xff,
+  0xf6, 0xce, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0xff, 0xff,
+  0x72, 0xa9, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xfd, 0xff, 0xc3,
+  0x02, 0xa9, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xd7, 0xff, 0xf6, 0x26,
+  0x00, 0xa9, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xff, 0xff, 0x74, 0x00,
+  0x00, 0xa9, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xfa, 0xff, 0xcb, 0x03, 0x00,
+  0x00, 0xa9, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcd, 0xff, 0xfa, 0x2f, 0x00, 0x00,
+  0x00, 0xa9, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xff, 0xff, 0x86, 0x00, 0x00, 0x00,
+  0x00, 0xa9, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x23, 0xf5, 0xff, 0xda, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0xa9, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0xb9, 0xff, 0xfe, 0x41, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xa9, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xff, 0xf1, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2,
+  0xb2, 0xe5, 0xff, 0xd8, 0xb2, 0xb2, 0x86, 0x00, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x00, 0x64, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
+  0x6f, 0xfa, 0xff, 0xb6, 0x6f, 0x6f, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xf6, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xf6, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xf6, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xf6, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+  0x2b, 0x2b, 0x2b, 0x2b, 0x16, 0x00, 0x00, 0x00, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x2f, 0xff, 0xff, 0xfe, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xfd, 0xfd, 0x80, 0x00, 0x00, 0x00, 0x2f, 0xff, 0xff, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xff, 0xff, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x2f, 0xff, 0xff, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x2f, 0xff, 0xff, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x2f, 0xff, 0xff, 0x9c, 0x95, 0xac, 0x9e, 0x7c, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x28, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0xff, 0xd3, 0x9d, 0x86, 0x89, 0xaa, 0xee, 0xff, 0xff, 0xee, 0x1c, 0x00, 0x00, 0x00, 0x14,
+  0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x9d, 0xff, 0xff, 0xb9, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xbf, 0xff, 0xff, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0xff, 0xff, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xff, 0xff, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x43, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x73, 0xff, 0xff, 0x53, 0x00, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x18, 0xea, 0xff, 0xf9, 0x1e, 0x00, 0x08, 0xd6, 0x6f, 0x24, 0x01, 0x00, 0x00, 0x08, 0x54,
+  0xdd, 0xff, 0xff, 0x7a, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 0xef, 0xda, 0xe5, 0xfe, 0xff, 0xff,
+  0xff, 0xb8, 0x03, 0x00, 0x00, 0x05, 0xbd, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xda, 0x6b,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x2d, 0x47, 0x58, 0x55, 0x45, 0x1e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x2b, 0x39, 0x29, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xbe, 0xf3, 0xff, 0xff, 0xff, 0xf1, 0x6d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xad, 0xff, 0xff, 0xff, 0xe4, 0xdb, 0xf3, 0xff, 0x8f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0xde, 0xff, 0xfd, 0x88, 0x24, 0x00, 0x00, 0x03, 0x40, 0x55, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0xf2, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x28, 0xf9, 0xff, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x97, 0xff, 0xf6, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xbc, 0xff, 0xb9, 0x00, 0x24, 0x7e, 0xa2, 0x98, 0x6b, 0x30, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xde, 0xff, 0x94, 0x71, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x91, 0x0a, 0x00,
+  0x00, 0x00, 0x05, 0xfc, 0xff, 0xbf, 0xff, 0xe7, 0x86, 0x63, 0x71, 0xc3, 0xff, 0xff, 0xad, 0x00,
+  0x00, 0x00, 0x22, 0xff, 0xff, 0xff, 0xd8, 0x16, 0x00, 0x00, 0x00, 0x01, 0xa5, 0xff, 0xff, 0x47,
+  0x00, 0x00, 0x23, 0xff, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xfa, 0xff, 0xb0,
+  0x00, 0x00, 0x1a, 0xff, 0xff, 0xf4, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xff, 0xd6,
+  0x00, 0x00, 0x04, 0xfa, 0xff, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xff, 0xf9,
+  0x02, 0x00, 0x00, 0xd7, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xef,
+  0x00, 0x00, 0x00, 0x98, 0xff, 0xfc, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe5, 0xff, 0xc9,
+  0x00, 0x00, 0x00, 0x42, 0xff, 0xff, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0xff, 0xff, 0x99,
+  0x00, 0x00, 0x00, 0x00, 0xbe, 0xff, 0xfa, 0x64, 0x02, 0x00, 0x00, 0x40, 0xe5, 0xff, 0xf3, 0x1d,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0xe4, 0xff, 0xff, 0xe9, 0xcc, 0xeb, 0xff, 0xff, 0xfb, 0x66, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xa2, 0xf5, 0xff, 0xff, 0xff, 0xf9, 0xc0, 0x2f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x2e, 0x3f, 0x25, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x21,
+  0x00, 0x16, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x00,
+  0x16, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfe, 0xff, 0xff, 0x85, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xff, 0xfd, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xea, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0xff, 0xff, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xff, 0xe4, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x31, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x9c, 0xff, 0xfb, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x12, 0xf5, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74,
+  0xff, 0xff, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xde, 0xff,
+  0xde, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0xff, 0xff, 0x79,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xff, 0xf9, 0x17, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xfe, 0xff, 0xaa, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xff, 0x44, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xef, 0xff, 0xdb, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xff, 0xff, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xce, 0xff, 0xf8, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3a, 0xff, 0xff, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x11, 0x50, 0x7a, 0x85, 0x66, 0x43, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a,
+  0x94, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x6d, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3,
+  0xff, 0xff, 0xe4, 0x98, 0x81, 0x9d, 0xef, 0xff, 0xff, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xff,
+  0xff, 0xbf, 0x0b, 0x00, 0x00, 0x00, 0x15, 0xdc, 0xff, 0xfc, 0x29, 0x00, 0x00, 0x00, 0x8d, 0xff,
+  0xff, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xff, 0x68, 0x00, 0x00, 0x00, 0xb3, 0xff,
+  0xff, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xff, 0xff, 0x8f, 0x00, 0x00, 0x00, 0x96, 0xff,
+  0xff, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xff, 0xff, 0x77, 0x00, 0x00, 0x00, 0x34, 0xfd,
+  0xff, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0xab, 0xff, 0xfe, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x79,
+  0xff, 0xfc, 0x9b, 0x47, 0x30, 0x4c, 0xaf, 0xff, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x58, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38,
+  0xcc, 0xff, 0xff, 0xfd, 0xee, 0xff, 0xff, 0xfe, 0xc5, 0x36, 0x00, 0x00, 0x00, 0x00, 0x22, 0xee,
+  0xff, 0xe0, 0x51, 0x0a, 0x00, 0x0f, 0x65, 0xeb, 0xff, 0xf2, 0x2d, 0x00, 0x00, 0x00, 0xa7, 0xff,
+  0xf9, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0xff, 0xff, 0xa2, 0x00, 0x00, 0x04, 0xfa, 0xff,
+  0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0xff, 0xe7, 0x00, 0x00, 0x23, 0xff, 0xff,
+  0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0xff, 0xfe, 0x07, 0x00, 0x13, 0xff, 0xff,
+  0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xff, 0xfd, 0x04, 0x00, 0x00, 0xe2, 0xff,
+  0xf1, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xfc, 0xff, 0xd5, 0x00, 0x00, 0x00, 0x82, 0xff,
+  0xff, 0xc2, 0x22, 0x00, 0x00, 0x00, 0x2e, 0xd1, 0xff, 0xff, 0x71, 0x00, 0x00, 0x00, 0x04, 0xc0,
+  0xff, 0xff, 0xf8, 0xcc, 0xae, 0xd1, 0xfc, 0xff, 0xff, 0xab, 0x04, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0x6b, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x51, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x1c, 0x3d, 0x52, 0x37, 0x16, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1b, 0x4a, 0x73, 0x83, 0x6a, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x89,
+  0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb5, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xd0, 0xff, 0xff,
+  0xd3, 0x91, 0x89, 0xbb, 0xfe, 0xff, 0xdc, 0x16, 0x00, 0x00, 0x00, 0x85, 0xff, 0xff, 0x8e, 0x01,
+  0x00, 0x00, 0x00, 0x4f, 0xfd, 0xff, 0x9e, 0x00, 0x00, 0x01, 0xe8, 0xff, 0xe8, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xa5, 0xff, 0xfc, 0x1c, 0x00, 0x23, 0xff, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x46, 0xff, 0xff, 0x66, 0x00, 0x3d, 0xff, 0xff, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x25, 0xff, 0xff, 0x9f, 0x00, 0x34, 0xff, 0xff, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x24, 0xff, 0xff, 0xc6, 0x00, 0x0e, 0xff, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46,
+  0xff, 0xff, 0xdf, 0x00, 0x00, 0xe3, 0xff, 0xe8, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xff,
+  0xff, 0xec, 0x00, 0x00, 0x6b, 0xff, 0xff, 0x97, 0x04, 0x00, 0x00, 0x00, 0x50, 0xfd, 0xfe, 0xff,
+  0xee, 0x00, 0x00, 0x03, 0xcc, 0xff, 0xff, 0xd5, 0x9b, 0x8a, 0xc0, 0xff, 0xeb, 0xcc, 0xff, 0xdc,
+  0x00, 0x00, 0x00, 0x0c, 0x96, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xd7, 0x30, 0xdf, 0xff, 0xc6, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x21, 0x4f, 0x77, 0x71, 0x44, 0x02, 0x0e, 0xfe, 0xff, 0x92, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xff, 0xff, 0x55, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xda, 0xff, 0xec, 0x08, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x87, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x46, 0x15,
+  0x00, 0x00, 0x02, 0x30, 0xa6, 0xff, 0xff, 0xd4, 0x08, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xfd, 0xe3,
+  0xd8, 0xee, 0xff, 0xff, 0xff, 0xbe, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xe9, 0xff, 0xff,
+  0xff, 0xf6, 0xbf, 0x79, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x23, 0x29,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xc2, 0x83, 0x03, 0x00, 0x48, 0xff, 0xff,
+  0xff, 0x61, 0x00, 0x5b, 0xff, 0xff, 0xff, 0x75, 0x00, 0x0b, 0xbf, 0xff, 0xc9, 0x13, 0x00, 0x00,
+  0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x93, 0xd8,
+  0x99, 0x05, 0x00, 0x5a, 0xff, 0xff, 0xff, 0x63, 0x00, 0x5c, 0xff, 0xff, 0xff, 0x69, 0x00, 0x06,
+  0xae, 0xed, 0xae, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xc2, 0x83,
+  0x03, 0x00, 0x00, 0x48, 0xff, 0xff, 0xff, 0x61, 0x00, 0x00, 0x5b, 0xff, 0xff, 0xff, 0x75, 0x00,
+  0x00, 0x0b, 0xbf, 0xff, 0xc9, 0x13, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x96, 0xdf, 0xa0, 0x07,
+  0x00, 0x00, 0x52, 0xff, 0xff, 0xff, 0x6b, 0x00, 0x00, 0x54, 0xff, 0xff, 0xff, 0x82, 0x00, 0x00,
+  0x05, 0xae, 0xfc, 0xff, 0x65, 0x00, 0x00, 0x00, 0x1a, 0xfa, 0xf8, 0x1a, 0x00, 0x00, 0x00, 0x9f,
+  0xff, 0x92, 0x00, 0x00, 0x00, 0x7c, 0xff, 0xd5, 0x0b, 0x00, 0x00, 0x18, 0xf5, 0xdf, 0x1e, 0x00,
+  0x00, 0x00, 0x00, 0x49, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x48, 0xa7, 0x86, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x89, 0xe5, 0xff, 0xff, 0x8e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x6a, 0xca, 0xff, 0xff, 0xff, 0xf8, 0xae, 0x39, 0x00,
+  0x00, 0x00, 0x00, 0x04, 0x4c, 0xab, 0xf8, 0xff, 0xff, 0xfd, 0xbd, 0x63, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x2e, 0x8d, 0xe8, 0xff, 0xff, 0xff, 0xcf, 0x74, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xba, 0xff, 0xff, 0xff, 0xdf, 0x85, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xe0, 0xff, 0xff, 0x9c, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8e, 0xf1, 0xff, 0xff, 0xf9, 0xb1, 0x57, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x09, 0x5a, 0xb8, 0xfc, 0xff, 0xff, 0xf3, 0xa3, 0x49, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1b, 0x77, 0xd5, 0xff, 0xff, 0xff, 0xe9, 0x94, 0x3c, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x94, 0xec, 0xff, 0xff, 0xff, 0xe1, 0x58, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x52, 0xb1, 0xfa, 0xff, 0x8e, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x6f, 0x67, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x89, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0xb2, 0x77, 0x00,
+  0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaa, 0x00,
+  0x60, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x53, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xa1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0x8c, 0x00,
+  0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaa, 0x00,
+  0x4d, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x65, 0x43, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xac, 0x83, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xcb, 0xff, 0xfe, 0xc3, 0x64, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x5f, 0xc9, 0xff, 0xff, 0xff, 0xf5, 0xa5, 0x46, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x24, 0x7d, 0xd7, 0xff, 0xff, 0xff, 0xe3, 0x86, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x90, 0xe8, 0xff, 0xff, 0xff, 0xc7, 0x68, 0x11, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x48, 0xa2, 0xf2, 0xff, 0xff, 0xf7, 0x77, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xc2, 0xff, 0xff, 0xa3, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x64, 0xbc, 0xfc, 0xff, 0xff, 0xeb, 0x69, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x07, 0x51, 0xac, 0xf8, 0xff, 0xff, 0xfa, 0xb0, 0x51, 0x06, 0x00, 0x00,
+  0x00, 0x02, 0x40, 0x9a, 0xed, 0xff, 0xff, 0xff, 0xcd, 0x6e, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0xe5, 0xff, 0xff, 0xff, 0xe6, 0x8b, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xcb, 0xff, 0xf7, 0xa8, 0x49, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x95, 0x66, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3a, 0xae, 0xe9, 0xff, 0xfd, 0xe5, 0xb7, 0x46, 0x00, 0x00, 0x00, 0x00, 0x01, 0x90, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa5, 0x01, 0x00, 0x02, 0x97, 0xff, 0xff, 0xbe, 0x64,
+  0x16, 0x17, 0x48, 0xb4, 0xff, 0xff, 0x71, 0x00, 0x78, 0xff, 0xff, 0x88, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xc1, 0xff, 0xbc, 0x00, 0x04, 0x78, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x9c, 0xff, 0xd6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xf3, 0xff,
+  0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xd8, 0xff, 0xf2, 0x2b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xf0, 0xff, 0xf3, 0x49, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x77, 0xfe, 0xff, 0xcd, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x52, 0xfe, 0xff, 0xac, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc,
+  0xff, 0xf1, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf4, 0xff, 0xab,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0xce, 0x87, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x8e, 0xc8, 0x7f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x63, 0xff, 0xff, 0xff, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xff,
+  0xff, 0xff, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xc1, 0xf9, 0xb2,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x0d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xa5, 0xec,
+  0xff, 0xff, 0xe8, 0xc5, 0xa1, 0x76, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1f, 0xbf, 0xff, 0xff, 0xff, 0xf6, 0xe1, 0xea, 0xfd, 0xff, 0xff, 0xdf, 0x43, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x32, 0xe8, 0xff, 0xfd, 0xab, 0x40, 0x07, 0x00, 0x00, 0x18, 0x69, 0xd3,
+  0xff, 0xfe, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xe2, 0xff, 0xf1, 0x4b, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x93, 0xff, 0xff, 0x3a, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xfc,
+  0x42, 0x00, 0x00, 0x01, 0x4a, 0x90, 0x99, 0x58, 0x04, 0x00, 0x02, 0xd4, 0xff, 0x81, 0x00, 0x00,
+  0x00, 0x2e, 0xfd, 0xff, 0xa5, 0x00, 0x00, 0x0c, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xce, 0x16, 0x01,
+  0xc2, 0xff, 0x85, 0x00, 0x00, 0x00, 0x8c, 0xff, 0xfd, 0x2a, 0x00, 0x02, 0xb8, 0xff, 0xff, 0xd1,
+  0xd7, 0xff, 0xff, 0xdf, 0xcb, 0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0xd2, 0xff, 0xb7, 0x00, 0x00,
+  0x53, 0xff, 0xff, 0x66, 0x00, 0x00, 0x59, 0xfd, 0xff, 0xff, 0xff, 0xa6, 0x00, 0x00, 0x00, 0x01,
+  0xfb, 0xff, 0x88, 0x00, 0x00, 0xad, 0xff, 0xc2, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xff, 0xff, 0x33,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0xff, 0xff, 0x64, 0x00, 0x00, 0xd9, 0xff, 0x84, 0x00, 0x00, 0x00,
+  0x00, 0x68, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xff, 0xff, 0x5e, 0x00, 0x00, 0xe4,
+  0xff, 0x77, 0x00, 0x00, 0x00, 0x00, 0x5b, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff,
+  0xff, 0x8d, 0x00, 0x00, 0xcf, 0xff, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x81, 0xff, 0xff, 0x03, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf7, 0xff, 0xbf, 0x00, 0x00, 0x96, 0xff, 0xf2, 0x12, 0x00, 0x00, 0x10,
+  0xe8, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xff, 0xf2, 0x10, 0x00, 0x28, 0xf9,
+  0xff, 0xd9, 0x63, 0x5f, 0xd4, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xff,
+  0xff, 0x91, 0x00, 0x00, 0x63, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0xdb, 0xff, 0xfb, 0x2c, 0x00, 0x00, 0x3c, 0xc3, 0xfa, 0xfd, 0xb5, 0x22,
+  0xa8, 0xac, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0xfc, 0xff, 0xd1, 0x1a, 0x00, 0x00,
+  0x00, 0x0c, 0x11, 0x00, 0x00, 0x00, 0x00, 0x09, 0x86, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73,
+  0xff, 0xff, 0xe5, 0x52, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xdb, 0xff, 0xf0, 0x27,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xfb, 0xff, 0xff, 0xdb, 0x8d, 0x6b, 0x65, 0x8b, 0xb1, 0xd8,
+  0xfe, 0xff, 0xff, 0xa5, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xb6, 0xfe, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x25, 0x68, 0xa3, 0xbe, 0xd0, 0xc9, 0xaf, 0x8a, 0x41, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x2b, 0x2b, 0x2b, 0x06,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xff, 0xff,
+  0xff, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcb,
+  0xff, 0xff, 0xff, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x21, 0xfe, 0xff, 0xc3, 0xff, 0xf3, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x73, 0xff, 0xf8, 0x35, 0xff, 0xff, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xc5, 0xff, 0xb9, 0x00, 0xda, 0xff, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xfd, 0xff, 0x6d, 0x00, 0x8d, 0xff, 0xf1, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0xff, 0xff, 0x21, 0x00, 0x42, 0xff, 0xff, 0x4b,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xff, 0xd2, 0x00, 0x00, 0x06, 0xf1,
+  0xff, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xfc, 0xff, 0x85, 0x00, 0x00,
+  0x00, 0xac, 0xff, 0xec, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xff, 0xff, 0x3a,
+  0x00, 0x00, 0x00, 0x60, 0xff, 0xff, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xff,
+  0xec, 0x03, 0x00, 0x00, 0x00, 0x16, 0xfd, 0xff, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13,
+  0xfa, 0xff, 0xaf, 0x15, 0x15, 0x15, 0x15, 0x15, 0xce, 0xff, 0xe6, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x61, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xb5, 0xff, 0xff, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xff, 0xff, 0x8d,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0xf9, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdd,
+  0xff, 0xdf, 0x01, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xff, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8f, 0xff, 0xff, 0x33, 0x00, 0x00, 0x00, 0xb0, 0xff, 0xfe, 0x1a, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x41, 0xff, 0xff, 0x86, 0x00, 0x00, 0x0d, 0xf7, 0xff, 0xcd, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xee, 0xff, 0xda, 0x00, 0x00, 0x58, 0xff, 0xff, 0x82, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24,
+  0x2b, 0x2b, 0x2b, 0x2b, 0x2a, 0x18, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xd6, 0x6e, 0x0b, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xff, 0xfc,
+  0xef, 0xef, 0xef, 0xf6, 0xff, 0xff, 0xff, 0xdf, 0x15, 0x00, 0x00, 0x00, 0xd6, 0xff, 0xc8, 0x00,
+  0x00, 0x00, 0x00, 0x0f, 0x5a, 0xe9, 0xff, 0xb9, 0x00, 0x00, 0x00, 0xd6, 0xff, 0xc8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x52, 0xff, 0xfd, 0x11, 0x00, 0x00, 0xd6, 0xff, 0xc8, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1a, 0xff, 0xff, 0x45, 0x00, 0x00, 0xd6, 0xff, 0xc8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x2d, 0xff, 0xff, 0x42, 0x00, 0x00, 0xd6, 0xff, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x96, 0xff, 0xf0, 0x0d, 0x00, 0x00, 0xd6, 0xff, 0xd8, 0x4b, 0x4b, 0x4b, 0x52, 0x6a, 0xbc,
+  0xff, 0xff, 0x65, 0x00, 0x00, 0x00, 0xd6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe2,
+  0x49, 0x00, 0x00, 0x00, 0x00, 0xd6, 0xff, 0xf6, 0xd6, 0xd6, 0xd6, 0xd6, 0xe9, 0xfe, 0xff, 0xe1,
+  0x6a, 0x00, 0x00, 0x00, 0xd6, 0xff, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x68, 0xec, 0xff,
+  0x80, 0x00, 0x00, 0xd6, 0xff, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0xff, 0xf8,
+  0x21, 0x00, 0xd6, 0xff, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xed, 0xff, 0x68,
+  0x00, 0xd6, 0xff, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xff, 0x8a, 0x00,
+  0xd6, 0xff, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xf0, 0xff, 0x6d, 0x00, 0xd6,
+  0xff, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xff, 0xff, 0x3a, 0x00, 0xd6, 0xff,
+  0xcf, 0x22, 0x22, 0x22, 0x22, 0x32, 0x4b, 0xa0, 0xfa, 0xff, 0xb7, 0x03, 0x00, 0xd6, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x10, 0x00, 0x00, 0xd6, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xfa, 0xe1, 0xc6, 0xa0, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1f, 0x53, 0x76, 0x86, 0x72, 0x4a, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xaf, 0xfc,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xf3, 0xff, 0xff, 0xe8,
+  0xb5, 0x9b, 0xb7, 0xf2, 0xff, 0xae, 0x00, 0x00, 0x00, 0x2f, 0xfa, 0xff, 0xf7, 0x56, 0x00, 0x00,
+  0x00, 0x00, 0x0b, 0x71, 0xa0, 0x00, 0x00, 0x02, 0xc5, 0xff, 0xfd, 0x3e, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x40, 0xff, 0xff, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xce, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xeb, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xfd, 0xff, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0xff, 0xff, 0xcf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf3, 0xff, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4,
+  0xff, 0xfa, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb4, 0xff,
+  0xff, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0xff, 0xff,
+  0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xfa, 0xff, 0xca,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0xff, 0xff, 0x60,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00, 0x1d, 0xf4, 0xff, 0xfe, 0x7f,
+  0x13, 0x00, 0x00, 0x00, 0x2c, 0x9c, 0xac, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xef, 0xff, 0xff, 0xfe,
+  0xdc, 0xc1, 0xe2, 0xff, 0xff, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x99, 0xf0, 0xff, 0xff,
+  0xff, 0xff, 0xfe, 0xcc, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x33, 0x4c, 0x56,
+  0x45, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x1a, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xcf, 0xaa, 0x3f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1d, 0xff, 0xff, 0xf9, 0xef, 0xef, 0xf8, 0xff, 0xff, 0xff, 0xfd, 0x88,
+  0x06, 0x00, 0x00, 0x00, 0x1d, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x14, 0x61, 0xe7, 0xff, 0xff,
+  0x9d, 0x00, 0x00, 0x00, 0x1d, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xee, 0xff,
+  0xf8, 0x16, 0x00, 0x00, 0x1d, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xff,
+  0xff, 0x7d, 0x00, 0x00, 0x1d, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xf9,
+  0xff, 0xcc, 0x00, 0x00, 0x1d, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9,
+  0xff, 0xe7, 0x00, 0x00, 0x1d, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2,
+  0xff, 0xfd, 0x04, 0x00, 0x1d, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa,
+  0xff, 0xff, 0x1c, 0x00, 0x1d, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c,
+  0xff, 0xff, 0x2c, 0x00, 0x1d, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1,
+  0xff, 0xff, 0x11, 0x00, 0x1d, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca,
+  0xff, 0xef, 0x00, 0x00, 0x1d, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe4,
+  0xff, 0xce, 0x00, 0x00, 0x1d, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xfe,
+  0xff, 0xa7, 0x00, 0x00, 0x1d, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff,
+  0xff, 0x39, 0x00, 0x00, 0x1d, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xfa, 0xff,
+  0xb2, 0x00, 0x00, 0x00, 0x1d, 0xff, 0xff, 0xb1, 0x22, 0x22, 0x38, 0x65, 0xae, 0xff, 0xff, 0xf0,
+  0x2d, 0x00, 0x00, 0x00, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0x1c,
+  0x00, 0x00, 0x00, 0x00, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xbf, 0x92, 0x56, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x12, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+  0x28, 0x00, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0x00,
+  0x6e, 0xff, 0xff, 0xfe, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xeb, 0x00, 0x6e, 0xff,
+  0xff, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xff, 0xff, 0x55,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xff, 0xff, 0x55, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xff, 0xff, 0x55, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xff, 0xff, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x6e, 0xff, 0xff, 0x8b, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x52, 0x40,
+  0x00, 0x00, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x00, 0x00,
+  0x6e, 0xff, 0xff, 0xe8, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xad, 0x00, 0x00, 0x6e, 0xff,
+  0xff, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xff, 0xff, 0x55,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xff, 0xff, 0x55, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xff, 0xff, 0x55, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xff, 0xff, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x6e, 0xff, 0xff, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x6e, 0xff, 0xff, 0x75, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2e, 0x00,
+  0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x6e, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x30, 0x32, 0x32, 0x32, 0x32,
+  0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x06, 0x00, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0xcc, 0xff, 0xfb, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1, 0xe1,
+  0xe1, 0xe1, 0x1b, 0x00, 0xcc, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xcc, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xcc, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xff,
+  0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xff, 0xe0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xff, 0xe2, 0x0c, 0x0c, 0x0c,
+  0x0c, 0x0c, 0x0c, 0x07, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x9a, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a,
+  0x00, 0x00, 0x00, 0x00, 0xcc, 0xff, 0xe1, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x05, 0x00, 0x00,
+  0x00, 0x00, 0xcc, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xcc, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xff,
+  0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xff, 0xe0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xff, 0xe0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xcc, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0x54, 0x82, 0x7e, 0x55, 0x13, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x5a, 0xeb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xa3, 0x1c, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0x98, 0xff, 0xff, 0xfa, 0xcf, 0xa0, 0xa4, 0xd6, 0xff, 0xff, 0x62, 0x00, 0x00,
+  0x00, 0x00, 0x9f, 0xff, 0xff, 0xbe, 0x11, 0x00, 0x00, 0x00, 0x00, 0x38, 0xcb, 0x62, 0x00, 0x00,
+  0x00, 0x29, 0xfc, 0xff, 0xb8, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x00, 0x00,
+  0x00, 0xab, 0xff, 0xff, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x16, 0xfe, 0xff, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x38, 0xff, 0xff, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x5a, 0xff, 0xff, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7b, 0xff, 0xff, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x92, 0xff, 0xff, 0x4f, 0x00, 0x00, 0x00, 0x2a, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0xd7, 0x14, 0x00,
+  0x77, 0xff, 0xff, 0x56, 0x00, 0x00, 0x00, 0x32, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0x00,
+  0x56, 0xff, 0xff, 0x67, 0x00, 0x00, 0x00, 0x0e, 0x4a, 0x4a, 0x4a, 0xaa, 0xff, 0xff, 0x18, 0x00,
+  0x34, 0xff, 0xff, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0xff, 0x18, 0x00,
+  0x10, 0xfa, 0xff, 0xcc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0xff, 0x18, 0x00,
+  0x00, 0x9c, 0xff, 0xfe, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0xff, 0x18, 0x00,
+  0x00, 0x21, 0xfa, 0xff, 0xc4, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xff, 0xff, 0x18, 0x00,
+  0x00, 0x00, 0x96, 0xff, 0xff, 0xd0, 0x2e, 0x02, 0x00, 0x00, 0x12, 0xb8, 0xff, 0xff, 0x18, 0x00,
+  0x00, 0x00, 0x06, 0xaa, 0xff, 0xff, 0xff, 0xf1, 0xc3, 0xcd, 0xf9, 0xff, 0xff, 0xd3, 0x0b, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x59, 0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x73, 0x08, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x43, 0x55, 0x4a, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0x2b, 0x2b, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x2b, 0x2a, 0x00, 0x1d,
+  0xff, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xff, 0xfb, 0x00, 0x1d, 0xff,
+  0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xff, 0xfb, 0x00, 0x1d, 0xff, 0xff,
+  0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xff, 0xfb, 0x00, 0x1d, 0xff, 0xff, 0xa5,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xff, 0xfb, 0x00, 0x1d, 0xff, 0xff, 0xa5, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xff, 0xfb, 0x00, 0x1d, 0xff, 0xff, 0xa5, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xff, 0xfb, 0x00, 0x1d, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xcd, 0xff, 0xfb, 0x00, 0x1d, 0xff, 0xff, 0xc2, 0x52, 0x52, 0x52, 0x52,
+  0x52, 0x52, 0x52, 0xdd, 0xff, 0xfb, 0x00, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xfb, 0x00, 0x1d, 0xff, 0xff, 0xf3, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+  0xdd, 0xf8, 0xff, 0xfb, 0x00, 0x1d, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xcd, 0xff, 0xfb, 0x00, 0x1d, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd,
+  0xff, 0xfb, 0x00, 0x1d, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xff,
+  0xfb, 0x00, 0x1d, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xff, 0xfb,
+  0x00, 0x1d, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xff, 0xfb, 0x00,
+  0x1d, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xff, 0xfb, 0x00, 0x1d,
+  0xff, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xff, 0xfb, 0x00, 0x1d, 0xff,
+  0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xff, 0xfb, 0x00, 0x1d, 0xff, 0xff,
+  0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xff, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x2b, 0x2b, 0x2b, 0x2b,
+  0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x04, 0x00, 0x44, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x15, 0x00, 0x43, 0xfd, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfd,
+  0xfd, 0xfd, 0xfd, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xc9, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xf8, 0xff, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf8, 0xff, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff,
+  0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xc9, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xc9, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xf8, 0xff, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf8, 0xff, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x30, 0x30, 0x30, 0x30, 0xf9, 0xff,
+  0xd3, 0x30, 0x30, 0x30, 0x30, 0x04, 0x00, 0x44, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x15, 0x00, 0x44, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xe7, 0xfd, 0xfd, 0xfd, 0xfd, 0xfe, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xb0, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb0, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xff,
+  0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x12,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x12, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xb0, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xb0, 0xff, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xb1, 0xff, 0xff, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc1, 0xff,
+  0xfe, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xff, 0xef, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0xfd, 0xff, 0xbf, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xad, 0xff, 0xff, 0x72, 0x00, 0x00, 0x49, 0xdb, 0xdb,
+  0xdb, 0xdb, 0xdb, 0xe4, 0xfe, 0xff, 0xff, 0xd5, 0x07, 0x00, 0x00, 0x55, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xf7, 0xa5, 0x13, 0x00, 0x00, 0x00, 0x15, 0x3f, 0x3f, 0x3f, 0x3f, 0x3f, 0x3a,
+  0x28, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x2b, 0x2b, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x23, 0x2b, 0x2b, 0x12, 0x00, 0x1d, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x6c, 0xfe, 0xff, 0xc6, 0x0f, 0x00, 0x1d, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x71, 0xfe, 0xff, 0xc3, 0x0d, 0x00, 0x00, 0x1d, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x75, 0xff, 0xff, 0xc0, 0x0c, 0x00, 0x00, 0x00, 0x1d, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x00,
+  0x00, 0x76, 0xff, 0xff, 0xbd, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xff, 0xff, 0xa5, 0x00, 0x00,
+  0x00, 0x76, 0xff, 0xff, 0xba, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xff, 0xff, 0xa5, 0x00,
+  0x00, 0x76, 0xff, 0xff, 0xb7, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xff, 0xff, 0xa5,
+  0x00, 0x78, 0xff, 0xff, 0xb3, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xff, 0xff,
+  0xa5, 0x7a, 0xff, 0xff, 0xcb, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xff,
+  0xff, 0xee, 0xff, 0xff, 0xff, 0xf9, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d,
+  0xff, 0xff, 0xff, 0xff, 0xb7, 0xfa, 0xff, 0xd9, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1d, 0xff, 0xff, 0xff, 0xa4, 0x03, 0x7a, 0xff, 0xff, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1d, 0xff, 0xff, 0xc3, 0x03, 0x00, 0x03, 0xc6, 0xff, 0xff, 0x58, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1d, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x25, 0xf4, 0xff, 0xf0, 0x20, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1d, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x68, 0xff, 0xff, 0xc4, 0x04,
+  0x00, 0x00, 0x00, 0x00, 0x1d, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb6, 0xff, 0xff,
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xec,
+  0xff, 0xfc, 0x3c, 0x00, 0x00, 0x00, 0x1d, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x54, 0xff, 0xff, 0xe0, 0x10, 0x00, 0x00, 0x1d, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xa3, 0xff, 0xff, 0xa9, 0x00, 0x00, 0x1d, 0xff, 0xff, 0xa5, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0xe2, 0xff, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x2b, 0x2b, 0x1f, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xb6, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0c, 0xff, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0c, 0xff, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0xff, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
+  0xff, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff,
+  0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff,
+  0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xb6,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xb6, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xb6, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0xc4, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x1b, 0x00, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x00, 0x0c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x2b, 0x2b, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x26, 0x2b, 0x2b, 0x25, 0x00, 0xf5, 0xff, 0xff, 0xf2, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+  0xfd, 0xff, 0xff, 0xdb, 0x00, 0xf5, 0xff, 0xff, 0xff, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81,
+  0xff, 0xff, 0xff, 0xdb, 0x00, 0xf5, 0xff, 0xe0, 0xff, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x04, 0xe4,
+  0xff, 0xdf, 0xff, 0xdb, 0x00, 0xf5, 0xff, 0x86, 0xf8, 0xff, 0x2c, 0x00, 0x00, 0x00, 0x4e, 0xff,
+  0xe9, 0x92, 0xff, 0xdb, 0x00, 0xf5, 0xff, 0x72, 0xa9, 0xff, 0x8f, 0x00, 0x00, 0x00, 0xb3, 0xff,
+  0x8a, 0x8b, 0xff, 0xdb, 0x00, 0xf5, 0xff, 0x72, 0x46, 0xff, 0xec, 0x07, 0x00, 0x1c, 0xfc, 0xfe,
+  0x26, 0x8b, 0xff, 0xdb, 0x00, 0xf5, 0xff, 0x72, 0x02, 0xe0, 0xff, 0x59, 0x00, 0x7e, 0xff, 0xc1,
+  0x00, 0x8b, 0xff, 0xdb, 0x00, 0xf5, 0xff, 0x72, 0x00, 0x7f, 0xff, 0xbd, 0x02, 0xe0, 0xff, 0x5e,
+  0x00, 0x8b, 0xff, 0xdb, 0x00, 0xf5, 0xff, 0x72, 0x00, 0x1e, 0xfd, 0xfe, 0x6c, 0xff, 0xf0, 0x0a,
+  0x00, 0x8b, 0xff, 0xdb, 0x00, 0xf5, 0xff, 0x72, 0x00, 0x00, 0xb6, 0xff, 0xf9, 0xff, 0x97, 0x00,
+  0x00, 0x8b, 0xff, 0xdb, 0x00, 0xf5, 0xff, 0x72, 0x00, 0x00, 0x4f, 0xff, 0xff, 0xff, 0x34, 0x00,
+  0x00, 0x8b, 0xff, 0xdb, 0x00, 0xf5, 0xff, 0x72, 0x00, 0x00, 0x05, 0xe8, 0xff, 0xcf, 0x00, 0x00,
+  0x00, 0x8b, 0xff, 0xdb, 0x00, 0xf5, 0xff, 0x72, 0x00, 0x00, 0x00, 0x39, 0x54, 0x2e, 0x00, 0x00,
+  0x00, 0x8b, 0xff, 0xdb, 0x00, 0xf5, 0xff, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8b, 0xff, 0xdb, 0x00, 0xf5, 0xff, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8b, 0xff, 0xdb, 0x00, 0xf5, 0xff, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8b, 0xff, 0xdb, 0x00, 0xf5, 0xff, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8b, 0xff, 0xdb, 0x00, 0xf5, 0xff, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8b, 0xff, 0xdb, 0x00, 0xf5, 0xff, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8b, 0xff, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x2b, 0x2b, 0x2b, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0x2b, 0x29, 0x00, 0x16, 0xff, 0xff, 0xff, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1,
+  0xff, 0xf4, 0x00, 0x16, 0xff, 0xff, 0xff, 0xfe, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xff,
+  0xf4, 0x00, 0x16, 0xff, 0xff, 0xff, 0xff, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xff, 0xf4,
+  0x00, 0x16, 0xff, 0xff, 0xea, 0xff, 0xf5, 0x13, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xff, 0xf4, 0x00,
+  0x16, 0xff, 0xff, 0x98, 0xe8, 0xff, 0x7a, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xff, 0xf4, 0x00, 0x16,
+  0xff, 0xff, 0x90, 0x7f, 0xff, 0xe5, 0x06, 0x00, 0x00, 0x00, 0xb1, 0xff, 0xf4, 0x00, 0x16, 0xff,
+  0xff, 0x90, 0x16, 0xf7, 0xff, 0x5c, 0x00, 0x00, 0x00, 0xb1, 0xff, 0xf4, 0x00, 0x16, 0xff, 0xff,
+  0x90, 0x00, 0x9d, 0xff, 0xcc, 0x00, 0x00, 0x00, 0xb1, 0xff, 0xf4, 0x00, 0x16, 0xff, 0xff, 0x90,
+  0x00, 0x2d, 0xfe, 0xff, 0x3d, 0x00, 0x00, 0xb1, 0xff, 0xf4, 0x00, 0x16, 0xff, 0xff, 0x90, 0x00,
+  0x00, 0xba, 0xff, 0xad, 0x00, 0x00, 0xb1, 0xff, 0xf4, 0x00, 0x16, 0xff, 0xff, 0x90, 0x00, 0x00,
+  0x4a, 0xff, 0xfc, 0x21, 0x00, 0xb1, 0xff, 0xf4, 0x00, 0x16, 0xff, 0xff, 0x90, 0x00, 0x00, 0x01,
+  0xd7, 0xff, 0x8d, 0x00, 0xb1, 0xff, 0xf4, 0x00, 0x16, 0xff, 0xff, 0x90, 0x00, 0x00, 0x00, 0x68,
+  0xff, 0xf0, 0x0d, 0xb1, 0xff, 0xf4, 0x00, 0x16, 0xff, 0xff, 0x90, 0x00, 0x00, 0x00, 0x0a, 0xec,
+  0xff, 0x6e, 0xb1, 0xff, 0xf4, 0x00, 0x16, 0xff, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00, 0x85, 0xff,
+  0xdd, 0xb4, 0xff, 0xf4, 0x00, 0x16, 0xff, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xfa, 0xff,
+  0xf4, 0xff, 0xf4, 0x00, 0x16, 0xff, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xff, 0xff,
+  0xff, 0xf4, 0x00, 0x16, 0xff, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xff, 0xff, 0xff,
+  0xf4, 0x00, 0x16, 0xff, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0xff, 0xff, 0xf4,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x38, 0x60, 0x4d, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x18, 0xbb, 0xf9, 0xff, 0xff, 0xff, 0xfd, 0xb9, 0x25, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x2c, 0xe1, 0xff, 0xff, 0xec, 0xc1, 0xf2, 0xff, 0xff, 0xed, 0x2a, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xde, 0xff, 0xfd, 0x5e, 0x02, 0x00, 0x05, 0x7b, 0xff, 0xff, 0xc5, 0x00, 0x00, 0x00,
+  0x00, 0x4d, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0xff, 0xff, 0x2e, 0x00, 0x00,
+  0x00, 0xb8, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xff, 0xff, 0x96, 0x00, 0x00,
+  0x06, 0xfd, 0xff, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xf2, 0xff, 0xe0, 0x00, 0x00,
+  0x1e, 0xff, 0xff, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xff, 0xf8, 0x01, 0x00,
+  0x38, 0xff, 0xff, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xff, 0xff, 0x13, 0x00,
+  0x52, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0xff, 0xff, 0x2b, 0x00,
+  0x63, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0xff, 0xff, 0x3c, 0x00,
+  0x4e, 0xff, 0xff, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xff, 0x27, 0x00,
+  0x34, 0xff, 0xff, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc1, 0xff, 0xff, 0x0f, 0x00,
+  0x1a, 0xff, 0xff, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0xff, 0xf5, 0x00, 0x00,
+  0x03, 0xf9, 0xff, 0xde, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xf8, 0xff, 0xd9, 0x00, 0x00,
+  0x00, 0xa8, 0xff, 0xff, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0xff, 0xff, 0x85, 0x00, 0x00,
+  0x00, 0x3f, 0xff, 0xff, 0x99, 0x00, 0x00, 0x00, 0x00, 0x03, 0xb7, 0xff, 0xfc, 0x1f, 0x00, 0x00,
+  0x00, 0x01, 0xd0, 0xff, 0xff, 0x88, 0x1d, 0x00, 0x26, 0xa1, 0xff, 0xff, 0xb1, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x18, 0xca, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xdd, 0x17, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0a, 0x94, 0xd7, 0xfd, 0xff, 0xff, 0xee, 0x95, 0x11, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x36, 0x27, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1c, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x24, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xe7, 0xb1, 0x37, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xff,
+  0xff, 0xf1, 0xef, 0xef, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xa8, 0x05, 0x00, 0x00, 0xa5, 0xff, 0xff,
+  0x1d, 0x00, 0x00, 0x01, 0x1b, 0x6e, 0xec, 0xff, 0xff, 0x85, 0x00, 0x00, 0xa5, 0xff, 0xff, 0x1d,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xfd, 0xff, 0xf0, 0x03, 0x00, 0xa5, 0xff, 0xff, 0x1d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xff, 0xff, 0x2a, 0x00, 0xa5, 0xff, 0xff, 0x1d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0x3a, 0x00, 0xa5, 0xff, 0xff, 0x1d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xc9, 0xff, 0xff, 0x17, 0x00, 0xa5, 0xff, 0xff, 0x1d, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x36, 0xfb, 0xff, 0xe9, 0x00, 0x00, 0xa5, 0xff, 0xff, 0x1d, 0x00, 0x00, 0x00, 0x05, 0x50,
+  0xe3, 0xff, 0xff, 0x7b, 0x00, 0x00, 0xa5, 0xff, 0xff, 0xdc, 0xd7, 0xd7, 0xdc, 0xf6, 0xff, 0xff,
+  0xff, 0xba, 0x02, 0x00, 0x00, 0xa5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xd4, 0x59,
+  0x02, 0x00, 0x00, 0x00, 0xa5, 0xff, 0xff, 0x5e, 0x4a, 0x4a, 0x43, 0x26, 0x09, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xa5, 0xff, 0xff, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xa5, 0xff, 0xff, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xa5, 0xff, 0xff, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xa5, 0xff, 0xff, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5,
+  0xff, 0xff, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xff,
+  0xff, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xff, 0xff,
+  0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x38, 0x60, 0x4d, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+  0xbb, 0xf9, 0xff, 0xff, 0xff, 0xfd, 0xb9, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c,
+  0xe1, 0xff, 0xff, 0xec, 0xc1, 0xf2, 0xff, 0xff, 0xed, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0xde, 0xff, 0xfd, 0x5e, 0x02, 0x00, 0x05, 0x7b, 0xff, 0xff, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x4d, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0xff, 0xff, 0x2e, 0x00, 0x00, 0x00,
+  0x00, 0xb8, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0xff, 0xff, 0x96, 0x00, 0x00,
+  0x00, 0x06, 0xfd, 0xff, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xf2, 0xff, 0xe0, 0x00,
+  0x00, 0x00, 0x1e, 0xff, 0xff, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xff, 0xf8,
+  0x01, 0x00, 0x00, 0x38, 0xff, 0xff, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xff,
+  0xff, 0x13, 0x00, 0x00, 0x52, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad,
+  0xff, 0xff, 0x2b, 0x00, 0x00, 0x63, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xa1, 0xff, 0xff, 0x3c, 0x00, 0x00, 0x4e, 0xff, 0xff, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xaf, 0xff, 0xff, 0x27, 0x00, 0x00, 0x34, 0xff, 0xff, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xc1, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x1a, 0xff, 0xff, 0xad, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xd3, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x03, 0xf9, 0xff, 0xe0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0c, 0xf8, 0xff, 0xda, 0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0x2d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4f, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0xff, 0x9d,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0xba, 0xff, 0xff, 0x29, 0x00, 0x00, 0x00, 0x00, 0x01, 0xd0, 0xff,
+  0xff, 0x89, 0x1d, 0x00, 0x26, 0xa2, 0xff, 0xff, 0xe8, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+  0xca, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa7, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0a, 0x93, 0xd5, 0xfc, 0xff, 0xff, 0xea, 0x92, 0xae, 0xff, 0xff, 0x86, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x30, 0x20, 0x03, 0x00, 0x09, 0xc5, 0xff, 0xff, 0x62, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xd9, 0xff, 0xd7,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0xa5,
+  0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x1a, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xd9, 0x75, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xfb, 0xef, 0xef, 0xef, 0xf7, 0xff, 0xff, 0xff, 0xdc, 0x14,
+  0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xba, 0x00, 0x00, 0x00, 0x00, 0x26, 0x97, 0xff, 0xff, 0xb4,
+  0x01, 0x00, 0x00, 0x08, 0xff, 0xff, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xff, 0xff,
+  0x39, 0x00, 0x00, 0x08, 0xff, 0xff, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0xff, 0xff,
+  0x6f, 0x00, 0x00, 0x08, 0xff, 0xff, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xff, 0xff,
+  0x8d, 0x00, 0x00, 0x08, 0xff, 0xff, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xff, 0xff,
+  0x68, 0x00, 0x00, 0x08, 0xff, 0xff, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xc9, 0xff, 0xfb,
+  0x2a, 0x00, 0x00, 0x08, 0xff, 0xff, 0xcc, 0x41, 0x41, 0x41, 0x54, 0x74, 0xdd, 0xff, 0xff, 0x8d,
+  0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x88, 0x03,
+  0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xf9, 0xe7, 0xeb, 0xee, 0xf9, 0xff, 0xf9, 0x31, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xba, 0x00, 0x00, 0x00, 0x5c, 0xff, 0xff, 0x68, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xba, 0x00, 0x00, 0x00, 0x02, 0xd4, 0xff, 0xe6, 0x0a, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xba, 0x00, 0x00, 0x00, 0x00, 0x55, 0xff, 0xff, 0x76, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xba, 0x00, 0x00, 0x00, 0x00, 0x01, 0xd0, 0xff, 0xed, 0x10,
+  0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xff, 0xff, 0x86,
+  0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xd0, 0xff, 0xf5,
+  0x19, 0x00, 0x00, 0x08, 0xff, 0xff, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xff, 0xff,
+  0x95, 0x00, 0x00, 0x08, 0xff, 0xff, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xce, 0xff,
+  0xf9, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x46, 0x76, 0x88, 0x7d, 0x61, 0x34, 0x04, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x7c, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x92,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0xff, 0xff, 0xf3, 0xb8, 0x9d, 0xa0, 0xc3, 0xf6, 0xff, 0xd5,
+  0x00, 0x00, 0x00, 0x00, 0x63, 0xff, 0xff, 0xaa, 0x14, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x69, 0xb6,
+  0x00, 0x00, 0x00, 0x00, 0xc2, 0xff, 0xdd, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x00, 0x00, 0x00, 0x02, 0xf3, 0xff, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x08, 0xfd, 0xff, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xdd, 0xff, 0xf6, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x6f, 0xff, 0xff, 0xfe, 0xaf, 0x60, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x93, 0x44, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0xb7, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x21,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x44, 0x7e, 0xbd, 0xfa, 0xff, 0xff, 0xe7,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xaf, 0xff, 0xff,
+  0x8d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xe3, 0xff,
+  0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0xff,
+  0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xff,
+  0xee, 0x00, 0x00, 0x00, 0x48, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0xf5, 0xff,
+  0xbf, 0x00, 0x00, 0x00, 0xd6, 0xd9, 0x71, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x43, 0xd6, 0xff, 0xff,
+  0x5b, 0x00, 0x00, 0x00, 0xd6, 0xff, 0xff, 0xff, 0xe1, 0xc4, 0xc9, 0xe8, 0xff, 0xff, 0xff, 0xa0,
+  0x01, 0x00, 0x00, 0x00, 0x4d, 0xad, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0x47, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x26, 0x48, 0x56, 0x4b, 0x2d, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0f, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+  0x2b, 0x2b, 0x2b, 0x09, 0x00, 0x58, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x37, 0x00, 0x57, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xff, 0xff,
+  0xff, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf1, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xf1, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf1, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xff, 0xd0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xff, 0xd0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xff,
+  0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf1, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xf1, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf1, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xff, 0xd0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xff, 0xd0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0xff,
+  0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf1, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x2b, 0x2b,
+  0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x2b, 0x2b, 0x08, 0x00, 0x5c, 0xff, 0xff,
+  0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xff, 0xff, 0x2d, 0x00, 0x5c, 0xff, 0xff,
+  0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xff, 0xff, 0x2d, 0x00, 0x5c, 0xff, 0xff,
+  0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xff, 0xff, 0x2d, 0x00, 0x5c, 0xff, 0xff,
+  0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xff, 0xff, 0x2d, 0x00, 0x5c, 0xff, 0xff,
+  0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xff, 0xff, 0x2d, 0x00, 0x5c, 0xff, 0xff,
+  0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xff, 0xff, 0x2d, 0x00, 0x5c, 0xff, 0xff,
+  0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xff, 0xff, 0x2d, 0x00, 0x5c, 0xff, 0xff,
+  0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xff, 0xff, 0x2d, 0x00, 0x5c, 0xff, 0xff,
+  0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xff, 0xff, 0x2d, 0x00, 0x5c, 0xff, 0xff,
+  0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xff, 0xff, 0x2d, 0x00, 0x5c, 0xff, 0xff,
+  0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xff, 0xff, 0x2d, 0x00, 0x5b, 0xff, 0xff,
+  0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xff, 0xff, 0x2d, 0x00, 0x53, 0xff, 0xff,
+  0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0xff, 0xff, 0x29, 0x00, 0x46, 0xff, 0xff,
+  0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0xff, 0xff, 0x1f, 0x00, 0x2f, 0xff, 0xff,
+  0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0xfd, 0x09, 0x00, 0x09, 0xf6, 0xff,
+  0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xdd, 0xff, 0xd8, 0x00, 0x00, 0x00, 0xa2, 0xff,
+  0xff, 0x87, 0x0a, 0x00, 0x00, 0x00, 0x13, 0xaa, 0xff, 0xff, 0x79, 0x00, 0x00, 0x00, 0x18, 0xdd,
+  0xff, 0xff, 0xf6, 0xcc, 0xbe, 0xd0, 0xfb, 0xff, 0xff, 0xc4, 0x08, 0x00, 0x00, 0x00, 0x00, 0x13,
+  0x92, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0x80, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x05, 0x2b, 0x4c, 0x59, 0x53, 0x34, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x2b, 0x2b,
+  0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x2b, 0x2b, 0x02, 0x00, 0x0a,
+  0xf5, 0xff, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0xff, 0xdd, 0x00,
+  0x00, 0x00, 0xaf, 0xff, 0xef, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xff, 0xff,
+  0x8e, 0x00, 0x00, 0x00, 0x60, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67,
+  0xff, 0xff, 0x3e, 0x00, 0x00, 0x00, 0x14, 0xfc, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xb3, 0xff, 0xea, 0x03, 0x00, 0x00, 0x00, 0x00, 0xc2, 0xff, 0xd7, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x09, 0xf5, 0xff, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0xff, 0xff, 0x24, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4b, 0xff, 0xff, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0xff, 0xff,
+  0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0xff, 0xf4, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xd5, 0xff, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xff, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x86, 0xff, 0xf9, 0x0d, 0x00, 0x00, 0x00, 0x2b, 0xff, 0xff, 0x5e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x36, 0xff, 0xff, 0x53, 0x00, 0x00, 0x00, 0x76, 0xff, 0xfb, 0x13, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe5, 0xff, 0x9e, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xbf,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0xff, 0xe8, 0x02, 0x00, 0x10, 0xfb,
+  0xff, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xff, 0xff, 0x35, 0x00,
+  0x57, 0xff, 0xff, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xf1, 0xff,
+  0x80, 0x00, 0xa3, 0xff, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xa7, 0xff, 0xca, 0x03, 0xec, 0xff, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x57, 0xff, 0xfd, 0x54, 0xff, 0xff, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0xf8, 0xff, 0xdf, 0xff, 0xe3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xff, 0xff, 0xff, 0x95, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xff, 0xff, 0xff, 0x46, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x2b, 0x12, 0x00, 0x00, 0x00, 0x05, 0x2b, 0x2b,
+  0x29, 0x00, 0x00, 0x00, 0x00, 0x19, 0x2b, 0x21, 0x00, 0xd6, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x38,
+  0xff, 0xff, 0xff, 0x0f, 0x00, 0x00, 0x00, 0xa7, 0xff, 0xb0, 0x00, 0xad, 0xff, 0xa3, 0x00, 0x00,
+  0x00, 0x62, 0xff, 0xff, 0xff, 0x36, 0x00, 0x00, 0x00, 0xca, 0xff, 0x89, 0x00, 0x84, 0xff, 0xc7,
+  0x00, 0x00, 0x00, 0x89, 0xff, 0xfb, 0xff, 0x5e, 0x00, 0x00, 0x00, 0xed, 0xff, 0x62, 0x00, 0x5c,
+  0xff, 0xeb, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xb8, 0xff, 0x86, 0x00, 0x00, 0x11, 0xff, 0xff, 0x3b,
+  0x00, 0x33, 0xff, 0xff, 0x10, 0x00, 0x00, 0xd4, 0xff, 0x5f, 0xff, 0xad, 0x00, 0x00, 0x34, 0xff,
+  0xff, 0x13, 0x00, 0x0c, 0xfe, 0xff, 0x33, 0x00, 0x03, 0xf7, 0xee, 0x17, 0xff, 0xd4, 0x00, 0x00,
+  0x57, 0xff, 0xe9, 0x00, 0x00, 0x00, 0xe2, 0xff, 0x56, 0x00, 0x22, 0xff, 0xc5, 0x00, 0xec, 0xf8,
+  0x03, 0x00, 0x7a, 0xff, 0xc1, 0x00, 0x00, 0x00, 0xbb, 0xff, 0x7a, 0x00, 0x48, 0xff, 0x9d, 0x00,
+  0xc3, 0xff, 0x22, 0x00, 0x9d, 0xff, 0x99, 0x00, 0x00, 0x00, 0x94, 0xff, 0x9d, 0x00, 0x6f, 0xff,
+  0x75, 0x00, 0x99, 0xff, 0x49, 0x00, 0xc0, 0xff, 0x71, 0x00, 0x00, 0x00, 0x6d, 0xff, 0xc0, 0x00,
+  0x96, 0xff, 0x4d, 0x00, 0x6e, 0xff, 0x70, 0x00, 0xe3, 0xff, 0x49, 0x00, 0x00, 0x00, 0x46, 0xff,
+  0xe4, 0x00, 0xbc, 0xff, 0x23, 0x00, 0x45, 0xff, 0x97, 0x08, 0xfd, 0xff, 0x21, 0x00, 0x00, 0x00,
+  0x1f, 0xff, 0xfe, 0x09, 0xe4, 0xf6, 0x02, 0x00, 0x1e, 0xff, 0xbe, 0x2a, 0xff, 0xf6, 0x02, 0x00,
+  0x00, 0x00, 0x02, 0xf5, 0xff, 0x38, 0xfe, 0xce, 0x00, 0x00, 0x01, 0xf4, 0xe6, 0x4d, 0xff, 0xcf,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xff, 0x83, 0xff, 0xa4, 0x00, 0x00, 0x00, 0xcb, 0xff, 0x80,
+  0xff, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xff, 0xce, 0xff, 0x7b, 0x00, 0x00, 0x00, 0xa1,
+  0xff, 0xcc, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0xff, 0xfe, 0xff, 0x51, 0x00, 0x00,
+  0x00, 0x76, 0xff, 0xfe, 0xff, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0xff, 0xff, 0xff, 0x27,
+  0x00, 0x00, 0x00, 0x4c, 0xff, 0xff, 0xff, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xff, 0xff,
+  0xf8, 0x04, 0x00, 0x00, 0x00, 0x23, 0xff, 0xff, 0xfe, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
+  0xfc, 0xff, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x03, 0xf7, 0xff, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0c, 0x2b, 0x2b, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x2b,
+  0x2b, 0x04, 0x00, 0x09, 0xd5, 0xff, 0xf1, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e,
+  0xfe, 0xff, 0xb4, 0x00, 0x00, 0x00, 0x30, 0xf8, 0xff, 0xc0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0xd6, 0xff, 0xed, 0x19, 0x00, 0x00, 0x00, 0x00, 0x74, 0xff, 0xff, 0x73, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7e, 0xff, 0xff, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xbc, 0xff, 0xf7, 0x2c,
+  0x00, 0x00, 0x00, 0x29, 0xf8, 0xff, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xed,
+  0xff, 0xcf, 0x06, 0x00, 0x02, 0xc4, 0xff, 0xe7, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x53, 0xff, 0xff, 0x88, 0x00, 0x69, 0xff, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x9a, 0xff, 0xfc, 0x57, 0xf0, 0xff, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xd6, 0xff, 0xff, 0xff, 0xe5, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xfd, 0xff, 0xff, 0x4e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0xff, 0xff, 0xff, 0x7e,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1a, 0xee, 0xff, 0xf4,
+  0xff, 0xf8, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb2, 0xff,
+  0xf7, 0x32, 0xe1, 0xff, 0xc3, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f,
+  0xff, 0xff, 0x77, 0x00, 0x51, 0xff, 0xff, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1d, 0xef, 0xff, 0xcc, 0x04, 0x00, 0x00, 0xb4, 0xff, 0xf2, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x01, 0xb9, 0xff, 0xfa, 0x2f, 0x00, 0x00, 0x00, 0x21, 0xf5, 0xff, 0xb7, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x68, 0xff, 0xff, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xff, 0xff, 0x5d,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0xf2, 0xff, 0xd4, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xd7,
+  0xff, 0xeb, 0x14, 0x00, 0x00, 0x01, 0xbb, 0xff, 0xfc, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x44, 0xff, 0xff, 0xa2, 0x00, 0x00, 0x6a, 0xff, 0xff, 0x8d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xff, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x2b, 0x2b, 0x15, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0x2b, 0x2b, 0x0d, 0x00, 0x20, 0xf4, 0xff,
+  0xd3, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xef, 0xff, 0xe3, 0x0d, 0x00, 0x00,
+  0x72, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xff, 0xff, 0x52, 0x00,
+  0x00, 0x00, 0x04, 0xd0, 0xff, 0xf0, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0xfd, 0xff, 0xb3,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xfd, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc3, 0xff,
+  0xf4, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xff, 0xfe, 0x38, 0x00, 0x00, 0x00, 0x5a,
+  0xff, 0xff, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0xea, 0xff, 0xca, 0x02, 0x00,
+  0x0c, 0xe4, 0xff, 0xcf, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5f, 0xff, 0xff,
+  0x64, 0x00, 0x87, 0xff, 0xfc, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0xc0, 0xff, 0xe9, 0x34, 0xf8, 0xff, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x2a, 0xf9, 0xff, 0xf3, 0xff, 0xe7, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x85, 0xff, 0xff, 0xff, 0x58, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xfb, 0xff, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xc9, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xc9, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff,
+  0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xf8, 0xff, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xf8, 0xff, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b, 0x2b,
+  0x2b, 0x2b, 0x2b, 0x03, 0x00, 0x32, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x11, 0x00, 0x31, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd, 0xfd,
+  0xff, 0xff, 0xfd, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a,
+  0xff, 0xff, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xf9,
+  0xff, 0xcf, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xd0, 0xff,
+  0xf6, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xff, 0xff,
+  0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xfd, 0xff, 0xb4,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xde, 0xff, 0xe8, 0x17,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xff, 0xfe, 0x4b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0xff, 0xff, 0x95, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0xe8, 0xff, 0xd6, 0x09, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0xff, 0xf9, 0x31, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xff, 0xff, 0x75, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0xff, 0xbd, 0x02, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xbf, 0xff, 0xed, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x73, 0xff, 0xff, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xf8, 0xff, 0xbf, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x10, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x57, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0x65, 0x00, 0xf3,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0x00, 0xf3, 0xff, 0xbd, 0x5e, 0x5e, 0x5e, 0x5e,
+  0x5e, 0x39, 0x00, 0xf3, 0xff, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xff, 0x96,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xff, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xf3, 0xff, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xff, 0x96, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xff, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3,
+  0xff, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xff, 0x96, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xf3, 0xff, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xff, 0x96,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xff, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xf3, 0xff, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xff, 0x96, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xff, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3,
+  0xff, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xff, 0x96, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xf3, 0xff, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xff, 0x96,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf3, 0xff, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xf3, 0xff, 0xd4, 0x96, 0x96, 0x96, 0x96, 0x96, 0x5b, 0x00, 0xf3, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x9a, 0x00, 0x70, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x47, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x5f, 0x5f, 0x27, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xda, 0xff, 0xbf, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xff, 0xff, 0x3e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xda, 0xff, 0xbc, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xff, 0xff, 0x3b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xda, 0xff, 0xbb, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xff, 0xff, 0x3d,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xda, 0xff, 0xbe,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xff, 0xff,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xda, 0xff,
+  0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xff,
+  0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xde,
+  0xff, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65,
+  0xff, 0xff, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0xdf, 0xff, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x65, 0xff, 0xff, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0xdf, 0xff, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x66, 0xff, 0xff, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x06, 0xe1, 0xff, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x68, 0xff, 0xff, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x07, 0xe2, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x69, 0xff, 0xff, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0xe2, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x27, 0x42, 0x41, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7,
+  0xa7, 0x7c, 0x00, 0xc9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0x00, 0x4a, 0x5e, 0x5e,
+  0x5e, 0x5e, 0x5e, 0xda, 0xff, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xff, 0xbd,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xff, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xc5, 0xff, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xff, 0xbd, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xff, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5,
+  0xff, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xff, 0xbd, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xc5, 0xff, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xff, 0xbd,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xff, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xc5, 0xff, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xff, 0xbd, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xff, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5,
+  0xff, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xff, 0xbd, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xc5, 0xff, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xff, 0xbd,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xff, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xc5, 0xff, 0xbd, 0x00, 0x7c, 0x9d, 0x9d, 0x9d, 0x9d, 0x9d, 0xe9, 0xff, 0xbd, 0x00, 0xc9,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0x00, 0x57, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
+  0x6f, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x24, 0x2b, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x49, 0xfe, 0xff, 0xf5, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1d, 0xeb, 0xff, 0xfe, 0xff, 0xd8, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0xc5, 0xff, 0xeb, 0x4c, 0xf9, 0xff, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x8e, 0xff, 0xff, 0x51, 0x00, 0x73, 0xff, 0xff, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52,
+  0xfe, 0xff, 0x9a, 0x00, 0x00, 0x02, 0xbd, 0xff, 0xf8, 0x33, 0x00, 0x00, 0x00, 0x00, 0x23, 0xf0,
+  0xff, 0xd8, 0x0b, 0x00, 0x00, 0x00, 0x1d, 0xed, 0xff, 0xdc, 0x0f, 0x00, 0x00, 0x08, 0xcd, 0xff,
+  0xf9, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xff, 0xff, 0xac, 0x01, 0x00, 0x0b, 0x29, 0x29,
+  0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x25, 0x29, 0x29, 0x05, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xa4, 0xa4,
+  0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0xa4, 0x13,
+  0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x1e, 0x00, 0x1b, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f,
+  0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x6f, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0e, 0x0e,
+  0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xed, 0xff, 0xe8, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x54, 0xff, 0xff, 0xb3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0xff, 0xff, 0x69, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0f, 0xe0, 0xff, 0xf5, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xfc, 0xff,
+  0xce, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x9a, 0x9a, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xae, 0xb2, 0xb5, 0xb9, 0xb7, 0xa2, 0x71, 0x20,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x96,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x09, 0x4c, 0x45, 0x42, 0x42, 0x4b, 0x6a, 0xc4, 0xff, 0xff, 0xa0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0xff, 0xfe, 0x25,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0xff, 0xff, 0x62, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x17, 0x1b, 0x1b, 0x25, 0xff, 0xff, 0x7a, 0x00, 0x00,
+  0x00, 0x03, 0x50, 0xaa, 0xe1, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x82, 0x00, 0x00, 0x0f,
+  0xba, 0xff, 0xff, 0xfd, 0xe0, 0xcb, 0xc7, 0xc7, 0xc9, 0xff, 0xff, 0x84, 0x00, 0x00, 0x92, 0xff,
+  0xfe, 0x89, 0x18, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xff, 0x84, 0x00, 0x01, 0xf3, 0xff, 0xa5,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xff, 0xff, 0x84, 0x00, 0x18, 0xff, 0xff, 0x6b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0xff, 0xff, 0x84, 0x00, 0x06, 0xf9, 0xff, 0x87, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x06, 0xd7, 0xff, 0xff, 0x84, 0x00, 0x00, 0xcb, 0xff, 0xf0, 0x32, 0x00, 0x00,
+  0x00, 0x13, 0xb0, 0xff, 0xff, 0xff, 0x84, 0x00, 0x00, 0x35, 0xf9, 0xff, 0xfd, 0xc2, 0x9f, 0xb5,
+  0xf2, 0xff, 0xce, 0xcc, 0xff, 0x84, 0x00, 0x00, 0x00, 0x3f, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xf9,
+  0x9c, 0x15, 0xc1, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x23, 0x49, 0x51, 0x3b, 0x09, 0x00,
+  0x00, 0x01, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x45, 0xb9, 0xb9, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x60, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x60, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x60, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x60, 0xff, 0xff, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
+  0xff, 0xff, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff,
+  0xff, 0x24, 0x0d, 0x67, 0xa5, 0xb5, 0x9d, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0xff,
+  0x4b, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0x19, 0x00, 0x00, 0x00, 0x60, 0xff, 0xff, 0xea,
+  0xff, 0xaa, 0x58, 0x4c, 0x7a, 0xe8, 0xff, 0xc7, 0x03, 0x00, 0x00, 0x60, 0xff, 0xff, 0xff, 0x7b,
+  0x00, 0x00, 0x00, 0x00, 0x1e, 0xe9, 0xff, 0x59, 0x00, 0x00, 0x60, 0xff, 0xff, 0xd8, 0x02, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x6d, 0xff, 0xb6, 0x00, 0x00, 0x60, 0xff, 0xff, 0x88, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1c, 0xff, 0xf4, 0x02, 0x00, 0x60, 0xff, 0xff, 0x61, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xf2, 0xff, 0x1d, 0x00, 0x60, 0xff, 0xff, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xe2, 0xff, 0x2e, 0x00, 0x60, 0xff, 0xff, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xe5, 0xff, 0x29, 0x00, 0x60, 0xff, 0xff, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05,
+  0xfb, 0xff, 0x10, 0x00, 0x60, 0xff, 0xff, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xff,
+  0xe0, 0x00, 0x00, 0x60, 0xff, 0xff, 0xf2, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xff, 0x93,
+  0x00, 0x00, 0x60, 0xff, 0xff, 0xff, 0xc1, 0x13, 0x00, 0x00, 0x00, 0x61, 0xfd, 0xfb, 0x25, 0x00,
+  0x00, 0x60, 0xff, 0xff, 0x96, 0xff, 0xf2, 0xb2, 0xa6, 0xd4, 0xff, 0xff, 0x73, 0x00, 0x00, 0x00,
+  0x60, 0xff, 0xf4, 0x01, 0x74, 0xf0, 0xff, 0xff, 0xff, 0xea, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x2b, 0x51, 0x3a, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x22, 0x78, 0x9b, 0xb5, 0xb3, 0x8f, 0x49, 0x04, 0x00, 0x00, 0x00, 0x00, 0x10, 0xab, 0xfe,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0x0e, 0x00, 0x00, 0x12, 0xda, 0xff, 0xff, 0xc9, 0x6e,
+  0x4e, 0x50, 0x79, 0xd5, 0xff, 0x15, 0x00, 0x00, 0xa6, 0xff, 0xfe, 0x71, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x70, 0x11, 0x00, 0x20, 0xfe, 0xff, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x73, 0xff, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x9e, 0xff, 0xfe, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8,
+  0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xf1,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xff, 0xff, 0x15, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xff, 0xff, 0x61, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xf1, 0xff, 0xdb, 0x0a, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x04, 0x00, 0x00, 0x66, 0xff, 0xff, 0xc5, 0x26, 0x00, 0x00, 0x00, 0x00, 0x31,
+  0xbe, 0x15, 0x00, 0x00, 0x01, 0x8e, 0xff, 0xff, 0xfd, 0xc9, 0xa9, 0xab, 0xd7, 0xff, 0xff, 0x15,
+  0x00, 0x00, 0x00, 0x00, 0x4e, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0x7d, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x3e, 0x54, 0x41, 0x23, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xb2, 0xb2, 0x2c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x45, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x45, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x45, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x45, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x45, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x02, 0x4e, 0x83, 0xb0, 0xa4, 0x62, 0x08, 0x45,
+  0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x10, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x5d, 0xff,
+  0xff, 0x3f, 0x00, 0x00, 0x02, 0xce, 0xff, 0xfe, 0x9c, 0x53, 0x51, 0x96, 0xfc, 0xeb, 0xff, 0xff,
+  0x3f, 0x00, 0x00, 0x58, 0xff, 0xff, 0x71, 0x00, 0x00, 0x00, 0x00, 0x65, 0xff, 0xff, 0xff, 0x3f,
+  0x00, 0x00, 0xd3, 0xff, 0xdb, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0xd0, 0xff, 0xff, 0x3f, 0x00,
+  0x0a, 0xfe, 0xff, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0x3f, 0x00, 0x2b,
+  0xff, 0xff, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0xff, 0xff, 0x3f, 0x00, 0x4b, 0xff,
+  0xff, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xff, 0xff, 0x3f, 0x00, 0x49, 0xff, 0xff,
+  0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0xff, 0xff, 0x3f, 0x00, 0x2d, 0xff, 0xff, 0x79,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xff, 0xff, 0x3f, 0x00, 0x05, 0xf4, 0xff, 0xaa, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0xff, 0xff, 0x3f, 0x00, 0x00, 0xaf, 0xff, 0xf2, 0x14, 0x00,
+  0x00, 0x00, 0x00, 0x10, 0xed, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x40, 0xff, 0xff, 0xb8, 0x0c, 0x00,
+  0x00, 0x09, 0xae, 0xff, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x97, 0xff, 0xff, 0xeb, 0xae, 0xac,
+  0xe8, 0xfd, 0x99, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x03, 0x7e, 0xf1, 0xff, 0xff, 0xff, 0xec,
+  0x5d, 0x15, 0xff, 0xff, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x3d, 0x51, 0x27, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x63, 0x93, 0xb1, 0x9d, 0x71, 0x35, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x98,
+  0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0xff, 0xff, 0xe1, 0x77, 0x4d, 0x53, 0x91, 0xf6, 0xff,
+  0xc2, 0x01, 0x00, 0x00, 0x00, 0x2f, 0xfa, 0xff, 0xbd, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x40, 0xfc,
+  0xff, 0x55, 0x00, 0x00, 0x00, 0xa8, 0xff, 0xf2, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6,
+  0xff, 0xcc, 0x00, 0x00, 0x06, 0xf1, 0xff, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65,
+  0xff, 0xf4, 0x01, 0x00, 0x27, 0xff, 0xff, 0xba, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0xa3,
+  0xff, 0xff, 0x1a, 0x00, 0x42, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x33, 0x00, 0x35, 0xff, 0xff, 0x95, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b, 0x5b,
+  0x5b, 0x5b, 0x12, 0x00, 0x0b, 0xfd, 0xff, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xff, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xff, 0xff, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0xd2, 0xff, 0xee, 0x61, 0x01, 0x00, 0x00, 0x00, 0x01, 0x37,
+  0x97, 0x96, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xd7, 0xff, 0xff, 0xe8, 0xbe, 0xa3, 0xb6, 0xea, 0xff,
+  0xff, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x7a, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee,
+  0xa8, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x3c, 0x56, 0x4c, 0x29, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x20, 0x20,
+  0x20, 0x20, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x94, 0xeb, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xff, 0xff, 0xf5, 0xdf, 0xde,
+  0xde, 0xde, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0xff, 0xff, 0x69, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xff, 0xec, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0xff, 0xdc, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xff, 0xdb, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x0b, 0x0b, 0x0b, 0x0b, 0xb2, 0xff, 0xdd, 0x0b, 0x0b, 0x0b, 0x0b,
+  0x05, 0x00, 0x00, 0x00, 0x32, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x7b, 0x00, 0x00, 0x00, 0x32, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x7b, 0x00, 0x00, 0x00, 0x04, 0x17, 0x17, 0x17, 0x17, 0xb6, 0xff, 0xde, 0x17, 0x17, 0x17, 0x17,
+  0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xff, 0xdb, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xff, 0xdb, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xff, 0xdb, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xff, 0xdb, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xff, 0xdb, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xff, 0xdb, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xff, 0xdb, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xff, 0xdb, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xff, 0xdb, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xff, 0xdb, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0x89, 0xae, 0xb2, 0x90, 0x3e, 0x00, 0x36, 0x54,
+  0x34, 0x00, 0x00, 0x01, 0x86, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xad, 0xab, 0xff, 0x9e, 0x00,
+  0x00, 0x77, 0xff, 0xff, 0xd7, 0x77, 0x4c, 0x6f, 0xdf, 0xff, 0xfe, 0xff, 0x9b, 0x00, 0x16, 0xf4,
+  0xff, 0xc5, 0x0f, 0x00, 0x00, 0x00, 0x15, 0xe1, 0xff, 0xff, 0x99, 0x00, 0x70, 0xff, 0xff, 0x3d,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xff, 0xff, 0x99, 0x00, 0xb2, 0xff, 0xdc, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1a, 0xff, 0xff, 0x99, 0x00, 0xd7, 0xff, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xf2, 0xff, 0x98, 0x00, 0xe7, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xe5, 0xff, 0x97, 0x00, 0xde, 0xff, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0xff,
+  0x95, 0x00, 0xc0, 0xff, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff, 0x94, 0x00,
+  0x8c, 0xff, 0xf8, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0xff, 0xff, 0x93, 0x00, 0x35, 0xff,
+  0xff, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb9, 0xff, 0xff, 0x91, 0x00, 0x00, 0xb3, 0xff, 0xff,
+  0x89, 0x16, 0x00, 0x1e, 0xa2, 0xff, 0xff, 0xff, 0x8f, 0x00, 0x00, 0x16, 0xdb, 0xff, 0xff, 0xff,
+  0xf0, 0xff, 0xff, 0xf5, 0xdb, 0xff, 0x8e, 0x00, 0x00, 0x00, 0x10, 0x8f, 0xea, 0xff, 0xff, 0xf7,
+  0xba, 0x35, 0xaa, 0xff, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x14, 0x03, 0x00, 0x00,
+  0xb4, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf2, 0xff,
+  0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4d, 0xff, 0xff, 0x53, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xbc, 0xff, 0xe2, 0x07, 0x00, 0x00, 0x1e,
+  0x37, 0x37, 0x38, 0x3e, 0x47, 0x74, 0xcf, 0xff, 0xff, 0x64, 0x00, 0x00, 0x00, 0x8d, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0x03, 0x00, 0x00, 0x00, 0x82, 0xe8, 0xe6, 0xe4, 0xe1,
+  0xdf, 0xd5, 0xa0, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xb2, 0xb2, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x59, 0xff, 0xff, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x59, 0xff, 0xff, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x59, 0xff, 0xff, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xff,
+  0xff, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xff, 0xff, 0x2b,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xff, 0xff, 0x2b, 0x11, 0x74,
+  0xa8, 0xd2, 0xbe, 0x88, 0x15, 0x00, 0x00, 0x00, 0x59, 0xff, 0xff, 0x44, 0xd2, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xe5, 0x1d, 0x00, 0x00, 0x59, 0xff, 0xff, 0xef, 0xfa, 0x9a, 0x60, 0x68, 0xbd, 0xff,
+  0xff, 0xab, 0x00, 0x00, 0x59, 0xff, 0xff, 0xfa, 0x43, 0x00, 0x00, 0x00, 0x02, 0xb9, 0xff, 0xfc,
+  0x0f, 0x00, 0x59, 0xff, 0xff, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0xff, 0xff, 0x3d, 0x00,
+  0x59, 0xff, 0xff, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0xff, 0xff, 0x53, 0x00, 0x59, 0xff,
+  0xff, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xff, 0xff, 0x5b, 0x00, 0x59, 0xff, 0xff, 0x2b,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xff, 0xff, 0x5b, 0x00, 0x59, 0xff, 0xff, 0x2b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x29, 0xff, 0xff, 0x5b, 0x00, 0x59, 0xff, 0xff, 0x2b, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x29, 0xff, 0xff, 0x5b, 0x00, 0x59, 0xff, 0xff, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29,
+  0xff, 0xff, 0x5b, 0x00, 0x59, 0xff, 0xff, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xff, 0xff,
+  0x5b, 0x00, 0x59, 0xff, 0xff, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xff, 0xff, 0x5b, 0x00,
+  0x59, 0xff, 0xff, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xff, 0xff, 0x5b, 0x00, 0x59, 0xff,
+  0xff, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xff, 0xff, 0x5b, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xfb, 0xfc,
+  0x73, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x40, 0xfc, 0xfd,
+  0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x2d, 0x62, 0x62, 0x62, 0x62, 0x62, 0x31, 0x00, 0x76, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x80, 0x00, 0x55, 0xb8, 0xb8, 0xb8, 0xfe, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff,
+  0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff,
+  0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff,
+  0x79, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xff,
+  0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff,
+  0x86, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0x86, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff,
+  0x83, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0xfc, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xd6, 0xff, 0xeb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xfd,
+  0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x62, 0x62, 0x62, 0x62,
+  0x62, 0x62, 0x0b, 0x00, 0x00, 0x00, 0x57, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1d, 0x00, 0x00,
+  0x00, 0x3f, 0xb8, 0xb8, 0xb8, 0xd5, 0xff, 0xff, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x67, 0xff, 0xff, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xff, 0xff, 0x1d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xff, 0xff, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x67, 0xff, 0xff, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xff, 0xff, 0x1d,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xff, 0xff, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x67, 0xff, 0xff, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xff, 0xff,
+  0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xff, 0xff, 0x1d, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x67, 0xff, 0xff, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xff,
+  0xff, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xff, 0xff, 0x1d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x67, 0xff, 0xff, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87,
+  0xff, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xff, 0xed, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x21, 0xf5, 0xff, 0xc4, 0x00, 0x00, 0x3b, 0x4c, 0x4c, 0x4c, 0x84, 0xf7,
+  0xff, 0xff, 0x58, 0x00, 0x00, 0xc5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0x04, 0x00, 0x00,
+  0xb0, 0xe3, 0xe3, 0xe3, 0xdb, 0xb2, 0x6d, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xf5, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xff, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xe8, 0xff, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xe8, 0xff, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xe8, 0xff, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xe8, 0xff, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x57, 0x62, 0x61, 0x0d, 0x00, 0x00,
+  0xe8, 0xff, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x07, 0xa8, 0xff, 0xfa, 0x5f, 0x00, 0x00, 0x00, 0xe8,
+  0xff, 0xaf, 0x00, 0x00, 0x00, 0x10, 0xbf, 0xff, 0xf3, 0x48, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xff,
+  0xaf, 0x00, 0x00, 0x19, 0xd0, 0xff, 0xea, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xff, 0xaf,
+  0x00, 0x25, 0xde, 0xff, 0xde, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xff, 0xaf, 0x34,
+  0xea, 0xff, 0xcf, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xff, 0xdc, 0xf3, 0xff,
+  0xff, 0xaf, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xff, 0xff, 0xff, 0xd6, 0xff,
+  0xff, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xff, 0xff, 0x83, 0x04, 0xbb, 0xff,
+  0xfc, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xff, 0xb7, 0x00, 0x00, 0x16, 0xe5, 0xff,
+  0xe9, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xff, 0xaf, 0x00, 0x00, 0x00, 0x3d, 0xfb, 0xff,
+  0xc6, 0x06, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xff, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x75, 0xff, 0xff,
+  0x92, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xff, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb0, 0xff, 0xff,
+  0x59, 0x00, 0x00, 0x00, 0xe8, 0xff, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xdd, 0xff, 0xf4,
+  0x2c, 0x00, 0x00, 0xe8, 0xff, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0xf8, 0xff, 0xd9,
+  0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x07, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x0d, 0x00, 0x25, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x3f, 0x00, 0x23, 0xef, 0xef, 0xef, 0xf5, 0xff, 0xff, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x56, 0xff, 0xff, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0xff, 0xff, 0x37, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x51, 0xff, 0xff, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xff, 0xff, 0x33, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x51, 0xff, 0xff, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xff, 0xff,
+  0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xff, 0xff, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51,
+  0xff, 0xff, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xff, 0xff, 0x33, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x51, 0xff, 0xff, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xff, 0xff, 0x33, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x51, 0xff, 0xff, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xff, 0xff, 0x33,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xff, 0xff, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xff,
+  0xff, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xff, 0xff, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x51, 0xff, 0xff, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x62,
+  0x15, 0x41, 0x87, 0xac, 0x6c, 0x04, 0x00, 0x38, 0x81, 0xae, 0x88, 0x20, 0x00, 0x00, 0xe0, 0xff,
+  0x99, 0xfd, 0xff, 0xff, 0xff, 0x86, 0x6c, 0xfc, 0xff, 0xff, 0xff, 0xe5, 0x17, 0x00, 0xe0, 0xff,
+  0xfb, 0x7d, 0x47, 0x93, 0xff, 0xfe, 0xff, 0xaf, 0x4c, 0x67, 0xf8, 0xff, 0x66, 0x00, 0xe0, 0xff,
+  0xb0, 0x00, 0x00, 0x01, 0xe3, 0xff, 0xe3, 0x02, 0x00, 0x00, 0xa5, 0xff, 0xa9, 0x00, 0xe0, 0xff,
+  0x85, 0x00, 0x00, 0x00, 0xbd, 0xff, 0xba, 0x00, 0x00, 0x00, 0x82, 0xff, 0xc1, 0x00, 0xe0, 0xff,
+  0x72, 0x00, 0x00, 0x00, 0xad, 0xff, 0xac, 0x00, 0x00, 0x00, 0x75, 0xff, 0xd0, 0x00, 0xe0, 0xff,
+  0x6c, 0x00, 0x00, 0x00, 0xab, 0xff, 0xa2, 0x00, 0x00, 0x00, 0x6b, 0xff, 0xdf, 0x00, 0xe0, 0xff,
+  0x6b, 0x00, 0x00, 0x00, 0xab, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x69, 0xff, 0xe2, 0x00, 0xe0, 0xff,
+  0x6b, 0x00, 0x00, 0x00, 0xab, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x69, 0xff, 0xe2, 0x00, 0xe0, 0xff,
+  0x6b, 0x00, 0x00, 0x00, 0xab, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x69, 0xff, 0xe2, 0x00, 0xe0, 0xff,
+  0x6b, 0x00, 0x00, 0x00, 0xab, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x69, 0xff, 0xe2, 0x00, 0xe0, 0xff,
+  0x6b, 0x00, 0x00, 0x00, 0xab, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x69, 0xff, 0xe2, 0x00, 0xe0, 0xff,
+  0x6b, 0x00, 0x00, 0x00, 0xab, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x69, 0xff, 0xe2, 0x00, 0xe0, 0xff,
+  0x6b, 0x00, 0x00, 0x00, 0xab, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x69, 0xff, 0xe2, 0x00, 0xe0, 0xff,
+  0x6b, 0x00, 0x00, 0x00, 0xab, 0xff, 0x9f, 0x00, 0x00, 0x00, 0x69, 0xff, 0xe2, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x62,
+  0x5c, 0x00, 0x01, 0x3a, 0x76, 0xac, 0x97, 0x66, 0x06, 0x00, 0x00, 0x00, 0x59, 0xff, 0xfe, 0x0a,
+  0x96, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc9, 0x18, 0x00, 0x00, 0x59, 0xff, 0xff, 0xac, 0xfa, 0x99,
+  0x64, 0x6c, 0xc6, 0xff, 0xff, 0x94, 0x00, 0x00, 0x59, 0xff, 0xff, 0xfb, 0x3c, 0x00, 0x00, 0x00,
+  0x04, 0xc3, 0xff, 0xf6, 0x0d, 0x00, 0x59, 0xff, 0xff, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d,
+  0xff, 0xff, 0x2e, 0x00, 0x59, 0xff, 0xff, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xff, 0xff,
+  0x4b, 0x00, 0x59, 0xff, 0xff, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xff, 0xff, 0x5b, 0x00,
+  0x59, 0xff, 0xff, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xff, 0xff, 0x5b, 0x00, 0x59, 0xff,
+  0xff, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xff, 0xff, 0x5b, 0x00, 0x59, 0xff, 0xff, 0x2b,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xff, 0xff, 0x5b, 0x00, 0x59, 0xff, 0xff, 0x2b, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x29, 0xff, 0xff, 0x5b, 0x00, 0x59, 0xff, 0xff, 0x2b, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x29, 0xff, 0xff, 0x5b, 0x00, 0x59, 0xff, 0xff, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29,
+  0xff, 0xff, 0x5b, 0x00, 0x59, 0xff, 0xff, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xff, 0xff,
+  0x5b, 0x00, 0x59, 0xff, 0xff, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xff, 0xff, 0x5b, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x27, 0x67, 0x93, 0xb1, 0x8c, 0x60, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+  0x77, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x94, 0xff,
+  0xff, 0xd0, 0x74, 0x50, 0x7c, 0xe0, 0xff, 0xff, 0x6d, 0x00, 0x00, 0x00, 0x24, 0xfa, 0xff, 0xbe,
+  0x0b, 0x00, 0x00, 0x00, 0x18, 0xd4, 0xff, 0xeb, 0x0e, 0x00, 0x00, 0x9d, 0xff, 0xff, 0x31, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x55, 0xff, 0xff, 0x78, 0x00, 0x00, 0xd0, 0xff, 0xce, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x05, 0xf1, 0xff, 0xab, 0x00, 0x00, 0xf1, 0xff, 0xac, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xd1, 0xff, 0xcd, 0x00, 0x11, 0xff, 0xff, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xb4, 0xff, 0xef, 0x00, 0x09, 0xfe, 0xff, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xbf, 0xff, 0xe4, 0x00, 0x00, 0xe6, 0xff, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xdc, 0xff, 0xc1, 0x00, 0x00, 0xc6, 0xff, 0xe7, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xfb,
+  0xff, 0x9f, 0x00, 0x00, 0x78, 0xff, 0xff, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xff, 0xff,
+  0x50, 0x00, 0x00, 0x0a, 0xe6, 0xff, 0xf1, 0x41, 0x00, 0x00, 0x00, 0x5d, 0xfa, 0xff, 0xc8, 0x01,
+  0x00, 0x00, 0x00, 0x51, 0xf4, 0xff, 0xfd, 0xd2, 0xab, 0xdb, 0xff, 0xff, 0xe9, 0x35, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x25, 0xc2, 0xfd, 0xff, 0xff, 0xff, 0xfc, 0xb3, 0x18, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0a, 0x33, 0x50, 0x2e, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x62, 0x57,
+  0x00, 0x0f, 0x58, 0x92, 0xab, 0x79, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xff, 0xfa, 0x1a,
+  0xd1, 0xff, 0xff, 0xff, 0xff, 0xff, 0x95, 0x05, 0x00, 0x00, 0x00, 0x67, 0xff, 0xff, 0xe1, 0xff,
+  0xc6, 0x6f, 0x54, 0x8b, 0xf8, 0xff, 0xa9, 0x00, 0x00, 0x00, 0x67, 0xff, 0xff, 0xff, 0xaa, 0x06,
+  0x00, 0x00, 0x00, 0x44, 0xfd, 0xfe, 0x30, 0x00, 0x00, 0x67, 0xff, 0xff, 0xfc, 0x1e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xb7, 0xff, 0xa7, 0x00, 0x00, 0x67, 0xff, 0xff, 0xbd, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x62, 0xff, 0xdd, 0x00, 0x00, 0x67, 0xff, 0xff, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x45, 0xff, 0xf9, 0x03, 0x00, 0x67, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2e, 0xff, 0xff, 0x1b, 0x00, 0x67, 0xff, 0xff, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36,
+  0xff, 0xff, 0x0f, 0x00, 0x67, 0xff, 0xff, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4e, 0xff,
+  0xed, 0x00, 0x00, 0x67, 0xff, 0xff, 0xd8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xff, 0xcb,
+  0x00, 0x00, 0x67, 0xff, 0xff, 0xff, 0x42, 0x00, 0x00, 0x00, 0x00, 0x01, 0xdc, 0xff, 0x78, 0x00,
+  0x00, 0x67, 0xff, 0xff, 0xff, 0xe5, 0x2d, 0x00, 0x00, 0x03, 0x9b, 0xff, 0xed, 0x0d, 0x00, 0x00,
+  0x67, 0xff, 0xff, 0xa5, 0xff, 0xfa, 0xc9, 0xaf, 0xe5, 0xff, 0xf9, 0x5c, 0x00, 0x00, 0x00, 0x67,
+  0xff, 0xff, 0x1d, 0x83, 0xf3, 0xff, 0xff, 0xff, 0xdd, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x67, 0xff,
+  0xff, 0x1d, 0x00, 0x04, 0x31, 0x4a, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xff, 0xff,
+  0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xff, 0xff, 0x1d,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xff, 0xff, 0x1d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xff, 0xff, 0x1d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xff, 0xff, 0x1d, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xea, 0xea, 0x1b, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x6e, 0xa2, 0x8e, 0x54, 0x0e,
+  0x00, 0x4a, 0x54, 0x22, 0x00, 0x00, 0x00, 0x01, 0x7b, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xd1, 0x16,
+  0xf6, 0xff, 0x69, 0x00, 0x00, 0x00, 0x8b, 0xff, 0xff, 0xac, 0x68, 0x72, 0xc2, 0xff, 0xdd, 0xff,
+  0xff, 0x69, 0x00, 0x00, 0x1d, 0xf8, 0xff, 0x78, 0x00, 0x00, 0x00, 0x03, 0xa1, 0xff, 0xff, 0xff,
+  0x69, 0x00, 0x00, 0x92, 0xff, 0xdc, 0x02, 0x00, 0x00, 0x00, 0x00, 0x14, 0xf8, 0xff, 0xff, 0x69,
+  0x00, 0x00, 0xd0, 0xff, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xff, 0x69, 0x00,
+  0x00, 0xef, 0xff, 0x5d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0xff, 0xff, 0x69, 0x00, 0x0f,
+  0xff, 0xff, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xff, 0xff, 0x69, 0x00, 0x14, 0xff,
+  0xff, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xff, 0xff, 0x69, 0x00, 0x04, 0xf9, 0xff,
+  0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0xff, 0xff, 0x69, 0x00, 0x00, 0xd0, 0xff, 0x95,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xff, 0xff, 0x69, 0x00, 0x00, 0x89, 0xff, 0xf1, 0x0d,
+  0x00, 0x00, 0x00, 0x00, 0x2c, 0xff, 0xff, 0xff, 0x69, 0x00, 0x00, 0x1e, 0xf8, 0xff, 0xb7, 0x0a,
+  0x00, 0x00, 0x1b, 0xd4, 0xff, 0xff, 0xff, 0x69, 0x00, 0x00, 0x00, 0x71, 0xff, 0xff, 0xe7, 0xa8,
+  0xb4, 0xf1, 0xff, 0xac, 0xff, 0xff, 0x69, 0x00, 0x00, 0x00, 0x00, 0x6d, 0xf2, 0xff, 0xff, 0xff,
+  0xfb, 0x91, 0x1c, 0xff, 0xff, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x4b, 0x60, 0x3e, 0x0a,
+  0x00, 0x1b, 0xff, 0xff, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1b, 0xff, 0xff, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b,
+  0xff, 0xff, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff,
+  0xff, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff,
+  0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0xff, 0xff, 0x69,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0xe3, 0xe3, 0x5d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e,
+  0x62, 0x61, 0x00, 0x07, 0x56, 0x98, 0xb2, 0xad, 0x86, 0x3a, 0x00, 0x00, 0x79, 0xff, 0xfd, 0x2d,
+  0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x00, 0x79, 0xff, 0xfb, 0xe2, 0xff, 0xdf, 0x89,
+  0x73, 0x8e, 0xb8, 0xf7, 0xae, 0x00, 0x79, 0xff, 0xff, 0xff, 0x84, 0x08, 0x00, 0x00, 0x00, 0x00,
+  0x20, 0x63, 0x00, 0x79, 0xff, 0xff, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x79, 0xff, 0xff, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xff, 0xfc,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xff, 0xfd, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x79, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x79, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xff,
+  0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xff, 0xff, 0x04, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xff, 0xff, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1f, 0x79, 0x99, 0xb4, 0xaa, 0x92, 0x64, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+  0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x45, 0x00, 0x00, 0x00, 0x73, 0xff, 0xff, 0xca,
+  0x85, 0x4f, 0x51, 0x73, 0xb0, 0xfb, 0x4a, 0x00, 0x00, 0x00, 0xd0, 0xff, 0xea, 0x0d, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1b, 0x1a, 0x00, 0x00, 0x01, 0xf8, 0xff, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xff, 0xd6, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x74, 0xff, 0xff, 0xf5, 0xb1, 0x74, 0x40, 0x0e, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x75, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x8b, 0x1a, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0b, 0x4e, 0x91, 0xca, 0xfb, 0xff, 0xff, 0xf8, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x11, 0x7d, 0xfd, 0xff, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x9d, 0xff, 0xf1, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x92, 0xff, 0xeb, 0x01, 0x00, 0x19, 0xc0, 0x5f, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x42,
+  0xf2, 0xff, 0xad, 0x00, 0x00, 0x1a, 0xff, 0xff, 0xf6, 0xcf, 0xaa, 0xa3, 0xcc, 0xff, 0xff, 0xe3,
+  0x19, 0x00, 0x00, 0x0d, 0x9f, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x98, 0x1e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x16, 0x36, 0x4d, 0x4d, 0x2e, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xc1, 0xc1,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x7f, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff,
+  0x64, 0x62, 0x62, 0x62, 0x62, 0x62, 0x06, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x0f, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xc7, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x0c, 0x00,
+  0x00, 0x80, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x80, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xff, 0xff, 0x04, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0xff, 0xff, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x56, 0xff, 0xff, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xfd, 0xff,
+  0xcb, 0x45, 0x23, 0x1b, 0x1b, 0x1b, 0x1b, 0x08, 0x00, 0x00, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x4a, 0x00, 0x00, 0x06, 0x6a, 0xd1, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4a,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x0e, 0x0e, 0x0e, 0x0e, 0x04, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x5b, 0x47, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x5a, 0x5b, 0x2f, 0x00, 0xb3, 0xff, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0xff, 0x86, 0x00, 0xb3, 0xff, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff,
+  0xff, 0x87, 0x00, 0xb3, 0xff, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0x89,
+  0x00, 0xb3, 0xff, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0xff, 0x8b, 0x00, 0xb3,
+  0xff, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0x8b, 0x00, 0xb3, 0xff, 0xc8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xff, 0x8b, 0x00, 0xb3, 0xff, 0xc8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0xff, 0xff, 0x8b, 0x00, 0xb3, 0xff, 0xc8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0xff, 0xff, 0x8b, 0x00, 0xb0, 0xff, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x19, 0xff, 0xff, 0x8b, 0x00, 0x95, 0xff, 0xfd, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xff,
+  0xff, 0x8b, 0x00, 0x76, 0xff, 0xff, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0xff, 0x8b,
+  0x00, 0x2e, 0xfd, 0xff, 0xd0, 0x4c, 0x04, 0x00, 0x06, 0x84, 0xfe, 0xff, 0xff, 0x8b, 0x00, 0x00,
+  0xa6, 0xff, 0xff, 0xff, 0xe7, 0xc0, 0xf4, 0xff, 0xeb, 0xe8, 0xff, 0x8b, 0x00, 0x00, 0x08, 0x8f,
+  0xfd, 0xff, 0xff, 0xff, 0xff, 0xdd, 0x28, 0xcd, 0xff, 0x8b, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x38,
+  0x5c, 0x44, 0x1a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x62, 0x61, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x13, 0x62, 0x62, 0x27, 0x00, 0x4d, 0xff, 0xff, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x72, 0xff, 0xfe, 0x25, 0x00, 0x04, 0xe8, 0xff, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xd1, 0xff, 0xc3, 0x00, 0x00, 0x00, 0x8c, 0xff, 0xf7, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x30, 0xff, 0xff, 0x62, 0x00, 0x00, 0x00, 0x2b, 0xff, 0xff, 0x67, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x8f, 0xff, 0xf4, 0x0d, 0x00, 0x00, 0x00, 0x00, 0xca, 0xff, 0xc5, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0xe9, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0xff, 0xfe, 0x26, 0x00, 0x00, 0x00,
+  0x4d, 0xff, 0xff, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xf7, 0xff, 0x84, 0x00, 0x00, 0x00,
+  0xab, 0xff, 0xdf, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0xff, 0xe0, 0x02, 0x00, 0x12,
+  0xf8, 0xff, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0xff, 0xff, 0x40, 0x00, 0x68,
+  0xff, 0xfe, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xe2, 0xff, 0x9d, 0x00, 0xc4,
+  0xff, 0xc2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xff, 0xf1, 0x2e, 0xfe,
+  0xff, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0xfe, 0xff, 0xd4, 0xff,
+  0xf3, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0xff, 0xff, 0xff,
+  0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xff, 0xff, 0xff,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5d, 0x62, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x62, 0x4e, 0x00, 0xc7, 0xff, 0xb1, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xff, 0x9f, 0x00, 0x87, 0xff, 0xeb, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xfc, 0xff, 0x60, 0x00, 0x47, 0xff, 0xff,
+  0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xff, 0xff, 0x21, 0x00, 0x0c,
+  0xfa, 0xff, 0x62, 0x00, 0x00, 0x03, 0x48, 0x48, 0x3c, 0x00, 0x00, 0x00, 0x71, 0xff, 0xe0, 0x00,
+  0x00, 0x00, 0xc5, 0xff, 0x9a, 0x00, 0x00, 0x37, 0xff, 0xff, 0xf9, 0x0f, 0x00, 0x00, 0xa6, 0xff,
+  0xa1, 0x00, 0x00, 0x00, 0x86, 0xff, 0xd3, 0x00, 0x00, 0x7d, 0xff, 0xff, 0xff, 0x58, 0x00, 0x00,
+  0xdb, 0xff, 0x62, 0x00, 0x00, 0x00, 0x47, 0xff, 0xfd, 0x0f, 0x00, 0xc3, 0xff, 0xbe, 0xff, 0xa9,
+  0x00, 0x12, 0xfe, 0xff, 0x23, 0x00, 0x00, 0x00, 0x0c, 0xfb, 0xff, 0x46, 0x0f, 0xfb, 0xf5, 0x2c,
+  0xff, 0xf2, 0x08, 0x47, 0xff, 0xe3, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xff, 0x80, 0x51, 0xff,
+  0xb1, 0x00, 0xd3, 0xff, 0x4d, 0x7c, 0xff, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xff, 0xba,
+  0x98, 0xff, 0x62, 0x00, 0x85, 0xff, 0x9e, 0xb1, 0xff, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49,
+  0xff, 0xf1, 0xe0, 0xfd, 0x16, 0x00, 0x37, 0xff, 0xea, 0xe7, 0xff, 0x24, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0e, 0xfb, 0xff, 0xff, 0xc4, 0x00, 0x00, 0x02, 0xe7, 0xff, 0xff, 0xe2, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xca, 0xff, 0xff, 0x76, 0x00, 0x00, 0x00, 0x9a, 0xff, 0xff, 0xa2, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0xff, 0x26, 0x00, 0x00, 0x00, 0x4c, 0xff, 0xff,
+  0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x62, 0x62, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x43, 0x62, 0x62, 0x0d, 0x00, 0x03, 0xb6, 0xff, 0xed, 0x21, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x41, 0xfb, 0xff, 0x95, 0x00, 0x00, 0x00, 0x11, 0xdd, 0xff, 0xcd, 0x09, 0x00, 0x00, 0x00,
+  0x18, 0xe6, 0xff, 0xc4, 0x06, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xf3, 0xff, 0x9e, 0x00, 0x00, 0x05,
+  0xc2, 0xff, 0xe5, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x53, 0xfe, 0xff, 0x68, 0x00, 0x8f,
+  0xff, 0xf8, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0xff, 0xf9, 0x85, 0xff,
+  0xff, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xb9, 0xff, 0xff, 0xff,
+  0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0xfe, 0xff, 0xf1,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xba, 0xff, 0xff, 0xff,
+  0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0xff, 0xfa, 0x8f, 0xff,
+  0xff, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xff, 0xff, 0x72, 0x00, 0x95,
+  0xff, 0xfa, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0xf5, 0xff, 0xab, 0x01, 0x00, 0x06,
+  0xc6, 0xff, 0xe7, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x15, 0xe1, 0xff, 0xd7, 0x0d, 0x00, 0x00, 0x00,
+  0x1c, 0xe9, 0xff, 0xc8, 0x07, 0x00, 0x00, 0x04, 0xbf, 0xff, 0xf2, 0x2a, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x42, 0xfc, 0xff, 0x9d, 0x00, 0x00, 0x8f, 0xff, 0xfe, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7a, 0xff, 0xff, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x65, 0x68, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x5c, 0x64, 0x3e, 0x00, 0x0f, 0xff, 0xff, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xec, 0xff, 0x99, 0x00, 0x11, 0xff, 0xff, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xe7, 0xff, 0x99, 0x00, 0x15, 0xff, 0xff, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3,
+  0xff, 0x9c, 0x00, 0x16, 0xff, 0xff, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0xff,
+  0x9f, 0x00, 0x16, 0xff, 0xff, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0xff, 0xa0,
+  0x00, 0x16, 0xff, 0xff, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0xff, 0xa0, 0x00,
+  0x16, 0xff, 0xff, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0xff, 0xa2, 0x00, 0x16,
+  0xff, 0xff, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0xff, 0xa5, 0x00, 0x16, 0xff,
+  0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0xff, 0xa7, 0x00, 0x0b, 0xfd, 0xff,
+  0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0xff, 0xa7, 0x00, 0x00, 0xdb, 0xff, 0xe2,
+  0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0xff, 0xa7, 0x00, 0x00, 0x77, 0xff, 0xff, 0xc0,
+  0x5f, 0x42, 0x3e, 0x3e, 0x3e, 0x3e, 0xe9, 0xff, 0xa7, 0x00, 0x00, 0x03, 0xb5, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa8, 0x00, 0x00, 0x00, 0x01, 0x62, 0xbb, 0xe5, 0xf8,
+  0xf8, 0xf8, 0xf8, 0xf8, 0xfe, 0xff, 0xab, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xdf, 0xff, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xec, 0xff, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0xfe, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71,
+  0xff, 0xff, 0x49, 0x00, 0x00, 0x00, 0x2e, 0x3e, 0x3f, 0x42, 0x44, 0x45, 0x45, 0x97, 0xfa, 0xff,
+  0xd0, 0x01, 0x00, 0x00, 0x00, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x37,
+  0x00, 0x00, 0x00, 0x00, 0xb7, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xf1, 0xe8, 0xac, 0x33, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x5c, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x69, 0x17, 0x00, 0x00, 0xe1,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x38, 0x00, 0x00, 0x65, 0x73, 0x73,
+  0x73, 0x73, 0x73, 0x73, 0x73, 0xd0, 0xff, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x53, 0xfd, 0xff, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35,
+  0xf5, 0xff, 0xb4, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0xe7, 0xff, 0xd1,
+  0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xd1, 0xff, 0xe7, 0x1e, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xb4, 0xff, 0xf6, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x90, 0xff, 0xfe, 0x56, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x69, 0xff, 0xff, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xfb,
+  0xff, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0xf1, 0xff, 0xbc, 0x05,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0xe0, 0xff, 0xd8, 0x11, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xff, 0xff, 0xf7, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0,
+  0xf0, 0xf0, 0x35, 0x00, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0a, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0x71, 0xc9, 0xe4, 0xf9, 0xff, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36,
+  0xff, 0xff, 0xd0, 0x67, 0x4c, 0x42, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xff, 0xff,
+  0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xff, 0xff, 0x1a, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x96, 0xff, 0xfe, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xb9, 0xff, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x4f, 0xfd,
+  0xff, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0xcc, 0xd4, 0xec, 0xff, 0xff, 0xdf, 0x1e,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xd8, 0x23, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x4b, 0x9a, 0xa4, 0xc2, 0xfc, 0xff, 0xef, 0x2f, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xf9, 0xff, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xb1, 0xff, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x93, 0xff, 0xff, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x88, 0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88,
+  0xff, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xff, 0xff,
+  0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xff, 0xff, 0x1d, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xff, 0xff, 0x4a, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0xfd, 0xff, 0xe5, 0x8c, 0x70, 0x66, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0x15, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x4b, 0xa3, 0xbd, 0xd1, 0xde, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x3f, 0x20, 0x00, 0xd5, 0xff,
+  0x83, 0x00, 0xd5, 0xff, 0x83, 0x00, 0xd5, 0xff, 0x83, 0x00, 0xd5, 0xff, 0x83, 0x00, 0xd5, 0xff,
+  0x83, 0x00, 0xd5, 0xff, 0x83, 0x00, 0xd5, 0xff, 0x83, 0x00, 0xd5, 0xff, 0x83, 0x00, 0xd5, 0xff,
+  0x83, 0x00, 0xd5, 0xff, 0x83, 0x00, 0xd5, 0xff, 0x83, 0x00, 0xd5, 0xff, 0x83, 0x00, 0xd5, 0xff,
+  0x83, 0x00, 0xd5, 0xff, 0x83, 0x00, 0xd5, 0xff, 0x83, 0x00, 0xd5, 0xff, 0x83, 0x00, 0xd5, 0xff,
+  0x83, 0x00, 0xd5, 0xff, 0x83, 0x00, 0xd5, 0xff, 0x83, 0x00, 0xd5, 0xff, 0x83, 0x00, 0xd5, 0xff,
+  0x83, 0x00, 0xd5, 0xff, 0x83, 0x00, 0xd5, 0xff, 0x83, 0x00, 0x0b, 0x0d, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x02, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x36, 0xff, 0xf6, 0xe0, 0xc0, 0x60, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x42, 0x4c, 0x69,
+  0xde, 0xff, 0xf8, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xff,
+  0xff, 0x2f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0xff, 0xff, 0x4e,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xff, 0xff, 0x5a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xff, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xff, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x27, 0xff, 0xff, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x11, 0xfe, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xc4, 0xff, 0xfc, 0x72, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27,
+  0xe3, 0xff, 0xff, 0xf7, 0xd8, 0xcd, 0x59, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0xe6,
+  0xff, 0xff, 0xff, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xfa, 0xff, 0xff, 0xdf,
+  0xb3, 0x9e, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xff, 0xf5, 0x4b, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0xff, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x24, 0xff, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x2a, 0xff, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2a, 0xff, 0xff, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0xff,
+  0xff, 0x5a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0xff, 0xff, 0x49,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xff, 0xff, 0x2a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x15, 0x66, 0x73, 0x95, 0xf1, 0xff, 0xed, 0x09, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x36, 0xff, 0xff, 0xff, 0xff, 0xff, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0xdd, 0xcd, 0xba, 0x9a, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0xb2,
+  0xd6, 0xa3, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xff, 0xff,
+  0xff, 0xff, 0xef, 0x36, 0x00, 0x00, 0x00, 0x00, 0x73, 0xb8, 0x59, 0x00, 0x31, 0xff, 0xfb, 0x69,
+  0x33, 0xa8, 0xff, 0xe9, 0x1e, 0x00, 0x00, 0x00, 0xb2, 0xff, 0x8b, 0x00, 0x8d, 0xff, 0xae, 0x00,
+  0x00, 0x01, 0xae, 0xff, 0xd4, 0x17, 0x00, 0x1f, 0xf6, 0xff, 0x40, 0x00, 0xca, 0xff, 0x6d, 0x00,
+  0x00, 0x00, 0x0d, 0xd1, 0xff, 0xe8, 0xa6, 0xe6, 0xff, 0xbe, 0x00, 0x00, 0x0f, 0x47, 0x1e, 0x00,
+  0x00, 0x00, 0x00, 0x1c, 0xd1, 0xff, 0xff, 0xff, 0xcd, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x5e, 0x2c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const app::FontAtlas proggy_atlas[] = {
+  {14, 12, -4, 1, 32, 95, proggy_atlas_14_glyphs, proggy_atlas_14_coverage},
+  {16, 14, -5, 2, 32, 95, proggy_atlas_16_glyphs, proggy_atlas_16_coverage},
+  {20, 18, -6, 2, 32, 95, proggy_atlas_20_glyphs, proggy_atlas_20_coverage},
+  {24, 22, -7, 3, 32, 95, proggy_atlas_24_glyphs, proggy_atlas_24_coverage},
+  {28, 25, -8, 3, 32, 95, proggy_atlas_28_glyphs, proggy_atlas_28_coverage},
+};
+
+static const int proggy_atlas_count = 5;
+
+#endif // FONT_PROGGY_ATLAS_HPP
@@ -0,0 +1,38 @@
+#include "vendor/doctest.h"
+#include "ot/lib/frame-manager.hpp"
+#include "ot/user/user.hpp"
+
+// Stands in for the syscall so wait() can be checked without a kernel
+static uint64_t last_wait_deadline;
+void ou_wait(uint64_t deadline) { last_wait_deadline = deadline; }
+
+TEST_CASE("frame-manager - waits for the next frame after rendering") {
+  graphics::FrameManager fm(10);
+  uint64_t frame = O_TIME_UNITS_PER_SECOND / 10;
+
+  CHECK(fm.begin_frame());
+  fm.end_frame();
+  uint64_t now = o_time_get();
+  CHECK(fm.next_deadline(now) > now);
+  CHECK(fm.next_deadline(now) <= now + frame);
+}
+
+TEST_CASE("frame-manager - hidden app waits a frame from now") {
+  graphics::FrameManager fm(10);
+  uint64_t frame = O_TIME_UNITS_PER_SECOND / 10;
+
+  // Never shown: no frame has been rendered, so the first deadline is long past
+  CHECK(fm.next_deadline(frame) == 2 * frame);
+  CHECK(fm.next_deadline(50 * frame) == 51 * frame);
+
+  // Shown once, then hidden: the deadline keeps moving with the clock
+  CHECK(fm.begin_frame());
+  fm.end_frame();
+  uint64_t later = o_time_get() + 10 * frame;
+  CHECK(fm.next_deadline(later) == later + frame);
+
+  last_wait_deadline = 0;
+  uint64_t before = o_time_get();
+  fm.wait();
+  CHECK(last_wait_deadline > before);
+}
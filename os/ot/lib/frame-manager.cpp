@@ -1,5 +1,6 @@
 // frame-manager.cpp - Simple frame rate manager implementation
 #include "ot/lib/frame-manager.hpp"
+#include "ot/user/user.hpp"
 
 namespace graphics {
 
@@ -39,4 +40,17 @@ void FrameManager::end_frame() {
   frame_in_progress_ = false;
 }
 
+uint64_t FrameManager::next_deadline(uint64_t now) const {
+  uint64_t deadline = last_frame_time_ + target_frame_duration_;
+  // No frame was rendered since the last deadline (e.g. the app is hidden and
+  // skips begin_frame()), so check back a frame from now rather than waking
+  // straight away
+  if (deadline <= now) {
+    deadline = now + target_frame_duration_;
+  }
+  return deadline;
+}
+
+void FrameManager::wait() { ou_wait(next_deadline(o_time_get())); }
+
 } // namespace graphics
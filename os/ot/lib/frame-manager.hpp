@@ -16,7 +16,7 @@ namespace graphics {
 //       graphics_client.flush();
 //       fm.end_frame();
 //     }
-//     ou_yield(); // Yield to other processes
+//     fm.wait(); // Let other processes run until the next frame is due
 //   }
 class FrameManager {
 public:
@@ -32,6 +32,15 @@ public:
   // Call this after rendering is complete.
   void end_frame();
 
+  // Block until the next frame is due or input arrives, letting other
+  // processes run. Use between frames in place of ou_yield() so an idle
+  // app doesn't keep the scheduler busy.
+  void wait();
+
+  // Deadline wait() passes to ou_wait(): the next frame, or one frame from
+  // now if that has already passed. Always later than now.
+  uint64_t next_deadline(uint64_t now) const;
+
 private:
   uint64_t target_frame_duration_; // Target duration per frame in time units
   uint64_t last_frame_time_;       // Time when last frame started
@@ -0,0 +1,115 @@
+// glyph-cache-test.cpp - Unit tests for app::GlyphCache
+
+#include "ot/lib/glyph-cache.hpp"
+#include "vendor/doctest.h"
+
+using app::CachedGlyph;
+using app::GlyphCache;
+using app::GlyphMetrics;
+using app::LineMetrics;
+
+static GlyphMetrics make_metrics(int w, int h) {
+  GlyphMetrics m;
+  m.advance = w + 1;
+  m.left_bearing = 0;
+  m.y_offset = -h;
+  m.width = w;
+  m.height = h;
+  return m;
+}
+
+static CachedGlyph *make_glyph(uint32_t cp, int size_px, int w = 8, int h = 8) {
+  CachedGlyph *g = GlyphCache::allocate(cp, size_px, make_metrics(w, h));
+  for (int i = 0; i < w * h; i++) {
+    g->coverage()[i] = (uint8_t)(cp + i);
+  }
+  return g;
+}
+
+TEST_CASE("glyph cache lookup") {
+  GlyphCache cache;
+
+  CHECK(cache.find('A', 16) == nullptr);
+  CHECK(cache.misses() == 1);
+
+  CHECK(cache.insert(make_glyph('A', 16)));
+  CHECK(cache.insert(make_glyph('A', 24)));
+  CHECK(cache.count() == 2);
+
+  CachedGlyph *g = cache.find('A', 16);
+  CHECK(g != nullptr);
+  CHECK(g->size_px == 16);
+  CHECK(g->metrics.advance == 9);
+  CHECK(g->coverage()[3] == (uint8_t)('A' + 3));
+  CHECK(cache.find('A', 24)->size_px == 24);
+  CHECK(cache.hits() == 2);
+  CHECK(cache.find('B', 16) == nullptr);
+}
+
+TEST_CASE("glyph cache evicts least recently used within budget") {
+  size_t per_glyph = sizeof(CachedGlyph) + 8 * 8;
+  GlyphCache cache(per_glyph * 3);
+
+  CHECK(cache.insert(make_glyph('a', 16)));
+  CHECK(cache.insert(make_glyph('b', 16)));
+  CHECK(cache.insert(make_glyph('c', 16)));
+  CHECK(cache.bytes_used() == per_glyph * 3);
+
+  // Touch 'a' so 'b' becomes the eviction candidate
+  CHECK(cache.find('a', 16) != nullptr);
+  CHECK(cache.insert(make_glyph('d', 16)));
+
+  CHECK(cache.count() == 3);
+  CHECK(cache.bytes_used() <= cache.budget());
+  CHECK(cache.find('b', 16) == nullptr);
+  CHECK(cache.find('a', 16) != nullptr);
+  CHECK(cache.find('c', 16) != nullptr);
+  CHECK(cache.find('d', 16) != nullptr);
+
+  SUBCASE("shrinking the budget evicts") {
+    cache.set_budget(per_glyph);
+    CHECK(cache.count() == 1);
+    CHECK(cache.find('d', 16) != nullptr);
+  }
+
+  SUBCASE("clear empties the cache") {
+    cache.clear();
+    CHECK(cache.count() == 0);
+    CHECK(cache.bytes_used() == 0);
+  }
+}
+
+TEST_CASE("glyph cache rejects glyphs larger than the budget") {
+  GlyphCache cache(256);
+  CachedGlyph *big = make_glyph('W', 96, 64, 64);
+  CHECK(!cache.insert(big));
+  CHECK(cache.count() == 0);
+  GlyphCache::release(big);
+
+  // Blank glyphs carry metrics only
+  CHECK(cache.insert(make_glyph(' ', 96, 0, 0)));
+  CHECK(cache.find(' ', 96)->footprint() == sizeof(CachedGlyph));
+}
+
+TEST_CASE("glyph cache line metrics") {
+  GlyphCache cache;
+  LineMetrics out;
+  CHECK(!cache.find_line_metrics(16, &out));
+
+  LineMetrics m = {12, -4, 1};
+  cache.store_line_metrics(16, m);
+  CHECK(cache.find_line_metrics(16, &out));
+  CHECK(out.ascender == 12);
+  CHECK(out.descender == -4);
+
+  // Filling every slot replaces the oldest size
+  for (int i = 0; i < GlyphCache::MAX_LINE_SIZES; i++) {
+    cache.store_line_metrics(100 + i, m);
+  }
+  CHECK(!cache.find_line_metrics(16, &out));
+  CHECK(cache.find_line_metrics(100 + GlyphCache::MAX_LINE_SIZES - 1, &out));
+
+  // Line metrics survive clearing the glyphs
+  cache.clear();
+  CHECK(cache.find_line_metrics(101, &out));
+}
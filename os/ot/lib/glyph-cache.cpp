@@ -0,0 +1,153 @@
+// glyph-cache.cpp - LRU cache of rasterised TTF glyphs and line metrics
+#include "ot/lib/glyph-cache.hpp"
+
+extern "C" void *ou_malloc(size_t size);
+extern "C" void ou_free(void *ptr);
+
+namespace app {
+
+GlyphCache::GlyphCache(size_t budget)
+    : budget_(budget), bytes_used_(0), count_(0), hits_(0), misses_(0), lru_head_(nullptr), lru_tail_(nullptr) {
+  for (int i = 0; i < BUCKETS; i++) {
+    buckets_[i] = nullptr;
+  }
+  for (int i = 0; i < MAX_LINE_SIZES; i++) {
+    line_metrics_[i].size_px = 0;
+  }
+}
+
+GlyphCache::~GlyphCache() { clear(); }
+
+CachedGlyph *GlyphCache::find(uint32_t codepoint, int size_px) {
+  for (CachedGlyph *g = buckets_[bucket_of(codepoint, size_px)]; g; g = g->bucket_next) {
+    if (g->codepoint == codepoint && g->size_px == size_px) {
+      if (g != lru_head_) {
+        lru_unlink(g);
+        lru_push_front(g);
+      }
+      hits_++;
+      return g;
+    }
+  }
+  misses_++;
+  return nullptr;
+}
+
+CachedGlyph *GlyphCache::allocate(uint32_t codepoint, int size_px, const GlyphMetrics &metrics) {
+  size_t bytes = sizeof(CachedGlyph) + (size_t)metrics.width * metrics.height;
+  CachedGlyph *g = (CachedGlyph *)ou_malloc(bytes);
+  if (!g) {
+    return nullptr;
+  }
+  g->codepoint = codepoint;
+  g->size_px = size_px;
+  g->metrics = metrics;
+  g->lru_prev = nullptr;
+  g->lru_next = nullptr;
+  g->bucket_next = nullptr;
+  return g;
+}
+
+bool GlyphCache::insert(CachedGlyph *glyph) {
+  size_t bytes = glyph->footprint();
+  if (bytes > budget_) {
+    return false;
+  }
+  evict_to(budget_ - bytes);
+
+  int b = bucket_of(glyph->codepoint, glyph->size_px);
+  glyph->bucket_next = buckets_[b];
+  buckets_[b] = glyph;
+  lru_push_front(glyph);
+  bytes_used_ += bytes;
+  count_++;
+  return true;
+}
+
+void GlyphCache::release(CachedGlyph *glyph) { ou_free(glyph); }
+
+bool GlyphCache::find_line_metrics(int size_px, LineMetrics *out) const {
+  for (int i = 0; i < MAX_LINE_SIZES; i++) {
+    if (line_metrics_[i].size_px == size_px) {
+      *out = line_metrics_[i].metrics;
+      return true;
+    }
+  }
+  return false;
+}
+
+void GlyphCache::store_line_metrics(int size_px, const LineMetrics &metrics) {
+  // Reuse the size's slot or a free one; with every slot taken, replace the
+  // oldest entry (sizes are few, so this is rare)
+  int slot = 0;
+  for (int i = 0; i < MAX_LINE_SIZES; i++) {
+    if (line_metrics_[i].size_px == size_px || line_metrics_[i].size_px == 0) {
+      slot = i;
+      break;
+    }
+  }
+  if (line_metrics_[slot].size_px != size_px && line_metrics_[slot].size_px != 0) {
+    for (int i = 0; i < MAX_LINE_SIZES - 1; i++) {
+      line_metrics_[i] = line_metrics_[i + 1];
+    }
+    slot = MAX_LINE_SIZES - 1;
+  }
+  line_metrics_[slot].size_px = size_px;
+  line_metrics_[slot].metrics = metrics;
+}
+
+void GlyphCache::clear() { evict_to(0); }
+
+void GlyphCache::set_budget(size_t budget) {
+  budget_ = budget;
+  evict_to(budget_);
+}
+
+void GlyphCache::lru_unlink(CachedGlyph *glyph) {
+  if (glyph->lru_prev) {
+    glyph->lru_prev->lru_next = glyph->lru_next;
+  } else {
+    lru_head_ = glyph->lru_next;
+  }
+  if (glyph->lru_next) {
+    glyph->lru_next->lru_prev = glyph->lru_prev;
+  } else {
+    lru_tail_ = glyph->lru_prev;
+  }
+  glyph->lru_prev = nullptr;
+  glyph->lru_next = nullptr;
+}
+
+void GlyphCache::lru_push_front(CachedGlyph *glyph) {
+  glyph->lru_prev = nullptr;
+  glyph->lru_next = lru_head_;
+  if (lru_head_) {
+    lru_head_->lru_prev = glyph;
+  }
+  lru_head_ = glyph;
+  if (!lru_tail_) {
+    lru_tail_ = glyph;
+  }
+}
+
+void GlyphCache::remove(CachedGlyph *glyph) {
+  CachedGlyph **link = &buckets_[bucket_of(glyph->codepoint, glyph->size_px)];
+  while (*link && *link != glyph) {
+    link = &(*link)->bucket_next;
+  }
+  if (*link) {
+    *link = glyph->bucket_next;
+  }
+  lru_unlink(glyph);
+  bytes_used_ -= glyph->footprint();
+  count_--;
+  ou_free(glyph);
+}
+
+void GlyphCache::evict_to(size_t limit) {
+  while (bytes_used_ > limit && lru_tail_) {
+    remove(lru_tail_);
+  }
+}
+
+} // namespace app
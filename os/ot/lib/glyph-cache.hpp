@@ -0,0 +1,109 @@
+// glyph-cache.hpp - LRU cache of rasterised TTF glyphs and line metrics
+#pragma once
+
+#include "ot/common.h"
+
+namespace app {
+
+// Metrics of a rasterised glyph, in pixels
+struct GlyphMetrics {
+  int advance;
+  int left_bearing;
+  int y_offset; // Offset of the bitmap's top row from the baseline
+  int width;    // Coverage bitmap dimensions (0 for blank glyphs like space)
+  int height;
+};
+
+// One cached glyph. The coverage bitmap (width * height bytes, row-major) is
+// allocated in the same block, directly after the struct.
+struct CachedGlyph {
+  uint32_t codepoint;
+  int size_px;
+  GlyphMetrics metrics;
+
+  CachedGlyph *lru_prev; // Towards most recently used
+  CachedGlyph *lru_next; // Towards least recently used
+  CachedGlyph *bucket_next;
+
+  uint8_t *coverage() { return (uint8_t *)(this + 1); }
+  const uint8_t *coverage() const { return (const uint8_t *)(this + 1); }
+  size_t footprint() const { return sizeof(CachedGlyph) + (size_t)metrics.width * metrics.height; }
+};
+
+// Font-wide metrics for one pixel size
+struct LineMetrics {
+  int ascender;
+  int descender;
+  int line_gap;
+};
+
+// Glyphs keyed by (codepoint, size), evicted least-recently-used first once the
+// total size of cached glyphs would exceed the memory budget. Line metrics are
+// cached per size alongside them and never evicted.
+class GlyphCache {
+public:
+  static const size_t DEFAULT_BUDGET = 32 * 1024;
+  static const int BUCKETS = 64;
+  static const int MAX_LINE_SIZES = 8;
+
+  explicit GlyphCache(size_t budget = DEFAULT_BUDGET);
+  ~GlyphCache();
+
+  // Look up a glyph, marking it most recently used. Returns nullptr on a miss.
+  CachedGlyph *find(uint32_t codepoint, int size_px);
+
+  // Allocate an uncached glyph with room for a width x height coverage bitmap.
+  // Fill in the bitmap, then either insert() it or release() it.
+  static CachedGlyph *allocate(uint32_t codepoint, int size_px, const GlyphMetrics &metrics);
+
+  // Take ownership of an allocated glyph, evicting old glyphs to stay within
+  // the budget. Returns false (and leaves ownership with the caller) if the
+  // glyph is larger than the whole budget.
+  bool insert(CachedGlyph *glyph);
+
+  // Free a glyph that was allocated but not inserted
+  static void release(CachedGlyph *glyph);
+
+  bool find_line_metrics(int size_px, LineMetrics *out) const;
+  void store_line_metrics(int size_px, const LineMetrics &metrics);
+
+  // Drop every cached glyph (line metrics are kept)
+  void clear();
+
+  // Change the budget, evicting glyphs if the cache is now over it
+  void set_budget(size_t budget);
+
+  size_t budget() const { return budget_; }
+  size_t bytes_used() const { return bytes_used_; }
+  int count() const { return count_; }
+  uint32_t hits() const { return hits_; }
+  uint32_t misses() const { return misses_; }
+
+private:
+  size_t budget_;
+  size_t bytes_used_;
+  int count_;
+  uint32_t hits_;
+  uint32_t misses_;
+
+  CachedGlyph *buckets_[BUCKETS];
+  CachedGlyph *lru_head_; // Most recently used
+  CachedGlyph *lru_tail_; // Least recently used
+
+  struct LineEntry {
+    int size_px; // 0 = unused
+    LineMetrics metrics;
+  };
+  LineEntry line_metrics_[MAX_LINE_SIZES];
+
+  static int bucket_of(uint32_t codepoint, int size_px) {
+    return (int)((codepoint * 31u + (uint32_t)size_px) % BUCKETS);
+  }
+
+  void lru_unlink(CachedGlyph *glyph);
+  void lru_push_front(CachedGlyph *glyph);
+  void remove(CachedGlyph *glyph);
+  void evict_to(size_t limit);
+};
+
+} // namespace app
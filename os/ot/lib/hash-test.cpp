@@ -0,0 +1,125 @@
+// hash-test.cpp - Unit tests for MD5, XXH32 and the shared hash interface
+
+#include "ot/lib/hash.hpp"
+#include "vendor/doctest.h"
+#include <string.h>
+
+static void md5_hex(const void *data, size_t len, char hex[33]) {
+  MD5Context ctx;
+  uint8_t digest[16];
+  md5_init(&ctx);
+  md5_update(&ctx, (const uint8_t *)data, len);
+  md5_final(&ctx, digest);
+  md5_digest_to_hex(digest, hex);
+}
+
+TEST_CASE("md5 matches RFC 1321 test suite") {
+  static const struct {
+    const char *input;
+    const char *digest;
+  } vectors[] = {
+      {"", "d41d8cd98f00b204e9800998ecf8427e"},
+      {"a", "0cc175b9c0f1b6a831c399e269772661"},
+      {"abc", "900150983cd24fb0d6963f7d28e17f72"},
+      {"message digest", "f96b697d7cb7938d525a2f31aaf161d0"},
+      {"abcdefghijklmnopqrstuvwxyz", "c3fcd3d76192e4007dfb496cca67e13b"},
+      {"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789", "d174ab98d277d9f5a5611c2c9f419d9f"},
+      {"12345678901234567890123456789012345678901234567890123456789012345678901234567890",
+       "57edf4a22be3c955ac49da2e2107b67a"},
+  };
+
+  for (const auto &v : vectors) {
+    char hex[33];
+    md5_hex(v.input, strlen(v.input), hex);
+    CHECK(strcmp(hex, v.digest) == 0);
+  }
+}
+
+TEST_CASE("xxh32 matches reference vectors") {
+  static uint8_t ramp[1024];
+  for (size_t i = 0; i < sizeof(ramp); i++) {
+    ramp[i] = (uint8_t)i;
+  }
+  const char *spam = "Nobody inspects the spammish repetition";
+
+  CHECK(xxh32("", 0) == 0x02cc5d05);
+  CHECK(xxh32("a", 1) == 0x550d7456);
+  CHECK(xxh32("abc", 3) == 0x32d153ff);
+  CHECK(xxh32(spam, strlen(spam)) == 0xe2293b2f);
+  CHECK(xxh32(ramp, sizeof(ramp)) == 0x58654d5a);
+
+  CHECK(xxh32("", 0, 0x9e3779b1) == 0x36b78ae7);
+  CHECK(xxh32("a", 1, 0x9e3779b1) == 0x9e1633e4);
+  CHECK(xxh32("abc", 3, 0x9e3779b1) == 0xa1ae7709);
+  CHECK(xxh32(spam, strlen(spam), 0x9e3779b1) == 0xc9e89e68);
+  CHECK(xxh32(ramp, sizeof(ramp), 0x9e3779b1) == 0xf058452b);
+}
+
+TEST_CASE("incremental and misaligned input give the same digest") {
+  static uint8_t data[3000 + 3];
+  for (size_t i = 0; i < sizeof(data); i++) {
+    data[i] = (uint8_t)(i * 131 + 17);
+  }
+  const size_t len = 3000;
+  // Chunk sizes that straddle block and stripe boundaries
+  static const size_t chunks[] = {1, 3, 15, 16, 17, 63, 64, 65, 1000};
+  static const HashAlgo algos[] = {HashAlgo::MD5, HashAlgo::XXH32};
+
+  for (HashAlgo algo : algos) {
+    CAPTURE(hash_algo_name(algo));
+    HashContext ctx;
+    uint8_t expected[HASH_MAX_DIGEST];
+    hash_init(&ctx, algo);
+    hash_update(&ctx, data, len);
+    size_t digest_len = hash_final(&ctx, expected);
+
+    for (size_t offset = 1; offset <= 3; offset++) {
+      uint8_t *moved = data + offset;
+      memmove(moved, data, len);
+      uint8_t digest[HASH_MAX_DIGEST];
+      hash_init(&ctx, algo);
+      hash_update(&ctx, moved, len);
+      hash_final(&ctx, digest);
+      CHECK(memcmp(digest, expected, digest_len) == 0);
+      memmove(data, moved, len);
+    }
+
+    for (size_t chunk : chunks) {
+      CAPTURE(chunk);
+      uint8_t digest[HASH_MAX_DIGEST];
+      hash_init(&ctx, algo);
+      for (size_t pos = 0; pos < len; pos += chunk) {
+        hash_update(&ctx, data + pos, pos + chunk <= len ? chunk : len - pos);
+      }
+      hash_final(&ctx, digest);
+      CHECK(memcmp(digest, expected, digest_len) == 0);
+    }
+  }
+
+  uint8_t digest[HASH_MAX_DIGEST];
+  HashContext ctx;
+  hash_init(&ctx, HashAlgo::XXH32);
+  hash_update(&ctx, data, len);
+  hash_final(&ctx, digest);
+  uint32_t one_shot = xxh32(data, len);
+  CHECK(digest[0] == (uint8_t)(one_shot >> 24));
+  CHECK(digest[3] == (uint8_t)one_shot);
+}
+
+TEST_CASE("hash algorithm names and hex digests") {
+  HashAlgo algo;
+  CHECK(hash_algo_from_name("md5", algo));
+  CHECK(algo == HashAlgo::MD5);
+  CHECK(hash_algo_from_name("xxh32", algo));
+  CHECK(algo == HashAlgo::XXH32);
+  CHECK(!hash_algo_from_name("sha1", algo));
+
+  HashContext ctx;
+  uint8_t digest[HASH_MAX_DIGEST];
+  char hex[HASH_MAX_DIGEST * 2 + 1];
+  hash_init(&ctx, HashAlgo::XXH32);
+  hash_update(&ctx, (const uint8_t *)"abc", 3);
+  size_t len = hash_final(&ctx, digest);
+  hash_digest_to_hex(digest, len, hex);
+  CHECK(strcmp(hex, "32d153ff") == 0);
+}
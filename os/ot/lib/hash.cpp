@@ -0,0 +1,78 @@
+#include "ot/lib/hash.hpp"
+#include <string.h>
+
+bool hash_algo_from_name(const char *name, HashAlgo &algo) {
+  if (strcmp(name, "md5") == 0) {
+    algo = HashAlgo::MD5;
+    return true;
+  }
+  if (strcmp(name, "xxh32") == 0) {
+    algo = HashAlgo::XXH32;
+    return true;
+  }
+  return false;
+}
+
+const char *hash_algo_name(HashAlgo algo) {
+  switch (algo) {
+  case HashAlgo::MD5:
+    return "md5";
+  case HashAlgo::XXH32:
+    return "xxh32";
+  }
+  return "unknown";
+}
+
+size_t hash_digest_size(HashAlgo algo) {
+  switch (algo) {
+  case HashAlgo::MD5:
+    return 16;
+  case HashAlgo::XXH32:
+    return 4;
+  }
+  return 0;
+}
+
+void hash_init(HashContext *ctx, HashAlgo algo) {
+  ctx->algo = algo;
+  switch (algo) {
+  case HashAlgo::MD5:
+    md5_init(&ctx->md5);
+    break;
+  case HashAlgo::XXH32:
+    xxh32_init(&ctx->xxh32);
+    break;
+  }
+}
+
+void hash_update(HashContext *ctx, const uint8_t *input, size_t len) {
+  switch (ctx->algo) {
+  case HashAlgo::MD5:
+    md5_update(&ctx->md5, input, len);
+    break;
+  case HashAlgo::XXH32:
+    xxh32_update(&ctx->xxh32, input, len);
+    break;
+  }
+}
+
+size_t hash_final(HashContext *ctx, uint8_t digest[HASH_MAX_DIGEST]) {
+  switch (ctx->algo) {
+  case HashAlgo::MD5:
+    md5_final(&ctx->md5, digest);
+    break;
+  case HashAlgo::XXH32:
+    xxh32_final(&ctx->xxh32, digest);
+    break;
+  }
+  return hash_digest_size(ctx->algo);
+}
+
+void hash_digest_to_hex(const uint8_t *digest, size_t len, char *hex) {
+  static const char hex_chars[] = "0123456789abcdef";
+  for (size_t i = 0; i < len; i++) {
+    hex[i * 2] = hex_chars[(digest[i] >> 4) & 0x0F];
+    hex[i * 2 + 1] = hex_chars[digest[i] & 0x0F];
+  }
+  hex[len * 2] = '\0';
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "ot/lib/md5.hpp"
+#include "ot/lib/xxhash.hpp"
+
+/**
+ * One interface over the digests used for file integrity checks, so callers
+ * can take the algorithm as a parameter (e.g. fs/hash in the shell).
+ */
+
+enum class HashAlgo : uint8_t {
+  MD5,   // 16-byte digest, matches md5sum
+  XXH32, // 4-byte digest, matches xxhsum -H0; much faster, not cryptographic
+};
+
+static const size_t HASH_MAX_DIGEST = 16;
+
+struct HashContext {
+  HashAlgo algo;
+  union {
+    MD5Context md5;
+    XXH32Context xxh32;
+  };
+};
+
+// Look up an algorithm by name ("md5", "xxh32"). Returns false if unknown.
+bool hash_algo_from_name(const char *name, HashAlgo &algo);
+const char *hash_algo_name(HashAlgo algo);
+size_t hash_digest_size(HashAlgo algo);
+
+void hash_init(HashContext *ctx, HashAlgo algo);
+void hash_update(HashContext *ctx, const uint8_t *input, size_t len);
+// Writes the digest and returns its length in bytes
+size_t hash_final(HashContext *ctx, uint8_t digest[HASH_MAX_DIGEST]);
+
+// Format a digest as lowercase hex (needs 2 * len + 1 bytes)
+void hash_digest_to_hex(const uint8_t *digest, size_t len, char *hex);
@@ -0,0 +1,125 @@
+// hashmap-test.cpp - Unit tests for ou::StringHashMap
+
+#include "ot/user/hashmap.hpp"
+#include "vendor/doctest.h"
+
+#include <stdio.h>
+
+TEST_CASE("hashmap insert and find") {
+  SUBCASE("basic operations") {
+    ou::StringHashMap<int> m;
+    CHECK(m.empty());
+    CHECK(m.insert("one", 1));
+    CHECK(m.insert("two", 2));
+    CHECK(m.size() == 2);
+    CHECK(*m.find("one") == 1);
+    CHECK(*m.find("two") == 2);
+    CHECK(m.find("three") == nullptr);
+    CHECK(m.find("on") == nullptr);
+  }
+
+  SUBCASE("insert updates an existing key") {
+    ou::StringHashMap<int> m;
+    m.insert("key", 1);
+    m.insert("key", 2);
+    CHECK(m.size() == 1);
+    CHECK(*m.find("key") == 2);
+  }
+
+  SUBCASE("keys are compared by length, not NUL termination") {
+    ou::StringHashMap<int> m;
+    const char *text = "abcdef";
+    m.insert(text, 3, 1);
+    m.insert(text, 6, 2);
+    m.insert("", 0, 3);
+    CHECK(*m.find("abc") == 1);
+    CHECK(*m.find(text, 6) == 2);
+    CHECK(*m.find("", 0) == 3);
+  }
+
+  SUBCASE("growth keeps every entry") {
+    ou::StringHashMap<int> m;
+    char keys[1000][8];
+    for (int i = 0; i < 1000; i++) {
+      snprintf(keys[i], sizeof(keys[i]), "k%d", i);
+      m.insert(keys[i], i);
+    }
+    CHECK(m.size() == 1000);
+    CHECK(m.capacity() >= 1000);
+    bool all = true;
+    for (int i = 0; i < 1000; i++) {
+      int *v = m.find(keys[i]);
+      all = all && v && *v == i;
+    }
+    CHECK(all);
+  }
+}
+
+TEST_CASE("hashmap remove") {
+  char keys[200][8];
+  ou::StringHashMap<int> m;
+  for (int i = 0; i < 200; i++) {
+    snprintf(keys[i], sizeof(keys[i]), "k%d", i);
+    m.insert(keys[i], i);
+  }
+
+  SUBCASE("removed keys are gone and the rest still found") {
+    for (int i = 0; i < 200; i += 2) {
+      CHECK(m.remove(keys[i]));
+    }
+    CHECK(!m.remove("k0"));
+    CHECK(m.size() == 100);
+    bool all = true;
+    for (int i = 0; i < 200; i++) {
+      int *v = m.find(keys[i]);
+      all = all && (i % 2 == 0 ? v == nullptr : (v && *v == i));
+    }
+    CHECK(all);
+  }
+
+  SUBCASE("removing and reinserting doesn't grow the table") {
+    size_t capacity = m.capacity();
+    for (int round = 0; round < 50; round++) {
+      for (int i = 0; i < 200; i++) {
+        m.remove(keys[i]);
+      }
+      for (int i = 0; i < 200; i++) {
+        m.insert(keys[i], i + round);
+      }
+    }
+    CHECK(m.capacity() == capacity);
+    CHECK(*m.find("k199") == 199 + 49);
+  }
+
+  SUBCASE("clear") {
+    m.clear();
+    CHECK(m.empty());
+    CHECK(m.find("k1") == nullptr);
+    m.insert("k1", 5);
+    CHECK(*m.find("k1") == 5);
+  }
+}
+
+TEST_CASE("hashmap owned keys") {
+  ou::StringHashMap<int, 16, true> m;
+  char buffer[16];
+
+  snprintf(buffer, sizeof(buffer), "first");
+  m.insert(buffer, 1);
+  snprintf(buffer, sizeof(buffer), "second");
+  m.insert(buffer, 2);
+  buffer[0] = '\0';
+
+  CHECK(*m.find("first") == 1);
+  CHECK(*m.find("second") == 2);
+  const char *stored = m.stored_key("first", 5);
+  CHECK(stored != nullptr);
+  CHECK(strcmp(stored, "first") == 0);
+  CHECK(stored != buffer);
+
+  // Keys longer than an arena chunk get a chunk of their own
+  char long_key[ou::KeyArena::CHUNK_SIZE + 10];
+  memset(long_key, 'x', sizeof(long_key));
+  m.insert(long_key, sizeof(long_key), 3);
+  CHECK(*m.find(long_key, sizeof(long_key)) == 3);
+}
@@ -6,9 +6,10 @@
 #include "ot/lib/md5.hpp"
 #include <string.h>
 
-// Basic MD5 functions
-#define F(x, y, z) (((x) & (y)) | ((~x) & (z)))
-#define G(x, y, z) (((x) & (z)) | ((y) & (~z)))
+// Basic MD5 functions. F and G are the RFC's selections rewritten with one
+// fewer operation each: F picks y or z by x, G picks x or y by z.
+#define F(x, y, z) ((z) ^ ((x) & ((y) ^ (z))))
+#define G(x, y, z) ((y) ^ ((z) & ((x) ^ (y))))
 #define H(x, y, z) ((x) ^ (y) ^ (z))
 #define I(x, y, z) ((y) ^ ((x) | (~z)))
 
@@ -59,92 +60,121 @@
 #define S43 15
 #define S44 21
 
-static void md5_transform(uint32_t state[4], const uint8_t block[64]) {
+// Little-endian 32-bit load. On a little-endian target this is a single load
+// when the compiler knows p is aligned, and byte loads otherwise.
+static inline uint32_t load_le32(const uint8_t *p) {
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  uint32_t v;
+  memcpy(&v, p, 4);
+  return v;
+#else
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+#endif
+}
+
+// Hash consecutive 64-byte blocks, keeping the state in registers between them
+static void md5_blocks(uint32_t state[4], const uint8_t *data, size_t blocks) {
   uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
-  uint32_t x[16];
+  // RISC-V has no fast misaligned loads, so only word-aligned input takes the word path
+  bool aligned = ((uintptr_t)data & 3) == 0;
 
-  // Decode block into 16 32-bit words (little-endian)
-  for (int i = 0; i < 16; i++) {
-    x[i] = ((uint32_t)block[i * 4]) | ((uint32_t)block[i * 4 + 1] << 8) | ((uint32_t)block[i * 4 + 2] << 16) |
-           ((uint32_t)block[i * 4 + 3] << 24);
+  for (; blocks > 0; blocks--, data += 64) {
+    uint32_t x[16];
+    if (aligned) {
+      const uint8_t *p = (const uint8_t *)__builtin_assume_aligned(data, 4);
+      for (int i = 0; i < 16; i++) {
+        x[i] = load_le32(p + i * 4);
+      }
+    } else {
+      for (int i = 0; i < 16; i++) {
+        x[i] = load_le32(data + i * 4);
+      }
+    }
+
+    uint32_t aa = a, bb = b, cc = c, dd = d;
+
+    // Round 1
+    FF(a, b, c, d, x[0], S11, 0xd76aa478);
+    FF(d, a, b, c, x[1], S12, 0xe8c7b756);
+    FF(c, d, a, b, x[2], S13, 0x242070db);
+    FF(b, c, d, a, x[3], S14, 0xc1bdceee);
+    FF(a, b, c, d, x[4], S11, 0xf57c0faf);
+    FF(d, a, b, c, x[5], S12, 0x4787c62a);
+    FF(c, d, a, b, x[6], S13, 0xa8304613);
+    FF(b, c, d, a, x[7], S14, 0xfd469501);
+    FF(a, b, c, d, x[8], S11, 0x698098d8);
+    FF(d, a, b, c, x[9], S12, 0x8b44f7af);
+    FF(c, d, a, b, x[10], S13, 0xffff5bb1);
+    FF(b, c, d, a, x[11], S14, 0x895cd7be);
+    FF(a, b, c, d, x[12], S11, 0x6b901122);
+    FF(d, a, b, c, x[13], S12, 0xfd987193);
+    FF(c, d, a, b, x[14], S13, 0xa679438e);
+    FF(b, c, d, a, x[15], S14, 0x49b40821);
+
+    // Round 2
+    GG(a, b, c, d, x[1], S21, 0xf61e2562);
+    GG(d, a, b, c, x[6], S22, 0xc040b340);
+    GG(c, d, a, b, x[11], S23, 0x265e5a51);
+    GG(b, c, d, a, x[0], S24, 0xe9b6c7aa);
+    GG(a, b, c, d, x[5], S21, 0xd62f105d);
+    GG(d, a, b, c, x[10], S22, 0x02441453);
+    GG(c, d, a, b, x[15], S23, 0xd8a1e681);
+    GG(b, c, d, a, x[4], S24, 0xe7d3fbc8);
+    GG(a, b, c, d, x[9], S21, 0x21e1cde6);
+    GG(d, a, b, c, x[14], S22, 0xc33707d6);
+    GG(c, d, a, b, x[3], S23, 0xf4d50d87);
+    GG(b, c, d, a, x[8], S24, 0x455a14ed);
+    GG(a, b, c, d, x[13], S21, 0xa9e3e905);
+    GG(d, a, b, c, x[2], S22, 0xfcefa3f8);
+    GG(c, d, a, b, x[7], S23, 0x676f02d9);
+    GG(b, c, d, a, x[12], S24, 0x8d2a4c8a);
+
+    // Round 3
+    HH(a, b, c, d, x[5], S31, 0xfffa3942);
+    HH(d, a, b, c, x[8], S32, 0x8771f681);
+    HH(c, d, a, b, x[11], S33, 0x6d9d6122);
+    HH(b, c, d, a, x[14], S34, 0xfde5380c);
+    HH(a, b, c, d, x[1], S31, 0xa4beea44);
+    HH(d, a, b, c, x[4], S32, 0x4bdecfa9);
+    HH(c, d, a, b, x[7], S33, 0xf6bb4b60);
+    HH(b, c, d, a, x[10], S34, 0xbebfbc70);
+    HH(a, b, c, d, x[13], S31, 0x289b7ec6);
+    HH(d, a, b, c, x[0], S32, 0xeaa127fa);
+    HH(c, d, a, b, x[3], S33, 0xd4ef3085);
+    HH(b, c, d, a, x[6], S34, 0x04881d05);
+    HH(a, b, c, d, x[9], S31, 0xd9d4d039);
+    HH(d, a, b, c, x[12], S32, 0xe6db99e5);
+    HH(c, d, a, b, x[15], S33, 0x1fa27cf8);
+    HH(b, c, d, a, x[2], S34, 0xc4ac5665);
+
+    // Round 4
+    II(a, b, c, d, x[0], S41, 0xf4292244);
+    II(d, a, b, c, x[7], S42, 0x432aff97);
+    II(c, d, a, b, x[14], S43, 0xab9423a7);
+    II(b, c, d, a, x[5], S44, 0xfc93a039);
+    II(a, b, c, d, x[12], S41, 0x655b59c3);
+    II(d, a, b, c, x[3], S42, 0x8f0ccc92);
+    II(c, d, a, b, x[10], S43, 0xffeff47d);
+    II(b, c, d, a, x[1], S44, 0x85845dd1);
+    II(a, b, c, d, x[8], S41, 0x6fa87e4f);
+    II(d, a, b, c, x[15], S42, 0xfe2ce6e0);
+    II(c, d, a, b, x[6], S43, 0xa3014314);
+    II(b, c, d, a, x[13], S44, 0x4e0811a1);
+    II(a, b, c, d, x[4], S41, 0xf7537e82);
+    II(d, a, b, c, x[11], S42, 0xbd3af235);
+    II(c, d, a, b, x[2], S43, 0x2ad7d2bb);
+    II(b, c, d, a, x[9], S44, 0xeb86d391);
+
+    a += aa;
+    b += bb;
+    c += cc;
+    d += dd;
   }
 
-  // Round 1
-  FF(a, b, c, d, x[0], S11, 0xd76aa478);
-  FF(d, a, b, c, x[1], S12, 0xe8c7b756);
-  FF(c, d, a, b, x[2], S13, 0x242070db);
-  FF(b, c, d, a, x[3], S14, 0xc1bdceee);
-  FF(a, b, c, d, x[4], S11, 0xf57c0faf);
-  FF(d, a, b, c, x[5], S12, 0x4787c62a);
-  FF(c, d, a, b, x[6], S13, 0xa8304613);
-  FF(b, c, d, a, x[7], S14, 0xfd469501);
-  FF(a, b, c, d, x[8], S11, 0x698098d8);
-  FF(d, a, b, c, x[9], S12, 0x8b44f7af);
-  FF(c, d, a, b, x[10], S13, 0xffff5bb1);
-  FF(b, c, d, a, x[11], S14, 0x895cd7be);
-  FF(a, b, c, d, x[12], S11, 0x6b901122);
-  FF(d, a, b, c, x[13], S12, 0xfd987193);
-  FF(c, d, a, b, x[14], S13, 0xa679438e);
-  FF(b, c, d, a, x[15], S14, 0x49b40821);
-
-  // Round 2
-  GG(a, b, c, d, x[1], S21, 0xf61e2562);
-  GG(d, a, b, c, x[6], S22, 0xc040b340);
-  GG(c, d, a, b, x[11], S23, 0x265e5a51);
-  GG(b, c, d, a, x[0], S24, 0xe9b6c7aa);
-  GG(a, b, c, d, x[5], S21, 0xd62f105d);
-  GG(d, a, b, c, x[10], S22, 0x02441453);
-  GG(c, d, a, b, x[15], S23, 0xd8a1e681);
-  GG(b, c, d, a, x[4], S24, 0xe7d3fbc8);
-  GG(a, b, c, d, x[9], S21, 0x21e1cde6);
-  GG(d, a, b, c, x[14], S22, 0xc33707d6);
-  GG(c, d, a, b, x[3], S23, 0xf4d50d87);
-  GG(b, c, d, a, x[8], S24, 0x455a14ed);
-  GG(a, b, c, d, x[13], S21, 0xa9e3e905);
-  GG(d, a, b, c, x[2], S22, 0xfcefa3f8);
-  GG(c, d, a, b, x[7], S23, 0x676f02d9);
-  GG(b, c, d, a, x[12], S24, 0x8d2a4c8a);
-
-  // Round 3
-  HH(a, b, c, d, x[5], S31, 0xfffa3942);
-  HH(d, a, b, c, x[8], S32, 0x8771f681);
-  HH(c, d, a, b, x[11], S33, 0x6d9d6122);
-  HH(b, c, d, a, x[14], S34, 0xfde5380c);
-  HH(a, b, c, d, x[1], S31, 0xa4beea44);
-  HH(d, a, b, c, x[4], S32, 0x4bdecfa9);
-  HH(c, d, a, b, x[7], S33, 0xf6bb4b60);
-  HH(b, c, d, a, x[10], S34, 0xbebfbc70);
-  HH(a, b, c, d, x[13], S31, 0x289b7ec6);
-  HH(d, a, b, c, x[0], S32, 0xeaa127fa);
-  HH(c, d, a, b, x[3], S33, 0xd4ef3085);
-  HH(b, c, d, a, x[6], S34, 0x04881d05);
-  HH(a, b, c, d, x[9], S31, 0xd9d4d039);
-  HH(d, a, b, c, x[12], S32, 0xe6db99e5);
-  HH(c, d, a, b, x[15], S33, 0x1fa27cf8);
-  HH(b, c, d, a, x[2], S34, 0xc4ac5665);
-
-  // Round 4
-  II(a, b, c, d, x[0], S41, 0xf4292244);
-  II(d, a, b, c, x[7], S42, 0x432aff97);
-  II(c, d, a, b, x[14], S43, 0xab9423a7);
-  II(b, c, d, a, x[5], S44, 0xfc93a039);
-  II(a, b, c, d, x[12], S41, 0x655b59c3);
-  II(d, a, b, c, x[3], S42, 0x8f0ccc92);
-  II(c, d, a, b, x[10], S43, 0xffeff47d);
-  II(b, c, d, a, x[1], S44, 0x85845dd1);
-  II(a, b, c, d, x[8], S41, 0x6fa87e4f);
-  II(d, a, b, c, x[15], S42, 0xfe2ce6e0);
-  II(c, d, a, b, x[6], S43, 0xa3014314);
-  II(b, c, d, a, x[13], S44, 0x4e0811a1);
-  II(a, b, c, d, x[4], S41, 0xf7537e82);
-  II(d, a, b, c, x[11], S42, 0xbd3af235);
-  II(c, d, a, b, x[2], S43, 0x2ad7d2bb);
-  II(b, c, d, a, x[9], S44, 0xeb86d391);
-
-  state[0] += a;
-  state[1] += b;
-  state[2] += c;
-  state[3] += d;
+  state[0] = a;
+  state[1] = b;
+  state[2] = c;
+  state[3] = d;
 }
 
 void md5_init(MD5Context *ctx) {
@@ -156,7 +186,6 @@ void md5_init(MD5Context *ctx) {
 }
 
 void md5_update(MD5Context *ctx, const uint8_t *input, size_t len) {
-  size_t i;
   uint32_t index = (ctx->count[0] >> 3) & 0x3F;
 
   // Update bit count
@@ -166,45 +195,47 @@ void md5_update(MD5Context *ctx, const uint8_t *input, size_t len) {
   }
   ctx->count[1] += (uint32_t)(len >> 29);
 
-  size_t part_len = 64 - index;
-
-  // Transform as many times as possible
-  if (len >= part_len) {
-    memcpy(&ctx->buffer[index], input, part_len);
-    md5_transform(ctx->state, ctx->buffer);
-
-    for (i = part_len; i + 63 < len; i += 64) {
-      md5_transform(ctx->state, &input[i]);
+  // Complete a partially buffered block first
+  if (index != 0) {
+    size_t part_len = 64 - index;
+    if (len < part_len) {
+      memcpy(&ctx->buffer[index], input, len);
+      return;
     }
-
-    index = 0;
-  } else {
-    i = 0;
+    memcpy(&ctx->buffer[index], input, part_len);
+    md5_blocks(ctx->state, ctx->buffer, 1);
+    input += part_len;
+    len -= part_len;
   }
 
-  // Buffer remaining input
-  memcpy(&ctx->buffer[index], &input[i], len - i);
+  // Whole blocks are hashed straight from the caller's memory, only the tail is copied
+  size_t blocks = len / 64;
+  if (blocks > 0) {
+    md5_blocks(ctx->state, input, blocks);
+    input += blocks * 64;
+    len -= blocks * 64;
+  }
+  memcpy(ctx->buffer, input, len);
 }
 
 void md5_final(MD5Context *ctx, uint8_t digest[16]) {
-  static const uint8_t padding[64] = {0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-                                      0,    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-                                      0,    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+  uint32_t index = (ctx->count[0] >> 3) & 0x3F;
 
-  // Save bit count
-  uint8_t bits[8];
-  for (int i = 0; i < 4; i++) {
-    bits[i] = (uint8_t)(ctx->count[0] >> (i * 8));
-    bits[i + 4] = (uint8_t)(ctx->count[1] >> (i * 8));
+  // Pad with a one bit and zeros up to 56 mod 64, spilling into a second block if needed
+  ctx->buffer[index++] = 0x80;
+  if (index > 56) {
+    memset(&ctx->buffer[index], 0, 64 - index);
+    md5_blocks(ctx->state, ctx->buffer, 1);
+    index = 0;
   }
+  memset(&ctx->buffer[index], 0, 56 - index);
 
-  // Pad to 56 mod 64
-  uint32_t index = (ctx->count[0] >> 3) & 0x3F;
-  size_t pad_len = (index < 56) ? (56 - index) : (120 - index);
-  md5_update(ctx, padding, pad_len);
-
-  // Append length
-  md5_update(ctx, bits, 8);
+  // Append bit count (little-endian)
+  for (int i = 0; i < 4; i++) {
+    ctx->buffer[56 + i] = (uint8_t)(ctx->count[0] >> (i * 8));
+    ctx->buffer[60 + i] = (uint8_t)(ctx->count[1] >> (i * 8));
+  }
+  md5_blocks(ctx->state, ctx->buffer, 1);
 
   // Store state in digest (little-endian)
   for (int i = 0; i < 4; i++) {
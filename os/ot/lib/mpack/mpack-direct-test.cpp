@@ -0,0 +1,154 @@
+#include "vendor/doctest.h"
+#include "ot/common.h"
+#include "ot/lib/mpack/mpack-direct.hpp"
+#include "ot/lib/mpack/mpack-reader.hpp"
+#include "ot/lib/mpack/mpack-writer.hpp"
+#include <string.h>
+
+TEST_CASE("mpack-direct - reads what MPackWriter writes") {
+  static char long_str[300];
+  memset(long_str, 'x', sizeof(long_str));
+  static char big_bin[70000];
+  memset(big_bin, 7, sizeof(big_bin));
+
+  static char buf[71000];
+  MPackWriter writer(buf, sizeof(buf));
+  writer.array(3).str("hi").str(long_str, 40).str(long_str, 300);
+  writer.bin("ab", 2).bin(big_bin, sizeof(big_bin));
+  writer.pack((uint32_t)5).pack((uint32_t)200).pack((uint32_t)70000);
+  writer.pack((int32_t)-3).pack((int32_t)-200).pack((int32_t)-70000).pack((int32_t)123);
+  writer.map(1);
+  CHECK(writer.ok());
+
+  MPackDirectReader reader(buf, writer.size());
+  uint32_t count;
+  CHECK(reader.enter_array(count));
+  CHECK(count == 3);
+
+  StringView sv;
+  CHECK(reader.read_string(sv));
+  CHECK(sv.equals("hi"));
+  CHECK(reader.read_string(sv));
+  CHECK(sv.len == 40);
+  CHECK(sv.ptr > buf);
+  CHECK(sv.ptr < buf + writer.size());
+  CHECK(reader.read_string(sv));
+  CHECK(sv.len == 300);
+
+  CHECK(reader.read_bin(sv));
+  CHECK(sv.len == 2);
+  CHECK(memcmp(sv.ptr, "ab", 2) == 0);
+  CHECK(reader.read_bin(sv));
+  CHECK(sv.len == sizeof(big_bin));
+
+  uint32_t u;
+  CHECK(reader.read_uint(u));
+  CHECK(u == 5);
+  CHECK(reader.read_uint(u));
+  CHECK(u == 200);
+  CHECK(reader.read_uint(u));
+  CHECK(u == 70000);
+
+  int32_t i;
+  CHECK(reader.read_int(i));
+  CHECK(i == -3);
+  CHECK(reader.read_int(i));
+  CHECK(i == -200);
+  CHECK(reader.read_int(i));
+  CHECK(i == -70000);
+  CHECK(reader.read_int(i));
+  CHECK(i == 123);
+
+  CHECK(reader.enter_map(count));
+  CHECK(count == 1);
+  CHECK(reader.ok());
+  CHECK(reader.bytes_remaining() == 0);
+}
+
+TEST_CASE("mpack-direct - writer matches MPackWriter byte for byte") {
+  static char long_str[300];
+  memset(long_str, 'y', sizeof(long_str));
+
+  char expected[1024], actual[1024];
+  MPackWriter reference(expected, sizeof(expected));
+  MPackDirectWriter writer(actual, sizeof(actual));
+  reference.array(2).array(20).str("").str(long_str, 31).str(long_str, 32).str(long_str, 300).bin("z", 1);
+  writer.array(2).array(20).str("").str(long_str, 31).str(long_str, 32).str(long_str, 300).bin("z", 1);
+  reference.pack((uint32_t)127).pack((uint32_t)128).pack((uint32_t)65536);
+  writer.pack((uint32_t)127).pack((uint32_t)128).pack((uint32_t)65536);
+
+  CHECK(reference.ok());
+  CHECK(writer.ok());
+  CHECK(writer.size() == reference.size());
+  CHECK(memcmp(actual, expected, writer.size()) == 0);
+}
+
+TEST_CASE("mpack-direct - bounds checks") {
+  char buf[64];
+  MPackWriter writer(buf, sizeof(buf));
+  writer.str("hello world");
+
+  // A string whose length runs past the end of the buffer
+  MPackDirectReader truncated(buf, writer.size() - 1);
+  StringView sv;
+  CHECK_FALSE(truncated.read_string(sv));
+  CHECK_FALSE(truncated.ok());
+
+  // An empty buffer
+  MPackDirectReader empty(buf, 0);
+  uint32_t count;
+  CHECK_FALSE(empty.enter_array(count));
+
+  // A str16 header cut off after its type byte
+  buf[0] = (char)0xda;
+  MPackDirectReader header(buf, 2);
+  CHECK_FALSE(header.read_string(sv));
+
+  // Writing past the end fails and stays failed
+  char small[4];
+  MPackDirectWriter out(small, sizeof(small));
+  out.str("toolong");
+  CHECK_FALSE(out.ok());
+  out.pack((uint32_t)1);
+  CHECK_FALSE(out.ok());
+}
+
+TEST_CASE("mpack-direct - type errors are sticky") {
+  char buf[64];
+  MPackWriter writer(buf, sizeof(buf));
+  writer.pack((uint32_t)42).str("after");
+
+  MPackDirectReader reader(buf, writer.size());
+  StringView sv;
+  CHECK_FALSE(reader.read_string(sv));
+  CHECK_FALSE(reader.ok());
+  // Even a read that would otherwise match fails now
+  CHECK_FALSE(reader.read_string(sv));
+
+  // Out-of-range values are rejected rather than truncated
+  MPackWriter wide(buf, sizeof(buf));
+  wide.pack((uint32_t)0x80000000u);
+  MPackDirectReader ints(buf, wide.size());
+  int32_t i;
+  CHECK_FALSE(ints.read_int(i));
+}
+
+TEST_CASE("mpack-direct - MPackReader resumes after a stringarray") {
+  char buf[256];
+  MPackWriter writer(buf, sizeof(buf));
+  const char *argv[] = {"ls", "-l"};
+  writer.stringarray(2, (char **)argv).pack((uint32_t)9);
+
+  MPackReader reader(buf, writer.size());
+  StringView views[4];
+  size_t count;
+  CHECK(reader.read_stringarray(views, 4, count));
+  CHECK(count == 2);
+  CHECK(views[1].equals("-l"));
+
+  // The tokenizer picks up where the direct decode stopped
+  uint32_t u;
+  CHECK(reader.read_uint(u));
+  CHECK(u == 9);
+  CHECK(reader.ok());
+}
@@ -0,0 +1,297 @@
+#ifndef OT_SHARED_MPACK_DIRECT_HPP
+#define OT_SHARED_MPACK_DIRECT_HPP
+
+#include "ot/common.h"
+#include "ot/lib/string-view.hpp"
+
+// Schema-specialised msgpack reading and writing, used by generated IPC code.
+//
+// MPackReader and MPackWriter go through libmpack's tokenizer, which accepts
+// any input but builds a token for every header and every chunk. When the
+// caller already knows what comes next (a method's argument list, a list_dir
+// reply), these read or write each header straight from the buffer: one
+// bounds check and one switch on the type byte. Strings and bin come back as
+// views into the buffer.
+//
+// Errors are sticky: after the first type mismatch or overrun every call
+// fails, so straight-line code only needs to check ok() at the end.
+class MPackDirectReader {
+private:
+  const uint8_t *p_;
+  const uint8_t *end_;
+  bool error_;
+
+  bool fail() {
+    error_ = true;
+    return false;
+  }
+
+  bool take_byte(uint8_t &b) {
+    if (error_ || p_ == end_) {
+      return fail();
+    }
+    b = *p_++;
+    return true;
+  }
+
+  // Big-endian value of n (1, 2 or 4) bytes
+  bool take_be(size_t n, uint32_t &value) {
+    if (error_ || (size_t)(end_ - p_) < n) {
+      return fail();
+    }
+    uint32_t v = 0;
+    for (size_t i = 0; i < n; i++) {
+      v = (v << 8) | p_[i];
+    }
+    p_ += n;
+    value = v;
+    return true;
+  }
+
+  // 64-bit big-endian value that must fit in 32 bits
+  bool take_be64(uint32_t &value) {
+    uint32_t hi;
+    if (!take_be(4, hi) || !take_be(4, value)) {
+      return false;
+    }
+    return hi == 0 || fail();
+  }
+
+  bool take_view(uint32_t len, StringView &out) {
+    if ((size_t)(end_ - p_) < len) {
+      return fail();
+    }
+    out.ptr = (const char *)p_;
+    out.len = len;
+    p_ += len;
+    return true;
+  }
+
+  // Length from a header with a fix form (fix_tag plus a length in fix_mask;
+  // none if fix_mask is 0), an 8-bit form (none if op8 is 0), a 16-bit form
+  // and a 32-bit form, whose type byte always follows the 16-bit one
+  bool take_length(uint8_t fix_tag, uint8_t fix_mask, uint8_t op8, uint8_t op16, uint32_t &len) {
+    uint8_t b;
+    if (!take_byte(b)) {
+      return false;
+    }
+    if (fix_mask && (b & ~fix_mask) == fix_tag) {
+      len = b & fix_mask;
+      return true;
+    } else if (op8 && b == op8) {
+      return take_be(1, len);
+    } else if (b == op16) {
+      return take_be(2, len);
+    } else if (b == op16 + 1) {
+      return take_be(4, len);
+    }
+    return fail();
+  }
+
+public:
+  MPackDirectReader(const void *buffer, size_t size)
+      : p_((const uint8_t *)buffer), end_((const uint8_t *)buffer + size), error_(false) {}
+
+  // Read string (zero-copy - returns view into msgpack buffer)
+  bool read_string(StringView &str) {
+    uint32_t len;
+    return take_length(0xa0, 0x1f, 0xd9, 0xda, len) && take_view(len, str);
+  }
+
+  // Read binary data (zero-copy - returns view into msgpack buffer)
+  bool read_bin(StringView &bin) {
+    uint32_t len;
+    return take_length(0, 0, 0xc4, 0xc5, len) && take_view(len, bin);
+  }
+
+  // Enter array, returns element count
+  bool enter_array(uint32_t &count) { return take_length(0x90, 0x0f, 0, 0xdc, count); }
+
+  // Enter map, returns pair count
+  bool enter_map(uint32_t &count) { return take_length(0x80, 0x0f, 0, 0xde, count); }
+
+  // Read unsigned integer
+  bool read_uint(uint32_t &value) {
+    uint8_t b;
+    if (!take_byte(b)) {
+      return false;
+    }
+    if (b < 0x80) {
+      value = b;
+      return true;
+    }
+    switch (b) {
+    case 0xcc:
+      return take_be(1, value);
+    case 0xcd:
+      return take_be(2, value);
+    case 0xce:
+      return take_be(4, value);
+    case 0xcf:
+      return take_be64(value);
+    default:
+      return fail();
+    }
+  }
+
+  // Read signed integer (positive values may be packed as uint)
+  bool read_int(int32_t &value) {
+    if (error_ || p_ == end_) {
+      return fail();
+    }
+    uint8_t b = *p_;
+    if (b >= 0xe0) {
+      p_++;
+      value = (int8_t)b;
+      return true;
+    }
+    uint32_t raw;
+    switch (b) {
+    case 0xd0:
+    case 0xd1:
+    case 0xd2:
+      p_++;
+      if (!take_be((size_t)1 << (b - 0xd0), raw)) {
+        return false;
+      }
+      // Sign-extend from the encoded width
+      value = b == 0xd0 ? (int8_t)raw : b == 0xd1 ? (int16_t)raw : (int32_t)raw;
+      return true;
+    case 0xd3: {
+      p_++;
+      uint32_t hi;
+      if (!take_be(4, hi) || !take_be(4, raw)) {
+        return false;
+      }
+      // In 32-bit range only if the high word is the sign extension of the low
+      if (hi != ((int32_t)raw < 0 ? 0xffffffffu : 0)) {
+        return fail();
+      }
+      value = (int32_t)raw;
+      return true;
+    }
+    default:
+      if (!read_uint(raw) || raw > 0x7fffffff) {
+        return fail();
+      }
+      value = (int32_t)raw;
+      return true;
+    }
+  }
+
+  // Read array of strings (zero-copy)
+  bool read_stringarray(StringView *views, size_t max_count, size_t &actual_count) {
+    uint32_t count;
+    if (!enter_array(count)) {
+      return false;
+    }
+    if (count > max_count) {
+      return fail();
+    }
+    for (uint32_t i = 0; i < count; i++) {
+      if (!read_string(views[i])) {
+        return false;
+      }
+    }
+    actual_count = count;
+    return true;
+  }
+
+  bool ok() const { return !error_; }
+  size_t bytes_remaining() const { return end_ - p_; }
+  // Current read position, e.g. to hand the rest of the buffer to another reader
+  const char *position() const { return (const char *)p_; }
+};
+
+class MPackDirectWriter {
+private:
+  uint8_t *start_;
+  uint8_t *p_;
+  uint8_t *end_;
+  bool error_;
+
+  bool reserve(size_t n) {
+    if (error_ || (size_t)(end_ - p_) < n) {
+      error_ = true;
+      return false;
+    }
+    return true;
+  }
+
+  void put_be(uint32_t v, size_t n) {
+    for (size_t i = n; i > 0; i--) {
+      *p_++ = (uint8_t)(v >> (8 * (i - 1)));
+    }
+  }
+
+  // Header in its smallest form; see MPackDirectReader::take_length
+  void put_length(uint8_t fix_tag, uint32_t fix_max, uint8_t op8, uint8_t op16, uint32_t len) {
+    if (fix_max && len <= fix_max) {
+      if (reserve(1)) {
+        *p_++ = (uint8_t)(fix_tag | len);
+      }
+    } else if (op8 && len <= 0xff) {
+      if (reserve(2)) {
+        *p_++ = op8;
+        put_be(len, 1);
+      }
+    } else if (len <= 0xffff) {
+      if (reserve(3)) {
+        *p_++ = op16;
+        put_be(len, 2);
+      }
+    } else if (reserve(5)) {
+      *p_++ = (uint8_t)(op16 + 1);
+      put_be(len, 4);
+    }
+  }
+
+  void put_bytes(const void *data, uint32_t len) {
+    if (len > 0 && reserve(len)) {
+      memcpy(p_, data, len);
+      p_ += len;
+    }
+  }
+
+public:
+  MPackDirectWriter(void *buffer, size_t size)
+      : start_((uint8_t *)buffer), p_((uint8_t *)buffer), end_((uint8_t *)buffer + size), error_(false) {}
+
+  MPackDirectWriter &str(const char *s, uint32_t len) {
+    put_length(0xa0, 0x1f, 0xd9, 0xda, len);
+    put_bytes(s, len);
+    return *this;
+  }
+
+  MPackDirectWriter &str(const char *s) { return str(s, (uint32_t)strlen(s)); }
+
+  MPackDirectWriter &str(const StringView &sv) { return str(sv.ptr, (uint32_t)sv.len); }
+
+  MPackDirectWriter &bin(const void *data, uint32_t len) {
+    put_length(0, 0, 0xc4, 0xc5, len);
+    put_bytes(data, len);
+    return *this;
+  }
+
+  // Start an array of N elements (caller must write N items after this)
+  MPackDirectWriter &array(uint32_t count) {
+    put_length(0x90, 0x0f, 0, 0xdc, count);
+    return *this;
+  }
+
+  MPackDirectWriter &pack(uint32_t v) {
+    if (v < 0x80) {
+      if (reserve(1)) {
+        *p_++ = (uint8_t)v;
+      }
+    } else {
+      put_length(0, 0, 0xcc, 0xcd, v);
+    }
+    return *this;
+  }
+
+  bool ok() const { return !error_; }
+  uint32_t size() const { return p_ - start_; }
+};
+
+#endif // OT_SHARED_MPACK_DIRECT_HPP
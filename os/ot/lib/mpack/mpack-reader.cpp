@@ -200,50 +200,35 @@ bool MPackReader::enter_map(uint32_t& count) {
   return true;
 }
 
+// The convenience readers know their layout, so they skip the tokenizer and
+// decode directly; between public calls the tokenizer holds no partial token,
+// so it can simply pick up from wherever the direct reader stopped.
 bool MPackReader::read_stringarray(StringView* views, size_t max_count, size_t& actual_count) {
-  uint32_t count;
-  if (!enter_array(count)) {
-    return false;
-  }
-
-  if (count > max_count) {
-    error_ = true;
-    return false;
-  }
-
-  actual_count = count;
-
-  for (uint32_t i = 0; i < count; i++) {
-    if (!read_string(views[i])) {
-      return false;
-    }
-  }
+  if (error_) return false;
 
-  return true;
+  MPackDirectReader direct(buf_, buflen_);
+  bool ok = direct.read_stringarray(views, max_count, actual_count);
+  skip_to(direct, ok);
+  return ok;
 }
 
 bool MPackReader::read_args_map(StringView* argv_views, size_t max_args, size_t& argc) {
-  uint32_t pairs;
-  if (!enter_map(pairs)) {
-    return false;
-  }
-
-  if (pairs != 1) {
-    error_ = true;
-    return false;
-  }
+  if (error_) return false;
 
-  // Read the key - should be "args"
+  MPackDirectReader direct(buf_, buflen_);
+  uint32_t pairs;
   StringView key;
-  if (!read_string(key)) {
-    return false;
-  }
+  // A single pair: "args" => array of strings
+  bool ok = direct.enter_map(pairs) && pairs == 1 && direct.read_string(key) && key.equals("args") &&
+            direct.read_stringarray(argv_views, max_args, argc);
+  skip_to(direct, ok);
+  return ok;
+}
 
-  if (!key.equals("args")) {
+void MPackReader::skip_to(const MPackDirectReader& direct, bool ok) {
+  if (!ok) {
     error_ = true;
-    return false;
   }
-
-  // Read the value - should be an array of strings
-  return read_stringarray(argv_views, max_args, argc);
+  buf_ = direct.position();
+  buflen_ = direct.bytes_remaining();
 }
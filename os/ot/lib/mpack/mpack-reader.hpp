@@ -3,6 +3,7 @@
 
 #include "ot/common.h"
 #include "ot/lib/error-codes.hpp"
+#include "ot/lib/mpack/mpack-direct.hpp"
 #include "ot/lib/mpack/mpack.h"
 #include "ot/lib/string-view.hpp"
 
@@ -17,6 +18,9 @@ private:
   // Internal: Read next token
   bool read_next(mpack_token_t& tok);
 
+  // Internal: Continue after data consumed by a direct reader, failing if it did
+  void skip_to(const MPackDirectReader& direct, bool ok);
+
 public:
   // Initialize reader with a buffer
   MPackReader(const void* buffer, size_t size);
@@ -0,0 +1,67 @@
+// pixel-ops-test.cpp - Unit tests for the pixel span kernels
+
+#include "ot/lib/pixel-ops.hpp"
+#include "vendor/doctest.h"
+
+// Per-channel reference blend, as the framework originally computed it
+static uint32_t reference_blend(uint32_t dst, uint32_t color, uint32_t alpha) {
+  uint32_t out = 0xFF000000;
+  for (int shift = 0; shift <= 16; shift += 8) {
+    uint32_t s = (color >> shift) & 0xFF;
+    uint32_t d = (dst >> shift) & 0xFF;
+    out |= ((s * alpha + d * (255 - alpha)) / 255) << shift;
+  }
+  return out;
+}
+
+TEST_CASE("div255 lanes are exact") {
+  for (uint32_t x = 0; x <= 255 * 255; x++) {
+    uint32_t packed = (x << 16) | (255 * 255 - x);
+    uint32_t result = graphics::div255_lanes(packed);
+    if ((result >> 16) != x / 255 || (result & 0xFFFF) != (255 * 255 - x) / 255) {
+      FAIL("mismatch at " << x);
+    }
+  }
+}
+
+TEST_CASE("blend matches per-channel reference") {
+  uint32_t colors[] = {0xFF000000, 0xFFFFFFFF, 0xFF123456, 0xFFCCCCDD, 0xFF1A1A2E};
+  for (uint32_t src : colors) {
+    for (uint32_t dst : colors) {
+      for (uint32_t a = 1; a < 255; a++) {
+        CHECK(graphics::blend(dst, src, a) == reference_blend(dst, src, a));
+      }
+    }
+  }
+}
+
+TEST_CASE("fill and blend spans") {
+  uint32_t buf[37];
+
+  SUBCASE("fill covers exactly count pixels") {
+    buf[36] = 0;
+    graphics::fill_span(buf, 36, 0xFFABCDEF);
+    for (int i = 0; i < 36; i++) {
+      CHECK(buf[i] == 0xFFABCDEF);
+    }
+    CHECK(buf[36] == 0);
+  }
+
+  SUBCASE("coverage mask skips transparent pixels") {
+    graphics::fill_span(buf, 4, 0xFF000000);
+    uint8_t mask[4] = {0, 255, 128, 0};
+    graphics::blend_span(buf, mask, 4, 0xFFFFFFFF);
+    CHECK(buf[0] == 0xFF000000);
+    CHECK(buf[1] == 0xFFFFFFFF);
+    CHECK(buf[2] == reference_blend(0xFF000000, 0xFFFFFFFF, 128));
+    CHECK(buf[3] == 0xFF000000);
+  }
+
+  SUBCASE("constant alpha blend") {
+    graphics::fill_span(buf, 37, 0xFF102030);
+    graphics::blend_span(buf, 37, 0xFFF0E0D0, 77);
+    for (int i = 0; i < 37; i++) {
+      CHECK(buf[i] == reference_blend(0xFF102030, 0xFFF0E0D0, 77));
+    }
+  }
+}
@@ -4,4 +4,14 @@ uint64_t o_time_get(void) {
   uint64_t time;
   asm volatile("rdtime %0" : "=r"(time));
   return time;
-}
\ No newline at end of file
+}
+uint64_t o_cycles_get(void) {
+  // rv32 reads the counter in halves; retry if the low half wrapped in between
+  uint32_t hi, lo, hi2;
+  do {
+    asm volatile("rdcycleh %0" : "=r"(hi));
+    asm volatile("rdcycle %0" : "=r"(lo));
+    asm volatile("rdcycleh %0" : "=r"(hi2));
+  } while (hi != hi2);
+  return ((uint64_t)hi << 32) | lo;
+}
@@ -6,6 +6,8 @@ EM_JS(uintptr_t, _o_time_get, (), { return Module.time_get(); });
 EM_JS(void, _o_puts, (char *str), { Module.print2(UTF8ToString(str), false); });
 uint64_t o_time_get(void) { return _o_time_get(); }
 
+uint64_t o_cycles_get(void) { return (uint64_t)(emscripten_get_now() * 1000000.0); }
+
 int ou_io_puts(char *str, int size) {
   for (int i = 0; i < size; i++) {
     oputchar(str[i]);
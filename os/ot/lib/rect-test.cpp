@@ -0,0 +1,122 @@
+// rect-test.cpp - Unit tests for graphics::Rect and graphics::DamageList
+
+#include "ot/lib/rect.hpp"
+#include "vendor/doctest.h"
+
+using graphics::DamageList;
+using graphics::Rect;
+
+TEST_CASE("rect intersect and unite") {
+  Rect a(0, 0, 10, 10);
+  Rect b(5, 5, 10, 10);
+
+  SUBCASE("overlapping intersect") {
+    Rect i = a.intersect(b);
+    CHECK(i.x == 5);
+    CHECK(i.y == 5);
+    CHECK(i.w == 5);
+    CHECK(i.h == 5);
+  }
+
+  SUBCASE("disjoint intersect is empty") { CHECK(a.intersect(Rect(20, 20, 5, 5)).empty()); }
+
+  SUBCASE("unite covers both") {
+    Rect u = a.unite(b);
+    CHECK(u.x == 0);
+    CHECK(u.y == 0);
+    CHECK(u.w == 15);
+    CHECK(u.h == 15);
+  }
+
+  SUBCASE("unite with empty returns other") {
+    Rect u = Rect().unite(b);
+    CHECK(u.x == 5);
+    CHECK(u.w == 10);
+  }
+
+  SUBCASE("clip to surface") {
+    Rect c = Rect(-5, 90, 20, 20).clip(100, 100);
+    CHECK(c.x == 0);
+    CHECK(c.y == 90);
+    CHECK(c.w == 15);
+    CHECK(c.h == 10);
+  }
+}
+
+TEST_CASE("rect encodings round trip") {
+  Rect r(1000, 700, 24, 300);
+
+  SUBCASE("packed IPC arguments") {
+    Rect p = Rect::from_packed(r.packed_origin(), r.packed_extent());
+    CHECK(p.x == 1000);
+    CHECK(p.y == 700);
+    CHECK(p.w == 24);
+    CHECK(p.h == 300);
+  }
+
+  SUBCASE("comm page wire format") {
+    uint8_t wire[graphics::RECT_WIRE_SIZE];
+    graphics::rect_encode(wire, r);
+    Rect d = graphics::rect_decode(wire);
+    CHECK(d.x == 1000);
+    CHECK(d.y == 700);
+    CHECK(d.w == 24);
+    CHECK(d.h == 300);
+  }
+}
+
+TEST_CASE("damage list") {
+  DamageList d;
+
+  SUBCASE("empty rects are ignored") {
+    d.add(Rect(0, 0, 0, 10));
+    CHECK(d.empty());
+  }
+
+  SUBCASE("disjoint rects are kept separate") {
+    d.add(Rect(0, 0, 10, 10));
+    d.add(Rect(50, 50, 10, 10));
+    CHECK(d.count == 2);
+  }
+
+  SUBCASE("overlapping rects merge") {
+    d.add(Rect(0, 0, 10, 10));
+    d.add(Rect(5, 5, 10, 10));
+    CHECK(d.count == 1);
+    CHECK(d.rects[0].w == 15);
+  }
+
+  SUBCASE("adjacent rows merge") {
+    d.add(Rect(0, 0, 100, 20));
+    d.add(Rect(0, 20, 100, 20));
+    CHECK(d.count == 1);
+    CHECK(d.rects[0].h == 40);
+  }
+
+  SUBCASE("merge cascades into earlier neighbours") {
+    d.add(Rect(0, 0, 10, 10));
+    d.add(Rect(30, 0, 10, 10));
+    d.add(Rect(5, 0, 30, 10));
+    CHECK(d.count == 1);
+    CHECK(d.rects[0].x == 0);
+    CHECK(d.rects[0].w == 40);
+  }
+
+  SUBCASE("overflow collapses to bounding box") {
+    for (int i = 0; i < DamageList::MAX_RECTS + 1; i++) {
+      d.add(Rect(i * 20, 0, 10, 10));
+    }
+    CHECK(d.count == 1);
+    CHECK(d.rects[0].x == 0);
+    CHECK(d.rects[0].right() == DamageList::MAX_RECTS * 20 + 10);
+  }
+
+  SUBCASE("encode writes every rect") {
+    d.add(Rect(0, 0, 10, 10));
+    d.add(Rect(50, 50, 10, 10));
+    ou::vector<uint8_t> buf;
+    d.encode(buf);
+    CHECK(buf.size() == 2 * graphics::RECT_WIRE_SIZE);
+    CHECK(graphics::rect_decode(buf.data() + graphics::RECT_WIRE_SIZE).x == 50);
+  }
+}
@@ -0,0 +1,157 @@
+// rect.hpp - Screen rectangles and damage tracking for partial graphics flushes
+#pragma once
+
+#include "ot/common.h"
+#include "ot/user/vector.hpp"
+
+namespace graphics {
+
+// Axis-aligned rectangle in framebuffer pixels. A rectangle with a non-positive
+// width or height is empty.
+struct Rect {
+  int x;
+  int y;
+  int w;
+  int h;
+
+  Rect() : x(0), y(0), w(0), h(0) {}
+  Rect(int x, int y, int w, int h) : x(x), y(y), w(w), h(h) {}
+
+  bool empty() const { return w <= 0 || h <= 0; }
+  int right() const { return x + w; }
+  int bottom() const { return y + h; }
+  int area() const { return empty() ? 0 : w * h; }
+
+  bool contains(const Rect &o) const {
+    return !o.empty() && o.x >= x && o.y >= y && o.right() <= right() && o.bottom() <= bottom();
+  }
+
+  // Overlapping area of both rectangles (empty if they don't overlap)
+  Rect intersect(const Rect &o) const {
+    int x0 = x > o.x ? x : o.x;
+    int y0 = y > o.y ? y : o.y;
+    int x1 = right() < o.right() ? right() : o.right();
+    int y1 = bottom() < o.bottom() ? bottom() : o.bottom();
+    if (x1 <= x0 || y1 <= y0) {
+      return Rect();
+    }
+    return Rect(x0, y0, x1 - x0, y1 - y0);
+  }
+
+  // Smallest rectangle covering both rectangles
+  Rect unite(const Rect &o) const {
+    if (empty())
+      return o;
+    if (o.empty())
+      return *this;
+    int x0 = x < o.x ? x : o.x;
+    int y0 = y < o.y ? y : o.y;
+    int x1 = right() > o.right() ? right() : o.right();
+    int y1 = bottom() > o.bottom() ? bottom() : o.bottom();
+    return Rect(x0, y0, x1 - x0, y1 - y0);
+  }
+
+  // Clip to a width x height surface anchored at the origin
+  Rect clip(int width, int height) const { return intersect(Rect(0, 0, width, height)); }
+
+  // Inline IPC encoding: two 16-bit coordinates packed into one register
+  uintptr_t packed_origin() const { return ((uintptr_t)(x & 0xFFFF) << 16) | (uintptr_t)(y & 0xFFFF); }
+  uintptr_t packed_extent() const { return ((uintptr_t)(w & 0xFFFF) << 16) | (uintptr_t)(h & 0xFFFF); }
+
+  static Rect from_packed(uintptr_t origin, uintptr_t extent) {
+    return Rect((int)((origin >> 16) & 0xFFFF), (int)(origin & 0xFFFF), (int)((extent >> 16) & 0xFFFF),
+                (int)(extent & 0xFFFF));
+  }
+};
+
+// Comm page encoding for flush_rects: x, y, w, h as little-endian uint16 values
+static const size_t RECT_WIRE_SIZE = 8;
+
+inline void rect_encode(uint8_t *out, const Rect &r) {
+  int fields[4] = {r.x, r.y, r.w, r.h};
+  for (int i = 0; i < 4; i++) {
+    out[i * 2] = (uint8_t)(fields[i] & 0xFF);
+    out[i * 2 + 1] = (uint8_t)((fields[i] >> 8) & 0xFF);
+  }
+}
+
+inline Rect rect_decode(const uint8_t *in) {
+  int fields[4];
+  for (int i = 0; i < 4; i++) {
+    fields[i] = (int)in[i * 2] | ((int)in[i * 2 + 1] << 8);
+  }
+  return Rect(fields[0], fields[1], fields[2], fields[3]);
+}
+
+// Small fixed-capacity list of damaged regions. Overlapping rectangles are
+// merged as they are added, and once the list is full everything collapses into
+// a single bounding box, so a flush never issues more than MAX_RECTS transfers.
+struct DamageList {
+  static const int MAX_RECTS = 16;
+
+  Rect rects[MAX_RECTS];
+  int count;
+
+  DamageList() : count(0) {}
+
+  bool empty() const { return count == 0; }
+  void clear() { count = 0; }
+
+  void add(const Rect &r) {
+    if (r.empty()) {
+      return;
+    }
+
+    Rect merged = r;
+    // Absorb any existing rectangles that overlap the new one; repeat because
+    // a merge can grow the rectangle into previously disjoint neighbours
+    bool changed = true;
+    while (changed) {
+      changed = false;
+      for (int i = 0; i < count; i++) {
+        if (!rects[i].intersect(merged).empty() || touches(rects[i], merged)) {
+          merged = merged.unite(rects[i]);
+          rects[i] = rects[--count];
+          changed = true;
+          break;
+        }
+      }
+    }
+
+    if (count == MAX_RECTS) {
+      merged = merged.unite(bounds());
+      count = 0;
+    }
+    rects[count++] = merged;
+  }
+
+  // Bounding box of all damage
+  Rect bounds() const {
+    Rect b;
+    for (int i = 0; i < count; i++) {
+      b = b.unite(rects[i]);
+    }
+    return b;
+  }
+
+  // Append the wire encoding of every rectangle to buf (for flush_rects)
+  void encode(ou::vector<uint8_t> &buf) const {
+    for (int i = 0; i < count; i++) {
+      uint8_t wire[RECT_WIRE_SIZE];
+      rect_encode(wire, rects[i]);
+      for (size_t j = 0; j < RECT_WIRE_SIZE; j++) {
+        buf.push_back(wire[j]);
+      }
+    }
+  }
+
+private:
+  // Rectangles sharing a full edge merge into one without covering extra pixels
+  static bool touches(const Rect &a, const Rect &b) {
+    bool same_columns = a.x == b.x && a.w == b.w && (a.bottom() == b.y || b.bottom() == a.y);
+    bool same_rows = a.y == b.y && a.h == b.h && (a.right() == b.x || b.right() == a.x);
+    return same_columns || same_rows;
+  }
+};
+
+} // namespace graphics
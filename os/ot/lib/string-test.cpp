@@ -3,6 +3,21 @@
 #include "ot/user/string.hpp"
 #include "vendor/doctest.h"
 
+#ifdef OT_POSIX
+#include <stdlib.h>
+// Provide OU memory functions for the test environment, counting allocations
+static size_t allocations = 0;
+void *ou_malloc(size_t size) {
+  allocations++;
+  return malloc(size);
+}
+void ou_free(void *ptr) { free(ptr); }
+void *ou_realloc(void *ptr, size_t size) {
+  allocations++;
+  return realloc(ptr, size);
+}
+#endif
+
 TEST_CASE("string construction") {
   SUBCASE("default constructor") {
     ou::string s;
@@ -119,6 +134,23 @@ TEST_CASE("string append operations") {
     CHECK(s.length() == 5);
     CHECK(strcmp(s.c_str(), "test!") == 0);
   }
+
+  SUBCASE("append from itself") {
+    // Outgrows the inline buffer, which is reused for the heap capacity
+    ou::string s("abcdefghijklmnopqrst");
+    s.append(s.data(), s.length());
+    CHECK(strcmp(s.c_str(), "abcdefghijklmnopqrstabcdefghijklmnopqrst") == 0);
+
+    // Grows the heap block, which may move
+    s.append(s);
+    CHECK(s.length() == 80);
+    CHECK(memcmp(s.c_str(), s.c_str() + 40, 40) == 0);
+
+    // A suffix of the string
+    ou::string t("xyz");
+    t.append(t.data() + 1, 2);
+    CHECK(strcmp(t.c_str(), "xyzyz") == 0);
+  }
 }
 
 TEST_CASE("string insert operations") {
@@ -297,6 +329,45 @@ TEST_CASE("string clear and capacity") {
   }
 }
 
+TEST_CASE("string inline storage") {
+  SUBCASE("short strings fit inline") {
+    ou::string s("hello");
+    CHECK(s.capacity() == ou::string::LOCAL_CAPACITY + 1);
+    s.append("0123456789012345678", 18);
+    CHECK(s.length() == ou::string::LOCAL_CAPACITY);
+    CHECK(s.capacity() == ou::string::LOCAL_CAPACITY + 1);
+  }
+
+  SUBCASE("growing past inline storage keeps contents") {
+    ou::string s("0123456789");
+    s.append("abcdefghijklmnopqrstuvwxyz");
+    CHECK(s.capacity() > ou::string::LOCAL_CAPACITY + 1);
+    CHECK(strcmp(s.c_str(), "0123456789abcdefghijklmnopqrstuvwxyz") == 0);
+  }
+
+  SUBCASE("moving inline and heap strings") {
+    ou::string small("abc");
+    ou::string big("a string that is much too long to be stored inline");
+    ou::string a(static_cast<ou::string &&>(small));
+    ou::string b(static_cast<ou::string &&>(big));
+    CHECK(a.compare("abc") == 0);
+    CHECK(b.compare("a string that is much too long to be stored inline") == 0);
+    CHECK(small.empty());
+    CHECK(big.empty());
+    a = static_cast<ou::string &&>(b);
+    CHECK(a.compare("a string that is much too long to be stored inline") == 0);
+    b = "xyz";
+    a = static_cast<ou::string &&>(b);
+    CHECK(a.compare("xyz") == 0);
+  }
+
+  SUBCASE("assigning from itself") {
+    ou::string s("abcdef");
+    s = s.c_str() + 2;
+    CHECK(s.compare("cdef") == 0);
+  }
+}
+
 TEST_CASE("string erase operations") {
   SUBCASE("erase from beginning") {
     ou::string s("hello world");
@@ -409,3 +480,90 @@ TEST_CASE("string erase operations") {
     CHECK(strcmp(s.c_str(), "hello") == 0);
   }
 }
+
+TEST_CASE("string allocation counts") {
+  SUBCASE("short strings never allocate") {
+    size_t before = allocations;
+    ou::string a("token");
+    ou::string b(a);
+    ou::string c = a.substr(1, 3);
+    b = c;
+    b += "-suffix";
+    ou::string d(static_cast<ou::string &&>(b));
+    CHECK(d.compare("oke-suffix") == 0);
+    CHECK(allocations == before);
+  }
+
+  SUBCASE("long strings allocate once per copy") {
+    const char *text = "a path argument that is too long to be inline";
+    size_t before = allocations;
+    ou::string a(text);
+    CHECK(allocations == before + 1);
+    ou::string b(a);
+    CHECK(allocations == before + 2);
+    ou::string c(static_cast<ou::string &&>(a));
+    CHECK(allocations == before + 2);
+    b = c;
+    CHECK(allocations == before + 2);
+  }
+}
+
+TEST_CASE("shared_string") {
+  const char *text = "a path argument that is too long to be inline";
+
+  SUBCASE("copies share one allocation") {
+    size_t before = allocations;
+    ou::shared_string a(text);
+    CHECK(allocations == before + 1);
+    ou::shared_string b(a);
+    ou::shared_string c;
+    c = b;
+    ou::shared_string d(static_cast<ou::shared_string &&>(b));
+    CHECK(allocations == before + 1);
+    CHECK(a.use_count() == 3);
+    CHECK(b.empty());
+    CHECK(c.data() == a.data());
+    CHECK(d.compare(text) == 0);
+  }
+
+  SUBCASE("last reference frees the block") {
+    ou::shared_string a(text);
+    {
+      ou::shared_string b(a);
+      CHECK(a.use_count() == 2);
+    }
+    CHECK(a.use_count() == 1);
+    a = ou::shared_string("other");
+    CHECK(a.compare("other") == 0);
+    CHECK(a.use_count() == 1);
+    a = a;
+    CHECK(a.compare("other") == 0);
+  }
+
+  SUBCASE("empty strings") {
+    size_t before = allocations;
+    ou::shared_string a;
+    ou::shared_string b("");
+    CHECK(a.empty());
+    CHECK(strcmp(b.c_str(), "") == 0);
+    CHECK(a == b);
+    CHECK(a.use_count() == 0);
+    CHECK(allocations == before);
+  }
+
+  SUBCASE("conversions and comparison") {
+    ou::string s("hello");
+    ou::shared_string a(s);
+    CHECK(a.length() == 5);
+    CHECK(a == "hello");
+    CHECK(a != "help");
+    CHECK(a.compare(ou::string_view("hello world", 5)) == 0);
+    CHECK(a.compare(ou::string_view("hellp")) < 0);
+    ou::string_view v(a);
+    CHECK(v.length() == 5);
+    ou::string copy = a.str();
+    copy += "!";
+    CHECK(a == "hello");
+    CHECK(copy.compare("hello!") == 0);
+  }
+}
@@ -448,3 +448,87 @@ TEST_CASE("vector iterators") {
     CHECK(v[2] == 6);
   }
 }
+
+static_assert(ou::is_trivially_relocatable<int *>::value, "pointers move by memcpy");
+static_assert(!ou::is_trivially_relocatable<ou::string>::value, "string points into itself");
+
+TEST_CASE("small_vector") {
+  SUBCASE("stays inline up to its capacity") {
+    ou::small_vector<int, 4> v;
+    for (int i = 0; i < 4; i++) {
+      v.push_back(i);
+    }
+    CHECK(v.is_inline());
+    v.push_back(4);
+    CHECK(!v.is_inline());
+    CHECK(v.size() == 5);
+    CHECK(v[0] == 0);
+    CHECK(v[4] == 4);
+  }
+
+  SUBCASE("strings survive growth, insert and erase") {
+    ou::small_vector<ou::string, 2> v;
+    v.push_back(ou::string("a"));
+    v.push_back(ou::string("a string too long for inline storage"));
+    v.push_back(ou::string("c"));
+    v.insert(1, ou::string("b"));
+    CHECK(v.size() == 4);
+    CHECK(v[0].compare("a") == 0);
+    CHECK(v[1].compare("b") == 0);
+    CHECK(v[2].compare("a string too long for inline storage") == 0);
+    CHECK(v[3].compare("c") == 0);
+    v.erase(0, 2);
+    CHECK(v.size() == 2);
+    CHECK(v[0].compare("a string too long for inline storage") == 0);
+    CHECK(v[1].compare("c") == 0);
+  }
+
+  SUBCASE("inserting a copy of an element while growing") {
+    ou::small_vector<ou::string, 2> v;
+    v.push_back(ou::string("x"));
+    v.push_back(ou::string("y"));
+    v.insert(0, 3, v[1]);
+    CHECK(v.size() == 5);
+    CHECK(v[0].compare("y") == 0);
+    CHECK(v[2].compare("y") == 0);
+    CHECK(v[3].compare("x") == 0);
+  }
+
+  SUBCASE("moving out of the inline buffer") {
+    ou::small_vector<ou::string, 4> small;
+    small.push_back(ou::string("one"));
+    small.push_back(ou::string("two"));
+    ou::vector<ou::string> v(static_cast<ou::vector<ou::string> &&>(small));
+    CHECK(v.size() == 2);
+    CHECK(v[1].compare("two") == 0);
+    CHECK(small.empty());
+    small.push_back(ou::string("three"));
+    CHECK(small[0].compare("three") == 0);
+  }
+
+  SUBCASE("moving a heap buffer takes it") {
+    ou::small_vector<int, 2> a;
+    for (int i = 0; i < 10; i++) {
+      a.push_back(i);
+    }
+    const int *data = a.data();
+    ou::small_vector<int, 2> b(static_cast<ou::small_vector<int, 2> &&>(a));
+    CHECK(b.data() == data);
+    CHECK(b.size() == 10);
+    CHECK(a.empty());
+    a.push_back(7);
+    CHECK(a[0] == 7);
+    a = static_cast<ou::small_vector<int, 2> &&>(b);
+    CHECK(a.size() == 10);
+    CHECK(a.data() == data);
+  }
+
+  SUBCASE("works where a vector is expected") {
+    ou::small_vector<int, 8> v;
+    ou::vector<int> &base = v;
+    base.resize(3, 5);
+    CHECK(v.size() == 3);
+    CHECK(v[2] == 5);
+    CHECK(v.is_inline());
+  }
+}
@@ -0,0 +1,145 @@
+/**
+ * XXH32 implementation following the xxHash specification
+ * (https://github.com/Cyan4973/xxHash/blob/dev/doc/xxhash_spec.md).
+ */
+
+#include "ot/lib/xxhash.hpp"
+#include <string.h>
+
+static const uint32_t PRIME1 = 0x9E3779B1U;
+static const uint32_t PRIME2 = 0x85EBCA77U;
+static const uint32_t PRIME3 = 0xC2B2AE3DU;
+static const uint32_t PRIME4 = 0x27D4EB2FU;
+static const uint32_t PRIME5 = 0x165667B1U;
+
+static inline uint32_t rotl32(uint32_t x, int n) { return (x << n) | (x >> (32 - n)); }
+
+// Little-endian 32-bit load, see md5.cpp
+static inline uint32_t load_le32(const uint8_t *p) {
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+  uint32_t v;
+  memcpy(&v, p, 4);
+  return v;
+#else
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+#endif
+}
+
+static inline uint32_t round32(uint32_t acc, uint32_t input) {
+  acc += input * PRIME2;
+  acc = rotl32(acc, 13);
+  return acc * PRIME1;
+}
+
+// Consume whole 16-byte stripes, returning the number of bytes used
+static size_t consume_stripes(uint32_t acc[4], const uint8_t *p, size_t len) {
+  uint32_t a0 = acc[0], a1 = acc[1], a2 = acc[2], a3 = acc[3];
+  size_t used = len & ~(size_t)15;
+  const uint8_t *end = p + used;
+  if (((uintptr_t)p & 3) == 0) {
+    const uint8_t *q = (const uint8_t *)__builtin_assume_aligned(p, 4);
+    for (; q < end; q += 16) {
+      a0 = round32(a0, load_le32(q));
+      a1 = round32(a1, load_le32(q + 4));
+      a2 = round32(a2, load_le32(q + 8));
+      a3 = round32(a3, load_le32(q + 12));
+    }
+  } else {
+    for (; p < end; p += 16) {
+      a0 = round32(a0, load_le32(p));
+      a1 = round32(a1, load_le32(p + 4));
+      a2 = round32(a2, load_le32(p + 8));
+      a3 = round32(a3, load_le32(p + 12));
+    }
+  }
+  acc[0] = a0;
+  acc[1] = a1;
+  acc[2] = a2;
+  acc[3] = a3;
+  return used;
+}
+
+// Mix in the last 0-15 bytes and avalanche
+static uint32_t finalize(uint32_t h, const uint8_t *p, size_t len) {
+  for (; len >= 4; len -= 4, p += 4) {
+    h += load_le32(p) * PRIME3;
+    h = rotl32(h, 17) * PRIME4;
+  }
+  for (; len > 0; len--, p++) {
+    h += *p * PRIME5;
+    h = rotl32(h, 11) * PRIME1;
+  }
+  h ^= h >> 15;
+  h *= PRIME2;
+  h ^= h >> 13;
+  h *= PRIME3;
+  h ^= h >> 16;
+  return h;
+}
+
+static inline uint32_t merge_accumulators(const uint32_t acc[4]) {
+  return rotl32(acc[0], 1) + rotl32(acc[1], 7) + rotl32(acc[2], 12) + rotl32(acc[3], 18);
+}
+
+void xxh32_init(XXH32Context *ctx, uint32_t seed) {
+  ctx->acc[0] = seed + PRIME1 + PRIME2;
+  ctx->acc[1] = seed + PRIME2;
+  ctx->acc[2] = seed;
+  ctx->acc[3] = seed - PRIME1;
+  ctx->seed = seed;
+  ctx->total_len = 0;
+  ctx->large_len = false;
+  ctx->buffer_len = 0;
+}
+
+void xxh32_update(XXH32Context *ctx, const uint8_t *input, size_t len) {
+  ctx->total_len += (uint32_t)len;
+  if (len >= 16 || ctx->total_len >= 16) {
+    ctx->large_len = true;
+  }
+
+  if (ctx->buffer_len + len < 16) {
+    memcpy(ctx->buffer + ctx->buffer_len, input, len);
+    ctx->buffer_len += (uint32_t)len;
+    return;
+  }
+
+  if (ctx->buffer_len != 0) {
+    size_t fill = 16 - ctx->buffer_len;
+    memcpy(ctx->buffer + ctx->buffer_len, input, fill);
+    consume_stripes(ctx->acc, ctx->buffer, 16);
+    input += fill;
+    len -= fill;
+    ctx->buffer_len = 0;
+  }
+
+  size_t used = consume_stripes(ctx->acc, input, len);
+  memcpy(ctx->buffer, input + used, len - used);
+  ctx->buffer_len = (uint32_t)(len - used);
+}
+
+void xxh32_final(XXH32Context *ctx, uint8_t digest[4]) {
+  uint32_t h = ctx->large_len ? merge_accumulators(ctx->acc) : ctx->seed + PRIME5;
+  h += ctx->total_len;
+  h = finalize(h, ctx->buffer, ctx->buffer_len);
+
+  digest[0] = (uint8_t)(h >> 24);
+  digest[1] = (uint8_t)(h >> 16);
+  digest[2] = (uint8_t)(h >> 8);
+  digest[3] = (uint8_t)h;
+}
+
+uint32_t xxh32(const void *data, size_t len, uint32_t seed) {
+  const uint8_t *p = (const uint8_t *)data;
+  uint32_t h;
+  if (len >= 16) {
+    uint32_t acc[4] = {seed + PRIME1 + PRIME2, seed + PRIME2, seed, seed - PRIME1};
+    size_t used = consume_stripes(acc, p, len);
+    p += used;
+    h = merge_accumulators(acc);
+  } else {
+    h = seed + PRIME5;
+  }
+  h += (uint32_t)len;
+  return finalize(h, p, len & 15);
+}
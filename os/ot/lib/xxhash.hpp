@@ -0,0 +1,28 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * XXH32, the 32-bit variant of xxHash. A fast non-cryptographic hash for
+ * spotting accidental corruption; use MD5 where a file's digest has to match
+ * one computed elsewhere. XXH32 only needs 32-bit multiplies, which keeps it
+ * fast on rv32.
+ */
+
+struct XXH32Context {
+  uint32_t acc[4];     // one accumulator per 4-byte lane of a stripe
+  uint32_t seed;       // kept for inputs shorter than a stripe
+  uint32_t total_len;  // bytes hashed, mod 2^32
+  bool large_len;      // at least one full 16-byte stripe has been seen
+  uint32_t buffer_len; // bytes waiting in buffer
+  uint8_t buffer[16];  // partial stripe
+};
+
+void xxh32_init(XXH32Context *ctx, uint32_t seed = 0);
+void xxh32_update(XXH32Context *ctx, const uint8_t *input, size_t len);
+// Digest in canonical (big-endian) byte order, as printed by xxhsum
+void xxh32_final(XXH32Context *ctx, uint8_t digest[4]);
+
+// One-shot hash of a buffer
+uint32_t xxh32(const void *data, size_t len, uint32_t seed = 0);
@@ -0,0 +1,144 @@
+// edit-buffer-test.cpp - Unit tests for the editor's piece table
+
+#include <stdio.h>
+
+#include "vendor/doctest.h"
+
+#include "ot/user/edit-buffer.hpp"
+
+using edit::TextBuffer;
+
+static bool line_is(const TextBuffer &b, size_t line, const char *expected) {
+  ou::string out;
+  b.get_line(line, out);
+  return out == expected;
+}
+
+static bool text_is(const TextBuffer &b, const char *expected) {
+  ou::string out;
+  b.copy(0, b.size(), out);
+  return out == expected;
+}
+
+TEST_CASE("edit buffer: lines of loaded text") {
+  TextBuffer b;
+  CHECK(b.line_count() == 1);
+  CHECK(b.line_length(0) == 0);
+
+  b.load("one\ntwo\n\nfour", 13);
+  CHECK(b.size() == 13);
+  CHECK(b.line_count() == 4);
+  CHECK(b.line_start(1) == 4);
+  CHECK(b.line_length(2) == 0);
+  CHECK(line_is(b, 0, "one"));
+  CHECK(line_is(b, 3, "four"));
+  CHECK(b.char_at(b.offset_of(1, 2)) == 'o');
+
+  size_t line, col;
+  b.position_of(10, &line, &col);
+  CHECK(line == 3);
+  CHECK(col == 1);
+}
+
+TEST_CASE("edit buffer: insert and erase across pieces") {
+  TextBuffer b;
+  b.load("hello world", 11);
+
+  b.insert(5, ",", 1);
+  b.insert(6, "\nbig", 4);
+  CHECK(text_is(b, "hello,\nbig world"));
+  CHECK(b.line_count() == 2);
+  CHECK(line_is(b, 1, "big world"));
+
+  // Consecutive typing extends one piece
+  size_t pieces = b.piece_count();
+  b.insert(b.size(), "!", 1);
+  b.insert(b.size(), "!", 1);
+  CHECK(b.piece_count() == pieces + 1);
+  CHECK(line_is(b, 1, "big world!!"));
+
+  // Erase spanning original and added text, including the newline
+  b.erase(3, 7);
+  CHECK(text_is(b, "hel world!!"));
+  CHECK(b.line_count() == 1);
+  CHECK(b.line_length(0) == 11);
+}
+
+TEST_CASE("edit buffer: undo reverses changes in order") {
+  TextBuffer b;
+  b.load("abc\ndef", 7);
+
+  b.insert(3, "X", 1);
+  b.insert(4, "Y", 1); // Merged with the previous insert
+  b.break_undo_group();
+  b.erase(0, 2);
+  CHECK(text_is(b, "cXY\ndef"));
+  CHECK(b.undo_depth() == 2);
+
+  size_t offset;
+  CHECK(b.undo(&offset));
+  CHECK(offset == 0);
+  CHECK(text_is(b, "abcXY\ndef"));
+
+  CHECK(b.undo(&offset));
+  CHECK(offset == 3);
+  CHECK(text_is(b, "abc\ndef"));
+  CHECK(b.line_count() == 2);
+
+  CHECK(!b.undo(&offset));
+}
+
+TEST_CASE("edit buffer: many lines") {
+  ou::string text;
+  for (int i = 0; i < 1000; i++) {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "line %d\n", i);
+    text.append(buf);
+  }
+  TextBuffer b;
+  b.load(static_cast<ou::string &&>(text));
+  CHECK(b.line_count() == 1001);
+
+  b.insert(b.line_start(500), "x", 1);
+  CHECK(line_is(b, 500, "xline 500"));
+  CHECK(line_is(b, 999, "line 999"));
+  CHECK(b.line_start(501) == b.line_start(500) + 10);
+}
+
+TEST_CASE("edit buffer: viewed text across newline checkpoints") {
+  ou::string text;
+  for (int i = 0; i < 1000; i++) {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "line %d\n", i);
+    text.append(buf);
+  }
+  TextBuffer b;
+  b.load_view(text.data(), text.length());
+  CHECK(b.is_view());
+  CHECK(b.line_count() == 1001);
+  CHECK(line_is(b, 255, "line 255"));
+  CHECK(line_is(b, 256, "line 256"));
+  CHECK(line_is(b, 999, "line 999"));
+
+  // Splits land between checkpoints, so piece newline counts need the scan
+  b.erase(b.line_start(250), b.line_start(520) - b.line_start(250));
+  CHECK(b.line_count() == 1001 - 270);
+  CHECK(line_is(b, 249, "line 249"));
+  CHECK(line_is(b, 250, "line 520"));
+
+  size_t line, col;
+  b.position_of(b.line_start(600) + 3, &line, &col);
+  CHECK(line == 600);
+  CHECK(col == 3);
+
+  // Owning the text keeps the buffer intact after the view goes away
+  b.own_original();
+  CHECK(!b.is_view());
+  text.clear();
+  text.append("garbage garbage garbage");
+  CHECK(line_is(b, 250, "line 520"));
+
+  size_t offset;
+  CHECK(b.undo(&offset));
+  CHECK(line_is(b, 256, "line 256"));
+}
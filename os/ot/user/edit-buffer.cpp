@@ -0,0 +1,361 @@
+// edit-buffer.cpp - Piece table text storage for the editor
+
+#include "ot/user/edit-buffer.hpp"
+
+#include <string.h>
+
+namespace edit {
+
+// First index whose value is >= x
+static size_t lower_bound(const ou::vector<size_t> &v, size_t x) {
+  size_t lo = 0, hi = v.size();
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    if (v[mid] < x) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+static void index_newlines(const char *text, size_t length, size_t base, ou::vector<size_t> &out) {
+  for (size_t i = 0; i < length; i++) {
+    if (text[i] == '\n') {
+      out.push_back(base + i);
+    }
+  }
+}
+
+// Count newlines in [text, text + length), without touching more than needed
+static size_t count_in(const char *text, size_t length) {
+  size_t count = 0;
+  const char *end = text + length;
+  while (text < end) {
+    const char *nl = (const char *)memchr(text, '\n', end - text);
+    if (!nl) {
+      break;
+    }
+    count++;
+    text = nl + 1;
+  }
+  return count;
+}
+
+TextBuffer::TextBuffer() : original_size_(0), original_is_view_(false), size_(0), newlines_(0), merge_undo_(false) {
+  original_ = original_owned_.data();
+  reindex(0);
+}
+
+void TextBuffer::load(ou::string &&text) {
+  clear();
+  original_owned_ = static_cast<ou::string &&>(text);
+  original_ = original_owned_.data();
+  original_size_ = original_owned_.size();
+  index_original();
+}
+
+void TextBuffer::load(const char *text, size_t length) { load(ou::string(text, length)); }
+
+void TextBuffer::load_view(const char *text, size_t length) {
+  clear();
+  original_ = text;
+  original_size_ = length;
+  original_is_view_ = true;
+  index_original();
+}
+
+void TextBuffer::own_original() {
+  if (is_view()) {
+    original_owned_ = ou::string(original_, original_size_);
+    original_ = original_owned_.data();
+    original_is_view_ = false;
+  }
+}
+
+void TextBuffer::index_original() {
+  // One pass with memchr; only every ORIGINAL_CHECKPOINT-th newline is kept
+  size_t n = 0;
+  const char *p = original_;
+  const char *end = original_ + original_size_;
+  while (p < end) {
+    const char *nl = (const char *)memchr(p, '\n', end - p);
+    if (!nl) {
+      break;
+    }
+    if (n % ORIGINAL_CHECKPOINT == 0) {
+      original_checkpoints_.push_back(nl - original_);
+    }
+    n++;
+    p = nl + 1;
+  }
+
+  if (original_size_ > 0) {
+    Piece whole;
+    whole.source = ORIGINAL;
+    whole.start = 0;
+    whole.length = original_size_;
+    whole.newlines = n;
+    pieces_.push_back(whole);
+  }
+  reindex(0);
+}
+
+size_t TextBuffer::newlines_before(Source source, size_t offset) const {
+  if (source == ADDED) {
+    return lower_bound(added_newlines_, offset);
+  }
+  // Count from the last checkpoint before offset
+  size_t cp = lower_bound(original_checkpoints_, offset);
+  if (cp == 0) {
+    return count_in(original_, offset);
+  }
+  size_t from = original_checkpoints_[cp - 1];
+  return (cp - 1) * ORIGINAL_CHECKPOINT + 1 + count_in(original_ + from + 1, offset - from - 1);
+}
+
+size_t TextBuffer::nth_newline(Source source, size_t n) const {
+  if (source == ADDED) {
+    return added_newlines_[n];
+  }
+  size_t pos = original_checkpoints_[n / ORIGINAL_CHECKPOINT];
+  for (size_t k = n % ORIGINAL_CHECKPOINT; k > 0; k--) {
+    pos = (const char *)memchr(original_ + pos + 1, '\n', original_size_ - pos - 1) - original_;
+  }
+  return pos;
+}
+
+void TextBuffer::clear() {
+  original_owned_.clear();
+  original_ = original_owned_.data();
+  original_size_ = 0;
+  original_is_view_ = false;
+  added_.clear();
+  original_checkpoints_.clear();
+  added_newlines_.clear();
+  pieces_.clear();
+  undo_.clear();
+  merge_undo_ = false;
+  reindex(0);
+}
+
+TextBuffer::Piece TextBuffer::make_piece(Source source, size_t start, size_t length) const {
+  Piece p;
+  p.source = source;
+  p.start = start;
+  p.length = length;
+  p.newlines = count_newlines(source, start, start + length);
+  return p;
+}
+
+void TextBuffer::reindex(size_t from) {
+  piece_offsets_.resize(pieces_.size() + 1, 0);
+  piece_lines_.resize(pieces_.size() + 1, 0);
+  for (size_t i = from; i < pieces_.size(); i++) {
+    piece_offsets_[i + 1] = piece_offsets_[i] + pieces_[i].length;
+    piece_lines_[i + 1] = piece_lines_[i] + pieces_[i].newlines;
+  }
+  size_ = piece_offsets_[pieces_.size()];
+  newlines_ = piece_lines_[pieces_.size()];
+}
+
+size_t TextBuffer::piece_at(size_t offset) const {
+  // First piece that ends after offset; pieces_.size() when offset is the end
+  size_t lo = 0, hi = pieces_.size();
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    if (piece_offsets_[mid + 1] <= offset) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+size_t TextBuffer::split_at(size_t offset) {
+  size_t i = piece_at(offset);
+  if (i == pieces_.size() || piece_offsets_[i] == offset) {
+    return i;
+  }
+
+  Piece p = pieces_[i];
+  size_t left = offset - piece_offsets_[i];
+  pieces_[i] = make_piece(p.source, p.start, left);
+  pieces_.insert(i + 1, make_piece(p.source, p.start + left, p.length - left));
+  reindex(i);
+  return i + 1;
+}
+
+size_t TextBuffer::line_start(size_t line) const {
+  if (line == 0) {
+    return 0;
+  }
+  if (line > newlines_) {
+    line = newlines_;
+  }
+
+  // Find the piece holding the line-th newline
+  size_t lo = 0, hi = pieces_.size();
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    if (piece_lines_[mid + 1] < line) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+
+  const Piece &p = pieces_[lo];
+  size_t newline = nth_newline(p.source, newlines_before(p.source, p.start) + (line - piece_lines_[lo] - 1));
+  return piece_offsets_[lo] + (newline - p.start) + 1;
+}
+
+size_t TextBuffer::line_length(size_t line) const {
+  if (line > newlines_) {
+    line = newlines_;
+  }
+  size_t end = line < newlines_ ? line_start(line + 1) - 1 : size_;
+  return end - line_start(line);
+}
+
+void TextBuffer::position_of(size_t offset, size_t *line, size_t *col) const {
+  if (offset > size_) {
+    offset = size_;
+  }
+  size_t i = piece_at(offset);
+  if (i == pieces_.size()) {
+    *line = newlines_;
+  } else {
+    const Piece &p = pieces_[i];
+    *line = piece_lines_[i] + count_newlines(p.source, p.start, p.start + (offset - piece_offsets_[i]));
+  }
+  *col = offset - line_start(*line);
+}
+
+char TextBuffer::char_at(size_t offset) const {
+  size_t i = piece_at(offset);
+  if (i == pieces_.size()) {
+    return '\0';
+  }
+  return piece_data(pieces_[i])[offset - piece_offsets_[i]];
+}
+
+void TextBuffer::copy(size_t offset, size_t length, ou::string &out) const {
+  out.clear();
+  if (offset >= size_) {
+    return;
+  }
+  if (length > size_ - offset) {
+    length = size_ - offset;
+  }
+  out.reserve(length + 1);
+
+  for (size_t i = piece_at(offset); length > 0 && i < pieces_.size(); i++) {
+    size_t skip = offset - piece_offsets_[i];
+    size_t n = pieces_[i].length - skip;
+    if (n > length) {
+      n = length;
+    }
+    out.append(piece_data(pieces_[i]) + skip, n);
+    offset += n;
+    length -= n;
+  }
+}
+
+void TextBuffer::insert(size_t offset, const char *text, size_t length) {
+  if (length == 0) {
+    return;
+  }
+  if (offset > size_) {
+    offset = size_;
+  }
+
+  size_t start = added_.size();
+  added_.append(text, length);
+  index_newlines(text, length, start, added_newlines_);
+
+  // Typing appends to the piece that was just inserted, so grow it in place
+  size_t prev = offset > 0 ? piece_at(offset - 1) : pieces_.size();
+  if (prev < pieces_.size() && piece_offsets_[prev + 1] == offset && pieces_[prev].source == ADDED &&
+      pieces_[prev].start + pieces_[prev].length == start) {
+    pieces_[prev].length += length;
+    pieces_[prev].newlines += count_newlines(ADDED, start, start + length);
+    reindex(prev);
+  } else {
+    Piece p = make_piece(ADDED, start, length);
+    insert_pieces(offset, &p, 1);
+  }
+
+  if (merge_undo_ && !undo_.empty() && undo_.back().inserted &&
+      undo_.back().offset + undo_.back().length == offset) {
+    undo_.back().length += length;
+  } else {
+    Change c;
+    c.inserted = true;
+    c.offset = offset;
+    c.length = length;
+    undo_.push_back(static_cast<Change &&>(c));
+  }
+  merge_undo_ = true;
+}
+
+void TextBuffer::erase(size_t offset, size_t length) {
+  if (offset >= size_) {
+    return;
+  }
+  if (length > size_ - offset) {
+    length = size_ - offset;
+  }
+  if (length == 0) {
+    return;
+  }
+
+  Change c;
+  c.inserted = false;
+  c.offset = offset;
+  c.length = 0;
+  erase_pieces(offset, length, &c.removed);
+  undo_.push_back(static_cast<Change &&>(c));
+  merge_undo_ = false;
+}
+
+void TextBuffer::insert_pieces(size_t offset, const Piece *pieces, size_t count) {
+  size_t at = split_at(offset);
+  for (size_t k = 0; k < count; k++) {
+    pieces_.insert(at + k, pieces[k]);
+  }
+  reindex(at);
+}
+
+void TextBuffer::erase_pieces(size_t offset, size_t length, ou::vector<Piece> *removed) {
+  size_t first = split_at(offset);
+  size_t last = split_at(offset + length);
+  if (removed) {
+    for (size_t i = first; i < last; i++) {
+      removed->push_back(pieces_[i]);
+    }
+  }
+  pieces_.erase(first, last - first);
+  reindex(first);
+}
+
+bool TextBuffer::undo(size_t *cursor_offset) {
+  if (undo_.empty()) {
+    return false;
+  }
+
+  Change &c = undo_.back();
+  if (c.inserted) {
+    erase_pieces(c.offset, c.length, nullptr);
+  } else {
+    insert_pieces(c.offset, c.removed.data(), c.removed.size());
+  }
+  *cursor_offset = c.offset;
+  undo_.pop_back();
+  merge_undo_ = false;
+  return true;
+}
+
+} // namespace edit
@@ -0,0 +1,140 @@
+// edit-buffer.hpp - Piece table text storage for the editor
+#ifndef OT_USER_EDIT_BUFFER_HPP
+#define OT_USER_EDIT_BUFFER_HPP
+
+#include "ot/common.h"
+#include "ot/user/string.hpp"
+#include "ot/user/vector.hpp"
+
+namespace edit {
+
+/**
+ * Text as a sequence of pieces, each a span of either the original file
+ * contents (never modified) or an append-only buffer of inserted text. Edits
+ * only split and splice pieces, so their cost depends on the number of pieces
+ * rather than the size of the file.
+ *
+ * The original text may be a view of memory the buffer doesn't own, such as a
+ * memory-mapped file, so opening a file copies nothing. Its newlines are only
+ * checkpointed (every ORIGINAL_CHECKPOINT-th one) while inserted text has
+ * every newline indexed. Pieces keep running totals of length and newlines,
+ * so finding a line is a binary search over pieces and the index, plus a
+ * short forward scan in original text.
+ *
+ * Removed pieces still point into the buffers, so each edit is recorded as a
+ * change that undo() can reverse without copying any text.
+ */
+class TextBuffer {
+public:
+  TextBuffer();
+
+  static const size_t ORIGINAL_CHECKPOINT = 256;
+
+  /** Replace the contents (and clear undo history) */
+  void load(ou::string &&text);
+  void load(const char *text, size_t length);
+  /** Like load, but use the text in place; it must outlive the buffer or the next load */
+  void load_view(const char *text, size_t length);
+  void clear();
+
+  /** True if the original text is a view of memory owned by someone else */
+  bool is_view() const { return original_is_view_; }
+  /** Copy viewed original text into the buffer, e.g. before its backing file is overwritten */
+  void own_original();
+
+  size_t size() const { return size_; }
+  size_t line_count() const { return newlines_ + 1; }
+
+  /** Offset of the first character of a line (clamped to the last line) */
+  size_t line_start(size_t line) const;
+  /** Length of a line, not counting its newline */
+  size_t line_length(size_t line) const;
+  /** Offset of (line, col) */
+  size_t offset_of(size_t line, size_t col) const { return line_start(line) + col; }
+  /** Line and column of an offset */
+  void position_of(size_t offset, size_t *line, size_t *col) const;
+
+  char char_at(size_t offset) const;
+  /** Copy [offset, offset + length) into out, replacing its contents */
+  void copy(size_t offset, size_t length, ou::string &out) const;
+  void get_line(size_t line, ou::string &out) const { copy(line_start(line), line_length(line), out); }
+
+  void insert(size_t offset, const char *text, size_t length);
+  void erase(size_t offset, size_t length);
+
+  /**
+   * Call fn(data, length) for each contiguous span of text in order, e.g. to
+   * write the buffer out without assembling it first
+   */
+  template <typename Fn> void for_each_span(Fn fn) const {
+    for (size_t i = 0; i < pieces_.size(); i++) {
+      fn(piece_data(pieces_[i]), pieces_[i].length);
+    }
+  }
+
+  /** Reverse the most recent change. Returns false if there is nothing to undo. */
+  bool undo(size_t *cursor_offset);
+  /** Stop typing from being merged into the previous change */
+  void break_undo_group() { merge_undo_ = false; }
+  size_t undo_depth() const { return undo_.size(); }
+
+  size_t piece_count() const { return pieces_.size(); }
+
+private:
+  enum Source : uint8_t { ORIGINAL, ADDED };
+
+  struct Piece {
+    Source source;
+    size_t start;    // Offset in the source buffer
+    size_t length;   // Bytes
+    size_t newlines; // Newlines within the span
+  };
+
+  struct Change {
+    bool inserted;                // Otherwise erased
+    size_t offset;
+    size_t length;                // Inserted length
+    ou::vector<Piece> removed;    // Erased pieces, in order
+  };
+
+  const char *original_;
+  size_t original_size_;
+  bool original_is_view_;
+  ou::string original_owned_;
+  ou::string added_;
+  // Offset of newline 0, N, 2N... in the original text (N = ORIGINAL_CHECKPOINT)
+  ou::vector<size_t> original_checkpoints_;
+  // Offset of every newline in the added text
+  ou::vector<size_t> added_newlines_;
+
+  ou::vector<Piece> pieces_;
+  // Characters and newlines before each piece (size() + 1 entries)
+  ou::vector<size_t> piece_offsets_;
+  ou::vector<size_t> piece_lines_;
+  size_t size_;
+  size_t newlines_;
+
+  ou::vector<Change> undo_;
+  bool merge_undo_;
+
+  const char *piece_data(const Piece &p) const { return (p.source == ORIGINAL ? original_ : added_.data()) + p.start; }
+  Piece make_piece(Source source, size_t start, size_t length) const;
+  void index_original();
+  // Number of newlines before offset in a source buffer
+  size_t newlines_before(Source source, size_t offset) const;
+  // Offset of a source buffer's n-th newline (0-based)
+  size_t nth_newline(Source source, size_t n) const;
+  size_t count_newlines(Source source, size_t start, size_t end) const {
+    return newlines_before(source, end) - newlines_before(source, start);
+  }
+
+  void reindex(size_t from);
+  size_t piece_at(size_t offset) const;
+  size_t split_at(size_t offset);
+  void insert_pieces(size_t offset, const Piece *pieces, size_t count);
+  void erase_pieces(size_t offset, size_t length, ou::vector<Piece> *removed);
+};
+
+} // namespace edit
+
+#endif
@@ -4,6 +4,8 @@
 
 #include "ot/user/edit.hpp"
 
+#include <stdio.h>
+
 using namespace edit;
 
 TEST_CASE("edit: insert mode adds text") {
@@ -291,3 +293,83 @@ TEST_CASE("edit: vim o opens line below") {
     CHECK(result[2] == "Line 3");
   }
 }
+
+TEST_CASE("edit: vim u undoes the last insert and delete") {
+  ou::vector<ou::string> initial;
+  initial.push_back("Line 1");
+  initial.push_back("Line 2");
+
+  Key script[] = {
+      key_char('i'), key_char('A'), key_char('B'), key_esc(), // Typing is undone as one change
+      key_down(), key_char('d'), key_char('d'),               // Delete Line 2
+      key_char('u'),                                          // Restore Line 2
+      key_char('u'),                                          // Remove "AB"
+  };
+  auto result = edit_test_run(script, sizeof(script) / sizeof(script[0]), &initial);
+  CHECK(result.size() == 2);
+  if (result.size() == 2) {
+    CHECK(result[0] == "Line 1");
+    CHECK(result[1] == "Line 2");
+  }
+}
+
+TEST_CASE("edit: simple mode C-z undoes typing") {
+  ou::vector<ou::string> initial;
+  initial.push_back("Hello");
+
+  Key script[] = {
+      key_ctrl('e'), key_char('!'), key_char('?'), key_ctrl('z'), key_char('.'),
+  };
+  auto result = edit_test_run(script, sizeof(script) / sizeof(script[0]), &initial, EditorStyle::SIMPLE);
+  CHECK(result.size() == 1);
+  if (result.size() == 1) {
+    CHECK(result[0] == "Hello.");
+  }
+}
+
+static void put_rows(Editor &e, int first, int count) {
+  for (int y = 0; y < count; y++) {
+    char buf[16];
+    snprintf(buf, sizeof(buf), "row %d", first + y);
+    e.screenPutLine(y, ou::string(buf));
+  }
+}
+
+TEST_CASE("edit: frame diff only marks changed and scrolled-in rows") {
+  Editor e;
+  put_rows(e, 0, 10);
+  e.diff_frame(80, 10);
+  CHECK(e.frame.full);
+
+  // Nothing changed
+  put_rows(e, 0, 10);
+  e.diff_frame(80, 10);
+  CHECK(!e.frame.full);
+  CHECK(!e.frame.status);
+  for (int y = 0; y < 10; y++) {
+    CHECK(!e.frame.row_changed(y));
+  }
+
+  // Scroll down two lines: only the two new bottom rows differ
+  e.row_offset = 2;
+  put_rows(e, 2, 10);
+  e.diff_frame(80, 10);
+  CHECK(e.frame.scroll == 2);
+  for (int y = 0; y < 8; y++) {
+    CHECK(!e.frame.row_changed(y));
+  }
+  CHECK(e.frame.row_changed(8));
+  CHECK(e.frame.row_changed(9));
+
+  // Edit one row
+  put_rows(e, 2, 10);
+  e.screenPutLine(4, ou::string("edited"));
+  e.diff_frame(80, 10);
+  CHECK(e.frame.scroll == 0);
+  CHECK(e.frame.row_changed(4));
+  CHECK(!e.frame.row_changed(5));
+
+  // A resize redraws everything
+  e.diff_frame(80, 12);
+  CHECK(e.frame.full);
+}
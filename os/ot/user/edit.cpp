@@ -54,6 +54,7 @@ static Keybinding default_bindings[] = {
 
     // NORMAL mode - editing
     {key_char('x'), EditorMode::NORMAL, Action::DELETE_CHAR_UNDER},
+    {key_char('u'), EditorMode::NORMAL, Action::UNDO},
 
     // INSERT mode specific
     {key_esc(), EditorMode::INSERT, Action::EXIT_TO_NORMAL},
@@ -86,6 +87,7 @@ static Keybinding simple_bindings[] = {
     // Editing (INSERT mode)
     {key_enter(), EditorMode::INSERT, Action::INSERT_NEWLINE},
     {key_backspace(), EditorMode::INSERT, Action::DELETE_CHAR_BACK},
+    {key_ctrl('z'), EditorMode::INSERT, Action::UNDO}, // C-z
 
     // Command mode
     {key_enter(), EditorMode::COMMND, Action::COMMAND_EXECUTE},
@@ -151,19 +153,20 @@ static bool is_empty_key(const Key &k) { return k.c == 0 && k.ext == ExtendedKey
 //
 
 void Editor::execute_motion(Action action) {
+  intptr_t line_count = buffer.line_count();
   switch (action) {
   case Action::MOVE_LEFT:
     if (cx != 0) {
       cx--;
     } else if (cy > 0) {
       cy--;
-      cx = file_lines[cy].length();
+      cx = buffer.line_length(cy);
     }
     break;
   case Action::MOVE_RIGHT:
-    if (cy < file_lines.size() && cx < file_lines[cy].length()) {
+    if (cy < line_count && cx < (intptr_t)buffer.line_length(cy)) {
       cx++;
-    } else if (cy < file_lines.size() - 1) {
+    } else if (cy < line_count - 1) {
       cy++;
       cx = 0;
     }
@@ -174,7 +177,7 @@ void Editor::execute_motion(Action action) {
     }
     break;
   case Action::MOVE_DOWN:
-    if (cy < file_lines.size() - 1) {
+    if (cy < line_count - 1) {
       cy++;
     }
     break;
@@ -182,8 +185,8 @@ void Editor::execute_motion(Action action) {
     cx = 0;
     break;
   case Action::MOVE_LINE_END:
-    if (cy < file_lines.size()) {
-      cx = file_lines[cy].length();
+    if (cy < line_count) {
+      cx = buffer.line_length(cy);
     }
     break;
   case Action::PAGE_UP: {
@@ -199,40 +202,62 @@ void Editor::execute_motion(Action action) {
     auto ws = be->getWindowSize();
     int page_size = ws.y / 2;
     cy += page_size;
-    if (cy >= file_lines.size()) {
-      cy = file_lines.size() - 1;
+    if (cy >= line_count) {
+      cy = line_count - 1;
     }
     break;
   }
   default:
     break;
   }
+  // Typing after moving the cursor is undone separately
+  buffer.break_undo_group();
 }
 
 void Editor::delete_line(intptr_t line) {
-  if (line < file_lines.size()) {
-    file_lines.erase(line);
-    if (file_lines.empty()) {
-      file_lines.push_back(ou::string());
+  intptr_t line_count = buffer.line_count();
+  if (line < line_count) {
+    size_t start = buffer.line_start(line);
+    if (line < line_count - 1) {
+      // Line and its newline
+      buffer.erase(start, buffer.line_start(line + 1) - start);
+    } else if (line > 0) {
+      // Last line: take the newline before it instead
+      buffer.erase(start - 1, buffer.line_length(line) + 1);
+    } else {
+      // Only line: leave it empty
+      buffer.erase(start, buffer.line_length(line));
     }
-    if (cy >= file_lines.size()) {
-      cy = file_lines.size() - 1;
+    if (cy >= (intptr_t)buffer.line_count()) {
+      cy = buffer.line_count() - 1;
     }
     cx = 0;
     dirty++;
   }
 }
 
+void Editor::undo() {
+  size_t offset, line, col;
+  if (!buffer.undo(&offset)) {
+    message_set("nothing to undo");
+    return;
+  }
+  buffer.position_of(offset, &line, &col);
+  cy = line;
+  cx = col;
+  dirty++;
+}
+
 void Editor::apply_operator(Operator op, intptr_t start_x, intptr_t start_y, intptr_t end_x, intptr_t end_y) {
   if (op == Operator::DELETE) {
-    if (start_y == end_y && start_y < file_lines.size()) {
+    if (start_y == end_y && start_y < (intptr_t)buffer.line_count()) {
       // Same line: delete characters between start_x and end_x
       if (start_x > end_x) {
         intptr_t tmp = start_x;
         start_x = end_x;
         end_x = tmp;
       }
-      file_lines[start_y].erase(start_x, end_x - start_x);
+      buffer.erase(buffer.offset_of(start_y, start_x), end_x - start_x);
       cx = start_x;
       dirty++;
     }
@@ -250,25 +275,22 @@ void Editor::execute_action(Action action, const Key &key) {
     break;
   case Action::ENTER_INSERT_APPEND:
     // Move cursor right one position (or to end of line if at end)
-    if (cy < file_lines.size() && cx < file_lines[cy].length()) {
+    if (cy < (intptr_t)buffer.line_count() && cx < (intptr_t)buffer.line_length(cy)) {
       cx++;
     }
     mode = EditorMode::INSERT;
     break;
   case Action::ENTER_INSERT_APPEND_EOL:
     // Move cursor to end of line
-    if (cy < file_lines.size()) {
-      cx = file_lines[cy].length();
+    if (cy < (intptr_t)buffer.line_count()) {
+      cx = buffer.line_length(cy);
     }
     mode = EditorMode::INSERT;
     break;
   case Action::ENTER_INSERT_OPEN_BELOW:
     // Insert a new line below current line and move to it
-    if (cy < file_lines.size()) {
-      file_lines.insert(cy + 1, ou::string());
-    } else {
-      file_lines.push_back(ou::string());
-    }
+    buffer.break_undo_group();
+    buffer.insert(buffer.offset_of(cy, buffer.line_length(cy)), "\n", 1);
     cy++;
     cx = 0;
     dirty++;
@@ -280,6 +302,7 @@ void Editor::execute_action(Action action, const Key &key) {
     break;
   case Action::EXIT_TO_NORMAL:
     mode = EditorMode::NORMAL;
+    buffer.break_undo_group();
     break;
   case Action::INSERT_NEWLINE:
     insert_newline();
@@ -289,11 +312,14 @@ void Editor::execute_action(Action action, const Key &key) {
     break;
   case Action::DELETE_CHAR_UNDER:
     // Delete character under cursor (vim 'x')
-    if (cy < file_lines.size() && cx < file_lines[cy].length()) {
-      file_lines[cy].erase(cx, 1);
+    if (cy < (intptr_t)buffer.line_count() && cx < (intptr_t)buffer.line_length(cy)) {
+      buffer.erase(buffer.offset_of(cy, cx), 1);
       dirty++;
     }
     break;
+  case Action::UNDO:
+    undo();
+    break;
   case Action::COMMAND_EXECUTE:
     interpret_command();
     command_line.clear();
@@ -320,11 +346,9 @@ void Editor::screenPutLine(int y, const ou::string &line, size_t cutoff) {
   while (render_lines.size() <= y) {
     render_lines.push_back(ou::string());
   }
-  if (cutoff != 0) {
-    lines[y] = line.substr(0, cutoff);
-  } else {
-    lines[y] = line;
-  }
+  // Reuse the row's storage rather than building a new string each frame
+  lines[y].clear();
+  lines[y].append(line.data(), cutoff != 0 && cutoff < line.length() ? cutoff : line.length());
 
   // Handle rendering lines
   render_lines[y].ensure_capacity(line.length());
@@ -340,6 +364,64 @@ void Editor::screenPutLine(int y, const ou::string &line, size_t cutoff) {
   }
 }
 
+void Editor::diff_frame(int width, int height) {
+  frame.full = width != prev_width || height != prev_height;
+  frame.scroll = 0;
+  frame.rows.clear();
+
+  if (!frame.full) {
+    // Compare each row against the row it would be if the previous frame were
+    // scrolled along with row_offset, so scrolling only dirties new rows
+    intptr_t delta = row_offset - prev_row_offset;
+    if (delta > -height && delta < height) {
+      frame.scroll = delta;
+    }
+    for (int y = 0; y < height; y++) {
+      intptr_t prev_y = y + frame.scroll;
+      bool same = y < (int)render_lines.size() && prev_y >= 0 && prev_y < (intptr_t)prev_render_lines.size() &&
+                  render_lines[y] == prev_render_lines[prev_y];
+      frame.rows.push_back(!same);
+    }
+  }
+  frame.status = frame.full || status_line != prev_status_line;
+  frame.message = frame.full || mode != prev_mode || message_line != prev_message_line ||
+                  command_line != prev_command_line;
+
+  while (prev_render_lines.size() < render_lines.size()) {
+    prev_render_lines.push_back(ou::string());
+  }
+  for (size_t y = 0; y < render_lines.size(); y++) {
+    if (frame.row_changed(y) || frame.scroll != 0) {
+      prev_render_lines[y] = render_lines[y];
+    }
+  }
+  if (frame.status) {
+    prev_status_line = status_line;
+  }
+  if (frame.message) {
+    prev_message_line = message_line;
+    prev_command_line = command_line;
+    prev_mode = mode;
+  }
+  prev_row_offset = row_offset;
+  prev_width = width;
+  prev_height = height;
+}
+
+void Editor::close_source() {
+  if (source_file) {
+    buffer.own_original();
+    release_source();
+  }
+}
+
+void Editor::release_source() {
+  if (source_file) {
+    ou_delete(source_file);
+    source_file = nullptr;
+  }
+}
+
 void Editor::message_set(const ou::string &message) {
   message_line = message;
   last_message_time = o_time_get();
@@ -360,37 +442,26 @@ void Editor::interpret_command() {
 }
 
 void Editor::insert_char(char c) {
-  if (cy == file_lines.size()) {
-    file_lines.push_back(ou::string());
-  }
-  file_lines[cy].insert(cx, 1, c);
+  buffer.insert(buffer.offset_of(cy, cx), &c, 1);
   cx++;
   dirty++;
 }
 
 void Editor::backspace() {
-  if (cx > 0 && cy < file_lines.size()) {
-    file_lines[cy].erase(cx - 1, 1);
+  if (cx > 0 && cy < (intptr_t)buffer.line_count()) {
+    buffer.erase(buffer.offset_of(cy, cx - 1), 1);
     cx--;
   } else if (cy > 0) {
-    // handle user going back onto previous line
+    // handle user going back onto previous line by joining it with this one
     cy--;
-    cx = file_lines[cy].length();
-    file_lines[cy].append(file_lines[cy + 1]);
-    file_lines.erase(cy + 1);
+    cx = buffer.line_length(cy);
+    buffer.erase(buffer.offset_of(cy, cx), 1);
   }
   dirty++;
 }
 
 void Editor::insert_newline() {
-  // Handle case where there is text after
-  if (cx < file_lines[cy].length()) {
-    ou::string text = file_lines[cy].substr(cx);
-    file_lines[cy].erase(cx);
-    file_lines.insert(cy + 1, text);
-  } else {
-    file_lines.insert(cy + 1, ou::string());
-  }
+  buffer.insert(buffer.offset_of(cy, cx), "\n", 1);
   cy++;
   cx = 0;
 }
@@ -447,8 +518,8 @@ void Editor::process_key_press() {
   }
 
   // Correct cx if it's beyond the end of the current line
-  if (cy < file_lines.size()) {
-    intptr_t current_line_len = file_lines[cy].length();
+  if (cy < (intptr_t)buffer.line_count()) {
+    intptr_t current_line_len = buffer.line_length(cy);
     if (cx > current_line_len) {
       cx = current_line_len;
     }
@@ -457,8 +528,9 @@ void Editor::process_key_press() {
 
 intptr_t Editor::cx_to_rx(intptr_t cx_arg) {
   intptr_t result = 0;
+  size_t start = buffer.line_start(cy);
   for (intptr_t j = 0; j < cx_arg; j++) {
-    if (file_lines[cy][j] == '\t') {
+    if (buffer.char_at(start + j) == '\t') {
       result += (TAB_SIZE - 1) - (result % TAB_SIZE);
     }
     result++;
@@ -575,6 +647,9 @@ static tcl::Status tcl_command_write(tcl::Interp &interp, tcl::vector<tcl::strin
     return tcl::S_ERR;
   }
 
+  // Opening for writing truncates the file the buffer may be mapped from
+  e.close_source();
+
   ou::File file(e.file_name.c_str(), ou::FileMode::WRITE);
   ErrorCode err = file.open();
   if (err != ErrorCode::NONE) {
@@ -582,24 +657,19 @@ static tcl::Status tcl_command_write(tcl::Interp &interp, tcl::vector<tcl::strin
     return tcl::S_ERR;
   }
 
-  oprintf("WRITE: %zu lines to write\n", e.file_lines.size());
-  for (size_t i = 0; i < e.file_lines.size(); i++) {
-    oprintf("WRITE: line %zu: len=%zu content=\"%s\"\n", i, e.file_lines[i].length(), e.file_lines[i].c_str());
-    err = file.write(e.file_lines[i]);
-    oprintf("WRITE: write result=%d\n", (int)err);
-    if (err != ErrorCode::NONE) {
-      interp.result = "failed to write line";
-      return tcl::S_ERR;
-    }
-    if (i < e.file_lines.size() - 1) {
-      oprintf("WRITE: writing newline\n");
-      err = file.write("\n");
-      oprintf("WRITE: newline result=%d\n", (int)err);
-      if (err != ErrorCode::NONE) {
-        interp.result = "failed to write newline";
-        return tcl::S_ERR;
-      }
+  // Write the buffer a piece at a time rather than assembling it first
+  ou::string chunk;
+  err = ErrorCode::NONE;
+  e.buffer.for_each_span([&](const char *data, size_t length) {
+    if (err == ErrorCode::NONE) {
+      chunk.clear();
+      chunk.append(data, length);
+      err = file.write(chunk);
     }
+  });
+  if (err != ErrorCode::NONE) {
+    interp.result = "failed to write file";
+    return tcl::S_ERR;
   }
   oprintf("WRITE: done\n");
 
@@ -660,44 +730,47 @@ void edit_run(Backend *be_, Editor *editor, tcl::Interp *interp, ou::string *fil
   ou::string tilde("~");
 
   if (file_path) {
-    ou::File file(file_path->c_str());
+    editor->close_source();
+    ou::File *file = ou_new<ou::File>(file_path->c_str());
     editor->file_name = file_path->c_str();
-    ErrorCode err = file.open();
+    ErrorCode err = file->open();
 
     if (err == FILESYSTEM__FILE_NOT_FOUND) {
       // New file - start with empty buffer
-      editor->file_lines.push_back(ou::string());
+      editor->buffer.clear();
       editor->message_set("[New File]");
     } else if (err != ErrorCode::NONE) {
       // Other error - exit
       oprintf("failed to open file %s: %d\n", file_path->c_str(), err);
+      ou_delete(file);
       return;
     } else {
-      // File exists - read contents
-      ou::string content;
-      err = file.read_all(content);
+      // File exists - map it and view the contents in place. Lines are only
+      // copied out as they are drawn, and edits are layered on as pieces.
+      const char *data;
+      size_t size;
+      err = file->map(&data, &size);
       if (err != ErrorCode::NONE) {
         oprintf("failed to read file %s: %d\n", file_path->c_str(), err);
+        ou_delete(file);
         return;
       }
 
-      // Split content by newlines
-      ou::string current_line;
-      for (size_t i = 0; i < content.length(); i++) {
-        if (content[i] == '\n') {
-          editor->file_lines.push_back(current_line);
-          current_line.clear();
-        } else {
-          current_line.push_back(content[i]);
-        }
-      }
-      // Add last line if file doesn't end with newline
-      if (!current_line.empty() || content.empty()) {
-        editor->file_lines.push_back(current_line);
+      // A trailing newline ends the last line rather than starting an empty one
+      if (size > 0 && data[size - 1] == '\n') {
+        size--;
       }
+      editor->buffer.load_view(data, size);
+      editor->source_file = file;
+      file = nullptr;
+    }
+    if (file) {
+      ou_delete(file);
     }
   }
 
+  ou::string row;
+
   while (editor->running) {
     // Check if we should process this frame (for cooperative scheduling)
     if (!be_->begin_frame()) {
@@ -719,20 +792,23 @@ void edit_run(Backend *be_, Editor *editor, tcl::Interp *interp, ou::string *fil
 
     for (int y = 0; y < ws.y; y++) {
       intptr_t file_row = y + editor->row_offset;
-      if (file_row < editor->file_lines.size()) {
-        intptr_t len = editor->file_lines[file_row].length() - editor->col_offset;
+      if (file_row < (intptr_t)editor->buffer.line_count()) {
+        intptr_t len = (intptr_t)editor->buffer.line_length(file_row) - editor->col_offset;
         if (len < 0) {
           len = 0;
         }
         if (len > ws.x) {
           len = ws.x;
         }
-        editor->screenPutLine(y, editor->file_lines[file_row].substr(editor->col_offset, len), len);
+        // Copy only the visible part of the row out of the buffer
+        editor->buffer.copy(editor->buffer.line_start(file_row) + editor->col_offset, len, row);
+        editor->screenPutLine(y, row, len);
       } else {
         editor->screenPutLine(y, tilde);
       }
     }
 
+    editor->diff_frame(ws.x, ws.y);
     be_->render(*editor);
     // Handle user input
     editor->process_key_press();
@@ -5,10 +5,15 @@
 #include "ot/common.h"
 #include "ot/lib/result.hpp"
 #include "ot/lib/string-view.hpp"
+#include "ot/user/edit-buffer.hpp"
 #include "ot/user/string.hpp"
 #include "ot/user/vector.hpp"
 
 // Forward declarations
+namespace ou {
+struct File;
+}
+
 namespace tcl {
 struct Interp;
 }
@@ -39,10 +44,31 @@ enum class Operator {
   // Future: YANK, CHANGE, etc.
 };
 
+/**
+ * How the current frame differs from the one rendered before it, so backends
+ * only redraw what changed. Filled in by Editor::diff_frame before render().
+ */
+struct FrameDiff {
+  FrameDiff() : full(true), scroll(0), status(true), message(true) {}
+
+  /** Nothing from the previous frame can be reused (first frame, resize) */
+  bool full;
+  /** Rows the text area moved up since the previous frame (negative: down) */
+  intptr_t scroll;
+  /** Per text row: whether it differs from the previous frame once that is scrolled by `scroll` */
+  ou::vector<bool> rows;
+  bool status;
+  bool message; // Message or command line
+
+  bool row_changed(int y) const { return full || y >= (int)rows.size() || rows[y]; }
+};
+
 struct Editor {
   Editor()
-      : row_offset(0), col_offset(0), cx(0), cy(0), rx(0), dirty(0), last_message_time(0), mode(EditorMode::INSERT),
-        pending_operator(Operator::NONE), style(EditorStyle::SIMPLE), be(nullptr), interp(nullptr), running(true) {}
+      : row_offset(0), col_offset(0), cx(0), cy(0), rx(0), dirty(0), source_file(nullptr), last_message_time(0),
+        mode(EditorMode::INSERT), pending_operator(Operator::NONE), style(EditorStyle::SIMPLE), be(nullptr),
+        interp(nullptr), running(true), prev_mode(EditorMode::INSERT), prev_row_offset(0), prev_width(-1), prev_height(-1) {}
+  ~Editor() { release_source(); }
 
   intptr_t row_offset, col_offset;
 
@@ -54,9 +80,16 @@ struct Editor {
 
   /** Lines to render; note that this is only roughly the height of the screen */
   ou::vector<ou::string> lines;
-  ou::vector<ou::string> file_lines;
   ou::vector<ou::string> render_lines;
 
+  /** What changed since the previous frame */
+  FrameDiff frame;
+
+  /** File contents */
+  TextBuffer buffer;
+  /** File the buffer's original text is mapped from, kept open while the buffer views it */
+  ou::File *source_file;
+
   ou::string file_name;
   /** status line -- shows info like current col, active file */
   ou::string status_line;
@@ -75,6 +108,20 @@ struct Editor {
   tcl::Interp *interp;
   bool running;
 
+  // Previously rendered frame, compared against by diff_frame
+  ou::vector<ou::string> prev_render_lines;
+  ou::string prev_status_line;
+  ou::string prev_message_line;
+  ou::string prev_command_line;
+  EditorMode prev_mode;
+  intptr_t prev_row_offset;
+  int prev_width, prev_height;
+
+  /** Release source_file, copying the text out of it first if the buffer still views it */
+  void close_source();
+  /** Release source_file without copying; the buffer must not be read until it is reloaded */
+  void release_source();
+
   // Screen management
   void screenResetLines() {
     for (size_t i = 0; i < lines.size(); i++) {
@@ -85,6 +132,11 @@ struct Editor {
   /** Overwrite a given row; grows if needed.  */
   void screenPutLine(int y, const ou::string &line, size_t cutoff = 0);
 
+  /** Fill in frame by comparing this frame's output with the previous one, then remember it */
+  void diff_frame(int width, int height);
+  /** Make the next frame redraw everything, e.g. after the screen was disturbed */
+  void invalidate_frame() { prev_width = prev_height = -1; }
+
   /** Append to a given row; grows if needed */
   void screenAppendLine(int y, const ou::string &line) {
     if (y >= lines.size()) {
@@ -108,6 +160,7 @@ struct Editor {
   void message_clear();
   void generate_status_line();
   void delete_line(intptr_t line);
+  void undo();
   void apply_operator(Operator op, intptr_t start_x, intptr_t start_y, intptr_t end_x, intptr_t end_y);
   intptr_t cx_to_rx(intptr_t cx);
 };
@@ -212,6 +265,7 @@ enum class Action {
   INSERT_NEWLINE,
   DELETE_CHAR_BACK,
   DELETE_CHAR_UNDER,  // vim: x - delete char under cursor
+  UNDO,               // vim: u, simple: C-z
 
   // Command mode
   COMMAND_EXECUTE,
@@ -3,7 +3,7 @@
  */
 
 #include "ot/lib/logger.hpp"
-#include "ot/lib/mpack/mpack-writer.hpp"
+#include "ot/lib/mpack/mpack-direct.hpp"
 #include "ot/user/fs/disk.hpp"
 #include "ot/user/fs/types.hpp"
 #include "ot/user/fs/virtio-disk.hpp"
@@ -186,7 +186,7 @@ private:
     }
 
     // Write as msgpack binary
-    MPackWriter writer(comm.as_ptr(), OT_PAGE_SIZE);
+    MPackDirectWriter writer(comm.as_ptr(), OT_PAGE_SIZE);
     writer.bin(buffer + 8, bytes_read);
 
     return Result<uintptr_t, ErrorCode>::ok(bytes_read);
@@ -217,6 +217,57 @@ private:
     return Result<uintptr_t, ErrorCode>::ok(bytes_written);
   }
 
+  Result<bool, ErrorCode> handle_read_stream(FileHandleId handle_id, StreamWriter &data) override {
+    OpenFile *of = find_open_file(handle_id.raw());
+    if (!of) {
+      return Result<bool, ErrorCode>::err(FILESYSTEM__INVALID_HANDLE);
+    }
+
+    FRESULT fr = f_lseek(&of->fil, data.cursor());
+    if (fr != FR_OK) {
+      return Result<bool, ErrorCode>::err(fresult_to_error(fr));
+    }
+
+    // Raw bytes straight into the comm page, no msgpack header to leave room for
+    UINT bytes_read = 0;
+    fr = f_read(&of->fil, data.buffer(), data.space(), &bytes_read);
+    if (fr != FR_OK) {
+      return Result<bool, ErrorCode>::err(fresult_to_error(fr));
+    }
+    data.commit(bytes_read);
+    if (f_eof(&of->fil)) {
+      data.end();
+    }
+    return Result<bool, ErrorCode>::ok(true);
+  }
+
+  Result<bool, ErrorCode> handle_write_stream(FileHandleId handle_id, const StreamChunk &data) override {
+    OpenFile *of = find_open_file(handle_id.raw());
+    if (!of) {
+      return Result<bool, ErrorCode>::err(FILESYSTEM__INVALID_HANDLE);
+    }
+
+    FRESULT fr = f_lseek(&of->fil, data.offset);
+    if (fr != FR_OK) {
+      return Result<bool, ErrorCode>::err(fresult_to_error(fr));
+    }
+
+    UINT bytes_written = 0;
+    fr = f_write(&of->fil, data.data.ptr, data.data.len, &bytes_written);
+    if (fr != FR_OK) {
+      return Result<bool, ErrorCode>::err(fresult_to_error(fr));
+    }
+    if (bytes_written < data.data.len) {
+      return Result<bool, ErrorCode>::err(FILESYSTEM__IO_ERROR);
+    }
+
+    // Sync once per stream rather than once per chunk
+    if (data.last) {
+      f_sync(&of->fil);
+    }
+    return Result<bool, ErrorCode>::ok(true);
+  }
+
   Result<bool, ErrorCode> handle_close(FileHandleId handle_id) override {
     OpenFile *of = find_open_file(handle_id.raw());
     if (!of) {
@@ -340,7 +391,7 @@ private:
     }
 
     PageAddr comm = ou_get_comm_page();
-    MPackWriter writer(comm.as_ptr(), OT_PAGE_SIZE);
+    MPackDirectWriter writer(comm.as_ptr(), OT_PAGE_SIZE);
     writer.array((uint32_t)count);
 
     while (f_readdir(&dir, &fno) == FR_OK && fno.fname[0] != 0) {
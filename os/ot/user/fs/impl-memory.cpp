@@ -1,4 +1,4 @@
-#include "ot/lib/mpack/mpack-writer.hpp"
+#include "ot/lib/mpack/mpack-direct.hpp"
 #include "ot/user/fs/types.hpp"
 #include "ot/user/gen/filesystem-server.hpp"
 #include "ot/user/user.hpp"
@@ -138,7 +138,7 @@ public:
     size_t bytes_to_read = (length < available) ? length : available;
 
     PageAddr comm = ou_get_comm_page();
-    MPackWriter writer(comm.as_ptr(), OT_PAGE_SIZE);
+    MPackDirectWriter writer(comm.as_ptr(), OT_PAGE_SIZE);
     writer.bin(inode->data.data() + offset, bytes_to_read);
 
     return Result<uintptr_t, ErrorCode>::ok(bytes_to_read);
@@ -170,6 +170,35 @@ public:
     return Result<uintptr_t, ErrorCode>::ok(length);
   }
 
+  Result<bool, ErrorCode> handle_read_stream(FileHandleId handle_id, StreamWriter &data) override {
+    FileHandle *handle = storage->find_handle(handle_id.raw());
+    if (!handle) {
+      return Result<bool, ErrorCode>::err(FILESYSTEM__INVALID_HANDLE);
+    }
+
+    INode *inode = storage->find_inode(handle->inode_num);
+    if (!inode || inode->type != NodeType::FILE) {
+      return Result<bool, ErrorCode>::err(FILESYSTEM__IO_ERROR);
+    }
+
+    size_t file_size = inode->data.size();
+    if (data.cursor() < file_size) {
+      data.write(inode->data.data() + data.cursor(), file_size - data.cursor());
+    }
+    if (data.cursor() >= file_size) {
+      data.end();
+    }
+    return Result<bool, ErrorCode>::ok(true);
+  }
+
+  Result<bool, ErrorCode> handle_write_stream(FileHandleId handle_id, const StreamChunk &data) override {
+    auto result = handle_write(handle_id, data.offset, data.data);
+    if (result.is_err()) {
+      return Result<bool, ErrorCode>::err(result.error());
+    }
+    return Result<bool, ErrorCode>::ok(true);
+  }
+
   Result<bool, ErrorCode> handle_close(FileHandleId handle_id) override {
     FileHandle *handle = storage->find_handle(handle_id.raw());
     if (!handle) {
@@ -361,7 +390,7 @@ public:
 
     // Write entries to comm page as msgpack array of strings
     PageAddr comm = ou_get_comm_page();
-    MPackWriter writer(comm.as_ptr(), OT_PAGE_SIZE);
+    MPackDirectWriter writer(comm.as_ptr(), OT_PAGE_SIZE);
     writer.array((uint32_t)dir->children.size());
 
     for (size_t i = 0; i < dir->children.size(); i++) {
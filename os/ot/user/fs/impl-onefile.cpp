@@ -1,5 +1,5 @@
 #include "ot/lib/logger.hpp"
-#include "ot/lib/mpack/mpack-writer.hpp"
+#include "ot/lib/mpack/mpack-direct.hpp"
 #include "ot/user/fs/disk.hpp"
 #include "ot/user/fs/virtio-disk.hpp"
 #include "ot/user/fs/types.hpp"
@@ -64,7 +64,7 @@ private:
             (unsigned)filename_len, (unsigned)data_start, (unsigned)content_len, (unsigned)bytes_to_read);
 
     PageAddr comm = ou_get_comm_page();
-    MPackWriter writer(comm.as_ptr(), OT_PAGE_SIZE);
+    MPackDirectWriter writer(comm.as_ptr(), OT_PAGE_SIZE);
     writer.bin(sector_buf + data_start, bytes_to_read);
 
     return Result<uintptr_t, ErrorCode>::ok(bytes_to_read);
@@ -114,6 +114,47 @@ private:
     return Result<uintptr_t, ErrorCode>::ok(data.len);
   }
 
+  // The whole file fits in sector 0, so a stream is always a single chunk
+  Result<bool, ErrorCode> handle_read_stream(FileHandleId handle_id, StreamWriter &data) override {
+    if (data.cursor() != 0) {
+      oprintf("[onefile] ERROR: non-zero offset not supported\n");
+      return Result<bool, ErrorCode>::err(FILESYSTEM__IO_ERROR);
+    }
+
+    uint8_t sector_buf[DISK_SECTOR_SIZE];
+    ErrorCode disk_err = disk->read_sector(0, sector_buf);
+    if (disk_err != NONE) {
+      oprintf("[onefile] ERROR: sector read failed: %s\n", error_code_to_string(disk_err));
+      return Result<bool, ErrorCode>::err(disk_err);
+    }
+
+    size_t filename_len = strlen(stored_filename);
+    size_t data_start = 0;
+    if (filename_len > 0 && filename_len < DISK_SECTOR_SIZE - 1) {
+      data_start = filename_len + 1; // Skip "filename "
+    }
+    size_t content_len = 0;
+    while (data_start + content_len < DISK_SECTOR_SIZE && sector_buf[data_start + content_len] != '\0') {
+      content_len++;
+    }
+
+    data.write(sector_buf + data_start, content_len);
+    data.end();
+    return Result<bool, ErrorCode>::ok(true);
+  }
+
+  Result<bool, ErrorCode> handle_write_stream(FileHandleId handle_id, const StreamChunk &data) override {
+    if (data.offset != 0 || !data.last) {
+      oprintf("[onefile] ERROR: multi-chunk stream not supported\n");
+      return Result<bool, ErrorCode>::err(FILESYSTEM__IO_ERROR);
+    }
+    auto result = handle_write(handle_id, 0, data.data);
+    if (result.is_err()) {
+      return Result<bool, ErrorCode>::err(result.error());
+    }
+    return Result<bool, ErrorCode>::ok(true);
+  }
+
   Result<bool, ErrorCode> handle_close(FileHandleId handle_id) override {
     file_is_open = false;
     return Result<bool, ErrorCode>::ok(true);
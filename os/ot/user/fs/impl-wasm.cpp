@@ -7,7 +7,7 @@
  */
 
 #include "ot/lib/logger.hpp"
-#include "ot/lib/mpack/mpack-writer.hpp"
+#include "ot/lib/mpack/mpack-direct.hpp"
 #include "ot/user/fs/types.hpp"
 #include "ot/user/gen/filesystem-server.hpp"
 #include "ot/user/user.hpp"
@@ -32,19 +32,21 @@ EM_JS(int, js_fs_exists, (const char *path), {
   return 0;
 });
 
-// Read a file's contents. Returns bytes read, or -1 on error.
-// Data is written to the provided buffer.
-EM_JS(int, js_fs_read_file, (const char *path, uint8_t *buf, int max_len), {
+// Read up to max_len bytes of a file starting at offset. Returns bytes read, or -1 on error.
+// Data is copied into the provided buffer in one go; JS has no seek, so a read
+// at an offset is a slice of the stored contents.
+EM_JS(int, js_fs_read_file, (const char *path, int offset, uint8_t *buf, int max_len), {
   const pathStr = UTF8ToString(path);
   if (typeof Module.fsReadFile === 'function') {
     const data = Module.fsReadFile(pathStr);
     if (data === null || data === undefined) {
       return -1;
     }
-    const len = Math.min(data.length, max_len);
-    for (let i = 0; i < len; i++) {
-      HEAPU8[buf + i] = data[i];
+    if (offset >= data.length) {
+      return 0;
     }
+    const len = Math.min(data.length - offset, max_len);
+    HEAPU8.set(data.subarray(offset, offset + len), buf);
     return len;
   }
   return -1;
@@ -67,20 +69,33 @@ EM_JS(int, js_fs_file_size, (const char *path), {
   return -1;
 });
 
-// Write data to a file. Returns bytes written, or -1 on error.
+// Replace a file's contents. Returns bytes written, or -1 on error.
 EM_JS(int, js_fs_write_file, (const char *path, const uint8_t *data, int len), {
   const pathStr = UTF8ToString(path);
   if (typeof Module.fsWriteFile === 'function') {
-    const arr = new Uint8Array(len);
-    for (let i = 0; i < len; i++) {
-      arr[i] = HEAPU8[data + i];
-    }
-    const success = Module.fsWriteFile(pathStr, arr);
+    // slice() copies: the storage keeps the array, and WASM memory may be reused
+    const success = Module.fsWriteFile(pathStr, HEAPU8.slice(data, data + len));
     return success ? len : -1;
   }
   return -1;
 });
 
+// Write data into a file at offset, growing it if needed. Returns bytes written, or -1 on error.
+EM_JS(int, js_fs_write_at, (const char *path, int offset, const uint8_t *data, int len), {
+  const pathStr = UTF8ToString(path);
+  if (typeof Module.fsReadFile !== 'function' || typeof Module.fsWriteFile !== 'function') {
+    return -1;
+  }
+  const existing = Module.fsReadFile(pathStr) || new Uint8Array(0);
+  let contents = existing;
+  if (offset + len > existing.length) {
+    contents = new Uint8Array(offset + len);
+    contents.set(existing);
+  }
+  contents.set(HEAPU8.subarray(data, data + len), offset);
+  return Module.fsWriteFile(pathStr, contents) ? len : -1;
+});
+
 // Create an empty file. Returns 1 on success, 0 on failure.
 EM_JS(int, js_fs_create_file, (const char *path), {
   const pathStr = UTF8ToString(path);
@@ -157,6 +172,8 @@ struct WasmFilesystemServer : LocalStorage, FilesystemServerBase {
     uintptr_t flags;
     bool in_use;
     size_t position; // Current read/write position
+    // Contents of the upload in progress, written to JS once at the end
+    ou::vector<uint8_t> stream;
   };
   OpenFile open_files[MAX_OPEN_HANDLES];
   uint32_t next_handle_id;
@@ -245,7 +262,7 @@ private:
     if (offset >= (uintptr_t)file_size) {
       // Reading past end of file - return 0 bytes with empty msgpack
       PageAddr comm = ou_get_comm_page();
-      MPackWriter writer(comm.as_ptr(), OT_PAGE_SIZE);
+      MPackDirectWriter writer(comm.as_ptr(), OT_PAGE_SIZE);
       writer.bin(nullptr, 0);
       return Result<uintptr_t, ErrorCode>::ok(0);
     }
@@ -261,28 +278,16 @@ private:
       length = available;
     }
 
-    // Read file content into comm page
+    // Read the requested range straight into the comm page
     PageAddr comm = ou_get_comm_page();
     uint8_t *buffer = (uint8_t *)comm.as_ptr() + 8; // Leave room for msgpack header
-
-    // Read entire file first, then extract the portion we need
-    // (JS doesn't have a seek+read, so we read all and slice)
-    ou::vector<uint8_t> full_content;
-    full_content.resize(file_size);
-
-    int bytes_read = js_fs_read_file(of->path.c_str(), full_content.data(), file_size);
-    if (bytes_read < 0) {
+    int actual_read = js_fs_read_file(of->path.c_str(), (int)offset, buffer, (int)length);
+    if (actual_read < 0) {
       return Result<uintptr_t, ErrorCode>::err(FILESYSTEM__IO_ERROR);
     }
 
-    // Copy the requested portion
-    size_t actual_read = (length < (size_t)(bytes_read - offset)) ? length : (bytes_read - offset);
-    for (size_t i = 0; i < actual_read; i++) {
-      buffer[i] = full_content[offset + i];
-    }
-
     // Write as msgpack binary
-    MPackWriter writer(comm.as_ptr(), OT_PAGE_SIZE);
+    MPackDirectWriter writer(comm.as_ptr(), OT_PAGE_SIZE);
     writer.bin(buffer, actual_read);
 
     return Result<uintptr_t, ErrorCode>::ok(actual_read);
@@ -294,33 +299,63 @@ private:
       return Result<uintptr_t, ErrorCode>::err(FILESYSTEM__INVALID_HANDLE);
     }
 
-    // Read existing file content (if any)
-    int file_size = js_fs_file_size(of->path.c_str());
-    ou::vector<uint8_t> content;
+    int result = js_fs_write_at(of->path.c_str(), (int)offset, (const uint8_t *)data.ptr, (int)data.len);
+    if (result < 0) {
+      return Result<uintptr_t, ErrorCode>::err(FILESYSTEM__IO_ERROR);
+    }
+
+    return Result<uintptr_t, ErrorCode>::ok(data.len);
+  }
 
-    if (file_size > 0) {
-      content.resize(file_size);
-      js_fs_read_file(of->path.c_str(), content.data(), file_size);
+  Result<bool, ErrorCode> handle_read_stream(FileHandleId handle_id, StreamWriter &data) override {
+    OpenFile *of = find_open_file(handle_id.raw());
+    if (!of) {
+      return Result<bool, ErrorCode>::err(FILESYSTEM__INVALID_HANDLE);
     }
 
-    // Expand if needed
-    size_t required_size = offset + data.len;
-    if (content.size() < required_size) {
-      content.resize(required_size, 0);
+    int file_size = js_fs_file_size(of->path.c_str());
+    if (file_size < 0) {
+      return Result<bool, ErrorCode>::err(FILESYSTEM__IO_ERROR);
     }
 
-    // Write the new data at offset
-    for (size_t i = 0; i < data.len; i++) {
-      content[offset + i] = (uint8_t)data.ptr[i];
+    // Each chunk is sliced out of the JS-side contents directly into the comm page
+    if (data.cursor() < (uintptr_t)file_size) {
+      int bytes_read =
+          js_fs_read_file(of->path.c_str(), (int)data.cursor(), (uint8_t *)data.buffer(), (int)data.space());
+      if (bytes_read < 0) {
+        return Result<bool, ErrorCode>::err(FILESYSTEM__IO_ERROR);
+      }
+      data.commit(bytes_read);
+    }
+    if (data.cursor() >= (uintptr_t)file_size) {
+      data.end();
     }
+    return Result<bool, ErrorCode>::ok(true);
+  }
 
-    // Write back to JS
-    int result = js_fs_write_file(of->path.c_str(), content.data(), content.size());
-    if (result < 0) {
-      return Result<uintptr_t, ErrorCode>::err(FILESYSTEM__IO_ERROR);
+  Result<bool, ErrorCode> handle_write_stream(FileHandleId handle_id, const StreamChunk &data) override {
+    OpenFile *of = find_open_file(handle_id.raw());
+    if (!of) {
+      return Result<bool, ErrorCode>::err(FILESYSTEM__INVALID_HANDLE);
     }
 
-    return Result<uintptr_t, ErrorCode>::ok(data.len);
+    if (data.offset == 0) {
+      of->stream.clear();
+    }
+    if (of->stream.size() < data.offset + data.data.len) {
+      of->stream.resize(data.offset + data.data.len, 0);
+    }
+    memcpy(of->stream.data() + data.offset, data.data.ptr, data.data.len);
+
+    if (!data.last) {
+      return Result<bool, ErrorCode>::ok(true);
+    }
+    auto result = handle_write(handle_id, 0, StringView((const char *)of->stream.data(), of->stream.size()));
+    of->stream.clear();
+    if (result.is_err()) {
+      return Result<bool, ErrorCode>::err(result.error());
+    }
+    return Result<bool, ErrorCode>::ok(true);
   }
 
   Result<bool, ErrorCode> handle_close(FileHandleId handle_id) override {
@@ -331,6 +366,7 @@ private:
 
     of->in_use = false;
     of->path.clear();
+    of->stream.clear();
 
     return Result<bool, ErrorCode>::ok(true);
   }
@@ -409,7 +445,7 @@ private:
 
     // Parse entries from scratch buffer and write to comm page as msgpack
     PageAddr comm = ou_get_comm_page();
-    MPackWriter writer(comm.as_ptr(), OT_PAGE_SIZE);
+    MPackDirectWriter writer(comm.as_ptr(), OT_PAGE_SIZE);
     writer.array((uint32_t)count);
 
     // Parse null-separated strings from scratch buffer
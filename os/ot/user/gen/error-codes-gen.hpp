@@ -3,15 +3,17 @@
 
   FIBONACCI__INVALID_INPUT = 100,
   GRAPHICS__NOT_INITIALIZED = 101,
-  GRAPHICS__TOO_MANY_APPS = 102,
-  GRAPHICS__NOT_REGISTERED = 103,
-  FILESYSTEM__FILE_NOT_FOUND = 104,
-  FILESYSTEM__PATH_TOO_LONG = 105,
-  FILESYSTEM__TOO_MANY_OPEN_FILES = 106,
-  FILESYSTEM__INVALID_HANDLE = 107,
-  FILESYSTEM__IO_ERROR = 108,
-  FILESYSTEM__ALREADY_EXISTS = 109,
-  FILESYSTEM__PARENT_NOT_FOUND = 110,
-  FILESYSTEM__DIR_NOT_FOUND = 111,
-  FILESYSTEM__NOT_EMPTY = 112,
-  KEYBOARD__NOT_INITIALIZED = 113,
+  GRAPHICS__INVALID_RECTS = 102,
+  GRAPHICS__TOO_MANY_APPS = 103,
+  GRAPHICS__NOT_REGISTERED = 104,
+  GRAPHICS__INVALID_SURFACE = 105,
+  FILESYSTEM__FILE_NOT_FOUND = 106,
+  FILESYSTEM__PATH_TOO_LONG = 107,
+  FILESYSTEM__TOO_MANY_OPEN_FILES = 108,
+  FILESYSTEM__INVALID_HANDLE = 109,
+  FILESYSTEM__IO_ERROR = 110,
+  FILESYSTEM__ALREADY_EXISTS = 111,
+  FILESYSTEM__PARENT_NOT_FOUND = 112,
+  FILESYSTEM__DIR_NOT_FOUND = 113,
+  FILESYSTEM__NOT_EMPTY = 114,
+  KEYBOARD__NOT_INITIALIZED = 115,
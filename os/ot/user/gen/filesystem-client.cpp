@@ -1,12 +1,57 @@
 #include "ot/user/gen/filesystem-client.hpp"
 #include "ot/user/gen/method-ids.hpp"
 #include "ot/user/user.hpp"
-#include "ot/lib/mpack/mpack-reader.hpp"
+#include "ot/lib/mpack/mpack-direct.hpp"
+
+// Comm page encoders, the counterparts of the server's decoders
+
+static bool encode_open_args(void* comm, const ou::string& path) {
+  MPackDirectWriter writer(comm, OT_PAGE_SIZE);
+  writer.str(path.c_str(), path.length());
+  return writer.ok();
+}
+
+static bool encode_write_args(void* comm, const ou::vector<uint8_t>& data) {
+  MPackDirectWriter writer(comm, OT_PAGE_SIZE);
+  writer.bin(data.data(), data.size());
+  return writer.ok();
+}
+
+static bool encode_create_file_args(void* comm, const ou::string& path) {
+  MPackDirectWriter writer(comm, OT_PAGE_SIZE);
+  writer.str(path.c_str(), path.length());
+  return writer.ok();
+}
+
+static bool encode_create_dir_args(void* comm, const ou::string& path) {
+  MPackDirectWriter writer(comm, OT_PAGE_SIZE);
+  writer.str(path.c_str(), path.length());
+  return writer.ok();
+}
+
+static bool encode_delete_file_args(void* comm, const ou::string& path) {
+  MPackDirectWriter writer(comm, OT_PAGE_SIZE);
+  writer.str(path.c_str(), path.length());
+  return writer.ok();
+}
+
+static bool encode_delete_dir_args(void* comm, const ou::string& path) {
+  MPackDirectWriter writer(comm, OT_PAGE_SIZE);
+  writer.str(path.c_str(), path.length());
+  return writer.ok();
+}
+
+static bool encode_list_dir_args(void* comm, const ou::string& path) {
+  MPackDirectWriter writer(comm, OT_PAGE_SIZE);
+  writer.str(path.c_str(), path.length());
+  return writer.ok();
+}
 
 Result<FileHandleId, ErrorCode> FilesystemClient::open(const ou::string& path, uintptr_t flags) {
   // Serialize complex arguments to comm page
-  CommWriter writer;
-  writer.writer().str(path.c_str());
+  if (!encode_open_args(ou_get_comm_page().as_ptr(), path)) {
+    return Result<FileHandleId, ErrorCode>::err(IPC__INVALID_ARGS);
+  }
 
   IpcResponse resp = ou_ipc_send(
     pid_,
@@ -41,8 +86,9 @@ Result<uintptr_t, ErrorCode> FilesystemClient::read(FileHandleId handle, uintptr
 
 Result<uintptr_t, ErrorCode> FilesystemClient::write(FileHandleId handle, uintptr_t offset, const ou::vector<uint8_t>& data) {
   // Serialize complex arguments to comm page
-  CommWriter writer;
-  writer.writer().bin(data.data(), data.size());
+  if (!encode_write_args(ou_get_comm_page().as_ptr(), data)) {
+    return Result<uintptr_t, ErrorCode>::err(IPC__INVALID_ARGS);
+  }
 
   IpcResponse resp = ou_ipc_send(
     pid_,
@@ -74,8 +120,9 @@ Result<bool, ErrorCode> FilesystemClient::close(FileHandleId handle) {
 
 Result<bool, ErrorCode> FilesystemClient::create_file(const ou::string& path) {
   // Serialize complex arguments to comm page
-  CommWriter writer;
-  writer.writer().str(path.c_str());
+  if (!encode_create_file_args(ou_get_comm_page().as_ptr(), path)) {
+    return Result<bool, ErrorCode>::err(IPC__INVALID_ARGS);
+  }
 
   IpcResponse resp = ou_ipc_send(
     pid_,
@@ -92,8 +139,9 @@ Result<bool, ErrorCode> FilesystemClient::create_file(const ou::string& path) {
 
 Result<bool, ErrorCode> FilesystemClient::create_dir(const ou::string& path) {
   // Serialize complex arguments to comm page
-  CommWriter writer;
-  writer.writer().str(path.c_str());
+  if (!encode_create_dir_args(ou_get_comm_page().as_ptr(), path)) {
+    return Result<bool, ErrorCode>::err(IPC__INVALID_ARGS);
+  }
 
   IpcResponse resp = ou_ipc_send(
     pid_,
@@ -110,8 +158,9 @@ Result<bool, ErrorCode> FilesystemClient::create_dir(const ou::string& path) {
 
 Result<bool, ErrorCode> FilesystemClient::delete_file(const ou::string& path) {
   // Serialize complex arguments to comm page
-  CommWriter writer;
-  writer.writer().str(path.c_str());
+  if (!encode_delete_file_args(ou_get_comm_page().as_ptr(), path)) {
+    return Result<bool, ErrorCode>::err(IPC__INVALID_ARGS);
+  }
 
   IpcResponse resp = ou_ipc_send(
     pid_,
@@ -128,8 +177,9 @@ Result<bool, ErrorCode> FilesystemClient::delete_file(const ou::string& path) {
 
 Result<bool, ErrorCode> FilesystemClient::delete_dir(const ou::string& path) {
   // Serialize complex arguments to comm page
-  CommWriter writer;
-  writer.writer().str(path.c_str());
+  if (!encode_delete_dir_args(ou_get_comm_page().as_ptr(), path)) {
+    return Result<bool, ErrorCode>::err(IPC__INVALID_ARGS);
+  }
 
   IpcResponse resp = ou_ipc_send(
     pid_,
@@ -146,8 +196,9 @@ Result<bool, ErrorCode> FilesystemClient::delete_dir(const ou::string& path) {
 
 Result<uintptr_t, ErrorCode> FilesystemClient::list_dir(const ou::string& path) {
   // Serialize complex arguments to comm page
-  CommWriter writer;
-  writer.writer().str(path.c_str());
+  if (!encode_list_dir_args(ou_get_comm_page().as_ptr(), path)) {
+    return Result<uintptr_t, ErrorCode>::err(IPC__INVALID_ARGS);
+  }
 
   IpcResponse resp = ou_ipc_send(
     pid_,
@@ -164,6 +215,16 @@ Result<uintptr_t, ErrorCode> FilesystemClient::list_dir(const ou::string& path)
   return Result<uintptr_t, ErrorCode>::ok(resp.values[0]);
 }
 
+StreamReader FilesystemClient::read_stream(FileHandleId handle) {
+  // Chunks are fetched as the caller iterates
+  return StreamReader(pid_, MethodIds::Filesystem::READ_STREAM, 1, handle.raw());
+}
+
+Result<uintptr_t, ErrorCode> FilesystemClient::write_stream(FileHandleId handle, const StringView& data) {
+  // Sent one comm page at a time
+  return ipc_stream_upload(pid_, MethodIds::Filesystem::WRITE_STREAM, data, 1, handle.raw());
+}
+
 
 Result<bool, ErrorCode> FilesystemClient::shutdown() {
   IpcResponse resp = ou_ipc_send(
@@ -6,6 +6,7 @@
 #include "ot/user/gen/filesystem-types.hpp"
 #include "ot/user/string.hpp"
 #include "ot/user/vector.hpp"
+#include "ot/user/ipc-stream.hpp"
 
 struct FilesystemClient {
   Pid pid_;
@@ -29,6 +30,8 @@ struct FilesystemClient {
   Result<bool, ErrorCode> delete_file(const ou::string& path);
   Result<bool, ErrorCode> delete_dir(const ou::string& path);
   Result<uintptr_t, ErrorCode> list_dir(const ou::string& path);
+  StreamReader read_stream(FileHandleId handle);
+  Result<uintptr_t, ErrorCode> write_stream(FileHandleId handle, const StringView& data);
 
   // Universal shutdown method (sends IPC_METHOD_SHUTDOWN)
   Result<bool, ErrorCode> shutdown();
@@ -1,7 +1,53 @@
 #include "ot/user/gen/filesystem-server.hpp"
 #include "ot/user/gen/method-ids.hpp"
 #include "ot/user/user.hpp"
-#include "ot/lib/mpack/mpack-reader.hpp"
+#include "ot/lib/mpack/mpack-direct.hpp"
+
+// Comm page decoders, one per method with complex arguments: straight-line
+// reads of the method's schema, bounds-checked against the page, with strings
+// and buffers returned as views into it
+
+static bool decode_open_args(const void* comm, StringView& path) {
+  MPackDirectReader reader(comm, OT_PAGE_SIZE);
+  reader.read_string(path);
+  return reader.ok();
+}
+
+static bool decode_write_args(const void* comm, StringView& data) {
+  MPackDirectReader reader(comm, OT_PAGE_SIZE);
+  reader.read_bin(data);
+  return reader.ok();
+}
+
+static bool decode_create_file_args(const void* comm, StringView& path) {
+  MPackDirectReader reader(comm, OT_PAGE_SIZE);
+  reader.read_string(path);
+  return reader.ok();
+}
+
+static bool decode_create_dir_args(const void* comm, StringView& path) {
+  MPackDirectReader reader(comm, OT_PAGE_SIZE);
+  reader.read_string(path);
+  return reader.ok();
+}
+
+static bool decode_delete_file_args(const void* comm, StringView& path) {
+  MPackDirectReader reader(comm, OT_PAGE_SIZE);
+  reader.read_string(path);
+  return reader.ok();
+}
+
+static bool decode_delete_dir_args(const void* comm, StringView& path) {
+  MPackDirectReader reader(comm, OT_PAGE_SIZE);
+  reader.read_string(path);
+  return reader.ok();
+}
+
+static bool decode_list_dir_args(const void* comm, StringView& path) {
+  MPackDirectReader reader(comm, OT_PAGE_SIZE);
+  reader.read_string(path);
+  return reader.ok();
+}
 
 void FilesystemServerBase::process_request(const IpcMessage& msg) {
   // Check for shutdown request (handled by base class)
@@ -16,10 +62,11 @@ void FilesystemServerBase::process_request(const IpcMessage& msg) {
   switch (method) {
   case MethodIds::Filesystem::OPEN: {
     // Deserialize complex arguments from comm page
-    PageAddr comm = ou_get_comm_page();
-    MPackReader reader(comm.as_ptr(), OT_PAGE_SIZE);
     StringView path_view;
-    reader.read_string(path_view);
+    if (!decode_open_args(ou_get_comm_page().as_ptr(), path_view)) {
+      resp.error_code = IPC__INVALID_ARGS;
+      break;
+    }
     ou::string path(path_view.ptr, path_view.len);
     auto result = handle_open(path, msg.args[0]);
     if (result.is_err()) {
@@ -40,10 +87,11 @@ void FilesystemServerBase::process_request(const IpcMessage& msg) {
   }
   case MethodIds::Filesystem::WRITE: {
     // Deserialize complex arguments from comm page
-    PageAddr comm = ou_get_comm_page();
-    MPackReader reader(comm.as_ptr(), OT_PAGE_SIZE);
     StringView data;
-    reader.read_bin(data);  // Zero-copy binary data from comm page
+    if (!decode_write_args(ou_get_comm_page().as_ptr(), data)) {
+      resp.error_code = IPC__INVALID_ARGS;
+      break;
+    }
     auto result = handle_write(FileHandleId(msg.args[0]), msg.args[1], data);
     if (result.is_err()) {
       resp.error_code = result.error();
@@ -63,10 +111,11 @@ void FilesystemServerBase::process_request(const IpcMessage& msg) {
   }
   case MethodIds::Filesystem::CREATE_FILE: {
     // Deserialize complex arguments from comm page
-    PageAddr comm = ou_get_comm_page();
-    MPackReader reader(comm.as_ptr(), OT_PAGE_SIZE);
     StringView path_view;
-    reader.read_string(path_view);
+    if (!decode_create_file_args(ou_get_comm_page().as_ptr(), path_view)) {
+      resp.error_code = IPC__INVALID_ARGS;
+      break;
+    }
     ou::string path(path_view.ptr, path_view.len);
     auto result = handle_create_file(path);
     if (result.is_err()) {
@@ -78,10 +127,11 @@ void FilesystemServerBase::process_request(const IpcMessage& msg) {
   }
   case MethodIds::Filesystem::CREATE_DIR: {
     // Deserialize complex arguments from comm page
-    PageAddr comm = ou_get_comm_page();
-    MPackReader reader(comm.as_ptr(), OT_PAGE_SIZE);
     StringView path_view;
-    reader.read_string(path_view);
+    if (!decode_create_dir_args(ou_get_comm_page().as_ptr(), path_view)) {
+      resp.error_code = IPC__INVALID_ARGS;
+      break;
+    }
     ou::string path(path_view.ptr, path_view.len);
     auto result = handle_create_dir(path);
     if (result.is_err()) {
@@ -93,10 +143,11 @@ void FilesystemServerBase::process_request(const IpcMessage& msg) {
   }
   case MethodIds::Filesystem::DELETE_FILE: {
     // Deserialize complex arguments from comm page
-    PageAddr comm = ou_get_comm_page();
-    MPackReader reader(comm.as_ptr(), OT_PAGE_SIZE);
     StringView path_view;
-    reader.read_string(path_view);
+    if (!decode_delete_file_args(ou_get_comm_page().as_ptr(), path_view)) {
+      resp.error_code = IPC__INVALID_ARGS;
+      break;
+    }
     ou::string path(path_view.ptr, path_view.len);
     auto result = handle_delete_file(path);
     if (result.is_err()) {
@@ -108,10 +159,11 @@ void FilesystemServerBase::process_request(const IpcMessage& msg) {
   }
   case MethodIds::Filesystem::DELETE_DIR: {
     // Deserialize complex arguments from comm page
-    PageAddr comm = ou_get_comm_page();
-    MPackReader reader(comm.as_ptr(), OT_PAGE_SIZE);
     StringView path_view;
-    reader.read_string(path_view);
+    if (!decode_delete_dir_args(ou_get_comm_page().as_ptr(), path_view)) {
+      resp.error_code = IPC__INVALID_ARGS;
+      break;
+    }
     ou::string path(path_view.ptr, path_view.len);
     auto result = handle_delete_dir(path);
     if (result.is_err()) {
@@ -123,10 +175,11 @@ void FilesystemServerBase::process_request(const IpcMessage& msg) {
   }
   case MethodIds::Filesystem::LIST_DIR: {
     // Deserialize complex arguments from comm page
-    PageAddr comm = ou_get_comm_page();
-    MPackReader reader(comm.as_ptr(), OT_PAGE_SIZE);
     StringView path_view;
-    reader.read_string(path_view);
+    if (!decode_list_dir_args(ou_get_comm_page().as_ptr(), path_view)) {
+      resp.error_code = IPC__INVALID_ARGS;
+      break;
+    }
     ou::string path(path_view.ptr, path_view.len);
     auto result = handle_list_dir(path);
     if (result.is_err()) {
@@ -136,6 +189,28 @@ void FilesystemServerBase::process_request(const IpcMessage& msg) {
     }
     break;
   }
+  case MethodIds::Filesystem::READ_STREAM: {
+    // Stream download: fill one comm page, resuming at the client's cursor
+    StreamWriter data(ou_get_comm_page().as<char>(), msg.args[1]);
+    auto result = handle_read_stream(FileHandleId(msg.args[0]), data);
+    if (result.is_err()) {
+      resp.error_code = result.error();
+    } else {
+      data.fill_response(resp.values);
+    }
+    break;
+  }
+  case MethodIds::Filesystem::WRITE_STREAM: {
+    // Stream upload: one chunk of raw bytes in the comm page
+    StreamChunk data(ou_get_comm_page().as<char>(), msg.args[1], msg.args[2], flags);
+    auto result = handle_write_stream(FileHandleId(msg.args[0]), data);
+    if (result.is_err()) {
+      resp.error_code = result.error();
+    } else {
+      // No return values
+    }
+    break;
+  }
   default:
     resp.error_code = IPC__METHOD_NOT_KNOWN;
     break;
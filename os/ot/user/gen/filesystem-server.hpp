@@ -7,6 +7,7 @@
 #include "ot/user/gen/filesystem-types.hpp"
 #include "ot/user/gen/server-base.hpp"
 #include "ot/user/string.hpp"
+#include "ot/user/ipc-stream.hpp"
 
 struct FilesystemServerBase : ServerBase {
   // Virtual destructor for proper cleanup
@@ -22,6 +23,8 @@ struct FilesystemServerBase : ServerBase {
   virtual Result<bool, ErrorCode> handle_delete_file(const ou::string& path) = 0;
   virtual Result<bool, ErrorCode> handle_delete_dir(const ou::string& path) = 0;
   virtual Result<uintptr_t, ErrorCode> handle_list_dir(const ou::string& path) = 0;
+  virtual Result<bool, ErrorCode> handle_read_stream(FileHandleId handle, StreamWriter& data) = 0;
+  virtual Result<bool, ErrorCode> handle_write_stream(FileHandleId handle, const StreamChunk& data) = 0;
 
   // Framework methods - handles dispatch
   void process_request(const IpcMessage& msg);
@@ -1,7 +1,21 @@
 #include "ot/user/gen/graphics-client.hpp"
 #include "ot/user/gen/method-ids.hpp"
 #include "ot/user/user.hpp"
-#include "ot/lib/mpack/mpack-reader.hpp"
+#include "ot/lib/mpack/mpack-direct.hpp"
+
+// Comm page encoders, the counterparts of the server's decoders
+
+static bool encode_flush_rects_args(void* comm, const ou::vector<uint8_t>& rects) {
+  MPackDirectWriter writer(comm, OT_PAGE_SIZE);
+  writer.bin(rects.data(), rects.size());
+  return writer.ok();
+}
+
+static bool encode_register_app_args(void* comm, const char* name) {
+  MPackDirectWriter writer(comm, OT_PAGE_SIZE);
+  writer.str(name);
+  return writer.ok();
+}
 
 Result<GetFramebufferResult, ErrorCode> GraphicsClient::get_framebuffer() {
 
@@ -37,10 +51,45 @@ Result<bool, ErrorCode> GraphicsClient::flush() {
   return Result<bool, ErrorCode>::ok({});
 }
 
+Result<bool, ErrorCode> GraphicsClient::flush_rect(uintptr_t origin, uintptr_t extent) {
+
+  IpcResponse resp = ou_ipc_send(
+    pid_,
+    0,
+    MethodIds::Graphics::FLUSH_RECT,
+    origin, extent, 0  );
+
+  if (resp.error_code != NONE) {
+    return Result<bool, ErrorCode>::err(resp.error_code);
+  }
+
+  return Result<bool, ErrorCode>::ok({});
+}
+
+Result<bool, ErrorCode> GraphicsClient::flush_rects(const ou::vector<uint8_t>& rects) {
+  // Serialize complex arguments to comm page
+  if (!encode_flush_rects_args(ou_get_comm_page().as_ptr(), rects)) {
+    return Result<bool, ErrorCode>::err(IPC__INVALID_ARGS);
+  }
+
+  IpcResponse resp = ou_ipc_send(
+    pid_,
+    IPC_FLAG_SEND_COMM_DATA,
+    MethodIds::Graphics::FLUSH_RECTS,
+    0, 0, 0  );
+
+  if (resp.error_code != NONE) {
+    return Result<bool, ErrorCode>::err(resp.error_code);
+  }
+
+  return Result<bool, ErrorCode>::ok({});
+}
+
 Result<uintptr_t, ErrorCode> GraphicsClient::register_app(const char* name) {
   // Serialize complex arguments to comm page
-  CommWriter writer;
-  writer.writer().str(name);
+  if (!encode_register_app_args(ou_get_comm_page().as_ptr(), name)) {
+    return Result<uintptr_t, ErrorCode>::err(IPC__INVALID_ARGS);
+  }
 
   IpcResponse resp = ou_ipc_send(
     pid_,
@@ -100,6 +149,51 @@ Result<uintptr_t, ErrorCode> GraphicsClient::handle_key(uintptr_t code, uintptr_
   return Result<uintptr_t, ErrorCode>::ok(resp.values[0]);
 }
 
+Result<bool, ErrorCode> GraphicsClient::set_surface(uintptr_t origin, uintptr_t extent) {
+
+  IpcResponse resp = ou_ipc_send(
+    pid_,
+    0,
+    MethodIds::Graphics::SET_SURFACE,
+    origin, extent, 0  );
+
+  if (resp.error_code != NONE) {
+    return Result<bool, ErrorCode>::err(resp.error_code);
+  }
+
+  return Result<bool, ErrorCode>::ok({});
+}
+
+Result<bool, ErrorCode> GraphicsClient::set_visible(uintptr_t visible) {
+
+  IpcResponse resp = ou_ipc_send(
+    pid_,
+    0,
+    MethodIds::Graphics::SET_VISIBLE,
+    visible, 0, 0  );
+
+  if (resp.error_code != NONE) {
+    return Result<bool, ErrorCode>::err(resp.error_code);
+  }
+
+  return Result<bool, ErrorCode>::ok({});
+}
+
+Result<bool, ErrorCode> GraphicsClient::raise_app() {
+
+  IpcResponse resp = ou_ipc_send(
+    pid_,
+    0,
+    MethodIds::Graphics::RAISE_APP,
+    0, 0, 0  );
+
+  if (resp.error_code != NONE) {
+    return Result<bool, ErrorCode>::err(resp.error_code);
+  }
+
+  return Result<bool, ErrorCode>::ok({});
+}
+
 
 Result<bool, ErrorCode> GraphicsClient::shutdown() {
   IpcResponse resp = ou_ipc_send(
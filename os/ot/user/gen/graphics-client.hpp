@@ -22,10 +22,15 @@ struct GraphicsClient {
 
   Result<GetFramebufferResult, ErrorCode> get_framebuffer();
   Result<bool, ErrorCode> flush();
+  Result<bool, ErrorCode> flush_rect(uintptr_t origin, uintptr_t extent);
+  Result<bool, ErrorCode> flush_rects(const ou::vector<uint8_t>& rects);
   Result<uintptr_t, ErrorCode> register_app(const char* name);
   Result<uintptr_t, ErrorCode> should_render();
   Result<bool, ErrorCode> unregister_app();
   Result<uintptr_t, ErrorCode> handle_key(uintptr_t code, uintptr_t flags);
+  Result<bool, ErrorCode> set_surface(uintptr_t origin, uintptr_t extent);
+  Result<bool, ErrorCode> set_visible(uintptr_t visible);
+  Result<bool, ErrorCode> raise_app();
 
   // Universal shutdown method (sends IPC_METHOD_SHUTDOWN)
   Result<bool, ErrorCode> shutdown();
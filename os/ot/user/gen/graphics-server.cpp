@@ -1,7 +1,23 @@
 #include "ot/user/gen/graphics-server.hpp"
 #include "ot/user/gen/method-ids.hpp"
 #include "ot/user/user.hpp"
-#include "ot/lib/mpack/mpack-reader.hpp"
+#include "ot/lib/mpack/mpack-direct.hpp"
+
+// Comm page decoders, one per method with complex arguments: straight-line
+// reads of the method's schema, bounds-checked against the page, with strings
+// and buffers returned as views into it
+
+static bool decode_flush_rects_args(const void* comm, StringView& rects) {
+  MPackDirectReader reader(comm, OT_PAGE_SIZE);
+  reader.read_bin(rects);
+  return reader.ok();
+}
+
+static bool decode_register_app_args(const void* comm, StringView& name) {
+  MPackDirectReader reader(comm, OT_PAGE_SIZE);
+  reader.read_string(name);
+  return reader.ok();
+}
 
 void GraphicsServerBase::process_request(const IpcMessage& msg) {
   // Check for shutdown request (handled by base class)
@@ -35,12 +51,37 @@ void GraphicsServerBase::process_request(const IpcMessage& msg) {
     }
     break;
   }
+  case MethodIds::Graphics::FLUSH_RECT: {
+    auto result = handle_flush_rect(msg.args[0], msg.args[1]);
+    if (result.is_err()) {
+      resp.error_code = result.error();
+    } else {
+      // No return values
+    }
+    break;
+  }
+  case MethodIds::Graphics::FLUSH_RECTS: {
+    // Deserialize complex arguments from comm page
+    StringView rects;
+    if (!decode_flush_rects_args(ou_get_comm_page().as_ptr(), rects)) {
+      resp.error_code = IPC__INVALID_ARGS;
+      break;
+    }
+    auto result = handle_flush_rects(rects);
+    if (result.is_err()) {
+      resp.error_code = result.error();
+    } else {
+      // No return values
+    }
+    break;
+  }
   case MethodIds::Graphics::REGISTER_APP: {
     // Deserialize complex arguments from comm page
-    PageAddr comm = ou_get_comm_page();
-    MPackReader reader(comm.as_ptr(), OT_PAGE_SIZE);
     StringView name;
-    reader.read_string(name);  // Zero-copy string from comm page
+    if (!decode_register_app_args(ou_get_comm_page().as_ptr(), name)) {
+      resp.error_code = IPC__INVALID_ARGS;
+      break;
+    }
     auto result = handle_register_app(name);
     if (result.is_err()) {
       resp.error_code = result.error();
@@ -76,6 +117,33 @@ void GraphicsServerBase::process_request(const IpcMessage& msg) {
     }
     break;
   }
+  case MethodIds::Graphics::SET_SURFACE: {
+    auto result = handle_set_surface(msg.args[0], msg.args[1]);
+    if (result.is_err()) {
+      resp.error_code = result.error();
+    } else {
+      // No return values
+    }
+    break;
+  }
+  case MethodIds::Graphics::SET_VISIBLE: {
+    auto result = handle_set_visible(msg.args[0]);
+    if (result.is_err()) {
+      resp.error_code = result.error();
+    } else {
+      // No return values
+    }
+    break;
+  }
+  case MethodIds::Graphics::RAISE_APP: {
+    auto result = handle_raise_app();
+    if (result.is_err()) {
+      resp.error_code = result.error();
+    } else {
+      // No return values
+    }
+    break;
+  }
   default:
     resp.error_code = IPC__METHOD_NOT_KNOWN;
     break;
@@ -15,10 +15,15 @@ struct GraphicsServerBase : ServerBase {
   // Pure virtual methods to implement in derived class
   virtual Result<GetFramebufferResult, ErrorCode> handle_get_framebuffer() = 0;
   virtual Result<bool, ErrorCode> handle_flush() = 0;
+  virtual Result<bool, ErrorCode> handle_flush_rect(uintptr_t origin, uintptr_t extent) = 0;
+  virtual Result<bool, ErrorCode> handle_flush_rects(const StringView& rects) = 0;
   virtual Result<uintptr_t, ErrorCode> handle_register_app(const StringView& name) = 0;
   virtual Result<uintptr_t, ErrorCode> handle_should_render() = 0;
   virtual Result<bool, ErrorCode> handle_unregister_app() = 0;
   virtual Result<uintptr_t, ErrorCode> handle_handle_key(uintptr_t code, uintptr_t flags) = 0;
+  virtual Result<bool, ErrorCode> handle_set_surface(uintptr_t origin, uintptr_t extent) = 0;
+  virtual Result<bool, ErrorCode> handle_set_visible(uintptr_t visible) = 0;
+  virtual Result<bool, ErrorCode> handle_raise_app() = 0;
 
   // Framework methods - handles dispatch
   void process_request(const IpcMessage& msg);
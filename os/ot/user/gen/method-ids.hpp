@@ -11,23 +11,30 @@ namespace MethodIds {
   namespace Graphics {
     constexpr intptr_t GET_FRAMEBUFFER = 0x1300;
     constexpr intptr_t FLUSH = 0x1400;
-    constexpr intptr_t REGISTER_APP = 0x1500;
-    constexpr intptr_t SHOULD_RENDER = 0x1600;
-    constexpr intptr_t UNREGISTER_APP = 0x1700;
-    constexpr intptr_t HANDLE_KEY = 0x1800;
+    constexpr intptr_t FLUSH_RECT = 0x1500;
+    constexpr intptr_t FLUSH_RECTS = 0x1600;
+    constexpr intptr_t REGISTER_APP = 0x1700;
+    constexpr intptr_t SHOULD_RENDER = 0x1800;
+    constexpr intptr_t UNREGISTER_APP = 0x1900;
+    constexpr intptr_t HANDLE_KEY = 0x1a00;
+    constexpr intptr_t SET_SURFACE = 0x1b00;
+    constexpr intptr_t SET_VISIBLE = 0x1c00;
+    constexpr intptr_t RAISE_APP = 0x1d00;
   }
   namespace Filesystem {
-    constexpr intptr_t OPEN = 0x1900;
-    constexpr intptr_t READ = 0x1a00;
-    constexpr intptr_t WRITE = 0x1b00;
-    constexpr intptr_t CLOSE = 0x1c00;
-    constexpr intptr_t CREATE_FILE = 0x1d00;
-    constexpr intptr_t CREATE_DIR = 0x1e00;
-    constexpr intptr_t DELETE_FILE = 0x1f00;
-    constexpr intptr_t DELETE_DIR = 0x2000;
-    constexpr intptr_t LIST_DIR = 0x2100;
+    constexpr intptr_t OPEN = 0x1e00;
+    constexpr intptr_t READ = 0x1f00;
+    constexpr intptr_t WRITE = 0x2000;
+    constexpr intptr_t CLOSE = 0x2100;
+    constexpr intptr_t CREATE_FILE = 0x2200;
+    constexpr intptr_t CREATE_DIR = 0x2300;
+    constexpr intptr_t DELETE_FILE = 0x2400;
+    constexpr intptr_t DELETE_DIR = 0x2500;
+    constexpr intptr_t LIST_DIR = 0x2600;
+    constexpr intptr_t READ_STREAM = 0x2700;
+    constexpr intptr_t WRITE_STREAM = 0x2800;
   }
   namespace Keyboard {
-    constexpr intptr_t POLL_KEY = 0x2200;
+    constexpr intptr_t POLL_KEY = 0x2900;
   }
 }
@@ -32,34 +32,48 @@ inline void register_ipc_method_vars(tcl::Interp &i) {
   snprintf(buf, sizeof(buf), "%d", 0x1400);
   i.set_var("GRAPHICS_FLUSH", buf);
   snprintf(buf, sizeof(buf), "%d", 0x1500);
-  i.set_var("GRAPHICS_REGISTER_APP", buf);
+  i.set_var("GRAPHICS_FLUSH_RECT", buf);
   snprintf(buf, sizeof(buf), "%d", 0x1600);
-  i.set_var("GRAPHICS_SHOULD_RENDER", buf);
+  i.set_var("GRAPHICS_FLUSH_RECTS", buf);
   snprintf(buf, sizeof(buf), "%d", 0x1700);
-  i.set_var("GRAPHICS_UNREGISTER_APP", buf);
+  i.set_var("GRAPHICS_REGISTER_APP", buf);
   snprintf(buf, sizeof(buf), "%d", 0x1800);
+  i.set_var("GRAPHICS_SHOULD_RENDER", buf);
+  snprintf(buf, sizeof(buf), "%d", 0x1900);
+  i.set_var("GRAPHICS_UNREGISTER_APP", buf);
+  snprintf(buf, sizeof(buf), "%d", 0x1a00);
   i.set_var("GRAPHICS_HANDLE_KEY", buf);
+  snprintf(buf, sizeof(buf), "%d", 0x1b00);
+  i.set_var("GRAPHICS_SET_SURFACE", buf);
+  snprintf(buf, sizeof(buf), "%d", 0x1c00);
+  i.set_var("GRAPHICS_SET_VISIBLE", buf);
+  snprintf(buf, sizeof(buf), "%d", 0x1d00);
+  i.set_var("GRAPHICS_RAISE_APP", buf);
   // Filesystem service methods
-  snprintf(buf, sizeof(buf), "%d", 0x1900);
+  snprintf(buf, sizeof(buf), "%d", 0x1e00);
   i.set_var("FILESYSTEM_OPEN", buf);
-  snprintf(buf, sizeof(buf), "%d", 0x1a00);
+  snprintf(buf, sizeof(buf), "%d", 0x1f00);
   i.set_var("FILESYSTEM_READ", buf);
-  snprintf(buf, sizeof(buf), "%d", 0x1b00);
+  snprintf(buf, sizeof(buf), "%d", 0x2000);
   i.set_var("FILESYSTEM_WRITE", buf);
-  snprintf(buf, sizeof(buf), "%d", 0x1c00);
+  snprintf(buf, sizeof(buf), "%d", 0x2100);
   i.set_var("FILESYSTEM_CLOSE", buf);
-  snprintf(buf, sizeof(buf), "%d", 0x1d00);
+  snprintf(buf, sizeof(buf), "%d", 0x2200);
   i.set_var("FILESYSTEM_CREATE_FILE", buf);
-  snprintf(buf, sizeof(buf), "%d", 0x1e00);
+  snprintf(buf, sizeof(buf), "%d", 0x2300);
   i.set_var("FILESYSTEM_CREATE_DIR", buf);
-  snprintf(buf, sizeof(buf), "%d", 0x1f00);
+  snprintf(buf, sizeof(buf), "%d", 0x2400);
   i.set_var("FILESYSTEM_DELETE_FILE", buf);
-  snprintf(buf, sizeof(buf), "%d", 0x2000);
+  snprintf(buf, sizeof(buf), "%d", 0x2500);
   i.set_var("FILESYSTEM_DELETE_DIR", buf);
-  snprintf(buf, sizeof(buf), "%d", 0x2100);
+  snprintf(buf, sizeof(buf), "%d", 0x2600);
   i.set_var("FILESYSTEM_LIST_DIR", buf);
+  snprintf(buf, sizeof(buf), "%d", 0x2700);
+  i.set_var("FILESYSTEM_READ_STREAM", buf);
+  snprintf(buf, sizeof(buf), "%d", 0x2800);
+  i.set_var("FILESYSTEM_WRITE_STREAM", buf);
   // Keyboard service methods
-  snprintf(buf, sizeof(buf), "%d", 0x2200);
+  snprintf(buf, sizeof(buf), "%d", 0x2900);
   i.set_var("KEYBOARD_POLL_KEY", buf);
 
   // Error codes
@@ -70,10 +84,14 @@ inline void register_ipc_method_vars(tcl::Interp &i) {
   i.set_var("ERROR_FIBONACCI__INVALID_INPUT", buf);
   snprintf(buf, sizeof(buf), "%d", ErrorCode::GRAPHICS__NOT_INITIALIZED);
   i.set_var("ERROR_GRAPHICS__NOT_INITIALIZED", buf);
+  snprintf(buf, sizeof(buf), "%d", ErrorCode::GRAPHICS__INVALID_RECTS);
+  i.set_var("ERROR_GRAPHICS__INVALID_RECTS", buf);
   snprintf(buf, sizeof(buf), "%d", ErrorCode::GRAPHICS__TOO_MANY_APPS);
   i.set_var("ERROR_GRAPHICS__TOO_MANY_APPS", buf);
   snprintf(buf, sizeof(buf), "%d", ErrorCode::GRAPHICS__NOT_REGISTERED);
   i.set_var("ERROR_GRAPHICS__NOT_REGISTERED", buf);
+  snprintf(buf, sizeof(buf), "%d", ErrorCode::GRAPHICS__INVALID_SURFACE);
+  i.set_var("ERROR_GRAPHICS__INVALID_SURFACE", buf);
   snprintf(buf, sizeof(buf), "%d", ErrorCode::FILESYSTEM__FILE_NOT_FOUND);
   i.set_var("ERROR_FILESYSTEM__FILE_NOT_FOUND", buf);
   snprintf(buf, sizeof(buf), "%d", ErrorCode::FILESYSTEM__PATH_TOO_LONG);
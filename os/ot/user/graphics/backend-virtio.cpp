@@ -184,49 +184,69 @@ void VirtioGraphicsBackend::create_framebuffer() {
   l.log("Framebuffer setup complete, ready for drawing");
 }
 
-void VirtioGraphicsBackend::flush() {
+bool VirtioGraphicsBackend::transfer_to_host(const graphics::Rect &r) {
   // Reuse existing command/response pages
-  // Transfer to host
   struct virtio_gpu_transfer_to_host_2d *transfer = cmd_page.as<struct virtio_gpu_transfer_to_host_2d>();
   transfer->hdr.type = VIRTIO_GPU_CMD_TRANSFER_TO_HOST_2D;
   transfer->hdr.flags = 0;
   transfer->hdr.fence_id = 0;
   transfer->hdr.ctx_id = 0;
   transfer->hdr.padding = 0;
-  transfer->r.x = 0;
-  transfer->r.y = 0;
-  transfer->r.width = width;
-  transfer->r.height = height;
-  transfer->offset = 0;
+  transfer->r.x = r.x;
+  transfer->r.y = r.y;
+  transfer->r.width = r.w;
+  transfer->r.height = r.h;
+  // Byte offset of the rectangle's top-left pixel in the backing store; the
+  // host copies each row from offset + row * stride
+  transfer->offset = ((uint64_t)r.y * width + r.x) * 4;
   transfer->resource_id = 1;
   transfer->padding = 0;
 
   uint32_t resp_type = send_command(cmd_page, sizeof(*transfer), resp_page, sizeof(struct virtio_gpu_ctrl_hdr));
   // l.log("Transfer response: 0x%x", resp_type);
-  if (resp_type != VIRTIO_GPU_RESP_OK_NODATA) {
-    // This seems to happen occasionally
-    // oprintf("ERROR: Transfer failed!\n");
-    return;
-  }
+  // This seems to fail occasionally
+  return resp_type == VIRTIO_GPU_RESP_OK_NODATA;
+}
 
-  // Flush resource
+bool VirtioGraphicsBackend::resource_flush(const graphics::Rect &r) {
   struct virtio_gpu_resource_flush *flush_cmd = cmd_page.as<struct virtio_gpu_resource_flush>();
   flush_cmd->hdr.type = VIRTIO_GPU_CMD_RESOURCE_FLUSH;
   flush_cmd->hdr.flags = 0;
   flush_cmd->hdr.fence_id = 0;
   flush_cmd->hdr.ctx_id = 0;
   flush_cmd->hdr.padding = 0;
-  flush_cmd->r.x = 0;
-  flush_cmd->r.y = 0;
-  flush_cmd->r.width = width;
-  flush_cmd->r.height = height;
+  flush_cmd->r.x = r.x;
+  flush_cmd->r.y = r.y;
+  flush_cmd->r.width = r.w;
+  flush_cmd->r.height = r.h;
   flush_cmd->resource_id = 1;
   flush_cmd->padding = 0;
 
-  resp_type = send_command(cmd_page, sizeof(*flush_cmd), resp_page, sizeof(struct virtio_gpu_ctrl_hdr));
+  uint32_t resp_type = send_command(cmd_page, sizeof(*flush_cmd), resp_page, sizeof(struct virtio_gpu_ctrl_hdr));
   // oprintf("Flush response: 0x%x\n", resp_type);
-  if (resp_type != VIRTIO_GPU_RESP_OK_NODATA) {
-    // oprintf("ERROR: Flush failed!\n");
+  return resp_type == VIRTIO_GPU_RESP_OK_NODATA;
+}
+
+void VirtioGraphicsBackend::flush() {
+  graphics::Rect full(0, 0, (int)width, (int)height);
+  if (!transfer_to_host(full)) {
     return;
   }
+  resource_flush(full);
+}
+
+void VirtioGraphicsBackend::flush_rects(const graphics::Rect *rects, int count) {
+  if (count <= 0) {
+    return;
+  }
+
+  // Transfer each damaged region, then flush the scanout once over their bounds
+  graphics::Rect bounds;
+  for (int i = 0; i < count; i++) {
+    if (!transfer_to_host(rects[i])) {
+      return;
+    }
+    bounds = bounds.unite(rects[i]);
+  }
+  resource_flush(bounds);
 }
@@ -107,12 +107,15 @@ public:
   bool init() override;
   uint32_t *get_framebuffer() override { return framebuffer.as<uint32_t>(); }
   void flush() override;
+  void flush_rects(const graphics::Rect *rects, int count) override;
   uint32_t get_width() const override { return width; }
   uint32_t get_height() const override { return height; }
 
 private:
   uint32_t send_command(PageAddr cmd, uint32_t cmd_len, PageAddr resp, uint32_t resp_len);
   void create_framebuffer();
+  bool transfer_to_host(const graphics::Rect &r);
+  bool resource_flush(const graphics::Rect &r);
 };
 
 #endif
@@ -31,6 +31,18 @@ EM_JS(void, js_graphics_flush, (uint32_t *fb_ptr, int width, int height), {
   }
 });
 
+// rects points at count graphics::Rect structs, i.e. count * 4 int32 values (x, y, w, h)
+EM_JS(void, js_graphics_flush_rects, (uint32_t *fb_ptr, int width, int height, const int *rects, int count), {
+  const pixelCount = width * height;
+  const pixels = HEAP32.subarray(fb_ptr >> 2, (fb_ptr >> 2) + pixelCount);
+  if (typeof Module.graphicsFlushRects === 'function') {
+    const damage = HEAP32.subarray(rects >> 2, (rects >> 2) + count * 4);
+    Module.graphicsFlushRects(pixels, width, height, damage);
+  } else if (typeof Module.graphicsFlush === 'function') {
+    Module.graphicsFlush(pixels, width, height);
+  }
+});
+
 EM_JS(void, js_graphics_cleanup, (), {
   if (typeof Module.graphicsCleanup === 'function') {
     Module.graphicsCleanup();
@@ -99,6 +111,16 @@ public:
     js_graphics_flush(framebuffer, width, height);
   }
 
+  void flush_rects(const graphics::Rect *rects, int count) override {
+    if (!framebuffer) {
+      oprintf("WasmGraphicsBackend: Cannot flush - not initialized\n");
+      return;
+    }
+
+    static_assert(sizeof(graphics::Rect) == 4 * sizeof(int), "Rect must be four packed ints for JS");
+    js_graphics_flush_rects(framebuffer, width, height, (const int *)rects, count);
+  }
+
   uint32_t get_width() const override { return width; }
 
   uint32_t get_height() const override { return height; }
@@ -3,6 +3,8 @@
 
 #include <stdint.h>
 
+#include "ot/lib/rect.hpp"
+
 /**
  * Abstract graphics backend interface.
  * Implementations provide platform-specific rendering backends for user-space.
@@ -29,6 +31,15 @@ public:
    */
   virtual void flush() = 0;
 
+  /**
+   * Flush only the given damaged regions to the display.
+   * Rectangles are already clipped to the display bounds. Backends that can't
+   * do partial updates fall back to a full flush.
+   * @param rects Damaged regions
+   * @param count Number of regions
+   */
+  virtual void flush_rects(const graphics::Rect *rects, int count) { flush(); }
+
   /**
    * Get the width of the display in pixels.
    * @return Display width, or 0 if not initialized
@@ -1,5 +1,8 @@
 #include "ot/lib/app-framework.hpp"
+#include "ot/lib/compositor.hpp"
 #include "ot/lib/logger.hpp"
+#include "ot/lib/pixel-ops.hpp"
+#include "ot/lib/rect.hpp"
 #include "ot/lib/string-view.hpp"
 #include "ot/user/gen/graphics-server.hpp"
 #include "ot/user/graphics/backend.hpp"
@@ -19,7 +22,9 @@
 
 static const int MAX_REGISTERED_APPS = 9;
 static const int TASKBAR_HEIGHT = 28;
+static const size_t GLYPH_CACHE_BUDGET = 8 * 1024;
 static const int TASKBAR_FONT_SIZE = 16;
+static const uint32_t DESKTOP_COLOR = 0xFF1a1a2e;        // Shown where no surface covers the screen
 static const uint32_t TASKBAR_BG_COLOR = 0xFF1a1a2e;     // Dark blue-gray
 static const uint32_t TASKBAR_BORDER_COLOR = 0xFF2d2d44; // Lighter blue-gray border
 static const uint32_t TASKBAR_TEXT_COLOR = 0xFF888899;   // Muted blue-gray text
@@ -35,27 +40,69 @@ struct RegisteredApp {
   Pid pid;
   uint8_t app_id; // 1-based, displayed in taskbar
   char name[16];
+  // Window the app draws into. The pixel buffer is sized for the whole area
+  // above the taskbar so the surface can be moved and resized without
+  // reallocating; it is kept with the slot after the app exits so the next app
+  // registered there reuses it. If it couldn't be allocated (pixels == nullptr)
+  // the app draws straight into the scanout and is only shown while focused.
+  graphics::Surface surface;
 };
 
 // Graphics server implementation with instance state
 struct GraphicsServer : GraphicsServerBase {
   GraphicsBackend *backend;
   Logger l;
-  app::Framework *fw; // For TTF font rendering in taskbar
+  app::Framework *fw;         // For TTF font rendering on the scanout (idle screen)
+  app::Framework *taskbar_fw; // For TTF font rendering into the taskbar surface
+  graphics::Compositor *compositor;
 
   // Multi-app state
   RegisteredApp apps[MAX_REGISTERED_APPS];
-  int active_app_index;   // Index of most recently registered app (-1 if none)
+  int active_app_index;   // Index of the focused app (-1 if none)
   uint8_t next_app_id;    // Next ID to assign
   IpcMessage current_msg; // Current message being processed (for sender_pid access)
 
-  GraphicsServer() : backend(nullptr), l("gfx"), fw(nullptr), active_app_index(-1), next_app_id(1) {
+  // The taskbar is its own always-on-top surface; it is only re-rendered when
+  // the app list or focus changes, and composited like any other surface
+  graphics::Surface taskbar;
+  bool taskbar_dirty;
+
+  GraphicsServer()
+      : backend(nullptr), l("gfx"), fw(nullptr), taskbar_fw(nullptr), compositor(nullptr), active_app_index(-1),
+        next_app_id(1), taskbar_dirty(true) {
     for (int i = 0; i < MAX_REGISTERED_APPS; i++) {
       apps[i].used = false;
     }
+    taskbar.always_on_top = true;
   }
 
-  // Initialize the framework for TTF rendering (call after backend is set)
+  // Create the compositor and taskbar surface (call after backend is set)
+  bool init_compositor() {
+    if (!backend || !backend->get_framebuffer())
+      return false;
+
+    static char compositor_buffer[sizeof(graphics::Compositor)]
+        __attribute__((aligned(alignof(graphics::Compositor))));
+    compositor = new (compositor_buffer)
+        graphics::Compositor(backend->get_framebuffer(), backend->get_width(), backend->get_height(), DESKTOP_COLOR);
+
+    // Screens too small for a taskbar (the test backend) composite apps only
+    if (!taskbar_enabled()) {
+      return true;
+    }
+
+    size_t bytes = (size_t)backend->get_width() * TASKBAR_HEIGHT * sizeof(uint32_t);
+    taskbar.pixels = (uint32_t *)ou_alloc_pages((bytes + OT_PAGE_SIZE - 1) / OT_PAGE_SIZE);
+    if (!taskbar.pixels) {
+      l.log("Failed to allocate taskbar surface");
+      return true;
+    }
+    taskbar.rect = taskbar_rect();
+    compositor->attach(&taskbar);
+    return true;
+  }
+
+  // Initialize the framework for TTF rendering (call after init_compositor)
   bool init_framework() {
     if (!backend)
       return false;
@@ -63,6 +110,8 @@ struct GraphicsServer : GraphicsServerBase {
     // Use placement new with static buffer to avoid heap allocation for Framework object
     static char fw_buffer[sizeof(app::Framework)] __attribute__((aligned(alignof(app::Framework))));
     fw = new (fw_buffer) app::Framework(backend->get_framebuffer(), backend->get_width(), backend->get_height());
+    // Two glyph caches share this server's small heap; the taskbar only needs a few dozen glyphs
+    fw->set_glyph_cache_budget(GLYPH_CACHE_BUDGET);
 
     auto result = fw->init_ttf();
     if (result.is_err()) {
@@ -70,6 +119,16 @@ struct GraphicsServer : GraphicsServerBase {
       fw = nullptr;
       return false;
     }
+
+    if (taskbar.pixels) {
+      static char taskbar_fw_buffer[sizeof(app::Framework)] __attribute__((aligned(alignof(app::Framework))));
+      taskbar_fw = new (taskbar_fw_buffer) app::Framework(taskbar.pixels, backend->get_width(), TASKBAR_HEIGHT);
+      taskbar_fw->set_glyph_cache_budget(GLYPH_CACHE_BUDGET);
+      if (taskbar_fw->init_ttf().is_err()) {
+        taskbar_fw = nullptr;
+        return false;
+      }
+    }
     return true;
   }
 
@@ -104,73 +163,151 @@ struct GraphicsServer : GraphicsServerBase {
     return -1;
   }
 
+  // Find the app slot owning a surface, returns -1 for the taskbar
+  int find_app_by_surface(const graphics::Surface *s) {
+    for (int i = 0; i < MAX_REGISTERED_APPS; i++) {
+      if (apps[i].used && &apps[i].surface == s) {
+        return i;
+      }
+    }
+    return -1;
+  }
+
+  bool taskbar_enabled() const { return (int)backend->get_height() > TASKBAR_HEIGHT; }
+
+  // Height of the area above the taskbar that apps draw into
+  int app_height() const {
+    int height = backend->get_height();
+    return taskbar_enabled() ? height - TASKBAR_HEIGHT : height;
+  }
+
+  graphics::Rect app_area() const { return graphics::Rect(0, 0, backend->get_width(), app_height()); }
+
+  // Allocate an app's back buffer if the slot doesn't have one yet
+  uint32_t *ensure_back_buffer(int slot) {
+    graphics::Surface &s = apps[slot].surface;
+    if (s.pixels) {
+      return s.pixels;
+    }
+
+    size_t bytes = (size_t)backend->get_width() * app_height() * sizeof(uint32_t);
+    size_t pages = (bytes + OT_PAGE_SIZE - 1) / OT_PAGE_SIZE;
+    s.pixels = (uint32_t *)ou_alloc_pages(pages);
+    if (!s.pixels) {
+      l.log("Failed to allocate %lu page back buffer for %s, drawing directly to scanout", pages, apps[slot].name);
+    }
+    return s.pixels;
+  }
+
+  // Give focus to the topmost visible app surface, or to the last registered
+  // app if none of them has a surface
+  void focus_top() {
+    int focus = -1;
+    for (int i = compositor ? compositor->count() - 1 : -1; i >= 0 && focus < 0; i--) {
+      int slot = find_app_by_surface(compositor->at(i));
+      if (slot >= 0 && apps[slot].surface.visible) {
+        focus = slot;
+      }
+    }
+    for (int i = 0; i < MAX_REGISTERED_APPS && focus < 0; i++) {
+      if (apps[i].used && !apps[i].surface.pixels) {
+        focus = i;
+      }
+    }
+
+    if (focus != active_app_index) {
+      active_app_index = focus;
+      taskbar_dirty = true;
+    }
+  }
+
+  // Bring an app to the top of the stack and focus it
+  void raise_app(int slot, graphics::DamageList &damage) {
+    graphics::Surface &s = apps[slot].surface;
+    if (s.pixels) {
+      compositor->raise(&s);
+      if (s.shown()) {
+        compositor->recompose(s.rect, damage);
+      }
+    }
+    if (active_app_index != slot) {
+      active_app_index = slot;
+      taskbar_dirty = true;
+    }
+  }
+
+  // Renumber remaining apps sequentially
+  void renumber_apps() {
+    uint8_t new_id = 1;
+    for (int i = 0; i < MAX_REGISTERED_APPS; i++) {
+      if (apps[i].used) {
+        apps[i].app_id = new_id++;
+      }
+    }
+    next_app_id = new_id;
+  }
+
+  // Take an app off screen and free its slot (the back buffer is kept)
+  void remove_app(int slot, graphics::DamageList &damage) {
+    graphics::Surface &s = apps[slot].surface;
+    apps[slot].used = false;
+    if (s.pixels) {
+      bool was_shown = s.shown();
+      compositor->detach(&s);
+      if (was_shown) {
+        compositor->recompose(s.rect, damage);
+      }
+    }
+    taskbar_dirty = true;
+  }
+
   // Reap dead processes and renumber app_ids
-  void reap_dead_processes() {
+  void reap_dead_processes(graphics::DamageList &damage) {
     bool any_reaped = false;
 
     for (int i = 0; i < MAX_REGISTERED_APPS; i++) {
       if (apps[i].used && !ou_proc_is_alive(apps[i].pid)) {
         l.log("Reaping dead app: %s (pid=%lu)", apps[i].name, apps[i].pid.raw());
-        apps[i].used = false;
+        remove_app(i, damage);
         any_reaped = true;
-
-        // If this was the active app, we need to find a new one
-        if (active_app_index == i) {
-          active_app_index = -1;
-        }
       }
     }
 
     if (any_reaped) {
-      // Renumber remaining apps sequentially and find new active
-      uint8_t new_id = 1;
-      int last_used_index = -1;
-      for (int i = 0; i < MAX_REGISTERED_APPS; i++) {
-        if (apps[i].used) {
-          apps[i].app_id = new_id++;
-          last_used_index = i;
-        }
-      }
-      next_app_id = new_id;
-
-      // If we lost the active app, make the last registered one active
-      if (active_app_index == -1 && last_used_index >= 0) {
-        active_app_index = last_used_index;
-      }
+      renumber_apps();
+      focus_top();
 
       // If no apps remain, show idle screen
-      if (last_used_index < 0) {
+      if (count_active_apps() == 0) {
         render_idle_screen();
+        damage.clear();
       }
     }
   }
 
-  // Render the taskbar at the bottom of the screen
+  // Screen area covered by the taskbar
+  graphics::Rect taskbar_rect() const {
+    int height = backend->get_height();
+    return graphics::Rect(0, height - TASKBAR_HEIGHT, backend->get_width(), TASKBAR_HEIGHT);
+  }
+
+  // Render the taskbar into its surface
   void render_taskbar() {
-    if (!backend)
+    taskbar_dirty = false;
+    if (!taskbar.pixels)
       return;
 
-    uint32_t *fb = backend->get_framebuffer();
-    int width = backend->get_width();
-    int height = backend->get_height();
-    int taskbar_y = height - TASKBAR_HEIGHT;
+    uint32_t *fb = taskbar.pixels;
+    int width = taskbar.rect.w;
 
-    // Fill taskbar background
-    for (int y = taskbar_y; y < height; y++) {
-      for (int x = 0; x < width; x++) {
-        fb[y * width + x] = TASKBAR_BG_COLOR;
-      }
-    }
-
-    // Draw top border (1px lighter line)
-    for (int x = 0; x < width; x++) {
-      fb[taskbar_y * width + x] = TASKBAR_BORDER_COLOR;
-    }
+    // Fill taskbar background with a top border (1px lighter line)
+    graphics::fill_span(fb, width, TASKBAR_BORDER_COLOR);
+    graphics::fill_span(fb + width, width * (TASKBAR_HEIGHT - 1), TASKBAR_BG_COLOR);
 
     // Draw registered apps using TTF font if available
-    if (fw && fw->ttf_available()) {
+    if (taskbar_fw && taskbar_fw->ttf_available()) {
       int text_x = 12;
-      int text_y = taskbar_y + 5; // Vertically center for 16px font in 28px bar
+      int text_y = 5; // Vertically center for 16px font in 28px bar
       char buf[32];
 
       for (int i = 0; i < MAX_REGISTERED_APPS; i++) {
@@ -206,13 +343,32 @@ struct GraphicsServer : GraphicsServerBase {
 
           // Highlight active app
           uint32_t color = (i == active_app_index) ? TASKBAR_ACTIVE_COLOR : TASKBAR_TEXT_COLOR;
-          auto result = fw->draw_ttf_text(text_x, text_y, buf, color, TASKBAR_FONT_SIZE);
+          auto result = taskbar_fw->draw_ttf_text(text_x, text_y, buf, color, TASKBAR_FONT_SIZE);
           if (result.is_ok()) {
             text_x += result.value() + 20; // Add spacing between apps
           }
         }
       }
     }
+
+    taskbar.mapped = true;
+  }
+
+  // Re-render the taskbar if the app list changed and composite it
+  void update_taskbar(graphics::DamageList &damage) {
+    if (!taskbar_dirty || !compositor) {
+      return;
+    }
+    render_taskbar();
+    compositor->present(&taskbar, graphics::Rect(0, 0, taskbar.rect.w, taskbar.rect.h), damage);
+  }
+
+  // Send everything composited since the last flush to the display
+  void flush_screen(graphics::DamageList &damage) {
+    update_taskbar(damage);
+    if (!damage.empty()) {
+      backend->flush_rects(damage.rects, damage.count);
+    }
   }
 
   // Count how many apps are currently registered
@@ -228,17 +384,18 @@ struct GraphicsServer : GraphicsServerBase {
 
   // Render idle screen when no apps are running
   void render_idle_screen() {
-    if (!backend)
+    if (!backend || !compositor)
       return;
 
-    uint32_t *fb = backend->get_framebuffer();
     int width = backend->get_width();
     int height = backend->get_height();
 
-    // Clear to dark background
-    for (int i = 0; i < width * height; i++) {
-      fb[i] = TASKBAR_BG_COLOR;
+    // Clear to the desktop background with an empty taskbar for consistent UI
+    graphics::DamageList damage;
+    if (taskbar_dirty) {
+      render_taskbar();
     }
+    compositor->recompose(graphics::Rect(0, 0, width, height), damage);
 
     // Render centered "No apps running" message
     if (fw && fw->ttf_available()) {
@@ -251,41 +408,112 @@ struct GraphicsServer : GraphicsServerBase {
       }
     }
 
-    // Render empty taskbar for consistent UI
-    render_taskbar();
-
     backend->flush();
   }
 
   Result<GetFramebufferResult, ErrorCode> handle_get_framebuffer() override {
-    if (!backend || !backend->get_framebuffer()) {
+    if (!backend || !compositor) {
       return Result<GetFramebufferResult, ErrorCode>::err(GRAPHICS__NOT_INITIALIZED);
     }
 
     GetFramebufferResult result;
-    result.fb_ptr = (uintptr_t)backend->get_framebuffer();
-    result.width = backend->get_width();
-    // Return reduced height to keep apps above the taskbar
-    result.height = backend->get_height() - TASKBAR_HEIGHT;
+
+    // Registered apps draw into their surface; unregistered clients (and apps
+    // whose buffer couldn't be allocated) get the scanout above the taskbar
+    int slot = find_app_by_pid(sender_pid());
+    if (slot >= 0 && apps[slot].surface.pixels) {
+      const graphics::Surface &s = apps[slot].surface;
+      result.fb_ptr = (uintptr_t)s.pixels;
+      result.width = s.rect.w;
+      result.height = s.rect.h;
+    } else {
+      result.fb_ptr = (uintptr_t)backend->get_framebuffer();
+      result.width = backend->get_width();
+      result.height = app_height();
+    }
 
     l.log("Returning fb_ptr=0x%lx, width=%lu, height=%lu", result.fb_ptr, result.width, result.height);
 
     return Result<GetFramebufferResult, ErrorCode>::ok(result);
   }
 
+  // Present a frame. For apps with a surface, the damaged regions (in surface
+  // coordinates) are composited onto the scanout minus whatever is covered by
+  // surfaces above, so a fully occluded app costs nothing. Clients drawing
+  // straight into the scanout just have their regions flushed while focused.
+  Result<bool, ErrorCode> present(graphics::DamageList &local, bool full) {
+    graphics::DamageList damage;
+    reap_dead_processes(damage);
+
+    int slot = find_app_by_pid(sender_pid());
+    if (slot >= 0 && apps[slot].surface.pixels) {
+      graphics::Surface &s = apps[slot].surface;
+      if (!s.mapped) {
+        // First frame since registering or resizing: show the whole surface
+        s.mapped = true;
+        full = true;
+      }
+
+      if (full) {
+        compositor->present(&s, graphics::Rect(0, 0, s.rect.w, s.rect.h), damage);
+      } else {
+        for (int i = 0; i < local.count; i++) {
+          compositor->present(&s, local.rects[i], damage);
+        }
+      }
+      flush_screen(damage);
+      return Result<bool, ErrorCode>::ok(true);
+    }
+
+    if (slot >= 0 && slot != active_app_index) {
+      return Result<bool, ErrorCode>::ok(true);
+    }
+
+    if (full) {
+      update_taskbar(damage);
+      backend->flush();
+      return Result<bool, ErrorCode>::ok(true);
+    }
+
+    for (int i = 0; i < local.count; i++) {
+      damage.add(local.rects[i].clip(backend->get_width(), app_height()));
+    }
+    flush_screen(damage);
+    return Result<bool, ErrorCode>::ok(true);
+  }
+
   Result<bool, ErrorCode> handle_flush() override {
-    if (!backend) {
+    if (!backend || !compositor) {
       return Result<bool, ErrorCode>::err(GRAPHICS__NOT_INITIALIZED);
     }
 
-    // Reap dead processes before rendering
-    reap_dead_processes();
+    graphics::DamageList local;
+    return present(local, true);
+  }
 
-    // Render taskbar over the app content
-    render_taskbar();
+  Result<bool, ErrorCode> handle_flush_rect(uintptr_t origin, uintptr_t extent) override {
+    if (!backend || !compositor) {
+      return Result<bool, ErrorCode>::err(GRAPHICS__NOT_INITIALIZED);
+    }
 
-    backend->flush();
-    return Result<bool, ErrorCode>::ok(true);
+    graphics::DamageList local;
+    local.add(graphics::Rect::from_packed(origin, extent));
+    return present(local, false);
+  }
+
+  Result<bool, ErrorCode> handle_flush_rects(const StringView &rects) override {
+    if (!backend || !compositor) {
+      return Result<bool, ErrorCode>::err(GRAPHICS__NOT_INITIALIZED);
+    }
+    if (rects.len % graphics::RECT_WIRE_SIZE != 0) {
+      return Result<bool, ErrorCode>::err(GRAPHICS__INVALID_RECTS);
+    }
+
+    graphics::DamageList local;
+    for (size_t off = 0; off < rects.len; off += graphics::RECT_WIRE_SIZE) {
+      local.add(graphics::rect_decode((const uint8_t *)rects.ptr + off));
+    }
+    return present(local, false);
   }
 
   Result<uintptr_t, ErrorCode> handle_register_app(const StringView &name) override {
@@ -314,8 +542,19 @@ struct GraphicsServer : GraphicsServerBase {
     }
     apps[slot].name[name_len] = '\0';
 
+    // New apps get a full-size surface on top of the stack, shown once they
+    // present their first frame
+    graphics::Surface &s = apps[slot].surface;
+    s.rect = app_area();
+    s.visible = true;
+    s.mapped = false;
+    if (compositor && ensure_back_buffer(slot)) {
+      compositor->attach(&s);
+    }
+
     // Most recently registered app becomes active
     active_app_index = slot;
+    taskbar_dirty = true;
 
     l.log("Registered app: %s (pid=%lu, app_id=%d)", apps[slot].name, apps[slot].pid.raw(), apps[slot].app_id);
 
@@ -328,9 +567,19 @@ struct GraphicsServer : GraphicsServerBase {
       return Result<uintptr_t, ErrorCode>::err(GRAPHICS__NOT_REGISTERED);
     }
 
-    // Return 1 if this app is active, 0 otherwise
-    uintptr_t active = (slot == active_app_index) ? 1 : 0;
-    return Result<uintptr_t, ErrorCode>::ok(active);
+    uintptr_t flags = 0;
+    bool focused = slot == active_app_index;
+    if (focused) {
+      flags |= graphics::RENDER_FOCUSED;
+    }
+
+    // Apps with a surface draw whenever part of it is on screen; apps drawing
+    // straight into the scanout only while focused
+    const graphics::Surface &s = apps[slot].surface;
+    if (s.pixels ? (s.visible && !compositor->occluded(&s)) : focused) {
+      flags |= graphics::RENDER_VISIBLE;
+    }
+    return Result<uintptr_t, ErrorCode>::ok(flags);
   }
 
   Result<bool, ErrorCode> handle_unregister_app() override {
@@ -340,28 +589,10 @@ struct GraphicsServer : GraphicsServerBase {
     }
 
     l.log("Unregistering app: %s (pid=%lu)", apps[slot].name, apps[slot].pid.raw());
-    apps[slot].used = false;
-
-    // If this was the active app, clear it
-    if (active_app_index == slot) {
-      active_app_index = -1;
-    }
-
-    // Renumber remaining apps sequentially and find new active
-    uint8_t new_id = 1;
-    int last_used_index = -1;
-    for (int i = 0; i < MAX_REGISTERED_APPS; i++) {
-      if (apps[i].used) {
-        apps[i].app_id = new_id++;
-        last_used_index = i;
-      }
-    }
-    next_app_id = new_id;
-
-    // If we lost the active app, make the last registered one active
-    if (active_app_index == -1 && last_used_index >= 0) {
-      active_app_index = last_used_index;
-    }
+    graphics::DamageList damage;
+    remove_app(slot, damage);
+    renumber_apps();
+    focus_top();
 
     // If no apps remain, show idle screen
     int remaining = count_active_apps();
@@ -369,6 +600,8 @@ struct GraphicsServer : GraphicsServerBase {
     if (remaining == 0) {
       l.log("No apps remaining, rendering idle screen");
       render_idle_screen();
+    } else {
+      flush_screen(damage);
     }
 
     return Result<bool, ErrorCode>::ok(true);
@@ -386,8 +619,12 @@ struct GraphicsServer : GraphicsServerBase {
       if (code >= KEY_1 && code <= KEY_9) {
         uint8_t target_app_id = (uint8_t)(code - KEY_1 + 1);
         int slot = find_app_by_id(target_app_id);
-        if (slot >= 0) {
-          active_app_index = slot;
+        if (slot >= 0 && compositor) {
+          // The app's surface still holds its last frame, so it can be shown
+          // right away without waiting for the app to redraw
+          graphics::DamageList damage;
+          raise_app(slot, damage);
+          flush_screen(damage);
           l.log("Switched to app %d: %s (pid=%lu)", target_app_id, apps[slot].name, apps[slot].pid.raw());
         }
         return Result<uintptr_t, ErrorCode>::ok(1); // consumed
@@ -396,6 +633,67 @@ struct GraphicsServer : GraphicsServerBase {
 
     return Result<uintptr_t, ErrorCode>::ok(0); // not consumed
   }
+
+  Result<bool, ErrorCode> handle_set_surface(uintptr_t origin, uintptr_t extent) override {
+    int slot = find_app_by_pid(sender_pid());
+    if (slot < 0) {
+      return Result<bool, ErrorCode>::err(GRAPHICS__NOT_REGISTERED);
+    }
+
+    graphics::Surface &s = apps[slot].surface;
+    graphics::Rect r = graphics::Rect::from_packed(origin, extent);
+    if (!s.pixels || r.empty() || !app_area().contains(r)) {
+      return Result<bool, ErrorCode>::err(GRAPHICS__INVALID_SURFACE);
+    }
+
+    // The buffer's contents don't match the new stride until the app redraws,
+    // so the surface stays hidden until its next present
+    graphics::DamageList damage;
+    graphics::Rect old = s.rect;
+    bool was_shown = s.shown();
+    s.rect = r;
+    s.mapped = false;
+    if (was_shown) {
+      compositor->recompose(old, damage);
+    }
+    flush_screen(damage);
+    return Result<bool, ErrorCode>::ok(true);
+  }
+
+  Result<bool, ErrorCode> handle_set_visible(uintptr_t visible) override {
+    int slot = find_app_by_pid(sender_pid());
+    if (slot < 0) {
+      return Result<bool, ErrorCode>::err(GRAPHICS__NOT_REGISTERED);
+    }
+
+    graphics::Surface &s = apps[slot].surface;
+    if (!s.pixels || s.visible == (visible != 0)) {
+      return Result<bool, ErrorCode>::ok(true);
+    }
+
+    graphics::DamageList damage;
+    s.visible = visible != 0;
+    if (s.mapped) {
+      compositor->recompose(s.rect, damage);
+    }
+    if (!s.visible && slot == active_app_index) {
+      focus_top();
+    }
+    flush_screen(damage);
+    return Result<bool, ErrorCode>::ok(true);
+  }
+
+  Result<bool, ErrorCode> handle_raise_app() override {
+    int slot = find_app_by_pid(sender_pid());
+    if (slot < 0) {
+      return Result<bool, ErrorCode>::err(GRAPHICS__NOT_REGISTERED);
+    }
+
+    graphics::DamageList damage;
+    raise_app(slot, damage);
+    flush_screen(damage);
+    return Result<bool, ErrorCode>::ok(true);
+  }
 };
 
 void proc_graphics(void) {
@@ -463,6 +761,10 @@ void proc_graphics(void) {
   GraphicsServer server;
   server.backend = &backend;
 
+  if (!server.init_compositor()) {
+    l.log("WARNING: No framebuffer to composite onto");
+  }
+
   // Initialize framework for TTF taskbar rendering
   if (!server.init_framework()) {
     l.log("WARNING: TTF fonts not available for taskbar");
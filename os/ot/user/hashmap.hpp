@@ -1,4 +1,4 @@
-// hashmap.hpp - Generic hash table with open addressing and linear probing
+// hashmap.hpp - Generic hash table with open addressing and robin hood probing
 // Uses ou_malloc/ou_free for freestanding environments
 
 #ifndef OT_USER_HASHMAP_HPP
@@ -9,45 +9,154 @@
 
 namespace ou {
 
-// djb2 hash function - simple and effective
+// FxHash-style hash: mixes a word at a time, so short keys take a few multiplies
 inline uint32_t hash_string(const char *str, size_t len) {
-  uint32_t hash = 5381;
-  for (size_t i = 0; i < len; i++) {
-    hash = ((hash << 5) + hash) + str[i]; // hash * 33 + c
+  const uint32_t K = 0x9e3779b9;
+  uint32_t hash = (uint32_t)len;
+  while (len >= 4) {
+    uint32_t word;
+    memcpy(&word, str, 4);
+    hash = (((hash << 5) | (hash >> 27)) ^ word) * K;
+    str += 4;
+    len -= 4;
   }
-  return hash;
+  if (len > 0) {
+    uint32_t word = 0;
+    memcpy(&word, str, len);
+    hash = (((hash << 5) | (hash >> 27)) ^ word) * K;
+  }
+  // The multiply leaves the low bits (used for the index) weakest; fold in the high ones
+  return hash ^ (hash >> 16);
 }
 
 inline uint32_t hash_string(const char *str) { return hash_string(str, strlen(str)); }
 
 /**
- * Generic open-addressing hash table with linear probing and dynamic growth
+ * Append-only storage for key copies. Keys never move once copied, and are
+ * all freed together when the arena is cleared or destroyed.
+ */
+class KeyArena {
+public:
+  static const size_t CHUNK_SIZE = 512;
+
+  KeyArena() : chunks_(nullptr) {}
+  ~KeyArena() { clear(); }
+  KeyArena(const KeyArena &) = delete;
+  KeyArena &operator=(const KeyArena &) = delete;
+
+  // Copy len bytes plus a NUL terminator, returning the copy
+  const char *copy(const char *key, size_t len) {
+    size_t need = len + 1;
+    if (!chunks_ || chunks_->size - chunks_->used < need) {
+      size_t size = need > CHUNK_SIZE ? need : CHUNK_SIZE;
+      Chunk *chunk = (Chunk *)ou_malloc(sizeof(Chunk) + size);
+      if (!chunk) {
+        return nullptr;
+      }
+      chunk->next = chunks_;
+      chunk->size = size;
+      chunk->used = 0;
+      chunks_ = chunk;
+    }
+    char *out = chunks_->data() + chunks_->used;
+    memcpy(out, key, len);
+    out[len] = '\0';
+    chunks_->used += need;
+    return out;
+  }
+
+  void clear() {
+    while (chunks_) {
+      Chunk *next = chunks_->next;
+      ou_free(chunks_);
+      chunks_ = next;
+    }
+  }
+
+private:
+  struct Chunk {
+    Chunk *next;
+    size_t size;
+    size_t used;
+    char *data() { return (char *)(this + 1); }
+  };
+
+  Chunk *chunks_;
+};
+
+/**
+ * Generic open-addressing hash table with robin hood probing and dynamic growth
+ *
+ * Each entry stores its key's hash and its distance from its ideal slot.
+ * Insertion displaces entries that are closer to home than the new one, which
+ * keeps probe sequences short and lets a lookup stop as soon as it passes
+ * where the key would have been. Removal shifts the following entries back
+ * instead of leaving tombstones. Keys are compared by hash and length before
+ * their bytes.
+ *
  * Template parameters:
  *   V - Value type
  *   INITIAL_CAPACITY - Initial number of slots (must be power of 2 for fast modulo)
+ *   OWN_KEYS - Copy keys into an arena owned by the map, instead of storing
+ *     the caller's pointer (which must then outlive the map)
  */
-template <typename V, size_t INITIAL_CAPACITY = 16> class StringHashMap {
+template <typename V, size_t INITIAL_CAPACITY = 16, bool OWN_KEYS = false> class StringHashMap {
 private:
   struct Entry {
-    const char *key; // Pointer to key string (not owned)
+    const char *key; // Pointer to key string (owned by the arena with OWN_KEYS)
     size_t key_len;
+    uint32_t hash;
+    uint32_t dist; // Probe distance from the ideal slot plus one; 0 = empty
     V value;
-    bool occupied;
 
-    Entry() : key(nullptr), key_len(0), value(), occupied(false) {}
+    Entry() : key(nullptr), key_len(0), hash(0), dist(0), value() {}
   };
 
   Entry *table_;
   size_t capacity_;
   size_t count_;
+  KeyArena keys_;
 
   // Ensure initial capacity is power of 2 for fast modulo
   static_assert((INITIAL_CAPACITY & (INITIAL_CAPACITY - 1)) == 0, "INITIAL_CAPACITY must be a power of 2");
 
-  size_t hash_index(const char *key, size_t len) const { return hash_string(key, len) & (capacity_ - 1); }
+  static bool matches(const Entry &e, uint32_t hash, const char *key, size_t len) {
+    return e.hash == hash && e.key_len == len && memcmp(e.key, key, len) == 0;
+  }
+
+  Entry *lookup(const char *key, size_t key_len) const {
+    if (!table_) {
+      return nullptr;
+    }
+    uint32_t hash = hash_string(key, key_len);
+    size_t mask = capacity_ - 1;
+    // Every entry of a longer chain would have displaced one that's closer to home
+    for (uint32_t dist = 1, idx = hash & mask;; dist++, idx = (idx + 1) & mask) {
+      Entry &e = table_[idx];
+      if (e.dist < dist) {
+        return nullptr;
+      } else if (matches(e, hash, key, key_len)) {
+        return &e;
+      }
+    }
+  }
 
-  bool keys_equal(const char *k1, size_t len1, const char *k2, size_t len2) const {
-    return len1 == len2 && memcmp(k1, k2, len1) == 0;
+  // Place an entry known not to be in the table
+  void place(Entry entry) {
+    size_t mask = capacity_ - 1;
+    size_t idx = entry.hash & mask;
+    entry.dist = 1;
+    while (table_[idx].dist != 0) {
+      if (table_[idx].dist < entry.dist) {
+        Entry displaced = table_[idx];
+        table_[idx] = entry;
+        entry = displaced;
+      }
+      idx = (idx + 1) & mask;
+      entry.dist++;
+    }
+    table_[idx] = entry;
+    count_++;
   }
 
   void resize(size_t new_capacity) {
@@ -70,10 +179,10 @@ private:
     capacity_ = new_capacity;
     count_ = 0;
 
-    // Reinsert all entries
+    // Reinsert all entries; the stored hashes and keys are reused
     for (size_t i = 0; i < old_capacity; i++) {
-      if (old_table[i].occupied) {
-        insert(old_table[i].key, old_table[i].key_len, old_table[i].value);
+      if (old_table[i].dist != 0) {
+        place(old_table[i]);
       }
     }
 
@@ -116,38 +225,33 @@ public:
   bool empty() const { return count_ == 0; }
 
   // Insert or update entry
-  // key must remain valid for the lifetime of the hash map (we store pointer, not copy)
+  // Without OWN_KEYS, key must remain valid for the lifetime of the hash map (we store pointer, not copy)
   bool insert(const char *key, size_t key_len, const V &value) {
-    // Check if we need to grow
-    if (count_ >= capacity_ * 3 / 4) {
-      // Grow by 2x
-      resize(capacity_ * 2);
+    Entry *existing = lookup(key, key_len);
+    if (existing) {
+      existing->value = value;
+      return true;
     }
 
-    size_t idx = hash_index(key, key_len);
-
-    // Linear probe to find empty slot or existing key
-    for (size_t i = 0; i < capacity_; i++) {
-      size_t probe_idx = (idx + i) & (capacity_ - 1);
-      Entry &e = table_[probe_idx];
-
-      if (!e.occupied) {
-        // Empty slot - insert here
-        e.key = key;
-        e.key_len = key_len;
-        e.value = value;
-        e.occupied = true;
-        count_++;
-        return true;
-      } else if (keys_equal(e.key, e.key_len, key, key_len)) {
-        // Key exists - update value
-        e.value = value;
-        return true;
+    // Check if we need to grow; robin hood probing stays short up to 7/8 full
+    if (!table_ || count_ >= capacity_ - capacity_ / 8) {
+      // Grow by 2x
+      resize(capacity_ * 2);
+      if (!table_ || count_ >= capacity_ - 1) {
+        return false;
       }
     }
 
-    // Table full (shouldn't happen after resize)
-    return false;
+    Entry e;
+    e.key = OWN_KEYS ? keys_.copy(key, key_len) : key;
+    if (!e.key) {
+      return false;
+    }
+    e.key_len = key_len;
+    e.hash = hash_string(key, key_len);
+    e.value = value;
+    place(e);
+    return true;
   }
 
   bool insert(const string &key, const V &value) { return insert(key.c_str(), key.length(), value); }
@@ -156,28 +260,8 @@ public:
 
   // Lookup entry
   V *find(const char *key, size_t key_len) {
-    if (!table_) {
-      return nullptr;
-    }
-
-    size_t idx = hash_index(key, key_len);
-
-    // Linear probe
-    for (size_t i = 0; i < capacity_; i++) {
-      size_t probe_idx = (idx + i) & (capacity_ - 1);
-      Entry &e = table_[probe_idx];
-
-      if (!e.occupied) {
-        // Hit empty slot - key not found
-        return nullptr;
-      } else if (keys_equal(e.key, e.key_len, key, key_len)) {
-        // Found it
-        return &e.value;
-      }
-    }
-
-    // Probed entire table - not found
-    return nullptr;
+    Entry *e = lookup(key, key_len);
+    return e ? &e->value : nullptr;
   }
 
   const V *find(const char *key, size_t key_len) const {
@@ -192,41 +276,45 @@ public:
 
   const V *find(const char *key) const { return find(key, strlen(key)); }
 
-  // Remove entry (optional - not needed for command lookup)
+  // The map's own pointer to a key, e.g. the arena copy with OWN_KEYS; nullptr if absent
+  const char *stored_key(const char *key, size_t key_len) const {
+    Entry *e = lookup(key, key_len);
+    return e ? e->key : nullptr;
+  }
+
+  // Remove entry. An owned key's bytes stay in the arena until clear().
   bool remove(const char *key, size_t key_len) {
-    if (!table_) {
+    Entry *e = lookup(key, key_len);
+    if (!e) {
       return false;
     }
 
-    size_t idx = hash_index(key, key_len);
-
-    for (size_t i = 0; i < capacity_; i++) {
-      size_t probe_idx = (idx + i) & (capacity_ - 1);
-      Entry &e = table_[probe_idx];
-
-      if (!e.occupied) {
-        return false; // Not found
-      } else if (keys_equal(e.key, e.key_len, key, key_len)) {
-        // Found - mark as unoccupied
-        // NOTE: This creates tombstones and can degrade performance
-        // For production use, consider rehashing or using a different deletion strategy
-        e.occupied = false;
-        count_--;
-        return true;
-      }
+    // Shift the rest of the chain back one slot, so no tombstone is needed
+    size_t mask = capacity_ - 1;
+    size_t idx = e - table_;
+    size_t next = (idx + 1) & mask;
+    while (table_[next].dist > 1) {
+      table_[idx] = table_[next];
+      table_[idx].dist--;
+      idx = next;
+      next = (next + 1) & mask;
     }
-
-    return false;
+    table_[idx] = Entry();
+    count_--;
+    return true;
   }
 
+  bool remove(const char *key) { return remove(key, strlen(key)); }
+
   void clear() {
     if (!table_) {
       return;
     }
     for (size_t i = 0; i < capacity_; i++) {
-      table_[i].occupied = false;
+      table_[i] = Entry();
     }
     count_ = 0;
+    keys_.clear();
   }
 };
 
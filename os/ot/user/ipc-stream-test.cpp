@@ -0,0 +1,50 @@
+#include "vendor/doctest.h"
+#include "ot/user/ipc-stream.hpp"
+#include <string.h>
+
+TEST_CASE("ipc-stream - writer fills one page and tracks the cursor") {
+  static char page[IPC_STREAM_CHUNK];
+  static char file[IPC_STREAM_CHUNK + 100];
+  for (size_t i = 0; i < sizeof(file); i++) {
+    file[i] = (char)i;
+  }
+
+  // First request starts at 0 and can only take a page
+  StreamWriter first(page, 0);
+  CHECK(first.write(file, sizeof(file)) == IPC_STREAM_CHUNK);
+  CHECK(first.space() == 0);
+  CHECK(first.write(file, 1) == 0);
+  CHECK_FALSE(first.ended());
+
+  intptr_t values[3];
+  first.fill_response(values);
+  CHECK(values[0] == (intptr_t)IPC_STREAM_CHUNK);
+  CHECK(values[1] == (intptr_t)IPC_STREAM_CHUNK);
+  CHECK(values[2] == 0);
+
+  // Second request resumes at the returned cursor
+  StreamWriter second(page, values[1]);
+  size_t rest = sizeof(file) - second.cursor();
+  memcpy(second.buffer(), file + second.cursor(), rest);
+  second.commit(rest);
+  second.end();
+  second.fill_response(values);
+  CHECK(values[0] == 100);
+  CHECK(values[1] == (intptr_t)sizeof(file));
+  CHECK(values[2] == 1);
+  CHECK(memcmp(page, file + IPC_STREAM_CHUNK, 100) == 0);
+}
+
+TEST_CASE("ipc-stream - chunk clamps its length to the page") {
+  static char page[IPC_STREAM_CHUNK];
+
+  StreamChunk middle(page, 4096, 4096, IPC_FLAG_SEND_COMM_DATA);
+  CHECK(middle.offset == 4096);
+  CHECK(middle.data.len == 4096);
+  CHECK_FALSE(middle.last);
+
+  // A bogus length from the client can't reach past the comm page
+  StreamChunk last(page, 8192, 100000, IPC_FLAG_SEND_COMM_DATA | IPC_FLAG_STREAM_END);
+  CHECK(last.data.len == IPC_STREAM_CHUNK);
+  CHECK(last.last);
+}
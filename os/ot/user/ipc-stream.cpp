@@ -0,0 +1,76 @@
+// ipc-stream.cpp - Client side of stream-typed IPC arguments
+#include "ot/user/ipc-stream.hpp"
+#include "ot/user/user.hpp"
+
+StreamReader::StreamReader(Pid pid, intptr_t method, int nargs, intptr_t arg0, intptr_t arg1)
+    : pid_(pid), method_(method), cursor_slot_(nargs), done_(false), error_(NONE), total_(0) {
+  args_[0] = arg0;
+  args_[1] = arg1;
+  args_[2] = 0;
+  args_[cursor_slot_] = 0;
+}
+
+bool StreamReader::next(StringView &chunk) {
+  if (done_) {
+    return false;
+  }
+
+  IpcResponse resp = ou_ipc_send(pid_, IPC_FLAG_RECV_COMM_DATA, method_, args_[0], args_[1], args_[2]);
+  if (resp.error_code != NONE) {
+    error_ = resp.error_code;
+    done_ = true;
+    return false;
+  }
+
+  size_t size = resp.values[0];
+  if (size > IPC_STREAM_CHUNK) {
+    error_ = IPC__INVALID_ARGS;
+    done_ = true;
+    return false;
+  }
+  args_[cursor_slot_] = resp.values[1];
+  done_ = resp.values[2] != 0;
+  total_ += size;
+
+  // A server that has nothing left may end with an empty chunk
+  if (size == 0) {
+    done_ = true;
+    return false;
+  }
+  chunk = StringView(ou_get_comm_page().as<char>(), size);
+  return true;
+}
+
+ErrorCode StreamReader::read_all(ou::string &out) {
+  StringView chunk;
+  while (next(chunk)) {
+    out.append(chunk.ptr, chunk.len);
+  }
+  return error_;
+}
+
+Result<uintptr_t, ErrorCode> ipc_stream_upload(Pid pid, intptr_t method, const StringView &data, int nargs,
+                                               intptr_t arg0) {
+  char *page = ou_get_comm_page().as<char>();
+  uintptr_t offset = 0;
+  // Always send at least one chunk, so the server sees the end of an empty stream
+  do {
+    size_t len = data.len - offset;
+    uintptr_t flags = IPC_FLAG_SEND_COMM_DATA;
+    if (len > IPC_STREAM_CHUNK) {
+      len = IPC_STREAM_CHUNK;
+    } else {
+      flags |= IPC_FLAG_STREAM_END;
+    }
+    memcpy(page, data.ptr + offset, len);
+
+    IpcResponse resp = nargs == 0 ? ou_ipc_send(pid, flags, method, offset, len, 0)
+                                  : ou_ipc_send(pid, flags, method, arg0, offset, len);
+    if (resp.error_code != NONE) {
+      return Result<uintptr_t, ErrorCode>::err(resp.error_code);
+    }
+    offset += len;
+  } while (offset < data.len);
+
+  return Result<uintptr_t, ErrorCode>::ok(offset);
+}
@@ -0,0 +1,130 @@
+// ipc-stream.hpp - Transfers larger than the comm page, for stream-typed IPC arguments
+#ifndef OT_USER_IPC_STREAM_HPP
+#define OT_USER_IPC_STREAM_HPP
+
+#include "ot/common.h"
+#include "ot/lib/error-codes.hpp"
+#include "ot/lib/ipc.hpp"
+#include "ot/lib/result.hpp"
+#include "ot/lib/string-view.hpp"
+#include "ot/user/string.hpp"
+
+/**
+ * A method with a `stream` argument in services.yaml moves any amount of data
+ * in one logical call. Underneath, each round trip carries one comm page of
+ * raw bytes (no msgpack framing) plus a cursor, and the caller drives: the
+ * next chunk is only requested or sent when the previous one has been
+ * handled, which is all the flow control a synchronous IPC needs.
+ *
+ * Downloads (direction: download) go server to client. The client gets a
+ * StreamReader and pulls chunks with next(); each call is one request, whose
+ * inline arguments are the method's own followed by the cursor. The server
+ * handler fills a StreamWriter per request, starting from that cursor, and
+ * calls end() once it has written the last byte.
+ *
+ * Uploads (direction: upload) go client to server. The client passes a view
+ * of the data; each request carries the method's arguments, the chunk's
+ * offset and its length, with IPC_FLAG_STREAM_END on the last one. The server
+ * handler is called once per chunk with a StreamChunk.
+ */
+
+/** Bytes carried per round trip */
+static const size_t IPC_STREAM_CHUNK = OT_PAGE_SIZE;
+
+/** Server side of a download: one comm page of the stream */
+class StreamWriter {
+public:
+  StreamWriter(char *page, uintptr_t cursor) : page_(page), size_(0), cursor_(cursor), ended_(false) {}
+
+  /** Position in the stream; starts where the client left off and advances with every byte written */
+  uintptr_t cursor() const { return cursor_; }
+  /** Override the cursor, for streams whose position isn't a byte offset (e.g. a directory index) */
+  void set_cursor(uintptr_t cursor) { cursor_ = cursor; }
+
+  /** Copy as much of data as fits in this chunk, returning the number of bytes taken */
+  size_t write(const void *data, size_t len) {
+    if (len > space()) {
+      len = space();
+    }
+    memcpy(page_ + size_, data, len);
+    commit(len);
+    return len;
+  }
+
+  /** Fill the chunk in place: write up to space() bytes at buffer(), then commit() them */
+  char *buffer() { return page_ + size_; }
+  size_t space() const { return IPC_STREAM_CHUNK - size_; }
+  void commit(size_t len) {
+    size_ += len;
+    cursor_ += len;
+  }
+
+  /** Mark this chunk as the last one */
+  void end() { ended_ = true; }
+  bool ended() const { return ended_; }
+  size_t size() const { return size_; }
+
+  /** Response values for the client: chunk size, next cursor, end flag */
+  void fill_response(intptr_t *values) const {
+    values[0] = size_;
+    values[1] = cursor_;
+    values[2] = ended_;
+  }
+
+private:
+  char *page_;
+  size_t size_;
+  uintptr_t cursor_;
+  bool ended_;
+};
+
+/** Server side of an upload: the chunk carried by one request */
+struct StreamChunk {
+  StringView data;
+  uintptr_t offset; // Position of data in the stream
+  bool last;        // No more chunks follow
+
+  StreamChunk(const char *page, uintptr_t offset, uintptr_t len, uintptr_t flags)
+      : data(page, len <= IPC_STREAM_CHUNK ? len : IPC_STREAM_CHUNK), offset(offset),
+        last((flags & IPC_FLAG_STREAM_END) != 0) {}
+};
+
+/**
+ * Client side of a download. Each next() is one round trip, so the consumer
+ * sets the pace and can stop at any point; chunks are views of the comm page
+ * and are only valid until the next IPC call.
+ */
+class StreamReader {
+public:
+  /** nargs of the method's own inline arguments (at most 2) precede the cursor */
+  StreamReader(Pid pid, intptr_t method, int nargs, intptr_t arg0 = 0, intptr_t arg1 = 0);
+
+  /** Fetch the next chunk. Returns false at the end of the stream or on error. */
+  bool next(StringView &chunk);
+
+  /** Append the rest of the stream to out */
+  ErrorCode read_all(ou::string &out);
+
+  ErrorCode error() const { return error_; }
+  /** Bytes received so far */
+  uintptr_t total() const { return total_; }
+
+private:
+  Pid pid_;
+  intptr_t method_;
+  intptr_t args_[3];
+  int cursor_slot_;
+  bool done_;
+  ErrorCode error_;
+  uintptr_t total_;
+};
+
+/**
+ * Client side of an upload: send data in comm-page chunks, with nargs (at
+ * most 1) of the method's own inline arguments ahead of offset and length.
+ * Returns the number of bytes sent.
+ */
+Result<uintptr_t, ErrorCode> ipc_stream_upload(Pid pid, intptr_t method, const StringView &data, int nargs,
+                                               intptr_t arg0 = 0);
+
+#endif
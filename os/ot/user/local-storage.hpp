@@ -5,7 +5,7 @@
 #define OT_USER_LOCAL_STORAGE_HPP
 
 #include "ot/common.h"
-#include "ot/vendor/tlsf/tlsf.h"
+#include "ot/user/slab.hpp"
 
 /**
  * Base structure for per-process local storage.
@@ -13,12 +13,12 @@
  */
 struct LocalStorage {
   char *memory_begin;
-  tlsf_t pool;
+  ou::SlabAllocator allocator;
   size_t memory_pages_allocated;
 
   /**
    * Initialize the memory allocator for this process.
-   * Allocates the specified number of pages and sets up TLSF pool.
+   * Allocates the specified number of pages and sets up the slab caches and TLSF pool.
    * This must be called before using ou_malloc/ou_free/ou_realloc.
    *
    * @param pages Number of pages to allocate for the memory pool (default 10)
@@ -33,4 +33,7 @@ struct LocalStorage {
  */
 extern LocalStorage *local_storage;
 
+/** Allocation statistics for the current process */
+void ou_alloc_stats(ou::AllocStats *out);
+
 #endif
@@ -1,9 +1,8 @@
 // memory-allocator.cpp - Memory allocation functions for user programs
-// Uses TLSF allocator with per-process local storage
+// Uses slab caches in front of a TLSF allocator, with per-process local storage
 
 #include "ot/user/local-storage.hpp"
 #include "ot/user/user.hpp"
-#include "ot/vendor/tlsf/tlsf.h"
 
 // Global pointer to current process's local storage (updated by kernel on context switch)
 LocalStorage *local_storage = nullptr;
@@ -25,8 +24,7 @@ void LocalStorage::process_storage_init(size_t pages) {
           pages, memory_begin, memory_begin + pages * OT_PAGE_SIZE);
 
   // Create TLSF pool from the contiguous memory region
-  pool = tlsf_create_with_pool(memory_begin, pages * OT_PAGE_SIZE);
-  if (!pool) {
+  if (!allocator.init(memory_begin, pages * OT_PAGE_SIZE)) {
     oprintf("FATAL: failed to create TLSF memory pool\n");
     ou_exit();
   }
@@ -39,12 +37,12 @@ extern "C" void *ou_malloc(size_t size) {
     oprintf("FATAL: ou_malloc called before local_storage initialized\n");
     ou_exit();
   }
-  if (!local_storage->pool) {
+  if (!local_storage->allocator.initialized()) {
     oprintf("FATAL: ou_malloc called before pool initialized (size=%d)\n", size);
     oprintf("       Did you forget to call process_storage_init()?\n");
     ou_exit();
   }
-  void *result = tlsf_malloc(local_storage->pool, size);
+  void *result = local_storage->allocator.malloc(size);
   if (!result && size > 0) {
     oprintf("FATAL: ou_malloc failed - out of memory (requested=%d)\n", size);
     ou_exit();
@@ -57,11 +55,11 @@ extern "C" void ou_free(void *ptr) {
     oprintf("WARNING: ou_free called before local_storage initialized\n");
     return;
   }
-  if (!local_storage->pool) {
+  if (!local_storage->allocator.initialized()) {
     oprintf("WARNING: ou_free called before pool initialized\n");
     return;
   }
-  tlsf_free(local_storage->pool, ptr);
+  local_storage->allocator.free(ptr);
 }
 
 extern "C" void *ou_realloc(void *ptr, size_t size) {
@@ -69,14 +67,22 @@ extern "C" void *ou_realloc(void *ptr, size_t size) {
     oprintf("FATAL: ou_realloc called before local_storage initialized\n");
     ou_exit();
   }
-  if (!local_storage->pool) {
+  if (!local_storage->allocator.initialized()) {
     oprintf("FATAL: ou_realloc called before pool initialized\n");
     ou_exit();
   }
-  void *result = tlsf_realloc(local_storage->pool, ptr, size);
+  void *result = local_storage->allocator.realloc(ptr, size);
   if (!result && size > 0) {
     oprintf("FATAL: ou_realloc failed - out of memory (requested=%d)\n", size);
     ou_exit();
   }
   return result;
 }
+
+void ou_alloc_stats(ou::AllocStats *out) {
+  if (!local_storage) {
+    memset(out, 0, sizeof(*out));
+    return;
+  }
+  local_storage->allocator.stats(out);
+}
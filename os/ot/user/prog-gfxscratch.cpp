@@ -13,6 +13,8 @@
 #include "ot/user/prog.h"
 #include "ot/user/user.hpp"
 
+#include "ot/lib/frame-manager.hpp"
+
 #if USE_APP_FRAMEWORK
 #include "ot/lib/app-framework.hpp"
 #endif
@@ -91,6 +93,8 @@ void gfxscratch_main() {
 
   oprintf("GFXSCRATCH: Running main loop\n");
 
+  graphics::FrameManager fm(30);
+
   while (s->running) {
     // oprintf("GFXSCRATCH: gfx_client at %p with pid %lu (frame %d)\n", &gfx_client, gfx_client.pid_.raw(),
     //  s->frame_count);
@@ -101,7 +105,7 @@ void gfxscratch_main() {
       ou_exit();
     }
 
-    if (should.value()) {
+    if (should.value() && fm.begin_frame()) {
 #if USE_APP_FRAMEWORK
       // Use Framework to clear
       gfx.clear(0xFF002200 | ((s->frame_count * 4) & 0xFF));
@@ -117,6 +121,7 @@ void gfxscratch_main() {
 #endif
 
       gfx_client.flush();
+      fm.end_frame();
       s->frame_count++;
 
 #if EXIT_AFTER_10_FRAMES
@@ -127,7 +132,8 @@ void gfxscratch_main() {
 #endif
     }
 
-    ou_yield();
+    // Let other processes run until the next frame is due
+    fm.wait();
   }
 
   // Unregister before exit
@@ -0,0 +1,366 @@
+// prog-ipc-bench.cpp - Microbenchmarks for IPC and the services built on it
+//
+// Each case repeats one operation, times every sample with o_cycles_get and
+// prints one line:
+//
+//   BENCH: <case> <median> <min> <unit>/op
+//
+// bench-ipc.py collects these lines and compares them against a saved
+// baseline. Under the OS the raw IPC cases talk to a second copy of this
+// program ("ipc-bench serve"); the filesystem and graphics cases use whichever
+// servers are running and are skipped otherwise. The POSIX build has no
+// kernel, so it runs the mpack cases only.
+//
+// Usage: ipc-bench [samples] [--shutdown]
+//   --shutdown  stop the filesystem and graphics servers when done, so the
+//               kernel exits (used by the bench_ipc kernel program)
+#include "ot/lib/mpack/mpack-direct.hpp"
+#include "ot/lib/mpack/mpack-reader.hpp"
+#include "ot/lib/mpack/mpack-writer.hpp"
+#include <stdio.h>
+#include <string.h>
+
+#ifndef OT_POSIX
+#include "ot/lib/rect.hpp"
+#include "ot/user/fs/types.hpp"
+#include "ot/user/gen/filesystem-client.hpp"
+#include "ot/user/gen/graphics-client.hpp"
+#include "ot/user/local-storage.hpp"
+#include "ot/user/prog.h"
+#include "ot/user/user.hpp"
+#else
+#include <stdlib.h>
+#endif
+
+static const size_t MAX_SAMPLES = 512;
+static const size_t DEFAULT_SAMPLES = 200;
+
+/**
+ * Time samples runs of batch calls to fn, which returns false on failure.
+ * Per-sample deltas stay in 32 bits so rv32 needs no 64-bit division.
+ */
+template <typename Fn> static void bench_case(const char *name, size_t samples, size_t batch, Fn fn) {
+  static uint32_t times[MAX_SAMPLES];
+  if (samples > MAX_SAMPLES) {
+    samples = MAX_SAMPLES;
+  }
+
+  // Warm up caches and any lazily created server state
+  if (!fn()) {
+    oprintf("BENCH: %s failed\n", name);
+    return;
+  }
+
+  for (size_t i = 0; i < samples; i++) {
+    uint64_t start = o_cycles_get();
+    for (size_t j = 0; j < batch; j++) {
+      if (!fn()) {
+        oprintf("BENCH: %s failed\n", name);
+        return;
+      }
+    }
+    times[i] = (uint32_t)(o_cycles_get() - start) / (uint32_t)batch;
+  }
+
+  // Insertion sort; samples is small
+  for (size_t i = 1; i < samples; i++) {
+    uint32_t t = times[i];
+    size_t j = i;
+    for (; j > 0 && times[j - 1] > t; j--) {
+      times[j] = times[j - 1];
+    }
+    times[j] = t;
+  }
+
+  oprintf("BENCH: %-32s %10lu %10lu %s/op\n", name, (unsigned long)times[samples / 2], (unsigned long)times[0],
+          O_CYCLES_UNIT);
+}
+
+static void bench_skip(const char *name, const char *why) { oprintf("BENCH: %s skipped (%s)\n", name, why); }
+
+//
+// mpack: a list_dir reply, the largest payload the shell decodes routinely
+//
+
+static const uint32_t LISTING_ENTRIES = 64;
+static char listing_page[OT_PAGE_SIZE];
+static char encode_page[OT_PAGE_SIZE];
+static volatile size_t sink;
+
+static const char *listing_name(uint32_t i) {
+  static char names[LISTING_ENTRIES][16];
+  static bool filled = false;
+  if (!filled) {
+    for (uint32_t n = 0; n < LISTING_ENTRIES; n++) {
+      snprintf(names[n], sizeof(names[n]), n % 4 == 0 ? "dir-%u/" : "file-%03u.txt", (unsigned)n);
+    }
+    filled = true;
+  }
+  return names[i];
+}
+
+template <typename Writer> static bool encode_listing() {
+  Writer writer(encode_page, sizeof(encode_page));
+  writer.array(LISTING_ENTRIES);
+  for (uint32_t i = 0; i < LISTING_ENTRIES; i++) {
+    writer.str(listing_name(i));
+  }
+  sink = sink + writer.size();
+  return writer.ok();
+}
+
+template <typename Reader> static bool decode_listing() {
+  Reader reader(listing_page, sizeof(listing_page));
+  uint32_t count = 0;
+  if (!reader.enter_array(count)) {
+    return false;
+  }
+  size_t total = 0;
+  for (uint32_t i = 0; i < count; i++) {
+    StringView name;
+    if (!reader.read_string(name)) {
+      return false;
+    }
+    total += name.len;
+  }
+  sink = sink + total;
+  return true;
+}
+
+static void bench_mpack(size_t samples) {
+  MPackWriter listing(listing_page, sizeof(listing_page));
+  listing.array(LISTING_ENTRIES);
+  for (uint32_t i = 0; i < LISTING_ENTRIES; i++) {
+    listing.str(listing_name(i));
+  }
+
+  bench_case("mpack encode (writer)", samples, 16, encode_listing<MPackWriter>);
+  bench_case("mpack encode (direct)", samples, 16, encode_listing<MPackDirectWriter>);
+  bench_case("mpack decode (reader)", samples, 16, decode_listing<MPackReader>);
+  bench_case("mpack decode (direct)", samples, 16, decode_listing<MPackDirectReader>);
+}
+
+#ifdef OT_POSIX
+
+int main(int argc, char **argv) {
+  int requested = argc > 1 ? atoi(argv[1]) : (int)DEFAULT_SAMPLES;
+  // bench_case needs at least one sample to report
+  size_t samples = requested > 0 ? (size_t)requested : 1;
+  oprintf("BENCH: start posix %u samples\n", (unsigned)samples);
+  bench_mpack(samples);
+  bench_skip("ipc", "no kernel on POSIX");
+  oprintf("BENCH: done\n");
+  return 0;
+}
+
+#else
+
+//
+// Raw IPC against a peer that does nothing else. Method IDs are private to
+// the peer.
+//
+
+static const intptr_t BENCH_NULL = 0x1000;   // Reply immediately
+static const intptr_t BENCH_SINK = 0x1100;   // Read args[0] bytes of the comm page
+static const intptr_t BENCH_SOURCE = 0x1200; // Write args[0] bytes to the comm page
+
+static void bench_serve() {
+  char *page = ou_get_comm_page().as<char>();
+  while (true) {
+    IpcMessage msg = ou_ipc_recv();
+    intptr_t method = IPC_UNPACK_METHOD(msg.method_and_flags);
+    size_t len = (size_t)msg.args[0] < OT_PAGE_SIZE ? (size_t)msg.args[0] : OT_PAGE_SIZE;
+    IpcResponse resp = {NONE, {0, 0, 0}};
+
+    switch (method) {
+    case BENCH_NULL:
+      break;
+    case BENCH_SINK: {
+      // Touch every byte, as a real server would when parsing
+      uint32_t sum = 0;
+      for (size_t i = 0; i < len; i++) {
+        sum += (uint8_t)page[i];
+      }
+      resp.values[0] = sum;
+      break;
+    }
+    case BENCH_SOURCE:
+      memset(page, 0x5a, len);
+      break;
+    case IPC_METHOD_SHUTDOWN:
+      ou_ipc_reply(resp);
+      ou_exit();
+      break;
+    default:
+      resp.error_code = IPC__METHOD_NOT_KNOWN;
+      break;
+    }
+    ou_ipc_reply(resp);
+  }
+}
+
+static void bench_ipc(size_t samples) {
+  char *serve_argv[] = {(char *)"ipc-bench", (char *)"serve"};
+  Pid peer = ou_proc_spawn("ipc-bench", 2, serve_argv);
+  if (peer == PID_NONE) {
+    bench_skip("ipc", "could not spawn peer");
+    return;
+  }
+
+  char *page = ou_get_comm_page().as<char>();
+  static char payload[OT_PAGE_SIZE];
+  memset(payload, 0xa5, sizeof(payload));
+
+  bench_case("ipc null round trip", samples, 8,
+             [&] { return ou_ipc_send(peer, IPC_FLAG_NONE, BENCH_NULL, 0, 0, 0).error_code == NONE; });
+
+  static const size_t sizes[] = {64, 1024, 4096};
+  static const char *send_names[] = {"ipc comm send 64B", "ipc comm send 1KiB", "ipc comm send 4KiB"};
+  static const char *recv_names[] = {"ipc comm recv 64B", "ipc comm recv 1KiB", "ipc comm recv 4KiB"};
+  for (size_t i = 0; i < 3; i++) {
+    size_t len = sizes[i];
+    bench_case(send_names[i], samples, 4, [&] {
+      memcpy(page, payload, len);
+      return ou_ipc_send(peer, IPC_FLAG_SEND_COMM_DATA, BENCH_SINK, len, 0, 0).error_code == NONE;
+    });
+    bench_case(recv_names[i], samples, 4, [&] {
+      if (ou_ipc_send(peer, IPC_FLAG_RECV_COMM_DATA, BENCH_SOURCE, len, 0, 0).error_code != NONE) {
+        return false;
+      }
+      memcpy(payload, page, len);
+      return true;
+    });
+  }
+
+  ou_ipc_send(peer, IPC_FLAG_NONE, IPC_METHOD_SHUTDOWN, 0, 0, 0);
+}
+
+//
+// Filesystem: the calls behind every File::read_all
+//
+
+static void bench_filesystem(size_t samples, bool shutdown) {
+  Pid fs_pid = ou_proc_lookup("filesystem");
+  if (fs_pid == PID_NONE) {
+    bench_skip("fs", "no filesystem server");
+    return;
+  }
+
+  FilesystemClient client(fs_pid);
+  ou::string path("/ipc-bench.dat");
+  static char contents[4 * OT_PAGE_SIZE];
+  memset(contents, 'b', sizeof(contents));
+
+  auto created = client.open(path, filesystem::OPEN_CREATE | filesystem::OPEN_WRITE | filesystem::OPEN_TRUNCATE);
+  if (created.is_err()) {
+    bench_skip("fs", error_code_to_string(created.error()));
+    return;
+  }
+  bool written = client.write_stream(created.value(), StringView(contents, sizeof(contents))).is_ok();
+  client.close(created.value());
+  if (!written) {
+    bench_skip("fs", "could not write test file");
+    return;
+  }
+
+  bench_case("fs open+read 1KiB+close", samples, 1, [&] {
+    auto opened = client.open(path, filesystem::OPEN_READ);
+    if (opened.is_err()) {
+      return false;
+    }
+    bool ok = client.read(opened.value(), 0, 1024).is_ok();
+    return client.close(opened.value()).is_ok() && ok;
+  });
+
+  bench_case("fs open+read_stream 16KiB+close", samples, 1, [&] {
+    auto opened = client.open(path, filesystem::OPEN_READ);
+    if (opened.is_err()) {
+      return false;
+    }
+    StreamReader reader = client.read_stream(opened.value());
+    StringView chunk;
+    while (reader.next(chunk)) {
+      sink = sink + chunk.len;
+    }
+    bool ok = reader.error() == NONE && reader.total() == sizeof(contents);
+    return client.close(opened.value()).is_ok() && ok;
+  });
+
+  client.delete_file(path);
+  if (shutdown) {
+    client.shutdown();
+  }
+}
+
+//
+// Graphics: full-screen flush against a small damaged rect
+//
+
+static void bench_graphics(size_t samples, bool shutdown) {
+  Pid gfx_pid = ou_proc_lookup("graphics");
+  if (gfx_pid == PID_NONE) {
+    bench_skip("gfx", "no graphics server");
+    return;
+  }
+
+  GraphicsClient client(gfx_pid);
+  graphics::Rect small(0, 0, 16, 16);
+  bench_case("gfx flush", samples, 1, [&] { return client.flush().is_ok(); });
+  bench_case("gfx flush_rect 16x16", samples, 1,
+             [&] { return client.flush_rect(small.packed_origin(), small.packed_extent()).is_ok(); });
+
+  if (shutdown) {
+    client.shutdown();
+  }
+}
+
+struct IpcBenchStorage : public LocalStorage {
+  IpcBenchStorage() { process_storage_init(10); }
+};
+
+void ipcbench_main() {
+  PageAddr arg_page = ou_get_arg_page();
+  MPackReader reader(arg_page.as<char>(), OT_PAGE_SIZE);
+  StringView argv[8];
+  size_t argc = 0;
+  if (!reader.read_args_map(argv, 8, argc)) {
+    argc = 0;
+  }
+
+  size_t samples = DEFAULT_SAMPLES;
+  bool shutdown = false;
+  for (size_t i = 1; i < argc; i++) {
+    if (argv[i].equals("serve")) {
+      bench_serve();
+      return;
+    } else if (argv[i].equals("--shutdown")) {
+      shutdown = true;
+    } else if (argv[i].len > 0 && argv[i].ptr[0] >= '0' && argv[i].ptr[0] <= '9') {
+      samples = 0;
+      for (size_t j = 0; j < argv[i].len && argv[i].ptr[j] >= '0' && argv[i].ptr[j] <= '9'; j++) {
+        samples = samples * 10 + (argv[i].ptr[j] - '0');
+      }
+      // bench_case needs at least one sample to report
+      if (samples == 0) {
+        samples = 1;
+      }
+    }
+  }
+
+  void *storage_page = ou_get_storage().as_ptr();
+  new (storage_page) IpcBenchStorage();
+
+#ifdef OT_ARCH_RISCV
+  oprintf("BENCH: start riscv %u samples\n", (unsigned)samples);
+#else
+  oprintf("BENCH: start wasm %u samples\n", (unsigned)samples);
+#endif
+
+  bench_ipc(samples);
+  bench_mpack(samples);
+  bench_filesystem(samples, shutdown);
+  bench_graphics(samples, shutdown);
+  oprintf("BENCH: done\n");
+}
+
+#endif
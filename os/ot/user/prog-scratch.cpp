@@ -89,7 +89,7 @@ void scratch_main() {
     // Check if we should render (are we the active app?)
     auto should = client.should_render();
     if (should.is_err() || should.value() == 0) {
-      ou_yield();
+      fm.wait();
       continue;
     }
 
@@ -119,8 +119,8 @@ void scratch_main() {
       frames_rendered++;
     }
 
-    // Always yield to cooperate with other processes
-    ou_yield();
+    // Let other processes run until the next frame is due
+    fm.wait();
   }
 
   // Unregister before exit
@@ -1,5 +1,6 @@
 // prog-spacedemo.cpp - DOS Space Demo port
 #include "ot/lib/app-framework.hpp"
+#include "ot/lib/compositor.hpp"
 #include "ot/lib/frame-manager.hpp"
 #include "ot/lib/keyboard-utils.hpp"
 #include "ot/lib/math.hpp"
@@ -490,30 +491,33 @@ void spacedemo_main() {
 
   bool running = true;
   while (running) {
-    // Check if we should render (are we the active app?)
+    // Check if we should render (is any of our surface on screen?)
     auto should = client.should_render();
     if (should.is_err() || should.value() == 0) {
-      // Not active, just yield
-      ou_yield();
+      // Not visible, just wait
+      fm.wait();
       continue;
     }
 
     if (fm.begin_frame()) {
-      // Poll keyboard
-      auto key_result = s->kbdc.poll_key();
-      if (key_result.is_ok()) {
-        auto key_data = key_result.value();
-        if (key_data.has_key) {
-          // Pass key to graphics server for global hotkeys (Alt+1-9 app switching)
-          gfx.pass_key_to_server(client, key_data.code, key_data.flags);
-
-          // Check for Alt+Q to quit
-          if ((key_data.flags & KEY_FLAG_ALT) && (key_data.code == KEY_Q)) {
-            oprintf("SPACEDEMO: Alt+Q pressed, exiting\n");
-            running = false;
+      // Poll keyboard while focused
+      if (should.value() & graphics::RENDER_FOCUSED) {
+        auto key_result = s->kbdc.poll_key();
+        if (key_result.is_ok()) {
+          auto key_data = key_result.value();
+          if (key_data.has_key) {
+            // Pass key to graphics server for global hotkeys (Alt+1-9 app switching)
+            gfx.pass_key_to_server(client, key_data.code, key_data.flags);
+
+            // Check for Alt+Q to quit
+            if ((key_data.flags & KEY_FLAG_ALT) && (key_data.code == KEY_Q)) {
+              oprintf("SPACEDEMO: Alt+Q pressed, exiting\n");
+              running = false;
+            }
           }
         }
       }
+
       // Clear entire screen to black
       gfx.clear(COLOR_BLACK);
 
@@ -544,8 +548,8 @@ void spacedemo_main() {
       }
     }
 
-    // Always yield to cooperate with other processes
-    ou_yield();
+    // Let other processes run until the next frame is due
+    fm.wait();
   }
 
   // Unregister before exit
@@ -1,5 +1,6 @@
 // prog-typedemo.cpp - Keyboard typing demo
 #include "ot/lib/app-framework.hpp"
+#include "ot/lib/compositor.hpp"
 #include "ot/lib/frame-manager.hpp"
 #include "ot/lib/keyboard-utils.hpp"
 #include "ot/user/gen/graphics-client.hpp"
@@ -128,21 +129,23 @@ void typedemo_main() {
           "5s idle clears)\n");
 
   while (true) {
-    // Check if we should render (are we the active app?)
+    // Check if we should render (is any of our surface on screen?)
     auto should = gfx_client.should_render();
     if (should.is_err() || should.value() == 0) {
-      // Not active, just yield
-      ou_yield();
+      // Not visible, just wait
+      fm.wait();
       continue;
     }
 
     if (fm.begin_frame()) {
-      // Poll for keyboard events
-      auto key_result = kbd_client.poll_key();
-      if (key_result.is_ok()) {
-        auto key_data = key_result.value();
-        if (key_data.has_key) {
-          handle_key_event(key_data.code, key_data.flags);
+      // Poll for keyboard events while focused
+      if (should.value() & graphics::RENDER_FOCUSED) {
+        auto key_result = kbd_client.poll_key();
+        if (key_result.is_ok()) {
+          auto key_data = key_result.value();
+          if (key_data.has_key) {
+            handle_key_event(key_data.code, key_data.flags);
+          }
         }
       }
 
@@ -200,8 +203,8 @@ void typedemo_main() {
       fm.end_frame();
     }
 
-    // Always yield to cooperate with other processes
-    ou_yield();
+    // Let other processes run until the next frame is due
+    fm.wait();
   }
 
   ou_exit();
@@ -14,6 +14,7 @@ void typedemo_main();
 void echo_main();
 void gfxscratch_main();
 void edit_main();
+void ipcbench_main();
 
 #ifdef __cplusplus
 }
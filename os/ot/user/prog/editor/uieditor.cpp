@@ -1,5 +1,6 @@
 // uieditor.cpp - Graphical text editor for the OS
 #include "ot/lib/app-framework.hpp"
+#include "ot/lib/compositor.hpp"
 #include "ot/lib/frame-manager.hpp"
 #include "ot/lib/keyboard-utils.hpp"
 #include "ot/lib/mpack/mpack-reader.hpp"
@@ -31,6 +32,7 @@ static const int FONT_SIZE = 16;
 static const int LINE_HEIGHT = 20;
 static const int TEXT_START_X = 10;
 static const int TEXT_START_Y = 10;
+static const uint32_t BACKGROUND = 0xFF1A1A2E;
 
 // Forward declarations
 struct GraphicsEditorStorage;
@@ -47,6 +49,12 @@ struct GraphicsEditorBackend : edit::Backend {
   int fb_width;
   int fb_height;
   int char_width;
+  bool focused; // Keys are only read while the editor has keyboard focus
+
+  // What the framebuffer currently shows, for redrawing only what changed
+  bool needs_full;
+  int cursor_row, cursor_col;
+  edit::EditorMode cursor_mode;
 
   GraphicsEditorBackend(GraphicsEditorStorage *s) : storage(s) {
     gfx_client = nullptr;
@@ -57,6 +65,10 @@ struct GraphicsEditorBackend : edit::Backend {
     fb_width = 0;
     fb_height = 0;
     char_width = 8; // Will be calculated after TTF init
+    focused = true;
+    needs_full = true;
+    cursor_row = cursor_col = -1;
+    cursor_mode = edit::EditorMode::INSERT;
   }
 
   edit::Key translateKeyEvent(uint16_t code, uint8_t flags) {
@@ -141,6 +153,7 @@ struct GraphicsEditorBackend : edit::Backend {
   virtual edit::Coord getWindowSize() override;
   virtual Result<edit::Key, edit::EditorErr> readKey() override;
   virtual void render(const edit::Editor &ed) override;
+  void draw_text_row(int row, const ou::string &line);
   virtual void debug_print(const ou::string &msg) override;
   virtual bool begin_frame() override;
   virtual void end_frame() override;
@@ -260,7 +273,7 @@ void GraphicsEditorBackend::refresh() {
 
 void GraphicsEditorBackend::clear() {
   if (gfx) {
-    gfx->clear(0xFF1A1A2E);
+    gfx->clear(BACKGROUND);
   }
 }
 
@@ -273,7 +286,7 @@ edit::Coord GraphicsEditorBackend::getWindowSize() {
 }
 
 Result<edit::Key, edit::EditorErr> GraphicsEditorBackend::readKey() {
-  if (!kbd_client) {
+  if (!kbd_client || !focused) {
     return Result<edit::Key, edit::EditorErr>::ok(edit::Key{});
   }
 
@@ -302,65 +315,112 @@ Result<edit::Key, edit::EditorErr> GraphicsEditorBackend::readKey() {
   return Result<edit::Key, edit::EditorErr>::ok(translateKeyEvent((uint16_t)key_data.code, (uint8_t)key_data.flags));
 }
 
+void GraphicsEditorBackend::draw_text_row(int row, const ou::string &line) {
+  int y = TEXT_START_Y + row * LINE_HEIGHT;
+  gfx->fill_rect(0, y, fb_width, LINE_HEIGHT, BACKGROUND);
+  if (line.length() > 0) {
+    gfx->draw_ttf_text(TEXT_START_X, y, line.c_str(), 0xFFFFFFFF, FONT_SIZE);
+  }
+}
+
 void GraphicsEditorBackend::render(const edit::Editor &ed) {
   if (!gfx) {
     return;
   }
 
-  // Clear screen to dark blue
-  gfx->clear(0xFF1A1A2E);
-
   edit::Coord ws = getWindowSize();
-  int y = TEXT_START_Y;
-
-  // Draw file lines
-  for (int i = 0; i < ws.y && i < (int)ed.render_lines.size(); i++) {
-    const ou::string &line = ed.render_lines[i];
-    if (line.length() > 0) {
-      gfx->draw_ttf_text(TEXT_START_X, y, line.c_str(), 0xFFFFFFFF, FONT_SIZE);
+  const edit::FrameDiff &diff = ed.frame;
+  bool full = diff.full || needs_full;
+  graphics::Rect damage;
+
+  if (full) {
+    gfx->clear(BACKGROUND);
+    damage = graphics::Rect(0, 0, fb_width, fb_height);
+  } else if (diff.scroll != 0) {
+    // Move the rows that stay on screen; only rows scrolling in get redrawn
+    int n = diff.scroll > 0 ? (int)diff.scroll : (int)-diff.scroll;
+    int keep = (ws.y - n) * LINE_HEIGHT;
+    int top = TEXT_START_Y + n * LINE_HEIGHT;
+    if (diff.scroll > 0) {
+      gfx->move_rows(top, TEXT_START_Y, keep);
+    } else {
+      gfx->move_rows(TEXT_START_Y, top, keep);
     }
-    y += LINE_HEIGHT;
+    damage = graphics::Rect(0, TEXT_START_Y, fb_width, ws.y * LINE_HEIGHT);
+    cursor_row -= (int)diff.scroll;
   }
 
-  // Draw ~ for empty lines beyond file content
-  for (int i = ed.render_lines.size(); i < ws.y; i++) {
-    gfx->draw_ttf_text(TEXT_START_X, y, "~", 0xFF666666, FONT_SIZE);
-    y += LINE_HEIGHT;
+  // The cursor is drawn over the text, so its old and new rows are redrawn
+  // whenever it moves
+  int new_cursor_row = (int)(ed.cy - ed.row_offset);
+  int new_cursor_col = (int)(ed.rx - ed.col_offset);
+  bool cursor_moved = new_cursor_row != cursor_row || new_cursor_col != cursor_col || ed.mode != cursor_mode;
+  bool draw_cursor = full || cursor_moved;
+
+  // Draw file lines, or ~ past the end of the file
+  for (int i = 0; i < ws.y; i++) {
+    bool cursor_row_dirty = cursor_moved && (i == cursor_row || i == new_cursor_row);
+    if (!full && !diff.row_changed(i) && !cursor_row_dirty) {
+      continue;
+    }
+    if (i < (int)ed.render_lines.size()) {
+      draw_text_row(i, ed.render_lines[i]);
+    } else {
+      int y = TEXT_START_Y + i * LINE_HEIGHT;
+      gfx->fill_rect(0, y, fb_width, LINE_HEIGHT, BACKGROUND);
+      gfx->draw_ttf_text(TEXT_START_X, y, "~", 0xFF666666, FONT_SIZE);
+    }
+    damage = damage.unite(graphics::Rect(0, TEXT_START_Y + i * LINE_HEIGHT, fb_width, LINE_HEIGHT));
+    if (i == new_cursor_row) {
+      draw_cursor = true; // Redrawing the row erased the cursor
+    }
   }
 
   // Draw status line (inverted: light background, dark text)
   int status_y = TEXT_START_Y + ws.y * LINE_HEIGHT;
-  gfx->fill_rect(0, status_y, fb_width, LINE_HEIGHT, 0xFFCCCCCC);
-  if (ed.status_line.length() > 0) {
-    gfx->draw_ttf_text(TEXT_START_X, status_y, ed.status_line.c_str(), 0xFF1A1A2E, FONT_SIZE);
+  if (full || diff.status) {
+    gfx->fill_rect(0, status_y, fb_width, LINE_HEIGHT, 0xFFCCCCCC);
+    if (ed.status_line.length() > 0) {
+      gfx->draw_ttf_text(TEXT_START_X, status_y, ed.status_line.c_str(), 0xFF1A1A2E, FONT_SIZE);
+    }
+    damage = damage.unite(graphics::Rect(0, status_y, fb_width, LINE_HEIGHT));
   }
 
   // Draw message/command line
   int message_y = status_y + LINE_HEIGHT;
-  if (!ed.message_line.empty()) {
-    gfx->draw_ttf_text(TEXT_START_X, message_y, ed.message_line.c_str(), 0xFFFFFFFF, FONT_SIZE);
-  } else if (ed.mode == edit::EditorMode::COMMND) {
-    // Draw command prompt
-    char cmd_buffer[256];
-    snprintf(cmd_buffer, sizeof(cmd_buffer), ";%s", ed.command_line.c_str());
-    gfx->draw_ttf_text(TEXT_START_X, message_y, cmd_buffer, 0xFFFFFFFF, FONT_SIZE);
+  if (full || diff.message) {
+    gfx->fill_rect(0, message_y, fb_width, LINE_HEIGHT, BACKGROUND);
+    if (!ed.message_line.empty()) {
+      gfx->draw_ttf_text(TEXT_START_X, message_y, ed.message_line.c_str(), 0xFFFFFFFF, FONT_SIZE);
+    } else if (ed.mode == edit::EditorMode::COMMND) {
+      // Draw command prompt
+      char cmd_buffer[256];
+      snprintf(cmd_buffer, sizeof(cmd_buffer), ";%s", ed.command_line.c_str());
+      gfx->draw_ttf_text(TEXT_START_X, message_y, cmd_buffer, 0xFFFFFFFF, FONT_SIZE);
+    }
+    damage = damage.unite(graphics::Rect(0, message_y, fb_width, LINE_HEIGHT));
   }
 
-  // Draw cursor
-  int cursor_x = TEXT_START_X + (ed.rx - ed.col_offset) * char_width;
-  int cursor_y = TEXT_START_Y + (ed.cy - ed.row_offset) * LINE_HEIGHT;
-
   // Draw cursor as a block (in normal mode) or underline (in insert mode)
-  if (ed.mode == edit::EditorMode::INSERT) {
-    // Underline cursor for insert mode
-    gfx->fill_rect(cursor_x, cursor_y + LINE_HEIGHT - 2, char_width, 2, 0xFFFFFF00);
-  } else {
-    // Block cursor for normal/command mode
-    gfx->fill_rect(cursor_x, cursor_y, char_width, LINE_HEIGHT, 0x88FFFFFF);
+  if (draw_cursor) {
+    int cursor_x = TEXT_START_X + new_cursor_col * char_width;
+    int cursor_y = TEXT_START_Y + new_cursor_row * LINE_HEIGHT;
+    if (ed.mode == edit::EditorMode::INSERT) {
+      gfx->fill_rect(cursor_x, cursor_y + LINE_HEIGHT - 2, char_width, 2, 0xFFFFFF00);
+    } else {
+      gfx->fill_rect(cursor_x, cursor_y, char_width, LINE_HEIGHT, 0x88FFFFFF);
+    }
+    cursor_row = new_cursor_row;
+    cursor_col = new_cursor_col;
+    cursor_mode = ed.mode;
   }
+  needs_full = false;
 
-  // Flush to display
-  gfx_client->flush();
+  // Flush only what changed; idle frames send nothing
+  damage = damage.clip(fb_width, fb_height);
+  if (!damage.empty()) {
+    gfx_client->flush_rect(damage.packed_origin(), damage.packed_extent());
+  }
 }
 
 void GraphicsEditorBackend::debug_print(const ou::string &msg) {
@@ -373,12 +433,15 @@ bool GraphicsEditorBackend::begin_frame() {
     return true;
   }
 
-  // Check if we should render (are we the active app?)
+  // Check if we should render (is any of our surface on screen?)
   auto should = gfx_client->should_render();
   if (should.is_err()) {
     return false;
   }
+  focused = (should.value() & graphics::RENDER_FOCUSED) != 0;
   if (should.value() == 0) {
+    // Off screen; draw everything again once we are back
+    needs_full = true;
     return false;
   }
 
@@ -392,7 +455,13 @@ void GraphicsEditorBackend::end_frame() {
   }
 }
 
-void GraphicsEditorBackend::yield() { ou_yield(); }
+void GraphicsEditorBackend::yield() {
+  if (frame_manager) {
+    frame_manager->wait();
+  } else {
+    ou_yield();
+  }
+}
 
 // Main entry point
 void edit_main() {
@@ -4,9 +4,11 @@
 #include <stdio.h>
 
 #include "ot/lib/file.hpp"
+#include "ot/lib/hash.hpp"
 #include "ot/lib/messages.hpp"
-#include "ot/lib/mpack/mpack-reader.hpp"
+#include "ot/lib/mpack/mpack-direct.hpp"
 #include "ot/user/gen/filesystem-client.hpp"
+#include "ot/user/local-storage.hpp"
 #include "ot/user/prog/shell/shell.hpp"
 #include "ot/user/user.hpp"
 
@@ -123,6 +125,33 @@ tcl::Status cmd_length(tcl::Interp &i, tcl::vector<tcl::string> &argv, tcl::Proc
   return tcl::S_OK;
 }
 
+tcl::Status cmd_mem_stats(tcl::Interp &i, tcl::vector<tcl::string> &argv, tcl::ProcPrivdata *privdata) {
+  if (!i.arity_check("mem/stats", argv, 1, 1)) {
+    return tcl::S_ERR;
+  }
+  ou::AllocStats stats;
+  ou_alloc_stats(&stats);
+
+  // Key/value pairs, then one {size allocs frees in-use slabs} entry per slab class
+  tcl::vector<tcl::string> entries;
+  char buf[96];
+  const char *names[] = {"in-use", "peak", "pool-free", "largest-free", "slab-waste", "large-allocs", "large-frees"};
+  size_t values[] = {stats.bytes_in_use, stats.peak_bytes,   stats.pool_free,  stats.largest_free,
+                     stats.slab_waste,   stats.large_allocs, stats.large_frees};
+  for (size_t k = 0; k < sizeof(values) / sizeof(values[0]); k++) {
+    entries.push_back(tcl::string(names[k]));
+    snprintf(buf, sizeof(buf), "%zu", values[k]);
+    entries.push_back(tcl::string(buf));
+  }
+  for (int c = 0; c < ou::AllocStats::CLASS_COUNT; c++) {
+    const ou::SlabClassStats &cs = stats.classes[c];
+    snprintf(buf, sizeof(buf), "%zu %zu %zu %zu %zu", cs.size, cs.allocs, cs.frees, cs.in_use, cs.slabs);
+    entries.push_back(tcl::string(buf));
+  }
+  tcl::list_format(entries, i.result);
+  return tcl::S_OK;
+}
+
 tcl::Status cmd_fs_read(tcl::Interp &i, tcl::vector<tcl::string> &argv, tcl::ProcPrivdata *privdata) {
   if (!i.arity_check("fs/read", argv, 2, 2)) {
     return tcl::S_ERR;
@@ -175,6 +204,49 @@ tcl::Status cmd_fs_write(tcl::Interp &i, tcl::vector<tcl::string> &argv, tcl::Pr
   return tcl::S_OK;
 }
 
+tcl::Status cmd_fs_hash(tcl::Interp &i, tcl::vector<tcl::string> &argv, tcl::ProcPrivdata *privdata) {
+  if (!i.arity_check("fs/hash", argv, 2, 3)) {
+    return tcl::S_ERR;
+  }
+
+  HashAlgo algo = HashAlgo::MD5;
+  if (argv.size() == 3 && !hash_algo_from_name(argv[2].c_str(), algo)) {
+    snprintf(ot_scratch_buffer, OT_PAGE_SIZE, "fs/hash: unknown algorithm '%s' (expected md5 or xxh32)",
+             argv[2].c_str());
+    i.result = ot_scratch_buffer;
+    return tcl::S_ERR;
+  }
+
+  ou::File file(argv[1].c_str(), ou::FileMode::READ);
+  ErrorCode err = file.open();
+  if (err != ErrorCode::NONE) {
+    snprintf(ot_scratch_buffer, OT_PAGE_SIZE, "fs/hash: failed to open file '%s': %s", argv[1].c_str(),
+             error_code_to_string(err));
+    i.result = ot_scratch_buffer;
+    return tcl::S_ERR;
+  }
+
+  // Hash as the file streams in, so large files never have to fit in memory
+  HashContext ctx;
+  hash_init(&ctx, algo);
+  err = file.read_chunks(
+      [](void *ctx, const char *data, size_t len) { hash_update((HashContext *)ctx, (const uint8_t *)data, len); },
+      &ctx);
+  if (err != ErrorCode::NONE) {
+    snprintf(ot_scratch_buffer, OT_PAGE_SIZE, "fs/hash: failed to read file '%s': %s", argv[1].c_str(),
+             error_code_to_string(err));
+    i.result = ot_scratch_buffer;
+    return tcl::S_ERR;
+  }
+
+  uint8_t digest[HASH_MAX_DIGEST];
+  char hex[HASH_MAX_DIGEST * 2 + 1];
+  size_t len = hash_final(&ctx, digest);
+  hash_digest_to_hex(digest, len, hex);
+  i.result = hex;
+  return tcl::S_OK;
+}
+
 tcl::Status cmd_fs_create(tcl::Interp &i, tcl::vector<tcl::string> &argv, tcl::ProcPrivdata *privdata) {
   if (!i.arity_check("fs/create", argv, 2, 2)) {
     return tcl::S_ERR;
@@ -305,7 +377,7 @@ tcl::Status cmd_dir_ls(tcl::Interp &i, tcl::vector<tcl::string> &argv, tcl::Proc
 
   // Read msgpack array from comm page
   PageAddr comm = ou_get_comm_page();
-  MPackReader reader(comm.as_ptr(), OT_PAGE_SIZE);
+  MPackDirectReader reader(comm.as_ptr(), OT_PAGE_SIZE);
 
   uint32_t count;
   reader.enter_array(count);
@@ -345,11 +417,20 @@ void register_shell_commands(tcl::Interp &i) {
 
   i.register_command("ot_yield", cmd_yield, nullptr, "[ot_yield] - Yields to the OS scheduler");
 
+  // Allocator statistics
+  i.register_command("mem/stats", cmd_mem_stats, nullptr,
+                     "[mem/stats] => list - Allocator statistics: in-use, peak, pool-free, largest-free, slab-waste, "
+                     "large-allocs and large-frees byte/count pairs, then {size allocs frees in-use slabs} per slab "
+                     "class");
+
   // Filesystem commands
   i.register_command("fs/read", cmd_fs_read, nullptr,
                      "[fs/read filename:string] => string - Read entire file into a string");
   i.register_command("fs/write", cmd_fs_write, nullptr,
                      "[fs/write filename:string content:string] => nil - Write string to a file");
+  i.register_command("fs/hash", cmd_fs_hash, nullptr,
+                     "[fs/hash filename:string algo?:string] => string - Hex digest of a file; algo is md5 "
+                     "(default) or xxh32");
   i.register_command("fs/create", cmd_fs_create, nullptr,
                      "[fs/create filename:string] => nil - Create a new empty file");
   i.register_command("dofile", cmd_dofile, nullptr, "[dofile filename:string] => result - Execute a Tcl script file");
@@ -11,6 +11,7 @@ tcl::Status cmd_ipc_send(tcl::Interp &i, tcl::vector<tcl::string> &argv, tcl::Pr
 tcl::Status cmd_error_string(tcl::Interp &i, tcl::vector<tcl::string> &argv, tcl::ProcPrivdata *privdata);
 tcl::Status cmd_fs_read(tcl::Interp &i, tcl::vector<tcl::string> &argv, tcl::ProcPrivdata *privdata);
 tcl::Status cmd_fs_write(tcl::Interp &i, tcl::vector<tcl::string> &argv, tcl::ProcPrivdata *privdata);
+tcl::Status cmd_fs_hash(tcl::Interp &i, tcl::vector<tcl::string> &argv, tcl::ProcPrivdata *privdata);
 tcl::Status cmd_fs_create(tcl::Interp &i, tcl::vector<tcl::string> &argv, tcl::ProcPrivdata *privdata);
 
 // Register all shell commands to an interpreter
@@ -125,7 +125,13 @@ void shell_main() {
   while (s->running) {
     oprintf("> ");
     while (s->running) {
-      char c = ogetchar();
+      int ch = ogetchar();
+      if (ch < 0) {
+        // Nothing typed yet: block until input arrives instead of polling
+        ou_wait(0);
+        continue;
+      }
+      char c = (char)ch;
       if (c >= 32 && c <= 126) {
         s->buffer[s->buffer_i++] = c;
         if (s->buffer_i == sizeof(s->buffer)) {
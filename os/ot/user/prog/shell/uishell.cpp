@@ -1,8 +1,10 @@
 // uishell.cpp - Graphical TCL shell implementation
 #include "ot/lib/app-framework.hpp"
+#include "ot/lib/compositor.hpp"
 #include "ot/lib/frame-manager.hpp"
 #include "ot/lib/keyboard-utils.hpp"
 #include "ot/lib/mpack/mpack-utils.hpp"
+#include "ot/lib/rect.hpp"
 #include "ot/lib/string-view.hpp"
 #include "ot/user/gen/graphics-client.hpp"
 #include "ot/user/gen/keyboard-client.hpp"
@@ -23,6 +25,7 @@ static const int BODY_SIZE = 16;
 static const int TEXT_START_X = 15;
 static const int TEXT_START_Y = 80;
 static const int LINE_SPACING = 20;
+static const uint32_t BG_COLOR = 0xFF1A1A2E;
 
 using ou::string_view;
 using tcl::Interp;
@@ -54,10 +57,22 @@ struct UIShellStorage : public shell::ShellStorage {
   int output_start;    // Index of first line in buffer
   int output_count;    // Number of lines in buffer
   int scroll_offset;   // Lines scrolled from bottom (0 = at bottom)
+  int total_lines;     // Lines ever added; numbers lines independently of the ring
+
+  // Output lines currently rasterised in the framebuffer, one LINE_SPACING
+  // strip each starting at TEXT_START_Y, as absolute line numbers
+  int view_first;
+  int view_count;
 
   bool cursor_visible;
   int cursor_blink_counter;
 
+  // Set when the framebuffer no longer matches the view (scrollback, clear,
+  // gfx/* drawing, becoming visible) and everything must be redrawn
+  bool full_redraw;
+  // Set when the input line or cursor changed
+  bool prompt_dirty;
+
   // TclIO implementation (composition instead of inheritance)
   UIShellTclIO tcl_io;
 
@@ -75,8 +90,13 @@ struct UIShellStorage : public shell::ShellStorage {
     output_start = 0;
     output_count = 0;
     scroll_offset = 0;
+    total_lines = 0;
+    view_first = 0;
+    view_count = 0;
     cursor_visible = true;
     cursor_blink_counter = 0;
+    full_redraw = true;
+    prompt_dirty = true;
     memset(input_buffer, 0, MAX_LINE_LENGTH);
   }
 
@@ -92,14 +112,22 @@ struct UIShellStorage : public shell::ShellStorage {
     }
 
     snprintf(output_lines[write_idx], MAX_LINE_LENGTH, "%s", text);
+    total_lines++;
 
-    // Auto-scroll to bottom on new output
-    scroll_offset = 0;
+    // Auto-scroll to bottom on new output. Lines already on screen stay in
+    // the framebuffer and are scrolled rather than redrawn.
+    if (scroll_offset != 0) {
+      scroll_offset = 0;
+      full_redraw = true;
+    }
   }
 
+  // Get line by absolute number (see total_lines), or nullptr if it has left the ring
+  const char *get_numbered_line(int number) { return get_output_line(number - (total_lines - output_count)); }
+
   // Get line at index (0 = oldest)
   const char *get_output_line(int idx) {
-    if (idx >= output_count)
+    if (idx < 0 || idx >= output_count)
       return nullptr;
     int real_idx = (output_start + idx) % MAX_OUTPUT_LINES;
     return output_lines[real_idx];
@@ -109,6 +137,7 @@ struct UIShellStorage : public shell::ShellStorage {
   void clear_output() {
     output_start = 0;
     output_count = 0;
+    full_redraw = true;
   }
 };
 
@@ -118,7 +147,7 @@ void UIShellTclIO::write(const char *str) {
   bool output_to_console = false;
   if (interp) {
     tcl::Var *v = interp->get_var(tcl::string_view("uishell_output_to_console"));
-    if (v && v->val->compare("1") == 0) {
+    if (v && v->value().compare("1") == 0) {
       output_to_console = true;
     }
   }
@@ -158,7 +187,7 @@ void UIShellTclIO::write_error(const char *str) {
   bool output_to_console = false;
   if (interp) {
     tcl::Var *v = interp->get_var(tcl::string_view("uishell_output_to_console"));
-    if (v && v->val->compare("1") == 0) {
+    if (v && v->value().compare("1") == 0) {
       output_to_console = true;
     }
   }
@@ -186,6 +215,7 @@ void handle_key_event(UIShellStorage *s, tcl::Interp &i, uint16_t code, uint8_t
     if (s->scroll_offset > max_scroll) {
       s->scroll_offset = max_scroll;
     }
+    s->full_redraw = true;
     return;
   }
 
@@ -197,6 +227,7 @@ void handle_key_event(UIShellStorage *s, tcl::Interp &i, uint16_t code, uint8_t
     if (s->scroll_offset < 0) {
       s->scroll_offset = 0;
     }
+    s->full_redraw = true;
     return;
   }
 
@@ -208,6 +239,7 @@ void handle_key_event(UIShellStorage *s, tcl::Interp &i, uint16_t code, uint8_t
     }
     s->cursor_blink_counter = 0;
     s->cursor_visible = true;
+    s->prompt_dirty = true;
     return;
   }
 
@@ -256,6 +288,7 @@ void handle_key_event(UIShellStorage *s, tcl::Interp &i, uint16_t code, uint8_t
     s->input_buffer[0] = 0;
     s->cursor_blink_counter = 0;
     s->cursor_visible = true;
+    s->prompt_dirty = true;
     return;
   }
 
@@ -267,6 +300,7 @@ void handle_key_event(UIShellStorage *s, tcl::Interp &i, uint16_t code, uint8_t
     s->input_buffer[s->input_pos] = 0;
     s->cursor_blink_counter = 0;
     s->cursor_visible = true;
+    s->prompt_dirty = true;
   }
 }
 
@@ -317,6 +351,7 @@ Status cmd_gfx_rectangle(tcl::Interp &i, tcl::vector<tcl::string> &argv, tcl::Pr
   oprintf("gfx/rectangle: x=%d y=%d width=%d height=%d color=%d\n", x, y, width, height, color);
 
   s->app->fill_rect(x, y, width, height, color);
+  s->full_redraw = true;
 
   return tcl::S_OK;
 }
@@ -350,6 +385,7 @@ Status cmd_gfx_pixel(tcl::Interp &i, tcl::vector<tcl::string> &argv, tcl::ProcPr
   int y = y_result.value();
 
   s->app->put_pixel(x, y, color);
+  s->full_redraw = true;
 
   return tcl::S_OK;
 }
@@ -381,6 +417,7 @@ tcl::Status cmd_gfx_loop(tcl::Interp &i, tcl::vector<tcl::string> &argv, tcl::Pr
   }
 
   graphics::FrameManager fm(framerate_result.value());
+  s->full_redraw = true;
   oprintf("gfx/loop: starting loop at %d FPS\n", framerate_result.value());
   while (s->running) {
     auto should = s->gfxc.should_render();
@@ -389,7 +426,7 @@ tcl::Status cmd_gfx_loop(tcl::Interp &i, tcl::vector<tcl::string> &argv, tcl::Pr
       return tcl::S_ERR;
     }
     if (should.value() == 0) {
-      ou_yield();
+      fm.wait();
       continue;
     }
 
@@ -401,6 +438,8 @@ tcl::Status cmd_gfx_loop(tcl::Interp &i, tcl::vector<tcl::string> &argv, tcl::Pr
       ou_yield();
 
       fm.end_frame();
+    } else {
+      fm.wait();
     }
   }
 
@@ -485,6 +524,7 @@ Status cmd_gfx_text(tcl::Interp &i, tcl::vector<tcl::string> &argv, tcl::ProcPri
 
   // Use size 16 for text rendering
   auto result = s->app->draw_ttf_text(x, y, text, color, 16);
+  s->full_redraw = true;
   if (result.is_err()) {
     i.result = "Text rendering failed";
     return tcl::S_ERR;
@@ -493,6 +533,95 @@ Status cmd_gfx_text(tcl::Interp &i, tcl::vector<tcl::string> &argv, tcl::ProcPri
   return tcl::S_OK;
 }
 
+// === RENDERING ===
+// Output lines are rasterised once, when they come into view. After that they
+// stay in the framebuffer: new output scrolls them up with move_rows and only
+// the new lines and the prompt are drawn. Typing redraws just the prompt line.
+
+static int row_y(int row) { return TEXT_START_Y + row * LINE_SPACING; }
+
+// Work out which output lines are on screen, as absolute line numbers
+static void visible_lines(UIShellStorage *s, int height, int *first, int *count) {
+  int available_height = height - TEXT_START_Y - 40; // Leave margin at bottom
+  int max_visible_lines = available_height / LINE_SPACING;
+
+  // Most recent lines at bottom, adjusted for scroll
+  int start_line = (s->output_count > max_visible_lines) ? (s->output_count - max_visible_lines - s->scroll_offset) : 0;
+  if (start_line < 0)
+    start_line = 0;
+
+  *first = s->total_lines - s->output_count + start_line;
+  *count = s->output_count - start_line;
+}
+
+static void draw_output_line(UIShellStorage *s, app::Framework &gfx, int number, int row) {
+  const char *line = s->get_numbered_line(number);
+  if (line) {
+    gfx.draw_ttf_text(TEXT_START_X, row_y(row), line, 0xFFFFFFFF, BODY_SIZE);
+  }
+}
+
+// Redraw the prompt and input line (and cursor) over a cleared strip
+static void draw_prompt(UIShellStorage *s, app::Framework &gfx, int y) {
+  gfx.fill_rect(0, y, gfx.width(), LINE_SPACING, BG_COLOR);
+
+  char prompt_with_input[MAX_LINE_LENGTH + 10];
+  snprintf(prompt_with_input, sizeof(prompt_with_input), "> %s", s->input_buffer);
+  gfx.draw_ttf_text(TEXT_START_X, y, prompt_with_input, 0xFF88FF88, BODY_SIZE);
+
+  if (s->cursor_visible) {
+    // Measure text up to cursor position
+    auto measure_result = gfx.measure_ttf_text(prompt_with_input, BODY_SIZE);
+    int cursor_x = TEXT_START_X;
+    if (measure_result.is_ok()) {
+      cursor_x += measure_result.value();
+    }
+    gfx.draw_ttf_text(cursor_x, y, "_", 0xFFFFFF00, BODY_SIZE);
+  }
+}
+
+static void render_full(UIShellStorage *s, app::Framework &gfx, int first, int count) {
+  gfx.clear(BG_COLOR);
+
+  // Draw title
+  gfx.draw_ttf_text(TEXT_START_X, 15, "OTIUM SHELL", 0xFFEEEEEE, TITLE_SIZE);
+  gfx.draw_ttf_text(TEXT_START_X, 48, "Interactive TCL Shell; Ctrl-U = scroll up, Ctrl-D = scroll down, Alt-Q = quit",
+                    0xFFCCCCCC, SUBTITLE_SIZE);
+
+  // Draw separator line
+  gfx.draw_hline(TEXT_START_X, 68, gfx.width() - TEXT_START_X * 2, 0xFF444444);
+
+  for (int row = 0; row < count; row++) {
+    draw_output_line(s, gfx, first + row, row);
+  }
+  draw_prompt(s, gfx, row_y(count));
+}
+
+// Bring the screen from the previous view to [first, first + count) by moving
+// lines that are still visible and drawing only the new ones. Returns the
+// region that changed, or an empty rect if the views don't overlap.
+static graphics::Rect render_scrolled(UIShellStorage *s, app::Framework &gfx, int first, int count) {
+  int shift = first - s->view_first;
+  int kept = s->view_count - shift;
+  if (shift < 0 || kept < 0 || kept > count) {
+    return graphics::Rect();
+  }
+
+  if (shift > 0) {
+    gfx.move_rows(row_y(shift), row_y(0), kept * LINE_SPACING);
+  }
+
+  // Clear from the old prompt row down through the new prompt row
+  gfx.fill_rect(0, row_y(kept), gfx.width(), (count - kept + 1) * LINE_SPACING, BG_COLOR);
+  for (int row = kept; row < count; row++) {
+    draw_output_line(s, gfx, first + row, row);
+  }
+  draw_prompt(s, gfx, row_y(count));
+
+  int top = shift > 0 ? 0 : kept;
+  return graphics::Rect(0, row_y(top), gfx.width(), (count - top + 1) * LINE_SPACING);
+}
+
 void uishell_main() {
   void *storage_page = ou_get_storage().as_ptr();
   UIShellStorage *s = new (storage_page) UIShellStorage();
@@ -618,40 +747,43 @@ void uishell_main() {
   oprintf("UISHELL: Running\n");
 
   while (s->running) {
-    // Check if we should render (are we the active app?)
+    // Check if we should render (is any of our surface on screen?)
     auto should = s->gfxc.should_render();
     if (should.is_err()) {
       oprintf("UISHELL: should_render returned error: %d\n", should.error());
       ou_exit();
     }
     if (should.value() == 0) {
-      // Not active, just yield
-      ou_yield();
+      // Not visible, just wait; the screen must be fully redrawn once we are shown again
+      s->full_redraw = true;
+      fm.wait();
       continue;
     }
 
     if (fm.begin_frame()) {
-      // Poll keyboard
-      auto key_result = s->kbdc.poll_key();
-      if (key_result.is_err()) {
-        oprintf("UISHELL: poll_key error: %d\n", key_result.error());
-      } else {
-        auto key_data = key_result.value();
-        if (key_data.has_key) {
-          // oprintf("UISHELL: got key code=%d flags=%d\n", (int)key_data.code, (int)key_data.flags);
-          // Pass key to graphics server first for global hotkeys (Alt+1-9 app switching)
-          bool consumed = gfx.pass_key_to_server(s->gfxc, key_data.code, key_data.flags);
-
-          // Check for Alt+Q to quit
-          if ((key_data.flags & KEY_FLAG_ALT) && (key_data.code == KEY_Q)) {
-            oprintf("UISHELL: Alt+Q pressed, exiting\n");
-            s->running = false;
-          }
+      // Poll keyboard while focused
+      if (should.value() & graphics::RENDER_FOCUSED) {
+        auto key_result = s->kbdc.poll_key();
+        if (key_result.is_err()) {
+          oprintf("UISHELL: poll_key error: %d\n", key_result.error());
+        } else {
+          auto key_data = key_result.value();
+          if (key_data.has_key) {
+            // oprintf("UISHELL: got key code=%d flags=%d\n", (int)key_data.code, (int)key_data.flags);
+            // Pass key to graphics server first for global hotkeys (Alt+1-9 app switching)
+            bool consumed = gfx.pass_key_to_server(s->gfxc, key_data.code, key_data.flags);
+
+            // Check for Alt+Q to quit
+            if ((key_data.flags & KEY_FLAG_ALT) && (key_data.code == KEY_Q)) {
+              oprintf("UISHELL: Alt+Q pressed, exiting\n");
+              s->running = false;
+            }
 
-          // oprintf("UISHELL: pass_key_to_server returned %d\n", consumed);
-          if (!consumed) {
-            // Key not consumed by server, handle locally
-            handle_key_event(s, i, key_data.code, key_data.flags);
+            // oprintf("UISHELL: pass_key_to_server returned %d\n", consumed);
+            if (!consumed) {
+              // Key not consumed by server, handle locally
+              handle_key_event(s, i, key_data.code, key_data.flags);
+            }
           }
         }
       }
@@ -661,63 +793,40 @@ void uishell_main() {
       if (s->cursor_blink_counter >= 30) { // Blink every 0.5s at 60 FPS
         s->cursor_visible = !s->cursor_visible;
         s->cursor_blink_counter = 0;
+        s->prompt_dirty = true;
       }
 
-      // Clear screen to dark blue
-      gfx.clear(0xFF1A1A2E);
-
-      // Draw title
-      gfx.draw_ttf_text(TEXT_START_X, 15, "OTIUM SHELL", 0xFFEEEEEE, TITLE_SIZE);
-      gfx.draw_ttf_text(TEXT_START_X, 48,
-                        "Interactive TCL Shell; Ctrl-U = scroll up, Ctrl-D = scroll down, Alt-Q = quit", 0xFFCCCCCC,
-                        SUBTITLE_SIZE);
-
-      // Draw separator line
-      gfx.draw_hline(TEXT_START_X, 68, width - TEXT_START_X * 2, 0xFF444444);
-
-      // Calculate how many lines fit on screen
-      int available_height = height - TEXT_START_Y - 40; // Leave margin at bottom
-      int max_visible_lines = available_height / LINE_SPACING;
-
-      // Draw output history (most recent lines at bottom, adjusted for scroll)
-      int y = TEXT_START_Y;
-      int start_line =
-          (s->output_count > max_visible_lines) ? (s->output_count - max_visible_lines - s->scroll_offset) : 0;
-      if (start_line < 0)
-        start_line = 0;
-
-      // Debug: log output rendering state (once)
-      for (int i = start_line; i < s->output_count; i++) {
-        const char *line = s->get_output_line(i);
-        if (line) {
-          gfx.draw_ttf_text(TEXT_START_X, y, line, 0xFFFFFFFF, BODY_SIZE);
-          y += LINE_SPACING;
+      int first, count;
+      visible_lines(s, height, &first, &count);
+
+      // Flush to display only what changed
+      if (!s->full_redraw && (first != s->view_first || count != s->view_count)) {
+        graphics::Rect changed = render_scrolled(s, gfx, first, count);
+        if (changed.empty()) {
+          s->full_redraw = true;
+        } else {
+          s->gfxc.flush_rect(changed.packed_origin(), changed.packed_extent());
         }
+      } else if (!s->full_redraw && s->prompt_dirty) {
+        draw_prompt(s, gfx, row_y(count));
+        graphics::Rect prompt_rect(0, row_y(count), width, LINE_SPACING);
+        s->gfxc.flush_rect(prompt_rect.packed_origin(), prompt_rect.packed_extent());
       }
 
-      // Draw prompt and input line
-      char prompt_with_input[MAX_LINE_LENGTH + 10];
-      snprintf(prompt_with_input, sizeof(prompt_with_input), "> %s", s->input_buffer);
-      gfx.draw_ttf_text(TEXT_START_X, y, prompt_with_input, 0xFF88FF88, BODY_SIZE);
-
-      // Draw cursor
-      if (s->cursor_visible) {
-        // Measure text up to cursor position
-        auto measure_result = gfx.measure_ttf_text(prompt_with_input, BODY_SIZE);
-        int cursor_x = TEXT_START_X;
-        if (measure_result.is_ok()) {
-          cursor_x += measure_result.value();
-        }
-        gfx.draw_ttf_text(cursor_x, y, "_", 0xFFFFFF00, BODY_SIZE);
+      if (s->full_redraw) {
+        render_full(s, gfx, first, count);
+        s->gfxc.flush();
       }
 
-      // Flush to display
-      s->gfxc.flush();
+      s->full_redraw = false;
+      s->prompt_dirty = false;
+      s->view_first = first;
+      s->view_count = count;
       fm.end_frame();
     }
 
-    // Always yield
-    ou_yield();
+    // Sleep until the next frame or a key press
+    fm.wait();
   }
 
   // Unregister before exit
@@ -0,0 +1,122 @@
+// slab-test.cpp - Unit tests for the slab allocator
+#include "ot/user/slab.hpp"
+#include "vendor/doctest.h"
+
+namespace {
+
+// A pool the size of a small process heap, aligned like the pages it normally gets
+alignas(ou::SlabAllocator::SLAB_SIZE) char pool_memory[64 * 1024];
+
+struct TestPool {
+  ou::SlabAllocator allocator;
+  TestPool() { allocator.init(pool_memory, sizeof(pool_memory)); }
+
+  ou::AllocStats stats() {
+    ou::AllocStats s;
+    allocator.stats(&s);
+    return s;
+  }
+};
+
+} // namespace
+
+TEST_CASE("slab allocator") {
+  TestPool p;
+  ou::SlabAllocator &a = p.allocator;
+  CHECK(a.initialized());
+
+  SUBCASE("small allocations come from size classes") {
+    void *x = a.malloc(10);
+    void *y = a.malloc(16);
+    void *z = a.malloc(40);
+    CHECK(x != nullptr);
+    CHECK(((uintptr_t)x & 15) == 0);
+    CHECK(((uintptr_t)z & 15) == 0);
+    ou::AllocStats s = p.stats();
+    CHECK(s.classes[0].size == 16);
+    CHECK(s.classes[0].in_use == 2);
+    CHECK(s.classes[0].slabs == 1);
+    CHECK(s.classes[2].size == 48);
+    CHECK(s.classes[2].in_use == 1);
+    CHECK(s.bytes_in_use == 16 + 16 + 48);
+    CHECK(s.large_allocs == 0);
+    a.free(x);
+    a.free(y);
+    a.free(z);
+    s = p.stats();
+    CHECK(s.bytes_in_use == 0);
+    CHECK(s.peak_bytes == 16 + 16 + 48);
+    CHECK(s.classes[0].frees == 2);
+  }
+
+  SUBCASE("freed objects are reused first") {
+    void *x = a.malloc(32);
+    a.free(x);
+    CHECK(a.malloc(32) == x);
+  }
+
+  SUBCASE("large allocations go to TLSF") {
+    void *x = a.malloc(1000);
+    CHECK(x != nullptr);
+    ou::AllocStats s = p.stats();
+    CHECK(s.large_allocs == 1);
+    CHECK(s.bytes_in_use >= 1000);
+    a.free(x);
+    CHECK(p.stats().large_frees == 1);
+    CHECK(p.stats().bytes_in_use == 0);
+  }
+
+  SUBCASE("filling and emptying slabs") {
+    void *ptrs[300];
+    for (int i = 0; i < 300; i++) {
+      ptrs[i] = a.malloc(64);
+      memset(ptrs[i], i, 64);
+    }
+    ou::AllocStats s = p.stats();
+    CHECK(s.classes[3].in_use == 300);
+    CHECK(s.classes[3].slabs > 1);
+    bool intact = true;
+    for (int i = 0; i < 300; i++) {
+      intact = intact && ((unsigned char *)ptrs[i])[63] == (unsigned char)i;
+    }
+    CHECK(intact);
+    for (int i = 0; i < 300; i++) {
+      a.free(ptrs[i]);
+    }
+    // Empty slabs go back to TLSF, except the class's last one
+    s = p.stats();
+    CHECK(s.classes[3].in_use == 0);
+    CHECK(s.classes[3].slabs == 1);
+  }
+
+  SUBCASE("realloc stays in place within a class and moves across") {
+    char *x = (char *)a.malloc(20);
+    memcpy(x, "0123456789", 11);
+    CHECK(a.realloc(x, 30) == x);
+    char *y = (char *)a.realloc(x, 100);
+    CHECK(y != x);
+    CHECK(strcmp(y, "0123456789") == 0);
+    char *z = (char *)a.realloc(y, 2000);
+    CHECK(strcmp(z, "0123456789") == 0);
+    ou::AllocStats s = p.stats();
+    CHECK(s.classes[1].in_use == 0);
+    CHECK(s.classes[5].in_use == 0);
+    CHECK(s.large_allocs == 1);
+    char *w = (char *)a.realloc(z, 8);
+    CHECK(memcmp(w, "01234567", 8) == 0);
+    CHECK(p.stats().large_frees == 1);
+    a.free(w);
+    CHECK(p.stats().bytes_in_use == 0);
+  }
+
+  SUBCASE("fragmentation figures") {
+    ou::AllocStats before = p.stats();
+    CHECK(before.pool_free > 0);
+    CHECK(before.largest_free <= before.pool_free);
+    void *x = a.malloc(16);
+    ou::AllocStats s = p.stats();
+    CHECK(s.slab_waste > 0);
+    CHECK(s.pool_free < before.pool_free);
+    a.free(x);
+  }
+}
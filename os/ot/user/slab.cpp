@@ -0,0 +1,226 @@
+// slab.cpp - Size-class slab caches in front of the TLSF allocator
+
+#include "ot/user/slab.hpp"
+
+namespace ou {
+
+const uint32_t SlabAllocator::CLASS_SIZES[AllocStats::CLASS_COUNT] = {16, 32, 48, 64, 96, 128, 192, 256};
+
+// Size class for each 16-byte step of request size
+static const uint8_t class_by_step[SlabAllocator::MAX_SMALL / 16 + 1] = {
+    0, 0, 1, 2, 3, 4, 4, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7,
+};
+
+SlabAllocator::SlabAllocator()
+    : pool_(nullptr), begin_(nullptr), size_(0), is_slab_(nullptr), large_allocs_(0), large_frees_(0),
+      bytes_in_use_(0), peak_bytes_(0) {
+  for (int i = 0; i < AllocStats::CLASS_COUNT; i++) {
+    caches_[i] = Cache();
+  }
+}
+
+bool SlabAllocator::init(char *begin, size_t size) {
+  pool_ = tlsf_create_with_pool(begin, size);
+  if (!pool_) {
+    return false;
+  }
+  begin_ = begin;
+  size_ = size;
+  is_slab_ = (uint8_t *)tlsf_malloc(pool_, size / SLAB_SIZE);
+  if (!is_slab_) {
+    pool_ = nullptr;
+    return false;
+  }
+  memset(is_slab_, 0, size / SLAB_SIZE);
+  return true;
+}
+
+int SlabAllocator::class_of(size_t size) { return class_by_step[(size + 15) / 16]; }
+
+SlabAllocator::Slab *SlabAllocator::slab_of(void *ptr) const {
+  size_t offset = (char *)ptr - begin_;
+  if ((char *)ptr < begin_ || offset >= size_ || !is_slab_[offset / SLAB_SIZE]) {
+    return nullptr;
+  }
+  return (Slab *)((uintptr_t)ptr & ~(uintptr_t)(SLAB_SIZE - 1));
+}
+
+SlabAllocator::Slab *SlabAllocator::new_slab(int size_class) {
+  Slab *s = (Slab *)tlsf_memalign(pool_, SLAB_SIZE, SLAB_SIZE);
+  if (!s) {
+    return nullptr;
+  }
+  is_slab_[((char *)s - begin_) / SLAB_SIZE] = 1;
+
+  // Chain every object onto the free list, lowest address first
+  size_t size = CLASS_SIZES[size_class];
+  char *first = (char *)s + SLAB_HEADER;
+  size_t count = (SLAB_SIZE - SLAB_HEADER) / size;
+  for (size_t i = 0; i + 1 < count; i++) {
+    *(void **)(first + i * size) = first + (i + 1) * size;
+  }
+  *(void **)(first + (count - 1) * size) = nullptr;
+
+  s->prev = nullptr;
+  s->next = caches_[size_class].partial;
+  if (s->next) {
+    s->next->prev = s;
+  }
+  s->free_list = first;
+  s->in_use = 0;
+  s->size_class = size_class;
+  caches_[size_class].partial = s;
+  caches_[size_class].slabs++;
+  return s;
+}
+
+void SlabAllocator::unlink(Cache &c, Slab *s) {
+  if (s->prev) {
+    s->prev->next = s->next;
+  } else {
+    c.partial = s->next;
+  }
+  if (s->next) {
+    s->next->prev = s->prev;
+  }
+  s->prev = s->next = nullptr;
+}
+
+void *SlabAllocator::malloc(size_t size) {
+  if (size > MAX_SMALL) {
+    void *ptr = tlsf_malloc(pool_, size);
+    if (ptr) {
+      large_allocs_++;
+      note_allocated(tlsf_block_size(ptr));
+    }
+    return ptr;
+  }
+
+  int size_class = class_of(size);
+  Cache &c = caches_[size_class];
+  Slab *s = c.partial;
+  if (!s && !(s = new_slab(size_class))) {
+    return nullptr;
+  }
+  void *ptr = s->free_list;
+  s->free_list = *(void **)ptr;
+  s->in_use++;
+  if (!s->free_list) {
+    unlink(c, s);
+  }
+  c.allocs++;
+  c.in_use++;
+  note_allocated(CLASS_SIZES[size_class]);
+  return ptr;
+}
+
+void SlabAllocator::free(void *ptr) {
+  if (!ptr) {
+    return;
+  }
+  Slab *s = slab_of(ptr);
+  if (!s) {
+    large_frees_++;
+    bytes_in_use_ -= tlsf_block_size(ptr);
+    tlsf_free(pool_, ptr);
+    return;
+  }
+
+  Cache &c = caches_[s->size_class];
+  if (!s->free_list) {
+    // Was full, so it wasn't in the partial list
+    s->next = c.partial;
+    if (s->next) {
+      s->next->prev = s;
+    }
+    c.partial = s;
+  }
+  *(void **)ptr = s->free_list;
+  s->free_list = ptr;
+  s->in_use--;
+  c.frees++;
+  c.in_use--;
+  bytes_in_use_ -= CLASS_SIZES[s->size_class];
+
+  if (s->in_use == 0 && (s->prev || s->next)) {
+    unlink(c, s);
+    c.slabs--;
+    is_slab_[((char *)s - begin_) / SLAB_SIZE] = 0;
+    tlsf_free(pool_, s);
+  }
+}
+
+void *SlabAllocator::realloc(void *ptr, size_t size) {
+  if (!ptr) {
+    return malloc(size);
+  }
+  if (size == 0) {
+    free(ptr);
+    return nullptr;
+  }
+
+  Slab *s = slab_of(ptr);
+  if (s && size <= CLASS_SIZES[s->size_class]) {
+    return ptr;
+  }
+  if (!s && size > MAX_SMALL) {
+    size_t old_size = tlsf_block_size(ptr);
+    void *result = tlsf_realloc(pool_, ptr, size);
+    if (result) {
+      bytes_in_use_ -= old_size;
+      note_allocated(tlsf_block_size(result));
+    }
+    return result;
+  }
+
+  // Moving to a larger class, or between a class and TLSF
+  size_t old_size = s ? CLASS_SIZES[s->size_class] : tlsf_block_size(ptr);
+  void *result = malloc(size);
+  if (result) {
+    memcpy(result, ptr, old_size < size ? old_size : size);
+    free(ptr);
+  }
+  return result;
+}
+
+struct PoolWalk {
+  size_t free;
+  size_t largest;
+};
+
+static void walk_free_blocks(void *ptr, size_t size, int used, void *user) {
+  PoolWalk *walk = (PoolWalk *)user;
+  if (!used) {
+    walk->free += size;
+    if (size > walk->largest) {
+      walk->largest = size;
+    }
+  }
+}
+
+void SlabAllocator::stats(AllocStats *out) const {
+  out->slab_waste = 0;
+  for (int i = 0; i < AllocStats::CLASS_COUNT; i++) {
+    const Cache &c = caches_[i];
+    SlabClassStats &cs = out->classes[i];
+    cs.size = CLASS_SIZES[i];
+    cs.allocs = c.allocs;
+    cs.frees = c.frees;
+    cs.in_use = c.in_use;
+    cs.slabs = c.slabs;
+    out->slab_waste += c.slabs * (SLAB_SIZE - SLAB_HEADER) - c.in_use * CLASS_SIZES[i];
+  }
+  out->large_allocs = large_allocs_;
+  out->large_frees = large_frees_;
+  out->bytes_in_use = bytes_in_use_;
+  out->peak_bytes = peak_bytes_;
+
+  PoolWalk walk = {0, 0};
+  if (pool_) {
+    tlsf_walk_pool(tlsf_get_pool(pool_), walk_free_blocks, &walk);
+  }
+  out->pool_free = walk.free;
+  out->largest_free = walk.largest;
+}
+
+} // namespace ou
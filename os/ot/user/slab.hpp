@@ -0,0 +1,102 @@
+// slab.hpp - Size-class slab caches in front of the TLSF allocator
+#ifndef OT_USER_SLAB_HPP
+#define OT_USER_SLAB_HPP
+
+#include "ot/common.h"
+#include "ot/vendor/tlsf/tlsf.h"
+
+namespace ou {
+
+struct SlabClassStats {
+  size_t size;     // Object size of the class
+  size_t allocs;   // Total allocations
+  size_t frees;    // Total frees
+  size_t in_use;   // Objects currently allocated
+  size_t slabs;    // Slabs currently held
+};
+
+struct AllocStats {
+  static const int CLASS_COUNT = 8;
+  SlabClassStats classes[CLASS_COUNT];
+  size_t large_allocs; // Allocations passed through to TLSF
+  size_t large_frees;
+  size_t bytes_in_use; // Object sizes for small blocks, TLSF block sizes for large ones
+  size_t peak_bytes;
+  size_t slab_waste;    // Free bytes inside slabs
+  size_t pool_free;     // Free bytes in the TLSF pool
+  size_t largest_free;  // Largest free TLSF block; pool_free / largest_free shows fragmentation
+};
+
+/**
+ * Allocator that serves small requests from per-size-class slabs, and passes
+ * anything larger to TLSF. A slab is one SLAB_SIZE block taken from TLSF and
+ * cut into equal objects; free objects are chained through their own first
+ * word, so allocating or freeing one is a few pointer moves. Slabs are
+ * aligned to SLAB_SIZE, so a pointer's slab header is found by masking, and
+ * a byte per SLAB_SIZE of the pool records which blocks are slabs.
+ *
+ * An empty slab is returned to TLSF unless it's the last one its class has,
+ * so a class that is repeatedly emptied and refilled doesn't thrash.
+ */
+class SlabAllocator {
+public:
+  static const size_t SLAB_SIZE = 4096;
+  static const size_t MAX_SMALL = 256;
+
+  SlabAllocator();
+
+  /** Manage [begin, begin + size) with TLSF, begin aligned to SLAB_SIZE. Returns false on failure. */
+  bool init(char *begin, size_t size);
+  bool initialized() const { return pool_ != nullptr; }
+
+  void *malloc(size_t size);
+  void free(void *ptr);
+  void *realloc(void *ptr, size_t size);
+
+  void stats(AllocStats *out) const;
+
+private:
+  struct Slab {
+    Slab *prev; // Neighbours in the class's list of slabs with free objects
+    Slab *next;
+    void *free_list;
+    uint32_t in_use;
+    uint32_t size_class;
+  };
+
+  struct Cache {
+    Slab *partial; // Slabs with at least one free object
+    size_t allocs;
+    size_t frees;
+    size_t in_use;
+    size_t slabs;
+  };
+
+  static const uint32_t CLASS_SIZES[AllocStats::CLASS_COUNT];
+  static const size_t SLAB_HEADER = (sizeof(Slab) + 15) & ~(size_t)15;
+
+  tlsf_t pool_;
+  char *begin_;
+  size_t size_;
+  uint8_t *is_slab_; // One byte per SLAB_SIZE of the pool
+  Cache caches_[AllocStats::CLASS_COUNT];
+  size_t large_allocs_;
+  size_t large_frees_;
+  size_t bytes_in_use_;
+  size_t peak_bytes_;
+
+  static int class_of(size_t size);
+  Slab *slab_of(void *ptr) const;
+  Slab *new_slab(int size_class);
+  void unlink(Cache &c, Slab *s);
+  void note_allocated(size_t bytes) {
+    bytes_in_use_ += bytes;
+    if (bytes_in_use_ > peak_bytes_) {
+      peak_bytes_ = bytes_in_use_;
+    }
+  }
+};
+
+} // namespace ou
+
+#endif
@@ -9,112 +9,117 @@ namespace ou {
 //
 
 void string::ensure_capacity(size_t new_cap) {
-  if (new_cap <= cap_)
+  if (new_cap <= capacity())
     return;
-  size_t alloc_cap = cap_ == 0 ? 16 : cap_;
+  size_t alloc_cap = is_local() ? 2 * (LOCAL_CAPACITY + 1) : cap_;
   while (alloc_cap < new_cap)
     alloc_cap *= 2;
-  char *new_data = (char *)ou_realloc(data_, alloc_cap);
-  data_ = new_data;
+  if (is_local()) {
+    char *new_data = (char *)ou_malloc(alloc_cap);
+    memcpy(new_data, local_, len_ + 1);
+    data_ = new_data;
+  } else {
+    data_ = (char *)ou_realloc(data_, alloc_cap);
+  }
   cap_ = alloc_cap;
 }
 
-string::string() : data_(nullptr), len_(0), cap_(0) {}
+void string::assign(const char *s, size_t n) {
+  ensure_capacity(n + 1);
+  // s may point into this string, which never needs to grow in that case
+  memmove(data_, s, n);
+  len_ = n;
+  data_[len_] = '\0';
+}
 
-string::string(const char *s) : data_(nullptr), len_(0), cap_(0) {
-  if (s) {
-    len_ = strlen(s);
-    ensure_capacity(len_ + 1);
-    memcpy(data_, s, len_);
-    data_[len_] = '\0';
+void string::steal(string &other) {
+  len_ = other.len_;
+  if (other.is_local()) {
+    data_ = local_;
+    memcpy(local_, other.local_, len_ + 1);
+  } else {
+    data_ = other.data_;
+    cap_ = other.cap_;
   }
+  other.init_local();
 }
 
-string::string(const char *s, size_t n) : data_(nullptr), len_(0), cap_(0) {
-  if (s && n > 0) {
-    len_ = n;
-    ensure_capacity(len_ + 1);
-    memcpy(data_, s, len_);
-    data_[len_] = '\0';
+string::string() { init_local(); }
+
+string::string(const char *s) {
+  init_local();
+  if (s) {
+    assign(s, strlen(s));
   }
 }
 
-string::string(const string &other) : data_(nullptr), len_(0), cap_(0) {
-  if (other.len_ > 0) {
-    len_ = other.len_;
-    ensure_capacity(len_ + 1);
-    memcpy(data_, other.data_, len_);
-    data_[len_] = '\0';
+string::string(const char *s, size_t n) {
+  init_local();
+  if (s && n > 0) {
+    assign(s, n);
   }
 }
 
-string::string(string &&other) noexcept
-    : data_(other.data_), len_(other.len_), cap_(other.cap_) {
-  other.data_ = nullptr;
-  other.len_ = 0;
-  other.cap_ = 0;
+string::string(const string &other) {
+  init_local();
+  assign(other.data_, other.len_);
 }
 
+string::string(string &&other) noexcept { steal(other); }
+
 string::~string() {
-  if (data_)
+  if (!is_local())
     ou_free(data_);
 }
 
 string &string::operator=(const string &other) {
   if (this != &other) {
-    clear();
-    if (other.len_ > 0) {
-      len_ = other.len_;
-      ensure_capacity(len_ + 1);
-      memcpy(data_, other.data_, len_);
-      data_[len_] = '\0';
-    }
+    assign(other.data_, other.len_);
   }
   return *this;
 }
 
 string &string::operator=(string &&other) noexcept {
   if (this != &other) {
-    if (data_)
+    if (!is_local())
       ou_free(data_);
-    data_ = other.data_;
-    len_ = other.len_;
-    cap_ = other.cap_;
-    other.data_ = nullptr;
-    other.len_ = 0;
-    other.cap_ = 0;
+    steal(other);
   }
   return *this;
 }
 
 string &string::operator=(const char *s) {
-  clear();
   if (s) {
-    len_ = strlen(s);
-    ensure_capacity(len_ + 1);
-    memcpy(data_, s, len_);
-    data_[len_] = '\0';
+    assign(s, strlen(s));
+  } else {
+    clear();
   }
   return *this;
 }
 
 void string::clear() {
   len_ = 0;
-  if (data_)
-    data_[0] = '\0';
+  data_[0] = '\0';
 }
 
 void string::reserve(size_t new_cap) { ensure_capacity(new_cap); }
 
 void string::append(const char *s, size_t n) {
   if (s && n > 0) {
-    ensure_capacity(len_ + n + 1);
+    // s may point into this string, whose bytes move (and whose inline
+    // buffer is reused for cap_) when it grows, so find them again after
+    if (s >= data_ && s < data_ + len_) {
+      size_t offset = s - data_;
+      ensure_capacity(len_ + n + 1);
+      s = data_ + offset;
+    } else {
+      ensure_capacity(len_ + n + 1);
+    }
     memcpy(data_ + len_, s, n);
     len_ += n;
     data_[len_] = '\0';
   }
 }
-
 void string::append(const char *s) {
   if (s)
     append(s, strlen(s));
@@ -181,27 +186,13 @@ string &string::operator+=(char c) {
   return *this;
 }
 
-int string::compare(const char *s) const {
-  if (!data_ && !s)
-    return 0;
-  if (!data_)
-    return -1;
-  if (!s)
-    return 1;
-  return strcmp(data_, s);
-}
+int string::compare(const char *s) const { return strcmp(data_, s ? s : ""); }
 
 int string::compare(const string &s) const { return compare(s.data_); }
 
 int string::compare(const string_view &s) const {
-  if (!data_ && !s.data_)
-    return 0;
-  if (!data_)
-    return -1;
-  if (!s.data_)
-    return 1;
   size_t minlen = len_ < s.len_ ? len_ : s.len_;
-  int cmp = memcmp(data_, s.data_, minlen);
+  int cmp = memcmp(data_, s.data(), minlen);
   if (cmp == 0)
     return len_ < s.len_ ? -1 : (len_ > s.len_ ? 1 : 0);
   return cmp;
@@ -221,4 +212,64 @@ string string::substr(size_t pos) const {
   return string(data_ + pos, len_ - pos);
 }
 
+//
+// SHARED STRING IMPLEMENTATION
+//
+
+void shared_string::init(const char *s, size_t n) {
+  if (!s || n == 0) {
+    block_ = nullptr;
+    return;
+  }
+  block_ = (Block *)ou_malloc(sizeof(Block) + n);
+  block_->refs = 1;
+  block_->len = n;
+  memcpy(block_->data, s, n);
+  block_->data[n] = '\0';
+}
+
+void shared_string::release() {
+  if (block_ && --block_->refs == 0) {
+    ou_free(block_);
+  }
+  block_ = nullptr;
+}
+
+shared_string::shared_string(const char *s) { init(s, s ? strlen(s) : 0); }
+
+shared_string::shared_string(const char *s, size_t n) { init(s, n); }
+
+shared_string::shared_string(const string &s) { init(s.data(), s.length()); }
+
+shared_string::shared_string(const string_view &s) { init(s.data(), s.length()); }
+
+shared_string &shared_string::operator=(const shared_string &other) {
+  // Take the new reference first so self-assignment keeps the block alive
+  Block *block = other.block_;
+  if (block) {
+    block->refs++;
+  }
+  release();
+  block_ = block;
+  return *this;
+}
+
+shared_string &shared_string::operator=(shared_string &&other) noexcept {
+  if (this != &other) {
+    release();
+    block_ = other.block_;
+    other.block_ = nullptr;
+  }
+  return *this;
+}
+
+int shared_string::compare(const string_view &s) const {
+  size_t len = length();
+  size_t minlen = len < s.length() ? len : s.length();
+  int cmp = memcmp(c_str(), s.data(), minlen);
+  if (cmp == 0)
+    return len < s.length() ? -1 : (len > s.length() ? 1 : 0);
+  return cmp;
+}
+
 } // namespace ou
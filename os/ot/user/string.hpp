@@ -32,13 +32,30 @@ template <typename T> void ou_delete(T *ptr) {
 struct string_view;
 
 /**
- * Lightweight string class using ou_malloc/ou_free
+ * Lightweight string class using ou_malloc/ou_free. Strings of up to
+ * LOCAL_CAPACITY characters are stored inline and never allocate.
  */
 class string {
+public:
+  static constexpr size_t LOCAL_CAPACITY = 23;
+
 private:
-  char *data_;
+  char *data_; // local_ or a heap block; always NUL-terminated
   size_t len_;
-  size_t cap_;
+  union {
+    size_t cap_; // Size of the heap block
+    char local_[LOCAL_CAPACITY + 1];
+  };
+
+  bool is_local() const { return data_ == local_; }
+  void init_local() {
+    data_ = local_;
+    len_ = 0;
+    local_[0] = '\0';
+  }
+  void assign(const char *s, size_t n);
+  // Take other's contents, leaving it empty
+  void steal(string &other);
 
 public:
   string();
@@ -54,9 +71,9 @@ public:
 
   size_t length() const { return len_; }
   size_t size() const { return len_; }
-  size_t capacity() const { return cap_; }
-  const char *c_str() const { return data_ ? data_ : ""; }
-  const char *data() const { return data_ ? data_ : ""; }
+  size_t capacity() const { return is_local() ? LOCAL_CAPACITY + 1 : cap_; }
+  const char *c_str() const { return data_; }
+  const char *data() const { return data_; }
   bool empty() const { return len_ == 0; }
 
   char operator[](size_t i) const { return data_[i]; }
@@ -91,6 +108,62 @@ public:
   void ensure_capacity(size_t new_cap);
 };
 
+/**
+ * Immutable reference-counted string, for values that are copied much more
+ * often than they are changed. The characters live in one heap block shared
+ * by every copy, so copying and assignment only adjust a count. The empty
+ * string uses no block at all.
+ */
+class shared_string {
+  struct Block {
+    size_t refs;
+    size_t len;
+    char data[1]; // len + 1 bytes, NUL-terminated
+  };
+
+  Block *block_;
+
+  void init(const char *s, size_t n);
+  void release();
+
+public:
+  shared_string() : block_(nullptr) {}
+  shared_string(const char *s);
+  shared_string(const char *s, size_t n);
+  shared_string(const string &s);
+  shared_string(const string_view &s);
+  shared_string(const shared_string &other) : block_(other.block_) {
+    if (block_)
+      block_->refs++;
+  }
+  shared_string(shared_string &&other) noexcept : block_(other.block_) { other.block_ = nullptr; }
+  ~shared_string() { release(); }
+
+  shared_string &operator=(const shared_string &other);
+  shared_string &operator=(shared_string &&other) noexcept;
+
+  size_t length() const { return block_ ? block_->len : 0; }
+  size_t size() const { return length(); }
+  bool empty() const { return block_ == nullptr; }
+  const char *c_str() const { return block_ ? block_->data : ""; }
+  const char *data() const { return c_str(); }
+  char operator[](size_t i) const { return block_->data[i]; }
+
+  /** Number of shared_strings sharing these characters (0 for the empty string) */
+  size_t use_count() const { return block_ ? block_->refs : 0; }
+  /** A mutable copy */
+  string str() const { return string(c_str(), length()); }
+
+  int compare(const char *s) const { return strcmp(c_str(), s ? s : ""); }
+  int compare(const shared_string &s) const { return block_ == s.block_ ? 0 : compare(s.c_str()); }
+  int compare(const string_view &s) const;
+
+  bool operator==(const shared_string &other) const { return compare(other) == 0; }
+  bool operator==(const char *s) const { return compare(s) == 0; }
+  bool operator!=(const shared_string &other) const { return compare(other) != 0; }
+  bool operator!=(const char *s) const { return compare(s) != 0; }
+};
+
 /**
  * Lightweight string view (non-owning reference)
  */
@@ -102,6 +175,7 @@ struct string_view {
   string_view(const char *s) : data_(s), len_(s ? strlen(s) : 0) {}
   string_view(const char *s, size_t n) : data_(s), len_(n) {}
   string_view(const string &s) : data_(s.c_str()), len_(s.length()) {}
+  string_view(const shared_string &s) : data_(s.c_str()), len_(s.length()) {}
 
   const char *data() const { return data_ ? data_ : ""; }
   size_t length() const { return len_; }
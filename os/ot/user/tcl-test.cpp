@@ -3,14 +3,6 @@
 #include "ot/user/tcl.hpp"
 #include "vendor/doctest.h"
 
-#ifdef OT_POSIX
-#include <stdlib.h>
-// Provide OU memory functions for test environment
-void *ou_malloc(size_t size) { return malloc(size); }
-void ou_free(void *ptr) { free(ptr); }
-void *ou_realloc(void *ptr, size_t size) { return realloc(ptr, size); }
-#endif
-
 TEST_CASE("tcl - basic evaluation") {
   tcl::Interp i;
   tcl::register_core_commands(i);
@@ -257,6 +249,62 @@ TEST_CASE("tcl - procedures") {
     // local variable should not exist in global scope
     CHECK(i.eval("set x $local") == tcl::S_ERR);
   }
+
+  SUBCASE("arguments are local to each call") {
+    CHECK(i.eval("set n 100") == tcl::S_OK);
+    CHECK(i.eval("proc fib {n} {if {< $n 2} {return $n}; return [+ [fib [- $n 1]] [fib [- $n 2]]]}") == tcl::S_OK);
+    CHECK(i.eval("fib 10") == tcl::S_OK);
+    CHECK(i.result.compare("55") == 0);
+    CHECK(i.get_var(tcl::string_view("n"))->value().compare("100") == 0);
+  }
+
+  SUBCASE("callers' variables are visible and set in place") {
+    CHECK(i.eval("proc bump {} {set count [+ $count 1]}") == tcl::S_OK);
+    CHECK(i.eval("proc outer {} {set count 0; bump; bump; return $count}") == tcl::S_OK);
+    CHECK(i.eval("outer") == tcl::S_OK);
+    CHECK(i.result.compare("2") == 0);
+    CHECK(!i.get_var(tcl::string_view("count")));
+    CHECK(i.eval("set count 10; bump") == tcl::S_OK);
+    CHECK(i.get_var(tcl::string_view("count"))->value().compare("11") == 0);
+  }
+
+  SUBCASE("variable names cache their slot") {
+    CHECK(i.eval("proc loop {k} {set total 0; while {> $k 0} {set total [+ $total $k]; set k [- $k 1]}; "
+                 "return $total}") == tcl::S_OK);
+    CHECK(i.eval("loop 4") == tcl::S_OK);
+    CHECK(i.result.compare("10") == 0);
+    tcl::Cmd *c = i.get_command("loop");
+    CHECK(c->privdata->locals->names.size() == 2);
+    // $total in the last command
+    CHECK(c->privdata->compiled->literals.back()->kind == tcl::Obj::LOCAL);
+    CHECK(i.eval("loop 5") == tcl::S_OK);
+    CHECK(i.result.compare("15") == 0);
+  }
+
+  SUBCASE("frames, variables and word vectors are reused") {
+    CHECK(i.eval("proc sq {x} {* $x $x}; proc sum {a b} {+ [sq $a] [sq $b]}") == tcl::S_OK);
+    CHECK(i.eval("sum 3 4") == tcl::S_OK);
+    CHECK(i.result.compare("25") == 0);
+    size_t frames = i.frame_pool_.size();
+    size_t vars = i.var_pool_.size();
+    size_t levels = i.argv_stack_.size();
+    CHECK(frames == 2);
+    CHECK(vars == 3);
+    CHECK(i.eval("sum 5 12; sum 8 15") == tcl::S_OK);
+    CHECK(i.result.compare("289") == 0);
+    CHECK(i.frame_pool_.size() == frames);
+    CHECK(i.var_pool_.size() == vars);
+    CHECK(i.argv_stack_.size() == levels);
+    CHECK(i.argv_depth_ == 0);
+  }
+
+  SUBCASE("globals are found by name") {
+    CHECK(i.eval("set a 1; set b 2; set c 3") == tcl::S_OK);
+    CHECK(i.globals_.size() == 3);
+    CHECK(i.get_var(tcl::string_view("b"))->value().compare("2") == 0);
+    i.set_var("b", "two");
+    CHECK(i.get_var(tcl::string_view("b"))->value().compare("two") == 0);
+  }
 }
 
 TEST_CASE("tcl - command substitution") {
@@ -948,84 +996,84 @@ TEST_CASE("tcl - escape sequences in quoted strings") {
     CHECK(i.eval("set x \"hello \\\"world\\\"\"") == tcl::S_OK);
     tcl::Var *v = i.get_var(tcl::string_view("x"));
     CHECK(v != nullptr);
-    CHECK(v->val->compare("hello \"world\"") == 0);
+    CHECK(v->value().compare("hello \"world\"") == 0);
   }
 
   SUBCASE("escaped backslash") {
     CHECK(i.eval("set x \"path\\\\to\\\\file\"") == tcl::S_OK);
     tcl::Var *v = i.get_var(tcl::string_view("x"));
     CHECK(v != nullptr);
-    CHECK(v->val->compare("path\\to\\file") == 0);
+    CHECK(v->value().compare("path\\to\\file") == 0);
   }
 
   SUBCASE("newline escape") {
     CHECK(i.eval("set x \"line1\\nline2\"") == tcl::S_OK);
     tcl::Var *v = i.get_var(tcl::string_view("x"));
     CHECK(v != nullptr);
-    CHECK(v->val->compare("line1\nline2") == 0);
+    CHECK(v->value().compare("line1\nline2") == 0);
   }
 
   SUBCASE("tab escape") {
     CHECK(i.eval("set x \"col1\\tcol2\"") == tcl::S_OK);
     tcl::Var *v = i.get_var(tcl::string_view("x"));
     CHECK(v != nullptr);
-    CHECK(v->val->compare("col1\tcol2") == 0);
+    CHECK(v->value().compare("col1\tcol2") == 0);
   }
 
   SUBCASE("carriage return escape") {
     CHECK(i.eval("set x \"text\\rmore\"") == tcl::S_OK);
     tcl::Var *v = i.get_var(tcl::string_view("x"));
     CHECK(v != nullptr);
-    CHECK(v->val->compare("text\rmore") == 0);
+    CHECK(v->value().compare("text\rmore") == 0);
   }
 
   SUBCASE("mixed escapes") {
     CHECK(i.eval("set x \"say \\\"hi\\\\there\\\"\"") == tcl::S_OK);
     tcl::Var *v = i.get_var(tcl::string_view("x"));
     CHECK(v != nullptr);
-    CHECK(v->val->compare("say \"hi\\there\"") == 0);
+    CHECK(v->value().compare("say \"hi\\there\"") == 0);
   }
 
   SUBCASE("escape at start and end") {
     CHECK(i.eval("set x \"\\\"quoted\\\"\"") == tcl::S_OK);
     tcl::Var *v = i.get_var(tcl::string_view("x"));
     CHECK(v != nullptr);
-    CHECK(v->val->compare("\"quoted\"") == 0);
+    CHECK(v->value().compare("\"quoted\"") == 0);
   }
 
   SUBCASE("unknown escape passes through") {
     CHECK(i.eval("set x \"test\\xvalue\"") == tcl::S_OK);
     tcl::Var *v = i.get_var(tcl::string_view("x"));
     CHECK(v != nullptr);
-    CHECK(v->val->compare("test\\xvalue") == 0);
+    CHECK(v->value().compare("test\\xvalue") == 0);
   }
 
   SUBCASE("no escapes - unchanged behavior") {
     CHECK(i.eval("set x \"hello world\"") == tcl::S_OK);
     tcl::Var *v = i.get_var(tcl::string_view("x"));
     CHECK(v != nullptr);
-    CHECK(v->val->compare("hello world") == 0);
+    CHECK(v->value().compare("hello world") == 0);
   }
 
   SUBCASE("braced strings unchanged") {
     CHECK(i.eval("set x {no \\\"escape\\\" here}") == tcl::S_OK);
     tcl::Var *v = i.get_var(tcl::string_view("x"));
     CHECK(v != nullptr);
-    CHECK(v->val->compare("no \\\"escape\\\" here") == 0);
+    CHECK(v->value().compare("no \\\"escape\\\" here") == 0);
   }
 
   SUBCASE("empty string with escapes") {
     CHECK(i.eval("set x \"\\\"\\\"\"") == tcl::S_OK);
     tcl::Var *v = i.get_var(tcl::string_view("x"));
     CHECK(v != nullptr);
-    CHECK(v->val->compare("\"\"") == 0);
+    CHECK(v->value().compare("\"\"") == 0);
   }
 
   SUBCASE("multiple newlines") {
     CHECK(i.eval("set x \"a\\nb\\nc\"") == tcl::S_OK);
     tcl::Var *v = i.get_var(tcl::string_view("x"));
     CHECK(v != nullptr);
-    CHECK(v->val->compare("a\nb\nc") == 0);
+    CHECK(v->value().compare("a\nb\nc") == 0);
   }
 }
 
@@ -1089,3 +1137,244 @@ TEST_CASE("tcl - lloop") {
     CHECK(i.eval("lloop {a b c} {x y z} { puts $x }") == tcl::S_ERR);
   }
 }
+
+TEST_CASE("tcl - bytecode") {
+  tcl::Interp i;
+  tcl::register_core_commands(i);
+
+  SUBCASE("compile splits words into literals, variables and substitutions") {
+    tcl::Script *s = tcl::compile("set x $y\nputs {a b}[+ 1 2]");
+    CHECK(s->code.size() == 8);
+    CHECK(s->code[0].op == tcl::OP_PUSH_LIT);
+    CHECK(s->code[1].op == tcl::OP_PUSH_LIT);
+    CHECK(s->code[2].op == tcl::OP_PUSH_VAR);
+    CHECK(s->code[3].op == tcl::OP_INVOKE);
+    CHECK(s->code[5].op == tcl::OP_PUSH_LIT);
+    CHECK(s->code[6].op == tcl::OP_APPEND_CMD);
+    CHECK(s->code[7].op == tcl::OP_INVOKE);
+    CHECK(s->children.size() == 1);
+    CHECK(s->commands.size() == 2);
+    tcl::script_release(s);
+  }
+
+  SUBCASE("eval reuses compiled scripts") {
+    CHECK(i.eval("set n 0") == tcl::S_OK);
+    CHECK(i.eval("while {< $n 10} { set n [+ $n 1] }") == tcl::S_OK);
+    size_t cached = i.script_cache_list_.size();
+    CHECK(i.eval("while {< $n 20} { set n [+ $n 1] }") == tcl::S_OK);
+    // Only the new outer script and condition; the body is shared
+    CHECK(i.script_cache_list_.size() == cached + 2);
+    CHECK(i.eval("set n") != tcl::S_OK);
+    CHECK(i.eval("+ $n 0") == tcl::S_OK);
+    CHECK(i.result.compare("20") == 0);
+  }
+
+  SUBCASE("escapes are processed at compile time") {
+    CHECK(i.eval("set x \"a\\tb\"") == tcl::S_OK);
+    CHECK(i.eval("list $x") == tcl::S_OK);
+    CHECK(i.result.compare("{a\tb}") == 0);
+  }
+
+  SUBCASE("command defined after the first failed lookup") {
+    CHECK(i.eval("proc run {} { later }") == tcl::S_OK);
+    CHECK(i.eval("run") == tcl::S_ERR);
+    CHECK(i.eval("proc later {} { return 7 }") == tcl::S_OK);
+    CHECK(i.eval("run") == tcl::S_OK);
+    CHECK(i.result.compare("7") == 0);
+  }
+
+  SUBCASE("proc redefined while it runs") {
+    CHECK(i.eval("proc f {} { proc f {} { return 2 }; return 1 }") == tcl::S_OK);
+    CHECK(i.eval("f") == tcl::S_OK);
+    CHECK(i.result.compare("1") == 0);
+    CHECK(i.eval("f") == tcl::S_OK);
+    CHECK(i.result.compare("2") == 0);
+  }
+
+  SUBCASE("cache flush while scripts are running") {
+    CHECK(i.eval("set n 0") == tcl::S_OK);
+    // Every iteration evaluates a distinct script, overflowing the cache
+    CHECK(i.eval("while {< $n 300} { eval [list set last $n]; set n [+ $n 1] }") == tcl::S_OK);
+    CHECK(i.script_cache_list_.size() <= tcl::Interp::SCRIPT_CACHE_MAX);
+    CHECK(i.eval("+ $last 0") == tcl::S_OK);
+    CHECK(i.result.compare("299") == 0);
+  }
+}
+
+static tcl::Status cmd_upper(tcl::Interp &i, tcl::vector<tcl::string> &argv, tcl::ProcPrivdata *privdata) {
+  i.result = argv[1];
+  for (size_t j = 0; j < i.result.length(); j++) {
+    if (i.result[j] >= 'a' && i.result[j] <= 'z') {
+      i.result[j] = i.result[j] - 'a' + 'A';
+    }
+  }
+  return tcl::S_OK;
+}
+
+TEST_CASE("tcl - values") {
+  tcl::Interp i;
+  tcl::register_core_commands(i);
+
+  SUBCASE("integer form is cached and the string made on demand") {
+    tcl::Obj *o = tcl::obj_new("42");
+    int value = 0;
+    CHECK(tcl::obj_int(o, &value));
+    CHECK(value == 42);
+    CHECK(o->kind == tcl::Obj::INT);
+    CHECK(o->str.compare("42") == 0);
+    tcl::obj_decr(o);
+
+    o = tcl::obj_new_int(-7);
+    CHECK(!o->has_string);
+    CHECK(tcl::obj_string(o).compare("-7") == 0);
+    tcl::obj_decr(o);
+
+    o = tcl::obj_new("4x");
+    CHECK(!tcl::obj_int(o, &value));
+    CHECK(o->kind == tcl::Obj::STRING);
+    tcl::obj_decr(o);
+  }
+
+  SUBCASE("arithmetic results stay integers in variables") {
+    CHECK(i.eval("set n [+ 1 2]") == tcl::S_OK);
+    tcl::Var *v = i.get_var(tcl::string_view("n"));
+    CHECK(v->val->kind == tcl::Obj::INT);
+    CHECK(v->value().compare("3") == 0);
+  }
+
+  SUBCASE("list form round trips through the string form") {
+    tcl::Obj *o = tcl::obj_new("a {b c} {}");
+    tcl::vector<tcl::Obj *> *elements = tcl::obj_list(o);
+    CHECK(elements->size() == 3);
+    CHECK(tcl::obj_string((*elements)[1]).compare("b c") == 0);
+    CHECK(tcl::obj_string((*elements)[2]).empty());
+    // The original string is kept until the list changes
+    CHECK(o->has_string);
+    elements->push_back(tcl::obj_new("d"));
+    tcl::obj_invalidate_string(o);
+    CHECK(tcl::obj_string(o).compare("a {b c} {} d") == 0);
+    tcl::obj_decr(o);
+  }
+
+  SUBCASE("lappend extends an unshared list in place") {
+    CHECK(i.eval("set l [list a]") == tcl::S_OK);
+    tcl::Obj *before = i.get_var(tcl::string_view("l"))->val;
+    CHECK(i.eval("lappend l b; lappend l c") == tcl::S_OK);
+    CHECK(i.get_var(tcl::string_view("l"))->val == before);
+    CHECK(i.result.compare("a b c") == 0);
+  }
+
+  SUBCASE("lappend copies a shared list") {
+    CHECK(i.eval("set a [list x]; set b $a; lappend b y") == tcl::S_OK);
+    CHECK(i.get_var(tcl::string_view("a"))->value().compare("x") == 0);
+    CHECK(i.get_var(tcl::string_view("b"))->value().compare("x y") == 0);
+  }
+
+  SUBCASE("appending to a word doesn't change the variable it came from") {
+    CHECK(i.eval("set a x; set b \"$a y\"") == tcl::S_OK);
+    CHECK(i.get_var(tcl::string_view("a"))->value().compare("x") == 0);
+    CHECK(i.get_var(tcl::string_view("b"))->value().compare("x y") == 0);
+  }
+
+  SUBCASE("loop bodies are compiled once and kept on the value") {
+    CHECK(i.eval("set n 0; while {< $n 5} { set n [+ $n 1] }") == tcl::S_OK);
+    size_t cached = i.script_cache_list_.size();
+    CHECK(i.eval("set n 0; while {< $n 5} { set n [+ $n 1] }") == tcl::S_OK);
+    CHECK(i.script_cache_list_.size() == cached);
+    CHECK(i.eval("+ $n 0") == tcl::S_OK);
+    CHECK(i.result.compare("5") == 0);
+  }
+
+  SUBCASE("string commands see values as strings") {
+    i.register_command("upper", cmd_upper);
+    CHECK(i.eval("set l [list a b]; upper [lindex $l 1][+ 1 1]") == tcl::S_OK);
+    CHECK(i.result.compare("B2") == 0);
+    CHECK(i.eval("llength [upper {x y z}]") == tcl::S_OK);
+    CHECK(i.result.compare("3") == 0);
+  }
+}
+
+TEST_CASE("tcl - expr") {
+  tcl::Interp i;
+  tcl::register_core_commands(i);
+
+  SUBCASE("precedence and parentheses") {
+    CHECK(i.eval("expr {1 + 2 * 3}") == tcl::S_OK);
+    CHECK(i.result.compare("7") == 0);
+    CHECK(i.eval("expr {(1 + 2) * 3}") == tcl::S_OK);
+    CHECK(i.result.compare("9") == 0);
+    CHECK(i.eval("expr {1 << 4 | 1 == 1}") == tcl::S_OK);
+    CHECK(i.result.compare("17") == 0);
+    CHECK(i.eval("expr {-2 * -3 + ~0 + !0 - 0x10}") == tcl::S_OK);
+    CHECK(i.result.compare("-10") == 0);
+    CHECK(i.eval("expr {7 / 2 + 7 % 2}") == tcl::S_OK);
+    CHECK(i.result.compare("4") == 0);
+  }
+
+  SUBCASE("overflowing division and shifts") {
+    CHECK(i.eval("expr {(-2147483647 - 1) / -1}") == tcl::S_OK);
+    CHECK(i.result.compare("-2147483648") == 0);
+    CHECK(i.eval("expr {(-2147483647 - 1) % -1}") == tcl::S_OK);
+    CHECK(i.result.compare("0") == 0);
+    CHECK(i.eval("expr {-1 << 4}") == tcl::S_OK);
+    CHECK(i.result.compare("-16") == 0);
+    CHECK(i.eval("expr {-16 >> 2}") == tcl::S_OK);
+    CHECK(i.result.compare("-4") == 0);
+    CHECK(i.eval("expr {1 << 32}") == tcl::S_ERR);
+    CHECK(i.eval("expr {1 >> -1}") == tcl::S_ERR);
+  }
+
+  SUBCASE("variables and command substitution") {
+    CHECK(i.eval("set a 3; set b 4; expr {$a * $a + $b * $b == [* 5 5]}") == tcl::S_OK);
+    CHECK(i.result.compare("1") == 0);
+  }
+
+  SUBCASE("&& and || short-circuit") {
+    CHECK(i.eval("set hit 0; expr {0 && [set hit 1]}") == tcl::S_OK);
+    CHECK(i.result.compare("0") == 0);
+    CHECK(i.eval("expr {5 || [set hit 1]}") == tcl::S_OK);
+    CHECK(i.result.compare("1") == 0);
+    CHECK(i.get_var(tcl::string_view("hit"))->value().compare("0") == 0);
+    CHECK(i.eval("expr {2 && 3}") == tcl::S_OK);
+    CHECK(i.result.compare("1") == 0);
+  }
+
+  SUBCASE("ternary") {
+    CHECK(i.eval("set n 5; expr {$n > 3 ? $n * 2 : 0}") == tcl::S_OK);
+    CHECK(i.result.compare("10") == 0);
+    CHECK(i.eval("expr {0 ? 1 : 1 ? 2 : 3}") == tcl::S_OK);
+    CHECK(i.result.compare("2") == 0);
+  }
+
+  SUBCASE("errors") {
+    CHECK(i.eval("expr {1 / 0}") == tcl::S_ERR);
+    CHECK(i.eval("expr {1 % 0}") == tcl::S_ERR);
+    CHECK(i.eval("expr {1 +}") == tcl::S_ERR);
+    CHECK(i.eval("expr {(1 + 2}") == tcl::S_ERR);
+    CHECK(i.eval("expr {1 2}") == tcl::S_ERR);
+    CHECK(i.eval("expr {$missing}") == tcl::S_ERR);
+    CHECK(i.eval("set s abc; expr {$s + 1}") == tcl::S_ERR);
+  }
+
+  SUBCASE("compiled form is cached on the value and by source") {
+    CHECK(i.eval("set n 0; while {< $n 10} { set n [expr {$n + 1}] }") == tcl::S_OK);
+    CHECK(i.get_var(tcl::string_view("n"))->value().compare("10") == 0);
+    CHECK(i.expr_cache_list_.size() == 1);
+
+    tcl::Obj *o = tcl::obj_new("$n * 2");
+    tcl::Expr *e = tcl::obj_expr(i, o);
+    CHECK(e != nullptr);
+    CHECK(o->kind == tcl::Obj::EXPR);
+    CHECK(tcl::obj_expr(i, o) == e);
+    int value = 0;
+    CHECK(i.eval_expr(e, &value) == tcl::S_OK);
+    CHECK(value == 20);
+    tcl::obj_decr(o);
+    CHECK(i.expr_cache_list_.size() == 2);
+  }
+
+  SUBCASE("several arguments are joined with spaces") {
+    CHECK(i.eval("expr 1 + 2 * 3") == tcl::S_OK);
+    CHECK(i.result.compare("7") == 0);
+  }
+}
@@ -271,15 +271,293 @@ Token Parser::next_token() {
   return t;
 }
 
+//
+// VALUES
+//
+
+// Drop the internal form, leaving only the string
+static void obj_free_internal(Obj *o) {
+  if (o->kind == Obj::LIST) {
+    for (Obj *elem : *o->list) {
+      obj_decr(elem);
+    }
+    ou_delete(o->list);
+  } else if (o->kind == Obj::SCRIPT) {
+    script_release(o->script);
+  } else if (o->kind == Obj::EXPR) {
+    expr_release(o->expr);
+  }
+  o->kind = Obj::STRING;
+}
+
+Obj::~Obj() { obj_free_internal(this); }
+
+Obj *obj_new(const string_view &str) {
+  Obj *o = ou_new<Obj>();
+  o->str = string(str.data(), str.length());
+  return o;
+}
+
+Obj *obj_new(string &&str) {
+  Obj *o = ou_new<Obj>();
+  o->str = static_cast<string &&>(str);
+  return o;
+}
+
+Obj *obj_new_int(int value) {
+  Obj *o = ou_new<Obj>();
+  o->has_string = false;
+  o->kind = Obj::INT;
+  o->int_val = value;
+  return o;
+}
+
+Obj *obj_new_list(vector<Obj *> &&elements) {
+  Obj *o = ou_new<Obj>();
+  o->has_string = false;
+  o->kind = Obj::LIST;
+  o->list = ou_new<vector<Obj *>>(static_cast<vector<Obj *> &&>(elements));
+  return o;
+}
+
+void obj_decr(Obj *o) {
+  if (--o->refs == 0) {
+    ou_delete(o);
+  }
+}
+
+const string &obj_string(Obj *o) {
+  if (!o->has_string) {
+    o->str.clear();
+    if (o->kind == Obj::INT) {
+      char buf[16];
+      snprintf(buf, sizeof(buf), "%d", o->int_val);
+      o->str = buf;
+    } else if (o->kind == Obj::LIST) {
+      for (Obj *elem : *o->list) {
+        list_append_element(o->str, obj_string(elem));
+      }
+    }
+    o->has_string = true;
+  }
+  return o->str;
+}
+
+bool obj_int(Obj *o, int *out) {
+  if (o->kind != Obj::INT) {
+    BoolResult<int> res = parse_and_check_int(obj_string(o));
+    if (res.is_err()) {
+      return false;
+    }
+    obj_free_internal(o);
+    o->kind = Obj::INT;
+    o->int_val = res.value();
+  }
+  *out = o->int_val;
+  return true;
+}
+
+vector<Obj *> *obj_list(Obj *o) {
+  if (o->kind != Obj::LIST) {
+    small_vector<string, 8> parts;
+    list_parse(string_view(obj_string(o)), parts);
+    vector<Obj *> *elements = ou_new<vector<Obj *>>();
+    for (string &part : parts) {
+      elements->push_back(obj_new(static_cast<string &&>(part)));
+    }
+    obj_free_internal(o);
+    o->kind = Obj::LIST;
+    o->list = elements;
+  }
+  return o->list;
+}
+
+Script *obj_script(Interp &i, Obj *o) {
+  if (o->kind != Obj::SCRIPT) {
+    Script *script = i.compile_cached(string_view(obj_string(o)));
+    obj_free_internal(o);
+    o->kind = Obj::SCRIPT;
+    o->script = script;
+  }
+  return o->script;
+}
+
+Expr *obj_expr(Interp &i, Obj *o) {
+  if (o->kind != Obj::EXPR) {
+    Expr *e = i.compile_expr_cached(string_view(obj_string(o)));
+    if (!e) {
+      return nullptr;
+    }
+    obj_free_internal(o);
+    o->kind = Obj::EXPR;
+    o->expr = e;
+  }
+  return o->expr;
+}
+
+void obj_invalidate_string(Obj *o) { o->has_string = false; }
+
+// Slot of a variable name in a proc, cached on the name
+static uint32_t obj_local_slot(Obj *name, Locals *locals) {
+  if (name->kind == Obj::LOCAL && name->local.locals_id == locals->id) {
+    return name->local.slot;
+  }
+  uint32_t slot = locals->slot_of(string_view(obj_string(name)));
+  obj_free_internal(name);
+  name->kind = Obj::LOCAL;
+  name->local.locals_id = locals->id;
+  name->local.slot = slot;
+  return slot;
+}
+
+//
+// COMPILER
+//
+
+Script::~Script() {
+  for (Obj *lit : literals) {
+    obj_decr(lit);
+  }
+  for (Script *child : children) {
+    script_release(child);
+  }
+}
+
+void script_release(Script *s) {
+  if (--s->refs == 0) {
+    ou_delete(s);
+  }
+}
+
+static void emit(Script *s, Opcode op, uint32_t arg, bool escapes = false) {
+  Instr in;
+  in.op = op;
+  in.escapes = escapes;
+  in.arg = arg;
+  s->code.push_back(in);
+}
+
+static uint32_t add_literal(Script *s, string &&lit) {
+  s->literals.push_back(obj_new(static_cast<string &&>(lit)));
+  return s->literals.size() - 1;
+}
+
+// Walks the source with the same token loop the interpreter used to evaluate
+// directly, but records how each word is built instead of building it
+Script *compile(const string_view &source, bool trace_parser) {
+  Script *s = ou_new<Script>();
+  s->source = string(source.data(), source.length());
+
+  Parser p(string_view(s->source), trace_parser);
+  size_t words = 0;
+  bool name_is_literal = false; // First word is a single literal, so its lookup can be cached
+
+  while (1) {
+    TokenType prevtype = p.token;
+    Token token = p.next_token();
+    string_view t = p.token_body();
+
+    if (token == TK_EOF) {
+      break;
+    } else if (token == TK_SEP) {
+      continue;
+    } else if (token == TK_EOL) {
+      if (words) {
+        uint32_t slot = Script::NO_SLOT;
+        if (name_is_literal) {
+          s->commands.push_back(nullptr);
+          slot = s->commands.size() - 1;
+        }
+        emit(s, OP_INVOKE, slot);
+      }
+      words = 0;
+      continue;
+    }
+
+    bool start = prevtype == TK_SEP || prevtype == TK_EOL || words == 0;
+    if (token == TK_VAR) {
+      emit(s, start ? OP_PUSH_VAR : OP_APPEND_VAR, add_literal(s, string(t.data(), t.length())), p.has_escapes());
+    } else if (token == TK_CMD) {
+      s->children.push_back(compile(t, trace_parser));
+      emit(s, start ? OP_PUSH_CMD : OP_APPEND_CMD, s->children.size() - 1, p.has_escapes());
+    } else {
+      string lit = p.has_escapes() ? process_escapes(t) : string(t.data(), t.length());
+      emit(s, start ? OP_PUSH_LIT : OP_APPEND_LIT, add_literal(s, static_cast<string &&>(lit)));
+    }
+
+    if (start) {
+      words++;
+      if (words == 1) {
+        name_is_literal = token != TK_VAR && token != TK_CMD;
+      }
+    } else if (words == 1) {
+      name_is_literal = false;
+    }
+  }
+  return s;
+}
+
 //
 // PRIVDATA IMPLEMENTATIONS
 //
 
-ProcPrivdata::ProcPrivdata(string *args_, string *body_) : args(args_), body(body_) {}
+static uint32_t next_locals_id = 1;
+
+Locals::Locals() : id(next_locals_id++), refs(1) {}
+
+void locals_release(Locals *l) {
+  if (--l->refs == 0) {
+    ou_delete(l);
+  }
+}
+
+bool Locals::find(const string_view &name, uint32_t *slot) {
+  uint32_t *found = slots.find(name.data(), name.length());
+  if (!found) {
+    return false;
+  }
+  *slot = *found;
+  return true;
+}
+
+uint32_t Locals::slot_of(const string_view &name) {
+  uint32_t slot;
+  if (find(name, &slot)) {
+    return slot;
+  }
+  slot = names.size();
+  slots.insert(name.data(), name.length(), slot);
+  names.push_back(string_view(slots.stored_key(name.data(), name.length()), name.length()));
+  return slot;
+}
+
+ProcPrivdata::ProcPrivdata(string *args_, string *body_)
+    : args(args_), body(body_), compiled(nullptr), locals(ou_new<Locals>()) {
+  // Parse arguments list; the arguments take the first slots
+  size_t j = 0, start = 0;
+  for (; j < args->size(); j++) {
+    while (j < args->size() && args->at(j) == ' ') {
+      j++;
+    }
+    start = j;
+    while (j < args->size() && args->at(j) != ' ') {
+      j++;
+    }
+    arg_slots.push_back(locals->slot_of(string_view(args->data() + start, j - start)));
+    if (j >= args->size())
+      break;
+  }
+}
 
 ProcPrivdata::~ProcPrivdata() {
   ou_delete(args);
   ou_delete(body);
+  if (compiled) {
+    script_release(compiled);
+  }
+  if (locals) {
+    locals_release(locals);
+  }
 }
 
 //
@@ -287,7 +565,7 @@ ProcPrivdata::~ProcPrivdata() {
 //
 
 Cmd::Cmd(const string &name_, cmd_func_t func_, ProcPrivdata *privdata_, const string &docstring_)
-    : name(name_), func(func_), privdata(privdata_), docstring(docstring_) {}
+    : name(name_), func(func_), obj_func(nullptr), privdata(privdata_), docstring(docstring_) {}
 
 Cmd::~Cmd() {
   if (privdata)
@@ -299,25 +577,38 @@ Cmd::~Cmd() {
 //
 
 Var::~Var() {
-  ou_delete(name);
-  ou_delete(val);
+  if (val) {
+    obj_decr(val);
+  }
 }
 
 //
 // CALLFRAME IMPLEMENTATION
 //
 
+CallFrame::CallFrame(Locals *locals_) : locals(locals_) {
+  if (locals) {
+    locals_acquire(locals);
+    slots.resize(locals->names.size(), nullptr);
+  }
+}
+
 CallFrame::~CallFrame() {
   for (Var *v : vars) {
     ou_delete(v);
   }
+  if (locals) {
+    locals_release(locals);
+  }
 }
 
 //
 // INTERP IMPLEMENTATION
 //
 
-Interp::Interp() : trace_parser(false), mpack_buffer_(nullptr), mpack_buffer_size_(0), io_(nullptr) {
+Interp::Interp()
+    : result_obj(nullptr), trace_parser(false), mpack_buffer_(nullptr), mpack_buffer_size_(0), io_(nullptr),
+      argv_depth_(0) {
   callframes.push_back(ou_new<CallFrame>());
 }
 
@@ -340,18 +631,62 @@ void Interp::write_error(const char *str) {
 }
 
 Interp::~Interp() {
+  reset_result();
+  flush_script_cache();
+  flush_expr_cache();
   for (CallFrame *cf : callframes) {
     ou_delete(cf);
   }
   for (Cmd *c : commands) {
     ou_delete(c);
   }
+  for (CallFrame *cf : frame_pool_) {
+    ou_delete(cf);
+  }
+  for (Var *v : var_pool_) {
+    ou_delete(v);
+  }
+  for (Argv *a : argv_stack_) {
+    ou_delete(a);
+  }
+}
+
+CallFrame *Interp::push_call_frame(Locals *locals) {
+  CallFrame *cf;
+  if (frame_pool_.empty()) {
+    cf = ou_new<CallFrame>(locals);
+  } else {
+    cf = frame_pool_.back();
+    frame_pool_.pop_back();
+    cf->locals = locals;
+    if (locals) {
+      locals_acquire(locals);
+      cf->slots.resize(locals->names.size(), nullptr);
+    }
+  }
+  callframes.push_back(cf);
+  return cf;
 }
 
 void Interp::drop_call_frame() {
   CallFrame *cf = callframes.back();
   callframes.pop_back();
-  ou_delete(cf);
+
+  // Keep the frame and its variables for the next call
+  for (Var *v : cf->vars) {
+    if (v->val) {
+      obj_decr(v->val);
+      v->val = nullptr;
+    }
+    var_pool_.push_back(v);
+  }
+  cf->vars.clear();
+  cf->slots.clear();
+  if (cf->locals) {
+    locals_release(cf->locals);
+    cf->locals = nullptr;
+  }
+  frame_pool_.push_back(cf);
 }
 
 Cmd *Interp::get_command(const string &name) const {
@@ -368,6 +703,7 @@ Status Interp::register_command(const string &name, cmd_func_t fn, ProcPrivdata
       ou_delete(existing->privdata);
     }
     existing->func = fn;
+    existing->obj_func = nullptr;
     existing->privdata = privdata;
     existing->docstring = docstring;
     return S_OK;
@@ -379,32 +715,161 @@ Status Interp::register_command(const string &name, cmd_func_t fn, ProcPrivdata
   return S_OK;
 }
 
-Var *Interp::get_var(const string_view &name) {
+Status Interp::register_obj_command(const string &name, obj_cmd_func_t fn, ProcPrivdata *privdata,
+                                    const string &docstring) {
+  register_command(name, nullptr, privdata, docstring);
+  get_command(name)->obj_func = fn;
+  return S_OK;
+}
+
+Var *Interp::get_var(const string_view &name) { return find_var(callframes.size() - 1, name); }
+
+Var *Interp::get_var(Obj *name) {
+  size_t top = callframes.size() - 1;
+  if (top > 0) {
+    CallFrame *cf = callframes[top];
+    uint32_t slot = obj_local_slot(name, cf->locals);
+    if (slot < cf->slots.size() && cf->slots[slot]) {
+      return cf->slots[slot];
+    }
+    top--;
+  }
+  return find_var(top, string_view(obj_string(name)));
+}
+
+Var *Interp::find_var(size_t frame, const string_view &name) {
   // Search from innermost to outermost scope
-  for (int i = callframes.size() - 1; i >= 0; i--) {
-    for (Var *v : callframes[i]->vars) {
-      if (v->name->compare(name) == 0) {
-        return v;
-      }
+  for (; frame > 0; frame--) {
+    CallFrame *cf = callframes[frame];
+    uint32_t slot;
+    if (cf->locals->find(name, &slot) && slot < cf->slots.size() && cf->slots[slot]) {
+      return cf->slots[slot];
+    }
+  }
+  Var **global = globals_.find(name.data(), name.length());
+  return global ? *global : nullptr;
+}
+
+Var *Interp::create_var(const string_view &name, uint32_t slot) {
+  CallFrame *cf = callframes.back();
+  Var *v;
+  if (var_pool_.empty()) {
+    v = ou_new<Var>();
+  } else {
+    v = var_pool_.back();
+    var_pool_.pop_back();
+  }
+  v->name.clear();
+  v->name.append(name.data(), name.length());
+  cf->vars.push_back(v);
+  if (cf->locals) {
+    if (slot == Script::NO_SLOT) {
+      slot = cf->locals->slot_of(name);
     }
+    if (slot >= cf->slots.size()) {
+      cf->slots.resize(cf->locals->names.size(), nullptr);
+    }
+    cf->slots[slot] = v;
+  } else {
+    globals_.insert(v->name.data(), v->name.length(), v);
+  }
+  return v;
+}
+
+static void var_assign(Var *v, Obj *val) {
+  obj_incr(val);
+  if (v->val) {
+    obj_decr(v->val);
   }
-  return nullptr;
+  v->val = val;
 }
 
 Status Interp::set_var(const string &name, const string &val) {
   Var *v = get_var(string_view(name));
-  if (v) {
-    ou_delete(v->val);
-    v->val = ou_new<string>(val);
-  } else {
-    v = ou_new<Var>();
-    v->name = ou_new<string>(name);
-    v->val = ou_new<string>(val);
-    callframes.back()->vars.push_back(v);
+  if (v && v->val->refs == 1) {
+    // Nothing else holds the value, so update it in place and keep its capacity
+    obj_free_internal(v->val);
+    v->val->str = val;
+    v->val->has_string = true;
+    return S_OK;
+  }
+  Obj *o = obj_new(string_view(val));
+  if (!v) {
+    v = create_var(string_view(name), Script::NO_SLOT);
+  }
+  var_assign(v, o);
+  obj_decr(o);
+  return S_OK;
+}
+
+Status Interp::set_var(const string_view &name, Obj *val) {
+  Var *v = get_var(name);
+  if (!v) {
+    v = create_var(name, Script::NO_SLOT);
+  }
+  var_assign(v, val);
+  return S_OK;
+}
+
+Status Interp::set_var(Obj *name, Obj *val) {
+  size_t top = callframes.size() - 1;
+  if (top == 0) {
+    return set_var(string_view(obj_string(name)), val);
+  }
+  CallFrame *cf = callframes[top];
+  uint32_t slot = obj_local_slot(name, cf->locals);
+  Var *v = slot < cf->slots.size() ? cf->slots[slot] : nullptr;
+  if (!v) {
+    v = find_var(top - 1, string_view(obj_string(name)));
+    if (!v) {
+      v = create_var(string_view(obj_string(name)), slot);
+    }
   }
+  var_assign(v, val);
   return S_OK;
 }
 
+void Interp::set_result(Obj *o) {
+  if (result_obj) {
+    obj_decr(result_obj);
+  }
+  result_obj = o;
+}
+
+void Interp::reset_result() {
+  set_result(nullptr);
+  result.clear();
+}
+
+Obj *Interp::take_result() {
+  Obj *o = result_obj;
+  if (o) {
+    result_obj = nullptr;
+  } else {
+    o = obj_new(static_cast<string &&>(result));
+    result.clear();
+  }
+  return o;
+}
+
+void Interp::sync_result() {
+  if (result_obj) {
+    result = obj_string(result_obj);
+    set_result(nullptr);
+  }
+}
+
+Status Interp::error(const char *fmt, ...) {
+  char buffer[4096];
+  va_list args;
+  va_start(args, fmt);
+  vsnprintf(buffer, sizeof(buffer), fmt, args);
+  va_end(args);
+  set_result(nullptr);
+  result = buffer;
+  return S_ERR;
+}
+
 
 bool Interp::int_check(const string &name, const vector<string> &argv, size_t idx) {
   const string &arg = argv[idx];
@@ -421,99 +886,204 @@ bool Interp::int_check(const string &name, const vector<string> &argv, size_t id
 }
 
 Status Interp::eval(const string_view &str) {
-  result.clear();
-  Parser p(str, trace_parser);
+  Script *script = compile_cached(str);
+  Status s = exec(script);
+  script_release(script);
+  // Callers read result, so hand back a value result as a string
+  sync_result();
+  return s;
+}
+
+Script *Interp::compile_cached(const string_view &source) {
+  if (source.length() > SCRIPT_CACHE_MAX_SOURCE) {
+    return compile(source, trace_parser);
+  }
+  Script **cached = script_cache_.find(source.data(), source.length());
+  if (cached) {
+    script_acquire(*cached);
+    return *cached;
+  }
+
+  if (script_cache_list_.size() >= SCRIPT_CACHE_MAX) {
+    flush_script_cache();
+  }
+  Script *script = compile(source, trace_parser);
+  // The cache keeps its own reference; the key is the script's copy of its source
+  script_acquire(script);
+  script_cache_list_.push_back(script);
+  script_cache_.insert(script->source, script);
+  return script;
+}
+
+void Interp::flush_script_cache() {
+  script_cache_.clear();
+  for (Script *script : script_cache_list_) {
+    script_release(script);
+  }
+  script_cache_list_.clear();
+}
+
+//
+// VM
+//
+
+// Append to the word being built, copying it first if anything else holds it
+static void append_to_word(vector<Obj *> &objv, const string &tail) {
+  Obj *&word = objv[objv.size() - 1];
+  if (word->refs > 1) {
+    Obj *copy = obj_new(string_view(obj_string(word)));
+    obj_decr(word);
+    word = copy;
+  } else {
+    obj_string(word);
+    obj_free_internal(word);
+  }
+  word->str += tail;
+}
+
+// String commands get the words as strings and leave their result in result
+static Status call_string_command(Interp &i, Cmd *c, vector<Obj *> &objv) {
+  i.sync_result();
+  vector<string> &argv = i.argv_stack_[i.argv_depth_ - 1]->argv;
+  for (Obj *o : objv) {
+    argv.push_back(obj_string(o));
+  }
+  Status s = c->func(i, argv, c->privdata);
+  argv.clear();
+  return s;
+}
+
+Status Interp::exec(Script *script) {
+  reset_result();
+  script_acquire(script);
+
   Status ret = S_OK;
-  vector<string> argv;
+  if (argv_depth_ == argv_stack_.size()) {
+    argv_stack_.push_back(ou_new<Argv>());
+  }
+  vector<Obj *> &objv = argv_stack_[argv_depth_++]->objv;
+  const Instr *code = script->code.data();
+  size_t count = script->code.size();
 
-  while (1) {
-    TokenType prevtype = p.token;
-    Token token = p.next_token();
-    string_view t = p.token_body();
+  for (size_t pc = 0; pc < count && ret == S_OK; pc++) {
+    const Instr &in = code[pc];
+    Obj *value = nullptr;
 
-    if (token == TK_EOF) {
-      break;
-    } else if (token == TK_VAR) {
-      Var *v = get_var(t);
+    switch (in.op) {
+    case OP_PUSH_LIT:
+      obj_incr(script->literals[in.arg]);
+      objv.push_back(script->literals[in.arg]);
+      continue;
+    case OP_APPEND_LIT:
+      append_to_word(objv, obj_string(script->literals[in.arg]));
+      continue;
+    case OP_PUSH_VAR:
+    case OP_APPEND_VAR: {
+      Var *v = get_var(script->literals[in.arg]);
       if (v == nullptr) {
-        format_error(result, "variable not found: '%.*s'", (int)t.length(), t.data());
-        return S_ERR;
+        ret = error("variable not found: '%s'", obj_string(script->literals[in.arg]).c_str());
+        continue;
       }
-      t = string_view(*v->val);
-    } else if (token == TK_CMD) {
-      ret = eval(t);
+      value = v->val;
+      obj_incr(value);
+      break;
+    }
+    case OP_PUSH_CMD:
+    case OP_APPEND_CMD:
+      ret = exec(script->children[in.arg]);
       if (ret != S_OK) {
-        return ret;
+        continue;
       }
-      t = string_view(result);
-    } else if (token == TK_SEP) {
-      continue;
-    } else if (token == TK_EOL) {
-      Cmd *c;
-      if (argv.size()) {
-        if ((c = get_command(argv[0])) == nullptr) {
-          format_error(result, "command not found: '%s'", argv[0].c_str());
-          return S_ERR;
+      value = take_result();
+      break;
+    case OP_INVOKE: {
+      Cmd *c = in.arg != Script::NO_SLOT ? script->commands[in.arg] : nullptr;
+      if (!c) {
+        const string &name = obj_string(objv[0]);
+        if ((c = get_command(name)) == nullptr) {
+          ret = error("command not found: '%s'", name.c_str());
+          continue;
         }
-        Status s = c->func(*this, argv, c->privdata);
-        if (s != S_OK) {
-          return s;
+        if (in.arg != Script::NO_SLOT) {
+          script->commands[in.arg] = c;
         }
       }
-      argv.clear();
+      ret = c->obj_func ? c->obj_func(*this, objv, c->privdata) : call_string_command(*this, c, objv);
+      for (Obj *o : objv) {
+        obj_decr(o);
+      }
+      objv.clear();
       continue;
     }
+    }
 
-    string token_str = p.has_escapes() ? process_escapes(t) : string(t.data(), t.length());
-    if (prevtype == TK_SEP || prevtype == TK_EOL) {
-      argv.push_back(token_str);
+    // Substituted variable or command result
+    if (in.escapes) {
+      Obj *escaped = obj_new(process_escapes(string_view(obj_string(value))));
+      obj_decr(value);
+      value = escaped;
+    }
+    if (in.op == OP_PUSH_VAR || in.op == OP_PUSH_CMD) {
+      objv.push_back(value);
     } else {
-      argv[argv.size() - 1] += token_str;
+      append_to_word(objv, obj_string(value));
+      obj_decr(value);
     }
-    prevtype = token;
   }
-  return S_OK;
+
+  for (Obj *o : objv) {
+    obj_decr(o);
+  }
+  objv.clear();
+  argv_depth_--;
+  script_release(script);
+  return ret;
 }
 
 //
 // CALL_PROC IMPLEMENTATION
 //
 
-Status call_proc(Interp &i, vector<string> &argv, ProcPrivdata *pd) {
-  CallFrame *cf = ou_new<CallFrame>();
-  i.callframes.push_back(cf);
+// Give the variables a proc body refers to their slots up front, caching
+// each slot on the name
+static void resolve_locals(Script *s, Locals *locals) {
+  for (const Instr &in : s->code) {
+    if (in.op == OP_PUSH_VAR || in.op == OP_APPEND_VAR) {
+      obj_local_slot(s->literals[in.arg], locals);
+    }
+  }
+  for (Script *child : s->children) {
+    resolve_locals(child, locals);
+  }
+}
 
-  size_t arity = 0;
-  string *alist = pd->args;
-  string *body = pd->body;
+Status call_proc(Interp &i, vector<Obj *> &objv, ProcPrivdata *pd) {
+  size_t arity = pd->arg_slots.size();
+  if (arity != objv.size() - 1) {
+    return i.error("wrong number of arguments for %s got %zu expected %zu", obj_string(objv[0]).c_str(),
+                   objv.size(), arity);
+  }
 
-  // Parse arguments list
-  size_t j = 0, start = 0;
-  for (; j < alist->size(); j++) {
-    while (j < alist->size() && alist->at(j) == ' ') {
-      j++;
-    }
-    start = j;
-    while (j < alist->size() && alist->at(j) != ' ') {
-      j++;
+  CallFrame *cf = i.push_call_frame(pd->locals);
+
+  // Arguments are always created in the new frame, even if a caller has a
+  // variable of the same name
+  for (size_t k = 0; k < arity; k++) {
+    uint32_t slot = pd->arg_slots[k];
+    Var *v = cf->slots[slot];
+    if (!v) {
+      v = i.create_var(pd->locals->names[slot], slot);
     }
-    // Got argument
-    i.set_var(alist->substr(start, j - start), argv[arity + 1]);
-    arity++;
-    if (j >= alist->size())
-      break;
+    var_assign(v, objv[k + 1]);
   }
 
-  Status s = S_OK;
-  if (arity != argv.size() - 1) {
-    format_error(i.result, "wrong number of arguments for %s got %zu expected %zu", argv[0].c_str(), argv.size(),
-                 arity);
-    s = S_ERR;
-  } else {
-    s = i.eval(string_view(*body));
-    if (s == S_RETURN) {
-      s = S_OK;
-    }
+  if (!pd->compiled) {
+    pd->compiled = compile(string_view(*pd->body), i.trace_parser);
+    resolve_locals(pd->compiled, pd->locals);
+  }
+  Status s = i.exec(pd->compiled);
+  if (s == S_RETURN) {
+    s = S_OK;
   }
 
   i.drop_call_frame();
@@ -524,51 +1094,61 @@ Status call_proc(Interp &i, vector<string> &argv, ProcPrivdata *pd) {
 // STDLIB COMMANDS
 //
 
-static Status cmd_puts(Interp &i, vector<string> &argv, ProcPrivdata *privdata) {
-  if (!i.arity_check("puts", argv, 2, 2)) {
+static Status cmd_puts(Interp &i, vector<Obj *> &objv, ProcPrivdata *privdata) {
+  if (!i.arity_check("puts", objv, 2, 2)) {
     return S_ERR;
   }
   // Build string with newline and use write()
   char buf[4096];
-  snprintf(buf, sizeof(buf), "%s\n", argv[1].c_str());
+  snprintf(buf, sizeof(buf), "%s\n", obj_string(objv[1]).c_str());
   i.write(buf);
   return S_OK;
 }
 
-static Status cmd_set(Interp &i, vector<string> &argv, ProcPrivdata *privdata) {
-  if (!i.arity_check("set", argv, 3, 3)) {
+static Status cmd_set(Interp &i, vector<Obj *> &objv, ProcPrivdata *privdata) {
+  if (!i.arity_check("set", objv, 3, 3)) {
     return S_ERR;
   }
-  i.set_var(argv[1], argv[2]);
+  i.set_var(objv[1], objv[2]);
   return S_OK;
 }
 
-static Status cmd_if(Interp &i, vector<string> &argv, ProcPrivdata *privdata) {
-  if (!i.arity_check("if", argv, 3, 5)) {
+static bool is_true(Obj *o) {
+  int value;
+  return obj_int(o, &value) ? value != 0 : atoi(obj_string(o).c_str()) != 0;
+}
+
+static bool result_is_true(Interp &i) { return i.result_obj ? is_true(i.result_obj) : atoi(i.result.c_str()) != 0; }
+
+// Run a value as a script, compiling it on first use
+static Status exec_obj(Interp &i, Obj *o) { return i.exec(obj_script(i, o)); }
+
+static Status cmd_if(Interp &i, vector<Obj *> &objv, ProcPrivdata *privdata) {
+  if (!i.arity_check("if", objv, 3, 5)) {
     return S_ERR;
   }
-  if (i.eval(string_view(argv[1])) != S_OK) {
+  if (exec_obj(i, objv[1]) != S_OK) {
     return S_ERR;
   }
-  if (atoi(i.result.c_str())) {
-    return i.eval(string_view(argv[2]));
-  } else if (argv.size() == 5) {
-    return i.eval(string_view(argv[4]));
+  if (result_is_true(i)) {
+    return exec_obj(i, objv[2]);
+  } else if (objv.size() == 5) {
+    return exec_obj(i, objv[4]);
   }
   return S_OK;
 }
 
-static Status cmd_while(Interp &i, vector<string> &argv, ProcPrivdata *privdata) {
-  if (!i.arity_check("while", argv, 3, 3)) {
+static Status cmd_while(Interp &i, vector<Obj *> &objv, ProcPrivdata *privdata) {
+  if (!i.arity_check("while", objv, 3, 3)) {
     return S_ERR;
   }
   while (1) {
-    Status s = i.eval(string_view(argv[1]));
+    Status s = exec_obj(i, objv[1]);
     if (s != S_OK) {
       return s;
     }
-    if (atoi(i.result.c_str())) {
-      s = i.eval(string_view(argv[2]));
+    if (result_is_true(i)) {
+      s = exec_obj(i, objv[2]);
       if (s == S_CONTINUE || s == S_OK) {
         continue;
       } else if (s == S_BREAK) {
@@ -583,293 +1163,187 @@ static Status cmd_while(Interp &i, vector<string> &argv, ProcPrivdata *privdata)
   return S_OK;
 }
 
-static Status cmd_break(Interp &i, vector<string> &argv, ProcPrivdata *privdata) {
-  if (!i.arity_check("break", argv, 1, 1)) {
+static Status cmd_break(Interp &i, vector<Obj *> &objv, ProcPrivdata *privdata) {
+  if (!i.arity_check("break", objv, 1, 1)) {
     return S_ERR;
   }
   return S_BREAK;
 }
 
-static Status cmd_continue(Interp &i, vector<string> &argv, ProcPrivdata *privdata) {
-  if (!i.arity_check("continue", argv, 1, 1)) {
+static Status cmd_continue(Interp &i, vector<Obj *> &objv, ProcPrivdata *privdata) {
+  if (!i.arity_check("continue", objv, 1, 1)) {
     return S_ERR;
   }
   return S_CONTINUE;
 }
 
-static Status cmd_proc(Interp &i, vector<string> &argv, ProcPrivdata *privdata) {
-  if (!i.arity_check("proc", argv, 4, 4)) {
+static Status cmd_proc(Interp &i, vector<Obj *> &objv, ProcPrivdata *privdata) {
+  if (!i.arity_check("proc", objv, 4, 4)) {
     return S_ERR;
   }
-  ProcPrivdata *ppd = ou_new<ProcPrivdata>(ou_new<string>(argv[2]), ou_new<string>(argv[3]));
-  i.register_command(argv[1], call_proc, ppd);
+  ProcPrivdata *ppd = ou_new<ProcPrivdata>(ou_new<string>(obj_string(objv[2])), ou_new<string>(obj_string(objv[3])));
+  i.register_obj_command(obj_string(objv[1]), call_proc, ppd);
   return S_OK;
 }
 
-static Status cmd_return(Interp &i, vector<string> &argv, ProcPrivdata *privdata) {
-  if (!i.arity_check("return", argv, 1, 2)) {
+static Status cmd_return(Interp &i, vector<Obj *> &objv, ProcPrivdata *privdata) {
+  if (!i.arity_check("return", objv, 1, 2)) {
     return S_ERR;
   }
-  if (argv.size() == 2) {
-    i.result = argv[1];
+  if (objv.size() == 2) {
+    obj_incr(objv[1]);
+    i.set_result(objv[1]);
   }
   return S_RETURN;
 }
 
-static Status cmd_add(Interp &i, vector<string> &argv, ProcPrivdata *privdata) {
-  if (!i.arity_check("+", argv, 3, 3)) {
-    return S_ERR;
+// Arguments of a binary integer command, using their cached integer forms
+static bool int_args(Interp &i, const char *name, vector<Obj *> &objv, int *a, int *b) {
+  if (!i.arity_check(name, objv, 3, 3)) {
+    return false;
   }
-  auto a = parse_and_check_int(argv[1]);
-  auto b = parse_and_check_int(argv[2]);
-  if (a.is_err() || b.is_err()) {
-    format_error(i.result, "[+]: arguments must be integers");
-    return S_ERR;
+  if (!obj_int(objv[1], a) || !obj_int(objv[2], b)) {
+    i.error("[%s]: arguments must be integers", name);
+    return false;
   }
-  int result = a.value() + b.value();
-  char buf[32];
-  snprintf(buf, sizeof(buf), "%d", result);
-  i.result = buf;
-  return S_OK;
+  return true;
 }
 
-static Status cmd_sub(Interp &i, vector<string> &argv, ProcPrivdata *privdata) {
-  if (!i.arity_check("-", argv, 3, 3)) {
-    return S_ERR;
-  }
-  auto a = parse_and_check_int(argv[1]);
-  auto b = parse_and_check_int(argv[2]);
-  if (a.is_err() || b.is_err()) {
-    format_error(i.result, "[-]: arguments must be integers");
+static Status cmd_add(Interp &i, vector<Obj *> &objv, ProcPrivdata *privdata) {
+  int a, b;
+  if (!int_args(i, "+", objv, &a, &b)) {
     return S_ERR;
   }
-  int result = a.value() - b.value();
-  char buf[32];
-  snprintf(buf, sizeof(buf), "%d", result);
-  i.result = buf;
+  i.set_result_int(a + b);
   return S_OK;
 }
 
-static Status cmd_mul(Interp &i, vector<string> &argv, ProcPrivdata *privdata) {
-  if (!i.arity_check("*", argv, 3, 3)) {
-    return S_ERR;
-  }
-  auto a = parse_and_check_int(argv[1]);
-  auto b = parse_and_check_int(argv[2]);
-  if (a.is_err() || b.is_err()) {
-    format_error(i.result, "[*]: arguments must be integers");
+static Status cmd_sub(Interp &i, vector<Obj *> &objv, ProcPrivdata *privdata) {
+  int a, b;
+  if (!int_args(i, "-", objv, &a, &b)) {
     return S_ERR;
   }
-  int result = a.value() * b.value();
-  char buf[32];
-  snprintf(buf, sizeof(buf), "%d", result);
-  i.result = buf;
+  i.set_result_int(a - b);
   return S_OK;
 }
 
-static Status cmd_div(Interp &i, vector<string> &argv, ProcPrivdata *privdata) {
-  if (!i.arity_check("/", argv, 3, 3)) {
-    return S_ERR;
-  }
-  auto a = parse_and_check_int(argv[1]);
-  auto b = parse_and_check_int(argv[2]);
-  if (a.is_err() || b.is_err()) {
-    format_error(i.result, "[/]: arguments must be integers");
+static Status cmd_mul(Interp &i, vector<Obj *> &objv, ProcPrivdata *privdata) {
+  int a, b;
+  if (!int_args(i, "*", objv, &a, &b)) {
     return S_ERR;
   }
-  int result = a.value() / b.value();
-  char buf[32];
-  snprintf(buf, sizeof(buf), "%d", result);
-  i.result = buf;
+  i.set_result_int(a * b);
   return S_OK;
 }
 
-static Status cmd_mod(Interp &i, vector<string> &argv, ProcPrivdata *privdata) {
-  if (!i.arity_check("%", argv, 3, 3)) {
-    return S_ERR;
-  }
-  auto a = parse_and_check_int(argv[1]);
-  auto b = parse_and_check_int(argv[2]);
-  if (a.is_err() || b.is_err()) {
-    format_error(i.result, "[%]: arguments must be integers");
+static Status cmd_div(Interp &i, vector<Obj *> &objv, ProcPrivdata *privdata) {
+  int a, b;
+  if (!int_args(i, "/", objv, &a, &b)) {
     return S_ERR;
   }
-  int result = a.value() % b.value();
-  char buf[32];
-  snprintf(buf, sizeof(buf), "%d", result);
-  i.result = buf;
+  i.set_result_int(a / b);
   return S_OK;
 }
 
-static Status cmd_and(Interp &i, vector<string> &argv, ProcPrivdata *privdata) {
-  if (!i.arity_check("&", argv, 3, 3)) {
-    return S_ERR;
-  }
-  auto a = parse_and_check_int(argv[1]);
-  auto b = parse_and_check_int(argv[2]);
-  if (a.is_err() || b.is_err()) {
-    format_error(i.result, "[&]: arguments must be integers");
+static Status cmd_mod(Interp &i, vector<Obj *> &objv, ProcPrivdata *privdata) {
+  int a, b;
+  if (!int_args(i, "%", objv, &a, &b)) {
     return S_ERR;
   }
-  int result = a.value() & b.value();
-  char buf[32];
-  snprintf(buf, sizeof(buf), "%d", result);
-  i.result = buf;
+  i.set_result_int(a % b);
   return S_OK;
 }
 
-static Status cmd_shl(Interp &i, vector<string> &argv, ProcPrivdata *privdata) {
-  if (!i.arity_check("<<", argv, 3, 3)) {
-    return S_ERR;
-  }
-  auto a = parse_and_check_int(argv[1]);
-  auto b = parse_and_check_int(argv[2]);
-  if (a.is_err() || b.is_err()) {
-    format_error(i.result, "[<<]: arguments must be integers");
+static Status cmd_and(Interp &i, vector<Obj *> &objv, ProcPrivdata *privdata) {
+  int a, b;
+  if (!int_args(i, "&", objv, &a, &b)) {
     return S_ERR;
   }
-  int result = a.value() << b.value();
-  char buf[32];
-  snprintf(buf, sizeof(buf), "%d", result);
-  i.result = buf;
+  i.set_result_int(a & b);
   return S_OK;
 }
 
-static Status cmd_shr(Interp &i, vector<string> &argv, ProcPrivdata *privdata) {
-  if (!i.arity_check(">>", argv, 3, 3)) {
-    return S_ERR;
-  }
-  auto a = parse_and_check_int(argv[1]);
-  auto b = parse_and_check_int(argv[2]);
-  if (a.is_err() || b.is_err()) {
-    format_error(i.result, "[>>]: arguments must be integers");
+static Status cmd_shl(Interp &i, vector<Obj *> &objv, ProcPrivdata *privdata) {
+  int a, b;
+  if (!int_args(i, "<<", objv, &a, &b)) {
     return S_ERR;
   }
-  int result = a.value() >> b.value();
-  char buf[32];
-  snprintf(buf, sizeof(buf), "%d", result);
-  i.result = buf;
+  i.set_result_int(a << b);
   return S_OK;
 }
 
-static Status cmd_eq(Interp &i, vector<string> &argv, ProcPrivdata *privdata) {
-  if (!i.arity_check("==", argv, 3, 3)) {
-    return S_ERR;
-  }
-  auto a = parse_and_check_int(argv[1]);
-  auto b = parse_and_check_int(argv[2]);
-  if (a.is_err() || b.is_err()) {
-    format_error(i.result, "[==]: arguments must be integers");
+static Status cmd_shr(Interp &i, vector<Obj *> &objv, ProcPrivdata *privdata) {
+  int a, b;
+  if (!int_args(i, ">>", objv, &a, &b)) {
     return S_ERR;
   }
-  int result = a.value() == b.value();
-  char buf[32];
-  snprintf(buf, sizeof(buf), "%d", result);
-  i.result = buf;
+  i.set_result_int(a >> b);
   return S_OK;
 }
 
-static Status cmd_ne(Interp &i, vector<string> &argv, ProcPrivdata *privdata) {
-  if (!i.arity_check("!=", argv, 3, 3)) {
-    return S_ERR;
-  }
-  auto a = parse_and_check_int(argv[1]);
-  auto b = parse_and_check_int(argv[2]);
-  if (a.is_err() || b.is_err()) {
-    format_error(i.result, "[!=]: arguments must be integers");
+static Status cmd_eq(Interp &i, vector<Obj *> &objv, ProcPrivdata *privdata) {
+  int a, b;
+  if (!int_args(i, "==", objv, &a, &b)) {
     return S_ERR;
   }
-  int result = a.value() != b.value();
-  char buf[32];
-  snprintf(buf, sizeof(buf), "%d", result);
-  i.result = buf;
+  i.set_result_int(a == b);
   return S_OK;
 }
 
-static Status cmd_gt(Interp &i, vector<string> &argv, ProcPrivdata *privdata) {
-  if (!i.arity_check(">", argv, 3, 3)) {
-    return S_ERR;
-  }
-  auto a = parse_and_check_int(argv[1]);
-  auto b = parse_and_check_int(argv[2]);
-  if (a.is_err() || b.is_err()) {
-    format_error(i.result, "[>]: arguments must be integers");
+static Status cmd_ne(Interp &i, vector<Obj *> &objv, ProcPrivdata *privdata) {
+  int a, b;
+  if (!int_args(i, "!=", objv, &a, &b)) {
     return S_ERR;
   }
-  int result = a.value() > b.value();
-  char buf[32];
-  snprintf(buf, sizeof(buf), "%d", result);
-  i.result = buf;
+  i.set_result_int(a != b);
   return S_OK;
 }
 
-static Status cmd_lt(Interp &i, vector<string> &argv, ProcPrivdata *privdata) {
-  if (!i.arity_check("<", argv, 3, 3)) {
-    return S_ERR;
-  }
-  auto a = parse_and_check_int(argv[1]);
-  auto b = parse_and_check_int(argv[2]);
-  if (a.is_err() || b.is_err()) {
-    format_error(i.result, "[<]: arguments must be integers");
+static Status cmd_gt(Interp &i, vector<Obj *> &objv, ProcPrivdata *privdata) {
+  int a, b;
+  if (!int_args(i, ">", objv, &a, &b)) {
     return S_ERR;
   }
-  int result = a.value() < b.value();
-  char buf[32];
-  snprintf(buf, sizeof(buf), "%d", result);
-  i.result = buf;
+  i.set_result_int(a > b);
   return S_OK;
 }
 
-static Status cmd_gte(Interp &i, vector<string> &argv, ProcPrivdata *privdata) {
-  if (!i.arity_check(">=", argv, 3, 3)) {
-    return S_ERR;
-  }
-  auto a = parse_and_check_int(argv[1]);
-  auto b = parse_and_check_int(argv[2]);
-  if (a.is_err() || b.is_err()) {
-    format_error(i.result, "[>=]: arguments must be integers");
+static Status cmd_lt(Interp &i, vector<Obj *> &objv, ProcPrivdata *privdata) {
+  int a, b;
+  if (!int_args(i, "<", objv, &a, &b)) {
     return S_ERR;
   }
-  int result = a.value() >= b.value();
-  char buf[32];
-  snprintf(buf, sizeof(buf), "%d", result);
-  i.result = buf;
+  i.set_result_int(a < b);
   return S_OK;
 }
 
-static Status cmd_lte(Interp &i, vector<string> &argv, ProcPrivdata *privdata) {
-  if (!i.arity_check("<=", argv, 3, 3)) {
-    return S_ERR;
-  }
-  auto a = parse_and_check_int(argv[1]);
-  auto b = parse_and_check_int(argv[2]);
-  if (a.is_err() || b.is_err()) {
-    format_error(i.result, "[<=]: arguments must be integers");
+static Status cmd_gte(Interp &i, vector<Obj *> &objv, ProcPrivdata *privdata) {
+  int a, b;
+  if (!int_args(i, ">=", objv, &a, &b)) {
     return S_ERR;
   }
-  int result = a.value() <= b.value();
-  char buf[32];
-  snprintf(buf, sizeof(buf), "%d", result);
-  i.result = buf;
+  i.set_result_int(a >= b);
   return S_OK;
 }
 
-static Status cmd_notn(Interp &i, vector<string> &argv, ProcPrivdata *privdata) {
-  if (!i.arity_check("!", argv, 2, 2)) {
-    return S_ERR;
-  }
-  if (!i.int_check("!", argv, 1)) {
+static Status cmd_lte(Interp &i, vector<Obj *> &objv, ProcPrivdata *privdata) {
+  int a, b;
+  if (!int_args(i, "<=", objv, &a, &b)) {
     return S_ERR;
   }
+  i.set_result_int(a <= b);
+  return S_OK;
+}
 
-  BoolResult<int> res = parse_int(argv[1].c_str());
-  if (res.is_err()) {
+static Status cmd_notn(Interp &i, vector<Obj *> &objv, ProcPrivdata *privdata) {
+  if (!i.arity_check("!", objv, 2, 2)) {
     return S_ERR;
   }
-  int result = !res.value();
-  char buf[10];
-  snprintf(buf, sizeof(buf), "%d", result);
-  i.result = buf;
+  int value;
+  if (!obj_int(objv[1], &value)) {
+    return i.error("[!]: argument 1 is not an integer");
+  }
+  i.set_result_int(!value);
   return S_OK;
 }
 
@@ -990,30 +1464,34 @@ void list_parse(const string_view &list_str, vector<string> &elements) {
   }
 }
 
+// Append an element to a list string, bracing it if needed
+void list_append_element(string &result, const string &elem) {
+  if (!result.empty())
+    result += ' ';
+  // Check if element needs braces (empty strings, strings with whitespace, or strings with braces)
+  bool needs_braces = (elem.length() == 0);
+  if (!needs_braces) {
+    for (size_t j = 0; j < elem.length(); j++) {
+      if (elem[j] == ' ' || elem[j] == '\t' || elem[j] == '\n' || elem[j] == '{' || elem[j] == '}') {
+        needs_braces = true;
+        break;
+      }
+    }
+  }
+  if (needs_braces) {
+    result += '{';
+    result += elem;
+    result += '}';
+  } else {
+    result += elem;
+  }
+}
+
 // Format a vector of elements as a list string
 void list_format(const vector<string> &elements, string &result) {
   result.clear();
   for (size_t i = 0; i < elements.size(); i++) {
-    if (i > 0)
-      result += ' ';
-    const string &elem = elements[i];
-    // Check if element needs braces (empty strings, strings with whitespace, or strings with braces)
-    bool needs_braces = (elem.length() == 0);
-    if (!needs_braces) {
-      for (size_t j = 0; j < elem.length(); j++) {
-        if (elem[j] == ' ' || elem[j] == '\t' || elem[j] == '\n' || elem[j] == '{' || elem[j] == '}') {
-          needs_braces = true;
-          break;
-        }
-      }
-    }
-    if (needs_braces) {
-      result += '{';
-      result += elem;
-      result += '}';
-    } else {
-      result += elem;
-    }
+    list_append_element(result, elements[i]);
   }
 }
 
@@ -1021,73 +1499,80 @@ void list_format(const vector<string> &elements, string &result) {
 // LIST COMMANDS
 //
 
-static Status cmd_list(Interp &i, vector<string> &argv, ProcPrivdata *privdata) {
-  // Create a list from all arguments (argv[1..n])
-  vector<string> elements;
-  for (size_t j = 1; j < argv.size(); j++) {
-    elements.push_back(argv[j]);
+static Status cmd_list(Interp &i, vector<Obj *> &objv, ProcPrivdata *privdata) {
+  // Create a list from all arguments (objv[1..n])
+  vector<Obj *> elements;
+  for (size_t j = 1; j < objv.size(); j++) {
+    obj_incr(objv[j]);
+    elements.push_back(objv[j]);
   }
-  list_format(elements, i.result);
+  i.set_result(obj_new_list(static_cast<vector<Obj *> &&>(elements)));
   return S_OK;
 }
 
-static Status cmd_lindex(Interp &i, vector<string> &argv, ProcPrivdata *privdata) {
-  if (!i.arity_check("lindex", argv, 3, 3)) {
+static Status cmd_lindex(Interp &i, vector<Obj *> &objv, ProcPrivdata *privdata) {
+  if (!i.arity_check("lindex", objv, 3, 3)) {
     return S_ERR;
   }
-  if (!i.int_check("lindex", argv, 2)) {
-    return S_ERR;
+  int index;
+  if (!obj_int(objv[2], &index)) {
+    return i.error("[lindex]: argument 2 is not an integer");
   }
 
-  vector<string> elements;
-  list_parse(string_view(argv[1]), elements);
-
-  int index = atoi(argv[2].c_str());
-  if (index < 0 || (size_t)index >= elements.size()) {
-    i.result.clear();
+  vector<Obj *> *elements = obj_list(objv[1]);
+  if (index < 0 || (size_t)index >= elements->size()) {
+    i.reset_result();
     return S_OK;
   }
 
-  i.result = elements[index];
+  Obj *elem = (*elements)[index];
+  obj_incr(elem);
+  i.set_result(elem);
   return S_OK;
 }
 
-static Status cmd_lappend(Interp &i, vector<string> &argv, ProcPrivdata *privdata) {
-  if (!i.arity_check("lappend", argv, 2, 1024)) {
+static Status cmd_lappend(Interp &i, vector<Obj *> &objv, ProcPrivdata *privdata) {
+  if (!i.arity_check("lappend", objv, 2, 1024)) {
     return S_ERR;
   }
+  // The result is about to be replaced; drop it so it doesn't count as a
+  // second owner of the list
+  i.reset_result();
 
-  // Get current list from variable
-  Var *v = i.get_var(string_view(argv[1]));
-  vector<string> elements;
-  if (v) {
-    list_parse(string_view(*v->val), elements);
+  // Append in place when the variable is the list's only owner
+  Var *v = i.get_var(string_view(obj_string(objv[1])));
+  Obj *list;
+  if (v && v->val->refs == 1) {
+    list = v->val;
+    obj_list(list);
+    obj_incr(list);
+  } else {
+    vector<Obj *> elements;
+    if (v) {
+      vector<Obj *> *old = obj_list(v->val);
+      for (Obj *elem : *old) {
+        obj_incr(elem);
+        elements.push_back(elem);
+      }
+    }
+    list = obj_new_list(static_cast<vector<Obj *> &&>(elements));
+    i.set_var(string_view(obj_string(objv[1])), list);
   }
 
-  // Append new elements
-  for (size_t j = 2; j < argv.size(); j++) {
-    elements.push_back(argv[j]);
+  for (size_t j = 2; j < objv.size(); j++) {
+    obj_incr(objv[j]);
+    list->list->push_back(objv[j]);
   }
-
-  // Format and store back
-  string new_list;
-  list_format(elements, new_list);
-  i.set_var(argv[1], new_list);
-  i.result = new_list;
+  obj_invalidate_string(list);
+  i.set_result(list);
   return S_OK;
 }
 
-static Status cmd_llength(Interp &i, vector<string> &argv, ProcPrivdata *privdata) {
-  if (!i.arity_check("llength", argv, 2, 2)) {
+static Status cmd_llength(Interp &i, vector<Obj *> &objv, ProcPrivdata *privdata) {
+  if (!i.arity_check("llength", objv, 2, 2)) {
     return S_ERR;
   }
-
-  vector<string> elements;
-  list_parse(string_view(argv[1]), elements);
-
-  char buf[32];
-  snprintf(buf, sizeof(buf), "%d", (int)elements.size());
-  i.result = buf;
+  i.set_result_int((int)obj_list(objv[1])->size());
   return S_OK;
 }
 
@@ -1099,7 +1584,7 @@ static Status cmd_lrange(Interp &i, vector<string> &argv, ProcPrivdata *privdata
     return S_ERR;
   }
 
-  vector<string> elements;
+  small_vector<string, 8> elements;
   list_parse(string_view(argv[1]), elements);
 
   int start = atoi(argv[2].c_str());
@@ -1110,7 +1595,7 @@ static Status cmd_lrange(Interp &i, vector<string> &argv, ProcPrivdata *privdata
   if (end >= (int)elements.size())
     end = elements.size() - 1;
 
-  vector<string> range;
+  small_vector<string, 8> range;
   for (int j = start; j <= end && j < (int)elements.size(); j++) {
     range.push_back(elements[j]);
   }
@@ -1134,7 +1619,7 @@ static Status cmd_split(Interp &i, vector<string> &argv, ProcPrivdata *privdata)
     delimiter = argv[2][0];
   }
 
-  vector<string> elements;
+  small_vector<string, 8> elements;
   size_t start = 0;
   for (size_t j = 0; j <= str.length(); j++) {
     if (j == str.length() || str[j] == delimiter) {
@@ -1152,7 +1637,7 @@ static Status cmd_join(Interp &i, vector<string> &argv, ProcPrivdata *privdata)
     return S_ERR;
   }
 
-  vector<string> elements;
+  small_vector<string, 8> elements;
   list_parse(string_view(argv[1]), elements);
 
   string separator = " ";
@@ -1170,58 +1655,61 @@ static Status cmd_join(Interp &i, vector<string> &argv, ProcPrivdata *privdata)
   return S_OK;
 }
 
-static Status cmd_lloop(Interp &i, vector<string> &argv, ProcPrivdata *privdata) {
+static Status cmd_lloop(Interp &i, vector<Obj *> &objv, ProcPrivdata *privdata) {
   // lloop list {idx item} body
   // lloop list item body
-  if (!i.arity_check("lloop", argv, 4, 4)) {
+  if (!i.arity_check("lloop", objv, 4, 4)) {
     return S_ERR;
   }
 
-  // Parse the list
-  vector<string> elements;
-  list_parse(string_view(argv[1]), elements);
-
-  // Parse variable names from argv[2]
+  // Variable names from objv[2]
   // Could be "{idx item}" for index+value or just "item" for value only
-  vector<string> var_names;
-  list_parse(string_view(argv[2]), var_names);
-
-  bool has_index = (var_names.size() == 2);
+  vector<Obj *> *var_names = obj_list(objv[2]);
+  bool has_index = (var_names->size() == 2);
   string idx_var, item_var;
   if (has_index) {
-    idx_var = var_names[0];
-    item_var = var_names[1];
-  } else if (var_names.size() == 1) {
-    item_var = var_names[0];
+    idx_var = obj_string((*var_names)[0]);
+    item_var = obj_string((*var_names)[1]);
+  } else if (var_names->size() == 1) {
+    item_var = obj_string((*var_names)[0]);
   } else {
-    format_error(i.result, "lloop: expected 1 or 2 variable names, got %zu", var_names.size());
-    return S_ERR;
+    return i.error("lloop: expected 1 or 2 variable names, got %zu", var_names->size());
+  }
+
+  // Hold the elements, since the body may change what the list value caches
+  small_vector<Obj *, 8> elements;
+  for (Obj *elem : *obj_list(objv[1])) {
+    obj_incr(elem);
+    elements.push_back(elem);
   }
 
-  // Iterate over list elements
+  Status s = S_OK;
   for (size_t j = 0; j < elements.size(); j++) {
     // Set index variable if requested
     if (has_index) {
-      char buf[32];
-      snprintf(buf, sizeof(buf), "%zu", j);
-      i.set_var(idx_var, buf);
+      Obj *idx = obj_new_int((int)j);
+      i.set_var(string_view(idx_var), idx);
+      obj_decr(idx);
     }
 
     // Set item variable
-    i.set_var(item_var, elements[j]);
+    i.set_var(string_view(item_var), elements[j]);
 
     // Execute body
-    Status s = i.eval(string_view(argv[3]));
+    s = exec_obj(i, objv[3]);
     if (s == S_CONTINUE || s == S_OK) {
+      s = S_OK;
       continue;
     } else if (s == S_BREAK) {
-      return S_OK;
-    } else {
-      return s;
+      s = S_OK;
     }
+    break;
   }
 
-  return S_OK;
+  for (Obj *elem : elements) {
+    obj_decr(elem);
+  }
+  return s;
 }
 
 //
@@ -1336,60 +1824,524 @@ static Status cmd_bin(Interp &i, vector<string> &argv, ProcPrivdata *privdata) {
   return S_OK;
 }
 
-static Status cmd_eval(Interp &i, vector<string> &argv, ProcPrivdata *privdata) {
-  if (!i.arity_check("eval", argv, 2, 2)) {
+static Status cmd_eval(Interp &i, vector<Obj *> &objv, ProcPrivdata *privdata) {
+  if (!i.arity_check("eval", objv, 2, 2)) {
+    return S_ERR;
+  }
+  return exec_obj(i, objv[1]);
+}
+
+//
+// EXPR
+//
+
+Expr::~Expr() {
+  for (Obj *name : names) {
+    obj_decr(name);
+  }
+  for (Script *s : scripts) {
+    script_release(s);
+  }
+}
+
+void expr_release(Expr *e) {
+  if (--e->refs == 0) {
+    ou_delete(e);
+  }
+}
+
+// Binary operators, longest spelling first where one is a prefix of another
+struct BinaryOp {
+  const char *text;
+  uint8_t len;
+  uint8_t op; // EX_JUMP_IF_FALSE for &&, EX_JUMP_IF_TRUE for ||
+  uint8_t prec;
+};
+
+static const BinaryOp binary_ops[] = {
+    {"||", 2, EX_JUMP_IF_TRUE, 1}, {"&&", 2, EX_JUMP_IF_FALSE, 2}, {"|", 1, EX_BITOR, 3}, {"^", 1, EX_BITXOR, 4},
+    {"&", 1, EX_BITAND, 5},        {"==", 2, EX_EQ, 6},            {"!=", 2, EX_NE, 6},   {"<=", 2, EX_LE, 7},
+    {">=", 2, EX_GE, 7},           {"<<", 2, EX_SHL, 8},           {">>", 2, EX_SHR, 8},  {"<", 1, EX_LT, 7},
+    {">", 1, EX_GT, 7},            {"+", 1, EX_ADD, 9},            {"-", 1, EX_SUB, 9},   {"*", 1, EX_MUL, 10},
+    {"/", 1, EX_DIV, 10},          {"%", 1, EX_MOD, 10},
+};
+
+// Recursive descent parser emitting stack code, C precedence
+struct ExprCompiler {
+  const char *p, *end;
+  Expr *e;
+  string &error;
+  bool trace_parser;
+  size_t depth; // Operands on the stack at this point of the code
+
+  ExprCompiler(const string_view &source, Expr *e_, string &error_, bool trace_parser_)
+      : p(source.data()), end(source.data() + source.length()), e(e_), error(error_), trace_parser(trace_parser_),
+        depth(0) {}
+
+  bool fail(const char *what) {
+    if (error.empty()) {
+      format_error(error, "[expr]: %s in '%s'", what, e->source.c_str());
+    }
+    return false;
+  }
+
+  size_t emit(uint8_t op, int32_t arg = 0) {
+    ExprInstr in;
+    in.op = op;
+    in.arg = arg;
+    e->code.push_back(in);
+    return e->code.size() - 1;
+  }
+
+  // Operands pushed (positive) or popped (negative) by the last instruction
+  bool stack(int change) {
+    depth += change;
+    return depth <= Expr::STACK_MAX || fail("expression too deep");
+  }
+
+  void patch(size_t at) { e->code[at].arg = (int32_t)e->code.size(); }
+
+  void skip_space() {
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r')) {
+      p++;
+    }
+  }
+
+  const BinaryOp *peek_binary() {
+    skip_space();
+    for (const BinaryOp &b : binary_ops) {
+      if ((size_t)(end - p) >= b.len && memcmp(p, b.text, b.len) == 0) {
+        return &b;
+      }
+    }
+    return nullptr;
+  }
+
+  bool number() {
+    int base = 10;
+    if (end - p > 2 && p[0] == '0' && (p[1] == 'x' || p[1] == 'X')) {
+      base = 16;
+      p += 2;
+    }
+    uint32_t value = 0;
+    const char *start = p;
+    for (; p < end; p++) {
+      int digit;
+      if (*p >= '0' && *p <= '9') {
+        digit = *p - '0';
+      } else if (base == 16 && ((*p | 0x20) >= 'a' && (*p | 0x20) <= 'f')) {
+        digit = (*p | 0x20) - 'a' + 10;
+      } else {
+        break;
+      }
+      value = value * base + digit;
+    }
+    if (p == start) {
+      return fail("bad number");
+    }
+    emit(EX_INT, (int32_t)value);
+    return stack(1);
+  }
+
+  bool variable() {
+    const char *start = ++p;
+    while (p < end && ((*p >= 'a' && *p <= 'z') || (*p >= 'A' && *p <= 'Z') || (*p >= '0' && *p <= '9') || *p == '_')) {
+      p++;
+    }
+    if (p == start) {
+      return fail("missing variable name");
+    }
+    e->names.push_back(obj_new(string_view(start, p - start)));
+    emit(EX_VAR, e->names.size() - 1);
+    return stack(1);
+  }
+
+  bool command() {
+    const char *start = ++p;
+    int nesting = 1;
+    for (; p < end; p++) {
+      if (*p == '[') {
+        nesting++;
+      } else if (*p == ']' && --nesting == 0) {
+        break;
+      }
+    }
+    if (p == end) {
+      return fail("missing ]");
+    }
+    e->scripts.push_back(compile(string_view(start, p - start), trace_parser));
+    p++;
+    emit(EX_CMD, e->scripts.size() - 1);
+    return stack(1);
+  }
+
+  bool unary() {
+    skip_space();
+    if (p == end) {
+      return fail("missing operand");
+    }
+    char c = *p;
+    if (c == '-' || c == '+' || c == '!' || c == '~') {
+      p++;
+      if (!unary()) {
+        return false;
+      }
+      if (c != '+') {
+        emit(c == '-' ? EX_NEG : c == '!' ? EX_NOT : EX_BITNOT);
+      }
+      return true;
+    } else if (c == '(') {
+      p++;
+      if (!ternary()) {
+        return false;
+      }
+      skip_space();
+      if (p == end || *p != ')') {
+        return fail("missing )");
+      }
+      p++;
+      return true;
+    } else if (c >= '0' && c <= '9') {
+      return number();
+    } else if (c == '$') {
+      return variable();
+    } else if (c == '[') {
+      return command();
+    }
+    return fail("unexpected character");
+  }
+
+  bool binary(int min_prec) {
+    if (!unary()) {
+      return false;
+    }
+    const BinaryOp *b;
+    while ((b = peek_binary()) != nullptr && b->prec >= min_prec) {
+      p += b->len;
+      if (b->op == EX_JUMP_IF_FALSE || b->op == EX_JUMP_IF_TRUE) {
+        // a && b: a; JUMP_IF_FALSE L1; b; BOOL; JUMP L2; L1: INT 0; L2:
+        size_t skip = emit(b->op);
+        stack(-1);
+        if (!binary(b->prec + 1)) {
+          return false;
+        }
+        emit(EX_BOOL);
+        size_t done = emit(EX_JUMP);
+        patch(skip);
+        emit(EX_INT, b->op == EX_JUMP_IF_TRUE);
+        patch(done);
+      } else {
+        if (!binary(b->prec + 1)) {
+          return false;
+        }
+        emit(b->op);
+        stack(-1);
+      }
+    }
+    return true;
+  }
+
+  bool ternary() {
+    if (!binary(1)) {
+      return false;
+    }
+    skip_space();
+    if (p == end || *p != '?') {
+      return true;
+    }
+    p++;
+    // c ? a : b: c; JUMP_IF_FALSE L1; a; JUMP L2; L1: b; L2:
+    size_t other = emit(EX_JUMP_IF_FALSE);
+    stack(-1);
+    if (!ternary()) {
+      return false;
+    }
+    size_t done = emit(EX_JUMP);
+    skip_space();
+    if (p == end || *p != ':') {
+      return fail("missing :");
+    }
+    p++;
+    patch(other);
+    stack(-1); // Only one branch's result is on the stack at L2
+    if (!ternary()) {
+      return false;
+    }
+    patch(done);
+    return true;
+  }
+};
+
+Expr *compile_expr(const string_view &source, string &error, bool trace_parser) {
+  Expr *e = ou_new<Expr>();
+  e->source = string(source.data(), source.length());
+  ExprCompiler c(string_view(e->source), e, error, trace_parser);
+  bool ok = c.ternary();
+  c.skip_space();
+  if (ok && c.p != c.end) {
+    ok = c.fail("unexpected character");
+  }
+  if (!ok) {
+    expr_release(e);
+    return nullptr;
+  }
+  return e;
+}
+
+Expr *Interp::compile_expr_cached(const string_view &source) {
+  string message;
+  Expr *e;
+  if (source.length() > SCRIPT_CACHE_MAX_SOURCE) {
+    e = compile_expr(source, message, trace_parser);
+  } else {
+    Expr **cached = expr_cache_.find(source.data(), source.length());
+    if (cached) {
+      expr_acquire(*cached);
+      return *cached;
+    }
+    if (expr_cache_list_.size() >= SCRIPT_CACHE_MAX) {
+      flush_expr_cache();
+    }
+    e = compile_expr(source, message, trace_parser);
+    if (e) {
+      expr_acquire(e);
+      expr_cache_list_.push_back(e);
+      expr_cache_.insert(e->source, e);
+    }
+  }
+  if (!e) {
+    error("%s", message.c_str());
+  }
+  return e;
+}
+
+void Interp::flush_expr_cache() {
+  expr_cache_.clear();
+  for (Expr *e : expr_cache_list_) {
+    expr_release(e);
+  }
+  expr_cache_list_.clear();
+}
+
+Status Interp::eval_expr(Expr *e, int *out) {
+  int stack[Expr::STACK_MAX];
+  size_t sp = 0;
+  Status ret = S_OK;
+  // Commands run by the expression may drop the last other reference to it
+  expr_acquire(e);
+
+  const ExprInstr *code = e->code.data();
+  size_t count = e->code.size();
+  for (size_t pc = 0; pc < count && ret == S_OK; pc++) {
+    const ExprInstr &in = code[pc];
+    int a = 0, b = 0;
+    if (in.op >= EX_MUL && in.op <= EX_BITOR) {
+      b = stack[--sp];
+      a = stack[sp - 1];
+    }
+
+    switch (in.op) {
+    case EX_INT:
+      stack[sp++] = in.arg;
+      break;
+    case EX_VAR: {
+      Var *v = get_var(e->names[in.arg]);
+      if (v == nullptr) {
+        ret = error("variable not found: '%s'", obj_string(e->names[in.arg]).c_str());
+      } else if (!obj_int(v->val, &stack[sp])) {
+        ret = error("[expr]: expected integer but got '%s'", v->value().c_str());
+      }
+      sp++;
+      break;
+    }
+    case EX_CMD: {
+      ret = exec(e->scripts[in.arg]);
+      if (ret != S_OK) {
+        break;
+      }
+      Obj *r = take_result();
+      if (!obj_int(r, &stack[sp])) {
+        ret = error("[expr]: expected integer but got '%s'", obj_string(r).c_str());
+      }
+      obj_decr(r);
+      sp++;
+      break;
+    }
+    case EX_NEG:
+      stack[sp - 1] = -stack[sp - 1];
+      break;
+    case EX_NOT:
+      stack[sp - 1] = !stack[sp - 1];
+      break;
+    case EX_BITNOT:
+      stack[sp - 1] = ~stack[sp - 1];
+      break;
+    case EX_BOOL:
+      stack[sp - 1] = stack[sp - 1] != 0;
+      break;
+    case EX_MUL:
+      stack[sp - 1] = a * b;
+      break;
+    case EX_DIV:
+    case EX_MOD:
+      if (b == 0) {
+        ret = error("[expr]: divide by zero");
+        break;
+      }
+      // INT_MIN / -1 overflows and traps; wrap it like the other operators do
+      if (b == -1) {
+        stack[sp - 1] = in.op == EX_DIV ? (int)(0u - (unsigned)a) : 0;
+        break;
+      }
+      stack[sp - 1] = in.op == EX_DIV ? a / b : a % b;
+      break;
+    case EX_ADD:
+      stack[sp - 1] = a + b;
+      break;
+    case EX_SUB:
+      stack[sp - 1] = a - b;
+      break;
+    case EX_SHL:
+    case EX_SHR:
+      if (b < 0 || b > 31) {
+        ret = error("[expr]: shift count out of range: %d", b);
+        break;
+      }
+      // Shift left as unsigned so negative operands are defined
+      stack[sp - 1] = in.op == EX_SHL ? (int)((unsigned)a << b) : a >> b;
+      break;
+    case EX_LT:
+      stack[sp - 1] = a < b;
+      break;
+    case EX_GT:
+      stack[sp - 1] = a > b;
+      break;
+    case EX_LE:
+      stack[sp - 1] = a <= b;
+      break;
+    case EX_GE:
+      stack[sp - 1] = a >= b;
+      break;
+    case EX_EQ:
+      stack[sp - 1] = a == b;
+      break;
+    case EX_NE:
+      stack[sp - 1] = a != b;
+      break;
+    case EX_BITAND:
+      stack[sp - 1] = a & b;
+      break;
+    case EX_BITXOR:
+      stack[sp - 1] = a ^ b;
+      break;
+    case EX_BITOR:
+      stack[sp - 1] = a | b;
+      break;
+    case EX_JUMP:
+      pc = in.arg - 1;
+      break;
+    case EX_JUMP_IF_FALSE:
+    case EX_JUMP_IF_TRUE:
+      if ((stack[--sp] != 0) == (in.op == EX_JUMP_IF_TRUE)) {
+        pc = in.arg - 1;
+      }
+      break;
+    }
+  }
+
+  if (ret == S_OK) {
+    *out = stack[0];
+  }
+  expr_release(e);
+  return ret;
+}
+
+static Status cmd_expr(Interp &i, vector<Obj *> &objv, ProcPrivdata *privdata) {
+  if (!i.arity_check("expr", objv, 2, 1024)) {
     return S_ERR;
   }
-  return i.eval(string_view(argv[1]));
+  int value;
+  Status s;
+  if (objv.size() == 2) {
+    // The usual braced form; the compiled expression is kept on the value
+    Expr *e = obj_expr(i, objv[1]);
+    if (!e) {
+      return S_ERR;
+    }
+    s = i.eval_expr(e, &value);
+  } else {
+    string source;
+    for (size_t j = 1; j < objv.size(); j++) {
+      if (j > 1) {
+        source += ' ';
+      }
+      source += obj_string(objv[j]);
+    }
+    Expr *e = i.compile_expr_cached(string_view(source));
+    if (!e) {
+      return S_ERR;
+    }
+    s = i.eval_expr(e, &value);
+    expr_release(e);
+  }
+  if (s == S_OK) {
+    i.set_result_int(value);
+  }
+  return s;
 }
 
 void register_core_commands(Interp &i) {
   // I/O commands
-  i.register_command("puts", cmd_puts, nullptr, "[puts string] => nil - Print string to output");
+  i.register_obj_command("puts", cmd_puts, nullptr, "[puts string] => nil - Print string to output");
 
   // Variable commands
-  i.register_command("set", cmd_set, nullptr, "[set var value] => value - Set variable to value");
+  i.register_obj_command("set", cmd_set, nullptr, "[set var value] => value - Set variable to value");
 
   // Control flow commands
-  i.register_command("if", cmd_if, nullptr,
-                     "[if cond then else?] => any - Evaluate then-body if "
-                     "condition is true, else-body otherwise");
-  i.register_command("while", cmd_while, nullptr, "[while cond body] => nil - Execute body while condition is true");
-  i.register_command("break", cmd_break, nullptr, "[break] => nil - Break out of innermost loop");
-  i.register_command("continue", cmd_continue, nullptr, "[continue] => nil - Skip to next iteration of innermost loop");
+  i.register_obj_command("if", cmd_if, nullptr,
+                         "[if cond then else?] => any - Evaluate then-body if "
+                         "condition is true, else-body otherwise");
+  i.register_obj_command("while", cmd_while, nullptr,
+                         "[while cond body] => nil - Execute body while condition is true");
+  i.register_obj_command("break", cmd_break, nullptr, "[break] => nil - Break out of innermost loop");
+  i.register_obj_command("continue", cmd_continue, nullptr,
+                         "[continue] => nil - Skip to next iteration of innermost loop");
 
   // Procedure commands
-  i.register_command("proc", cmd_proc, nullptr, "[proc name args body] => nil - Define a new procedure");
-  i.register_command("return", cmd_return, nullptr,
-                     "[return value?] => any - Return from current procedure "
-                     "with optional value");
+  i.register_obj_command("proc", cmd_proc, nullptr, "[proc name args body] => nil - Define a new procedure");
+  i.register_obj_command("return", cmd_return, nullptr,
+                         "[return value?] => any - Return from current procedure "
+                         "with optional value");
 
   // Arithmetic commands
-  i.register_command("+", cmd_add, nullptr, "[+ a:int b:int] => int - Add two integers");
-  i.register_command("-", cmd_sub, nullptr, "[- a:int b:int] => int - Subtract b from a");
-  i.register_command("*", cmd_mul, nullptr, "[* a:int b:int] => int - Multiply two integers");
-  i.register_command("/", cmd_div, nullptr, "[/ a:int b:int] => int - Divide a by b (integer division)");
-  i.register_command("%", cmd_mod, nullptr, "[% a:int b:int] => int - Modulo (remainder of a / b)");
+  i.register_obj_command("+", cmd_add, nullptr, "[+ a:int b:int] => int - Add two integers");
+  i.register_obj_command("-", cmd_sub, nullptr, "[- a:int b:int] => int - Subtract b from a");
+  i.register_obj_command("*", cmd_mul, nullptr, "[* a:int b:int] => int - Multiply two integers");
+  i.register_obj_command("/", cmd_div, nullptr, "[/ a:int b:int] => int - Divide a by b (integer division)");
+  i.register_obj_command("%", cmd_mod, nullptr, "[% a:int b:int] => int - Modulo (remainder of a / b)");
 
   // Bitwise commands
-  i.register_command("&", cmd_and, nullptr, "[& a:int b:int] => int - Bitwise AND");
-  i.register_command("<<", cmd_shl, nullptr, "[<< a:int n:int] => int - Shift a left by n bits");
-  i.register_command(">>", cmd_shr, nullptr, "[>> a:int n:int] => int - Shift a right by n bits");
+  i.register_obj_command("&", cmd_and, nullptr, "[& a:int b:int] => int - Bitwise AND");
+  i.register_obj_command("<<", cmd_shl, nullptr, "[<< a:int n:int] => int - Shift a left by n bits");
+  i.register_obj_command(">>", cmd_shr, nullptr, "[>> a:int n:int] => int - Shift a right by n bits");
 
   // Comparison commands
-  i.register_command("==", cmd_eq, nullptr, "[== a:int b:int] => bool - Test if a equals b (returns 1 or 0)");
-  i.register_command("!=", cmd_ne, nullptr,
-                     "[!= a:int b:int] => bool - Test if a is not equal to b "
-                     "(returns 1 or 0)");
-  i.register_command(">", cmd_gt, nullptr, "[> a:int b:int] => bool - Test if a is greater than b (returns 1 or 0)");
-  i.register_command("<", cmd_lt, nullptr, "[< a:int b:int] => bool - Test if a is less than b (returns 1 or 0)");
-  i.register_command(">=", cmd_gte, nullptr,
-                     "[>= a:int b:int] => bool - Test if a is greater than or "
-                     "equal to b (returns 1 or 0)");
-  i.register_command("<=", cmd_lte, nullptr,
-                     "[<= a:int b:int] => bool - Test if a is less than or "
-                     "equal to b (returns 1 or 0)");
-  i.register_command("!", cmd_notn, nullptr, "[! value] => bool - Test if value is false (returns 1 or 0)");
+  i.register_obj_command("==", cmd_eq, nullptr, "[== a:int b:int] => bool - Test if a equals b (returns 1 or 0)");
+  i.register_obj_command("!=", cmd_ne, nullptr,
+                         "[!= a:int b:int] => bool - Test if a is not equal to b "
+                         "(returns 1 or 0)");
+  i.register_obj_command(">", cmd_gt, nullptr,
+                         "[> a:int b:int] => bool - Test if a is greater than b (returns 1 or 0)");
+  i.register_obj_command("<", cmd_lt, nullptr, "[< a:int b:int] => bool - Test if a is less than b (returns 1 or 0)");
+  i.register_obj_command(">=", cmd_gte, nullptr,
+                         "[>= a:int b:int] => bool - Test if a is greater than or "
+                         "equal to b (returns 1 or 0)");
+  i.register_obj_command("<=", cmd_lte, nullptr,
+                         "[<= a:int b:int] => bool - Test if a is less than or "
+                         "equal to b (returns 1 or 0)");
+  i.register_obj_command("!", cmd_notn, nullptr, "[! value] => bool - Test if value is false (returns 1 or 0)");
+  i.register_obj_command("expr", cmd_expr, nullptr,
+                         "[expr expression] => int - Evaluate an infix integer expression, e.g. {$a * ($b + 1) < 10}");
 
   // Help commands
   i.register_command("help", cmd_help, nullptr,
@@ -1397,20 +2349,21 @@ void register_core_commands(Interp &i) {
   i.register_command("commands", cmd_commands, nullptr, "[commands] => nil - List all available commands");
 
   // List commands
-  i.register_command("list", cmd_list, nullptr, "[list elem1 elem2 ...] => list - Create a list from arguments");
-  i.register_command("lindex", cmd_lindex, nullptr, "[lindex list index:int] => elem - Get element at index from list");
-  i.register_command("lappend", cmd_lappend, nullptr,
-                     "[lappend varName elem ...] => list - Append elements to list variable");
-  i.register_command("llength", cmd_llength, nullptr, "[llength list] => int - Get the length of a list");
+  i.register_obj_command("list", cmd_list, nullptr, "[list elem1 elem2 ...] => list - Create a list from arguments");
+  i.register_obj_command("lindex", cmd_lindex, nullptr,
+                         "[lindex list index:int] => elem - Get element at index from list");
+  i.register_obj_command("lappend", cmd_lappend, nullptr,
+                         "[lappend varName elem ...] => list - Append elements to list variable");
+  i.register_obj_command("llength", cmd_llength, nullptr, "[llength list] => int - Get the length of a list");
   i.register_command("lrange", cmd_lrange, nullptr,
                      "[lrange list start:int end:int] => list - Get range of elements from list");
   i.register_command("split", cmd_split, nullptr,
                      "[split string delimiter?] => list - Split string into list (default delimiter: space)");
   i.register_command("join", cmd_join, nullptr,
                      "[join list separator?] => string - Join list elements into string (default separator: space)");
-  i.register_command("lloop", cmd_lloop, nullptr,
-                     "[lloop list {idx item} body] or [lloop list item body] => nil - "
-                     "Iterate over list elements with break/continue support");
+  i.register_obj_command("lloop", cmd_lloop, nullptr,
+                         "[lloop list {idx item} body] or [lloop list item body] => nil - "
+                         "Iterate over list elements with break/continue support");
 
   // Number conversion commands
   i.register_command("hex", cmd_hex, nullptr,
@@ -1421,7 +2374,8 @@ void register_core_commands(Interp &i) {
                      "[bin string] => int - Parse binary string to decimal (supports 0b prefix)");
 
   // Eval command
-  i.register_command("eval", cmd_eval, nullptr, "[eval string] => any - Evaluate a Tcl string and return the result");
+  i.register_obj_command("eval", cmd_eval, nullptr,
+                         "[eval string] => any - Evaluate a Tcl string and return the result");
 }
 
 //
@@ -17,6 +17,7 @@ using ou::ou_delete;
 using ou::ou_new;
 using ou::string;
 using ou::string_view;
+using ou::small_vector;
 using ou::vector;
 template <typename V> using HashMap = ou::StringHashMap<V>;
 
@@ -47,6 +48,10 @@ struct ProcPrivdata;
 struct Cmd;
 struct Var;
 struct CallFrame;
+struct Script;
+struct Obj;
+struct Locals;
+struct Expr;
 
 /**
  * I/O backend interface for interpreter output.
@@ -91,22 +96,208 @@ struct Parser {
   bool has_escapes() const;
 };
 
+/**
+ * Values. Every value has a string form and may also cache an internal form
+ * (an integer, a list of values, or compiled bytecode) next to it. Either
+ * form is produced from the other only when asked for, so a counter that is
+ * only used in arithmetic is never formatted and a loop body is compiled
+ * once. Values are refcounted and must not be modified once shared.
+ */
+struct Obj {
+  enum Kind : uint8_t { STRING, INT, LIST, SCRIPT, LOCAL, EXPR };
+
+  Obj() : refs(1), has_string(true), kind(STRING), int_val(0) {}
+  ~Obj();
+
+  size_t refs;
+  bool has_string; // Otherwise str is stale and is regenerated from the internal form
+  Kind kind;
+  string str;
+  union {
+    int int_val;
+    vector<Obj *> *list;
+    Script *script;
+    Expr *expr;
+    struct {
+      uint32_t locals_id;
+      uint32_t slot;
+    } local; // A variable name's slot in a proc's Locals
+  };
+};
+
+// Constructors return a value holding one reference for the caller
+Obj *obj_new(const string_view &str);
+Obj *obj_new(string &&str);
+inline Obj *obj_new(const char *str) { return obj_new(string_view(str)); }
+Obj *obj_new_int(int value);
+/** Takes over the references held by elements */
+Obj *obj_new_list(vector<Obj *> &&elements);
+
+inline void obj_incr(Obj *o) { o->refs++; }
+void obj_decr(Obj *o);
+
+const string &obj_string(Obj *o);
+/** Integer form, parsed and cached on first use. Returns false if the value isn't an integer. */
+bool obj_int(Obj *o, int *out);
+/** List form, parsed and cached on first use */
+vector<Obj *> *obj_list(Obj *o);
+/** Compiled form, compiled and cached on first use */
+Script *obj_script(Interp &i, Obj *o);
+/** Compiled expression, compiled and cached on first use. Returns nullptr with an error result on a syntax error. */
+Expr *obj_expr(Interp &i, Obj *o);
+/** Mark the string form stale after changing an unshared value's list in place */
+void obj_invalidate_string(Obj *o);
+
+/**
+ * Bytecode instructions. Each command is compiled to a run of PUSH/APPEND
+ * instructions that build its words, followed by an INVOKE.
+ */
+enum Opcode : uint8_t {
+  OP_PUSH_LIT,   // Start a new word with literals[arg]
+  OP_APPEND_LIT, // Append literals[arg] to the current word
+  OP_PUSH_VAR,   // Start a new word with the value of the variable named literals[arg]
+  OP_APPEND_VAR,
+  OP_PUSH_CMD,   // Start a new word with the result of running children[arg]
+  OP_APPEND_CMD,
+  OP_INVOKE,     // Call the command named by the first word; arg is a commands slot or NO_SLOT
+};
+
+struct Instr {
+  uint8_t op;
+  bool escapes; // Substituted value needs backslash escapes processed
+  uint32_t arg;
+};
+
+/**
+ * A compiled script: instructions plus the literal pool, nested scripts for
+ * [command] substitutions, and command lookups resolved on first use.
+ * Refcounted so a script can't be freed while it is running.
+ */
+struct Script {
+  static constexpr uint32_t NO_SLOT = 0xFFFFFFFF;
+
+  Script() : refs(1) {}
+  ~Script();
+
+  // Inline capacity covers most loop bodies and conditions, so compiling
+  // them allocates little more than the Script itself
+  string source;
+  small_vector<Instr, 8> code;
+  small_vector<Obj *, 4> literals;
+  vector<Script *> children;
+  // Commands whose name is a plain literal; nullptr until first invoked.
+  // Commands are never freed and re-registering reuses the Cmd, so these stay valid.
+  small_vector<Cmd *, 2> commands;
+  size_t refs;
+};
+
+/** Compile source into a new script with one reference */
+Script *compile(const string_view &source, bool trace_parser = false);
+inline void script_acquire(Script *s) { s->refs++; }
+void script_release(Script *s);
+
+/**
+ * Expression instructions, for expr. They work on a stack of integers;
+ * && || and ?: are compiled to jumps so they only evaluate what they need.
+ */
+enum ExprOpcode : uint8_t {
+  EX_INT,           // Push arg
+  EX_VAR,           // Push the value of the variable named names[arg]
+  EX_CMD,           // Run scripts[arg] and push its result
+  EX_NEG,           // Unary operators replace the top of the stack
+  EX_NOT,
+  EX_BITNOT,
+  EX_BOOL,          // Replace the top with 1 if it is non-zero, otherwise 0
+  EX_MUL,           // Binary operators pop two operands and push the result
+  EX_DIV,
+  EX_MOD,
+  EX_ADD,
+  EX_SUB,
+  EX_SHL,
+  EX_SHR,
+  EX_LT,
+  EX_GT,
+  EX_LE,
+  EX_GE,
+  EX_EQ,
+  EX_NE,
+  EX_BITAND,
+  EX_BITXOR,
+  EX_BITOR,
+  EX_JUMP,          // Continue at instruction arg
+  EX_JUMP_IF_FALSE, // Pop, and continue at instruction arg if it was zero
+  EX_JUMP_IF_TRUE,  // Pop, and continue at instruction arg if it was non-zero
+};
+
+struct ExprInstr {
+  uint8_t op;
+  int32_t arg;
+};
+
+/**
+ * A compiled expression
+ */
+struct Expr {
+  static constexpr size_t STACK_MAX = 32;
+
+  Expr() : refs(1) {}
+  ~Expr();
+
+  size_t refs;
+  string source;
+  vector<ExprInstr> code;
+  vector<Obj *> names;      // Variable names, which cache their slot like script literals
+  vector<Script *> scripts; // Command substitutions
+};
+
+/** Compile an expression into a new one with one reference, or return nullptr and set error */
+Expr *compile_expr(const string_view &source, string &error, bool trace_parser = false);
+inline void expr_acquire(Expr *e) { e->refs++; }
+void expr_release(Expr *e);
+
+/**
+ * Variable slots of a proc. Argument names get the first slots when the proc
+ * is defined, the names its body refers to when the body is compiled, and
+ * any others when first used, so a call frame can keep its variables in an
+ * array indexed by slot. Refcounted, since frames outlive redefinition.
+ */
+struct Locals {
+  Locals();
+  uint32_t id; // Unique, so names can cache a slot without holding a reference
+  size_t refs;
+  vector<string_view> names; // Point at the keys copied into slots
+  ou::StringHashMap<uint32_t, 16, true> slots;
+
+  bool find(const string_view &name, uint32_t *slot);
+  /** Slot of a name, adding it if new */
+  uint32_t slot_of(const string_view &name);
+};
+
+inline void locals_acquire(Locals *l) { l->refs++; }
+void locals_release(Locals *l);
+
 /**
  * Base class for command private data.
  * Can be subclassed to pass custom data to command functions.
  */
 struct ProcPrivdata {
-  ProcPrivdata() : args(nullptr), body(nullptr) {}
+  ProcPrivdata() : args(nullptr), body(nullptr), compiled(nullptr), locals(nullptr) {}
   ProcPrivdata(string *args_, string *body_);
   virtual ~ProcPrivdata();
   string *args;
   string *body;
+  Script *compiled; // Body bytecode, compiled on the first call
+  Locals *locals;
+  vector<uint32_t> arg_slots; // Slot of each argument, in order
 };
 
 /**
- * Command function type
+ * Command function types. String commands get every word as a string; value
+ * commands get the words as values, so they can use their cached forms and
+ * return a value with set_result.
  */
 typedef Status (*cmd_func_t)(Interp &i, vector<string> &argv, ProcPrivdata *privdata);
+typedef Status (*obj_cmd_func_t)(Interp &i, vector<Obj *> &objv, ProcPrivdata *privdata);
 
 /**
  * Command struct
@@ -115,7 +306,8 @@ struct Cmd {
   Cmd(const string &name_, cmd_func_t func_, ProcPrivdata *privdata_ = nullptr, const string &docstring_ = "");
   ~Cmd();
   string name;
-  cmd_func_t func;
+  cmd_func_t func;        // Set for string commands
+  obj_cmd_func_t obj_func; // Set for value commands
   ProcPrivdata *privdata;
   string docstring;
 };
@@ -124,16 +316,23 @@ struct Cmd {
  * Variable
  */
 struct Var {
+  Var() : val(nullptr) {}
   ~Var();
-  string *name, *val;
+  string name;
+  Obj *val;
+  const string &value() const { return obj_string(val); }
 };
 
 /**
- * Call frame
+ * Call frame. The global frame's variables are found through
+ * Interp::globals_; a proc's through its slots.
  */
 struct CallFrame {
+  explicit CallFrame(Locals *locals_ = nullptr);
   ~CallFrame();
   vector<Var *> vars;
+  Locals *locals;      // nullptr for the global frame
+  vector<Var *> slots; // Indexed by Locals slot; nullptr until the variable is created here
 };
 
 /**
@@ -143,7 +342,11 @@ struct Interp {
   vector<Cmd *> commands;
   HashMap<Cmd *> cmd_hash_;
   vector<CallFrame *> callframes;
+  HashMap<Var *> globals_; // Keyed by the Var's name
   string result;
+  // The result as a value, when the last command returned one. Takes
+  // precedence over result until eval() copies it back for callers.
+  Obj *result_obj;
   bool trace_parser;
 
   // MessagePack support (optional)
@@ -154,18 +357,83 @@ struct Interp {
   // I/O backend (nullptr = default console output)
   TclIO *io_;
 
+  // Scripts compiled by eval, keyed by source, so loop bodies and conditions
+  // are only parsed once. Flushed when it reaches SCRIPT_CACHE_MAX entries.
+  static constexpr size_t SCRIPT_CACHE_MAX = 256;
+  static constexpr size_t SCRIPT_CACHE_MAX_SOURCE = 4096; // Longer scripts are compiled per eval
+  HashMap<Script *> script_cache_;
+  vector<Script *> script_cache_list_;
+
+  // Word vectors for each level of exec() nesting. A level's vectors are
+  // cleared when it returns but keep their storage for the next script run
+  // at that depth.
+  struct Argv {
+    vector<Obj *> objv;
+    vector<string> argv; // For string commands
+  };
+  vector<Argv *> argv_stack_;
+  size_t argv_depth_;
+
+  // Frames and variables of returned procs, reused by later calls
+  vector<CallFrame *> frame_pool_;
+  vector<Var *> var_pool_;
+
   Interp();
   ~Interp();
 
+  CallFrame *push_call_frame(Locals *locals);
   void drop_call_frame();
   Cmd *get_command(const string &name) const;
   Status register_command(const string &name, cmd_func_t fn, ProcPrivdata *privdata = nullptr,
                           const string &docstring = "");
+  Status register_obj_command(const string &name, obj_cmd_func_t fn, ProcPrivdata *privdata = nullptr,
+                              const string &docstring = "");
+  /**
+   * Variables are scoped dynamically: lookup searches every frame from the
+   * innermost out, and setting a variable that doesn't exist yet creates it
+   * in the innermost frame.
+   */
   Var *get_var(const string_view &name);
+  /** Like get_var, but caches the name's slot in the current proc on the name */
+  Var *get_var(Obj *name);
   Status set_var(const string &name, const string &val);
+  /** Set a variable to a value; the variable takes its own reference */
+  Status set_var(const string_view &name, Obj *val);
+  Status set_var(Obj *name, Obj *val);
+  /** Search callframes[frame] and every frame outside it */
+  Var *find_var(size_t frame, const string_view &name);
+  /** Create an unset variable in the innermost frame, at slot if it is a proc frame */
+  Var *create_var(const string_view &name, uint32_t slot);
+
+  /** Set the result to a value, taking over the caller's reference */
+  void set_result(Obj *o);
+  void set_result_int(int value) { set_result(obj_new_int(value)); }
+  void reset_result();
+  /** The result as a value, with a reference for the caller */
+  Obj *take_result();
+  const string &result_string() { return result_obj ? obj_string(result_obj) : result; }
+  /** Copy a value result into result */
+  void sync_result();
+  /** Set an error message as the result and return S_ERR */
+  Status error(const char *fmt, ...);
+
   bool arity_check(const string &name, const vector<string> &argv, size_t min, size_t max);
+  bool arity_check(const char *name, const vector<Obj *> &objv, size_t min, size_t max);
   bool int_check(const string &name, const vector<string> &argv, size_t idx);
   Status eval(const string_view &str);
+  /** Run a compiled script */
+  Status exec(Script *script);
+  /** Compiled form of source, from the cache if possible. Returns a new reference. */
+  Script *compile_cached(const string_view &source);
+  void flush_script_cache();
+
+  // Expressions compiled by expr, cached like scripts
+  HashMap<Expr *> expr_cache_;
+  vector<Expr *> expr_cache_list_;
+  /** Compiled expression from the cache if possible. Returns a new reference, or nullptr with an error result. */
+  Expr *compile_expr_cached(const string_view &source);
+  void flush_expr_cache();
+  Status eval_expr(Expr *e, int *out);
 
   // I/O methods - use configured backend or default to console
   void set_io(TclIO *io);
@@ -177,7 +445,7 @@ struct Interp {
 };
 
 // Global functions
-Status call_proc(Interp &i, vector<string> &argv, ProcPrivdata *privdata);
+Status call_proc(Interp &i, vector<Obj *> &objv, ProcPrivdata *privdata);
 void register_core_commands(Interp &i);
 
 // Helper for printing escaped strings
@@ -189,6 +457,7 @@ void format_error(string &result, const char *fmt, ...);
 // List helper functions
 void list_parse(const string_view &list_str, vector<string> &elements);
 void list_format(const vector<string> &elements, string &result);
+void list_append_element(string &result, const string &elem);
 
 // Inline helper functions for performance
 
@@ -240,6 +509,18 @@ inline bool Interp::arity_check(const string &name, const vector<string> &argv,
   return true;
 }
 
+inline bool Interp::arity_check(const char *name, const vector<Obj *> &objv, size_t min, size_t max) {
+  if (min == max && objv.size() != min) {
+    error("wrong number of args for %s (expected %zu)", name, min);
+    return false;
+  }
+  if (objv.size() < min || objv.size() > max) {
+    error("[%s]: wrong number of args (expected %zu to %zu)", name, min, max);
+    return false;
+  }
+  return true;
+}
+
 } // namespace tcl
 
 #endif
@@ -8,7 +8,7 @@
 #include "ot/user/user.hpp"
 #include "ot/vendor/tlsf/tlsf.h"
 
-enum ProgramType { UNKNOWN, SHELL, UISHELL, SCRATCH, SPACEDEMO, TYPEDEMO, ECHO, GFXSCRATCH, EDIT };
+enum ProgramType { UNKNOWN, SHELL, UISHELL, SCRATCH, SPACEDEMO, TYPEDEMO, ECHO, GFXSCRATCH, EDIT, IPCBENCH };
 
 ProgramType determine_program_type() {
   PageAddr arg_page = ou_get_arg_page();
@@ -70,6 +70,9 @@ ProgramType determine_program_type() {
     if (arg.equals("edit")) {
       return EDIT;
     }
+    if (arg.equals("ipc-bench")) {
+      return IPCBENCH;
+    }
   }
 
   return UNKNOWN;
@@ -94,6 +97,8 @@ void user_program_main(void) {
     gfxscratch_main();
   } else if (program_type == EDIT) {
     edit_main();
+  } else if (program_type == IPCBENCH) {
+    ipcbench_main();
   } else {
     const char *str = "unknown program type, exiting\n";
     ou_io_puts(str, strlen(str));
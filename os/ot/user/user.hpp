@@ -17,6 +17,14 @@ int ogetchar();
 }
 
 void ou_yield(void);
+/**
+ * Block until there may be something to do: input arrives, another process
+ * sends this one an IPC message, or o_time_get() reaches deadline (0 for no
+ * deadline). Wakeups can be early, so callers re-check what they wait for.
+ * On WASM this lets an idle system return to the host's event loop instead of
+ * spinning through ou_yield(); elsewhere it is currently just a yield.
+ */
+void ou_wait(uint64_t deadline);
 void ou_exit(void);
 void ou_shutdown(void);
 void *ou_alloc_pages(size_t count);
@@ -9,14 +9,50 @@
 
 namespace ou {
 
+/**
+ * Whether a T can be moved by copying its bytes, leaving nothing to destroy.
+ * Types holding pointers into themselves (like string's inline buffer) can't.
+ */
+template <typename T> struct is_trivially_relocatable {
+  static constexpr bool value = __is_trivially_copyable(T);
+};
+
 /**
  * Dynamic array template using ou_malloc/ou_free
  */
 template <typename T> class vector {
-private:
+protected:
   T *data_;
   size_t size_;
   size_t cap_;
+  T *inline_; // A small_vector's inline buffer, or nullptr
+
+  // For small_vector: start out using an inline buffer
+  vector(T *inline_buffer, size_t inline_cap)
+      : data_(inline_buffer), size_(0), cap_(inline_cap), inline_(inline_buffer) {}
+
+  bool is_inline() const { return inline_ && data_ == inline_; }
+
+  // Move count elements from src to dst; the ranges may overlap. src may be
+  // null when count is 0, which memmove doesn't allow
+  static void relocate(T *dst, T *src, size_t count) {
+    if (count == 0) {
+      return;
+    }
+    if (is_trivially_relocatable<T>::value) {
+      memmove((void *)dst, (const void *)src, count * sizeof(T));
+    } else if (dst < src) {
+      for (size_t i = 0; i < count; i++) {
+        new (&dst[i]) T(static_cast<T &&>(src[i]));
+        src[i].~T();
+      }
+    } else {
+      for (size_t i = count; i > 0; i--) {
+        new (&dst[i - 1]) T(static_cast<T &&>(src[i - 1]));
+        src[i - 1].~T();
+      }
+    }
+  }
 
   void ensure_capacity(size_t new_cap) {
     if (new_cap <= cap_)
@@ -25,36 +61,61 @@ private:
     while (alloc_cap < new_cap)
       alloc_cap *= 2;
     T *new_data = (T *)ou_malloc(alloc_cap * sizeof(T));
-    if (data_) {
-      for (size_t i = 0; i < size_; i++) {
-        new (&new_data[i]) T(static_cast<T &&>(data_[i]));
-        data_[i].~T();
-      }
+    relocate(new_data, data_, size_);
+    if (data_ && !is_inline()) {
       ou_free(data_);
     }
     data_ = new_data;
     cap_ = alloc_cap;
   }
 
-public:
-  vector() : data_(nullptr), size_(0), cap_(0) {}
-
-  ~vector() {
-    if (data_) {
-      for (size_t i = 0; i < size_; i++) {
-        data_[i].~T();
-      }
+  // Destroy the elements and free a heap buffer, leaving data_ dangling
+  void release() {
+    for (size_t i = 0; i < size_; i++) {
+      data_[i].~T();
+    }
+    if (data_ && !is_inline()) {
       ou_free(data_);
     }
+    size_ = 0;
   }
 
-  // Move constructor
-  vector(vector &&other) noexcept : data_(other.data_), size_(other.size_), cap_(other.cap_) {
-    other.data_ = nullptr;
+  // Take other's elements: its heap buffer if it has one, otherwise by moving
+  // them out of its inline buffer. Leaves other empty.
+  void move_from(vector &other) {
+    if (other.is_inline()) {
+      ensure_capacity(other.size_);
+      relocate(data_, other.data_, other.size_);
+      size_ = other.size_;
+      other.size_ = 0;
+      return;
+    }
+    release();
+    data_ = other.data_;
+    size_ = other.size_;
+    cap_ = other.cap_;
+    // An inline buffer isn't reused once given up, which keeps this simple
+    other.data_ = other.inline_;
     other.size_ = 0;
     other.cap_ = 0;
   }
 
+public:
+  vector() : data_(nullptr), size_(0), cap_(0), inline_(nullptr) {}
+
+  ~vector() { release(); }
+
+  // Move constructor
+  vector(vector &&other) noexcept : data_(nullptr), size_(0), cap_(0), inline_(nullptr) { move_from(other); }
+
+  vector &operator=(vector &&other) noexcept {
+    if (this != &other) {
+      clear();
+      move_from(other);
+    }
+    return *this;
+  }
+
   // Copy is deleted
   vector(const vector &) = delete;
   vector &operator=(const vector &) = delete;
@@ -114,31 +175,22 @@ public:
     size_ = 0;
   }
 
-  void insert(size_t pos, const T &val) {
-    if (pos > size_)
-      pos = size_;
-    ensure_capacity(size_ + 1);
-    // Move existing elements to make room
-    for (size_t i = size_; i > pos; i--) {
-      new (&data_[i]) T(static_cast<T &&>(data_[i - 1]));
-      data_[i - 1].~T();
-    }
-    // Insert new element
-    new (&data_[pos]) T(val);
-    size_++;
-  }
+  void insert(size_t pos, const T &val) { insert(pos, 1, val); }
 
   void insert(size_t pos, size_t count, const T &val) {
     if (count == 0)
       return;
     if (pos > size_)
       pos = size_;
+    if (size_ + count > cap_ && &val >= data_ && &val < data_ + size_) {
+      // val is about to move; insert a copy
+      T copy(val);
+      insert(pos, count, copy);
+      return;
+    }
     ensure_capacity(size_ + count);
     // Move existing elements to make room
-    for (size_t i = size_ + count - 1; i >= pos + count; i--) {
-      new (&data_[i]) T(static_cast<T &&>(data_[i - count]));
-      data_[i - count].~T();
-    }
+    relocate(data_ + pos + count, data_ + pos, size_ - pos);
     // Insert new elements
     for (size_t i = 0; i < count; i++) {
       new (&data_[pos + i]) T(val);
@@ -146,18 +198,7 @@ public:
     size_ += count;
   }
 
-  void erase(size_t pos) {
-    if (pos >= size_)
-      return;
-    // Destroy element at pos
-    data_[pos].~T();
-    // Move elements after pos forward
-    for (size_t i = pos; i < size_ - 1; i++) {
-      new (&data_[i]) T(static_cast<T &&>(data_[i + 1]));
-      data_[i + 1].~T();
-    }
-    size_--;
-  }
+  void erase(size_t pos) { erase(pos, 1); }
 
   void erase(size_t pos, size_t count) {
     if (count == 0 || pos >= size_)
@@ -170,10 +211,7 @@ public:
       data_[i].~T();
     }
     // Move elements after erased range forward
-    for (size_t i = pos; i < size_ - count; i++) {
-      new (&data_[i]) T(static_cast<T &&>(data_[i + count]));
-      data_[i + count].~T();
-    }
+    relocate(data_ + pos, data_ + pos + count, size_ - pos - count);
     size_ -= count;
   }
 
@@ -184,6 +222,27 @@ public:
   const T *end() const { return data_ + size_; }
 };
 
+/**
+ * Vector with room for N elements inline, so it only allocates once it grows
+ * past N. Usable anywhere a vector<T> & is expected.
+ */
+template <typename T, size_t N> class small_vector : public vector<T> {
+public:
+  small_vector() : vector<T>(reinterpret_cast<T *>(buffer_), N) {}
+  small_vector(small_vector &&other) noexcept : small_vector() { this->move_from(other); }
+
+  small_vector &operator=(small_vector &&other) noexcept {
+    vector<T>::operator=(static_cast<vector<T> &&>(other));
+    return *this;
+  }
+
+  /** True while the elements are in the inline buffer */
+  bool is_inline() const { return vector<T>::is_inline(); }
+
+private:
+  alignas(T) char buffer_[N * sizeof(T)];
+};
+
 } // namespace ou
 
 #endif
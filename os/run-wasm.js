@@ -3,6 +3,12 @@
 // run-wasm.js - Node.js test runner for Otium OS WASM build
 //
 // Usage: node run-wasm.js [build-dir]
+//        node run-wasm.js --bench-glue
+//
+// --bench-glue times the host side of frame flushes and file reads headlessly,
+// without loading a WASM build, and prints BENCH: lines in the format
+// bench-ipc.py reads (e.g. node run-wasm.js --bench-glue > log.txt, then
+// ./bench-ipc.py --platform wasm --input log.txt).
 //
 // Environment:
 //   OTIUM_TEST_MODE=1  - Run in test mode (no interactive input)
@@ -13,6 +19,105 @@ const readline = require('readline');
 
 const support = require('./wasm-support.js');
 
+// =============================================================================
+// Glue benchmark
+// =============================================================================
+
+/**
+ * Run fn in batches and report the median and minimum time per call, like
+ * bench_case in ot/user/prog-ipc-bench.cpp
+ */
+function benchCase(name, batch, fn) {
+  const samples = 31;
+  const times = [];
+  fn(); // Warm up the JIT
+  for (let s = 0; s < samples; s++) {
+    const start = process.hrtime.bigint();
+    for (let i = 0; i < batch; i++) {
+      fn();
+    }
+    times.push(Number(process.hrtime.bigint() - start) / batch);
+  }
+  times.sort((a, b) => a - b);
+  const median = Math.round(times[samples >> 1]);
+  const min = Math.round(times[0]);
+  console.log(`BENCH: ${name.padEnd(32)} ${String(median).padStart(10)} ${String(min).padStart(10)} ns/op`);
+}
+
+function benchGlue() {
+  // A stand-in for WASM memory, laid out like a running system: the
+  // framebuffer, then a comm page to read file chunks into
+  const width = 1024;
+  const height = 700;
+  const memory = new ArrayBuffer(width * height * 4 + 4096);
+  const HEAPU8 = new Uint8Array(memory);
+  const HEAP32 = new Int32Array(memory);
+  const pixels = HEAP32.subarray(0, width * height);
+  const commPage = width * height * 4;
+  for (let i = 0; i < pixels.length; i++) {
+    pixels[i] = 0xFF000000 | (i * 2654435761);
+  }
+  const rgba = new Uint32Array(width * height);
+  const rgbaBytes = new Uint8Array(rgba.buffer);
+
+  console.log('BENCH: start glue');
+
+  // Before word-wise conversion, each flush assembled RGBA a byte at a time
+  benchCase('flush frame bytewise (reference)', 4, () => {
+    for (let i = 0; i < pixels.length; i++) {
+      const pixel = pixels[i];
+      const offset = i * 4;
+      rgbaBytes[offset + 0] = (pixel >> 16) & 0xFF;
+      rgbaBytes[offset + 1] = (pixel >> 8) & 0xFF;
+      rgbaBytes[offset + 2] = pixel & 0xFF;
+      rgbaBytes[offset + 3] = (pixel >> 24) & 0xFF;
+    }
+  });
+  benchCase('flush frame', 4, () => support.convertRegion(pixels, rgba, width, 0, 0, width, height));
+  benchCase('flush damage 8x16 glyph', 1000, () => support.convertRegion(pixels, rgba, width, 512, 300, 8, 16));
+  benchCase('flush damage 1024x16 line', 100, () => support.convertRegion(pixels, rgba, width, 0, 300, width, 16));
+
+  // File reads as impl-wasm does them: one comm page per request
+  const fsCallbacks = support.filesystemCallbacks;
+  const fileSize = 1024 * 1024;
+  const contents = new Uint8Array(fileSize);
+  for (let i = 0; i < fileSize; i++) {
+    contents[i] = i * 31;
+  }
+  fsCallbacks.fsWriteFile('/bench-glue.bin', contents);
+
+  benchCase('fs read 1 MiB bytewise (reference)', 1, () => {
+    for (let offset = 0; offset < fileSize; offset += 4096) {
+      const data = fsCallbacks.fsReadFile('/bench-glue.bin');
+      for (let i = 0; i < 4096; i++) {
+        HEAPU8[commPage + i] = data[offset + i];
+      }
+    }
+  });
+  benchCase('fs read 4 KiB', 1000, () => {
+    const data = fsCallbacks.fsReadFile('/bench-glue.bin');
+    HEAPU8.set(data.subarray(0, 4096), commPage);
+  });
+  benchCase('fs read 1 MiB', 1, () => {
+    for (let offset = 0; offset < fileSize; offset += 4096) {
+      const data = fsCallbacks.fsReadFile('/bench-glue.bin');
+      HEAPU8.set(data.subarray(offset, offset + 4096), commPage);
+    }
+  });
+  benchCase('fs write 4 KiB', 1000, () => {
+    fsCallbacks.fsWriteFile('/bench-glue-out.bin', HEAPU8.slice(commPage, commPage + 4096));
+  });
+
+  fsCallbacks.fsDeleteFile('/bench-glue.bin');
+  fsCallbacks.fsDeleteFile('/bench-glue-out.bin');
+  console.log('BENCH: done');
+}
+
+if (process.argv[2] === '--bench-glue') {
+  benchGlue();
+  process.exit(0);
+}
+
 // Get build directory from command line args or use default
 const buildDirArg = process.argv[2] || 'build-wasm';
 const buildDir = path.isAbsolute(buildDirArg)
@@ -72,6 +177,7 @@ const Module = {
     return true;
   },
   graphicsFlush: support.graphicsFlush,
+  graphicsFlushRects: support.graphicsFlushRects,
   graphicsCleanup: function() {
     console.log('Graphics cleanup');
     support.graphicsCleanup();
@@ -85,6 +191,9 @@ const Module = {
   // Filesystem callbacks
   ...support.filesystemCallbacks,
 
+  // Scheduler idle wait, ended early by input
+  idleWait: support.idleWait,
+
   // Exit handler
   exit: (status) => {
     const fsOutDir = path.join(__dirname, 'fs-out');
@@ -128,6 +237,7 @@ const Module = {
           inputBuffer.push(line.charCodeAt(i));
         }
         inputBuffer.push(13);
+        support.wakeIdle();
       });
 
       rl.on('close', () => {
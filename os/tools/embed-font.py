@@ -2,20 +2,86 @@
 """
 Embed a binary file as a C++ byte array header.
 Usage: embed-font.py <input.ttf> <output.hpp> <variable_name>
+
+With --atlas, pre-rasterise printable ASCII at the given pixel sizes instead and
+emit 8-bit coverage atlases with glyph and line metrics (see ot/lib/font-atlas.hpp).
+Glyphs are rendered by the vendored libschrift, built for the host with $CC, so
+atlas pixels are identical to what the runtime rasteriser would produce.
+Usage: embed-font.py --atlas 14,16,20 <input.ttf> <output.hpp> <variable_name>
 """
 
 import sys
 import os
+import subprocess
+import tempfile
 
-def main():
-    if len(sys.argv) != 4:
-        print("Usage: embed-font.py <input.ttf> <output.hpp> <variable_name>")
-        sys.exit(1)
+FIRST_CHAR = 32
+LAST_CHAR = 126
+
+SCHRIFT_DIR = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'ot', 'vendor', 'libschrift')
+
+# Host helper: prints line metrics, then one line per glyph with its metrics
+# and coverage bytes in hex
+RASTER_SOURCE = r"""
+#include <stdio.h>
+#include <stdlib.h>
+#include "schrift.h"
+
+/* Referenced by schrift.c; unused since no arena is passed */
+void *sft_arena_alloc(void *arena, size_t size) { return NULL; }
+void *sft_arena_alloc_zeroed(void *arena, size_t size) { return NULL; }
 
-    input_file = sys.argv[1]
-    output_file = sys.argv[2]
-    var_name = sys.argv[3]
+int main(int argc, char **argv) {
+  SFT sft = {0};
+  SFT_LMetrics lm;
+  int size = atoi(argv[2]);
+  unsigned cp;
 
+  sft.font = sft_loadfile(argv[1]);
+  if (!sft.font) {
+    return 1;
+  }
+  sft.xScale = sft.yScale = (double)size;
+  sft.flags = SFT_DOWNWARD_Y;
+  if (sft_lmetrics(&sft, &lm) < 0) {
+    return 1;
+  }
+  printf("%d %d %d\n", (int)lm.ascender, (int)lm.descender, (int)lm.lineGap);
+
+  for (cp = %FIRST%; cp <= %LAST%; cp++) {
+    SFT_Glyph glyph;
+    SFT_GMetrics gm;
+    SFT_Image image;
+    int i, w = 0, h = 0;
+    unsigned char *pixels = NULL;
+
+    if (sft_lookup(&sft, cp, &glyph) < 0 || sft_gmetrics(&sft, glyph, &gm) < 0) {
+      return 1;
+    }
+    if (gm.minWidth > 0 && gm.minHeight > 0) {
+      w = gm.minWidth;
+      h = gm.minHeight;
+      pixels = calloc((size_t)w * h, 1);
+      image.pixels = pixels;
+      image.width = w;
+      image.height = h;
+      if (sft_render(&sft, glyph, image) < 0) {
+        return 1;
+      }
+    }
+    printf("%d %d %d %d %d ", (int)gm.advanceWidth, (int)gm.leftSideBearing, gm.yOffset, w, h);
+    for (i = 0; i < w * h; i++) {
+      printf("%02x", pixels[i]);
+    }
+    printf("\n");
+    free(pixels);
+  }
+  return 0;
+}
+"""
+
+
+def embed_binary(input_file, output_file, var_name):
     with open(input_file, 'rb') as f:
         data = f.read()
 
@@ -51,5 +117,106 @@ static const size_t {var_name}_size = {len(data)};
 
     print(f"Generated {output_file} ({len(data)} bytes)")
 
+
+def build_rasteriser(workdir):
+    source = os.path.join(workdir, 'raster.c')
+    binary = os.path.join(workdir, 'raster')
+    with open(source, 'w') as f:
+        f.write(RASTER_SOURCE.replace('%FIRST%', str(FIRST_CHAR)).replace('%LAST%', str(LAST_CHAR)))
+    cc = os.environ.get('CC', 'cc')
+    subprocess.run([cc, '-std=c99', '-O2', '-I', SCHRIFT_DIR, source, os.path.join(SCHRIFT_DIR, 'schrift.c'),
+                    '-lm', '-o', binary], check=True)
+    return binary
+
+
+def rasterise(binary, input_file, size):
+    out = subprocess.run([binary, input_file, str(size)], check=True, capture_output=True, text=True).stdout
+    lines = out.splitlines()
+    line_metrics = [int(v) for v in lines[0].split()]
+    glyphs = []
+    for line in lines[1:]:
+        fields = line.split()
+        advance, lsb, y_offset, w, h = (int(v) for v in fields[:5])
+        coverage = bytes.fromhex(fields[5]) if len(fields) > 5 else b''
+        glyphs.append((advance, lsb, y_offset, w, h, coverage))
+    return line_metrics, glyphs
+
+
+def byte_lines(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append('  ' + ', '.join(f'0x{b:02x}' for b in data[i:i+16]) + ',')
+    return lines
+
+
+def embed_atlas(sizes, input_file, output_file, var_name):
+    guard = os.path.basename(output_file).upper().replace('.', '_').replace('-', '_')
+
+    with tempfile.TemporaryDirectory() as workdir:
+        binary = build_rasteriser(workdir)
+        atlases = [(size, *rasterise(binary, input_file, size)) for size in sizes]
+
+    body = []
+    entries = []
+    total = 0
+    for size, (ascender, descender, line_gap), glyphs in atlases:
+        coverage = bytearray()
+        glyph_lines = []
+        for i, (advance, lsb, y_offset, w, h, pixels) in enumerate(glyphs):
+            assert w < 256 and h < 256, f'glyph {FIRST_CHAR + i} too large for the atlas'
+            glyph_lines.append(f'  {{{advance}, {lsb}, {y_offset}, {w}, {h}, {len(coverage)}}}, '
+                               f'// {chr(FIRST_CHAR + i)!r}')
+            coverage += pixels
+        total += len(coverage)
+
+        body.append(f'static const app::AtlasGlyph {var_name}_{size}_glyphs[] = {{')
+        body.extend(glyph_lines)
+        body.append('};')
+        body.append('')
+        body.append(f'static const uint8_t {var_name}_{size}_coverage[] = {{')
+        body.extend(byte_lines(coverage))
+        body.append('};')
+        body.append('')
+        entries.append(f'  {{{size}, {ascender}, {descender}, {line_gap}, {FIRST_CHAR}, {len(glyphs)}, '
+                       f'{var_name}_{size}_glyphs, {var_name}_{size}_coverage}},')
+
+    header = f"""// Auto-generated file - do not edit
+// Generated from: {os.path.basename(input_file)} (embed-font.py --atlas {','.join(str(s) for s in sizes)})
+// Coverage: {total} bytes
+
+#ifndef {guard}
+#define {guard}
+
+#include "ot/lib/font-atlas.hpp"
+
+{chr(10).join(body)}
+static const app::FontAtlas {var_name}[] = {{
+{chr(10).join(entries)}
+}};
+
+static const int {var_name}_count = {len(entries)};
+
+#endif // {guard}
+"""
+
+    with open(output_file, 'w') as f:
+        f.write(header)
+
+    print(f"Generated {output_file} ({len(entries)} sizes, {total} coverage bytes)")
+
+
+def main():
+    args = sys.argv[1:]
+    if len(args) == 5 and args[0] == '--atlas':
+        sizes = [int(s) for s in args[1].split(',')]
+        embed_atlas(sizes, args[2], args[3], args[4])
+        return
+
+    if len(args) != 3:
+        print("Usage: embed-font.py [--atlas <sizes>] <input.ttf> <output.hpp> <variable_name>")
+        sys.exit(1)
+
+    embed_binary(args[0], args[1], args[2])
+
 if __name__ == '__main__':
     main()
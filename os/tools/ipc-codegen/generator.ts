@@ -25,6 +25,9 @@ interface TemplateContext {
   extractMsgArgs: (method: Method) => string;
   isComplexType: (arg: Arg | Return) => boolean;
   hasComplexArgs: (method: Method) => boolean;
+  streamArg: (method: Method) => Arg | undefined;
+  hasStreams: (service: Service) => boolean;
+  formatStreamIpcArgs: (method: Method) => string;
   usesIntAliases: (service: Service) => boolean;
 }
 
@@ -58,6 +61,7 @@ function getType(arg: Arg | Return): string {
   if (type === "string") return "const ou::string&";
   if (type === "cstring") return "const char*";  // No allocation needed
   if (type === "buffer") return "const ou::vector<uint8_t>&";
+  if (type === "stream") return "const StringView&";  // Uploads; downloads return a StreamReader
   if (type === "uint") return "uintptr_t";
 
   // Check if this is an int alias
@@ -75,6 +79,9 @@ function getServerType(arg: Arg | Return): string {
   if (type === "string") return "const ou::string&";
   if (type === "cstring") return "const StringView&";  // Zero-copy from comm page
   if (type === "buffer") return "const StringView&";  // Zero-copy from comm page
+  if (type === "stream") {
+    return (arg as Arg).direction === "upload" ? "const StreamChunk&" : "StreamWriter&";
+  }
   if (type === "uint") return "uintptr_t";
 
   // Check if this is an int alias
@@ -95,6 +102,14 @@ function hasComplexArgs(method: Method): boolean {
   return method.args.some(isComplexType);
 }
 
+function streamArg(method: Method): Arg | undefined {
+  return method.args.find((arg) => arg.type === "stream");
+}
+
+function hasStreams(service: Service): boolean {
+  return service.methods.some((method) => streamArg(method) !== undefined);
+}
+
 function getReturnType(method: Method): string {
   if (method.returns.length === 0) {
     return "bool"; // For void methods, return bool (always true on success)
@@ -106,6 +121,8 @@ function getReturnType(method: Method): string {
 }
 
 function formatArgs(args: Arg[]): string {
+  // A download stream is the client method's result, not a parameter
+  args = args.filter((arg) => !(arg.type === "stream" && arg.direction === "download"));
   if (args.length === 0) return "";
   return args.map((arg) => `${getType(arg)} ${arg.name}`).join(", ");
 }
@@ -118,7 +135,7 @@ function formatServerArgs(args: Arg[]): string {
 
 function formatIpcArgs(args: Arg[]): string {
   // Only include non-complex (int/uint) args for IPC inline args
-  const simpleArgs = args.filter(arg => !isComplexType(arg));
+  const simpleArgs = args.filter(arg => !isComplexType(arg) && arg.type !== "stream");
   const argNames = simpleArgs.map((arg) => {
     const type = arg.type || "int";
     // If it's an int alias, extract raw value
@@ -134,6 +151,13 @@ function formatIpcArgs(args: Arg[]): string {
   return argNames.slice(0, 3).join(", ");
 }
 
+// Inline arguments ahead of a stream's own, as "count, arg0, arg1" for
+// StreamReader and ipc_stream_upload
+function formatStreamIpcArgs(method: Method): string {
+  const simpleArgs = formatIpcArgs(method.args).split(", ").slice(0, method.args.length - 1);
+  return [String(simpleArgs.length), ...simpleArgs].join(", ");
+}
+
 function extractMsgArgs(method: Method): string {
   if (method.args.length === 0) return "";
   return method.args
@@ -177,6 +201,9 @@ function createContext(data: Partial<TemplateContext>): TemplateContext {
     extractMsgArgs,
     isComplexType,
     hasComplexArgs,
+    streamArg,
+    hasStreams,
+    formatStreamIpcArgs,
     usesIntAliases,
   };
 }
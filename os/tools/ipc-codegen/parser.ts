@@ -12,8 +12,9 @@ export interface IntAlias {
 
 export interface Arg {
   name: string;
-  type?: string;    // Type: "int" (default), "uint", "string", "buffer"
+  type?: string;    // Type: "int" (default), "uint", "string", "buffer", "stream"
   signed?: boolean; // Defaults to true if omitted (for backward compat with int/uint)
+  direction?: "download" | "upload"; // For streams: server to client, or client to server
 }
 
 export interface Return {
@@ -49,6 +50,39 @@ export interface ParsedIDL {
   errorCodes: ErrorCodeDef[];
 }
 
+// A stream takes over the comm page and the inline arguments after the
+// method's own (cursor for downloads; offset and length for uploads), so it
+// can't be combined with other comm page arguments or with return values
+function validateStreamArgs(service: string, method: string, args: Arg[], returns: unknown[]) {
+  const streams = args.filter((arg) => arg.type === "stream");
+  if (streams.length === 0) {
+    return;
+  }
+  const where = `${service}.${method}`;
+  if (streams.length > 1) {
+    throw new Error(`${where}: at most one stream argument is allowed`);
+  }
+  const stream = streams[0];
+  if (stream.direction !== "download" && stream.direction !== "upload") {
+    throw new Error(`${where}: stream direction must be "download" or "upload"`);
+  }
+  // The generated code carries the stream's cursor (or chunk) in the slots after the other arguments
+  if (args[args.length - 1] !== stream) {
+    throw new Error(`${where}: the stream argument must be the last argument`);
+  }
+  if (args.some((arg) => ["string", "cstring", "buffer"].includes(arg.type || "int"))) {
+    throw new Error(`${where}: a stream can't be combined with string or buffer arguments`);
+  }
+  if (returns.length > 0) {
+    throw new Error(`${where}: methods with a stream argument can't have return values`);
+  }
+  const inline = args.length - 1;
+  const maxInline = stream.direction === "download" ? 2 : 1;
+  if (inline > maxInline) {
+    throw new Error(`${where}: a stream ${stream.direction} allows at most ${maxInline} other argument(s)`);
+  }
+}
+
 export async function parseIDL(filePath: string): Promise<ParsedIDL> {
   const content = await Deno.readTextFile(filePath);
   const yaml: any = parse(content);
@@ -95,8 +129,12 @@ export async function parseIDL(filePath: string): Promise<ParsedIDL> {
         }
         const type = arg.type || "int";
         const signed = arg.signed ?? (type === "int");
+        if (type === "stream") {
+          return { name: arg.name, type, signed, direction: arg.direction ?? "download" };
+        }
         return { name: arg.name, type, signed };
       });
+      validateStreamArgs(svc.name, method.name, args, method.returns || []);
 
       const returns: Return[] = (method.returns || []).map((ret: any) => {
         if (typeof ret === "string") {
@@ -3,6 +3,7 @@
 // This module provides:
 // - In-memory filesystem with fs-in/fs-out sync (Node.js)
 // - Graphics support via SDL (optional)
+// - Idle waiting for the kernel scheduler
 // - Module callbacks for WASM runtime
 
 const fs = require('fs');
@@ -182,6 +183,15 @@ let sdl = null;
 let sdlAvailable = false;
 let window = null;
 let pixelBuffer = null;
+let pixelWords = null; // Uint32Array view of pixelBuffer
+
+// The framebuffer holds 0xAARRGGBB words, i.e. B, G, R, A bytes in memory,
+// which SDL calls bgra32. While SDL accepts that format, frames are rendered
+// straight out of WASM memory and never converted; otherwise they are swizzled
+// into pixelBuffer as rgba32, and pixelBufferStale forces one full conversion
+// after switching over.
+let renderNative = true;
+let pixelBufferStale = true;
 
 // SDL key (string) to DOM code mapping
 // SDL returns key as a string like "a", "escape", etc.
@@ -253,7 +263,9 @@ function graphicsInit(width, height) {
       resizable: false,
     });
 
-    pixelBuffer = Buffer.allocUnsafe(width * height * 4);
+    pixelBuffer = Buffer.alloc(width * height * 4);
+    pixelWords = new Uint32Array(pixelBuffer.buffer, pixelBuffer.byteOffset, width * height);
+    pixelBufferStale = true;
 
     // Set up keyboard event handlers now that window exists
     window.on('keyDown', (event) => {
@@ -292,29 +304,87 @@ function graphicsInit(width, height) {
   }
 }
 
-function graphicsFlush(pixels, width, height) {
-  if (!sdl || !window || !pixelBuffer) {
-    return;
+/**
+ * Convert one rectangle of the BGRA framebuffer into RGBA, a word at a time:
+ * swapping the R and B bytes of each 0xAARRGGBB pixel gives 0xAABBGGRR, which
+ * is R, G, B, A in memory on a little-endian host.
+ */
+function convertRegion(pixels, out, width, x, y, w, h) {
+  for (let row = y; row < y + h; row++) {
+    const end = row * width + x + w;
+    for (let i = row * width + x; i < end; i++) {
+      const pixel = pixels[i];
+      out[i] = (pixel & 0xFF00FF00) | ((pixel >>> 16) & 0xFF) | ((pixel & 0xFF) << 16);
+    }
   }
+}
 
+/**
+ * Hand a frame to SDL. Returns false if SDL rejected the format, in which case
+ * the caller falls back to rgba32.
+ */
+function renderFrame(buffer, format, width, height) {
   try {
-    // Convert BGRA to RGBA
-    for (let i = 0; i < width * height; i++) {
-      const pixel = pixels[i];
-      const offset = i * 4;
-      pixelBuffer[offset + 0] = (pixel >> 16) & 0xFF; // R
-      pixelBuffer[offset + 1] = (pixel >> 8) & 0xFF;  // G
-      pixelBuffer[offset + 2] = pixel & 0xFF;         // B
-      pixelBuffer[offset + 3] = (pixel >> 24) & 0xFF; // A
-    }
-    window.render(width, height, width * 4, 'rgba32', pixelBuffer);
+    window.render(width, height, width * 4, format, buffer);
+    return true;
   } catch (e) {
     if (e.message && e.message.includes('window is destroyed')) {
       console.log('\nWindow closed by user, exiting...');
       process.exit(0);
     }
+    if (format !== 'rgba32') {
+      console.log(`[SDL] Cannot render ${format} (${e.message}), converting frames to rgba32`);
+      return false;
+    }
     console.error('Graphics flush error:', e);
+    return true;
+  }
+}
+
+function renderNativeFrame(pixels, width, height) {
+  const frame = Buffer.from(pixels.buffer, pixels.byteOffset, width * height * 4);
+  if (renderFrame(frame, 'bgra32', width, height)) {
+    return true;
+  }
+  renderNative = false;
+  return false;
+}
+
+function graphicsFlush(pixels, width, height) {
+  if (!sdl || !window || !pixelBuffer) {
+    return;
+  }
+
+  if (renderNative && renderNativeFrame(pixels, width, height)) {
+    return;
+  }
+  convertRegion(pixels, pixelWords, width, 0, 0, width, height);
+  pixelBufferStale = false;
+  renderFrame(pixelBuffer, 'rgba32', width, height);
+}
+
+/**
+ * Flush only damaged regions. rects is an Int32Array of (x, y, w, h) quadruples,
+ * already clipped to the framebuffer. When frames have to be converted, pixels
+ * outside the damage keep their previously converted contents in pixelBuffer.
+ */
+function graphicsFlushRects(pixels, width, height, rects) {
+  if (!sdl || !window || !pixelBuffer) {
+    return;
+  }
+
+  if (renderNative && renderNativeFrame(pixels, width, height)) {
+    return;
+  }
+  if (pixelBufferStale) {
+    convertRegion(pixels, pixelWords, width, 0, 0, width, height);
+    pixelBufferStale = false;
+  } else {
+    for (let i = 0; i + 3 < rects.length; i += 4) {
+      convertRegion(pixels, pixelWords, width, rects[i], rects[i + 1], rects[i + 2], rects[i + 3]);
+    }
   }
+  renderFrame(pixelBuffer, 'rgba32', width, height);
 }
 
 function graphicsCleanup() {
@@ -323,6 +393,51 @@ function graphicsCleanup() {
     window = null;
   }
   pixelBuffer = null;
+  pixelWords = null;
+}
+
+// =============================================================================
+// Idle Support
+// =============================================================================
+
+// When every process is blocked, the kernel scheduler awaits idleWait instead
+// of spinning. Input (keyboard events here, console lines in run-wasm.js)
+// calls wakeIdle to end the wait early.
+let idleWake = null;
+let inputWhileBusy = false;
+
+// Without a deadline, still check back every so often; a pending timer also
+// keeps Node from exiting while the kernel waits
+const IDLE_MAX_MS = 1000;
+
+/**
+ * Wait for up to timeoutMs (-1: no deadline). Resolves to true if input arrived
+ * during the wait or since the previous one.
+ */
+function idleWait(timeoutMs) {
+  if (inputWhileBusy) {
+    inputWhileBusy = false;
+    return Promise.resolve(true);
+  }
+  return new Promise((resolve) => {
+    const timer = setTimeout(() => {
+      idleWake = null;
+      resolve(false);
+    }, timeoutMs < 0 ? IDLE_MAX_MS : timeoutMs);
+    idleWake = () => {
+      clearTimeout(timer);
+      idleWake = null;
+      resolve(true);
+    };
+  });
+}
+
+function wakeIdle() {
+  if (idleWake) {
+    idleWake();
+  } else {
+    inputWhileBusy = true;
+  }
 }
 
 // =============================================================================
@@ -391,6 +506,7 @@ function keyboardHandleEvent(domCode, isKeyDown) {
   // Don't queue modifier-only events (matches VirtIO backend behavior)
   if (!isModifierKey(linuxCode)) {
     keyboardEventQueue.push({ code: linuxCode, flags: flags });
+    wakeIdle();
   }
 }
 
@@ -610,7 +726,13 @@ module.exports = {
   checkSdlAvailable,
   graphicsInit,
   graphicsFlush,
+  graphicsFlushRects,
   graphicsCleanup,
+  convertRegion,
+
+  // Idle
+  idleWait,
+  wakeIdle,
 
   // Keyboard
   keyboardInit,